@@ -20,6 +20,10 @@
 #include "../../common/dsp/constants.hpp"
 #include "../../common/dsp/smoother.hpp"
 
+#include "../../lib/vcl/vectorclass.h"
+
+#include <algorithm>
+#include <array>
 #include <cfloat>
 #include <random>
 
@@ -228,7 +232,7 @@ template<typename Sample> class ShortComb {
 public:
   constexpr static int bufEnd = 511;
 
-  std::array<Sample, bufEnd + 1> buf; // At least 20ms when samplerate is 192kHz.
+  std::array<Sample, bufEnd + 1> buf{}; // At least 20ms when samplerate is 192kHz.
   int wptr = 0;
   int rptr = 0;
   Sample r1 = 0;
@@ -259,124 +263,217 @@ public:
   }
 };
 
-// 2x oversampled delay.
-template<typename Sample> class Delay {
+// 2x oversampled delay for 16 strings. Each lane has its own delay time, and the write
+// pointer is shared because all strings advance in lockstep. Buffer is interleaved as
+// `buf[time][lane]` so writes are a single vector store, and reads are a gather.
+//
+// Reading and writing are split so that outputs of all strings are available before the
+// inputs are computed. Delay time is at least 2 samples to make the output of current
+// sample independent of the input of current sample.
+//
+// Buffer is owned by caller, so copying a delay doesn't copy the buffer. While a journal
+// is set, writes go to the journal instead of the buffer, and reads see the journal
+// first. This is used to render a copy of the delay without touching the buffer.
+// `endJournal()` moves the journal to the buffer.
+class alignas(64) Delay16 {
 public:
   constexpr static int bufEnd = 32767; // 2^15 - 1. 0x7fff.
-
-  std::array<Sample, bufEnd + 1> buf; // Min ~11.72Hz when samplerate is 192kHz.
-  Sample w1 = 0;
-  Sample rFraction = 0;
+  constexpr static int bufSize = bufEnd + 1; // Min ~11.72Hz when samplerate is 192kHz.
+  constexpr static int journalEnd = 255;     // 2 writes per sample, for 128 samples.
+  constexpr static int journalSize = journalEnd + 1;
+
+  Vec16f *buf = nullptr;
+  Vec16f *journal = nullptr;
+  int journalStart = 0;
+  int nJournal = 0;
+
+  Vec16f w1 = 0.0f;
+  Vec16f rFraction = 0.0f;
+  Vec16i rptr = 0;
   int wptr = 0;
-  int rptr = 0;
 
   void reset()
   {
-    w1 = 0;
-    buf.fill(0);
+    w1 = 0.0f;
+    std::fill(buf, buf + bufSize, Vec16f(0.0f));
   }
 
-  void setTime(Sample sampleRate, Sample seconds)
+  void beginJournal(Vec16f *journal)
   {
-    Sample timeInSample = std::clamp<Sample>(Sample(2) * sampleRate * seconds, 0, bufEnd);
+    this->journal = journal;
+    journalStart = wptr;
+    nJournal = 0;
+  }
+
+  void endJournal()
+  {
+    for (int i = 0; i < nJournal; ++i) buf[(journalStart + 1 + i) & bufEnd] = journal[i];
+    journal = nullptr;
+    nJournal = 0;
+  }
+
+  void setTime(int index, float sampleRate, float seconds)
+  {
+    float timeInSample = std::clamp<float>(2.0f * sampleRate * seconds, 2, bufEnd - 1);
     auto timeInt = int(timeInSample);
 
-    rFraction = timeInSample - Sample(timeInt);
+    rFraction.insert(index, timeInSample - float(timeInt));
 
-    rptr = wptr - timeInt;
-    if (rptr < 0) rptr += int(buf.size());
+    int r = wptr - timeInt;
+    if (r < 0) r += bufSize;
+    rptr.insert(index, r);
   }
 
-  Sample process(Sample input)
+  Vec16f read()
   {
-    // Write to buffer.
-    ++wptr;
-    wptr &= bufEnd;
-    buf[wptr] = Sample(0.5) * (input + w1);
+    const Vec16i i1 = (rptr + 1) & bufEnd;
+    const Vec16i i0 = (rptr + 2) & bufEnd;
+    rptr = i0;
 
-    ++wptr;
-    wptr &= bufEnd;
-    buf[wptr] = input;
+    if (journal == nullptr) return interpolate(gather(buf, i0), gather(buf, i1));
+    return interpolate(readJournaled(i0), readJournaled(i1));
+  }
 
+  void write(Vec16f input)
+  {
+    push(0.5f * (input + w1));
+    push(input);
     w1 = input;
+  }
 
-    // Read from buffer.
-    ++rptr;
-    rptr &= bufEnd;
-    const unsigned int i1 = rptr;
+private:
+  static Vec16f gather(const Vec16f *data, Vec16i index)
+  {
+    constexpr int tableSize = bufSize * 16;
+    const Vec16i lane(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    return lookup<tableSize>(index * 16 + lane, reinterpret_cast<const float *>(data));
+  }
 
-    ++rptr;
-    rptr &= bufEnd;
-    const unsigned int i0 = rptr;
+  Vec16f readJournaled(Vec16i index)
+  {
+    constexpr int tableSize = journalSize * 16;
+    const Vec16i lane(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const Vec16i offset = (index - journalStart - 1) & bufEnd;
+    const Vec16f fromJournal = lookup<tableSize>(
+      (offset & journalEnd) * 16 + lane, reinterpret_cast<const float *>(journal));
+    return select(offset < nJournal, fromJournal, gather(buf, index));
+  }
 
-    return buf[i0] - rFraction * (buf[i0] - buf[i1]);
+  Vec16f interpolate(Vec16f b0, Vec16f b1) { return b0 - rFraction * (b0 - b1); }
+
+  void push(Vec16f value)
+  {
+    ++wptr;
+    wptr &= bufEnd;
+    if (journal == nullptr)
+      buf[wptr] = value;
+    else
+      journal[nJournal++] = value;
   }
 };
 
-template<typename Sample> class KsString {
+// 16 Karplus-Strong strings.
+class alignas(64) KsString16 {
 public:
-  Delay<Sample> delay;
-  PControllerKSHat<Sample> lowpass;
-  OnePoleHighpass<Sample> highpass;
-  Sample feedback = 0;
-
-  void setup(Sample sampleRate) { highpass.setCutoff(sampleRate, 20); }
+  Delay16 delay;
+  PControllerKSHat<Vec16f> lowpass;
+  OnePoleHighpass<Vec16f> highpass;
+  Vec16f feedback = 0.0f;
+  Vec16f out = 0.0f;
 
   void reset()
   {
     delay.reset();
     lowpass.reset();
     highpass.reset();
-    feedback = 0;
+    feedback = 0.0f;
+    out = 0.0f;
   }
 
-  Sample process(Sample in, Sample kp, Sample b1)
+  Vec16f read(Vec16f b1)
   {
-    Sample out = delay.process(in + feedback);
-    feedback = lowpass.process(out, kp);
+    out = delay.read();
     return highpass.process(out, b1);
   }
+
+  void write(Vec16f input, Vec16f kp)
+  {
+    delay.write(input + feedback);
+    feedback = lowpass.process(out, kp);
+  }
 };
 
-template<typename Sample, uint16_t size> class KsHat {
+// Strings are processed in SIMD lanes. The collision between strings, and serial
+// connection, only use the outputs of current sample, so they are computed in a scalar
+// pass between read and write of strings.
+template<uint16_t size> class KsHat16 {
 public:
-  std::array<KsString<Sample>, size> string;
-  std::array<Sample, size> buf{};
-  Sample distance = 1;
+  static constexpr size_t nGroup = (size + 15) / 16;
+
+  std::array<KsString16, nGroup> string;
+  alignas(64) std::array<float, 16 * nGroup> buf{};
+  alignas(64) std::array<float, 16 * nGroup> stringIn{};
+  float distance = 1;
   bool isSerial = false;
 
-  Sample kp = 0; // Lowpass coefficient.
-  Sample b1 = 1; // Highpass coefficient.
+  float kp = 0; // Lowpass coefficient.
+  float b1 = 1; // Highpass coefficient.
+
+  void setTime(size_t index, float sampleRate, float seconds)
+  {
+    string[index / 16].delay.setTime(int(index % 16), sampleRate, seconds);
+  }
+
+  // `storage` must have `nGroup * Delay16::bufSize` elements.
+  void setBuffer(Vec16f *storage)
+  {
+    for (size_t grp = 0; grp < nGroup; ++grp)
+      string[grp].delay.buf = storage + grp * Delay16::bufSize;
+  }
 
-  void setup(Sample sampleRate)
+  // `journal` must have `nGroup * Delay16::journalSize` elements.
+  void beginJournal(Vec16f *journal)
   {
-    for (auto &str : string) str.setup(sampleRate);
+    for (size_t grp = 0; grp < nGroup; ++grp)
+      string[grp].delay.beginJournal(journal + grp * Delay16::journalSize);
+  }
+
+  void endJournal()
+  {
+    for (auto &str : string) str.delay.endJournal();
   }
 
   void reset()
   {
     for (auto &str : string) str.reset();
     buf.fill(0);
+    stringIn.fill(0);
   }
 
-  void trigger(Sample distance, bool isSerial)
+  void trigger(float distance, bool isSerial)
   {
     this->distance = distance;
     this->isSerial = isSerial;
     reset();
   }
 
-  Sample process(Sample input, Sample propagation)
+  float process(float input, float propagation)
   {
-    Sample out = 0;
+    for (size_t grp = 0; grp < nGroup; ++grp) string[grp].read(b1).store_a(&buf[16 * grp]);
+
+    float out = 0;
     for (uint16_t idx = 0; idx < size; ++idx) {
-      Sample dist = (idx < 1) ? distance : distance - buf[idx - 1];
-      Sample leftover = (input <= dist) ? 0 : input - dist;
+      float dist = (idx < 1) ? distance : distance - buf[idx - 1];
+      float leftover = (input <= dist) ? 0 : input - dist;
       input -= propagation * leftover;
-      buf[idx] = string[idx].process(input, kp, b1);
+      stringIn[idx] = input;
       out += buf[idx];
       if (isSerial) input = buf[idx];
     }
+
+    for (size_t grp = 0; grp < nGroup; ++grp)
+      string[grp].write(Vec16f().load_a(&stringIn[16 * grp]), kp);
+
     return out / size;
   }
 };
@@ -72,7 +72,6 @@ template<typename T> T onepoleHighpassPoleApprox(T x)
 void NOTE_NAME::setup(float sampleRate)
 {
   cymbalLowpassEnvelope.setup(sampleRate);
-  cymbal.setup(sampleRate);
 }
 
 void NOTE_NAME::noteOn(
@@ -94,6 +93,10 @@ void NOTE_NAME::noteOn(
   this->pan = pan;
   gain = 1.0f;
 
+  // Multi-thread rendering gives each note own noise generator, to render notes on any
+  // thread in any order. Single-thread rendering draws from `info.rngNoise` as before.
+  if (pv[ID::multiThread]->getInt()) rngNoise.seed(info.rngNoise());
+
   const float eqTemp = pv[ID::equalTemperament]->getFloat() + 1;
   const auto semitone = int32_t(pv[ID::semitone]->getInt()) - 120;
   const auto octave = eqTemp * (int32_t(pv[ID::octave]->getInt()) - 12);
@@ -125,7 +128,7 @@ void NOTE_NAME::noteOn(
     const auto spread
       = (freq - Scales::frequency.getMin()) * pv[ID::randomFrequency]->getFloat();
     std::uniform_real_distribution<float> distFreq(freq - spread, freq + spread);
-    cymbal.string[idx].delay.setTime(sampleRate, 1.0f / distFreq(info.rngString));
+    cymbal.setTime(idx, sampleRate, 1.0f / distFreq(info.rngString));
   }
   cymbal.trigger(pv[ID::distance]->getFloat(), pv[ID::connection]->getInt());
 
@@ -155,11 +158,12 @@ bool NOTE_NAME::isAttacking() { return cymbalLowpassEnvelope.isAttacking(); }
 
 float NOTE_NAME::getGain() { return gain; }
 
-std::array<float, 2> NOTE_NAME::process(float sampleRate, NoteProcessInfo &info)
+std::array<float, 2>
+NOTE_NAME::process(float sampleRate, NoteProcessInfo &info, std::minstd_rand &rng)
 {
   float sig = noise.isTerminated
     ? 0
-    : info.noiseGain.getValue() * exciterLowpass.process(noise.process(info.rngNoise));
+    : info.noiseGain.getValue() * exciterLowpass.process(noise.process(rng));
 
   for (auto &cmb : comb) sig -= cmb.process(sig);
   sig *= gate.process();
@@ -187,14 +191,17 @@ void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   // 10 msec + 1 sample transition time.
   transitionBuffer.resize(1 + size_t(sampleRate * 0.005), {0.0f, 0.0f});
 
   for (auto &note : notes) note.setup(sampleRate);
 
+  // Threads are started here because `setParameters()` is called on audio thread.
+  VoicePool::instance().start();
+
   reset();
 }
 
@@ -203,6 +210,12 @@ DSPCORE_NAME::DSPCORE_NAME()
   unisonPan.reserve(maxVoice);
   noteIndices.reserve(maxVoice);
   voiceIndices.reserve(maxVoice);
+
+  // Delay buffers are outside of notes, so snapshots of notes are small.
+  constexpr size_t noteBufferSize = KsHat16<nDelay>::nGroup * Delay16::bufSize;
+  delayBuffer.resize(maxVoice * noteBufferSize, Vec16f(0.0f));
+  for (size_t idx = 0; idx < notes.size(); ++idx)
+    notes[idx].cymbal.setBuffer(delayBuffer.data() + idx * noteBufferSize);
 }
 
 void DSPCORE_NAME::reset()
@@ -224,11 +237,14 @@ void DSPCORE_NAME::setParameters(float tempo)
   using ID = ParameterID::ID;
   auto &pv = param.value;
 
-  info.setParameters(param);
+  info.setParameters(param, smootherCommon);
 
   nVoice = pv[ID::nVoice]->getInt() + 1;
 
-  interpMasterGain.push(pv[ID::gain]->getFloat() * pv[ID::boost]->getFloat());
+  isMultiThread = pv[ID::multiThread]->getInt();
+
+  interpMasterGain.push(
+    smootherCommon, pv[ID::gain]->getFloat() * pv[ID::boost]->getFloat());
 
   for (auto &note : notes) {
     if (note.state == NoteState::rest) continue;
@@ -238,39 +254,140 @@ void DSPCORE_NAME::setParameters(float tempo)
   }
 }
 
+void DSPCORE_NAME::renderVoice(void *context, uint32_t index)
+{
+  auto dsp = static_cast<DSPCORE_NAME *>(context);
+  auto &note = dsp->notes[dsp->activeVoice[index]];
+  auto &buffer = dsp->voiceBuffer[index];
+
+  // Each task advances its own copy of smoothers.
+  auto info = dsp->info;
+
+  size_t i = 0;
+  for (; i < dsp->voiceBlockLength && note.state != NoteState::rest; ++i) {
+    info.process();
+    buffer[i] = note.process(dsp->sampleRate, info, note.rngNoise);
+  }
+  for (; i < dsp->voiceBlockLength; ++i) buffer[i].fill(0.0f);
+}
+
+void DSPCORE_NAME::snapshotVoice(void *context, uint32_t index)
+{
+  auto dsp = static_cast<DSPCORE_NAME *>(context);
+  auto &snapshot = dsp->voiceSnapshot[index];
+  snapshot.note = dsp->notes[dsp->activeVoice[index]];
+  snapshot.note.cymbal.beginJournal(snapshot.journal.data());
+  snapshot.info = dsp->info;
+  snapshot.sampleRate = dsp->sampleRate;
+  snapshot.length = dsp->voiceBlockLength;
+}
+
+// Delay buffer of the note is only read. Writes go to the journal of snapshot.
+void DSPCORE_NAME::renderSnapshot(void *context, uint32_t index)
+{
+  auto &snapshot = static_cast<DSPCORE_NAME *>(context)->voiceSnapshot[index];
+  auto &note = snapshot.note;
+  auto &buffer = snapshot.buffer;
+
+  size_t i = 0;
+  for (; i < snapshot.length && note.state != NoteState::rest; ++i) {
+    snapshot.info.process();
+    buffer[i] = note.process(snapshot.sampleRate, snapshot.info, note.rngNoise);
+  }
+  for (; i < snapshot.length; ++i) buffer[i].fill(0.0f);
+}
+
+void DSPCORE_NAME::commitVoice(void *context, uint32_t index)
+{
+  auto dsp = static_cast<DSPCORE_NAME *>(context);
+  auto &snapshot = dsp->voiceSnapshot[index];
+  auto &note = dsp->notes[dsp->activeVoice[index]];
+  note = snapshot.note;
+  note.cymbal.endJournal();
+  std::copy_n(snapshot.buffer.begin(), snapshot.length, dsp->voiceBuffer[index].begin());
+}
+
+const VoicePool::Task DSPCORE_NAME::voiceTask{
+  renderVoice, snapshotVoice, renderSnapshot, commitVoice};
+
 void DSPCORE_NAME::process(const size_t length, float *out0, float *out1)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   std::array<float, 2> frame{};
-  for (size_t i = 0; i < length; ++i) {
-    processMidiNote(i);
 
-    info.process();
+  if (!isMultiThread) {
+    for (size_t i = 0; i < length; ++i) {
+      processMidiNote(i);
+
+      info.process();
 
-    frame.fill(0.0f);
+      frame.fill(0.0f);
 
-    for (auto &note : notes) {
-      if (note.state == NoteState::rest) continue;
-      auto sig = note.process(sampleRate, info);
-      frame[0] += sig[0];
-      frame[1] += sig[1];
+      for (auto &note : notes) {
+        if (note.state == NoteState::rest) continue;
+        auto sig = note.process(sampleRate, info, info.rngNoise);
+        frame[0] += sig[0];
+        frame[1] += sig[1];
+      }
+
+      processTransition(frame);
+
+      const auto masterGain = interpMasterGain.process();
+      out0[i] = masterGain * frame[0];
+      out1[i] = masterGain * frame[1];
     }
+    return;
+  }
+
+  size_t i = 0;
+  while (i < length) {
+    processMidiNote(i);
+
+    // Voices are rendered until next note event, then summed in the order of `notes`.
+    size_t end = std::min(length, i + voiceBlockSize);
+    for (const auto &nt : midiNotes)
+      if (nt.frame > i && nt.frame < end) end = nt.frame;
+    voiceBlockLength = end - i;
 
-    if (isTransitioning) {
-      frame[0] += transitionBuffer[trIndex][0];
-      frame[1] += transitionBuffer[trIndex][1];
-      transitionBuffer[trIndex].fill(0.0f);
-      trIndex = (trIndex + 1) % transitionBuffer.size();
-      if (trIndex == trStop) isTransitioning = false;
+    nActiveVoice = 0;
+    for (size_t idx = 0; idx < notes.size(); ++idx) {
+      if (notes[idx].state == NoteState::rest) continue;
+      activeVoice[nActiveVoice++] = idx;
     }
+    // Workers get half of the block duration before their voices are rendered inline.
+    VoicePool::instance().run(
+      voiceTask, this, uint32_t(nActiveVoice), 0.5f * voiceBlockLength / sampleRate);
+
+    for (size_t j = 0; j < voiceBlockLength; ++j, ++i) {
+      info.process();
+
+      frame.fill(0.0f);
+
+      for (size_t voice = 0; voice < nActiveVoice; ++voice) {
+        frame[0] += voiceBuffer[voice][j][0];
+        frame[1] += voiceBuffer[voice][j][1];
+      }
 
-    const auto masterGain = interpMasterGain.process();
-    out0[i] = masterGain * frame[0];
-    out1[i] = masterGain * frame[1];
+      processTransition(frame);
+
+      const auto masterGain = interpMasterGain.process();
+      out0[i] = masterGain * frame[0];
+      out1[i] = masterGain * frame[1];
+    }
   }
 }
 
+void DSPCORE_NAME::processTransition(std::array<float, 2> &frame)
+{
+  if (!isTransitioning) return;
+  frame[0] += transitionBuffer[trIndex][0];
+  frame[1] += transitionBuffer[trIndex][1];
+  transitionBuffer[trIndex].fill(0.0f);
+  trIndex = (trIndex + 1) % transitionBuffer.size();
+  if (trIndex == trStop) isTransitioning = false;
+}
+
 void DSPCORE_NAME::setUnisonPan(size_t nUnison)
 {
   using ID = ParameterID::ID;
@@ -366,7 +483,7 @@ void DSPCORE_NAME::fillTransitionBuffer(size_t noteIndex)
   auto &note = notes[noteIndex];
 
   for (size_t bufIdx = 0; bufIdx < transitionBuffer.size(); ++bufIdx) {
-    auto oscOut = note.process(sampleRate, info);
+    auto oscOut = note.process(sampleRate, info, info.rngNoise);
     auto idx = (trIndex + bufIdx) % transitionBuffer.size();
     auto interp = 1.0f - float(bufIdx) / transitionBuffer.size();
 
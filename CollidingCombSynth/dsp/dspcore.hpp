@@ -20,6 +20,7 @@
 #include "../../common/dsp/constants.hpp"
 #include "../../common/dsp/smoother.hpp"
 #include "../../common/dsp/somemath.hpp"
+#include "../../common/dsp/voicepool.hpp"
 #include "../parameter.hpp"
 #include "delay.hpp"
 #include "envelope.hpp"
@@ -32,13 +33,11 @@
 
 using namespace SomeDSP;
 
-enum class NoteState { active, release, rest };
+constexpr size_t voiceBlockSize = 128;
+static_assert(
+  2 * voiceBlockSize <= Delay16::journalSize, "Journal can't hold a voice block.");
 
-#define NOTE_PROCESS_INFO_SMOOTHER(METHOD)                                               \
-  lowpassCutoff.METHOD(pv[ID::lowpassCutoff]->getFloat());                               \
-  highpassCutoff.METHOD(pv[ID::highpassCutoff]->getFloat());                             \
-  noiseGain.METHOD(pv[ID::exciterGain]->getFloat());                                     \
-  propagation.METHOD(pv[ID::propagation]->getFloat());
+enum class NoteState { active, release, rest };
 
 struct NoteProcessInfo {
   std::minstd_rand rngNoise{0};
@@ -61,15 +60,21 @@ struct NoteProcessInfo {
     rngString.seed(pv[ID::seedString]->getInt());
     rngUnison.seed(pv[ID::seedUnison]->getInt());
 
-    NOTE_PROCESS_INFO_SMOOTHER(reset);
+    lowpassCutoff.reset(pv[ID::lowpassCutoff]->getFloat());
+    highpassCutoff.reset(pv[ID::highpassCutoff]->getFloat());
+    noiseGain.reset(pv[ID::exciterGain]->getFloat());
+    propagation.reset(pv[ID::propagation]->getFloat());
   }
 
-  void setParameters(GlobalParameter &param)
+  void setParameters(GlobalParameter &param, const SmootherCommon<float> &common)
   {
     using ID = ParameterID::ID;
     auto &pv = param.value;
 
-    NOTE_PROCESS_INFO_SMOOTHER(push);
+    lowpassCutoff.push(common, pv[ID::lowpassCutoff]->getFloat());
+    highpassCutoff.push(common, pv[ID::highpassCutoff]->getFloat());
+    noiseGain.push(common, pv[ID::exciterGain]->getFloat());
+    propagation.push(common, pv[ID::propagation]->getFloat());
   }
 
   void process()
@@ -95,11 +100,12 @@ struct NoteProcessInfo {
     int32_t releaseCounter = 0;                                                          \
     float releaseLength = 0;                                                             \
                                                                                          \
+    std::minstd_rand rngNoise{0};                                                        \
     ADNoise noise;                                                                       \
     PController<float> exciterLowpass;                                                   \
     AttackGate<float> gate;                                                              \
     std::array<ShortComb<float>, nComb> comb;                                            \
-    KsHat<float, nDelay> cymbal;                                                         \
+    KsHat16<nDelay> cymbal;                                                              \
     ExpADSREnvelopeP<float> cymbalLowpassEnvelope;                                       \
     DCKiller<float> dcKiller;                                                            \
     EasyCompressor<float> compressor;                                                    \
@@ -117,7 +123,8 @@ struct NoteProcessInfo {
     void rest();                                                                         \
     bool isAttacking();                                                                  \
     float getGain();                                                                     \
-    std::array<float, 2> process(float sampleRate, NoteProcessInfo &info);               \
+    std::array<float, 2>                                                                 \
+    process(float sampleRate, NoteProcessInfo &info, std::minstd_rand &rng);             \
   };
 
 NOTE_CLASS(AVX512)
@@ -166,6 +173,7 @@ public:
   class DSPCore_##INSTRSET final : public DSPInterface {                                 \
   public:                                                                                \
     DSPCore_##INSTRSET();                                                                \
+    ~DSPCore_##INSTRSET() { VoicePool::instance().detach(this); }                        \
                                                                                          \
     void setup(double sampleRate);                                                       \
     void reset();                                                                        \
@@ -223,8 +231,10 @@ public:
                                                                                          \
   private:                                                                               \
     void setUnisonPan(size_t nUnison);                                                   \
+    void processTransition(std::array<float, 2> &frame);                                 \
                                                                                          \
     float sampleRate = 44100.0f;                                                         \
+    SmootherCommon<float> smootherCommon;                                                \
     float velocity = 0.0f;                                                               \
     DecibelScale<float> velocityMap{-30, 0, true};                                       \
                                                                                          \
@@ -234,6 +244,7 @@ public:
     std::vector<size_t> voiceIndices;                                                    \
     std::vector<float> unisonPan;                                                        \
     std::array<Note_##INSTRSET, maxVoice> notes;                                         \
+    std::vector<Vec16f> delayBuffer;                                                     \
                                                                                          \
     NoteProcessInfo info;                                                                \
     ExpSmoother<float> interpMasterGain;                                                 \
@@ -242,6 +253,28 @@ public:
     bool isTransitioning = false;                                                        \
     size_t trIndex = 0;                                                                  \
     size_t trStop = 0;                                                                   \
+                                                                                         \
+    bool isMultiThread = false;                                                          \
+    size_t voiceBlockLength = 0;                                                         \
+    size_t nActiveVoice = 0;                                                             \
+    std::array<size_t, maxVoice> activeVoice{};                                          \
+    std::array<std::array<std::array<float, 2>, voiceBlockSize>, maxVoice> voiceBuffer;  \
+                                                                                         \
+    struct VoiceSnapshot {                                                               \
+      Note_##INSTRSET note;                                                              \
+      NoteProcessInfo info;                                                              \
+      float sampleRate = 44100.0f;                                                       \
+      size_t length = 0;                                                                 \
+      std::array<Vec16f, KsHat16<nDelay>::nGroup * Delay16::journalSize> journal;        \
+      std::array<std::array<float, 2>, voiceBlockSize> buffer;                           \
+    };                                                                                   \
+    std::array<VoiceSnapshot, maxVoice> voiceSnapshot;                                   \
+                                                                                         \
+    static const VoicePool::Task voiceTask;                                              \
+    static void renderVoice(void *context, uint32_t index);                              \
+    static void snapshotVoice(void *context, uint32_t index);                            \
+    static void renderSnapshot(void *context, uint32_t index);                           \
+    static void commitVoice(void *context, uint32_t index);                              \
   };
 
 DSPCORE_CLASS(AVX512)
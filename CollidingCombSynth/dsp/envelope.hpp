@@ -127,7 +127,7 @@ public:
 
 private:
   enum class State : int32_t { attack, decay, release, tail, terminated };
-  const Sample threshold = 1e-5;
+  constexpr static Sample threshold = 1e-5;
 
   uint32_t tailLength = 32;
   uint32_t tailCounter = tailLength;
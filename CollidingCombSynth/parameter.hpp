@@ -94,6 +94,8 @@ enum ID {
   pitchA4Hz,
   pitchBend,
 
+  multiThread,
+
   ID_ENUM_LENGTH,
 };
 } // namespace ParameterID
@@ -141,12 +143,10 @@ struct Scales {
 };
 
 struct GlobalParameter : public ParameterInterface {
-  std::vector<std::unique_ptr<ValueInterface>> value;
+  ValueArray<ParameterID::ID_ENUM_LENGTH> value;
 
   GlobalParameter()
   {
-    value.resize(ParameterID::ID_ENUM_LENGTH);
-
     using ID = ParameterID::ID;
     using LinearValue = FloatValue<SomeDSP::LinearScale<double>>;
     using LogValue = FloatValue<SomeDSP::LogScale<double>>;
@@ -282,6 +282,9 @@ struct GlobalParameter : public ParameterInterface {
 
     value[ID::pitchBend] = std::make_unique<LinearValue>(
       0.5, Scales::defaultScale, "pitchBend", kParameterIsAutomable);
+
+    value[ID::multiThread] = std::make_unique<IntValue>(
+      0, Scales::boolScale, "multiThread", kParameterIsAutomable | kParameterIsBoolean);
   }
 
 #ifndef TEST_BUILD
@@ -294,10 +297,7 @@ struct GlobalParameter : public ParameterInterface {
 
   size_t idLength() override { return value.size(); }
 
-  void resetParameter()
-  {
-    for (auto &val : value) val->setFromNormalized(val->getDefaultNormalized());
-  }
+  void resetParameter() { value.reset(); }
 
   double getNormalized(uint32_t index) const override
   {
@@ -346,10 +346,12 @@ struct GlobalParameter : public ParameterInterface {
   enum Preset { presetDefault, Preset_ENUM_LENGTH };
   std::array<const char *, 12> programName{"Default"};
 
+#ifndef TEST_BUILD
   void initProgramName(uint32_t index, String &programName)
   {
     programName = this->programName[index];
   }
+#endif
 
   void loadProgram(uint32_t index)
   {
@@ -25,13 +25,15 @@
 #include <utility>
 
 #include "DistrhoPlugin.hpp"
+#include "../common/dspload.hpp"
 #include "dsp/dspcore.hpp"
 
 START_NAMESPACE_DISTRHO
 
 class CollidingCombSynth : public Plugin {
 public:
-  CollidingCombSynth() : Plugin(ParameterID::ID_ENUM_LENGTH, 0, 0)
+  CollidingCombSynth()
+    : Plugin(ParameterID::ID_ENUM_LENGTH + DSPLoadMeter::nParameter, 0, 0)
   {
     auto iset = instrset_detect();
     if (iset >= 10) {
@@ -70,12 +72,19 @@ protected:
 
   void initParameter(uint32_t index, Parameter &parameter) override
   {
+    if (index >= ParameterID::ID_ENUM_LENGTH) {
+      DSPLoadMeter::initParameter(index - ParameterID::ID_ENUM_LENGTH, parameter);
+      return;
+    }
+
     dsp->param.initParameter(index, parameter);
     parameter.symbol = parameter.name;
   }
 
   float getParameterValue(uint32_t index) const override
   {
+    if (index >= ParameterID::ID_ENUM_LENGTH)
+      return loadMeter.getParameter(index - ParameterID::ID_ENUM_LENGTH);
     return dsp->param.getFloat(index);
   }
 
@@ -91,7 +100,11 @@ protected:
 
   void loadProgram(uint32_t index) override { dsp->param.loadProgram(index); }
 
-  void sampleRateChanged(double newSampleRate) { dsp->setup(newSampleRate); }
+  void sampleRateChanged(double newSampleRate)
+  {
+    loadMeter.setup(newSampleRate);
+    dsp->setup(newSampleRate);
+  }
   void activate() {}
   void deactivate() { dsp->reset(); }
 
@@ -154,11 +167,13 @@ protected:
     alreadyRecievedNote.resize(0);
 
     dsp->setParameters(timePos.bbt.beatsPerMinute);
+    auto probe = loadMeter.probe(frames);
     dsp->process(frames, outputs[0], outputs[1]);
   }
 
 private:
   std::unique_ptr<DSPInterface> dsp;
+  DSPLoadMeter loadMeter;
   bool wasPlaying = false;
   uint32_t noteId = 0;
   std::vector<std::pair<uint8_t, uint32_t>> lastNoteId;
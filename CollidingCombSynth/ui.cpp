@@ -157,14 +157,7 @@ public:
 
     setGeometryConstraints(defaultWidth, defaultHeight, true, true);
 
-    if (palette.fontPath().size() > 0)
-      fontId = createFontFromFile("main", palette.fontPath().c_str());
-
-    if (fontId < 0) {
-      fontId = createFontFromMemory(
-        "main", (unsigned char *)(FontData::TinosBoldItalicData),
-        FontData::TinosBoldItalicDataSize, false);
-    }
+    loadFont();
 
     using ID = ParameterID::ID;
 
@@ -343,6 +336,9 @@ public:
     addTextKnob(
       miscLeft0 + knobX, miscTop1 + 0 * labelY, knobX, labelHeight, uiTextSize,
       ID::nVoice, Scales::nVoice, false, 0, 1);
+    addCheckbox(
+      miscLeft0 + 2 * knobX + 2 * margin, miscTop1, 2 * knobX, labelHeight, uiTextSize,
+      "Multi Thread", ID::multiThread);
 
     // Exciter.
     constexpr auto exciterLeft0 = left0 + 4 * knobX + labelY;
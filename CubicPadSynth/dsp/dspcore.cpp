@@ -76,6 +76,7 @@ void NOTE_NAME::noteOn(
   float velocity,
   float pan,
   float phase,
+  const SmootherCommon<float> &smootherCommon,
   NoteProcessInfo &info,
   std::array<PROCESSING_UNIT_NAME, nUnit> &units,
   GlobalParameter &param)
@@ -107,13 +108,14 @@ void NOTE_NAME::noteOn(
 
   unit.gainEnvelope.reset(vecIndex);
   unit.lowpassEnvelope.reset(
-    vecIndex, param.value[ID::tableLowpassA]->getFloat(),
+    smootherCommon, vecIndex, param.value[ID::tableLowpassA]->getFloat(),
     param.value[ID::tableLowpassD]->getFloat(),
     param.value[ID::tableLowpassS]->getFloat(),
     param.value[ID::tableLowpassR]->getFloat(), sampleRate);
   unit.pitchEnvelope.reset(
-    vecIndex, param.value[ID::pitchA]->getFloat(), param.value[ID::pitchD]->getFloat(),
-    param.value[ID::pitchS]->getFloat(), param.value[ID::pitchR]->getFloat(), sampleRate);
+    smootherCommon, vecIndex, param.value[ID::pitchA]->getFloat(),
+    param.value[ID::pitchD]->getFloat(), param.value[ID::pitchS]->getFloat(),
+    param.value[ID::pitchR]->getFloat(), sampleRate);
 }
 
 void NOTE_NAME::release(std::array<PROCESSING_UNIT_NAME, nUnit> &units)
@@ -159,8 +161,8 @@ void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.04f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.04f);
 
   for (size_t idx = 0; idx < nUnit; ++idx) {
     units[idx].gainEnvelope.setup(
@@ -172,6 +174,9 @@ void DSPCORE_NAME::setup(double sampleRate)
   // 2 msec + 1 sample transition time.
   transitionBuffer.resize(1 + size_t(sampleRate * 0.01), {0.0f, 0.0f});
 
+  // Threads are started here because `setParameters()` is called on audio thread.
+  VoicePool::instance().start();
+
   startup();
   prepareRefresh = true;
 }
@@ -205,61 +210,75 @@ void DSPCORE_NAME::startup()
 }
 
 void PROCESSING_UNIT_NAME::setParameters(
-  float sampleRate, NoteProcessInfo &info, GlobalParameter &param)
+  float sampleRate,
+  const SmootherCommon<float> &smootherCommon,
+  NoteProcessInfo &info,
+  GlobalParameter &param)
 {
   using ID = ParameterID::ID;
 
   gainEnvelope.set(
-    param.value[ID::gainA]->getFloat(), param.value[ID::gainD]->getFloat(),
-    param.value[ID::gainS]->getFloat(), param.value[ID::gainR]->getFloat(),
+    smootherCommon, param.value[ID::gainA]->getFloat(),
+    param.value[ID::gainD]->getFloat(), param.value[ID::gainS]->getFloat(),
+    param.value[ID::gainR]->getFloat(),
     notePitchToFrequency(
       notePitch + info.masterPitch.getValue(), info.equalTemperament.getValue(),
       info.pitchA4Hz.getValue()));
   lowpassEnvelope.set(
-    param.value[ID::tableLowpassA]->getFloat(),
+    smootherCommon, param.value[ID::tableLowpassA]->getFloat(),
     param.value[ID::tableLowpassD]->getFloat(),
     param.value[ID::tableLowpassS]->getFloat(),
     param.value[ID::tableLowpassR]->getFloat(), sampleRate);
   pitchEnvelope.set(
-    param.value[ID::pitchA]->getFloat(), param.value[ID::pitchD]->getFloat(),
-    param.value[ID::pitchS]->getFloat(), param.value[ID::pitchR]->getFloat(), sampleRate);
+    smootherCommon, param.value[ID::pitchA]->getFloat(),
+    param.value[ID::pitchD]->getFloat(), param.value[ID::pitchS]->getFloat(),
+    param.value[ID::pitchR]->getFloat(), sampleRate);
 }
 
 void DSPCORE_NAME::setParameters(float tempo)
 {
   using ID = ParameterID::ID;
 
-  SmootherCommon<float>::setTime(param.value[ID::smoothness]->getFloat());
+  smootherCommon.setTime(param.value[ID::smoothness]->getFloat());
 
-  interpMasterGain.push(param.value[ID::gain]->getFloat());
+  interpMasterGain.push(smootherCommon, param.value[ID::gain]->getFloat());
 
-  info.masterPitch.push(calcMasterPitch(
-    int32_t(param.value[ID::oscOctave]->getInt()) - 12,
-    param.value[ID::oscSemi]->getInt() - 120, param.value[ID::oscMilli]->getInt() - 1000,
-    param.value[ID::pitchBend]->getFloat()));
-  info.equalTemperament.push(param.value[ID::equalTemperament]->getFloat() + 1);
-  info.pitchA4Hz.push(param.value[ID::pitchA4Hz]->getFloat() + 100);
+  info.masterPitch.push(
+    smootherCommon,
+    calcMasterPitch(
+      int32_t(param.value[ID::oscOctave]->getInt()) - 12,
+      param.value[ID::oscSemi]->getInt() - 120,
+      param.value[ID::oscMilli]->getInt() - 1000,
+      param.value[ID::pitchBend]->getFloat()));
+  info.equalTemperament.push(
+    smootherCommon, param.value[ID::equalTemperament]->getFloat() + 1);
+  info.pitchA4Hz.push(smootherCommon, param.value[ID::pitchA4Hz]->getFloat() + 100);
   info.tableLowpass.push(
+    smootherCommon,
     Scales::tableLowpass.getMax() - param.value[ID::tableLowpass]->getFloat());
-  info.tableLowpassKeyFollow.push(param.value[ID::tableLowpassKeyFollow]->getFloat());
+  info.tableLowpassKeyFollow.push(
+    smootherCommon, param.value[ID::tableLowpassKeyFollow]->getFloat());
   info.tableLowpassEnvelopeAmount.push(
-    param.value[ID::tableLowpassEnvelopeAmount]->getFloat());
+    smootherCommon, param.value[ID::tableLowpassEnvelopeAmount]->getFloat());
   info.pitchEnvelopeAmount.push(
-    param.value[ID::pitchEnvelopeAmount]->getFloat()
+    smootherCommon, param.value[ID::pitchEnvelopeAmount]->getFloat()
     * (param.value[ID::pitchEnvelopeAmountNegative]->getInt() ? -1 : 1));
 
   const float beat = float(param.value[ID::lfoTempoNumerator]->getInt() + 1)
     / float(param.value[ID::lfoTempoDenominator]->getInt() + 1);
   info.lfoFrequency.push(
+    smootherCommon,
     param.value[ID::lfoFrequencyMultiplier]->getFloat() * tempo / 240.0f / beat);
-  info.lfoPitchAmount.push(param.value[ID::lfoPitchAmount]->getFloat());
-  info.lfoLowpass.push(param.value[ID::lfoLowpass]->getFloat());
+  info.lfoPitchAmount.push(smootherCommon, param.value[ID::lfoPitchAmount]->getFloat());
+  info.lfoLowpass.push(smootherCommon, param.value[ID::lfoLowpass]->getFloat());
 
-  for (auto &unit : units) unit.setParameters(sampleRate, info, param);
+  for (auto &unit : units) unit.setParameters(sampleRate, smootherCommon, info, param);
 
   nVoice = 16 * (param.value[ID::nVoice]->getInt() + 1);
   if (nVoice > notes.size()) nVoice = notes.size();
 
+  isMultiThread = param.value[ID::multiThread]->getInt();
+
   if (prepareRefresh || (!isLFORefreshed && param.value[ID::refreshLFO]->getInt()))
     refreshLfo();
   isLFORefreshed = param.value[ID::refreshLFO]->getInt();
@@ -296,7 +315,7 @@ std::array<float, 2> PROCESSING_UNIT_NAME::process(
   lowpassPitch = (lpPt + lpKey * (lpCutoff * (float(nTable) - pitch) - lpPt))
     - lowpassEnvelope.process() * info.tableLowpassEnvelopeAmount.getValue();
   lowpassPitch = select(lowpassPitch < 0.0f, 0.0f, lowpassPitch);
-  Vec16f sig = osc.processCubic(lowpassPitch + pitch, wavetable.table);
+  Vec16f sig = osc.processCubic(lowpassPitch + pitch, wavetable.data);
 
   gain = velocity * gainEnvelope.process();
   isActive = horizontal_add(gain) != 0;
@@ -310,6 +329,60 @@ std::array<float, 2> PROCESSING_UNIT_NAME::process(
   return frame;
 }
 
+void DSPCORE_NAME::renderUnit(void *context, uint32_t index)
+{
+  auto dsp = static_cast<DSPCORE_NAME *>(context);
+  auto &unit = dsp->units[dsp->activeUnit[index]];
+  auto &buffer = dsp->unitBuffer[index];
+
+  // Each task advances its own copy of smoothers.
+  auto info = dsp->info;
+
+  size_t i = 0;
+  for (; i < dsp->voiceBlockLength && unit.isActive; ++i) {
+    info.process();
+    buffer[i] = unit.process(dsp->sampleRate, dsp->wavetable, dsp->lfoWavetable, info);
+  }
+  for (; i < dsp->voiceBlockLength; ++i) buffer[i].fill(0.0f);
+}
+
+void DSPCORE_NAME::snapshotUnit(void *context, uint32_t index)
+{
+  auto dsp = static_cast<DSPCORE_NAME *>(context);
+  auto &snapshot = dsp->unitSnapshot[index];
+  snapshot.unit = dsp->units[dsp->activeUnit[index]];
+  snapshot.info = dsp->info;
+  snapshot.sampleRate = dsp->sampleRate;
+  snapshot.length = dsp->voiceBlockLength;
+}
+
+void DSPCORE_NAME::renderSnapshot(void *context, uint32_t index)
+{
+  auto dsp = static_cast<DSPCORE_NAME *>(context);
+  auto &snapshot = dsp->unitSnapshot[index];
+  auto &unit = snapshot.unit;
+  auto &buffer = snapshot.buffer;
+
+  size_t i = 0;
+  for (; i < snapshot.length && unit.isActive; ++i) {
+    snapshot.info.process();
+    buffer[i] = unit.process(
+      snapshot.sampleRate, dsp->wavetable, dsp->lfoWavetable, snapshot.info);
+  }
+  for (; i < snapshot.length; ++i) buffer[i].fill(0.0f);
+}
+
+void DSPCORE_NAME::commitUnit(void *context, uint32_t index)
+{
+  auto dsp = static_cast<DSPCORE_NAME *>(context);
+  auto &snapshot = dsp->unitSnapshot[index];
+  dsp->units[dsp->activeUnit[index]] = snapshot.unit;
+  std::copy_n(snapshot.buffer.begin(), snapshot.length, dsp->unitBuffer[index].begin());
+}
+
+const VoicePool::Task DSPCORE_NAME::unitTask{
+  renderUnit, snapshotUnit, renderSnapshot, commitUnit};
+
 void DSPCORE_NAME::process(const size_t length, float *out0, float *out1)
 {
   if (wavetable.isRefreshing) {
@@ -321,43 +394,51 @@ void DSPCORE_NAME::process(const size_t length, float *out0, float *out1)
     return;
   }
 
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   std::array<float, 2> frame{};
-  for (uint32_t i = 0; i < length; ++i) {
+  uint32_t i = 0;
+  while (i < length) {
     processMidiNote(i);
 
-    info.masterPitch.process();
-    info.equalTemperament.process();
-    info.pitchA4Hz.process();
-    info.tableLowpass.process();
-    info.tableLowpassKeyFollow.process();
-    info.tableLowpassEnvelopeAmount.process();
-    info.pitchEnvelopeAmount.process();
-    info.lfoFrequency.process();
-    info.lfoPitchAmount.process();
-    info.lfoLowpass.process();
-
-    frame.fill(0.0f);
-
-    for (auto &unit : units) {
-      if (!unit.isActive) continue;
-      auto sig = unit.process(sampleRate, wavetable, lfoWavetable, info);
-      frame[0] += sig[0];
-      frame[1] += sig[1];
-    }
+    // Units are rendered until next note event, then summed in the order of `units`.
+    size_t end = std::min(length, size_t(i) + voiceBlockSize);
+    for (const auto &nt : midiNotes)
+      if (nt.frame > i && nt.frame < end) end = nt.frame;
+    voiceBlockLength = end - i;
 
-    if (isTransitioning) {
-      frame[0] += transitionBuffer[trIndex][0];
-      frame[1] += transitionBuffer[trIndex][1];
-      transitionBuffer[trIndex].fill(0.0f);
-      trIndex = (trIndex + 1) % transitionBuffer.size();
-      if (trIndex == trStop) isTransitioning = false;
+    nActiveUnit = 0;
+    for (size_t idx = 0; idx < units.size(); ++idx) {
+      if (!units[idx].isActive) continue;
+      activeUnit[nActiveUnit++] = idx;
     }
+    // Workers get half of the block duration before their units are rendered inline.
+    VoicePool::render(
+      isMultiThread, unitTask, this, uint32_t(nActiveUnit),
+      0.5f * voiceBlockLength / sampleRate);
 
-    const auto masterGain = interpMasterGain.process();
-    out0[i] = masterGain * frame[0];
-    out1[i] = masterGain * frame[1];
+    for (size_t j = 0; j < voiceBlockLength; ++j, ++i) {
+      info.process();
+
+      frame.fill(0.0f);
+
+      for (size_t unit = 0; unit < nActiveUnit; ++unit) {
+        frame[0] += unitBuffer[unit][j][0];
+        frame[1] += unitBuffer[unit][j][1];
+      }
+
+      if (isTransitioning) {
+        frame[0] += transitionBuffer[trIndex][0];
+        frame[1] += transitionBuffer[trIndex][1];
+        transitionBuffer[trIndex].fill(0.0f);
+        trIndex = (trIndex + 1) % transitionBuffer.size();
+        if (trIndex == trStop) isTransitioning = false;
+      }
+
+      const auto masterGain = interpMasterGain.process();
+      out0[i] = masterGain * frame[0];
+      out1[i] = masterGain * frame[1];
+    }
   }
 }
 
@@ -422,7 +503,8 @@ void DSPCORE_NAME::noteOn(int32_t identifier, int16_t pitch, float tuning, float
 
   if (nUnison <= 1) {
     notes[noteIndices[0]].noteOn(
-      identifier, float(pitch) + tuning, velocity, 0.5f, 0.0f, info, units, param);
+      identifier, float(pitch) + tuning, velocity, 0.5f, 0.0f, smootherCommon, info,
+      units, param);
     terminateNotes(nUnison);
     return;
   }
@@ -533,7 +615,7 @@ void DSPCORE_NAME::noteOn(int32_t identifier, int16_t pitch, float tuning, float
     auto phase = unisonPhase * unison / float(nUnison);
     notes[noteIndices[unison]].noteOn(
       identifier, notePitch, distGain(info.rng) * velocity, unisonPan[unison], phase,
-      info, units, param);
+      smootherCommon, info, units, param);
   }
 
   terminateNotes(nUnison);
@@ -582,6 +664,8 @@ void DSPCORE_NAME::refreshTable()
 {
   using ID = ParameterID::ID;
 
+  // Abandoned workers may still read the table.
+  VoicePool::instance().detach(this);
   reset();
 
   const float tableBaseFreq = param.value[ID::tableBaseFrequency]->getFloat();
@@ -615,6 +699,7 @@ void DSPCORE_NAME::refreshLfo()
 {
   using ID = ParameterID::ID;
 
+  VoicePool::instance().detach(this);
   reset();
 
   std::vector<float> table(nLFOWavetable);
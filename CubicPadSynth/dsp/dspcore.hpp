@@ -19,6 +19,7 @@
 
 #include "../../common/dsp/constants.hpp"
 #include "../../common/dsp/smoother.hpp"
+#include "../../common/dsp/voicepool.hpp"
 #include "../parameter.hpp"
 #include "envelope.hpp"
 #include "noise.hpp"
@@ -35,6 +36,7 @@
 using namespace SomeDSP;
 
 constexpr size_t nUnit = 8;
+constexpr size_t voiceBlockSize = 128;
 
 enum class NoteState { active, release, rest };
 
@@ -65,6 +67,20 @@ struct NoteProcessInfo {
     lfoPitchAmount.reset(0);
     lfoLowpass.reset(1);
   }
+
+  void process()
+  {
+    masterPitch.process();
+    equalTemperament.process();
+    pitchA4Hz.process();
+    tableLowpass.process();
+    tableLowpassKeyFollow.process();
+    tableLowpassEnvelopeAmount.process();
+    pitchEnvelopeAmount.process();
+    lfoFrequency.process();
+    lfoPitchAmount.process();
+    lfoLowpass.process();
+  }
 };
 
 #define PROCESSING_UNIT_CLASS(INSTRSET)                                                  \
@@ -88,7 +104,11 @@ struct NoteProcessInfo {
                                                                                          \
     bool isActive = false;                                                               \
                                                                                          \
-    void setParameters(float sampleRate, NoteProcessInfo &info, GlobalParameter &param); \
+    void setParameters(                                                                  \
+      float sampleRate,                                                                  \
+      const SmootherCommon<float> &smootherCommon,                                       \
+      NoteProcessInfo &info,                                                             \
+      GlobalParameter &param);                                                           \
     std::array<float, 2> process(                                                        \
       float sampleRate,                                                                  \
       Wavetable<tableSize, nOvertone> &wavetable,                                        \
@@ -120,6 +140,7 @@ PROCESSING_UNIT_CLASS(SSE2)
       float velocity,                                                                    \
       float pan,                                                                         \
       float phase,                                                                       \
+      const SmootherCommon<float> &smootherCommon,                                       \
       NoteProcessInfo &info,                                                             \
       std::array<ProcessingUnit_##INSTRSET, nUnit> &units,                               \
       GlobalParameter &param);                                                           \
@@ -178,6 +199,7 @@ public:
   class DSPCore_##INSTRSET final : public DSPInterface {                                 \
   public:                                                                                \
     DSPCore_##INSTRSET();                                                                \
+    ~DSPCore_##INSTRSET() { VoicePool::instance().detach(this); }                        \
                                                                                          \
     void setup(double sampleRate) override;                                              \
     void reset() override;                                                               \
@@ -229,6 +251,7 @@ public:
     void terminateNotes(size_t nNote);                                                   \
                                                                                          \
     float sampleRate = 44100.0f;                                                         \
+    SmootherCommon<float> smootherCommon;                                                \
                                                                                          \
     std::array<float, nOvertone> otFrequency{};                                          \
     std::array<float, nOvertone> otGain{};                                               \
@@ -257,6 +280,27 @@ public:
     size_t trIndex = 0;                                                                  \
     size_t trStop = 0;                                                                   \
     TableOsc<tableSize> trOsc;                                                           \
+                                                                                         \
+    bool isMultiThread = false;                                                          \
+    size_t voiceBlockLength = 0;                                                         \
+    size_t nActiveUnit = 0;                                                              \
+    std::array<size_t, nUnit> activeUnit{};                                              \
+    std::array<std::array<std::array<float, 2>, voiceBlockSize>, nUnit> unitBuffer;      \
+                                                                                         \
+    struct UnitSnapshot {                                                                \
+      ProcessingUnit_##INSTRSET unit;                                                    \
+      NoteProcessInfo info;                                                              \
+      float sampleRate = 44100.0f;                                                       \
+      size_t length = 0;                                                                 \
+      std::array<std::array<float, 2>, voiceBlockSize> buffer;                           \
+    };                                                                                   \
+    std::array<UnitSnapshot, nUnit> unitSnapshot;                                        \
+                                                                                         \
+    static const VoicePool::Task unitTask;                                               \
+    static void renderUnit(void *context, uint32_t index);                               \
+    static void snapshotUnit(void *context, uint32_t index);                             \
+    static void renderSnapshot(void *context, uint32_t index);                           \
+    static void commitUnit(void *context, uint32_t index);                               \
   };
 
 DSPCORE_CLASS(AVX512)
@@ -66,13 +66,15 @@ public:
   }
 
   void set(
+    const SmootherCommon<float> &common,
     float attackTime,
     float decayTime,
     float sustainLevel,
     float releaseTime,
     Vec16f noteFreq)
   {
-    sus.push(std::max<float>(float(0.0), std::min<float>(sustainLevel, float(1.0))));
+    sus.push(
+      common, std::max<float>(float(0.0), std::min<float>(sustainLevel, float(1.0))));
     atk = secondToMultiplier(adaptTime(attackTime, noteFreq));
     dec = secondToMultiplier(decayTime);
     rel = secondToMultiplier(adaptTime(releaseTime, noteFreq));
@@ -176,6 +178,7 @@ public:
   Vec16f secondToDelta(Vec16f seconds) { return float(1) / (sampleRate * seconds); }
 
   void reset(
+    const SmootherCommon<float> &common,
     int index,
     float attackTime,
     float decayTime,
@@ -185,17 +188,19 @@ public:
   {
     state.insert(index, stateAttack);
     value.insert(index, float(1) - value[index]);
-    set(attackTime, decayTime, sustainLevel, releaseTime, noteFreq);
+    set(common, attackTime, decayTime, sustainLevel, releaseTime, noteFreq);
   }
 
   void set(
+    const SmootherCommon<float> &common,
     float attackTime,
     float decayTime,
     float sustainLevel,
     float releaseTime,
     Vec16f noteFreq)
   {
-    sus.push(std::max<float>(float(0.0), std::min<float>(sustainLevel, float(1.0))));
+    sus.push(
+      common, std::max<float>(float(0.0), std::min<float>(sustainLevel, float(1.0))));
     atk = secondToDelta(adaptTime(attackTime, noteFreq));
     dec = secondToDelta(adaptTime(decayTime, noteFreq));
     rel = secondToDelta(adaptTime(releaseTime, noteFreq));
@@ -36,6 +36,12 @@ constexpr size_t nTable = 136; // midi note nubmer 136 ~= 21096 Hz.
 constexpr size_t nTablePadded = nTable + 4;
 constexpr size_t notePitchUpperBound = nTable + 1;
 
+// Distance between rows of a wavetable. Rows are padded to 64 bytes.
+constexpr size_t paddedTableStride(size_t tableSize)
+{
+  return (tableSize + 3 + 15) / 16 * 16;
+}
+
 // Range of t is in [0, 1]. Interpoltes between y1 and y2.
 inline float cubicInterp(float y0, float y1, float y2, float y3, float t)
 {
@@ -76,13 +82,19 @@ table is 2d array which has extra padding for interpolation.
 - Padded last column has first element of original table.
 - Padded first row is copy of first row of original table.
 - Padded last 3 row is silence.
+
+All rows are stored in a single contiguous block `data`, and `table[row]` points to the
+start of each row. TableOsc16 reads `data` with computed offsets, which turn into gather
+instructions on AVX2 and AVX512.
 */
 template<size_t tableSize, size_t nPeak> struct Wavetable {
   static constexpr size_t spectrumSize = tableSize / 2 + 1;
   static constexpr size_t paddedSize = tableSize + 3;
+  static constexpr size_t stride = paddedTableStride(tableSize);
   fftwf_complex *spectrum;
   fftwf_complex *bandLimited;
   fftwf_complex *tmpSpec;
+  float *data;
   std::array<float *, nTablePadded> table;
   std::array<fftwf_plan, nTablePadded> plan;
   std::array<float, nTablePadded> frequency; // Must be sorted by ascending order.
@@ -95,8 +107,9 @@ template<size_t tableSize, size_t nPeak> struct Wavetable {
     bandLimited = (fftwf_complex *)fftwf_malloc(sizeof(fftwf_complex) * spectrumSize);
     tmpSpec = (fftwf_complex *)fftwf_malloc(sizeof(fftwf_complex) * spectrumSize);
 
+    data = (float *)fftwf_malloc(sizeof(float) * nTablePadded * stride);
     for (size_t idx = 0; idx < nTablePadded; ++idx) {
-      table[idx] = (float *)fftwf_malloc(sizeof(float) * paddedSize);
+      table[idx] = data + idx * stride;
       table[idx][0] = 0;
       table[idx][paddedSize - 1] = 0;
 
@@ -116,7 +129,7 @@ template<size_t tableSize, size_t nPeak> struct Wavetable {
   ~Wavetable()
   {
     for (auto &pln : plan) fftwf_destroy_plan(pln);
-    for (auto &tbl : table) fftwf_free(tbl);
+    fftwf_free(data);
     fftwf_free(tmpSpec);
     fftwf_free(bandLimited);
     fftwf_free(spectrum);
@@ -349,6 +362,8 @@ template<size_t tableSize> struct TableOsc {
 
 template<size_t tableSize> struct alignas(64) TableOsc16 {
   static constexpr size_t paddedLast = tableSize + 1;
+  static constexpr int stride = int(paddedTableStride(tableSize));
+  static constexpr int dataSize = int(nTablePadded) * stride;
   Vec16f phase = 1; // table index starts from 1. 0 is padded index.
   Vec16f tick = 0;
 
@@ -374,22 +389,15 @@ template<size_t tableSize> struct alignas(64) TableOsc16 {
 
   void reset() { phase = 1; }
 
-  inline Vec16f loadTable(Vec16i ix, Vec16i iy, std::array<float *, nTablePadded> &table)
+  // `index` is `row * stride + column` of `Wavetable::data`.
+  inline Vec16f loadTable(Vec16i index, const float *data)
   {
-    return Vec16f(
-      table[iy.extract(0)][ix.extract(0)], table[iy.extract(1)][ix.extract(1)],
-      table[iy.extract(2)][ix.extract(2)], table[iy.extract(3)][ix.extract(3)],
-      table[iy.extract(4)][ix.extract(4)], table[iy.extract(5)][ix.extract(5)],
-      table[iy.extract(6)][ix.extract(6)], table[iy.extract(7)][ix.extract(7)],
-      table[iy.extract(8)][ix.extract(8)], table[iy.extract(9)][ix.extract(9)],
-      table[iy.extract(10)][ix.extract(10)], table[iy.extract(11)][ix.extract(11)],
-      table[iy.extract(12)][ix.extract(12)], table[iy.extract(13)][ix.extract(13)],
-      table[iy.extract(14)][ix.extract(14)], table[iy.extract(15)][ix.extract(15)]);
+    return lookup<dataSize>(index, data);
   }
 
   // notePitch is fractional note number. For example, notePitch = 60.12 means 60
   // semitones and 12 cents higher from midi note number 0.
-  Vec16f process(Vec16f notePitch, std::array<float *, nTablePadded> &table)
+  Vec16f process(Vec16f notePitch, const float *data)
   {
     phase += tick;
     phase = select(phase >= paddedLast, phase - tableSize, phase);
@@ -400,26 +408,22 @@ template<size_t tableSize> struct alignas(64) TableOsc16 {
 
     // Bilinear interpolation.
     Vec16f yFrac = notePitch - floor(notePitch);
-    Vec16i iy0 = truncatei(notePitch);
-    Vec16i iy1 = iy0 + 1;
-
     Vec16f xFrac = phase - floor(phase);
-    Vec16i ix0 = truncatei(phase);
-    Vec16i ix1 = ix0 + 1;
+    Vec16i index = truncatei(notePitch) * stride + truncatei(phase);
 
-    Vec16f table00 = loadTable(ix0, iy0, table);
-    Vec16f table01 = loadTable(ix1, iy0, table);
+    Vec16f table00 = loadTable(index, data);
+    Vec16f table01 = loadTable(index + 1, data);
     Vec16f y0 = table00 + xFrac * (table01 - table00);
 
-    Vec16f table10 = loadTable(ix0, iy1, table);
-    Vec16f table11 = loadTable(ix1, iy1, table);
+    index += stride;
+    Vec16f table10 = loadTable(index, data);
+    Vec16f table11 = loadTable(index + 1, data);
     Vec16f y1 = table10 + xFrac * (table11 - table10);
 
     return y0 + yFrac * (y1 - y0);
   }
 
-  // Too slow.
-  Vec16f processCubic(Vec16f notePitch, std::array<float *, nTablePadded> &table)
+  Vec16f processCubic(Vec16f notePitch, const float *data)
   {
     phase += tick;
     phase = select(phase >= paddedLast, phase - tableSize, phase);
@@ -428,44 +432,19 @@ template<size_t tableSize> struct alignas(64) TableOsc16 {
     notePitch += float(1);
     notePitch = select(notePitch >= notePitchUpperBound, notePitchUpperBound, notePitch);
 
-    // Bicubic interpolation.
+    // Bicubic interpolation. `index` starts from the top left of 4x4 taps.
     Vec16f yFrac = notePitch - floor(notePitch);
-    Vec16i iy1 = truncatei(notePitch);
-    Vec16i iy0 = iy1 - 1;
-    Vec16i iy2 = iy1 + 1;
-    Vec16i iy3 = iy1 + 2;
-
     Vec16f xFrac = phase - floor(phase);
-    Vec16i ix1 = truncatei(phase);
-    Vec16i ix0 = ix1 - 1;
-    Vec16i ix2 = ix1 + 1;
-    Vec16i ix3 = ix1 + 2;
-
-    Vec16f table00 = loadTable(ix0, iy0, table);
-    Vec16f table01 = loadTable(ix1, iy0, table);
-    Vec16f table02 = loadTable(ix2, iy0, table);
-    Vec16f table03 = loadTable(ix3, iy0, table);
-    Vec16f y0 = cubicInterp(table00, table01, table02, table03, xFrac);
-
-    Vec16f table10 = loadTable(ix0, iy1, table);
-    Vec16f table11 = loadTable(ix1, iy1, table);
-    Vec16f table12 = loadTable(ix2, iy1, table);
-    Vec16f table13 = loadTable(ix3, iy1, table);
-    Vec16f y1 = cubicInterp(table10, table11, table12, table13, xFrac);
-
-    Vec16f table20 = loadTable(ix0, iy2, table);
-    Vec16f table21 = loadTable(ix1, iy2, table);
-    Vec16f table22 = loadTable(ix2, iy2, table);
-    Vec16f table23 = loadTable(ix3, iy2, table);
-    Vec16f y2 = cubicInterp(table20, table21, table22, table23, xFrac);
-
-    Vec16f table30 = loadTable(ix0, iy3, table);
-    Vec16f table31 = loadTable(ix1, iy3, table);
-    Vec16f table32 = loadTable(ix2, iy3, table);
-    Vec16f table33 = loadTable(ix3, iy3, table);
-    Vec16f y3 = cubicInterp(table30, table31, table32, table33, xFrac);
-
-    return cubicInterp(y0, y1, y2, y3, yFrac);
+    Vec16i index = (truncatei(notePitch) - 1) * stride + truncatei(phase) - 1;
+
+    std::array<Vec16f, 4> y;
+    for (auto &yy : y) {
+      yy = cubicInterp(
+        loadTable(index, data), loadTable(index + 1, data), loadTable(index + 2, data),
+        loadTable(index + 3, data), xFrac);
+      index += stride;
+    }
+    return cubicInterp(y[0], y[1], y[2], y[3], yFrac);
   }
 };
 
@@ -124,6 +124,8 @@ enum ID {
   refreshLFO,
   refreshTable,
 
+  multiThread,
+
   ID_ENUM_LENGTH,
 };
 } // namespace ParameterID
@@ -181,12 +183,10 @@ struct Scales {
 };
 
 struct GlobalParameter : public ParameterInterface {
-  std::vector<std::unique_ptr<ValueInterface>> value;
+  ValueArray<ParameterID::ID_ENUM_LENGTH> value;
 
   GlobalParameter()
   {
-    value.resize(ParameterID::ID_ENUM_LENGTH);
-
     using ID = ParameterID::ID;
     using LinearValue = FloatValue<SomeDSP::LinearScale<double>>;
     using LogValue = FloatValue<SomeDSP::LogScale<double>>;
@@ -372,6 +372,9 @@ struct GlobalParameter : public ParameterInterface {
       0, Scales::boolScale, "refreshLFO", kParameterIsAutomable | kParameterIsBoolean);
     value[ID::refreshTable] = std::make_unique<IntValue>(
       0, Scales::boolScale, "refreshTable", kParameterIsAutomable | kParameterIsBoolean);
+
+    value[ID::multiThread] = std::make_unique<IntValue>(
+      0, Scales::boolScale, "multiThread", kParameterIsAutomable | kParameterIsBoolean);
   }
 
 #ifndef TEST_BUILD
@@ -384,10 +387,7 @@ struct GlobalParameter : public ParameterInterface {
 
   size_t idLength() override { return value.size(); }
 
-  void resetParameter()
-  {
-    for (auto &val : value) val->setFromNormalized(val->getDefaultNormalized());
-  }
+  void resetParameter() { value.reset(); }
 
   double getNormalized(uint32_t index) const override
   {
@@ -68,14 +68,7 @@ public:
 
     setGeometryConstraints(defaultWidth, defaultHeight, true, true);
 
-    if (palette.fontPath().size() > 0)
-      fontId = createFontFromFile("main", palette.fontPath().c_str());
-
-    if (fontId < 0) {
-      fontId = createFontFromMemory(
-        "main", (unsigned char *)(FontData::TinosBoldItalicData),
-        FontData::TinosBoldItalicDataSize, false);
-    }
+    loadFont();
 
     using ID = ParameterID::ID;
 
@@ -459,6 +452,11 @@ public:
       addCheckbox(
         miscLeft0, miscTop0 + labelY, knobWidth, labelHeight, uiTextSize, "Pool",
         ID::voicePool));
+    tabview->addWidget(
+      tabMain,
+      addCheckbox(
+        miscLeft0, miscTop0 + 2.0f * labelY, checkboxWidth, labelHeight, uiTextSize,
+        "Multi Thread", ID::multiThread));
 
     // LFO wavetable.
     const auto lfoWaveTop = lfoKnobTop + knobY + 0.5f * labelY;
@@ -225,8 +225,8 @@ void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.04f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.04f);
 
   interpPhaserPhase.setRange(float(twopi));
 
@@ -261,13 +261,14 @@ void DSPCORE_NAME::setParameters(float tempo)
 {
   using ID = ParameterID::ID;
 
-  SmootherCommon<float>::setTime(param.value[ID::smoothness]->getFloat());
+  smootherCommon.setTime(param.value[ID::smoothness]->getFloat());
 
   interpMasterGain.push(
+    smootherCommon,
     param.value[ID::gain]->getFloat() * param.value[ID::gainBoost]->getFloat());
 
-  interpPhaserMix.push(param.value[ID::phaserMix]->getFloat());
-  interpPhaserFeedback.push(param.value[ID::phaserFeedback]->getFloat());
+  interpPhaserMix.push(smootherCommon, param.value[ID::phaserMix]->getFloat());
+  interpPhaserFeedback.push(smootherCommon, param.value[ID::phaserFeedback]->getFloat());
 
   float lfoFreq;
   if (param.value[ParameterID::phaserTempoSync]->getInt()) {
@@ -282,15 +283,16 @@ void DSPCORE_NAME::setParameters(float tempo)
   } else {
     lfoFreq = param.value[ID::phaserFrequency]->getFloat();
   }
-  interpPhaserTick.push(lfoFreq * twopi / sampleRate);
+  interpPhaserTick.push(smootherCommon, lfoFreq * twopi / sampleRate);
 
   const float phaserRange = param.value[ID::phaserRange]->getFloat();
-  interpPhaserRange.push(phaserRange);
+  interpPhaserRange.push(smootherCommon, phaserRange);
   interpPhaserMin.push(
+    smootherCommon,
     Thiran2Phaser16::getOffset(phaserRange, param.value[ID::phaserMin]->getFloat()));
 
-  interpPhaserPhase.push(param.value[ID::phaserPhase]->getFloat());
-  interpPhaserOffset.push(param.value[ID::phaserOffset]->getFloat());
+  interpPhaserPhase.push(smootherCommon, param.value[ID::phaserPhase]->getFloat());
+  interpPhaserOffset.push(smootherCommon, param.value[ID::phaserOffset]->getFloat());
 
   auto phaserStage = param.value[ID::phaserStage]->getInt();
   phaser[0].setStage(phaserStage);
@@ -302,7 +304,7 @@ void DSPCORE_NAME::setParameters(float tempo)
 
 void DSPCORE_NAME::process(const size_t length, float *out0, float *out1)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   std::array<float, 2> frame{};
   for (size_t i = 0; i < length; ++i) {
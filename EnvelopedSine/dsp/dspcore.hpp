@@ -165,6 +165,7 @@ transitionBuffer is used to store a release of a note to reduce pop noise.
                                                                                          \
   private:                                                                               \
     float sampleRate = 44100.0f;                                                         \
+    SmootherCommon<float> smootherCommon;                                                \
                                                                                          \
     White16 rng{0};                                                                      \
     std::array<Thiran2Phaser16, 2> phaser;                                               \
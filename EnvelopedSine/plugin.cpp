@@ -26,6 +26,7 @@
 #include <utility>
 
 #include "DistrhoPlugin.hpp"
+#include "../common/dspload.hpp"
 #include "dsp/dspcore.hpp"
 
 START_NAMESPACE_DISTRHO
@@ -34,7 +35,9 @@ class EnvelopedSine : public Plugin {
 public:
   // Plugin(nParameters, nPrograms, nStates).
   EnvelopedSine()
-    : Plugin(ParameterID::ID_ENUM_LENGTH, GlobalParameter::Preset::Preset_ENUM_LENGTH, 0)
+    : Plugin(
+      ParameterID::ID_ENUM_LENGTH + DSPLoadMeter::nParameter,
+      GlobalParameter::Preset::Preset_ENUM_LENGTH, 0)
   {
     auto iset = instrset_detect();
     if (iset >= 10) {
@@ -78,6 +81,11 @@ protected:
 
   void initParameter(uint32_t index, Parameter &parameter) override
   {
+    if (index >= ParameterID::ID_ENUM_LENGTH) {
+      DSPLoadMeter::initParameter(index - ParameterID::ID_ENUM_LENGTH, parameter);
+      return;
+    }
+
     dsp->param.initParameter(index, parameter);
 
     switch (index) {
@@ -91,6 +99,8 @@ protected:
 
   float getParameterValue(uint32_t index) const override
   {
+    if (index >= ParameterID::ID_ENUM_LENGTH)
+      return loadMeter.getParameter(index - ParameterID::ID_ENUM_LENGTH);
     return dsp->param.getFloat(index);
   }
 
@@ -106,7 +116,11 @@ protected:
 
   void loadProgram(uint32_t index) override { dsp->param.loadProgram(index); }
 
-  void sampleRateChanged(double newSampleRate) { dsp->setup(newSampleRate); }
+  void sampleRateChanged(double newSampleRate)
+  {
+    loadMeter.setup(newSampleRate);
+    dsp->setup(newSampleRate);
+  }
   void activate() { dsp->startup(); }
   void deactivate() { dsp->reset(); }
 
@@ -170,11 +184,13 @@ protected:
     alreadyRecievedNote.resize(0);
 
     dsp->setParameters(timePos.bbt.beatsPerMinute);
+    auto probe = loadMeter.probe(frames);
     dsp->process(frames, outputs[0], outputs[1]);
   }
 
 private:
   std::unique_ptr<DSPInterface> dsp;
+  DSPLoadMeter loadMeter;
   bool wasPlaying = false;
   uint32_t noteId = 0;
   std::vector<std::pair<uint8_t, uint32_t>> lastNoteId;
@@ -55,26 +55,25 @@ void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.04f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.04f);
 
   interpPhase.setRange(float(twopi));
 
-  phaser[0].setup(sampleRate);
-  phaser[1].setup(sampleRate);
+  phaser.setup(sampleRate);
   startup();
 }
 
 void DSPCORE_NAME::reset()
 {
-  for (auto &ph : phaser) ph.reset();
+  phaser.reset();
   startup();
 }
 
 void DSPCORE_NAME::startup()
 {
-  for (size_t i = 0; i < phaser.size(); ++i) {
-    phaser[i].phase = float(i) / phaser.size();
+  for (size_t i = 0; i < phaser.phase.size(); ++i) {
+    phaser.phase[i] = float(i) / phaser.phase.size();
   }
 }
 
@@ -82,7 +81,7 @@ void DSPCORE_NAME::setParameters(float tempo)
 {
   using ID = ParameterID::ID;
 
-  SmootherCommon<float>::setTime(param.value[ID::smoothness]->getFloat());
+  smootherCommon.setTime(param.value[ID::smoothness]->getFloat());
 
   float lfoFreq;
   if (param.value[ParameterID::tempoSync]->getInt()) {
@@ -98,31 +97,30 @@ void DSPCORE_NAME::setParameters(float tempo)
   } else {
     lfoFreq = param.value[ID::frequency]->getFloat();
   }
-  interpTick.push(lfoFreq * twopi / sampleRate);
+  interpTick.push(smootherCommon, lfoFreq * twopi / sampleRate);
 
-  interpMix.push(param.value[ID::mix]->getFloat());
-  interpFreqSpread.push(param.value[ID::freqSpread]->getFloat());
-  interpFeedback.push(param.value[ID::feedback]->getFloat());
+  interpMix.push(smootherCommon, param.value[ID::mix]->getFloat());
+  interpFreqSpread.push(smootherCommon, param.value[ID::freqSpread]->getFloat());
+  interpFeedback.push(smootherCommon, param.value[ID::feedback]->getFloat());
 
   const float phaserRange = param.value[ID::range]->getFloat();
-  interpRange.push(phaserRange);
-  interpMin.push(Thiran2Phaser::getLfoMin(phaserRange, param.value[ID::min]->getFloat()));
+  interpRange.push(smootherCommon, phaserRange);
+  interpMin.push(
+    smootherCommon,
+    Thiran2Phaser::getLfoMin(phaserRange, param.value[ID::min]->getFloat()));
 
-  interpPhase.push(param.value[ID::phase]->getFloat());
-  interpStereoOffset.push(param.value[ID::stereoOffset]->getFloat());
-  interpCascadeOffset.push(param.value[ID::cascadeOffset]->getFloat());
+  interpPhase.push(smootherCommon, param.value[ID::phase]->getFloat());
+  interpStereoOffset.push(smootherCommon, param.value[ID::stereoOffset]->getFloat());
+  interpCascadeOffset.push(smootherCommon, param.value[ID::cascadeOffset]->getFloat());
 
-  auto phaserStage = param.value[ID::stage]->getInt();
-  phaser[0].setStage(phaserStage);
-  phaser[1].setStage(phaserStage);
+  phaser.setStage(param.value[ID::stage]->getInt());
 }
 
 void DSPCORE_NAME::process(
   const size_t length, const float *in0, const float *in1, float *out0, float *out1)
 {
-  SmootherCommon<float>::setBufferSize(length);
-  phaser[0].interpStage.setBufferSize(length);
-  phaser[1].interpStage.setBufferSize(length);
+  smootherCommon.setBufferSize(length);
+  phaser.interpStage.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     const auto freq = interpTick.process();
@@ -134,13 +132,11 @@ void DSPCORE_NAME::process(
     const auto stereo = interpStereoOffset.process();
     const auto cascade = interpCascadeOffset.process();
 
-    const auto phaser0
-      = phaser[0].process(in0[i], spread, cascade, phase, freq, feedback, range, min);
-    const auto phaser1 = phaser[1].process(
-      in0[i], spread, cascade, phase + stereo, freq, feedback, range, min);
+    const auto sig = phaser.process(
+      in0[i], in0[i], spread, cascade, phase, phase + stereo, freq, feedback, range, min);
 
     const auto mix = interpMix.process();
-    out0[i] = in0[i] + mix * (phaser0 - in0[i]);
-    out1[i] = in1[i] + mix * (phaser1 - in1[i]);
+    out0[i] = in0[i] + mix * (sig[0] - in0[i]);
+    out1[i] = in1[i] + mix * (sig[1] - in1[i]);
   }
 }
@@ -62,8 +62,9 @@ public:
                                                                                          \
   private:                                                                               \
     float sampleRate = 44100.0f;                                                         \
+    SmootherCommon<float> smootherCommon;                                                \
                                                                                          \
-    std::array<Thiran2Phaser, 2> phaser;                                                 \
+    Thiran2Phaser phaser;                                                                \
                                                                                          \
     LinearSmoother<float> interpMix;                                                     \
     LinearSmoother<float> interpTick;                                                    \
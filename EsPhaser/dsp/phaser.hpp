@@ -89,8 +89,6 @@ struct alignas(64) ThiranAllpass2x16 {
   Vec16f y0 = 0.0f;
   Vec16f y1 = 0.0f;
   Vec16f y2 = 0.0f;
-  Vec16f a1 = 0.0f;
-  Vec16f a2 = 0.0f;
 
   void reset()
   {
@@ -102,14 +100,18 @@ struct alignas(64) ThiranAllpass2x16 {
     y2 = 0.0f;
   }
 
-  // fraction > 0.01.
-  void step(float input, Vec16f fraction)
+  // fraction > 0.01. Coefficients only depend on fraction, so they are shared by all
+  // stages in a cascade.
+  static void computeCoefficients(Vec16f fraction, Vec16f &a1, Vec16f &a2)
   {
     auto delay = 2.0f - fraction;
     auto tmp = (delay - 2.0f) / (delay + 1.0f);
     a1 = -2.0f * tmp;
     a2 = (delay - 1.0f) / (delay + 2.0f) * tmp;
+  }
 
+  void step(float input, const Vec16f &a1, const Vec16f &a2)
+  {
     x2 = x1;
     x1 = x0;
     x0 = permute16<V_DC, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14>(x0);
@@ -123,10 +125,13 @@ struct alignas(64) ThiranAllpass2x16 {
   float get(int index) { return y0.extract(index); }
 };
 
+// Stereo phaser. Left and right cascades are stepped in the same loop, so the two serial
+// dependency chains overlap, and the stage interpolation and LFO tick are shared.
 struct alignas(64) Thiran2Phaser {
-  std::array<ThiranAllpass2x16, 256> allpass;
-  Vec16f phase{0};
-  float buffer = 0;
+  std::array<std::array<ThiranAllpass2x16, 2>, 256> allpass; // [block][channel].
+  std::array<Vec16f, 2> phase{};
+  Vec16f laneIndex{0};
+  std::array<float, 2> buffer{};
   float sampleRate = 44100;
   std::array<int, 2> stage{15, 15};
   std::array<int, 2> index{};
@@ -156,6 +161,7 @@ struct alignas(64) Thiran2Phaser {
   void setup(float sampleRate)
   {
     this->sampleRate = sampleRate;
+    for (int i = 0; i < 16; ++i) laneIndex.insert(i, float(i));
     interpStage.setSampleRate(sampleRate);
     interpStage.setTime(0.04f);
     interpStage.reset(1.0f);
@@ -163,44 +169,53 @@ struct alignas(64) Thiran2Phaser {
 
   void reset()
   {
-    for (auto &ap : allpass) ap.reset();
-    buffer = 0;
+    for (auto &block : allpass)
+      for (auto &ap : block) ap.reset();
+    buffer.fill(0);
   }
 
   // tick = frequency / sampleRate.
   // Stable only if (lfoRange - lfoMin) <= 0.99f.
-  float process(
-    float input,
+  std::array<float, 2> process(
+    float input0,
+    float input1,
     float freqSpread,
     float cascadeOffset,
-    float stereoOffset,
+    float lfoOffset0,
+    float lfoOffset1,
     float tick,
     float feedback,
     float lfoRange,
     float lfoMin)
   {
-    Vec16f tck;
-    Vec16f offset;
-    for (int i = 0; i < 16; ++i) {
-      tck.insert(i, freqSpread * i);
-      offset.insert(i, stereoOffset + i * cascadeOffset);
-    }
+    Vec16f tck = tick / (1.0f + freqSpread * laneIndex);
 
-    phase += tick / (1.0f + tck);
-    phase = select(phase > float(pi), phase - float(twopi), phase);
+    std::array<Vec16f, 2> a1;
+    std::array<Vec16f, 2> a2;
+    for (size_t ch = 0; ch < 2; ++ch) {
+      phase[ch] += tck;
+      phase[ch] = select(phase[ch] > float(pi), phase[ch] - float(twopi), phase[ch]);
 
-    Vec16f lfo = lfoRange * sin(phase + offset) - lfoMin;
+      Vec16f offset = (ch == 0 ? lfoOffset0 : lfoOffset1) + laneIndex * cascadeOffset;
+      Vec16f lfo = lfoRange * sin(phase[ch] + offset) - lfoMin;
+      ThiranAllpass2x16::computeCoefficients(lfo, a1[ch], a2[ch]);
+    }
 
-    buffer = juce::dsp::FastMathApproximations::tanh(input + feedback * buffer);
+    buffer[0] = juce::dsp::FastMathApproximations::tanh(input0 + feedback * buffer[0]);
+    buffer[1] = juce::dsp::FastMathApproximations::tanh(input1 + feedback * buffer[1]);
     for (int i = 0; i <= arrayStop; ++i) {
-      allpass[i].step(buffer, lfo);
-      buffer = allpass[i].get(15);
+      allpass[i][0].step(buffer[0], a1[0], a2[0]);
+      allpass[i][1].step(buffer[1], a1[1], a2[1]);
+      buffer[0] = allpass[i][0].get(15);
+      buffer[1] = allpass[i][1].get(15);
     }
 
-    auto sig0 = allpass[index[0]].get(stage[0]);
-    auto sig1 = allpass[index[1]].get(stage[1]);
-    buffer = sig0 + interpStage.process() * (sig1 - sig0);
-
+    const auto interp = interpStage.process();
+    for (size_t ch = 0; ch < 2; ++ch) {
+      auto sig0 = allpass[index[0]][ch].get(stage[0]);
+      auto sig1 = allpass[index[1]][ch].get(stage[1]);
+      buffer[ch] = sig0 + interp * (sig1 - sig0);
+    }
     return buffer;
   }
 };
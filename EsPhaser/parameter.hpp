@@ -77,12 +77,10 @@ struct Scales {
 };
 
 struct GlobalParameter : public ParameterInterface {
-  std::vector<std::unique_ptr<ValueInterface>> value;
+  ValueArray<ParameterID::ID_ENUM_LENGTH> value;
 
   GlobalParameter()
   {
-    value.resize(ParameterID::ID_ENUM_LENGTH);
-
     using ID = ParameterID::ID;
     using LinearValue = FloatValue<SomeDSP::LinearScale<double>>;
     using LogValue = FloatValue<SomeDSP::LogScale<double>>;
@@ -138,10 +136,7 @@ struct GlobalParameter : public ParameterInterface {
 
   size_t idLength() override { return value.size(); }
 
-  void resetParameter()
-  {
-    for (auto &val : value) val->setFromNormalized(val->getDefaultNormalized());
-  }
+  void resetParameter() { value.reset(); }
 
   double getNormalized(uint32_t index) const override
   {
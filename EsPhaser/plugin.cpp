@@ -26,6 +26,7 @@
 #include <utility>
 
 #include "DistrhoPlugin.hpp"
+#include "../common/dspload.hpp"
 #include "dsp/dspcore.hpp"
 
 START_NAMESPACE_DISTRHO
@@ -34,7 +35,9 @@ class EsPhaser : public Plugin {
 public:
   // Plugin(nParameters, nPrograms, nStates).
   EsPhaser()
-    : Plugin(ParameterID::ID_ENUM_LENGTH, GlobalParameter::Preset::Preset_ENUM_LENGTH, 0)
+    : Plugin(
+      ParameterID::ID_ENUM_LENGTH + DSPLoadMeter::nParameter,
+      GlobalParameter::Preset::Preset_ENUM_LENGTH, 0)
   {
     auto iset = instrset_detect();
     if (iset >= 10) {
@@ -75,6 +78,11 @@ protected:
 
   void initParameter(uint32_t index, Parameter &parameter) override
   {
+    if (index >= ParameterID::ID_ENUM_LENGTH) {
+      DSPLoadMeter::initParameter(index - ParameterID::ID_ENUM_LENGTH, parameter);
+      return;
+    }
+
     dsp->param.initParameter(index, parameter);
 
     switch (index) {
@@ -88,6 +96,8 @@ protected:
 
   float getParameterValue(uint32_t index) const override
   {
+    if (index >= ParameterID::ID_ENUM_LENGTH)
+      return loadMeter.getParameter(index - ParameterID::ID_ENUM_LENGTH);
     return dsp->param.getFloat(index);
   }
 
@@ -103,7 +113,11 @@ protected:
 
   void loadProgram(uint32_t index) override { dsp->param.loadProgram(index); }
 
-  void sampleRateChanged(double newSampleRate) { dsp->setup(newSampleRate); }
+  void sampleRateChanged(double newSampleRate)
+  {
+    loadMeter.setup(newSampleRate);
+    dsp->setup(newSampleRate);
+  }
   void activate() { dsp->startup(); }
   void deactivate() { dsp->reset(); }
 
@@ -123,11 +137,13 @@ protected:
     wasPlaying = timePos.playing;
 
     dsp->setParameters(timePos.bbt.beatsPerMinute);
+    auto probe = loadMeter.probe(frames);
     dsp->process(frames, inputs[0], inputs[1], outputs[0], outputs[1]);
   }
 
 private:
   std::unique_ptr<DSPInterface> dsp;
+  DSPLoadMeter loadMeter;
   bool wasPlaying = false;
 
   DISTRHO_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EsPhaser)
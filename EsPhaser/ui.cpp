@@ -105,14 +105,7 @@ public:
 
     setGeometryConstraints(defaultWidth, defaultHeight, true, true);
 
-    if (palette.fontPath().size() > 0)
-      fontId = createFontFromFile("main", palette.fontPath().c_str());
-
-    if (fontId < 0) {
-      fontId = createFontFromMemory(
-        "main", (unsigned char *)(FontData::TinosBoldItalicData),
-        FontData::TinosBoldItalicDataSize, false);
-    }
+    loadFont();
 
     using ID = ParameterID::ID;
 
@@ -169,10 +169,10 @@ public:
     delayTime.reset(maxTime);
   }
 
-  void set(Sample gain, Sample timeSec)
+  void set(const SmootherCommon<Sample> &common, Sample gain, Sample timeSec)
   {
     this->gain = gain;
-    delayTime.push(timeSec);
+    delayTime.push(common, timeSec);
   }
 
   void reset()
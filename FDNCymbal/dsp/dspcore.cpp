@@ -30,12 +30,27 @@ inline float midiNoteToFrequency(float pitch, float tuning)
 
 float paramToPitch(float bend) { return powf(2.0f, ((bend - 0.5f) * 400.0f) / 1200.0f); }
 
+inline bool isSilent(const float *buffer, size_t length)
+{
+  if (buffer == nullptr) return true;
+  for (size_t i = 0; i < length; ++i) {
+    if (std::fabs(buffer[i]) >= hitSilence) return false;
+  }
+  return true;
+}
+
 void DSPCore::setup(double sampleRate)
+{
+  setupDSP(sampleRate);
+  liveCountdown = 0;
+}
+
+void DSPCore::setupDSP(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   noteStack.reserve(128);
   noteStack.resize(0);
@@ -88,6 +103,8 @@ void DSPCore::reset()
 
   tremoloDelay.reset();
 
+  hitCache.reset();
+
   startup();
 }
 
@@ -101,52 +118,169 @@ void DSPCore::setParameters()
 {
   using ID = ParameterID::ID;
 
-  SmootherCommon<float>::setTime(param.value[ID::smoothness]->getFloat());
+  smootherCommon.setTime(param.value[ID::smoothness]->getFloat());
 
   if (!noteStack.empty()) {
     velocity = noteStack.back().velocity;
     const auto freq
       = noteStack.back().frequency * paramToPitch(param.value[ID::pitchBend]->getFloat());
-    interpPitch.push(freq);
+    interpPitch.push(smootherCommon, freq);
   } else {
-    interpPitch.push(0.0f);
+    interpPitch.push(smootherCommon, 0.0f);
   }
-  interpMasterGain.push(velocity * param.value[ID::gain]->getFloat());
+  interpMasterGain.push(smootherCommon, velocity * param.value[ID::gain]->getFloat());
 
-  interpStickToneMix.push(param.value[ID::stickToneMix]->getFloat());
-  interpStickPulseMix.push(param.value[ID::stickPulseMix]->getFloat());
-  interpStickVelvetMix.push(param.value[ID::stickVelvetMix]->getFloat());
+  interpStickToneMix.push(smootherCommon, param.value[ID::stickToneMix]->getFloat());
+  interpStickPulseMix.push(smootherCommon, param.value[ID::stickPulseMix]->getFloat());
+  interpStickVelvetMix.push(smootherCommon, param.value[ID::stickVelvetMix]->getFloat());
 
-  interpFDNFeedback.push(param.value[ID::fdnFeedback]->getFloat());
-  interpFDNCascadeMix.push(param.value[ID::fdnCascadeMix]->getFloat());
+  interpFDNFeedback.push(smootherCommon, param.value[ID::fdnFeedback]->getFloat());
+  interpFDNCascadeMix.push(smootherCommon, param.value[ID::fdnCascadeMix]->getFloat());
 
-  interpAllpassMix.push(param.value[ID::allpassMix]->getFloat());
-  interpAllpass1Feedback.push(param.value[ID::allpass1Feedback]->getFloat());
-  interpAllpass2Feedback.push(param.value[ID::allpass2Feedback]->getFloat());
+  interpAllpassMix.push(smootherCommon, param.value[ID::allpassMix]->getFloat());
+  interpAllpass1Feedback.push(
+    smootherCommon, param.value[ID::allpass1Feedback]->getFloat());
+  interpAllpass2Feedback.push(
+    smootherCommon, param.value[ID::allpass2Feedback]->getFloat());
 
-  interpTremoloMix.push(param.value[ID::tremoloMix]->getFloat());
-  interpTremoloDepth.push(randomTremoloDepth * param.value[ID::tremoloDepth]->getFloat());
+  interpTremoloMix.push(smootherCommon, param.value[ID::tremoloMix]->getFloat());
+  interpTremoloDepth.push(
+    smootherCommon, randomTremoloDepth * param.value[ID::tremoloDepth]->getFloat());
   interpTremoloFrequency.push(
+    smootherCommon,
     randomTremoloFrequency * param.value[ID::tremoloFrequency]->getFloat());
   interpTremoloDelayTime.push(
+    smootherCommon,
     randomTremoloDelayTime * param.value[ID::tremoloDelayTime]->getFloat());
 
   serialAP1Highpass.setCutoffQ(
     param.value[ID::allpass1HighpassCutoff]->getFloat(), highpassQ);
   serialAP2Highpass.setCutoffQ(
     param.value[ID::allpass2HighpassCutoff]->getFloat(), highpassQ);
+
+  if (param.value[ID::hitCache]->getInt()) {
+    hitCache.start(renderHit);
+
+    hitKey = HitKey();
+    for (size_t i = 0; i < hitRequest.value.size(); ++i) {
+      hitRequest.value[i] = param.value[i]->getFloat();
+      if (i == ID::bypass || i == ID::gain || i == ID::hitCache) continue;
+      hitKey.add(hitRequest.value[i]);
+    }
+    hitRequest.sampleRate = sampleRate;
+    hitKey.add(sampleRate);
+
+    isHitCacheable = param.value[ID::stick]->getInt()
+      && param.value[ID::retriggerStick]->getInt()
+      && param.value[ID::retriggerTime]->getInt()
+      && (param.value[ID::tremoloMix]->getFloat() == 0.0
+          || param.value[ID::retriggerTremolo]->getInt());
+  }
 }
 
 void DSPCore::process(
   const size_t length, const float *in0, const float *in1, float *out0, float *out1)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  if (!param.value[ParameterID::hitCache]->getInt()) {
+    hitCache.reset();
+    liveCountdown = int64_t(sampleRate);
+    processLive(length, in0, in1, out0, out1);
+    return;
+  }
+
+  hitCache.collect();
+
+  // Cached hits follow the master gain of live synthesis.
+  auto interpCacheGain = interpMasterGain;
+
+  // Cached hits are removed from `midiNotes`. Missed hits are requested and played live.
+  bool isNoteOn = false;
+  for (auto it = midiNotes.begin(); it != midiNotes.end();) {
+    if (!it->isNoteOn) {
+      ++it;
+      continue;
+    }
+
+    if (isHitCacheable) {
+      auto key = hitKey;
+      key.add(it->pitch);
+      key.add(it->tuning);
+      if (hitCache.play(key.get(), it->frame, 1.0f)) {
+        // Velocity is applied by master gain from next block, as same as live note.
+        noteStack.push_back(
+          {it->id, midiNoteToFrequency(it->pitch, it->tuning), it->velocity});
+        it = midiNotes.erase(it);
+        continue;
+      }
+      hitCache.request(key.get(), [&](HitRequest &request) {
+        request = hitRequest;
+        request.pitch = it->pitch;
+        request.tuning = it->tuning;
+      });
+    }
+    isNoteOn = true;
+    ++it;
+  }
+
+  // Inputs are checked before writing outputs, because they may share the same buffer.
+  if (liveCountdown > 0 || isNoteOn || !isSilent(in0, length) || !isSilent(in1, length)) {
+    processLive(length, in0, in1, out0, out1);
+
+    float peak = 0.0f;
+    for (size_t i = 0; i < length; ++i) peak = std::max(peak, std::fabs(out0[i]));
+    // Attack of a new note may start after this block.
+    const float gain = interpMasterGain.getValue();
+    if (isNoteOn || gain <= 0.0f || peak >= hitSilence * gain)
+      liveCountdown = int64_t(sampleRate);
+    else
+      liveCountdown -= int64_t(length);
+  } else {
+    for (const auto &note : midiNotes) noteOff(note.id);
+    midiNotes.clear();
+    for (size_t i = 0; i < length; ++i) interpMasterGain.process();
+    std::fill(out0, out0 + length, 0.0f);
+    std::fill(out1, out1 + length, 0.0f);
+  }
+
+  if (!hitCache.isPlaying()) return;
+  for (size_t i = 0; i < length; ++i) {
+    const float sample = interpCacheGain.process() * hitCache.process();
+    out0[i] += sample;
+    out1[i] += sample;
+  }
+}
+
+std::vector<float>
+DSPCore::renderHit(const HitRequest &request, const std::atomic<bool> &isRunning)
+{
+  using ID = ParameterID::ID;
+
+  auto dsp = std::make_unique<DSPCore>();
+  for (size_t i = 0; i < request.value.size(); ++i)
+    dsp->param.value[i]->setFromFloat(request.value[i]);
+  dsp->param.value[ID::gain]->setFromFloat(1.0);
+  dsp->param.value[ID::hitCache]->setFromInt(0);
+
+  dsp->setupDSP(request.sampleRate);
+  dsp->noteOn(0, request.pitch, request.tuning, 1.0f);
+
+  return renderHitUntilSilence(
+    request.sampleRate, isRunning, [&](float *out, size_t length) {
+      dsp->setParameters();
+      dsp->processLive(length, nullptr, nullptr, out, out);
+    });
+}
+
+void DSPCore::processLive(
+  const size_t length, const float *in0, const float *in1, float *out0, float *out1)
+{
+  smootherCommon.setBufferSize(length);
 
   for (auto &fdn : fdnCascade)
-    for (auto &time : fdn.delayTime) time.refresh();
-  for (auto &ap : serialAP1.allpass) ap.delayTime.refresh();
+    for (auto &time : fdn.delayTime) time.refresh(smootherCommon);
+  for (auto &ap : serialAP1.allpass) ap.delayTime.refresh(smootherCommon);
   for (auto &section : serialAP2)
-    for (auto &ap : section.allpass) ap.delayTime.refresh();
+    for (auto &ap : section.allpass) ap.delayTime.refresh(smootherCommon);
 
   const bool enableFDN = param.value[ParameterID::fdn]->getInt();
   const bool allpass1Saturation = param.value[ParameterID::allpass1Saturation]->getInt();
@@ -266,6 +400,7 @@ void DSPCore::noteOn(int32_t noteId, int16_t pitch, float tuning, float velocity
       fdnCascade[n].gain[i] = (rng.process() < 0.5f ? 1.0f : -1.0f)
         * (0.1f + rng.process()) * 2.0f / fdnMatrixSize;
       fdnCascade[n].delayTime[i].push(
+        smootherCommon,
         rng.process() * delayTimeMod * param.value[ParameterID::fdnTime]->getFloat());
     }
   }
@@ -273,14 +408,17 @@ void DSPCore::noteOn(int32_t noteId, int16_t pitch, float tuning, float velocity
   // Set serialAP.
   float ap1Time = param.value[ParameterID::allpass1Time]->getFloat();
   for (auto &ap : serialAP1.allpass) {
-    ap.set(0.001f + 0.999f * rng.process(), ap1Time + ap1Time * rng.process());
+    ap.set(
+      smootherCommon, 0.001f + 0.999f * rng.process(), ap1Time + ap1Time * rng.process());
     ap1Time *= 1.5f;
   }
 
   float ap2Time = param.value[ParameterID::allpass2Time]->getFloat();
   for (auto &allpass : serialAP2) {
     for (auto &ap : allpass.allpass)
-      ap.set(0.001f + 0.999f * rng.process(), ap2Time + ap2Time * rng.process());
+      ap.set(
+        smootherCommon, 0.001f + 0.999f * rng.process(),
+        ap2Time + ap2Time * rng.process());
     ap2Time *= 1.5f;
   }
 
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "../../common/dsp/constants.hpp"
+#include "../../common/dsp/hitcache.hpp"
 #include "../../common/dsp/smoother.hpp"
 #include "../parameter.hpp"
 #include "delay.hpp"
@@ -26,8 +27,10 @@
 #include "oscillator.hpp"
 
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <memory>
+#include <vector>
 
 using namespace SomeDSP;
 
@@ -103,7 +106,38 @@ public:
   }
 
 private:
+  /**
+  Hit cache plays back a rendered hit in place of live synthesis, when the hit sounds the
+  same on every note-on. That is, random seeds are retriggered and the stick is on.
+
+  A hit is rendered from rest at unity gain. A missed hit is played by live synthesis as
+  same as when the cache is off, so it doesn't cut off the hits still ringing. Cached
+  hits are scaled by the master gain of live synthesis, which follows the velocity of the
+  latest note on next block. Overlapping cached hits are summed instead of exciting the
+  same FDN, and note-off doesn't change a cached hit. Live synthesis is skipped while it
+  is silent.
+  */
+  struct HitRequest {
+    std::array<double, ParameterID::ID_ENUM_LENGTH> value;
+    float sampleRate;
+    int16_t pitch;
+    float tuning;
+  };
+
+  void setupDSP(double sampleRate);
+  void processLive(
+    const size_t length, const float *in0, const float *in1, float *out0, float *out1);
+  static std::vector<float>
+  renderHit(const HitRequest &request, const std::atomic<bool> &isRunning);
+
+  HitCache<HitRequest> hitCache;
+  HitRequest hitRequest; // Parameters of current block.
+  HitKey hitKey;
+  bool isHitCacheable = false;
+  int64_t liveCountdown = 0; // Live synthesis is skipped when this reaches 0.
+
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
 
   float velocity = 0;
   std::vector<NoteInfo> noteStack; // Top of this stack is current note.
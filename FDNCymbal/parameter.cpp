@@ -40,6 +40,8 @@ LogScale<double> Scales::smoothness(0.0, 0.5, 0.2, 0.02);
 LogScale<double> Scales::gain(0.0, 4.0, 0.75, 0.5);
 
 // Generated from preset dump. This works, but hard coding preset data is seriously bad.
+#ifndef TEST_BUILD
+
 void GlobalParameter::loadProgram(uint32_t index)
 {
   using ID = ParameterID::ID;
@@ -446,3 +448,4 @@ void GlobalParameter::loadProgram(uint32_t index)
     } break;
   }
 }
+#endif
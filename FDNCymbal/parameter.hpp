@@ -68,6 +68,8 @@ enum ID {
   gain,
   pitchBend,
 
+  hitCache,
+
   ID_ENUM_LENGTH,
 };
 } // namespace ParameterID
@@ -94,12 +96,10 @@ struct Scales {
 };
 
 struct GlobalParameter : public ParameterInterface {
-  std::vector<std::unique_ptr<ValueInterface>> value;
+  ValueArray<ParameterID::ID_ENUM_LENGTH> value;
 
   GlobalParameter()
   {
-    value.resize(ParameterID::ID_ENUM_LENGTH);
-
     using ID = ParameterID::ID;
     using LinearValue = FloatValue<SomeDSP::LinearScale<double>>;
     using LogValue = FloatValue<SomeDSP::LogScale<double>>;
@@ -181,6 +181,9 @@ struct GlobalParameter : public ParameterInterface {
       = std::make_unique<LogValue>(0.5, Scales::gain, "gain", kParameterIsAutomable);
     value[ID::pitchBend] = std::make_unique<LinearValue>(
       0.5, Scales::defaultScale, "pitchBend", kParameterIsAutomable);
+
+    value[ID::hitCache] = std::make_unique<IntValue>(
+      0, Scales::boolScale, "hitCache", kParameterIsAutomable | kParameterIsBoolean);
   }
 
 #ifndef TEST_BUILD
@@ -193,10 +196,7 @@ struct GlobalParameter : public ParameterInterface {
 
   size_t idLength() override { return value.size(); }
 
-  void resetParameter()
-  {
-    for (auto &val : value) val->setFromNormalized(val->getDefaultNormalized());
-  }
+  void resetParameter() { value.reset(); }
 
   double getNormalized(uint32_t index) const override
   {
@@ -23,6 +23,7 @@
 #include <utility>
 
 #include "DistrhoPlugin.hpp"
+#include "../common/dspload.hpp"
 #include "dsp/dspcore.hpp"
 
 START_NAMESPACE_DISTRHO
@@ -31,7 +32,9 @@ class FDNCymbal : public Plugin {
 public:
   // Plugin(nParameters, nPrograms, nStates).
   FDNCymbal()
-    : Plugin(ParameterID::ID_ENUM_LENGTH, GlobalParameter::Preset::Preset_ENUM_LENGTH, 0)
+    : Plugin(
+      ParameterID::ID_ENUM_LENGTH + DSPLoadMeter::nParameter,
+      GlobalParameter::Preset::Preset_ENUM_LENGTH, 0)
   {
     sampleRateChanged(getSampleRate());
     lastNoteId.reserve(dsp.maxVoice + 1);
@@ -60,6 +63,11 @@ protected:
 
   void initParameter(uint32_t index, Parameter &parameter) override
   {
+    if (index >= ParameterID::ID_ENUM_LENGTH) {
+      DSPLoadMeter::initParameter(index - ParameterID::ID_ENUM_LENGTH, parameter);
+      return;
+    }
+
     dsp.param.initParameter(index, parameter);
 
     switch (index) {
@@ -73,6 +81,8 @@ protected:
 
   float getParameterValue(uint32_t index) const override
   {
+    if (index >= ParameterID::ID_ENUM_LENGTH)
+      return loadMeter.getParameter(index - ParameterID::ID_ENUM_LENGTH);
     return dsp.param.getFloat(index);
   }
 
@@ -88,7 +98,11 @@ protected:
 
   void loadProgram(uint32_t index) override { dsp.param.loadProgram(index); }
 
-  void sampleRateChanged(double newSampleRate) { dsp.setup(newSampleRate); }
+  void sampleRateChanged(double newSampleRate)
+  {
+    loadMeter.setup(newSampleRate);
+    dsp.setup(newSampleRate);
+  }
   void activate() { dsp.startup(); }
   void deactivate() { dsp.reset(); }
 
@@ -153,11 +167,13 @@ protected:
     alreadyRecievedNote.resize(0);
 
     dsp.setParameters();
+    auto probe = loadMeter.probe(frames);
     dsp.process(frames, inputs[0], inputs[1], outputs[0], outputs[1]);
   }
 
 private:
   DSPCore dsp;
+  DSPLoadMeter loadMeter;
   bool wasPlaying = false;
   uint32_t noteId = 0;
   std::vector<std::pair<uint8_t, uint32_t>> lastNoteId;
@@ -84,7 +84,7 @@ constexpr float sliderY = sliderHeight + labelY;
 constexpr float checkboxWidth = 80.0f;
 constexpr uint32_t defaultWidth = uint32_t(40 + sliderX + 7 * knobX + 6 * margin);
 constexpr uint32_t defaultHeight
-  = uint32_t(20 + 3 * knobY + 3 * labelHeight + 3 * margin);
+  = uint32_t(20 + 3 * knobY + 4 * labelHeight + 6 * margin);
 
 class FDNCymbalUI : public PluginUIBase {
 protected:
@@ -105,14 +105,7 @@ public:
 
     setGeometryConstraints(defaultWidth, defaultHeight, true, true);
 
-    if (palette.fontPath().size() > 0)
-      fontId = createFontFromFile("main", palette.fontPath().c_str());
-
-    if (fontId < 0) {
-      fontId = createFontFromMemory(
-        "main", (unsigned char *)(FontData::TinosBoldItalicData),
-        FontData::TinosBoldItalicDataSize, false);
-    }
+    loadFont();
 
     using ID = ParameterID::ID;
 
@@ -218,6 +211,11 @@ public:
       left0 - margin, top2 + labelHeight + margin, sliderX, margin, uiTextSize, "Smooth",
       ID::smoothness);
 
+    // Hit cache.
+    addToggleButton(
+      left0 - margin, top2 + labelHeight + knobY, checkboxWidth, labelHeight, midTextSize,
+      "Hit Cache", ID::hitCache);
+
     // Tremolo.
     const auto leftTremolo = left0 + sliderX + 2.0f * margin;
     addGroupLabel(leftTremolo, top2, 4.0f * knobX, labelHeight, midTextSize, "Tremolo");
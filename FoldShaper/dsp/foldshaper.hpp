@@ -15,57 +15,94 @@
 // You should have received a copy of the GNU General Public License
 // along with FoldShaper.  If not, see <https://www.gnu.org/licenses/>.
 
-#include "../../common/dsp/decimationLowpass.hpp"
+#pragma once
+
 #include "../../common/dsp/somemath.hpp"
+#include "../../lib/vcl/vectorclass.h"
+#include "../../lib/vcl/vectormath_exp.h"
 
 #include <algorithm>
 
 namespace SomeDSP {
 
-template<typename Sample> class FoldShaper {
+class FoldShaper {
 public:
-  Sample gain = 1;
-  Sample multiply = 1; // Must be greater than 0.
+  float gain = 1;
+  float multiply = 1; // Must be greater than 0.
   bool hardclip = true;
 
-  Sample x1 = 0;
-  DecimationLowpass16<Sample> lowpass;
-
-  void reset()
-  {
-    x1 = 0;
-    lowpass.reset();
-  }
-
-  Sample process(Sample x0)
+  float process(float x0)
   {
-    if (hardclip) x0 = std::clamp(x0, Sample(-1), Sample(1));
-    Sample absed = somefabs(x0 * gain);
-    Sample floored = somefloor(absed);
-    Sample mul = somepow(multiply, floored);
+    if (hardclip) x0 = std::clamp(x0, float(-1), float(1));
+    float absed = somefabs(x0 * gain);
+    float floored = somefloor(absed);
+    float mul = somepow(multiply, floored);
 
-    Sample output;
+    float output;
     if (int(floored) % 2 == 1) {
-      output = somecopysign(Sample(1), x0) - somecopysign(mul * (absed - floored), x0);
-    } else if (floored >= Sample(1)) {
-      output = somecopysign(mul * (absed - floored) + (Sample(1) - mul / multiply), x0);
+      output = somecopysign(float(1), x0) - somecopysign(mul * (absed - floored), x0);
+    } else if (floored >= float(1)) {
+      output = somecopysign(mul * (absed - floored) + (float(1) - mul / multiply), x0);
     } else {
-      output = somecopysign(mul * (absed - floored) + (Sample(1) - mul), x0);
+      output = somecopysign(mul * (absed - floored) + (float(1) - mul), x0);
     }
     return std::isfinite(output) ? output : 0;
   }
 
-  Sample process16(Sample x0)
+  /**
+  Vectorized `process()` on 16 oversampled samples. `pow(multiply, floored)` becomes
+  `exp2(floored * log2(multiply))`, and `log2` is only computed once per call.
+  */
+  Vec16f process(Vec16f x0)
   {
-    if (hardclip) x0 = std::clamp(x0, Sample(-1), Sample(1));
-    Sample diff = x0 - x1;
-    for (int i = 0; i < 16; ++i) lowpass.push(process(x1 + i / Sample(16) * diff));
-    x1 = x0;
-    if (std::isfinite(lowpass.output())) return lowpass.output();
+    if (hardclip) x0 = min(max(x0, -1.0f), 1.0f);
+    Vec16f absed = abs(x0 * gain);
+    Vec16f floored = floor(absed);
+    Vec16f fraction = absed - floored;
+    Vec16f mul = exp2(floored * somelog2(multiply));
+    mul = select(floored == 0, Vec16f(1.0f), mul); // pow(0, 0) == 1.
 
-    reset();
-    return 0;
+    auto isOdd = floored - 2.0f * floor(0.5f * floored) == 1.0f;
+    Vec16f odd = 1.0f - mul * fraction;
+    Vec16f even = abs(mul * fraction + 1.0f - select(floored >= 1, mul / multiply, mul));
+    Vec16f output = sign_combine(select(isOdd, odd, even), x0);
+    return select(is_finite(output), output, Vec16f(0.0f));
   }
 };
 
+/**
+`FoldShaper` on lanes of `Vec`. Each lane has its own `multiply` and `hardclip`.
+`hardclip` is 1 for on, and 0 for off.
+*/
+template<typename Vec> class FoldShaperLane {
+public:
+  void set(Vec multiply, Vec hardclip)
+  {
+    this->multiply = multiply;
+    this->hardclip = hardclip;
+    logMultiply = log2(multiply);
+  }
+
+  Vec process(Vec x0)
+  {
+    x0 = select(hardclip != 0.0f, min(max(x0, -1.0f), 1.0f), x0);
+    Vec absed = abs(x0);
+    Vec floored = floor(absed);
+    Vec fraction = absed - floored;
+    Vec mul = exp2(floored * logMultiply);
+    mul = select(floored == 0, Vec(1.0f), mul);
+
+    auto isOdd = floored - 2.0f * floor(0.5f * floored) == 1.0f;
+    Vec odd = 1.0f - mul * fraction;
+    Vec even = abs(mul * fraction + 1.0f - select(floored >= 1, mul / multiply, mul));
+    Vec output = sign_combine(select(isOdd, odd, even), x0);
+    return select(is_finite(output), output, Vec(0.0f));
+  }
+
+private:
+  Vec multiply = 1.0f;
+  Vec logMultiply = 0.0f;
+  Vec hardclip = 1.0f;
+};
+
 } // namespace SomeDSP
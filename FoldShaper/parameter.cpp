@@ -29,3 +29,5 @@ LinearScale<double> Scales::mul(1e-5, 1.0);
 LinearScale<double> Scales::moreMul(1.0, 4.0);
 
 LogScale<double> Scales::smoothness(0.0, 0.5, 0.1, 0.04);
+
+IntScale<double> Scales::oversampleFactor(3);
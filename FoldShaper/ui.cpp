@@ -80,7 +80,7 @@ constexpr float knobY = knobHeight + labelY;
 constexpr float checkboxWidth = 60.0f;
 constexpr float splashHeight = 20.0f;
 constexpr uint32_t defaultWidth = uint32_t(6 * knobX + 30);
-constexpr uint32_t defaultHeight = uint32_t(30 + 2 * labelY + splashHeight + margin);
+constexpr uint32_t defaultHeight = uint32_t(30 + knobY + 3 * margin + labelHeight);
 
 class FoldShaperUI : public PluginUIBase {
 protected:
@@ -101,14 +101,7 @@ public:
 
     setGeometryConstraints(defaultWidth, defaultHeight, true, true);
 
-    if (palette.fontPath().size() > 0)
-      fontId = createFontFromFile("main", palette.fontPath().c_str());
-
-    if (fontId < 0) {
-      fontId = createFontFromMemory(
-        "main", (unsigned char *)(FontData::TinosBoldItalicData),
-        FontData::TinosBoldItalicDataSize, false);
-    }
+    loadFont();
 
     using ID = ParameterID::ID;
 
@@ -130,6 +123,16 @@ public:
       checkboxLeft, checkboxTop + labelY, knobX, labelHeight, uiTextSize, "Hardclip",
       ID::hardclip);
 
+    const auto top1 = top0 + knobY + 3 * margin;
+    addLabel(left0, top1, knobX, labelHeight, uiTextSize, "Factor");
+    std::vector<std::string> oversampleFactorItems{"2x", "4x", "8x", "16x"};
+    addOptionMenu(
+      left0 + knobX, top1, knobX, labelHeight, uiTextSize, ID::oversampleFactor,
+      oversampleFactorItems);
+    addCheckbox(
+      left0 + 2 * knobX + 2 * margin, top1, 1.5f * knobX, labelHeight, uiTextSize,
+      "Linear Phase", ID::linearPhase);
+
     // Plugin name.
     const auto splashTop = checkboxTop + 2 * labelY + margin;
     const auto splashLeft = checkboxLeft;
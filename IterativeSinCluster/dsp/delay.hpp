@@ -118,6 +118,7 @@ public:
 
   // frequency can be negative.
   void setParam(
+    const SmootherCommon<Sample> &common,
     Sample frequency,
     Sample phase,
     Sample feedback,
@@ -125,12 +126,12 @@ public:
     Sample delayTimeRange,
     Sample minDelayTime)
   {
-    interpTick.push(Sample(twopi) * frequency / delay.sampleRate);
-    interpPhase.push(phase);
-    interpFeedback.push(feedback);
-    interpDepth.push(depth);
-    interpDelayTimeRange.push(delayTimeRange);
-    interpMinDelayTime.push(minDelayTime);
+    interpTick.push(common, Sample(twopi) * frequency / delay.sampleRate);
+    interpPhase.push(common, phase);
+    interpFeedback.push(common, feedback);
+    interpDepth.push(common, depth);
+    interpDelayTimeRange.push(common, delayTimeRange);
+    interpMinDelayTime.push(common, minDelayTime);
   }
 
   void reset()
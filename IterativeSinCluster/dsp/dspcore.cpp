@@ -213,8 +213,8 @@ void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.04f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.04f);
 
   for (auto &note : notes) note.setup(sampleRate);
 
@@ -226,6 +226,9 @@ void DSPCORE_NAME::setup(double sampleRate)
   // 2 msec + 1 sample transition time.
   transitionBuffer.resize(1 + size_t(sampleRate * 0.005), {0, 0});
 
+  // Threads are started here because `setParameters()` is called on audio thread.
+  VoicePool::instance().start();
+
   startup();
 }
 
@@ -245,15 +248,18 @@ void DSPCORE_NAME::setParameters()
 {
   using ID = ParameterID::ID;
 
-  SmootherCommon<float>::setTime(param.value[ID::smoothness]->getFloat());
+  smootherCommon.setTime(param.value[ID::smoothness]->getFloat());
 
-  interpTremoloMix.push(param.value[ID::chorusMix]->getFloat());
+  interpTremoloMix.push(smootherCommon, param.value[ID::chorusMix]->getFloat());
   interpMasterGain.push(
+    smootherCommon,
     param.value[ID::gain]->getFloat() * param.value[ID::gainBoost]->getFloat());
 
   nVoice = 1 << param.value[ID::nVoice]->getInt();
   if (nVoice > notes.size()) nVoice = notes.size();
 
+  isMultiThread = param.value[ID::multiThread]->getInt();
+
   for (auto &note : notes) {
     if (note.state == NoteState::rest) continue;
     note.gainEnvelope.set(
@@ -264,7 +270,7 @@ void DSPCORE_NAME::setParameters()
 
   for (size_t i = 0; i < chorus.size(); ++i) {
     chorus[i].setParam(
-      param.value[ID::chorusFrequency]->getFloat(),
+      smootherCommon, param.value[ID::chorusFrequency]->getFloat(),
       param.value[ID::chorusPhase]->getFloat()
         + i * param.value[ID::chorusOffset]->getFloat(),
       param.value[ID::chorusFeedback]->getFloat(),
@@ -276,46 +282,97 @@ void DSPCORE_NAME::setParameters()
   }
 }
 
+void DSPCORE_NAME::renderVoice(void *context, uint32_t index)
+{
+  auto dsp = static_cast<DSPCORE_NAME *>(context);
+  auto &note = dsp->notes[dsp->activeVoice[index]];
+  auto &buffer = dsp->voiceBuffer[index];
+  for (size_t i = 0; i < dsp->voiceBlockLength; ++i) buffer[i] = note.process();
+}
+
+void DSPCORE_NAME::snapshotVoice(void *context, uint32_t index)
+{
+  auto dsp = static_cast<DSPCORE_NAME *>(context);
+  auto &snapshot = dsp->voiceSnapshot[index];
+  snapshot.note = dsp->notes[dsp->activeVoice[index]];
+  snapshot.length = dsp->voiceBlockLength;
+}
+
+void DSPCORE_NAME::renderSnapshot(void *context, uint32_t index)
+{
+  auto &snapshot = static_cast<DSPCORE_NAME *>(context)->voiceSnapshot[index];
+  auto &note = snapshot.note;
+  for (size_t i = 0; i < snapshot.length; ++i) snapshot.buffer[i] = note.process();
+}
+
+void DSPCORE_NAME::commitVoice(void *context, uint32_t index)
+{
+  auto dsp = static_cast<DSPCORE_NAME *>(context);
+  auto &snapshot = dsp->voiceSnapshot[index];
+  dsp->notes[dsp->activeVoice[index]] = snapshot.note;
+  std::copy_n(snapshot.buffer.begin(), snapshot.length, dsp->voiceBuffer[index].begin());
+}
+
+const VoicePool::Task DSPCORE_NAME::voiceTask{
+  renderVoice, snapshotVoice, renderSnapshot, commitVoice};
+
 void DSPCORE_NAME::process(const size_t length, float *out0, float *out1)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   std::array<float, 2> frame{};
   std::array<float, 2> chorusOut{};
-  for (size_t i = 0; i < length; ++i) {
+  size_t i = 0;
+  while (i < length) {
     processMidiNote(i);
 
-    frame.fill(0.0f);
+    // Voices are rendered until next note event, then summed in the order of `notes`.
+    size_t end = std::min(length, i + voiceBlockSize);
+    for (const auto &nt : midiNotes)
+      if (nt.frame > i && nt.frame < end) end = nt.frame;
+    voiceBlockLength = end - i;
 
-    for (auto &note : notes) {
-      if (note.state == NoteState::rest) continue;
-      auto noteSig = note.process();
-      frame[0] += noteSig[0];
-      frame[1] += noteSig[1];
+    nActiveVoice = 0;
+    for (size_t idx = 0; idx < notes.size(); ++idx) {
+      if (notes[idx].state == NoteState::rest) continue;
+      activeVoice[nActiveVoice++] = idx;
     }
+    // Workers get half of the block duration before their voices are rendered inline.
+    VoicePool::render(
+      isMultiThread, voiceTask, this, uint32_t(nActiveVoice),
+      0.5f * voiceBlockLength / sampleRate);
 
-    if (isTransitioning) {
-      frame[0] += transitionBuffer[mptIndex][0];
-      frame[1] += transitionBuffer[mptIndex][1];
-      transitionBuffer[mptIndex].fill(0.0f);
-      mptIndex = (mptIndex + 1) % transitionBuffer.size();
-      if (mptIndex == mptStop) isTransitioning = false;
-    }
+    for (size_t j = 0; j < voiceBlockLength; ++j, ++i) {
+      frame.fill(0.0f);
 
-    const auto chorusIn = frame[0] + frame[1];
-    chorusOut.fill(0.0f);
-    for (auto &chrs : chorus) {
-      const auto out = chrs.process(chorusIn);
-      chorusOut[0] += out[0];
-      chorusOut[1] += out[1];
-    }
-    chorusOut[0] /= chorus.size();
-    chorusOut[1] /= chorus.size();
+      for (size_t voice = 0; voice < nActiveVoice; ++voice) {
+        frame[0] += voiceBuffer[voice][j][0];
+        frame[1] += voiceBuffer[voice][j][1];
+      }
+
+      if (isTransitioning) {
+        frame[0] += transitionBuffer[mptIndex][0];
+        frame[1] += transitionBuffer[mptIndex][1];
+        transitionBuffer[mptIndex].fill(0.0f);
+        mptIndex = (mptIndex + 1) % transitionBuffer.size();
+        if (mptIndex == mptStop) isTransitioning = false;
+      }
 
-    const auto chorusMix = interpTremoloMix.process();
-    const auto masterGain = interpMasterGain.process();
-    out0[i] = masterGain * (frame[0] + chorusMix * (chorusOut[0] - frame[0]));
-    out1[i] = masterGain * (frame[1] + chorusMix * (chorusOut[1] - frame[1]));
+      const auto chorusIn = frame[0] + frame[1];
+      chorusOut.fill(0.0f);
+      for (auto &chrs : chorus) {
+        const auto out = chrs.process(chorusIn);
+        chorusOut[0] += out[0];
+        chorusOut[1] += out[1];
+      }
+      chorusOut[0] /= chorus.size();
+      chorusOut[1] /= chorus.size();
+
+      const auto chorusMix = interpTremoloMix.process();
+      const auto masterGain = interpMasterGain.process();
+      out0[i] = masterGain * (frame[0] + chorusMix * (chorusOut[0] - frame[0]));
+      out1[i] = masterGain * (frame[1] + chorusMix * (chorusOut[1] - frame[1]));
+    }
   }
 }
 
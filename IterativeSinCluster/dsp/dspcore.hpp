@@ -19,6 +19,7 @@
 
 #include "../../common/dsp/constants.hpp"
 #include "../../common/dsp/smoother.hpp"
+#include "../../common/dsp/voicepool.hpp"
 #include "../parameter.hpp"
 #include "delay.hpp"
 #include "envelope.hpp"
@@ -38,6 +39,7 @@ constexpr size_t nPitch = 8;
 constexpr size_t nChord = 4;
 constexpr size_t nOvertone = 16;
 constexpr size_t biquadOscSize = nPitch * nOvertone;
+constexpr size_t voiceBlockSize = 128;
 
 enum class NoteState { active, release, rest };
 
@@ -124,6 +126,8 @@ mpt stands for Max Poly Transition. I guess this sounds weird for English native
 #define DSPCORE_CLASS(INSTRSET)                                                          \
   class DSPCore_##INSTRSET final : public DSPInterface {                                 \
   public:                                                                                \
+    ~DSPCore_##INSTRSET() { VoicePool::instance().detach(this); }                        \
+                                                                                         \
     void setup(double sampleRate) override;                                              \
     void reset() override;                                                               \
     void startup() override;                                                             \
@@ -168,6 +172,7 @@ mpt stands for Max Poly Transition. I guess this sounds weird for English native
                                                                                          \
   private:                                                                               \
     float sampleRate = 44100.0f;                                                         \
+    SmootherCommon<float> smootherCommon;                                                \
                                                                                          \
     White<float> rng{0};                                                                 \
                                                                                          \
@@ -184,6 +189,25 @@ mpt stands for Max Poly Transition. I guess this sounds weird for English native
     bool isTransitioning = false;                                                        \
     size_t mptIndex = 0;                                                                 \
     size_t mptStop = 0;                                                                  \
+                                                                                         \
+    bool isMultiThread = false;                                                          \
+    size_t voiceBlockLength = 0;                                                         \
+    size_t nActiveVoice = 0;                                                             \
+    std::array<size_t, maxVoice> activeVoice{};                                          \
+    std::array<std::array<std::array<float, 2>, voiceBlockSize>, maxVoice> voiceBuffer;  \
+                                                                                         \
+    struct VoiceSnapshot {                                                               \
+      Note_##INSTRSET<float> note;                                                       \
+      size_t length = 0;                                                                 \
+      std::array<std::array<float, 2>, voiceBlockSize> buffer;                           \
+    };                                                                                   \
+    std::array<VoiceSnapshot, maxVoice> voiceSnapshot;                                   \
+                                                                                         \
+    static const VoicePool::Task voiceTask;                                              \
+    static void renderVoice(void *context, uint32_t index);                              \
+    static void snapshotVoice(void *context, uint32_t index);                            \
+    static void renderSnapshot(void *context, uint32_t index);                           \
+    static void commitVoice(void *context, uint32_t index);                              \
   };
 
 DSPCORE_CLASS(AVX512)
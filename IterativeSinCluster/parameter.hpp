@@ -142,6 +142,8 @@ enum ID {
 
   pitchBend,
 
+  multiThread,
+
   ID_ENUM_LENGTH,
 };
 } // namespace ParameterID
@@ -185,12 +187,10 @@ struct Scales {
 };
 
 struct GlobalParameter : public ParameterInterface {
-  std::vector<std::unique_ptr<ValueInterface>> value;
+  ValueArray<ParameterID::ID_ENUM_LENGTH> value;
 
   GlobalParameter()
   {
-    value.resize(ParameterID::ID_ENUM_LENGTH);
-
     using ID = ParameterID::ID;
 
     using ID = ParameterID::ID;
@@ -422,6 +422,9 @@ struct GlobalParameter : public ParameterInterface {
 
     value[ID::pitchBend] = std::make_unique<LinearValue>(
       0.5, Scales::defaultScale, "pitchBend", kParameterIsAutomable);
+
+    value[ID::multiThread] = std::make_unique<IntValue>(
+      0, Scales::boolScale, "multiThread", kParameterIsAutomable | kParameterIsBoolean);
   }
 
 #ifndef TEST_BUILD
@@ -434,10 +437,7 @@ struct GlobalParameter : public ParameterInterface {
 
   size_t idLength() override { return value.size(); }
 
-  void resetParameter()
-  {
-    for (auto &val : value) val->setFromNormalized(val->getDefaultNormalized());
-  }
+  void resetParameter() { value.reset(); }
 
   double getNormalized(uint32_t index) const override
   {
@@ -88,7 +88,7 @@ constexpr float checkboxWidth = 60.0f;
 constexpr float splashHeight = 40.0f;
 constexpr uint32_t defaultWidth = uint32_t(12 * knobX + 4 * margin + 40);
 constexpr uint32_t defaultHeight
-  = uint32_t(40 + 10 * labelY + 2 * knobY + 1 * knobHeight + 2 * margin);
+  = uint32_t(40 + 11 * labelY + 2 * knobY + 1 * knobHeight + 2 * margin);
 
 class IterativeSinClusterUI : public PluginUIBase {
 protected:
@@ -109,14 +109,7 @@ public:
 
     setGeometryConstraints(defaultWidth, defaultHeight, true, true);
 
-    if (palette.fontPath().size() > 0)
-      fontId = createFontFromFile("main", palette.fontPath().c_str());
-
-    if (fontId < 0) {
-      fontId = createFontFromMemory(
-        "main", (unsigned char *)(FontData::TinosBoldItalicData),
-        FontData::TinosBoldItalicDataSize, false);
-    }
+    loadFont();
 
     using ID = ParameterID::ID;
 
@@ -301,6 +294,10 @@ public:
       chorusLeft0 + 0.8f * knobX, chorusTop5 + margin, checkboxWidth, labelHeight,
       uiTextSize, "Key Follow", ID::chorusKeyFollow);
 
+    addCheckbox(
+      chorusLeft0 + 0.8f * knobX, chorusTop5 + labelY + margin, checkboxWidth, labelHeight,
+      uiTextSize, "Multi Thread", ID::multiThread);
+
     // Note.
     const float noteTop0 = filterTop0 + knobY + labelY;
     addGroupLabel(
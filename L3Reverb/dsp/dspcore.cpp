@@ -35,8 +35,8 @@ void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.2f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.2f);
 
   for (auto &dly : delay) dly.setup(sampleRate, Scales::time.getMax());
 
@@ -49,7 +49,7 @@ inline std::array<float, 2> calcOffset(float offset, float mul)
   return {(1.0f + offset) * mul, mul};
 }
 
-#define ASSIGN_ALLPASS_PARAMETER(METHOD)                                                 \
+#define ASSIGN_ALLPASS_PARAMETER(METHOD, ...)                                            \
   auto timeMul = param.value[ID::timeMultiply]->getFloat();                              \
   auto innerMul = param.value[ID::innerFeedMultiply]->getFloat();                        \
   auto d1FeedMul = param.value[ID::d1FeedMultiply]->getFloat();                          \
@@ -93,18 +93,20 @@ inline std::array<float, 2> calcOffset(float offset, float mul)
           auto d1FeedOffset = calcOffset(d1FeedOffsetDist(d1FeedRng), d1FeedMul);        \
                                                                                          \
           ap1L.seconds[d1].METHOD(                                                       \
-            param.value[ID::time0 + i1]->getFloat() * d1TimeOffset[0]);                  \
+            __VA_ARGS__ param.value[ID::time0 + i1]->getFloat() * d1TimeOffset[0]);      \
           ap1L.innerFeed[d1].METHOD(                                                     \
+            __VA_ARGS__                                                                  \
             param.value[ID::innerFeed0 + i1]->getFloat() * innerFeedOffset[0]);          \
           ap1L.outerFeed[d1].METHOD(                                                     \
-            param.value[ID::d1Feed0 + i1]->getFloat() * d1FeedOffset[0]);                \
+            __VA_ARGS__ param.value[ID::d1Feed0 + i1]->getFloat() * d1FeedOffset[0]);    \
                                                                                          \
           ap1R.seconds[d1].METHOD(                                                       \
-            param.value[ID::time0 + i1]->getFloat() * d1TimeOffset[1]);                  \
+            __VA_ARGS__ param.value[ID::time0 + i1]->getFloat() * d1TimeOffset[1]);      \
           ap1R.innerFeed[d1].METHOD(                                                     \
+            __VA_ARGS__                                                                  \
             param.value[ID::innerFeed0 + i1]->getFloat() * innerFeedOffset[1]);          \
           ap1R.outerFeed[d1].METHOD(                                                     \
-            param.value[ID::d1Feed0 + i1]->getFloat() * d1FeedOffset[1]);                \
+            __VA_ARGS__ param.value[ID::d1Feed0 + i1]->getFloat() * d1FeedOffset[1]);    \
                                                                                          \
           ++i1;                                                                          \
         }                                                                                \
@@ -112,30 +114,34 @@ inline std::array<float, 2> calcOffset(float offset, float mul)
         auto offsetD2Feed = calcOffset(d2FeedOffsetDist(d2FeedRng), d2FeedMul);          \
                                                                                          \
         ap2L.feed[d2].METHOD(                                                            \
-          param.value[ID::d2Feed0 + i2]->getFloat() * offsetD2Feed[0]);                  \
+          __VA_ARGS__ param.value[ID::d2Feed0 + i2]->getFloat() * offsetD2Feed[0]);      \
         ap2R.feed[d2].METHOD(                                                            \
-          param.value[ID::d2Feed0 + i2]->getFloat() * offsetD2Feed[1]);                  \
+          __VA_ARGS__ param.value[ID::d2Feed0 + i2]->getFloat() * offsetD2Feed[1]);      \
         ++i2;                                                                            \
       }                                                                                  \
                                                                                          \
       auto offsetD3Feed = calcOffset(d3FeedOffsetDist(d3FeedRng), d3FeedMul);            \
                                                                                          \
-      ap3L.feed[d3].METHOD(param.value[ID::d3Feed0 + i3]->getFloat() * offsetD3Feed[0]); \
-      ap3R.feed[d3].METHOD(param.value[ID::d3Feed0 + i3]->getFloat() * offsetD3Feed[1]); \
+      ap3L.feed[d3].METHOD(                                                              \
+        __VA_ARGS__ param.value[ID::d3Feed0 + i3]->getFloat() * offsetD3Feed[0]);        \
+      ap3R.feed[d3].METHOD(                                                              \
+        __VA_ARGS__ param.value[ID::d3Feed0 + i3]->getFloat() * offsetD3Feed[1]);        \
       ++i3;                                                                              \
     }                                                                                    \
                                                                                          \
     auto offsetD4Feed = calcOffset(d4FeedOffsetDist(d4FeedRng), d4FeedMul);              \
                                                                                          \
-    ap4L.feed[d4].METHOD(param.value[ID::d4Feed0 + i4]->getFloat() * offsetD4Feed[0]);   \
-    ap4R.feed[d4].METHOD(param.value[ID::d4Feed0 + i4]->getFloat() * offsetD4Feed[1]);   \
+    ap4L.feed[d4].METHOD(                                                                \
+      __VA_ARGS__ param.value[ID::d4Feed0 + i4]->getFloat() * offsetD4Feed[0]);          \
+    ap4R.feed[d4].METHOD(                                                                \
+      __VA_ARGS__ param.value[ID::d4Feed0 + i4]->getFloat() * offsetD4Feed[1]);          \
     ++i4;                                                                                \
   }                                                                                      \
                                                                                          \
-  interpStereoCross.METHOD(param.value[ID::stereoCross]->getFloat());                    \
-  interpStereoSpread.METHOD(param.value[ID::stereoSpread]->getFloat());                  \
-  interpDry.METHOD(param.value[ID::dry]->getFloat());                                    \
-  interpWet.METHOD(param.value[ID::wet]->getFloat());
+  interpStereoCross.METHOD(__VA_ARGS__ param.value[ID::stereoCross]->getFloat());        \
+  interpStereoSpread.METHOD(__VA_ARGS__ param.value[ID::stereoSpread]->getFloat());      \
+  interpDry.METHOD(__VA_ARGS__ param.value[ID::dry]->getFloat());                        \
+  interpWet.METHOD(__VA_ARGS__ param.value[ID::wet]->getFloat());
 
 void DSPCORE_NAME::reset()
 {
@@ -145,7 +151,7 @@ void DSPCORE_NAME::reset()
 
   for (auto &dly : delay) dly.reset();
 
-  ASSIGN_ALLPASS_PARAMETER(reset);
+  ASSIGN_ALLPASS_PARAMETER(reset, );
 }
 
 void DSPCORE_NAME::startup()
@@ -164,7 +170,7 @@ void DSPCORE_NAME::setParameters(float tempo)
 {
   using ID = ParameterID::ID;
 
-  SmootherCommon<float>::setTime(param.value[ID::smoothness]->getFloat());
+  smootherCommon.setTime(param.value[ID::smoothness]->getFloat());
 
   refreshSeed();
 
@@ -175,13 +181,13 @@ void DSPCORE_NAME::setParameters(float tempo)
   if (!param.value[ID::d3FeedModulation]->getInt()) d3FeedRng.seed(d3FeedSeed);
   if (!param.value[ID::d4FeedModulation]->getInt()) d4FeedRng.seed(d4FeedSeed);
 
-  ASSIGN_ALLPASS_PARAMETER(push);
+  ASSIGN_ALLPASS_PARAMETER(push, smootherCommon, );
 }
 
 void DSPCORE_NAME::process(
   const size_t length, const float *in0, const float *in1, float *out0, float *out1)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     const auto cross = interpStereoCross.process();
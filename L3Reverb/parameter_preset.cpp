@@ -20,10871 +20,2272 @@
 // Generated from preset dump.
 #ifndef TEST_BUILD
 
-void GlobalParameter::loadProgram(uint32_t index)
-{
-  using ID = ParameterID::ID;
-
-  switch (index) {
-    default:
-      resetParameter();
-      break;
-
-    case presetDefault: {
-      value[ID::time0 + 0]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 1]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 2]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 3]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 4]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 5]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 6]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 7]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 8]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 9]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 10]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 11]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 12]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 13]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 14]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 15]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 16]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 17]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 18]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 19]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 20]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 21]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 22]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 23]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 24]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 25]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 26]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 27]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 28]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 29]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 30]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 31]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 32]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 33]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 34]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 35]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 36]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 37]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 38]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 39]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 40]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 41]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 42]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 43]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 44]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 45]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 46]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 47]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 48]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 49]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 50]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 51]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 52]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 53]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 54]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 55]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 56]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 57]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 58]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 59]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 60]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 61]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 62]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 63]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 64]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 65]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 66]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 67]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 68]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 69]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 70]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 71]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 72]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 73]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 74]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 75]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 76]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 77]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 78]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 79]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 80]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 81]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 82]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 83]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 84]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 85]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 86]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 87]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 88]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 89]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 90]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 91]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 92]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 93]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 94]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 95]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 96]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 97]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 98]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 99]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 100]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 101]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 102]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 103]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 104]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 105]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 106]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 107]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 108]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 109]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 110]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 111]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 112]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 113]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 114]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 115]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 116]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 117]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 118]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 119]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 120]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 121]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 122]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 123]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 124]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 125]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 126]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 127]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 128]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 129]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 130]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 131]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 132]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 133]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 134]->setFromNormalized(0.5869779495764822);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::d1FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d2FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d3FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.2752180285130085);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(0);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(0);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetBamberga: {
-      value[ID::time0 + 0]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 1]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 2]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 3]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 4]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 5]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 6]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 7]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 8]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 9]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 10]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 11]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 12]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 13]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 14]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 15]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 16]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 17]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 18]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 19]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 20]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 21]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 22]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 23]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 24]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 25]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 26]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 27]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 28]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 29]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 30]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 31]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 32]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 33]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 34]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 35]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 36]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 37]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 38]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 39]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 40]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 41]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 42]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 43]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 44]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 45]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 46]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 47]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 48]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 49]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 50]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 51]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 52]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 53]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 54]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 55]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 56]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 57]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 58]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 59]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 60]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 61]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 62]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 63]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 64]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 65]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 66]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 67]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 68]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 69]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 70]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 71]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 72]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 73]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 74]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 75]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 76]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 77]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 78]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 79]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 80]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 81]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 82]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 83]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 84]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 85]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 86]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 87]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 88]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 89]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 90]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 91]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 92]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 93]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 94]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 95]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 96]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 97]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 98]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 99]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 100]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 101]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 102]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 103]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 104]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 105]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 106]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 107]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 108]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 109]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 110]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 111]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 112]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 113]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 114]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 115]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 116]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 117]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 118]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 119]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 120]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 121]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 122]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 123]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 124]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 125]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 126]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 127]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 128]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 129]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 130]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 131]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 132]->setFromNormalized(0.05780388049663191);
-      value[ID::time0 + 133]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 134]->setFromNormalized(0.05780388049663191);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.4392116727047153);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.46769459055386664);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.42495268235150035);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.42495268235150035);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.42495268235150035);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.42495268235150035);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.42495268235150035);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.0);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.42495268235150035);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.0);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.35878523175949995);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.0);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.0);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.0);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.0);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.0);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.35878523175949995);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.0);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.0);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.0);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.0);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.0);
-      value[ID::timeMultiply]->setFromNormalized(0.2919999957084656);
-      value[ID::innerFeedMultiply]->setFromNormalized(0.5);
-      value[ID::d1FeedMultiply]->setFromNormalized(0.5);
-      value[ID::d2FeedMultiply]->setFromNormalized(0.5);
-      value[ID::d3FeedMultiply]->setFromNormalized(0.5);
-      value[ID::d4FeedMultiply]->setFromNormalized(0.5);
-      value[ID::timeOffsetRange]->setFromNormalized(0.0);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(0);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(0);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetCamilla: {
-      value[ID::time0 + 0]->setFromNormalized(0.01388888888888884);
-      value[ID::time0 + 1]->setFromNormalized(0.01666666666666672);
-      value[ID::time0 + 2]->setFromNormalized(0.022222222222222254);
-      value[ID::time0 + 3]->setFromNormalized(0.022222222222222254);
-      value[ID::time0 + 4]->setFromNormalized(0.02777777777777779);
-      value[ID::time0 + 5]->setFromNormalized(0.033333333333333326);
-      value[ID::time0 + 6]->setFromNormalized(0.033333333333333326);
-      value[ID::time0 + 7]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 8]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 9]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 10]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 11]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 12]->setFromNormalized(0.05555555555555558);
-      value[ID::time0 + 13]->setFromNormalized(0.05555555555555558);
-      value[ID::time0 + 14]->setFromNormalized(0.05555555555555558);
-      value[ID::time0 + 15]->setFromNormalized(0.061111111111111116);
-      value[ID::time0 + 16]->setFromNormalized(0.06666666666666665);
-      value[ID::time0 + 17]->setFromNormalized(0.07777777777777772);
-      value[ID::time0 + 18]->setFromNormalized(0.08333333333333337);
-      value[ID::time0 + 19]->setFromNormalized(0.0888888888888889);
-      value[ID::time0 + 20]->setFromNormalized(0.0888888888888889);
-      value[ID::time0 + 21]->setFromNormalized(0.0888888888888889);
-      value[ID::time0 + 22]->setFromNormalized(0.0888888888888889);
-      value[ID::time0 + 23]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 24]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 25]->setFromNormalized(0.10555555555555551);
-      value[ID::time0 + 26]->setFromNormalized(0.10555555555555551);
-      value[ID::time0 + 27]->setFromNormalized(0.10555555555555551);
-      value[ID::time0 + 28]->setFromNormalized(0.10833333333333328);
-      value[ID::time0 + 29]->setFromNormalized(0.11111111111111116);
-      value[ID::time0 + 30]->setFromNormalized(0.11111111111111116);
-      value[ID::time0 + 31]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 32]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 33]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 34]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 35]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 36]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 37]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 38]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 39]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 40]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 41]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 42]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 43]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 44]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 45]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 46]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 47]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 48]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 49]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 50]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 51]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 52]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 53]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 54]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 55]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 56]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 57]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 58]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 59]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 60]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 61]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 62]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 63]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 64]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 65]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 66]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 67]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 68]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 69]->setFromNormalized(0.1333333333333333);
-      value[ID::time0 + 70]->setFromNormalized(0.1333333333333333);
-      value[ID::time0 + 71]->setFromNormalized(0.13888888888888884);
-      value[ID::time0 + 72]->setFromNormalized(0.13888888888888884);
-      value[ID::time0 + 73]->setFromNormalized(0.14166666666666672);
-      value[ID::time0 + 74]->setFromNormalized(0.1444444444444445);
-      value[ID::time0 + 75]->setFromNormalized(0.15000000000000002);
-      value[ID::time0 + 76]->setFromNormalized(0.15000000000000002);
-      value[ID::time0 + 77]->setFromNormalized(0.15000000000000002);
-      value[ID::time0 + 78]->setFromNormalized(0.15000000000000002);
-      value[ID::time0 + 79]->setFromNormalized(0.15833333333333333);
-      value[ID::time0 + 80]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 81]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 82]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 83]->setFromNormalized(0.1694444444444444);
-      value[ID::time0 + 84]->setFromNormalized(0.17222222222222228);
-      value[ID::time0 + 85]->setFromNormalized(0.17500000000000004);
-      value[ID::time0 + 86]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 87]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 88]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 89]->setFromNormalized(0.19444444444444442);
-      value[ID::time0 + 90]->setFromNormalized(0.19999999999999996);
-      value[ID::time0 + 91]->setFromNormalized(0.2055555555555556);
-      value[ID::time0 + 92]->setFromNormalized(0.21666666666666667);
-      value[ID::time0 + 93]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 94]->setFromNormalized(0.23333333333333328);
-      value[ID::time0 + 95]->setFromNormalized(0.23888888888888893);
-      value[ID::time0 + 96]->setFromNormalized(0.24444444444444446);
-      value[ID::time0 + 97]->setFromNormalized(0.25555555555555554);
-      value[ID::time0 + 98]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 99]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 100]->setFromNormalized(0.28055555555555556);
-      value[ID::time0 + 101]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 102]->setFromNormalized(0.2944444444444444);
-      value[ID::time0 + 103]->setFromNormalized(0.3055555555555556);
-      value[ID::time0 + 104]->setFromNormalized(0.31666666666666665);
-      value[ID::time0 + 105]->setFromNormalized(0.3222222222222222);
-      value[ID::time0 + 106]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 107]->setFromNormalized(0.3388888888888889);
-      value[ID::time0 + 108]->setFromNormalized(0.34444444444444444);
-      value[ID::time0 + 109]->setFromNormalized(0.3555555555555555);
-      value[ID::time0 + 110]->setFromNormalized(0.3666666666666667);
-      value[ID::time0 + 111]->setFromNormalized(0.37222222222222223);
-      value[ID::time0 + 112]->setFromNormalized(0.37777777777777777);
-      value[ID::time0 + 113]->setFromNormalized(0.38888888888888884);
-      value[ID::time0 + 114]->setFromNormalized(0.4);
-      value[ID::time0 + 115]->setFromNormalized(0.40555555555555556);
-      value[ID::time0 + 116]->setFromNormalized(0.41666666666666663);
-      value[ID::time0 + 117]->setFromNormalized(0.41666666666666663);
-      value[ID::time0 + 118]->setFromNormalized(0.4222222222222223);
-      value[ID::time0 + 119]->setFromNormalized(0.4388888888888889);
-      value[ID::time0 + 120]->setFromNormalized(0.4388888888888889);
-      value[ID::time0 + 121]->setFromNormalized(0.4388888888888889);
-      value[ID::time0 + 122]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 123]->setFromNormalized(0.4555555555555556);
-      value[ID::time0 + 124]->setFromNormalized(0.46111111111111114);
-      value[ID::time0 + 125]->setFromNormalized(0.4666666666666667);
-      value[ID::time0 + 126]->setFromNormalized(0.47777777777777775);
-      value[ID::time0 + 127]->setFromNormalized(0.4833333333333333);
-      value[ID::time0 + 128]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 129]->setFromNormalized(0.5);
-      value[ID::time0 + 130]->setFromNormalized(0.5055555555555555);
-      value[ID::time0 + 131]->setFromNormalized(0.5111111111111111);
-      value[ID::time0 + 132]->setFromNormalized(0.5222222222222221);
-      value[ID::time0 + 133]->setFromNormalized(0.5222222222222221);
-      value[ID::time0 + 134]->setFromNormalized(0.7666666666666666);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.6055555555555556);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.6333333333333333);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.65);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.6888888888888889);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.7333333333333334);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.7555555555555555);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.8166666666666667);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.8277777777777777);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.8388888888888889);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.8388888888888889);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.8388888888888889);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.8388888888888889);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.8333333333333334);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.8277777777777777);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.8277777777777777);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.8222222222222222);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.8222222222222222);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.8222222222222222);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.8166666666666667);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.8166666666666667);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.8138888888888889);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.8111111111111111);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.8111111111111111);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.8083333333333333);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.8055555555555556);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.8027777777777778);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.8);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.8);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.8);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.8);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.8);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.8);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.8);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.7989583333333333);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.796875);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.7947916666666667);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.7927083333333333);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.790625);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.7885416666666667);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.7864583333333334);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.784375);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.7833333333333333);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.7805555555555556);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.775);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.7722222222222223);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.7722222222222223);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.7722222222222223);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.7722222222222223);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.7722222222222223);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.7722222222222223);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.7694444444444444);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.7666666666666666);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.7638888888888888);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.7625);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.7652777777777777);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.7666666666666666);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.7666666666666666);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.7666666666666666);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.7666666666666666);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.7694444444444444);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.775);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.7791666666666667);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.7819444444444444);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.7833333333333333);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.7833333333333333);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.7833333333333333);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.7833333333333333);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.7833333333333333);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.7833333333333333);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.7833333333333333);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.7847222222222222);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.7875);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.7916666666666666);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.7944444444444445);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.7722222222222223);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.7722222222222223);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.7722222222222223);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.7722222222222223);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.3277777777777777);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.3277777777777777);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.34444444444444444);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.3472222222222222);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.35);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.35277777777777775);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.3555555555555555);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.3569444444444444);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.3597222222222223);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.36111111111111116);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.36388888888888893);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.3666666666666667);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.370370356241862);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.38518519931369355);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.3907407548692491);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.3944444444444445);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.3981481340196398);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.4);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.40092591179741754);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.4027777777777778);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.40462964375813804);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.40555555555555556);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.4064814673529731);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.4083333333333333);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.41018519931369357);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.41527777777777775);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.42361111111111116);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.4222222222222223);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.41666666666666663);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.41527777777777775);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.4125);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.4083333333333333);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.40555555555555556);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.4);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.4);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.4);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.4);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.3944444444444445);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.3916666666666667);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.38611111111111107);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.04166666666666663);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.3222222222222222);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.31666666666666665);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.31666666666666665);
-      value[ID::timeMultiply]->setFromNormalized(0.44399991631507874);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::d1FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d2FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d3FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.27521803975105286);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(1.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(1.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(1.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(1.0);
-      value[ID::timeModulation]->setFromInt(1);
-      value[ID::innerFeedModulation]->setFromInt(1);
-      value[ID::d1FeedModulation]->setFromInt(1);
-      value[ID::d2FeedModulation]->setFromInt(1);
-      value[ID::d3FeedModulation]->setFromInt(1);
-      value[ID::d4FeedModulation]->setFromInt(1);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.8479992747306824);
-      value[ID::stereoSpread]->setFromNormalized(0.5199999213218689);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(1.0);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetCeres: {
-      value[ID::time0 + 0]->setFromNormalized(0.0);
-      value[ID::time0 + 1]->setFromNormalized(0.0);
-      value[ID::time0 + 2]->setFromNormalized(0.0);
-      value[ID::time0 + 3]->setFromNormalized(0.0);
-      value[ID::time0 + 4]->setFromNormalized(0.0);
-      value[ID::time0 + 5]->setFromNormalized(0.0);
-      value[ID::time0 + 6]->setFromNormalized(0.0);
-      value[ID::time0 + 7]->setFromNormalized(0.0);
-      value[ID::time0 + 8]->setFromNormalized(0.0);
-      value[ID::time0 + 9]->setFromNormalized(0.0);
-      value[ID::time0 + 10]->setFromNormalized(0.0);
-      value[ID::time0 + 11]->setFromNormalized(0.0);
-      value[ID::time0 + 12]->setFromNormalized(0.0);
-      value[ID::time0 + 13]->setFromNormalized(0.0);
-      value[ID::time0 + 14]->setFromNormalized(0.0);
-      value[ID::time0 + 15]->setFromNormalized(0.0);
-      value[ID::time0 + 16]->setFromNormalized(0.0);
-      value[ID::time0 + 17]->setFromNormalized(0.0);
-      value[ID::time0 + 18]->setFromNormalized(0.0);
-      value[ID::time0 + 19]->setFromNormalized(0.0);
-      value[ID::time0 + 20]->setFromNormalized(0.0);
-      value[ID::time0 + 21]->setFromNormalized(0.7055555555555555);
-      value[ID::time0 + 22]->setFromNormalized(0.6777777777777778);
-      value[ID::time0 + 23]->setFromNormalized(0.6555555555555556);
-      value[ID::time0 + 24]->setFromNormalized(0.6222222222222222);
-      value[ID::time0 + 25]->setFromNormalized(0.6055555555555556);
-      value[ID::time0 + 26]->setFromNormalized(0.5666666666666667);
-      value[ID::time0 + 27]->setFromNormalized(0.55);
-      value[ID::time0 + 28]->setFromNormalized(0.5472222222222223);
-      value[ID::time0 + 29]->setFromNormalized(0.0);
-      value[ID::time0 + 30]->setFromNormalized(0.0);
-      value[ID::time0 + 31]->setFromNormalized(0.0);
-      value[ID::time0 + 32]->setFromNormalized(0.0);
-      value[ID::time0 + 33]->setFromNormalized(0.0);
-      value[ID::time0 + 34]->setFromNormalized(0.0);
-      value[ID::time0 + 35]->setFromNormalized(0.0);
-      value[ID::time0 + 36]->setFromNormalized(0.0);
-      value[ID::time0 + 37]->setFromNormalized(0.0);
-      value[ID::time0 + 38]->setFromNormalized(0.0);
-      value[ID::time0 + 39]->setFromNormalized(0.0);
-      value[ID::time0 + 40]->setFromNormalized(0.0);
-      value[ID::time0 + 41]->setFromNormalized(0.0);
-      value[ID::time0 + 42]->setFromNormalized(0.0);
-      value[ID::time0 + 43]->setFromNormalized(0.0);
-      value[ID::time0 + 44]->setFromNormalized(0.0);
-      value[ID::time0 + 45]->setFromNormalized(0.0);
-      value[ID::time0 + 46]->setFromNormalized(0.0);
-      value[ID::time0 + 47]->setFromNormalized(0.0);
-      value[ID::time0 + 48]->setFromNormalized(0.0);
-      value[ID::time0 + 49]->setFromNormalized(0.0);
-      value[ID::time0 + 50]->setFromNormalized(0.0);
-      value[ID::time0 + 51]->setFromNormalized(0.5555555555555556);
-      value[ID::time0 + 52]->setFromNormalized(0.5388888888888889);
-      value[ID::time0 + 53]->setFromNormalized(0.5222222222222221);
-      value[ID::time0 + 54]->setFromNormalized(0.5111111111111111);
-      value[ID::time0 + 55]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 56]->setFromNormalized(0.4833333333333333);
-      value[ID::time0 + 57]->setFromNormalized(0.4722222222222222);
-      value[ID::time0 + 58]->setFromNormalized(0.46111111111111114);
-      value[ID::time0 + 59]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 60]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 61]->setFromNormalized(0.0);
-      value[ID::time0 + 62]->setFromNormalized(0.0);
-      value[ID::time0 + 63]->setFromNormalized(0.0);
-      value[ID::time0 + 64]->setFromNormalized(0.0);
-      value[ID::time0 + 65]->setFromNormalized(0.0);
-      value[ID::time0 + 66]->setFromNormalized(0.0);
-      value[ID::time0 + 67]->setFromNormalized(0.0);
-      value[ID::time0 + 68]->setFromNormalized(0.0);
-      value[ID::time0 + 69]->setFromNormalized(0.0);
-      value[ID::time0 + 70]->setFromNormalized(0.0);
-      value[ID::time0 + 71]->setFromNormalized(0.0);
-      value[ID::time0 + 72]->setFromNormalized(0.0);
-      value[ID::time0 + 73]->setFromNormalized(0.0);
-      value[ID::time0 + 74]->setFromNormalized(0.0);
-      value[ID::time0 + 75]->setFromNormalized(0.0);
-      value[ID::time0 + 76]->setFromNormalized(0.0);
-      value[ID::time0 + 77]->setFromNormalized(0.0);
-      value[ID::time0 + 78]->setFromNormalized(0.0);
-      value[ID::time0 + 79]->setFromNormalized(0.0);
-      value[ID::time0 + 80]->setFromNormalized(0.0);
-      value[ID::time0 + 81]->setFromNormalized(0.0);
-      value[ID::time0 + 82]->setFromNormalized(0.0);
-      value[ID::time0 + 83]->setFromNormalized(0.0);
-      value[ID::time0 + 84]->setFromNormalized(0.0);
-      value[ID::time0 + 85]->setFromNormalized(0.5);
-      value[ID::time0 + 86]->setFromNormalized(0.4833333333333333);
-      value[ID::time0 + 87]->setFromNormalized(0.4666666666666667);
-      value[ID::time0 + 88]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 89]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 90]->setFromNormalized(0.0);
-      value[ID::time0 + 91]->setFromNormalized(0.0);
-      value[ID::time0 + 92]->setFromNormalized(0.0);
-      value[ID::time0 + 93]->setFromNormalized(0.0);
-      value[ID::time0 + 94]->setFromNormalized(0.0);
-      value[ID::time0 + 95]->setFromNormalized(0.0);
-      value[ID::time0 + 96]->setFromNormalized(0.0);
-      value[ID::time0 + 97]->setFromNormalized(0.0);
-      value[ID::time0 + 98]->setFromNormalized(0.0);
-      value[ID::time0 + 99]->setFromNormalized(0.0);
-      value[ID::time0 + 100]->setFromNormalized(0.0);
-      value[ID::time0 + 101]->setFromNormalized(0.0);
-      value[ID::time0 + 102]->setFromNormalized(0.0);
-      value[ID::time0 + 103]->setFromNormalized(0.0);
-      value[ID::time0 + 104]->setFromNormalized(0.0);
-      value[ID::time0 + 105]->setFromNormalized(0.0);
-      value[ID::time0 + 106]->setFromNormalized(0.0);
-      value[ID::time0 + 107]->setFromNormalized(0.0);
-      value[ID::time0 + 108]->setFromNormalized(0.0);
-      value[ID::time0 + 109]->setFromNormalized(0.0);
-      value[ID::time0 + 110]->setFromNormalized(0.0);
-      value[ID::time0 + 111]->setFromNormalized(0.0);
-      value[ID::time0 + 112]->setFromNormalized(0.0);
-      value[ID::time0 + 113]->setFromNormalized(0.0);
-      value[ID::time0 + 114]->setFromNormalized(0.0);
-      value[ID::time0 + 115]->setFromNormalized(0.07777777777777772);
-      value[ID::time0 + 116]->setFromNormalized(0.06944444444444442);
-      value[ID::time0 + 117]->setFromNormalized(0.061111111111111116);
-      value[ID::time0 + 118]->setFromNormalized(0.05555555555555558);
-      value[ID::time0 + 119]->setFromNormalized(0.050000000000000044);
-      value[ID::time0 + 120]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 121]->setFromNormalized(0.01666666666666672);
-      value[ID::time0 + 122]->setFromNormalized(0.005555555555555536);
-      value[ID::time0 + 123]->setFromNormalized(0.0);
-      value[ID::time0 + 124]->setFromNormalized(0.0);
-      value[ID::time0 + 125]->setFromNormalized(0.0);
-      value[ID::time0 + 126]->setFromNormalized(0.0);
-      value[ID::time0 + 127]->setFromNormalized(0.0);
-      value[ID::time0 + 128]->setFromNormalized(0.0);
-      value[ID::time0 + 129]->setFromNormalized(0.0);
-      value[ID::time0 + 130]->setFromNormalized(0.0);
-      value[ID::time0 + 131]->setFromNormalized(0.0);
-      value[ID::time0 + 132]->setFromNormalized(0.0);
-      value[ID::time0 + 133]->setFromNormalized(0.0);
-      value[ID::time0 + 134]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.1527777777777778);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.15555555555555556);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.16388888888888886);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.17500000000000004);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.18055555555555558);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.18333333333333335);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.18888888888888888);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.19999999999999996);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.2055555555555556);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.20833333333333337);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.2138888888888889);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.21944444444444444);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.22499999999999998);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.2305555555555555);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.23611111111111116);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.2416666666666667);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.24722222222222223);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.25277777777777777);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.25555555555555554);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.2587301466200087);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.26507932874891493);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.27142851087782116);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.2777776930067274);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.2841268751356337);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.29047605726453996);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.2968252817789714);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.3027777777777778);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.30833333333333335);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.3138888888888889);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.3194444444444444);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.32499999999999996);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.3305555555555556);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.33611111111111114);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.3416666666666667);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.34444444444444444);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.3477777693006727);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.3544444190131293);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.36111106872558596);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.3677777184380425);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.3744443681504991);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.37777777777777777);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.38055555555555554);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.38611111111111107);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.3916666666666667);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.39722222222222225);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.4027777777777778);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.4083333333333333);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.41388888888888886);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.4194444444444444);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.4222222222222223);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.42592591179741757);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.43333333333333335);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.44074075486924913);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.4481481764051649);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.4555555979410807);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.4629630194769965);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.4666666666666667);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.4697530958387587);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.4759259541829427);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.4820988125271267);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.48827167087131074);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.49444452921549475);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.5006173875596789);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.5067902459038629);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.5129631042480469);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.5191359625922309);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.5222222222222221);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.5254629770914714);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.5319444444444444);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.5384259117974175);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.5449073791503907);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.5513888465033637);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.5578703138563368);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.5611111111111111);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.5622222052680121);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.5644444359673394);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.5666666666666667);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.5688888973659939);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.5711111280653212);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.5638888888888889);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.5555555555555556);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.5222222222222221);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.49444444444444446);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.46944444444444444);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.4444444444444444);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.3666666666666667);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.3277777777777777);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.27222222222222225);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.2222222222222222);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.2055555555555556);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.1958333333333333);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.17638888888888893);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.16666666666666663);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.16269844902886288);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.15476192898220487);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.14682540893554685);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.13888888888888884);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.13095236884223094);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.12301584879557292);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.11507932874891491);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.108888922797309);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.10444446139865449);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.09555553860134547);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.09111107720269096);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.0888888888888889);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.2222222222222222);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.2222222222222222);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.22499999999999998);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.22777777777777775);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.23611111111111116);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.24444444444444446);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.24722222222222223);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.25277777777777777);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.25555555555555554);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.25555555555555554);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.25555555555555554);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.27222222222222225);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.275);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.2777777777777778);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.2833333333333333);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.2833333333333333);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.2833333333333333);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.28888888888888886);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.2944444444444444);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.2972222222222223);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.30833333333333335);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.31666666666666665);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.3222222222222222);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.3277777777777777);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.33333333333333337);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.34444444444444444);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.35);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.36388888888888893);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.3847222222222222);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.39861111111111114);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.40555555555555556);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.43333333333333335);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.4555555555555556);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.48888888888888893);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.5222222222222221);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.5333333333333333);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.5388888888888889);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.5444444444444445);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.5555555555555556);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.5583333333333333);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.5611111111111111);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.5777777777777777);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.5805555555555555);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.5833333333333333);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.5888888888888889);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.5944444444444444);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.5972222222222222);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.6);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.6027777777777779);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.6055555555555556);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.6083333333333334);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.6069444444444445);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.5986111111111111);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.5944444444444444);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.5888888888888889);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.5833333333333333);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.5791666666666666);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.5708333333333333);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.5666666666666667);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.5583333333333333);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.5416666666666667);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.5333333333333333);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.525);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.5083333333333333);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.4916666666666667);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.4833333333333333);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.475);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.45833333333333337);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.44166666666666665);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.43333333333333335);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.42847222222222225);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.41874999999999996);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.40902777777777777);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.3993055555555556);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.3944444444444445);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.3905555725097656);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.3827777862548828);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.375);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.3672222137451172);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.3594444274902344);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.3555555555555555);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.3518518659803602);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.34444444444444444);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.33703702290852866);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.33333333333333337);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.3311111026340061);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.3266666412353516);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.3222221798366971);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.3177777184380426);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.31333325703938797);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.3111111111111111);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.3104166666666667);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.3090277777777778);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.3076388888888889);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.30625);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.3055555555555556);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.30486111111111114);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.30347222222222225);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.30208333333333337);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.3006944444444445);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.32499999999999996);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::timeMultiply]->setFromNormalized(0.5580002665519714);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::d1FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d2FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d3FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.2752180285130085);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::timeModulation]->setFromInt(1);
-      value[ID::innerFeedModulation]->setFromInt(0);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(0);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetCybele: {
-      value[ID::time0 + 0]->setFromNormalized(0.0888888888888889);
-      value[ID::time0 + 1]->setFromNormalized(0.050000000000000044);
-      value[ID::time0 + 2]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 3]->setFromNormalized(0.14166666666666672);
-      value[ID::time0 + 4]->setFromNormalized(0.1333333333333333);
-      value[ID::time0 + 5]->setFromNormalized(0.15000000000000002);
-      value[ID::time0 + 6]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 7]->setFromNormalized(0.46111111111111114);
-      value[ID::time0 + 8]->setFromNormalized(0.2222222222222222);
-      value[ID::time0 + 9]->setFromNormalized(0.23333333333333328);
-      value[ID::time0 + 10]->setFromNormalized(0.24444444444444446);
-      value[ID::time0 + 11]->setFromNormalized(0.25);
-      value[ID::time0 + 12]->setFromNormalized(0.25555555555555554);
-      value[ID::time0 + 13]->setFromNormalized(0.27222222222222225);
-      value[ID::time0 + 14]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 15]->setFromNormalized(0.29166666666666663);
-      value[ID::time0 + 16]->setFromNormalized(0.30000000000000004);
-      value[ID::time0 + 17]->setFromNormalized(0.3111111111111111);
-      value[ID::time0 + 18]->setFromNormalized(0.3222222222222222);
-      value[ID::time0 + 19]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 20]->setFromNormalized(0.35);
-      value[ID::time0 + 21]->setFromNormalized(0.3944444444444445);
-      value[ID::time0 + 22]->setFromNormalized(0.4277777777777778);
-      value[ID::time0 + 23]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 24]->setFromNormalized(0.475);
-      value[ID::time0 + 25]->setFromNormalized(0.4388888888888889);
-      value[ID::time0 + 26]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 27]->setFromNormalized(0.4555555555555556);
-      value[ID::time0 + 28]->setFromNormalized(0.4722222222222222);
-      value[ID::time0 + 29]->setFromNormalized(0.48888888888888893);
-      value[ID::time0 + 30]->setFromNormalized(0.5111111111111111);
-      value[ID::time0 + 31]->setFromNormalized(0.5333333333333333);
-      value[ID::time0 + 32]->setFromNormalized(0.5611111111111111);
-      value[ID::time0 + 33]->setFromNormalized(0.5944444444444444);
-      value[ID::time0 + 34]->setFromNormalized(0.65);
-      value[ID::time0 + 35]->setFromNormalized(0.6444444444444444);
-      value[ID::time0 + 36]->setFromNormalized(0.6);
-      value[ID::time0 + 37]->setFromNormalized(0.5722222222222222);
-      value[ID::time0 + 38]->setFromNormalized(0.55);
-      value[ID::time0 + 39]->setFromNormalized(0.5166666666666666);
-      value[ID::time0 + 40]->setFromNormalized(0.4833333333333333);
-      value[ID::time0 + 41]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 42]->setFromNormalized(0.4222222222222223);
-      value[ID::time0 + 43]->setFromNormalized(0.38888888888888884);
-      value[ID::time0 + 44]->setFromNormalized(0.36111111111111116);
-      value[ID::time0 + 45]->setFromNormalized(0.34444444444444444);
-      value[ID::time0 + 46]->setFromNormalized(0.34444444444444444);
-      value[ID::time0 + 47]->setFromNormalized(0.34444444444444444);
-      value[ID::time0 + 48]->setFromNormalized(0.35277777777777775);
-      value[ID::time0 + 49]->setFromNormalized(0.37777777777777777);
-      value[ID::time0 + 50]->setFromNormalized(0.40555555555555556);
-      value[ID::time0 + 51]->setFromNormalized(0.4277777777777778);
-      value[ID::time0 + 52]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 53]->setFromNormalized(0.4722222222222222);
-      value[ID::time0 + 54]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 55]->setFromNormalized(0.5166666666666666);
-      value[ID::time0 + 56]->setFromNormalized(0.5333333333333333);
-      value[ID::time0 + 57]->setFromNormalized(0.55);
-      value[ID::time0 + 58]->setFromNormalized(0.5555555555555556);
-      value[ID::time0 + 59]->setFromNormalized(0.5777777777777777);
-      value[ID::time0 + 60]->setFromNormalized(0.5888888888888889);
-      value[ID::time0 + 61]->setFromNormalized(0.6055555555555556);
-      value[ID::time0 + 62]->setFromNormalized(0.6222222222222222);
-      value[ID::time0 + 63]->setFromNormalized(0.6222222222222222);
-      value[ID::time0 + 64]->setFromNormalized(0.5666666666666667);
-      value[ID::time0 + 65]->setFromNormalized(0.5555555555555556);
-      value[ID::time0 + 66]->setFromNormalized(0.55);
-      value[ID::time0 + 67]->setFromNormalized(0.5333333333333333);
-      value[ID::time0 + 68]->setFromNormalized(0.5222222222222221);
-      value[ID::time0 + 69]->setFromNormalized(0.5222222222222221);
-      value[ID::time0 + 70]->setFromNormalized(0.5055555555555555);
-      value[ID::time0 + 71]->setFromNormalized(0.5);
-      value[ID::time0 + 72]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 73]->setFromNormalized(0.48888888888888893);
-      value[ID::time0 + 74]->setFromNormalized(0.47777777777777775);
-      value[ID::time0 + 75]->setFromNormalized(0.47777777777777775);
-      value[ID::time0 + 76]->setFromNormalized(0.47777777777777775);
-      value[ID::time0 + 77]->setFromNormalized(0.47777777777777775);
-      value[ID::time0 + 78]->setFromNormalized(0.47777777777777775);
-      value[ID::time0 + 79]->setFromNormalized(0.47777777777777775);
-      value[ID::time0 + 80]->setFromNormalized(0.47777777777777775);
-      value[ID::time0 + 81]->setFromNormalized(0.47777777777777775);
-      value[ID::time0 + 82]->setFromNormalized(0.4722222222222222);
-      value[ID::time0 + 83]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 84]->setFromNormalized(0.4388888888888889);
-      value[ID::time0 + 85]->setFromNormalized(0.3916666666666667);
-      value[ID::time0 + 86]->setFromNormalized(0.37222184075249565);
-      value[ID::time0 + 87]->setFromNormalized(0.3652042812771268);
-      value[ID::time0 + 88]->setFromNormalized(0.3581867218017578);
-      value[ID::time0 + 89]->setFromNormalized(0.35116916232638884);
-      value[ID::time0 + 90]->setFromNormalized(0.34415160285102);
-      value[ID::time0 + 91]->setFromNormalized(0.337134043375651);
-      value[ID::time0 + 92]->setFromNormalized(0.33011648390028214);
-      value[ID::time0 + 93]->setFromNormalized(0.32309892442491317);
-      value[ID::time0 + 94]->setFromNormalized(0.3160813649495443);
-      value[ID::time0 + 95]->setFromNormalized(0.30906380547417533);
-      value[ID::time0 + 96]->setFromNormalized(0.3020462459988065);
-      value[ID::time0 + 97]->setFromNormalized(0.2950286865234375);
-      value[ID::time0 + 98]->setFromNormalized(0.28801108466254344);
-      value[ID::time0 + 99]->setFromNormalized(0.28099356757269967);
-      value[ID::time0 + 100]->setFromNormalized(0.2739760504828559);
-      value[ID::time0 + 101]->setFromNormalized(0.2669585333930121);
-      value[ID::time0 + 102]->setFromNormalized(0.25994101630316835);
-      value[ID::time0 + 103]->setFromNormalized(0.2529234992133247);
-      value[ID::time0 + 104]->setFromNormalized(0.24590598212348092);
-      value[ID::time0 + 105]->setFromNormalized(0.23888846503363714);
-      value[ID::time0 + 106]->setFromNormalized(0.23187094794379337);
-      value[ID::time0 + 107]->setFromNormalized(0.2248534308539496);
-      value[ID::time0 + 108]->setFromNormalized(0.21783591376410594);
-      value[ID::time0 + 109]->setFromNormalized(0.21081839667426217);
-      value[ID::time0 + 110]->setFromNormalized(0.2038008795844184);
-      value[ID::time0 + 111]->setFromNormalized(0.19678336249457462);
-      value[ID::time0 + 112]->setFromNormalized(0.18976584540473085);
-      value[ID::time0 + 113]->setFromNormalized(0.1827483283148872);
-      value[ID::time0 + 114]->setFromNormalized(0.17573081122504342);
-      value[ID::time0 + 115]->setFromNormalized(0.16871329413519964);
-      value[ID::time0 + 116]->setFromNormalized(0.16169577704535587);
-      value[ID::time0 + 117]->setFromNormalized(0.1546782599555121);
-      value[ID::time0 + 118]->setFromNormalized(0.14766074286566844);
-      value[ID::time0 + 119]->setFromNormalized(0.14064322577582467);
-      value[ID::time0 + 120]->setFromNormalized(0.1336257086859809);
-      value[ID::time0 + 121]->setFromNormalized(0.12660819159613712);
-      value[ID::time0 + 122]->setFromNormalized(0.11959067450629335);
-      value[ID::time0 + 123]->setFromNormalized(0.11257315741644969);
-      value[ID::time0 + 124]->setFromNormalized(0.10555564032660592);
-      value[ID::time0 + 125]->setFromNormalized(0.09853812323676214);
-      value[ID::time0 + 126]->setFromNormalized(0.09152060614691837);
-      value[ID::time0 + 127]->setFromNormalized(0.0845030890570746);
-      value[ID::time0 + 128]->setFromNormalized(0.07748557196723094);
-      value[ID::time0 + 129]->setFromNormalized(0.07046805487738717);
-      value[ID::time0 + 130]->setFromNormalized(0.06345053778754339);
-      value[ID::time0 + 131]->setFromNormalized(0.05643302069769962);
-      value[ID::time0 + 132]->setFromNormalized(0.04941550360785585);
-      value[ID::time0 + 133]->setFromNormalized(0.04239798651801219);
-      value[ID::time0 + 134]->setFromNormalized(0.03888888888888886);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.2525308397081163);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.4833333333333333);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.4833333333333333);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.4833333333333333);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.4833333333333333);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.4833333333333333);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.4833333333333333);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.4833333333333333);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.4833333333333333);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.4833333333333333);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.4833333333333333);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.4833333333333333);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.4833333333333333);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.4627777947319879);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.47895062764485674);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.4951234605577257);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.5112962934705947);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.5274691263834635);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.5436419592963324);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.5598147922092014);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.5759876251220704);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.5921604580349392);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.6083332909478081);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.624506123860677);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.640678956773546);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.6568517684936523);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.6730246014065213);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.6891974343193902);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.705370267232259);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.721543100145128);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.737715933057997);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.7538887659708658);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.7700615988837348);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.7862344317966037);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.8024072647094727);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.8185800976223416);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.8347529411315918);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.850925784640842);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.8670986281500922);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.8832714716593424);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.8994443151685927);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.9156171639760335);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.9317900021870931);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.9479628403981527);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.964135675960117);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.9722222222222222);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.1166666666666667);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.1166666666666667);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.1166666666666667);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.12222222222222223);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.12222222222222223);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.12222222222222223);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.12777777777777777);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.1333333333333333);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.13888888888888884);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.15555555555555556);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.18888888888888888);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.23888888888888893);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.3222222222222222);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.9333333333333333);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.9638888888888889);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.9222222222222223);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.9166666666666666);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.9166666666666666);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.9166666666666666);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.9055555555555556);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.9);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.8944444444444445);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.8833333333333333);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.07499999999999996);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.17222222222222228);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.19444444444444442);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.3555555555555555);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.3555555555555555);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.21666666666666667);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.21666666666666667);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.7666666666666666);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.8611111111111112);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.8611111111111112);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.8611111111111112);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.8611111111111112);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.09999999999999998);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.8777777777777778);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.8555555555555556);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.1527777777777778);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.18333333333333335);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.9805555555555555);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.05277777777777781);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.5333333333333333);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.9361111111111111);
-      value[ID::timeMultiply]->setFromNormalized(0.4980003237724304);
-      value[ID::innerFeedMultiply]->setFromNormalized(0.5);
-      value[ID::d1FeedMultiply]->setFromNormalized(0.5);
-      value[ID::d2FeedMultiply]->setFromNormalized(0.5);
-      value[ID::d3FeedMultiply]->setFromNormalized(0.5);
-      value[ID::d4FeedMultiply]->setFromNormalized(0.5);
-      value[ID::timeOffsetRange]->setFromNormalized(0.5432180762290955);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.5);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.5);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.5);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.5);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.5);
-      value[ID::timeModulation]->setFromInt(1);
-      value[ID::innerFeedModulation]->setFromInt(1);
-      value[ID::d1FeedModulation]->setFromInt(1);
-      value[ID::d2FeedModulation]->setFromInt(1);
-      value[ID::d3FeedModulation]->setFromInt(1);
-      value[ID::d4FeedModulation]->setFromInt(1);
-      value[ID::seed]->setFromInt(5939133);
-      value[ID::stereoCross]->setFromNormalized(0.03999980539083481);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.37999987602233887);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.6840001344680786);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetDavida: {
-      value[ID::time0 + 0]->setFromNormalized(0.0);
-      value[ID::time0 + 1]->setFromNormalized(0.0);
-      value[ID::time0 + 2]->setFromNormalized(0.0);
-      value[ID::time0 + 3]->setFromNormalized(0.0);
-      value[ID::time0 + 4]->setFromNormalized(0.0);
-      value[ID::time0 + 5]->setFromNormalized(0.0);
-      value[ID::time0 + 6]->setFromNormalized(0.8777777777777778);
-      value[ID::time0 + 7]->setFromNormalized(0.05555555555555558);
-      value[ID::time0 + 8]->setFromNormalized(0.0);
-      value[ID::time0 + 9]->setFromNormalized(0.0);
-      value[ID::time0 + 10]->setFromNormalized(0.0);
-      value[ID::time0 + 11]->setFromNormalized(0.0);
-      value[ID::time0 + 12]->setFromNormalized(0.0);
-      value[ID::time0 + 13]->setFromNormalized(0.0);
-      value[ID::time0 + 14]->setFromNormalized(0.0);
-      value[ID::time0 + 15]->setFromNormalized(0.0);
-      value[ID::time0 + 16]->setFromNormalized(0.0);
-      value[ID::time0 + 17]->setFromNormalized(0.0);
-      value[ID::time0 + 18]->setFromNormalized(0.0);
-      value[ID::time0 + 19]->setFromNormalized(0.0);
-      value[ID::time0 + 20]->setFromNormalized(0.0);
-      value[ID::time0 + 21]->setFromNormalized(0.0);
-      value[ID::time0 + 22]->setFromNormalized(0.0);
-      value[ID::time0 + 23]->setFromNormalized(0.0);
-      value[ID::time0 + 24]->setFromNormalized(0.0);
-      value[ID::time0 + 25]->setFromNormalized(0.0);
-      value[ID::time0 + 26]->setFromNormalized(0.0);
-      value[ID::time0 + 27]->setFromNormalized(0.0);
-      value[ID::time0 + 28]->setFromNormalized(0.0);
-      value[ID::time0 + 29]->setFromNormalized(0.0);
-      value[ID::time0 + 30]->setFromNormalized(0.0);
-      value[ID::time0 + 31]->setFromNormalized(0.0);
-      value[ID::time0 + 32]->setFromNormalized(0.0);
-      value[ID::time0 + 33]->setFromNormalized(0.0);
-      value[ID::time0 + 34]->setFromNormalized(0.0);
-      value[ID::time0 + 35]->setFromNormalized(0.0);
-      value[ID::time0 + 36]->setFromNormalized(0.0);
-      value[ID::time0 + 37]->setFromNormalized(0.0);
-      value[ID::time0 + 38]->setFromNormalized(0.0);
-      value[ID::time0 + 39]->setFromNormalized(0.7944444444444445);
-      value[ID::time0 + 40]->setFromNormalized(0.4555555555555556);
-      value[ID::time0 + 41]->setFromNormalized(0.0);
-      value[ID::time0 + 42]->setFromNormalized(0.0);
-      value[ID::time0 + 43]->setFromNormalized(0.0);
-      value[ID::time0 + 44]->setFromNormalized(0.0);
-      value[ID::time0 + 45]->setFromNormalized(0.0);
-      value[ID::time0 + 46]->setFromNormalized(0.0);
-      value[ID::time0 + 47]->setFromNormalized(0.0);
-      value[ID::time0 + 48]->setFromNormalized(0.0);
-      value[ID::time0 + 49]->setFromNormalized(0.0);
-      value[ID::time0 + 50]->setFromNormalized(0.0);
-      value[ID::time0 + 51]->setFromNormalized(0.0);
-      value[ID::time0 + 52]->setFromNormalized(0.0);
-      value[ID::time0 + 53]->setFromNormalized(0.0);
-      value[ID::time0 + 54]->setFromNormalized(0.0);
-      value[ID::time0 + 55]->setFromNormalized(0.0);
-      value[ID::time0 + 56]->setFromNormalized(0.0);
-      value[ID::time0 + 57]->setFromNormalized(0.0);
-      value[ID::time0 + 58]->setFromNormalized(0.0);
-      value[ID::time0 + 59]->setFromNormalized(0.0);
-      value[ID::time0 + 60]->setFromNormalized(0.0);
-      value[ID::time0 + 61]->setFromNormalized(0.0);
-      value[ID::time0 + 62]->setFromNormalized(0.0);
-      value[ID::time0 + 63]->setFromNormalized(0.0);
-      value[ID::time0 + 64]->setFromNormalized(0.0);
-      value[ID::time0 + 65]->setFromNormalized(0.0);
-      value[ID::time0 + 66]->setFromNormalized(0.05833333333333335);
-      value[ID::time0 + 67]->setFromNormalized(0.07222222222222219);
-      value[ID::time0 + 68]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 69]->setFromNormalized(0.10555555555555551);
-      value[ID::time0 + 70]->setFromNormalized(0.13888888888888884);
-      value[ID::time0 + 71]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 72]->setFromNormalized(0.19999999999999996);
-      value[ID::time0 + 73]->setFromNormalized(0.2222222222222222);
-      value[ID::time0 + 74]->setFromNormalized(0.3222222222222222);
-      value[ID::time0 + 75]->setFromNormalized(0.7444444444444445);
-      value[ID::time0 + 76]->setFromNormalized(0.0);
-      value[ID::time0 + 77]->setFromNormalized(0.0);
-      value[ID::time0 + 78]->setFromNormalized(0.0);
-      value[ID::time0 + 79]->setFromNormalized(0.0);
-      value[ID::time0 + 80]->setFromNormalized(0.0);
-      value[ID::time0 + 81]->setFromNormalized(0.0);
-      value[ID::time0 + 82]->setFromNormalized(0.0);
-      value[ID::time0 + 83]->setFromNormalized(0.0);
-      value[ID::time0 + 84]->setFromNormalized(0.0);
-      value[ID::time0 + 85]->setFromNormalized(0.0);
-      value[ID::time0 + 86]->setFromNormalized(0.0);
-      value[ID::time0 + 87]->setFromNormalized(0.0);
-      value[ID::time0 + 88]->setFromNormalized(0.0);
-      value[ID::time0 + 89]->setFromNormalized(0.0);
-      value[ID::time0 + 90]->setFromNormalized(0.0);
-      value[ID::time0 + 91]->setFromNormalized(0.0);
-      value[ID::time0 + 92]->setFromNormalized(0.0);
-      value[ID::time0 + 93]->setFromNormalized(0.0);
-      value[ID::time0 + 94]->setFromNormalized(0.0);
-      value[ID::time0 + 95]->setFromNormalized(0.0);
-      value[ID::time0 + 96]->setFromNormalized(0.0);
-      value[ID::time0 + 97]->setFromNormalized(0.0);
-      value[ID::time0 + 98]->setFromNormalized(0.0);
-      value[ID::time0 + 99]->setFromNormalized(0.0);
-      value[ID::time0 + 100]->setFromNormalized(0.0);
-      value[ID::time0 + 101]->setFromNormalized(0.0);
-      value[ID::time0 + 102]->setFromNormalized(0.0);
-      value[ID::time0 + 103]->setFromNormalized(0.5166666666666666);
-      value[ID::time0 + 104]->setFromNormalized(0.7277777777777779);
-      value[ID::time0 + 105]->setFromNormalized(0.0);
-      value[ID::time0 + 106]->setFromNormalized(0.0);
-      value[ID::time0 + 107]->setFromNormalized(0.0);
-      value[ID::time0 + 108]->setFromNormalized(0.0);
-      value[ID::time0 + 109]->setFromNormalized(0.0);
-      value[ID::time0 + 110]->setFromNormalized(0.0);
-      value[ID::time0 + 111]->setFromNormalized(0.0);
-      value[ID::time0 + 112]->setFromNormalized(0.0);
-      value[ID::time0 + 113]->setFromNormalized(0.0);
-      value[ID::time0 + 114]->setFromNormalized(0.0);
-      value[ID::time0 + 115]->setFromNormalized(0.0);
-      value[ID::time0 + 116]->setFromNormalized(0.0);
-      value[ID::time0 + 117]->setFromNormalized(0.0);
-      value[ID::time0 + 118]->setFromNormalized(0.0);
-      value[ID::time0 + 119]->setFromNormalized(0.0);
-      value[ID::time0 + 120]->setFromNormalized(0.0);
-      value[ID::time0 + 121]->setFromNormalized(0.0);
-      value[ID::time0 + 122]->setFromNormalized(0.0);
-      value[ID::time0 + 123]->setFromNormalized(0.0);
-      value[ID::time0 + 124]->setFromNormalized(0.0);
-      value[ID::time0 + 125]->setFromNormalized(0.0);
-      value[ID::time0 + 126]->setFromNormalized(0.0);
-      value[ID::time0 + 127]->setFromNormalized(0.0);
-      value[ID::time0 + 128]->setFromNormalized(0.0);
-      value[ID::time0 + 129]->setFromNormalized(0.0);
-      value[ID::time0 + 130]->setFromNormalized(0.0);
-      value[ID::time0 + 131]->setFromNormalized(0.0);
-      value[ID::time0 + 132]->setFromNormalized(0.0);
-      value[ID::time0 + 133]->setFromNormalized(0.0);
-      value[ID::time0 + 134]->setFromNormalized(0.9333333333333333);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.6722222222222223);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.4555555555555556);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.4222222222222223);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.5944444444444444);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.38888888888888884);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.6166666666666667);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.37777777777777777);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.6333333333333333);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.3666666666666667);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.6388888888888888);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.35);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.33819444444444446);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.6743055555555556);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.31319444444444444);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.6993055555555555);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.7111111111111111);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.2833333333333333);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.7208333333333333);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.27083333333333337);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.7333333333333333);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.25555555555555554);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.75);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.23333333333333328);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.21111111111111114);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.7944444444444444);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.20138888888888884);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.8069444444444445);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.18888888888888888);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.8166666666666667);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.1777777777777778);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.8263888888888888);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.16527777777777775);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.8388888888888889);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.15555555555555556);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.85);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.85);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.85);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.85);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.85);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.85);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.85);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.85);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.1527777777777778);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.8444444444444444);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.1611111111111111);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.8333333333333334);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.8222222222222222);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.18888888888888888);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.8);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.20833333333333337);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.7833333333333333);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.22083333333333333);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.7708333333333334);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.23333333333333328);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.7625);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.24583333333333335);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.75);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.25555555555555554);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.7388888888888889);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.2694444444444445);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.2861111111111111);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.7055555555555556);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.6888888888888889);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.31666666666666665);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.6805555555555556);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.3222222222222222);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.6694444444444444);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.3388888888888889);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.6597222222222222);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.34305555555555556);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.3472222222222222);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.65);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.35277777777777775);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.6416666666666667);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.36111111111111116);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.6361111111111111);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.3666666666666667);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.6333333333333333);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.3666666666666667);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.6333333333333333);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.3666666666666667);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.6333333333333333);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.3666666666666667);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.6333333333333333);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.3666666666666667);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.6333333333333333);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.3666666666666667);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.6333333333333333);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.3666666666666667);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.6388888888888888);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.3555555555555555);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.65);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.3388888888888889);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.6666666666666666);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.3222222222222222);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.6888888888888889);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.7055555555555556);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.28888888888888886);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.7166666666666667);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.2777777777777778);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.2777777777777778);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.2777777777777778);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.7166666666666667);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.2861111111111111);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.7111111111111111);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.7);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.3111111111111111);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.6777777777777778);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.3277777777777777);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.34444444444444444);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.65);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.5555555555555556);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.4444444444444444);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.5555555555555556);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.4444444444444444);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.5555555555555556);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.4444444444444444);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.5555555555555556);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.4444444444444444);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.5444444444444444);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.17222222222222228);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.825);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.1777777777777778);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.8138888888888889);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.19444444444444442);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.8);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.21944444444444444);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.7722222222222223);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.23333333333333328);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.7611111111111111);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.23888888888888893);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.7611111111111111);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.23888888888888893);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.7611111111111111);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.2416666666666667);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.7555555555555555);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.24444444444444446);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.7555555555555555);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.24444444444444446);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.7555555555555555);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.24444444444444446);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.7555555555555555);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.24444444444444446);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.7555555555555555);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.24444444444444446);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.7555555555555555);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.24444444444444446);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.7583333333333333);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.23888888888888893);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.7638888888888888);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.23333333333333328);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.7666666666666667);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.23333333333333328);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.7685184902615018);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.22777777777777775);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.7759259541829427);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.22037031385633676);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.7833334181043837);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.21296284993489578);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.21055552164713542);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.7905555725097656);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.20833333333333337);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.7927777608235677);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.2061111450195312);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.7944444444444444);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.20416666666666672);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.7986111111111112);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.19861111111111107);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.8041666666666667);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.19444444444444442);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.3222222222222222);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.6777777777777778);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.30000000000000004);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.0805555555555556);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.21111111111111114);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.7888888888888889);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.21111111111111114);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.7888888888888889);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.21111111111111114);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.7888888888888889);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.2222222222222222);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.0888888888888889);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.9111111111111111);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.0888888888888889);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.9111111111111111);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.0888888888888889);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.9111111111111111);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.0888888888888889);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.9111111111111111);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.7388888888888889);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.2666666666666667);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.7333333333333333);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.2666666666666667);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.7333333333333333);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.2777777777777778);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.7222222222222222);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.2777777777777778);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.7055555555555556);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.2944444444444444);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.7055555555555556);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.5611111111111111);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.12777777777777777);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.8666666666666667);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.1444444444444445);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.8444444444444444);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.17222222222222228);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.8);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.23333333333333328);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.7166666666666667);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::d1FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d2FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d3FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.27521803975105286);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.12800000607967377);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.07599999755620956);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(1);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(1);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5599995851516724);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetDoris: {
-      value[ID::time0 + 0]->setFromNormalized(0.17795059878468114);
-      value[ID::time0 + 1]->setFromNormalized(0.19231400403212168);
-      value[ID::time0 + 2]->setFromNormalized(0.18992951321549176);
-      value[ID::time0 + 3]->setFromNormalized(0.19486495875404253);
-      value[ID::time0 + 4]->setFromNormalized(0.18595510386322972);
-      value[ID::time0 + 5]->setFromNormalized(0.1824043031089711);
-      value[ID::time0 + 6]->setFromNormalized(0.19343955037465652);
-      value[ID::time0 + 7]->setFromNormalized(0.19233148791803809);
-      value[ID::time0 + 8]->setFromNormalized(0.1797240906769715);
-      value[ID::time0 + 9]->setFromNormalized(0.1981539407531773);
-      value[ID::time0 + 10]->setFromNormalized(0.22837705198722263);
-      value[ID::time0 + 11]->setFromNormalized(0.03113792987593695);
-      value[ID::time0 + 12]->setFromNormalized(0.6679819280246856);
-      value[ID::time0 + 13]->setFromNormalized(0.6921826136989119);
-      value[ID::time0 + 14]->setFromNormalized(0.6119395269255602);
-      value[ID::time0 + 15]->setFromNormalized(0.5894585300861199);
-      value[ID::time0 + 16]->setFromNormalized(0.6021983037868619);
-      value[ID::time0 + 17]->setFromNormalized(0.4995601428404222);
-      value[ID::time0 + 18]->setFromNormalized(0.49504674414477146);
-      value[ID::time0 + 19]->setFromNormalized(0.49580496907726973);
-      value[ID::time0 + 20]->setFromNormalized(0.40075837957016325);
-      value[ID::time0 + 21]->setFromNormalized(0.3189186629849062);
-      value[ID::time0 + 22]->setFromNormalized(0.30835703431355904);
-      value[ID::time0 + 23]->setFromNormalized(0.3235374228554906);
-      value[ID::time0 + 24]->setFromNormalized(0.5348664614553034);
-      value[ID::time0 + 25]->setFromNormalized(0.544215997080161);
-      value[ID::time0 + 26]->setFromNormalized(0.029924504745422936);
-      value[ID::time0 + 27]->setFromNormalized(0.04243297315047673);
-      value[ID::time0 + 28]->setFromNormalized(0.048359419326949225);
-      value[ID::time0 + 29]->setFromNormalized(0.00725588685945352);
-      value[ID::time0 + 30]->setFromNormalized(0.005053334096007025);
-      value[ID::time0 + 31]->setFromNormalized(0.007451855614556004);
-      value[ID::time0 + 32]->setFromNormalized(0.022262566341968108);
-      value[ID::time0 + 33]->setFromNormalized(0.01741482244258421);
-      value[ID::time0 + 34]->setFromNormalized(0.0019036452029270812);
-      value[ID::time0 + 35]->setFromNormalized(0.0);
-      value[ID::time0 + 36]->setFromNormalized(0.02694468887468952);
-      value[ID::time0 + 37]->setFromNormalized(0.07559705704714284);
-      value[ID::time0 + 38]->setFromNormalized(0.010453559897127214);
-      value[ID::time0 + 39]->setFromNormalized(0.027086294818889047);
-      value[ID::time0 + 40]->setFromNormalized(0.043205618566567634);
-      value[ID::time0 + 41]->setFromNormalized(0.12958272465181672);
-      value[ID::time0 + 42]->setFromNormalized(0.07525766374284708);
-      value[ID::time0 + 43]->setFromNormalized(0.09210079525853529);
-      value[ID::time0 + 44]->setFromNormalized(0.10396596025218173);
-      value[ID::time0 + 45]->setFromNormalized(0.025032851270463383);
-      value[ID::time0 + 46]->setFromNormalized(0.0634796747677971);
-      value[ID::time0 + 47]->setFromNormalized(0.14973900625353131);
-      value[ID::time0 + 48]->setFromNormalized(0.11980511187257606);
-      value[ID::time0 + 49]->setFromNormalized(0.07272856708304858);
-      value[ID::time0 + 50]->setFromNormalized(0.057119188963058024);
-      value[ID::time0 + 51]->setFromNormalized(0.15220334126990503);
-      value[ID::time0 + 52]->setFromNormalized(0.055688607297967145);
-      value[ID::time0 + 53]->setFromNormalized(0.06564937801400927);
-      value[ID::time0 + 54]->setFromNormalized(0.0443039468033275);
-      value[ID::time0 + 55]->setFromNormalized(0.07297390424391277);
-      value[ID::time0 + 56]->setFromNormalized(0.04597915681233085);
-      value[ID::time0 + 57]->setFromNormalized(0.039743458237579174);
-      value[ID::time0 + 58]->setFromNormalized(0.0);
-      value[ID::time0 + 59]->setFromNormalized(0.6250370937724371);
-      value[ID::time0 + 60]->setFromNormalized(0.5009855007407988);
-      value[ID::time0 + 61]->setFromNormalized(0.4193907754616062);
-      value[ID::time0 + 62]->setFromNormalized(0.4446606735436659);
-      value[ID::time0 + 63]->setFromNormalized(0.43187438612858015);
-      value[ID::time0 + 64]->setFromNormalized(0.3871772210857982);
-      value[ID::time0 + 65]->setFromNormalized(0.35438334692810936);
-      value[ID::time0 + 66]->setFromNormalized(0.3107836042244331);
-      value[ID::time0 + 67]->setFromNormalized(0.41100449582066106);
-      value[ID::time0 + 68]->setFromNormalized(0.30976277159610566);
-      value[ID::time0 + 69]->setFromNormalized(0.2547324453922394);
-      value[ID::time0 + 70]->setFromNormalized(0.22116009464275194);
-      value[ID::time0 + 71]->setFromNormalized(0.22761298714586095);
-      value[ID::time0 + 72]->setFromNormalized(0.2388557974968427);
-      value[ID::time0 + 73]->setFromNormalized(0.14007359287313015);
-      value[ID::time0 + 74]->setFromNormalized(0.1528653742492536);
-      value[ID::time0 + 75]->setFromNormalized(0.20229823470118158);
-      value[ID::time0 + 76]->setFromNormalized(0.15602446876069873);
-      value[ID::time0 + 77]->setFromNormalized(0.11710155772267823);
-      value[ID::time0 + 78]->setFromNormalized(0.1172332793441663);
-      value[ID::time0 + 79]->setFromNormalized(0.14279962449270012);
-      value[ID::time0 + 80]->setFromNormalized(0.07911776560784749);
-      value[ID::time0 + 81]->setFromNormalized(0.06603424558018063);
-      value[ID::time0 + 82]->setFromNormalized(0.04067743223364105);
-      value[ID::time0 + 83]->setFromNormalized(0.05587535184345184);
-      value[ID::time0 + 84]->setFromNormalized(0.022757047790175733);
-      value[ID::time0 + 85]->setFromNormalized(0.022700587393164308);
-      value[ID::time0 + 86]->setFromNormalized(0.014154871286891435);
-      value[ID::time0 + 87]->setFromNormalized(0.018504664761716038);
-      value[ID::time0 + 88]->setFromNormalized(0.028214202094275286);
-      value[ID::time0 + 89]->setFromNormalized(0.6121204299429989);
-      value[ID::time0 + 90]->setFromNormalized(0.6147953884131027);
-      value[ID::time0 + 91]->setFromNormalized(0.5347263137018329);
-      value[ID::time0 + 92]->setFromNormalized(0.5198489333823882);
-      value[ID::time0 + 93]->setFromNormalized(0.4973011749310888);
-      value[ID::time0 + 94]->setFromNormalized(0.49786956587169856);
-      value[ID::time0 + 95]->setFromNormalized(0.415685437497874);
-      value[ID::time0 + 96]->setFromNormalized(0.009630307790579423);
-      value[ID::time0 + 97]->setFromNormalized(0.06675833716700455);
-      value[ID::time0 + 98]->setFromNormalized(0.17611711285658588);
-      value[ID::time0 + 99]->setFromNormalized(0.06527227071350124);
-      value[ID::time0 + 100]->setFromNormalized(0.015443160572692332);
-      value[ID::time0 + 101]->setFromNormalized(0.12307971511351337);
-      value[ID::time0 + 102]->setFromNormalized(0.030553494900759738);
-      value[ID::time0 + 103]->setFromNormalized(0.013121884484384092);
-      value[ID::time0 + 104]->setFromNormalized(0.024676610692944016);
-      value[ID::time0 + 105]->setFromNormalized(0.02145787492037758);
-      value[ID::time0 + 106]->setFromNormalized(0.08224322356298266);
-      value[ID::time0 + 107]->setFromNormalized(0.03221044346207663);
-      value[ID::time0 + 108]->setFromNormalized(0.027032778746340393);
-      value[ID::time0 + 109]->setFromNormalized(0.07618288281968842);
-      value[ID::time0 + 110]->setFromNormalized(0.07368735944224314);
-      value[ID::time0 + 111]->setFromNormalized(0.14901962601816823);
-      value[ID::time0 + 112]->setFromNormalized(0.163677077355068);
-      value[ID::time0 + 113]->setFromNormalized(0.07134988707395516);
-      value[ID::time0 + 114]->setFromNormalized(0.09022068322034446);
-      value[ID::time0 + 115]->setFromNormalized(0.0896359909121071);
-      value[ID::time0 + 116]->setFromNormalized(0.204784827174989);
-      value[ID::time0 + 117]->setFromNormalized(0.1130075694258842);
-      value[ID::time0 + 118]->setFromNormalized(0.14438632162352502);
-      value[ID::time0 + 119]->setFromNormalized(0.13109017852596347);
-      value[ID::time0 + 120]->setFromNormalized(0.028135277872426277);
-      value[ID::time0 + 121]->setFromNormalized(0.08487247532509788);
-      value[ID::time0 + 122]->setFromNormalized(0.024894454111422687);
-      value[ID::time0 + 123]->setFromNormalized(0.23411908608761622);
-      value[ID::time0 + 124]->setFromNormalized(0.006273192109701307);
-      value[ID::time0 + 125]->setFromNormalized(0.08914894902950131);
-      value[ID::time0 + 126]->setFromNormalized(0.05198499427260753);
-      value[ID::time0 + 127]->setFromNormalized(0.1049283008139951);
-      value[ID::time0 + 128]->setFromNormalized(0.14397316716377478);
-      value[ID::time0 + 129]->setFromNormalized(0.008726812546112923);
-      value[ID::time0 + 130]->setFromNormalized(0.021080410134613058);
-      value[ID::time0 + 131]->setFromNormalized(0.14162293028704875);
-      value[ID::time0 + 132]->setFromNormalized(0.07444929386569354);
-      value[ID::time0 + 133]->setFromNormalized(0.06723105004487283);
-      value[ID::time0 + 134]->setFromNormalized(0.03132645723190698);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.07222222222222219);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.09212632053336228);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.10421359688038245);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.11964038827580936);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.14222243829368642);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.1639442858601311);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.1588460948243986);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.1656121339953388);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.19526066198118397);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.21733371297602144);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.23026455992690348);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.23636770344317276);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.250560670959694);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.29148296589381967);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.28156769260020764);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.31733988309154637);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.3406357446214747);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.37672325218981284);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.36262006577758216);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.378370626005591);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.4962614684860281);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.8007814593785579);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.6926444184659742);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.7281422533136421);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.5052807087710323);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.49937436908525307);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.5226085039045409);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.4802424489313868);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.4837005996907232);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.5647838456876575);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.5389614264297347);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.4676446206359867);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.50116668560872);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.47674574628736105);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.4627636030447735);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.5401402378762782);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.5184939940541528);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.41136748599224093);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.5258242897348319);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.5487582498329875);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.47129775438270416);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.4736538026227267);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.4834220630579451);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.5321791128829761);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.45821704085027304);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.49210089468299956);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.49391630377092116);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.45331069053335193);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.4897181996225738);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.4961500828131873);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.522405702129258);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.5480920767664987);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.4558526461188802);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.5220040601673439);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.45596783615739145);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.4676891054434746);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.481204642457237);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.48844691575652965);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.48024471552092896);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.48708353638409735);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.5074716625119654);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.4429084771665156);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.39655453204033775);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.3517685454527248);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.3023340635049942);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.2651059506536603);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.3278161960170731);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.36846496056686756);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.28557873103466286);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.31005206830602505);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.24112420426116);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.24220951844838856);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.2087726714606627);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.16184143670555778);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.4389034203185467);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.5049980295522264);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.4226206557084948);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.4101627502931698);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.3489955371196079);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.268932182463467);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.3124371131495316);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.3287900678346405);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.2896329899709758);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.18833608184048617);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.18799903884014607);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.1687975639593136);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.4731965046063435);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.521977849257017);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.5163476034669696);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.48676169892240617);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.5408943823866408);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.4546405041639305);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.4532384211312471);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.5029582805440508);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.48958570156272013);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.48606016287080966);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.4917475086905813);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.477414210746762);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.5292074512734868);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.5391373408845478);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.4886568841538301);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.4779333257125454);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.5127619813037684);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.44607916830174904);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.4943753152020684);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.4965471757272576);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.5127750959960281);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.5233277587804495);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.5824974846515133);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.5612253357768872);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.5474824853152629);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.5730922887084934);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.5547608412528887);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.5286671645850088);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.541447749585172);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.5114786134821049);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.5245153387993249);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.529342858388361);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.433729558757376);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.5672087225677551);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.4942732517628132);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.468681793202526);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.5403362513034189);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.5595524249403956);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.49783693238274296);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.5566869460991719);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.40692380590584026);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.5264639440844476);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.5669991433112752);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.4205327202331776);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.5090170887241531);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.42795719567132084);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.5002652080776545);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.5471746884147326);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.39838149709103576);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.4997145588296308);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.5056773931513848);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.49632249403067746);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.4964166729267767);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.4960776654786028);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.2566002952011754);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.2908583804298931);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.3070402383743044);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.29840291714902756);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.3387349075256169);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.3545629157304372);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.375312791560296);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.3120228536386508);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.4149671814221022);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.3856513414975791);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.41586890418227196);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.43226161702574956);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.4546432970549309);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.474895137047597);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.41144277133779533);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.48266783656863577);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.4812421610411429);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.5012744793970267);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.4787863269179413);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.5023702480926907);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.5351157367451728);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.5963756943825763);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.5807173850204533);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.5732833674956825);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.5887459307321239);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.6139462398188712);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.6405178935207405);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.5795069932450331);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.6044484225510193);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.6239335950108834);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.6926831616713282);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.5059010547789323);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.5201501550608797);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.5249259259044632);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.49101741036880264);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.5508534377149161);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.5016308305865921);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.45472268466147664);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.4906853341905478);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.4767583158189903);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.4208991319845226);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.4460422813655604);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.5389436071803311);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.42916608055127947);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.5153173457382861);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.4753700462187111);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.46455356842385426);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.48099781279767256);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.5449349233116407);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.4892161210486283);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.5252711924018046);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.5008505250104431);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.46781710991836356);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.5070654555661728);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.4802886357135482);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.4788822474386583);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.4854024716481309);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.5544785377539979);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.4527392802941542);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.5848635690848978);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.4884727384331287);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.5490581389590782);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.442603555683645);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.5602374173298192);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.5140498096701007);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.5750617512223783);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.47086017770673644);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.4206713543188424);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.5557099314798329);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.42887656740940927);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.5163925066433255);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.5422349480646701);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.5547932112432185);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.47147862356354847);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.5392949262890844);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.47027944935183935);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.4446021850549127);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.4731724942563013);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.5224080345153628);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.45474394018203873);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.4252448727637139);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.5132468279603771);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.48112423027950235);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.5825233899015916);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.5265802611824186);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.4942187716970136);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.4903148843498734);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.4974545569633666);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.5372329767614776);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.5489016598682485);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.5561378262004294);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.5839267341804087);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.412698569461356);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.5311165042556252);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.5805698809189256);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.49390050961731247);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.48692413774155846);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.4551033003136937);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.5503830476724992);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.42076121137495764);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.5582869848401307);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.49044479686552567);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.4801392321640208);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.4838111174447639);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.47588707137045777);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.4329442708578731);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.4900020737001835);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.49341943892353646);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.4377206530990228);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.4312522770079011);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.47628171868589353);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.3113260053589098);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.404356919123889);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.42795953949322924);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.5341204882610717);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.44637012167533985);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.5277314597340216);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.46582778858784424);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.48437039240635227);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.5433738273989986);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.47053855757878693);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.4609111166880668);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.5524300139646583);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.5319037232720354);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.5210919600470585);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.41535074474124895);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.5175050547614204);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.42490239687835846);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.40921977418629757);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.5168552675684526);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.2146291714437249);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.19789079012305943);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.3047729152576962);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.2882683959035248);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.30199773063076457);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.3731104005571694);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.39694728554231856);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.4215655808098932);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.4245369486370611);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.48133708757554555);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.5769344813892817);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.5611803295239424);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.4619546065539729);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.4798205567594701);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.5174151759940115);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.5421121691902805);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.5334101407382256);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.6986026880308577);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.5163258554090568);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.5646811301041699);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.5689384995902265);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.5465049630606549);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.4623781789761793);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.7039328422703388);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.649791692571005);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.5757454784114354);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.5034054717863893);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.0859716218158747);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.21890254298624978);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.2886296159016975);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.2774780729472138);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.3083352153743731);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.3397171783408564);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.3348445271951992);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.3061133613591199);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.29825721081720885);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.33221079971985884);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.38114120384263783);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.5208120556290419);
-      value[ID::timeMultiply]->setFromNormalized(0.3359997570514679);
-      value[ID::innerFeedMultiply]->setFromNormalized(0.7919999957084656);
-      value[ID::d1FeedMultiply]->setFromNormalized(0.7260000705718994);
-      value[ID::d2FeedMultiply]->setFromNormalized(0.6460000276565552);
-      value[ID::d3FeedMultiply]->setFromNormalized(0.6859999895095825);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.37121790647506714);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(1.0);
-      value[ID::timeModulation]->setFromInt(1);
-      value[ID::innerFeedModulation]->setFromInt(0);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(1);
-      value[ID::seed]->setFromInt(1979711);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetEugenia: {
-      value[ID::time0 + 0]->setFromNormalized(0.2222222222222222);
-      value[ID::time0 + 1]->setFromNormalized(0.21111111111111114);
-      value[ID::time0 + 2]->setFromNormalized(0.19999999999999996);
-      value[ID::time0 + 3]->setFromNormalized(0.19444444444444442);
-      value[ID::time0 + 4]->setFromNormalized(0.18888888888888888);
-      value[ID::time0 + 5]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 6]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 7]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 8]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 9]->setFromNormalized(0.11111111111111116);
-      value[ID::time0 + 10]->setFromNormalized(0.12638888888888888);
-      value[ID::time0 + 11]->setFromNormalized(0.15694444444444444);
-      value[ID::time0 + 12]->setFromNormalized(0.17222222222222228);
-      value[ID::time0 + 13]->setFromNormalized(0.1972222222222222);
-      value[ID::time0 + 14]->setFromNormalized(0.2222222222222222);
-      value[ID::time0 + 15]->setFromNormalized(0.23611111111111116);
-      value[ID::time0 + 16]->setFromNormalized(0.26388888888888884);
-      value[ID::time0 + 17]->setFromNormalized(0.29166666666666663);
-      value[ID::time0 + 18]->setFromNormalized(0.3055555555555556);
-      value[ID::time0 + 19]->setFromNormalized(0.3305555555555556);
-      value[ID::time0 + 20]->setFromNormalized(0.3555555555555555);
-      value[ID::time0 + 21]->setFromNormalized(0.37222222222222223);
-      value[ID::time0 + 22]->setFromNormalized(0.40555555555555556);
-      value[ID::time0 + 23]->setFromNormalized(0.4222222222222223);
-      value[ID::time0 + 24]->setFromNormalized(0.43425924513075087);
-      value[ID::time0 + 25]->setFromNormalized(0.45833333333333337);
-      value[ID::time0 + 26]->setFromNormalized(0.48240742153591576);
-      value[ID::time0 + 27]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 28]->setFromNormalized(0.5138888888888888);
-      value[ID::time0 + 29]->setFromNormalized(0.5527777777777778);
-      value[ID::time0 + 30]->setFromNormalized(0.5722222222222222);
-      value[ID::time0 + 31]->setFromNormalized(0.5902777777777778);
-      value[ID::time0 + 32]->setFromNormalized(0.6263888888888889);
-      value[ID::time0 + 33]->setFromNormalized(0.6444444444444444);
-      value[ID::time0 + 34]->setFromNormalized(0.6592592663235135);
-      value[ID::time0 + 35]->setFromNormalized(0.6888888888888889);
-      value[ID::time0 + 36]->setFromNormalized(0.7185185114542643);
-      value[ID::time0 + 37]->setFromNormalized(0.7333333333333334);
-      value[ID::time0 + 38]->setFromNormalized(0.7666666666666666);
-      value[ID::time0 + 39]->setFromNormalized(0.7833333333333333);
-      value[ID::time0 + 40]->setFromNormalized(0.8);
-      value[ID::time0 + 41]->setFromNormalized(0.8333333333333334);
-      value[ID::time0 + 42]->setFromNormalized(0.85);
-      value[ID::time0 + 43]->setFromNormalized(0.8611111111111112);
-      value[ID::time0 + 44]->setFromNormalized(0.8444444444444444);
-      value[ID::time0 + 45]->setFromNormalized(0.8166666666666667);
-      value[ID::time0 + 46]->setFromNormalized(0.7777777777777778);
-      value[ID::time0 + 47]->setFromNormalized(0.7444444444444445);
-      value[ID::time0 + 48]->setFromNormalized(0.7111111111111111);
-      value[ID::time0 + 49]->setFromNormalized(0.6777777777777778);
-      value[ID::time0 + 50]->setFromNormalized(0.6555555555555556);
-      value[ID::time0 + 51]->setFromNormalized(0.6444444444444444);
-      value[ID::time0 + 52]->setFromNormalized(0.6333333333333333);
-      value[ID::time0 + 53]->setFromNormalized(0.6166666666666667);
-      value[ID::time0 + 54]->setFromNormalized(0.6111111111111112);
-      value[ID::time0 + 55]->setFromNormalized(0.6055555555555556);
-      value[ID::time0 + 56]->setFromNormalized(0.6055555555555556);
-      value[ID::time0 + 57]->setFromNormalized(0.6055555555555556);
-      value[ID::time0 + 58]->setFromNormalized(0.6055555555555556);
-      value[ID::time0 + 59]->setFromNormalized(0.6083333333333334);
-      value[ID::time0 + 60]->setFromNormalized(0.6138888888888889);
-      value[ID::time0 + 61]->setFromNormalized(0.6194444444444445);
-      value[ID::time0 + 62]->setFromNormalized(0.625);
-      value[ID::time0 + 63]->setFromNormalized(0.6305555555555555);
-      value[ID::time0 + 64]->setFromNormalized(0.6333333333333333);
-      value[ID::time0 + 65]->setFromNormalized(0.6370370229085287);
-      value[ID::time0 + 66]->setFromNormalized(0.644444465637207);
-      value[ID::time0 + 67]->setFromNormalized(0.6518518659803603);
-      value[ID::time0 + 68]->setFromNormalized(0.6555555555555556);
-      value[ID::time0 + 69]->setFromNormalized(0.6611111111111111);
-      value[ID::time0 + 70]->setFromNormalized(0.6722222222222223);
-      value[ID::time0 + 71]->setFromNormalized(0.6777777777777778);
-      value[ID::time0 + 72]->setFromNormalized(0.6861111111111111);
-      value[ID::time0 + 73]->setFromNormalized(0.6944444444444444);
-      value[ID::time0 + 74]->setFromNormalized(0.7055555555555555);
-      value[ID::time0 + 75]->setFromNormalized(0.7166666666666667);
-      value[ID::time0 + 76]->setFromNormalized(0.7222222222222222);
-      value[ID::time0 + 77]->setFromNormalized(0.7277777777777779);
-      value[ID::time0 + 78]->setFromNormalized(0.7277777777777779);
-      value[ID::time0 + 79]->setFromNormalized(0.7277777777777779);
-      value[ID::time0 + 80]->setFromNormalized(0.7277777777777779);
-      value[ID::time0 + 81]->setFromNormalized(0.7111111111111111);
-      value[ID::time0 + 82]->setFromNormalized(0.6916666666666667);
-      value[ID::time0 + 83]->setFromNormalized(0.6722222222222223);
-      value[ID::time0 + 84]->setFromNormalized(0.65);
-      value[ID::time0 + 85]->setFromNormalized(0.6055555555555556);
-      value[ID::time0 + 86]->setFromNormalized(0.5444444444444445);
-      value[ID::time0 + 87]->setFromNormalized(0.5194444444444444);
-      value[ID::time0 + 88]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 89]->setFromNormalized(0.4388888888888889);
-      value[ID::time0 + 90]->setFromNormalized(0.41666666666666663);
-      value[ID::time0 + 91]->setFromNormalized(0.3944444444444445);
-      value[ID::time0 + 92]->setFromNormalized(0.36111111111111116);
-      value[ID::time0 + 93]->setFromNormalized(0.34444444444444444);
-      value[ID::time0 + 94]->setFromNormalized(0.3277777777777777);
-      value[ID::time0 + 95]->setFromNormalized(0.3194444444444444);
-      value[ID::time0 + 96]->setFromNormalized(0.3111111111111111);
-      value[ID::time0 + 97]->setFromNormalized(0.3055555555555556);
-      value[ID::time0 + 98]->setFromNormalized(0.2972222222222223);
-      value[ID::time0 + 99]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 100]->setFromNormalized(0.2861111111111111);
-      value[ID::time0 + 101]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 102]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 103]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 104]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 105]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 106]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 107]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 108]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 109]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 110]->setFromNormalized(0.2944444444444444);
-      value[ID::time0 + 111]->setFromNormalized(0.2972222222222223);
-      value[ID::time0 + 112]->setFromNormalized(0.30000000000000004);
-      value[ID::time0 + 113]->setFromNormalized(0.3055555555555556);
-      value[ID::time0 + 114]->setFromNormalized(0.3055555555555556);
-      value[ID::time0 + 115]->setFromNormalized(0.3055555555555556);
-      value[ID::time0 + 116]->setFromNormalized(0.30000000000000004);
-      value[ID::time0 + 117]->setFromNormalized(0.2944444444444444);
-      value[ID::time0 + 118]->setFromNormalized(0.2944444444444444);
-      value[ID::time0 + 119]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 120]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 121]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 122]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 123]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 124]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 125]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 126]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 127]->setFromNormalized(0.27222222222222225);
-      value[ID::time0 + 128]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 129]->setFromNormalized(0.26111111111111107);
-      value[ID::time0 + 130]->setFromNormalized(0.25);
-      value[ID::time0 + 131]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 132]->setFromNormalized(0.21666666666666667);
-      value[ID::time0 + 133]->setFromNormalized(0.11111111111111116);
-      value[ID::time0 + 134]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.6055555555555556);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.6333333333333333);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.65);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.6888888888888889);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.7333333333333334);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.7555555555555555);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.28888888888888886);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.41666666666666663);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.19444444444444442);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.19444444444444442);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.1972222222222222);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.19999999999999996);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.21111111111111114);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.23333333333333328);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.25555555555555554);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.2777777777777778);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.28888888888888886);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.29611112806532114);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.3105555640326606);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.32499999999999996);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.3394444359673394);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.3538888719346788);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.36111111111111116);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.36944444444444446);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.38611111111111107);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.4027777777777778);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.4194444444444444);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.4361111111111111);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.4444444444444444);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.45138888888888884);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.4652777777777778);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.47916666666666663);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.4930555555555556);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.5069444444444444);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.5208333333333333);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.5277777777777778);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.5337963104248047);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.5458333333333334);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.557870356241862);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.5699073791503906);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.5819444020589193);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.593981424967448);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.6);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.606481467352973);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.6194444444444445);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.6324074215359158);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.6388888888888888);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.6416666666666666);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.6472222222222221);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.6527777777777778);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.6333333333333333);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.5666666666666667);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.5333333333333333);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.4722222222222222);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.40555555555555556);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.34444444444444444);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.3111111111111111);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.2666666666666667);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.2666666666666667);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.2666666666666667);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.2666666666666667);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.27222222222222225);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.2833333333333333);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.3055555555555556);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.3111111111111111);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.32013888888888886);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.33819444444444446);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.35624999999999996);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.37430555555555556);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.3833333333333333);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.39351853264702696);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.41388888888888886);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.43425924513075087);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.4444444444444444);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.45833333333333337);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.48611111111111116);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.5138888888888888);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.5277777777777778);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.5398148006863064);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.5638888888888889);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.5879629770914714);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.6);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.6125);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.6375);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.65);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.6625);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.6875);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.7);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.7194444444444444);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.7388888888888889);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.75);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.4666666666666667);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.37222222222222223);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.34444444444444444);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.32499999999999996);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.3055555555555556);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.3027777777777778);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.2972222222222223);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.2981481340196398);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.3055555555555556);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.31296297709147136);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.31666666666666665);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.3222222222222222);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.33333333333333337);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.3388888888888889);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.34444444444444444);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.35);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.36111111111111116);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.37222222222222223);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.24097222222222225);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.2451388888888889);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.24930555555555556);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.2534722222222222);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.25555555555555554);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.2569444444444444);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.2597222222222222);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.26111111111111107);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.6166666666666667);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.6166666666666667);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.6166666666666667);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.6166666666666667);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.6180555555555556);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.6208333333333333);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.6222222222222222);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.6244444529215495);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.628888914320204);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.6333333757188585);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.637777837117513);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.6422222985161675);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.6444444444444444);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.647685178120931);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.6541666666666667);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.6606481552124024);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.667129643758138);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.6736111323038737);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.6800926208496094);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.6833333333333333);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.6868055555555556);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.69375);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.7006944444444445);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.7076388888888889);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.7145833333333333);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.7215277777777778);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.7284722222222222);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.7354166666666666);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.7388888888888889);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.7423611111111111);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.7493055555555556);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.75625);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.7631944444444445);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.7701388888888889);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.7770833333333333);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.7840277777777778);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.7909722222222222);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.7944444444444445);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.7984127044677735);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.8063492033216688);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.8142857021755643);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.8222222010294596);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.830158699883355);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.8380952093336318);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.8460317187839084);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.85);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.8538888931274414);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.8616666687859429);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.8694444444444445);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.8772222201029459);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.8849999957614475);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.8888888888888888);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.8916666666666666);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.8972222222222223);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.9027777777777778);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.9083333333333333);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.9111111111111111);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.9120370388031006);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.9138888888888889);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.9157407389746772);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.9166666666666666);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.9166666666666666);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.9166666666666666);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.9166666666666666);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.9111111111111111);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.9055555555555556);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.8777777777777778);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.8611111111111112);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.8444444444444444);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.8222222222222222);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.8);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.7611111111111111);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.7333333333333334);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.7111111111111111);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.7069444444444444);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.6986111111111111);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.6902777777777778);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.6819444444444445);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.6777777777777778);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.6743055555555555);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.6673611111111111);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.6604166666666667);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.6534722222222222);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.65);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.6490740670098198);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.6472222222222221);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.6453703774346246);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.6444444444444444);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.6430555555555555);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.6402777777777777);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.6347222222222222);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.6263888888888889);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.6222222222222222);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.6194444444444445);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.6166666666666667);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.5888888888888889);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.5722222222222222);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.5555555555555556);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.5111111111111111);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.48611111111111116);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.4222222222222223);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.3666666666666667);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.31666666666666665);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.2777777777777778);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.25);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.22777777777777775);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.22777777777777775);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.22777777777777775);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.2305555555555555);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.23611111111111116);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.2416666666666667);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.24444444444444446);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.25555555555555554);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.2666666666666667);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.2777777777777778);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.28888888888888886);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.3055555555555556);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.3222222222222222);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.3291666666666667);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.34305555555555556);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.35);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.3569444444444444);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.37083333333333335);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.3930555555555556);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.40555555555555556);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.40555555555555556);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.40555555555555556);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.40555555555555556);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.40555555555555556);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.40555555555555556);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.40555555555555556);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.3666666666666667);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.3666666666666667);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.3666666666666667);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.3666666666666667);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.3666666666666667);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.8722222222222222);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.8722222222222222);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.8777777777777778);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.8888888888888888);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.8888888888888888);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.8888888888888888);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.8888888888888888);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.2833333333333333);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.2777777777777778);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.275);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.27222222222222225);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.2666666666666667);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.2666666666666667);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.25555555555555554);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.25);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.24444444444444446);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.23333333333333328);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.2222222222222222);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.21111111111111114);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.2055555555555556);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.19444444444444442);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.18333333333333335);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.4388888888888889);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.7333333333333334);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.44999999999999996);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.44999999999999996);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.8055555555555556);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.7888888888888889);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.7388888888888889);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.7);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.6722222222222223);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.3222222222222222);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.7222222222222222);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.31666666666666665);
-      value[ID::timeMultiply]->setFromNormalized(0.18000005185604098);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::d1FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d2FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d3FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.27521803975105286);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(0);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(0);
-      value[ID::seed]->setFromInt(12616462);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetEunomia: {
-      value[ID::time0 + 0]->setFromNormalized(0.0);
-      value[ID::time0 + 1]->setFromNormalized(0.0);
-      value[ID::time0 + 2]->setFromNormalized(0.0);
-      value[ID::time0 + 3]->setFromNormalized(0.0);
-      value[ID::time0 + 4]->setFromNormalized(0.0);
-      value[ID::time0 + 5]->setFromNormalized(0.0);
-      value[ID::time0 + 6]->setFromNormalized(0.0);
-      value[ID::time0 + 7]->setFromNormalized(0.0);
-      value[ID::time0 + 8]->setFromNormalized(0.0);
-      value[ID::time0 + 9]->setFromNormalized(0.0);
-      value[ID::time0 + 10]->setFromNormalized(0.0);
-      value[ID::time0 + 11]->setFromNormalized(0.0);
-      value[ID::time0 + 12]->setFromNormalized(0.0);
-      value[ID::time0 + 13]->setFromNormalized(0.0);
-      value[ID::time0 + 14]->setFromNormalized(0.0);
-      value[ID::time0 + 15]->setFromNormalized(0.0);
-      value[ID::time0 + 16]->setFromNormalized(0.0);
-      value[ID::time0 + 17]->setFromNormalized(0.0);
-      value[ID::time0 + 18]->setFromNormalized(0.0);
-      value[ID::time0 + 19]->setFromNormalized(0.0);
-      value[ID::time0 + 20]->setFromNormalized(0.0);
-      value[ID::time0 + 21]->setFromNormalized(0.0);
-      value[ID::time0 + 22]->setFromNormalized(0.0);
-      value[ID::time0 + 23]->setFromNormalized(0.0);
-      value[ID::time0 + 24]->setFromNormalized(0.0);
-      value[ID::time0 + 25]->setFromNormalized(0.0);
-      value[ID::time0 + 26]->setFromNormalized(0.0);
-      value[ID::time0 + 27]->setFromNormalized(0.0);
-      value[ID::time0 + 28]->setFromNormalized(0.0);
-      value[ID::time0 + 29]->setFromNormalized(0.0);
-      value[ID::time0 + 30]->setFromNormalized(0.0);
-      value[ID::time0 + 31]->setFromNormalized(0.0);
-      value[ID::time0 + 32]->setFromNormalized(0.0);
-      value[ID::time0 + 33]->setFromNormalized(0.0);
-      value[ID::time0 + 34]->setFromNormalized(0.0);
-      value[ID::time0 + 35]->setFromNormalized(0.0);
-      value[ID::time0 + 36]->setFromNormalized(0.0);
-      value[ID::time0 + 37]->setFromNormalized(0.0);
-      value[ID::time0 + 38]->setFromNormalized(0.0);
-      value[ID::time0 + 39]->setFromNormalized(0.0);
-      value[ID::time0 + 40]->setFromNormalized(0.0);
-      value[ID::time0 + 41]->setFromNormalized(0.0);
-      value[ID::time0 + 42]->setFromNormalized(0.0);
-      value[ID::time0 + 43]->setFromNormalized(0.0);
-      value[ID::time0 + 44]->setFromNormalized(0.0);
-      value[ID::time0 + 45]->setFromNormalized(0.0);
-      value[ID::time0 + 46]->setFromNormalized(0.0);
-      value[ID::time0 + 47]->setFromNormalized(0.0);
-      value[ID::time0 + 48]->setFromNormalized(0.0);
-      value[ID::time0 + 49]->setFromNormalized(0.0);
-      value[ID::time0 + 50]->setFromNormalized(0.0);
-      value[ID::time0 + 51]->setFromNormalized(0.0);
-      value[ID::time0 + 52]->setFromNormalized(0.0);
-      value[ID::time0 + 53]->setFromNormalized(0.0);
-      value[ID::time0 + 54]->setFromNormalized(0.0);
-      value[ID::time0 + 55]->setFromNormalized(0.0);
-      value[ID::time0 + 56]->setFromNormalized(0.0);
-      value[ID::time0 + 57]->setFromNormalized(0.0);
-      value[ID::time0 + 58]->setFromNormalized(0.0);
-      value[ID::time0 + 59]->setFromNormalized(0.0);
-      value[ID::time0 + 60]->setFromNormalized(0.0);
-      value[ID::time0 + 61]->setFromNormalized(0.0);
-      value[ID::time0 + 62]->setFromNormalized(0.0);
-      value[ID::time0 + 63]->setFromNormalized(0.0);
-      value[ID::time0 + 64]->setFromNormalized(0.0);
-      value[ID::time0 + 65]->setFromNormalized(0.0);
-      value[ID::time0 + 66]->setFromNormalized(0.0);
-      value[ID::time0 + 67]->setFromNormalized(0.0);
-      value[ID::time0 + 68]->setFromNormalized(0.0);
-      value[ID::time0 + 69]->setFromNormalized(0.0);
-      value[ID::time0 + 70]->setFromNormalized(0.0);
-      value[ID::time0 + 71]->setFromNormalized(0.0);
-      value[ID::time0 + 72]->setFromNormalized(0.0);
-      value[ID::time0 + 73]->setFromNormalized(0.0);
-      value[ID::time0 + 74]->setFromNormalized(0.0);
-      value[ID::time0 + 75]->setFromNormalized(0.0);
-      value[ID::time0 + 76]->setFromNormalized(0.0);
-      value[ID::time0 + 77]->setFromNormalized(0.0);
-      value[ID::time0 + 78]->setFromNormalized(0.0);
-      value[ID::time0 + 79]->setFromNormalized(0.0);
-      value[ID::time0 + 80]->setFromNormalized(0.0);
-      value[ID::time0 + 81]->setFromNormalized(0.0);
-      value[ID::time0 + 82]->setFromNormalized(0.0);
-      value[ID::time0 + 83]->setFromNormalized(0.0);
-      value[ID::time0 + 84]->setFromNormalized(0.009722222222222188);
-      value[ID::time0 + 85]->setFromNormalized(0.029166666666666674);
-      value[ID::time0 + 86]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 87]->setFromNormalized(0.05277777777777781);
-      value[ID::time0 + 88]->setFromNormalized(0.06666666666666665);
-      value[ID::time0 + 89]->setFromNormalized(0.07499999999999996);
-      value[ID::time0 + 90]->setFromNormalized(0.08333333333333337);
-      value[ID::time0 + 91]->setFromNormalized(0.10277777777777775);
-      value[ID::time0 + 92]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 93]->setFromNormalized(0.13611111111111107);
-      value[ID::time0 + 94]->setFromNormalized(0.15000000000000002);
-      value[ID::time0 + 95]->setFromNormalized(0.16388888888888886);
-      value[ID::time0 + 96]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 97]->setFromNormalized(0.19166666666666665);
-      value[ID::time0 + 98]->setFromNormalized(0.2055555555555556);
-      value[ID::time0 + 99]->setFromNormalized(0.23333333333333328);
-      value[ID::time0 + 100]->setFromNormalized(0.25);
-      value[ID::time0 + 101]->setFromNormalized(0.27222222222222225);
-      value[ID::time0 + 102]->setFromNormalized(0.2777777777777778);
-      value[ID::time0 + 103]->setFromNormalized(0.3055555555555556);
-      value[ID::time0 + 104]->setFromNormalized(0.31666666666666665);
-      value[ID::time0 + 105]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 106]->setFromNormalized(0.3388888888888889);
-      value[ID::time0 + 107]->setFromNormalized(0.3666666666666667);
-      value[ID::time0 + 108]->setFromNormalized(0.38888888888888884);
-      value[ID::time0 + 109]->setFromNormalized(0.4111111111111111);
-      value[ID::time0 + 110]->setFromNormalized(0.4222222222222223);
-      value[ID::time0 + 111]->setFromNormalized(0.43333333333333335);
-      value[ID::time0 + 112]->setFromNormalized(0.4555555555555556);
-      value[ID::time0 + 113]->setFromNormalized(0.46111111111111114);
-      value[ID::time0 + 114]->setFromNormalized(0.4833333333333333);
-      value[ID::time0 + 115]->setFromNormalized(0.5);
-      value[ID::time0 + 116]->setFromNormalized(0.5222222222222221);
-      value[ID::time0 + 117]->setFromNormalized(0.5388888888888889);
-      value[ID::time0 + 118]->setFromNormalized(0.5444444444444445);
-      value[ID::time0 + 119]->setFromNormalized(0.5555555555555556);
-      value[ID::time0 + 120]->setFromNormalized(0.5833333333333333);
-      value[ID::time0 + 121]->setFromNormalized(0.6);
-      value[ID::time0 + 122]->setFromNormalized(0.6111111111111112);
-      value[ID::time0 + 123]->setFromNormalized(0.6333333333333333);
-      value[ID::time0 + 124]->setFromNormalized(0.65);
-      value[ID::time0 + 125]->setFromNormalized(0.6666666666666667);
-      value[ID::time0 + 126]->setFromNormalized(0.6888888888888889);
-      value[ID::time0 + 127]->setFromNormalized(0.7277777777777779);
-      value[ID::time0 + 128]->setFromNormalized(0.7666666666666666);
-      value[ID::time0 + 129]->setFromNormalized(0.7833333333333333);
-      value[ID::time0 + 130]->setFromNormalized(0.8);
-      value[ID::time0 + 131]->setFromNormalized(0.8277777777777777);
-      value[ID::time0 + 132]->setFromNormalized(0.8444444444444444);
-      value[ID::time0 + 133]->setFromNormalized(0.8722222222222222);
-      value[ID::time0 + 134]->setFromNormalized(0.8833333333333333);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.3916666666666667);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.46597222222222223);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.46458333333333335);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.46319444444444446);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.4618055555555556);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.46111111111111114);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.4600000169542101);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.45777778625488286);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.4555555555555556);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.45333332485622835);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.4511110941569011);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.4483333163791232);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.44499999152289493);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.44166666666666665);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.43833334181043837);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.4350000169542101);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.43333333333333335);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.43333333333333335);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.43333333333333335);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.43333333333333335);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.43333333333333335);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.43333333333333335);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.43333333333333335);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.4326388888888889);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.43125);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.42986111111111114);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.42847222222222225);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.4268518659803603);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.42500000000000004);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.4231481340196398);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.4222222222222223);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.42037035624186203);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.41666666666666663);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.41296297709147134);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.41666666666666663);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.4222222222222223);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.4305555555555556);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.4388888888888889);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.4472222222222222);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.4555555555555556);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.46111111111111114);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.4675925784640842);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.46944444444444444);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.4712963104248047);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.4722222222222222);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.4722222222222222);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.4722222222222222);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.4722222222222222);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.4722222222222222);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.475);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.4805555555555555);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.4833333333333333);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.4833333333333333);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.4833333333333333);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.4833333333333333);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.4833333333333333);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.4847222222222223);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.48750000000000004);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.48888888888888893);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.48981480068630645);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.4916666666666667);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.49351853264702694);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.49444444444444446);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.6333333333333333);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.65);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.6611111111111111);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.6652777777777779);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.6736111111111112);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.6819444444444445);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.6902777777777778);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.6944444444444444);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.7083333333333333);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.7222222222222222);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.7291666666666667);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.7430555555555556);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.75);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.7555555555555555);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.7666666666666666);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.7722222222222223);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.775);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.7777777777777778);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.7833333333333333);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.30000000000000004);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.7944444444444445);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.8388888888888889);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.8611111111111112);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.8888888888888888);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.8888888888888888);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.8888888888888888);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.4833333333333333);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.5111111111111111);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.5222222222222221);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.5222222222222221);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.5166666666666666);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.5111111111111111);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.5194444444444444);
-      value[ID::timeMultiply]->setFromNormalized(0.3920001983642578);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::d1FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d2FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d3FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.27521803975105286);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(0);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(0);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.18399998545646667);
-      value[ID::wet]->setFromNormalized(0.4759998917579651);
-      value[ID::smoothness]->setFromNormalized(0.7799996733665466);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetEuphrosyne: {
-      value[ID::time0 + 0]->setFromNormalized(0.0);
-      value[ID::time0 + 1]->setFromNormalized(0.0);
-      value[ID::time0 + 2]->setFromNormalized(0.0);
-      value[ID::time0 + 3]->setFromNormalized(0.0);
-      value[ID::time0 + 4]->setFromNormalized(0.0);
-      value[ID::time0 + 5]->setFromNormalized(0.0);
-      value[ID::time0 + 6]->setFromNormalized(0.0);
-      value[ID::time0 + 7]->setFromNormalized(0.0);
-      value[ID::time0 + 8]->setFromNormalized(0.0);
-      value[ID::time0 + 9]->setFromNormalized(0.0);
-      value[ID::time0 + 10]->setFromNormalized(0.0);
-      value[ID::time0 + 11]->setFromNormalized(0.0);
-      value[ID::time0 + 12]->setFromNormalized(0.0);
-      value[ID::time0 + 13]->setFromNormalized(0.0);
-      value[ID::time0 + 14]->setFromNormalized(0.0);
-      value[ID::time0 + 15]->setFromNormalized(0.0);
-      value[ID::time0 + 16]->setFromNormalized(0.0);
-      value[ID::time0 + 17]->setFromNormalized(0.0);
-      value[ID::time0 + 18]->setFromNormalized(0.0);
-      value[ID::time0 + 19]->setFromNormalized(0.0);
-      value[ID::time0 + 20]->setFromNormalized(0.0);
-      value[ID::time0 + 21]->setFromNormalized(0.0);
-      value[ID::time0 + 22]->setFromNormalized(0.0);
-      value[ID::time0 + 23]->setFromNormalized(0.0);
-      value[ID::time0 + 24]->setFromNormalized(0.0);
-      value[ID::time0 + 25]->setFromNormalized(0.0);
-      value[ID::time0 + 26]->setFromNormalized(0.0);
-      value[ID::time0 + 27]->setFromNormalized(0.0);
-      value[ID::time0 + 28]->setFromNormalized(0.0);
-      value[ID::time0 + 29]->setFromNormalized(0.0);
-      value[ID::time0 + 30]->setFromNormalized(0.0);
-      value[ID::time0 + 31]->setFromNormalized(0.0);
-      value[ID::time0 + 32]->setFromNormalized(0.0);
-      value[ID::time0 + 33]->setFromNormalized(0.0);
-      value[ID::time0 + 34]->setFromNormalized(0.0);
-      value[ID::time0 + 35]->setFromNormalized(0.0);
-      value[ID::time0 + 36]->setFromNormalized(0.0);
-      value[ID::time0 + 37]->setFromNormalized(0.0);
-      value[ID::time0 + 38]->setFromNormalized(0.0);
-      value[ID::time0 + 39]->setFromNormalized(0.0);
-      value[ID::time0 + 40]->setFromNormalized(0.0);
-      value[ID::time0 + 41]->setFromNormalized(0.0);
-      value[ID::time0 + 42]->setFromNormalized(0.0);
-      value[ID::time0 + 43]->setFromNormalized(0.0);
-      value[ID::time0 + 44]->setFromNormalized(0.0);
-      value[ID::time0 + 45]->setFromNormalized(0.0);
-      value[ID::time0 + 46]->setFromNormalized(0.0);
-      value[ID::time0 + 47]->setFromNormalized(0.0);
-      value[ID::time0 + 48]->setFromNormalized(0.0);
-      value[ID::time0 + 49]->setFromNormalized(0.0);
-      value[ID::time0 + 50]->setFromNormalized(0.0);
-      value[ID::time0 + 51]->setFromNormalized(0.0);
-      value[ID::time0 + 52]->setFromNormalized(0.0);
-      value[ID::time0 + 53]->setFromNormalized(0.01666666666666672);
-      value[ID::time0 + 54]->setFromNormalized(0.033333333333333326);
-      value[ID::time0 + 55]->setFromNormalized(0.07777777777777772);
-      value[ID::time0 + 56]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 57]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 58]->setFromNormalized(0.2777777777777778);
-      value[ID::time0 + 59]->setFromNormalized(0.37222222222222223);
-      value[ID::time0 + 60]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 61]->setFromNormalized(0.5555555555555556);
-      value[ID::time0 + 62]->setFromNormalized(0.6333333333333333);
-      value[ID::time0 + 63]->setFromNormalized(0.7222222222222222);
-      value[ID::time0 + 64]->setFromNormalized(0.95);
-      value[ID::time0 + 65]->setFromNormalized(0.9722222222222222);
-      value[ID::time0 + 66]->setFromNormalized(0.9777777777777777);
-      value[ID::time0 + 67]->setFromNormalized(0.9944444444444445);
-      value[ID::time0 + 68]->setFromNormalized(0.9972222222222222);
-      value[ID::time0 + 69]->setFromNormalized(0.95);
-      value[ID::time0 + 70]->setFromNormalized(0.8611111111111112);
-      value[ID::time0 + 71]->setFromNormalized(0.8111111111111111);
-      value[ID::time0 + 72]->setFromNormalized(0.7833333333333333);
-      value[ID::time0 + 73]->setFromNormalized(0.7722222222222223);
-      value[ID::time0 + 74]->setFromNormalized(0.7444444444444445);
-      value[ID::time0 + 75]->setFromNormalized(0.7166666666666667);
-      value[ID::time0 + 76]->setFromNormalized(0.7);
-      value[ID::time0 + 77]->setFromNormalized(0.6777777777777778);
-      value[ID::time0 + 78]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 79]->setFromNormalized(0.3222222222222222);
-      value[ID::time0 + 80]->setFromNormalized(0.25);
-      value[ID::time0 + 81]->setFromNormalized(0.1444444444444445);
-      value[ID::time0 + 82]->setFromNormalized(0.06666666666666665);
-      value[ID::time0 + 83]->setFromNormalized(0.0);
-      value[ID::time0 + 84]->setFromNormalized(0.0);
-      value[ID::time0 + 85]->setFromNormalized(0.0);
-      value[ID::time0 + 86]->setFromNormalized(0.0);
-      value[ID::time0 + 87]->setFromNormalized(0.0);
-      value[ID::time0 + 88]->setFromNormalized(0.0);
-      value[ID::time0 + 89]->setFromNormalized(0.0);
-      value[ID::time0 + 90]->setFromNormalized(0.0);
-      value[ID::time0 + 91]->setFromNormalized(0.0);
-      value[ID::time0 + 92]->setFromNormalized(0.0);
-      value[ID::time0 + 93]->setFromNormalized(0.0);
-      value[ID::time0 + 94]->setFromNormalized(0.0);
-      value[ID::time0 + 95]->setFromNormalized(0.0);
-      value[ID::time0 + 96]->setFromNormalized(0.0);
-      value[ID::time0 + 97]->setFromNormalized(0.0);
-      value[ID::time0 + 98]->setFromNormalized(0.0);
-      value[ID::time0 + 99]->setFromNormalized(0.0);
-      value[ID::time0 + 100]->setFromNormalized(0.0);
-      value[ID::time0 + 101]->setFromNormalized(0.0);
-      value[ID::time0 + 102]->setFromNormalized(0.0);
-      value[ID::time0 + 103]->setFromNormalized(0.0);
-      value[ID::time0 + 104]->setFromNormalized(0.0);
-      value[ID::time0 + 105]->setFromNormalized(0.0);
-      value[ID::time0 + 106]->setFromNormalized(0.0);
-      value[ID::time0 + 107]->setFromNormalized(0.0);
-      value[ID::time0 + 108]->setFromNormalized(0.0);
-      value[ID::time0 + 109]->setFromNormalized(0.0);
-      value[ID::time0 + 110]->setFromNormalized(0.0);
-      value[ID::time0 + 111]->setFromNormalized(0.0);
-      value[ID::time0 + 112]->setFromNormalized(0.0);
-      value[ID::time0 + 113]->setFromNormalized(0.0);
-      value[ID::time0 + 114]->setFromNormalized(0.0);
-      value[ID::time0 + 115]->setFromNormalized(0.0);
-      value[ID::time0 + 116]->setFromNormalized(0.0);
-      value[ID::time0 + 117]->setFromNormalized(0.0);
-      value[ID::time0 + 118]->setFromNormalized(0.0);
-      value[ID::time0 + 119]->setFromNormalized(0.0);
-      value[ID::time0 + 120]->setFromNormalized(0.0);
-      value[ID::time0 + 121]->setFromNormalized(0.0);
-      value[ID::time0 + 122]->setFromNormalized(0.0);
-      value[ID::time0 + 123]->setFromNormalized(0.0);
-      value[ID::time0 + 124]->setFromNormalized(0.0);
-      value[ID::time0 + 125]->setFromNormalized(0.0);
-      value[ID::time0 + 126]->setFromNormalized(0.0);
-      value[ID::time0 + 127]->setFromNormalized(0.0);
-      value[ID::time0 + 128]->setFromNormalized(0.0);
-      value[ID::time0 + 129]->setFromNormalized(0.0);
-      value[ID::time0 + 130]->setFromNormalized(0.0);
-      value[ID::time0 + 131]->setFromNormalized(0.0);
-      value[ID::time0 + 132]->setFromNormalized(0.0);
-      value[ID::time0 + 133]->setFromNormalized(0.0);
-      value[ID::time0 + 134]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.95);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.95);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.8222222222222222);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.8888888888888888);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.8666666666666667);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.4555555555555556);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.4555555555555556);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.4555555555555556);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.8333333333333334);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.8222222222222222);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.8166666666666667);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.8166666666666667);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.8166666666666667);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.2944444444444444);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.27222222222222225);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.26111111111111107);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.3277777777777777);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.4083333333333333);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.21666666666666667);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.18333333333333335);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.25555555555555554);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.35);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.3277777777777777);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.38611111111111107);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.38888888888888884);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.2972222222222223);
-      value[ID::timeMultiply]->setFromNormalized(0.41600024700164795);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::d1FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d2FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d3FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.27521803975105286);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.4760001003742218);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.6160000562667847);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(1);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(1);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(0);
-      value[ID::seed]->setFromInt(9865003);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.18399998545646667);
-      value[ID::wet]->setFromNormalized(0.4759998917579651);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
+using PresetBank = std::array<
+  std::array<double, ParameterID::ID_ENUM_LENGTH>,
+  GlobalParameter::Preset_ENUM_LENGTH>;
 
-    case presetEuropa: {
-      value[ID::time0 + 0]->setFromNormalized(0.8611111111111112);
-      value[ID::time0 + 1]->setFromNormalized(0.0);
-      value[ID::time0 + 2]->setFromNormalized(0.0);
-      value[ID::time0 + 3]->setFromNormalized(0.0);
-      value[ID::time0 + 4]->setFromNormalized(0.0);
-      value[ID::time0 + 5]->setFromNormalized(0.0);
-      value[ID::time0 + 6]->setFromNormalized(0.0);
-      value[ID::time0 + 7]->setFromNormalized(0.0);
-      value[ID::time0 + 8]->setFromNormalized(0.0);
-      value[ID::time0 + 9]->setFromNormalized(0.0);
-      value[ID::time0 + 10]->setFromNormalized(0.0);
-      value[ID::time0 + 11]->setFromNormalized(0.0);
-      value[ID::time0 + 12]->setFromNormalized(0.0);
-      value[ID::time0 + 13]->setFromNormalized(0.0);
-      value[ID::time0 + 14]->setFromNormalized(0.0);
-      value[ID::time0 + 15]->setFromNormalized(0.0);
-      value[ID::time0 + 16]->setFromNormalized(0.0);
-      value[ID::time0 + 17]->setFromNormalized(0.0);
-      value[ID::time0 + 18]->setFromNormalized(0.0);
-      value[ID::time0 + 19]->setFromNormalized(0.0);
-      value[ID::time0 + 20]->setFromNormalized(0.0);
-      value[ID::time0 + 21]->setFromNormalized(0.0);
-      value[ID::time0 + 22]->setFromNormalized(0.0);
-      value[ID::time0 + 23]->setFromNormalized(0.0);
-      value[ID::time0 + 24]->setFromNormalized(0.0);
-      value[ID::time0 + 25]->setFromNormalized(0.0);
-      value[ID::time0 + 26]->setFromNormalized(0.0);
-      value[ID::time0 + 27]->setFromNormalized(0.0);
-      value[ID::time0 + 28]->setFromNormalized(0.0);
-      value[ID::time0 + 29]->setFromNormalized(0.0);
-      value[ID::time0 + 30]->setFromNormalized(0.0);
-      value[ID::time0 + 31]->setFromNormalized(0.0);
-      value[ID::time0 + 32]->setFromNormalized(0.0);
-      value[ID::time0 + 33]->setFromNormalized(0.0);
-      value[ID::time0 + 34]->setFromNormalized(0.0);
-      value[ID::time0 + 35]->setFromNormalized(0.0);
-      value[ID::time0 + 36]->setFromNormalized(0.0);
-      value[ID::time0 + 37]->setFromNormalized(0.0);
-      value[ID::time0 + 38]->setFromNormalized(0.0);
-      value[ID::time0 + 39]->setFromNormalized(0.0);
-      value[ID::time0 + 40]->setFromNormalized(0.0);
-      value[ID::time0 + 41]->setFromNormalized(0.0);
-      value[ID::time0 + 42]->setFromNormalized(0.0);
-      value[ID::time0 + 43]->setFromNormalized(0.0);
-      value[ID::time0 + 44]->setFromNormalized(0.0);
-      value[ID::time0 + 45]->setFromNormalized(0.0);
-      value[ID::time0 + 46]->setFromNormalized(0.0);
-      value[ID::time0 + 47]->setFromNormalized(0.0);
-      value[ID::time0 + 48]->setFromNormalized(0.0);
-      value[ID::time0 + 49]->setFromNormalized(0.0);
-      value[ID::time0 + 50]->setFromNormalized(0.0);
-      value[ID::time0 + 51]->setFromNormalized(0.0);
-      value[ID::time0 + 52]->setFromNormalized(0.0);
-      value[ID::time0 + 53]->setFromNormalized(0.0);
-      value[ID::time0 + 54]->setFromNormalized(0.0);
-      value[ID::time0 + 55]->setFromNormalized(0.0);
-      value[ID::time0 + 56]->setFromNormalized(0.0);
-      value[ID::time0 + 57]->setFromNormalized(0.0);
-      value[ID::time0 + 58]->setFromNormalized(0.0);
-      value[ID::time0 + 59]->setFromNormalized(0.0);
-      value[ID::time0 + 60]->setFromNormalized(0.0);
-      value[ID::time0 + 61]->setFromNormalized(0.0);
-      value[ID::time0 + 62]->setFromNormalized(0.0);
-      value[ID::time0 + 63]->setFromNormalized(0.0);
-      value[ID::time0 + 64]->setFromNormalized(0.0);
-      value[ID::time0 + 65]->setFromNormalized(0.0);
-      value[ID::time0 + 66]->setFromNormalized(0.0);
-      value[ID::time0 + 67]->setFromNormalized(0.0);
-      value[ID::time0 + 68]->setFromNormalized(0.0);
-      value[ID::time0 + 69]->setFromNormalized(0.0);
-      value[ID::time0 + 70]->setFromNormalized(0.0);
-      value[ID::time0 + 71]->setFromNormalized(0.0);
-      value[ID::time0 + 72]->setFromNormalized(0.0);
-      value[ID::time0 + 73]->setFromNormalized(0.0);
-      value[ID::time0 + 74]->setFromNormalized(0.0);
-      value[ID::time0 + 75]->setFromNormalized(0.0);
-      value[ID::time0 + 76]->setFromNormalized(0.0);
-      value[ID::time0 + 77]->setFromNormalized(0.0);
-      value[ID::time0 + 78]->setFromNormalized(0.0);
-      value[ID::time0 + 79]->setFromNormalized(0.0);
-      value[ID::time0 + 80]->setFromNormalized(0.0);
-      value[ID::time0 + 81]->setFromNormalized(0.0);
-      value[ID::time0 + 82]->setFromNormalized(0.0);
-      value[ID::time0 + 83]->setFromNormalized(0.0);
-      value[ID::time0 + 84]->setFromNormalized(0.0);
-      value[ID::time0 + 85]->setFromNormalized(0.0);
-      value[ID::time0 + 86]->setFromNormalized(0.0);
-      value[ID::time0 + 87]->setFromNormalized(0.0);
-      value[ID::time0 + 88]->setFromNormalized(0.0);
-      value[ID::time0 + 89]->setFromNormalized(0.0);
-      value[ID::time0 + 90]->setFromNormalized(0.0);
-      value[ID::time0 + 91]->setFromNormalized(0.0);
-      value[ID::time0 + 92]->setFromNormalized(0.0);
-      value[ID::time0 + 93]->setFromNormalized(0.0);
-      value[ID::time0 + 94]->setFromNormalized(0.0);
-      value[ID::time0 + 95]->setFromNormalized(0.0);
-      value[ID::time0 + 96]->setFromNormalized(0.0);
-      value[ID::time0 + 97]->setFromNormalized(0.0);
-      value[ID::time0 + 98]->setFromNormalized(0.0);
-      value[ID::time0 + 99]->setFromNormalized(0.0);
-      value[ID::time0 + 100]->setFromNormalized(0.0);
-      value[ID::time0 + 101]->setFromNormalized(0.0);
-      value[ID::time0 + 102]->setFromNormalized(0.0);
-      value[ID::time0 + 103]->setFromNormalized(0.0);
-      value[ID::time0 + 104]->setFromNormalized(0.0);
-      value[ID::time0 + 105]->setFromNormalized(0.0);
-      value[ID::time0 + 106]->setFromNormalized(0.0);
-      value[ID::time0 + 107]->setFromNormalized(0.0);
-      value[ID::time0 + 108]->setFromNormalized(0.0);
-      value[ID::time0 + 109]->setFromNormalized(0.0);
-      value[ID::time0 + 110]->setFromNormalized(0.0);
-      value[ID::time0 + 111]->setFromNormalized(0.0);
-      value[ID::time0 + 112]->setFromNormalized(0.0);
-      value[ID::time0 + 113]->setFromNormalized(0.0);
-      value[ID::time0 + 114]->setFromNormalized(0.0);
-      value[ID::time0 + 115]->setFromNormalized(0.0);
-      value[ID::time0 + 116]->setFromNormalized(0.0);
-      value[ID::time0 + 117]->setFromNormalized(0.0);
-      value[ID::time0 + 118]->setFromNormalized(0.0);
-      value[ID::time0 + 119]->setFromNormalized(0.0);
-      value[ID::time0 + 120]->setFromNormalized(0.0);
-      value[ID::time0 + 121]->setFromNormalized(0.0);
-      value[ID::time0 + 122]->setFromNormalized(0.0);
-      value[ID::time0 + 123]->setFromNormalized(0.0);
-      value[ID::time0 + 124]->setFromNormalized(0.0);
-      value[ID::time0 + 125]->setFromNormalized(0.0);
-      value[ID::time0 + 126]->setFromNormalized(0.0);
-      value[ID::time0 + 127]->setFromNormalized(0.0);
-      value[ID::time0 + 128]->setFromNormalized(0.0);
-      value[ID::time0 + 129]->setFromNormalized(0.0);
-      value[ID::time0 + 130]->setFromNormalized(0.0);
-      value[ID::time0 + 131]->setFromNormalized(0.0);
-      value[ID::time0 + 132]->setFromNormalized(0.0);
-      value[ID::time0 + 133]->setFromNormalized(0.0);
-      value[ID::time0 + 134]->setFromNormalized(0.9333333333333333);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.01666666666666672);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.019444444444444486);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.022222222222222254);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.022222222222222254);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.022222222222222254);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.022222222222222254);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.02777777777777779);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.03472222222222221);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.03749999999999998);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.03888888888888886);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.04166666666666663);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.0444444444444444);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.0444444444444444);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.0444444444444444);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.047222222222222276);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.050000000000000044);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.05138888888888893);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.054166666666666696);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.05555555555555558);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.05555555555555558);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.05555555555555558);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.061111111111111116);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.06666666666666665);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.06666666666666665);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.06666666666666665);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.06944444444444442);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.07222222222222219);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.07499999999999996);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.08333333333333337);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.08333333333333337);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.08333333333333337);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.0888888888888889);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.09444444444444444);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.10277777777777775);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.10555555555555551);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.11388888888888893);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.10555555555555551);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.10555555555555551);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.09444444444444444);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.09166666666666667);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.0888888888888889);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.0888888888888889);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.07222222222222219);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.06944444444444442);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.06666666666666665);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.06666666666666665);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.05555555555555558);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.050000000000000044);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.0444444444444444);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.02777777777777779);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.08333333333333337);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.08333333333333337);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.0888888888888889);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.09444444444444444);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.10555555555555551);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.6166666666666667);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.6194444444444445);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.6222222222222222);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.6333333333333333);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.6333333333333333);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.6361111111111111);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.6370370229085287);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.6333333333333333);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.629629643758138);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.6291666666666667);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.6319444444444444);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.6333333333333333);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.6333333333333333);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.6333333333333333);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.6333333333333333);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.6333333333333333);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.6333333333333333);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.6333333333333333);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.6347222222222222);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.6375);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.6416666666666666);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.6444444444444444);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.65);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.65);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.65);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.6527777777777778);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.6555555555555556);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.6611111111111111);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.6638888888888889);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.6694444444444445);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.6722222222222223);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.6722222222222223);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.6722222222222223);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.675);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.6777777777777778);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.6777777777777778);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.7);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.0805555555555556);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.21111111111111114);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.7888888888888889);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.21111111111111114);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.7888888888888889);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.21111111111111114);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.7888888888888889);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.2222222222222222);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.0888888888888889);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.9111111111111111);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.0888888888888889);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.9111111111111111);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.0888888888888889);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.9111111111111111);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.0888888888888889);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.9111111111111111);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.7388888888888889);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.2666666666666667);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.7333333333333333);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.2666666666666667);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.7333333333333333);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.2777777777777778);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.7222222222222222);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.2777777777777778);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.7055555555555556);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.2944444444444444);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.7055555555555556);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.1166666666666667);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.12777777777777777);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.1333333333333333);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.1444444444444445);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.15555555555555556);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.17222222222222228);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.19999999999999996);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.23333333333333328);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.2833333333333333);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.18333333333333335);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.18888888888888888);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.21666666666666667);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(0.8860000967979431);
-      value[ID::d1FeedMultiply]->setFromNormalized(0.7759999632835388);
-      value[ID::d2FeedMultiply]->setFromNormalized(0.7740001678466797);
-      value[ID::d3FeedMultiply]->setFromNormalized(0.8380001783370972);
-      value[ID::d4FeedMultiply]->setFromNormalized(0.6780002117156982);
-      value[ID::timeOffsetRange]->setFromNormalized(0.3640000820159912);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.3420000374317169);
-      value[ID::timeModulation]->setFromInt(1);
-      value[ID::innerFeedModulation]->setFromInt(0);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(0);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5599995851516724);
-      value[ID::bypass]->setFromInt(0);
-    } break;
+static constexpr PresetBank presetBank{{
+  // Default
+  {{
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 0.2752180285130085, 0.0, 0.0, 0.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 0,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+  // Bamberga
+  {{
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.5869779495764822,
+    0.05780388049663191, 0.5869779495764822, 0.05780388049663191, 0.4392116727047153,
+    0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0,
+    0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0,
+    0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153,
+    0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0,
+    0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0,
+    0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153,
+    0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0,
+    0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0,
+    0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153,
+    0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0,
+    0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0,
+    0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153,
+    0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0,
+    0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0,
+    0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153,
+    0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0,
+    0.4392116727047153, 0.0, 0.0, 0.4392116727047153, 0.0, 0.0, 0.46769459055386664, 0.0,
+    0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.0, 0.46769459055386664, 0.0, 0.0, 0.0,
+    0.46769459055386664, 0.0, 0.0, 0.42495268235150035, 0.0, 0.0, 0.0, 0.0,
+    0.42495268235150035, 0.0, 0.0, 0.0, 0.0, 0.42495268235150035, 0.0, 0.0, 0.0, 0.0,
+    0.42495268235150035, 0.0, 0.0, 0.0, 0.0, 0.42495268235150035, 0.0, 0.0, 0.0, 0.0,
+    0.42495268235150035, 0.0, 0.35878523175949995, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.35878523175949995, 0.0, 0.0, 0.0, 0.0, 0.0, 0.2919999957084656, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 0, 0.5, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+  // Camilla
+  {{
+    0.01388888888888884, 0.01666666666666672, 0.022222222222222254, 0.022222222222222254,
+    0.02777777777777779, 0.033333333333333326, 0.033333333333333326, 0.03888888888888886,
+    0.0444444444444444, 0.0444444444444444, 0.0444444444444444, 0.0444444444444444,
+    0.05555555555555558, 0.05555555555555558, 0.05555555555555558, 0.061111111111111116,
+    0.06666666666666665, 0.07777777777777772, 0.08333333333333337, 0.0888888888888889,
+    0.0888888888888889, 0.0888888888888889, 0.0888888888888889, 0.09444444444444444,
+    0.09999999999999998, 0.10555555555555551, 0.10555555555555551, 0.10555555555555551,
+    0.10833333333333328, 0.11111111111111116, 0.11111111111111116, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.12222222222222223, 0.12222222222222223, 0.12777777777777777, 0.12777777777777777,
+    0.12777777777777777, 0.12777777777777777, 0.12777777777777777, 0.12777777777777777,
+    0.12777777777777777, 0.12777777777777777, 0.12777777777777777, 0.12777777777777777,
+    0.12777777777777777, 0.12777777777777777, 0.12777777777777777, 0.12777777777777777,
+    0.12777777777777777, 0.12777777777777777, 0.12777777777777777, 0.12777777777777777,
+    0.12777777777777777, 0.12777777777777777, 0.12777777777777777, 0.12777777777777777,
+    0.12777777777777777, 0.12777777777777777, 0.12777777777777777, 0.12777777777777777,
+    0.12777777777777777, 0.1333333333333333, 0.1333333333333333, 0.13888888888888884,
+    0.13888888888888884, 0.14166666666666672, 0.1444444444444445, 0.15000000000000002,
+    0.15000000000000002, 0.15000000000000002, 0.15000000000000002, 0.15833333333333333,
+    0.16666666666666663, 0.16666666666666663, 0.16666666666666663, 0.1694444444444444,
+    0.17222222222222228, 0.17500000000000004, 0.1777777777777778, 0.1777777777777778,
+    0.18333333333333335, 0.19444444444444442, 0.19999999999999996, 0.2055555555555556,
+    0.21666666666666667, 0.22777777777777775, 0.23333333333333328, 0.23888888888888893,
+    0.24444444444444446, 0.25555555555555554, 0.2666666666666667, 0.2666666666666667,
+    0.28055555555555556, 0.28888888888888886, 0.2944444444444444, 0.3055555555555556,
+    0.31666666666666665, 0.3222222222222222, 0.33333333333333337, 0.3388888888888889,
+    0.34444444444444444, 0.3555555555555555, 0.3666666666666667, 0.37222222222222223,
+    0.37777777777777777, 0.38888888888888884, 0.4, 0.40555555555555556,
+    0.41666666666666663, 0.41666666666666663, 0.4222222222222223, 0.4388888888888889,
+    0.4388888888888889, 0.4388888888888889, 0.44999999999999996, 0.4555555555555556,
+    0.46111111111111114, 0.4666666666666667, 0.47777777777777775, 0.4833333333333333,
+    0.49444444444444446, 0.5, 0.5055555555555555, 0.5111111111111111, 0.5222222222222221,
+    0.5222222222222221, 0.7666666666666666, 0.6055555555555556, 0.6333333333333333, 0.65,
+    0.6888888888888889, 0.7333333333333334, 0.7555555555555555, 0.7944444444444445,
+    0.8166666666666667, 0.8277777777777777, 0.8388888888888889, 0.8388888888888889,
+    0.8388888888888889, 0.8388888888888889, 0.8333333333333334, 0.8277777777777777,
+    0.8277777777777777, 0.8222222222222222, 0.8222222222222222, 0.8222222222222222,
+    0.8166666666666667, 0.8166666666666667, 0.8138888888888889, 0.8111111111111111,
+    0.8111111111111111, 0.8083333333333333, 0.8055555555555556, 0.8027777777777778, 0.8,
+    0.8, 0.8, 0.8, 0.8, 0.8, 0.8, 0.7989583333333333, 0.796875, 0.7947916666666667,
+    0.7927083333333333, 0.790625, 0.7885416666666667, 0.7864583333333334, 0.784375,
+    0.7833333333333333, 0.7805555555555556, 0.775, 0.7722222222222223,
+    0.7722222222222223, 0.7722222222222223, 0.7722222222222223, 0.7722222222222223,
+    0.7722222222222223, 0.7694444444444444, 0.7666666666666666, 0.7638888888888888,
+    0.7611111111111111, 0.7611111111111111, 0.7611111111111111, 0.7611111111111111,
+    0.7611111111111111, 0.7611111111111111, 0.7611111111111111, 0.7611111111111111,
+    0.7611111111111111, 0.7611111111111111, 0.7611111111111111, 0.7611111111111111,
+    0.7611111111111111, 0.7611111111111111, 0.7611111111111111, 0.7611111111111111,
+    0.7611111111111111, 0.7611111111111111, 0.7611111111111111, 0.7611111111111111,
+    0.7611111111111111, 0.7611111111111111, 0.7611111111111111, 0.7611111111111111,
+    0.7611111111111111, 0.7611111111111111, 0.7611111111111111, 0.7611111111111111,
+    0.7611111111111111, 0.7611111111111111, 0.7625, 0.7652777777777777,
+    0.7666666666666666, 0.7666666666666666, 0.7666666666666666, 0.7666666666666666,
+    0.7694444444444444, 0.775, 0.7777777777777778, 0.7791666666666667,
+    0.7819444444444444, 0.7833333333333333, 0.7833333333333333, 0.7833333333333333,
+    0.7833333333333333, 0.7833333333333333, 0.7833333333333333, 0.7833333333333333,
+    0.7847222222222222, 0.7875, 0.7888888888888889, 0.7888888888888889,
+    0.7888888888888889, 0.7916666666666666, 0.7944444444444445, 0.7944444444444445,
+    0.7944444444444445, 0.7944444444444445, 0.7944444444444445, 0.7944444444444445,
+    0.7944444444444445, 0.7944444444444445, 0.7944444444444445, 0.7944444444444445,
+    0.7944444444444445, 0.7944444444444445, 0.7944444444444445, 0.7944444444444445,
+    0.7944444444444445, 0.7944444444444445, 0.7944444444444445, 0.7944444444444445,
+    0.7944444444444445, 0.7944444444444445, 0.7944444444444445, 0.7944444444444445,
+    0.7944444444444445, 0.7722222222222223, 0.7722222222222223, 0.7722222222222223,
+    0.7722222222222223, 0.3277777777777777, 0.3277777777777777, 0.34444444444444444,
+    0.3472222222222222, 0.35, 0.35277777777777775, 0.3555555555555555,
+    0.3569444444444444, 0.3597222222222223, 0.36111111111111116, 0.36388888888888893,
+    0.3666666666666667, 0.370370356241862, 0.37777777777777777, 0.38518519931369355,
+    0.38888888888888884, 0.3907407548692491, 0.3944444444444445, 0.3981481340196398, 0.4,
+    0.40092591179741754, 0.4027777777777778, 0.40462964375813804, 0.40555555555555556,
+    0.4064814673529731, 0.4083333333333333, 0.41018519931369357, 0.4111111111111111,
+    0.41527777777777775, 0.42361111111111116, 0.4277777777777778, 0.4277777777777778,
+    0.4277777777777778, 0.4277777777777778, 0.4277777777777778, 0.4277777777777778,
+    0.4277777777777778, 0.4277777777777778, 0.4277777777777778, 0.4277777777777778,
+    0.4277777777777778, 0.4277777777777778, 0.4277777777777778, 0.4277777777777778,
+    0.4277777777777778, 0.4277777777777778, 0.4277777777777778, 0.4277777777777778,
+    0.4222222222222223, 0.41666666666666663, 0.41527777777777775, 0.4125,
+    0.4111111111111111, 0.4083333333333333, 0.40555555555555556, 0.4, 0.4, 0.4, 0.4,
+    0.3944444444444445, 0.3916666666666667, 0.38888888888888884, 0.38888888888888884,
+    0.38888888888888884, 0.38888888888888884, 0.38888888888888884, 0.38888888888888884,
+    0.38888888888888884, 0.38888888888888884, 0.38888888888888884, 0.38888888888888884,
+    0.38888888888888884, 0.38888888888888884, 0.38888888888888884, 0.38888888888888884,
+    0.38888888888888884, 0.38888888888888884, 0.38888888888888884, 0.38888888888888884,
+    0.38888888888888884, 0.38888888888888884, 0.38888888888888884, 0.38888888888888884,
+    0.38888888888888884, 0.38888888888888884, 0.38888888888888884, 0.38888888888888884,
+    0.38888888888888884, 0.38888888888888884, 0.38888888888888884, 0.38888888888888884,
+    0.38888888888888884, 0.38888888888888884, 0.38888888888888884, 0.38888888888888884,
+    0.38888888888888884, 0.38888888888888884, 0.38888888888888884, 0.38888888888888884,
+    0.38888888888888884, 0.38888888888888884, 0.38888888888888884, 0.38611111111111107,
+    0.3833333333333333, 0.3833333333333333, 0.3833333333333333, 0.3833333333333333,
+    0.3833333333333333, 0.3833333333333333, 0.3833333333333333, 0.3833333333333333,
+    0.3833333333333333, 0.3833333333333333, 0.3833333333333333, 0.3833333333333333,
+    0.3833333333333333, 0.3833333333333333, 0.37777777777777777, 0.37777777777777777,
+    0.37777777777777777, 0.37222222222222223, 0.37222222222222223, 0.37222222222222223,
+    0.37222222222222223, 0.37222222222222223, 0.37222222222222223, 0.37222222222222223,
+    0.37222222222222223, 0.37222222222222223, 0.37222222222222223, 0.37222222222222223,
+    0.37222222222222223, 0.37222222222222223, 0.37222222222222223, 0.04166666666666663,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.3222222222222222, 0.31666666666666665, 0.31666666666666665,
+    0.44399991631507874, 1.0, 1.0, 1.0, 1.0, 1.0, 0.27521803975105286, 0.0, 1.0, 1.0,
+    1.0, 1.0, 1, 1, 1, 1, 1, 1, 0, 0.8479992747306824, 0.5199999213218689, 0.5, 0.5, 1.0,
+    0,
+  }},
+  // Ceres
+  {{
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.7055555555555555, 0.6777777777777778, 0.6555555555555556,
+    0.6222222222222222, 0.6055555555555556, 0.5666666666666667, 0.55, 0.5472222222222223,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.5555555555555556, 0.5388888888888889, 0.5222222222222221,
+    0.5111111111111111, 0.49444444444444446, 0.4833333333333333, 0.4722222222222222,
+    0.46111111111111114, 0.44999999999999996, 0.44999999999999996, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.5, 0.4833333333333333, 0.4666666666666667, 0.44999999999999996,
+    0.44999999999999996, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.07777777777777772,
+    0.06944444444444442, 0.061111111111111116, 0.05555555555555558, 0.050000000000000044,
+    0.03888888888888886, 0.01666666666666672, 0.005555555555555536, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.1444444444444445, 0.1444444444444445,
+    0.1444444444444445, 0.15000000000000002, 0.1527777777777778, 0.15555555555555556,
+    0.16388888888888886, 0.17222222222222228, 0.17500000000000004, 0.18055555555555558,
+    0.18333333333333335, 0.18888888888888888, 0.19999999999999996, 0.2055555555555556,
+    0.20833333333333337, 0.2138888888888889, 0.21944444444444444, 0.22499999999999998,
+    0.2305555555555555, 0.23611111111111116, 0.2416666666666667, 0.24722222222222223,
+    0.25277777777777777, 0.25555555555555554, 0.2587301466200087, 0.26507932874891493,
+    0.27142851087782116, 0.2777776930067274, 0.2841268751356337, 0.29047605726453996,
+    0.2968252817789714, 0.30000000000000004, 0.3027777777777778, 0.30833333333333335,
+    0.3138888888888889, 0.3194444444444444, 0.32499999999999996, 0.3305555555555556,
+    0.33611111111111114, 0.3416666666666667, 0.34444444444444444, 0.3477777693006727,
+    0.3544444190131293, 0.36111106872558596, 0.3677777184380425, 0.3744443681504991,
+    0.37777777777777777, 0.38055555555555554, 0.38611111111111107, 0.3916666666666667,
+    0.39722222222222225, 0.4027777777777778, 0.4083333333333333, 0.41388888888888886,
+    0.4194444444444444, 0.4222222222222223, 0.42592591179741757, 0.43333333333333335,
+    0.44074075486924913, 0.4481481764051649, 0.4555555979410807, 0.4629630194769965,
+    0.4666666666666667, 0.4697530958387587, 0.4759259541829427, 0.4820988125271267,
+    0.48827167087131074, 0.49444452921549475, 0.5006173875596789, 0.5067902459038629,
+    0.5129631042480469, 0.5191359625922309, 0.5222222222222221, 0.5254629770914714,
+    0.5319444444444444, 0.5384259117974175, 0.5449073791503907, 0.5513888465033637,
+    0.5578703138563368, 0.5611111111111111, 0.5622222052680121, 0.5644444359673394,
+    0.5666666666666667, 0.5688888973659939, 0.5711111280653212, 0.5722222222222222,
+    0.5722222222222222, 0.5722222222222222, 0.5722222222222222, 0.5722222222222222,
+    0.5722222222222222, 0.5722222222222222, 0.5722222222222222, 0.5722222222222222,
+    0.5722222222222222, 0.5722222222222222, 0.5722222222222222, 0.5722222222222222,
+    0.5722222222222222, 0.5722222222222222, 0.5722222222222222, 0.5722222222222222,
+    0.5722222222222222, 0.5638888888888889, 0.5555555555555556, 0.5222222222222221,
+    0.49444444444444446, 0.46944444444444444, 0.4444444444444444, 0.3666666666666667,
+    0.3277777777777777, 0.27222222222222225, 0.23888888888888893, 0.2222222222222222,
+    0.2055555555555556, 0.1958333333333333, 0.17638888888888893, 0.16666666666666663,
+    0.16269844902886288, 0.15476192898220487, 0.14682540893554685, 0.13888888888888884,
+    0.13095236884223094, 0.12301584879557292, 0.11507932874891491, 0.11111111111111116,
+    0.108888922797309, 0.10444446139865449, 0.09999999999999998, 0.09555553860134547,
+    0.09111107720269096, 0.0888888888888889, 0.5, 0.5, 0.5, 0.5, 0.2222222222222222,
+    0.21666666666666667, 0.21666666666666667, 0.21666666666666667, 0.21666666666666667,
+    0.21666666666666667, 0.2222222222222222, 0.22499999999999998, 0.22777777777777775,
+    0.23611111111111116, 0.24444444444444446, 0.24722222222222223, 0.25277777777777777,
+    0.25555555555555554, 0.25555555555555554, 0.25555555555555554, 0.27222222222222225,
+    0.275, 0.2777777777777778, 0.2833333333333333, 0.2833333333333333,
+    0.2833333333333333, 0.28888888888888886, 0.2944444444444444, 0.2972222222222223,
+    0.30000000000000004, 0.30833333333333335, 0.31666666666666665, 0.3222222222222222,
+    0.3277777777777777, 0.33333333333333337, 0.34444444444444444, 0.35,
+    0.36388888888888893, 0.37777777777777777, 0.3847222222222222, 0.39861111111111114,
+    0.40555555555555556, 0.43333333333333335, 0.4555555555555556, 0.48888888888888893,
+    0.5222222222222221, 0.5333333333333333, 0.5388888888888889, 0.5444444444444445,
+    0.5555555555555556, 0.5583333333333333, 0.5611111111111111, 0.5777777777777777,
+    0.5805555555555555, 0.5833333333333333, 0.5888888888888889, 0.5944444444444444,
+    0.5972222222222222, 0.6, 0.6027777777777779, 0.6055555555555556, 0.6083333333333334,
+    0.6111111111111112, 0.6111111111111112, 0.6111111111111112, 0.6111111111111112,
+    0.6111111111111112, 0.6111111111111112, 0.6111111111111112, 0.6111111111111112,
+    0.6111111111111112, 0.6111111111111112, 0.6111111111111112, 0.6111111111111112,
+    0.6111111111111112, 0.6111111111111112, 0.6111111111111112, 0.6069444444444445,
+    0.5986111111111111, 0.5944444444444444, 0.5888888888888889, 0.5833333333333333,
+    0.5791666666666666, 0.5708333333333333, 0.5666666666666667, 0.5583333333333333,
+    0.5416666666666667, 0.5333333333333333, 0.525, 0.5083333333333333,
+    0.4916666666666667, 0.4833333333333333, 0.475, 0.45833333333333337,
+    0.44166666666666665, 0.43333333333333335, 0.42847222222222225, 0.41874999999999996,
+    0.40902777777777777, 0.3993055555555556, 0.3944444444444445, 0.3905555725097656,
+    0.3827777862548828, 0.375, 0.3672222137451172, 0.3594444274902344,
+    0.3555555555555555, 0.3518518659803602, 0.34444444444444444, 0.33703702290852866,
+    0.33333333333333337, 0.3311111026340061, 0.3266666412353516, 0.3222221798366971,
+    0.3177777184380426, 0.31333325703938797, 0.3111111111111111, 0.3104166666666667,
+    0.3090277777777778, 0.3076388888888889, 0.30625, 0.3055555555555556,
+    0.30486111111111114, 0.30347222222222225, 0.30208333333333337, 0.3006944444444445,
+    0.30000000000000004, 0.30000000000000004, 0.30000000000000004, 0.30000000000000004,
+    0.30000000000000004, 0.30000000000000004, 0.30000000000000004, 0.30000000000000004,
+    0.30000000000000004, 0.30000000000000004, 0.32499999999999996, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5580002665519714, 1.0, 1.0, 1.0, 1.0, 1.0, 0.2752180285130085, 0.0, 0.0,
+    0.0, 0.0, 0.0, 1, 0, 0, 0, 0, 0, 0, 0.5, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+  // Cybele
+  {{
+    0.0888888888888889, 0.050000000000000044, 0.12222222222222223, 0.14166666666666672,
+    0.1333333333333333, 0.15000000000000002, 0.18333333333333335, 0.46111111111111114,
+    0.2222222222222222, 0.23333333333333328, 0.24444444444444446, 0.25,
+    0.25555555555555554, 0.27222222222222225, 0.2833333333333333, 0.29166666666666663,
+    0.30000000000000004, 0.3111111111111111, 0.3222222222222222, 0.33333333333333337,
+    0.35, 0.3944444444444445, 0.4277777777777778, 0.44999999999999996, 0.475,
+    0.4388888888888889, 0.44999999999999996, 0.4555555555555556, 0.4722222222222222,
+    0.48888888888888893, 0.5111111111111111, 0.5333333333333333, 0.5611111111111111,
+    0.5944444444444444, 0.65, 0.6444444444444444, 0.6, 0.5722222222222222, 0.55,
+    0.5166666666666666, 0.4833333333333333, 0.44999999999999996, 0.4222222222222223,
+    0.38888888888888884, 0.36111111111111116, 0.34444444444444444, 0.34444444444444444,
+    0.34444444444444444, 0.35277777777777775, 0.37777777777777777, 0.40555555555555556,
+    0.4277777777777778, 0.44999999999999996, 0.4722222222222222, 0.49444444444444446,
+    0.5166666666666666, 0.5333333333333333, 0.55, 0.5555555555555556, 0.5777777777777777,
+    0.5888888888888889, 0.6055555555555556, 0.6222222222222222, 0.6222222222222222,
+    0.5666666666666667, 0.5555555555555556, 0.55, 0.5333333333333333, 0.5222222222222221,
+    0.5222222222222221, 0.5055555555555555, 0.5, 0.49444444444444446,
+    0.48888888888888893, 0.47777777777777775, 0.47777777777777775, 0.47777777777777775,
+    0.47777777777777775, 0.47777777777777775, 0.47777777777777775, 0.47777777777777775,
+    0.47777777777777775, 0.4722222222222222, 0.44999999999999996, 0.4388888888888889,
+    0.3916666666666667, 0.37222184075249565, 0.3652042812771268, 0.3581867218017578,
+    0.35116916232638884, 0.34415160285102, 0.337134043375651, 0.33011648390028214,
+    0.32309892442491317, 0.3160813649495443, 0.30906380547417533, 0.3020462459988065,
+    0.2950286865234375, 0.28801108466254344, 0.28099356757269967, 0.2739760504828559,
+    0.2669585333930121, 0.25994101630316835, 0.2529234992133247, 0.24590598212348092,
+    0.23888846503363714, 0.23187094794379337, 0.2248534308539496, 0.21783591376410594,
+    0.21081839667426217, 0.2038008795844184, 0.19678336249457462, 0.18976584540473085,
+    0.1827483283148872, 0.17573081122504342, 0.16871329413519964, 0.16169577704535587,
+    0.1546782599555121, 0.14766074286566844, 0.14064322577582467, 0.1336257086859809,
+    0.12660819159613712, 0.11959067450629335, 0.11257315741644969, 0.10555564032660592,
+    0.09853812323676214, 0.09152060614691837, 0.0845030890570746, 0.07748557196723094,
+    0.07046805487738717, 0.06345053778754339, 0.05643302069769962, 0.04941550360785585,
+    0.04239798651801219, 0.03888888888888886, 0.17222222222222228, 0.17222222222222228,
+    0.17222222222222228, 0.17222222222222228, 0.17222222222222228, 0.17222222222222228,
+    0.24444444444444446, 0.2525308397081163, 0.4833333333333333, 0.4833333333333333,
+    0.4833333333333333, 0.4833333333333333, 0.4833333333333333, 0.4833333333333333,
+    0.4833333333333333, 0.4833333333333333, 0.4833333333333333, 0.4833333333333333,
+    0.4833333333333333, 0.4833333333333333, 0.4627777947319879, 0.47895062764485674,
+    0.4951234605577257, 0.5112962934705947, 0.5274691263834635, 0.5436419592963324,
+    0.5598147922092014, 0.5759876251220704, 0.5921604580349392, 0.6083332909478081,
+    0.624506123860677, 0.640678956773546, 0.6568517684936523, 0.6730246014065213,
+    0.6891974343193902, 0.705370267232259, 0.721543100145128, 0.737715933057997,
+    0.7538887659708658, 0.7700615988837348, 0.7862344317966037, 0.8024072647094727,
+    0.8185800976223416, 0.8347529411315918, 0.850925784640842, 0.8670986281500922,
+    0.8832714716593424, 0.8994443151685927, 0.9156171639760335, 0.9317900021870931,
+    0.9479628403981527, 0.964135675960117, 0.9722222222222222, 0.24444444444444446,
+    0.24444444444444446, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.0888888888888889, 0.0888888888888889, 0.0888888888888889, 0.0888888888888889,
+    0.0888888888888889, 0.0888888888888889, 0.0888888888888889, 0.1166666666666667,
+    0.1166666666666667, 0.11111111111111116, 0.11111111111111116, 0.11111111111111116,
+    0.11111111111111116, 0.11111111111111116, 0.11111111111111116, 0.11111111111111116,
+    0.1166666666666667, 0.12222222222222223, 0.12222222222222223, 0.12222222222222223,
+    0.12777777777777777, 0.1333333333333333, 0.13888888888888884, 0.15555555555555556,
+    0.18888888888888888, 0.23888888888888893, 0.3222222222222222, 0.3833333333333333,
+    0.4111111111111111, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9333333333333333,
+    0.9388888888888889, 0.9388888888888889, 0.9388888888888889, 0.9388888888888889,
+    0.9388888888888889, 0.9388888888888889, 0.9388888888888889, 0.9388888888888889,
+    0.9388888888888889, 0.9638888888888889, 0.9222222222222223, 0.9166666666666666,
+    0.9166666666666666, 0.9166666666666666, 0.9055555555555556, 0.9, 0.8944444444444445,
+    0.8833333333333333, 0.07499999999999996, 0.17222222222222228, 0.19444444444444442,
+    0.3555555555555555, 0.3555555555555555, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.21666666666666667, 0.21666666666666667, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.7666666666666666, 0.8611111111111112, 0.8611111111111112, 0.8611111111111112,
+    0.8611111111111112, 0.09999999999999998, 0.5, 0.8777777777777778, 0.8555555555555556,
+    0.5, 0.1527777777777778, 0.18333333333333335, 0.5, 0.9805555555555555,
+    0.05277777777777781, 0.5333333333333333, 0.9361111111111111, 0.4980003237724304, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5432180762290955, 0.5, 0.5, 0.5, 0.5, 0.5, 1, 1, 1, 1, 1, 1,
+    5939133, 0.03999980539083481, 0.5, 0.37999987602233887, 0.5, 0.6840001344680786, 0,
+  }},
+  // Davida
+  {{
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.8777777777777778, 0.05555555555555558, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.7944444444444445,
+    0.4555555555555556, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.05833333333333335,
+    0.07222222222222219, 0.09444444444444444, 0.10555555555555551, 0.13888888888888884,
+    0.16666666666666663, 0.19999999999999996, 0.2222222222222222, 0.3222222222222222,
+    0.7444444444444445, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.5166666666666666, 0.7277777777777779, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.9333333333333333, 0.6722222222222223, 0.4555555555555556,
+    0.5722222222222222, 0.4222222222222223, 0.5944444444444444, 0.38888888888888884,
+    0.6166666666666667, 0.37777777777777777, 0.6333333333333333, 0.3666666666666667,
+    0.6388888888888888, 0.35, 0.6555555555555556, 0.33819444444444446,
+    0.6743055555555556, 0.31319444444444444, 0.6993055555555555, 0.2944444444444444,
+    0.7111111111111111, 0.2833333333333333, 0.7208333333333333, 0.27083333333333337,
+    0.7333333333333333, 0.25555555555555554, 0.75, 0.24444444444444446,
+    0.7611111111111111, 0.23888888888888893, 0.7611111111111111, 0.23333333333333328,
+    0.7777777777777778, 0.21111111111111114, 0.7944444444444444, 0.20138888888888884,
+    0.8069444444444445, 0.18888888888888888, 0.8166666666666667, 0.1777777777777778,
+    0.8263888888888888, 0.16527777777777775, 0.8388888888888889, 0.15555555555555556,
+    0.85, 0.15000000000000002, 0.85, 0.15000000000000002, 0.85, 0.15000000000000002,
+    0.85, 0.15000000000000002, 0.85, 0.15000000000000002, 0.85, 0.15000000000000002,
+    0.85, 0.15000000000000002, 0.85, 0.1527777777777778, 0.8444444444444444,
+    0.1611111111111111, 0.8333333333333334, 0.17222222222222228, 0.8222222222222222,
+    0.18888888888888888, 0.8, 0.20833333333333337, 0.7833333333333333,
+    0.22083333333333333, 0.7708333333333334, 0.23333333333333328, 0.7625,
+    0.24583333333333335, 0.75, 0.25555555555555554, 0.7388888888888889,
+    0.2694444444444445, 0.7222222222222222, 0.2861111111111111, 0.7055555555555556,
+    0.30000000000000004, 0.6888888888888889, 0.31666666666666665, 0.6805555555555556,
+    0.3222222222222222, 0.6694444444444444, 0.3388888888888889, 0.6597222222222222,
+    0.34305555555555556, 0.6555555555555556, 0.3472222222222222, 0.65,
+    0.35277777777777775, 0.6416666666666667, 0.36111111111111116, 0.6361111111111111,
+    0.3666666666666667, 0.6333333333333333, 0.3666666666666667, 0.6333333333333333,
+    0.3666666666666667, 0.6333333333333333, 0.3666666666666667, 0.6333333333333333,
+    0.3666666666666667, 0.6333333333333333, 0.3666666666666667, 0.6333333333333333,
+    0.3666666666666667, 0.6388888888888888, 0.3555555555555555, 0.65, 0.3388888888888889,
+    0.6666666666666666, 0.3222222222222222, 0.6888888888888889, 0.30000000000000004,
+    0.7055555555555556, 0.28888888888888886, 0.7166666666666667, 0.2777777777777778,
+    0.7222222222222222, 0.2777777777777778, 0.7222222222222222, 0.2777777777777778,
+    0.7166666666666667, 0.2861111111111111, 0.7111111111111111, 0.2944444444444444, 0.7,
+    0.3111111111111111, 0.6777777777777778, 0.3277777777777777, 0.6611111111111111,
+    0.34444444444444444, 0.65, 0.5555555555555556, 0.4444444444444444,
+    0.5555555555555556, 0.4444444444444444, 0.5555555555555556, 0.4444444444444444,
+    0.5555555555555556, 0.4444444444444444, 0.5444444444444444, 0.17222222222222228,
+    0.825, 0.1777777777777778, 0.8138888888888889, 0.19444444444444442, 0.8,
+    0.2055555555555556, 0.7888888888888889, 0.21944444444444444, 0.7722222222222223,
+    0.23333333333333328, 0.7611111111111111, 0.23888888888888893, 0.7611111111111111,
+    0.23888888888888893, 0.7611111111111111, 0.2416666666666667, 0.7555555555555555,
+    0.24444444444444446, 0.7555555555555555, 0.24444444444444446, 0.7555555555555555,
+    0.24444444444444446, 0.7555555555555555, 0.24444444444444446, 0.7555555555555555,
+    0.24444444444444446, 0.7555555555555555, 0.24444444444444446, 0.7583333333333333,
+    0.23888888888888893, 0.7638888888888888, 0.23333333333333328, 0.7666666666666667,
+    0.23333333333333328, 0.7685184902615018, 0.22777777777777775, 0.7759259541829427,
+    0.22037031385633676, 0.7833334181043837, 0.21296284993489578, 0.7888888888888889,
+    0.21055552164713542, 0.7905555725097656, 0.20833333333333337, 0.7927777608235677,
+    0.2061111450195312, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.2055555555555556, 0.7944444444444444, 0.2055555555555556, 0.7944444444444444,
+    0.20416666666666672, 0.7986111111111112, 0.19861111111111107, 0.8041666666666667,
+    0.19444444444444442, 0.3222222222222222, 0.6777777777777778, 0.30000000000000004,
+    0.0805555555555556, 0.21111111111111114, 0.7888888888888889, 0.21111111111111114,
+    0.7888888888888889, 0.21111111111111114, 0.7888888888888889, 0.2222222222222222,
+    0.0888888888888889, 0.9111111111111111, 0.0888888888888889, 0.9111111111111111,
+    0.0888888888888889, 0.9111111111111111, 0.0888888888888889, 0.9111111111111111,
+    0.7388888888888889, 0.2666666666666667, 0.7333333333333333, 0.2666666666666667,
+    0.7333333333333333, 0.2777777777777778, 0.7222222222222222, 0.2777777777777778,
+    0.7055555555555556, 0.2944444444444444, 0.7055555555555556, 0.5611111111111111,
+    0.12777777777777777, 0.8666666666666667, 0.1444444444444445, 0.8444444444444444,
+    0.17222222222222228, 0.8, 0.23333333333333328, 0.7166666666666667, 0.5, 0.5, 0.5,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.27521803975105286, 0.12800000607967377, 0.0, 0.0,
+    0.0, 0.07599999755620956, 0, 1, 0, 0, 0, 1, 0, 0.5, 0.5, 0.5, 0.5,
+    0.5599995851516724, 0,
+  }},
+  // Doris
+  {{
+    0.17795059878468114, 0.19231400403212168, 0.18992951321549176, 0.19486495875404253,
+    0.18595510386322972, 0.1824043031089711, 0.19343955037465652, 0.19233148791803809,
+    0.1797240906769715, 0.1981539407531773, 0.22837705198722263, 0.03113792987593695,
+    0.6679819280246856, 0.6921826136989119, 0.6119395269255602, 0.5894585300861199,
+    0.6021983037868619, 0.4995601428404222, 0.49504674414477146, 0.49580496907726973,
+    0.40075837957016325, 0.3189186629849062, 0.30835703431355904, 0.3235374228554906,
+    0.5348664614553034, 0.544215997080161, 0.029924504745422936, 0.04243297315047673,
+    0.048359419326949225, 0.00725588685945352, 0.005053334096007025,
+    0.007451855614556004, 0.022262566341968108, 0.01741482244258421,
+    0.0019036452029270812, 0.0, 0.02694468887468952, 0.07559705704714284,
+    0.010453559897127214, 0.027086294818889047, 0.043205618566567634,
+    0.12958272465181672, 0.07525766374284708, 0.09210079525853529, 0.10396596025218173,
+    0.025032851270463383, 0.0634796747677971, 0.14973900625353131, 0.11980511187257606,
+    0.07272856708304858, 0.057119188963058024, 0.15220334126990503, 0.055688607297967145,
+    0.06564937801400927, 0.0443039468033275, 0.07297390424391277, 0.04597915681233085,
+    0.039743458237579174, 0.0, 0.6250370937724371, 0.5009855007407988,
+    0.4193907754616062, 0.4446606735436659, 0.43187438612858015, 0.3871772210857982,
+    0.35438334692810936, 0.3107836042244331, 0.41100449582066106, 0.30976277159610566,
+    0.2547324453922394, 0.22116009464275194, 0.22761298714586095, 0.2388557974968427,
+    0.14007359287313015, 0.1528653742492536, 0.20229823470118158, 0.15602446876069873,
+    0.11710155772267823, 0.1172332793441663, 0.14279962449270012, 0.07911776560784749,
+    0.06603424558018063, 0.04067743223364105, 0.05587535184345184, 0.022757047790175733,
+    0.022700587393164308, 0.014154871286891435, 0.018504664761716038,
+    0.028214202094275286, 0.6121204299429989, 0.6147953884131027, 0.5347263137018329,
+    0.5198489333823882, 0.4973011749310888, 0.49786956587169856, 0.415685437497874,
+    0.009630307790579423, 0.06675833716700455, 0.17611711285658588, 0.06527227071350124,
+    0.015443160572692332, 0.12307971511351337, 0.030553494900759738,
+    0.013121884484384092, 0.024676610692944016, 0.02145787492037758, 0.08224322356298266,
+    0.03221044346207663, 0.027032778746340393, 0.07618288281968842, 0.07368735944224314,
+    0.14901962601816823, 0.163677077355068, 0.07134988707395516, 0.09022068322034446,
+    0.0896359909121071, 0.204784827174989, 0.1130075694258842, 0.14438632162352502,
+    0.13109017852596347, 0.028135277872426277, 0.08487247532509788, 0.024894454111422687,
+    0.23411908608761622, 0.006273192109701307, 0.08914894902950131, 0.05198499427260753,
+    0.1049283008139951, 0.14397316716377478, 0.008726812546112923, 0.021080410134613058,
+    0.14162293028704875, 0.07444929386569354, 0.06723105004487283, 0.03132645723190698,
+    0.07222222222222219, 0.09212632053336228, 0.10421359688038245, 0.11964038827580936,
+    0.14222243829368642, 0.1639442858601311, 0.1588460948243986, 0.1656121339953388,
+    0.19526066198118397, 0.21733371297602144, 0.23026455992690348, 0.23636770344317276,
+    0.250560670959694, 0.29148296589381967, 0.28156769260020764, 0.31733988309154637,
+    0.3406357446214747, 0.37672325218981284, 0.36262006577758216, 0.378370626005591,
+    0.4962614684860281, 0.8007814593785579, 0.6926444184659742, 0.7281422533136421,
+    0.5052807087710323, 0.49937436908525307, 0.5226085039045409, 0.4802424489313868,
+    0.4837005996907232, 0.5647838456876575, 0.5389614264297347, 0.4676446206359867,
+    0.50116668560872, 0.47674574628736105, 0.4627636030447735, 0.5401402378762782,
+    0.5184939940541528, 0.41136748599224093, 0.5258242897348319, 0.5487582498329875,
+    0.47129775438270416, 0.4736538026227267, 0.4834220630579451, 0.5321791128829761,
+    0.45821704085027304, 0.49210089468299956, 0.49391630377092116, 0.45331069053335193,
+    0.4897181996225738, 0.4961500828131873, 0.522405702129258, 0.5480920767664987,
+    0.4558526461188802, 0.5220040601673439, 0.45596783615739145, 0.4676891054434746,
+    0.481204642457237, 0.48844691575652965, 0.48024471552092896, 0.48708353638409735,
+    0.5074716625119654, 0.4429084771665156, 0.39655453204033775, 0.3517685454527248,
+    0.3023340635049942, 0.2651059506536603, 0.3278161960170731, 0.36846496056686756,
+    0.28557873103466286, 0.31005206830602505, 0.24112420426116, 0.24220951844838856,
+    0.2087726714606627, 0.16184143670555778, 0.4389034203185467, 0.5049980295522264,
+    0.4226206557084948, 0.4101627502931698, 0.3489955371196079, 0.268932182463467,
+    0.3124371131495316, 0.3287900678346405, 0.2896329899709758, 0.18833608184048617,
+    0.18799903884014607, 0.1687975639593136, 0.4731965046063435, 0.521977849257017,
+    0.5163476034669696, 0.48676169892240617, 0.5408943823866408, 0.4546405041639305,
+    0.4532384211312471, 0.5029582805440508, 0.48958570156272013, 0.48606016287080966,
+    0.4917475086905813, 0.477414210746762, 0.5292074512734868, 0.5391373408845478,
+    0.4886568841538301, 0.4779333257125454, 0.5127619813037684, 0.44607916830174904,
+    0.4943753152020684, 0.4965471757272576, 0.5127750959960281, 0.5233277587804495,
+    0.5824974846515133, 0.5612253357768872, 0.5474824853152629, 0.5730922887084934,
+    0.5547608412528887, 0.5286671645850088, 0.541447749585172, 0.5114786134821049,
+    0.5245153387993249, 0.529342858388361, 0.433729558757376, 0.5672087225677551,
+    0.4942732517628132, 0.468681793202526, 0.5403362513034189, 0.5595524249403956,
+    0.49783693238274296, 0.5566869460991719, 0.40692380590584026, 0.5264639440844476,
+    0.5669991433112752, 0.4205327202331776, 0.5090170887241531, 0.42795719567132084,
+    0.5002652080776545, 0.5471746884147326, 0.39838149709103576, 0.4997145588296308,
+    0.5056773931513848, 0.49632249403067746, 0.4964166729267767, 0.4960776654786028,
+    0.2566002952011754, 0.2908583804298931, 0.3070402383743044, 0.29840291714902756,
+    0.3387349075256169, 0.3545629157304372, 0.375312791560296, 0.3120228536386508,
+    0.4149671814221022, 0.3856513414975791, 0.41586890418227196, 0.43226161702574956,
+    0.4546432970549309, 0.474895137047597, 0.41144277133779533, 0.48266783656863577,
+    0.4812421610411429, 0.5012744793970267, 0.4787863269179413, 0.5023702480926907,
+    0.5351157367451728, 0.5963756943825763, 0.5807173850204533, 0.5732833674956825,
+    0.5887459307321239, 0.6139462398188712, 0.6405178935207405, 0.5795069932450331,
+    0.6044484225510193, 0.6239335950108834, 0.6926831616713282, 0.5059010547789323,
+    0.5201501550608797, 0.5249259259044632, 0.49101741036880264, 0.5508534377149161,
+    0.5016308305865921, 0.45472268466147664, 0.4906853341905478, 0.4767583158189903,
+    0.4208991319845226, 0.4460422813655604, 0.5389436071803311, 0.42916608055127947,
+    0.5153173457382861, 0.4753700462187111, 0.46455356842385426, 0.48099781279767256,
+    0.5449349233116407, 0.4892161210486283, 0.5252711924018046, 0.5008505250104431,
+    0.46781710991836356, 0.5070654555661728, 0.4802886357135482, 0.4788822474386583,
+    0.4854024716481309, 0.5544785377539979, 0.4527392802941542, 0.5848635690848978,
+    0.4884727384331287, 0.5490581389590782, 0.442603555683645, 0.5602374173298192,
+    0.5140498096701007, 0.5750617512223783, 0.47086017770673644, 0.4206713543188424,
+    0.5557099314798329, 0.42887656740940927, 0.5163925066433255, 0.5422349480646701,
+    0.5547932112432185, 0.47147862356354847, 0.5392949262890844, 0.47027944935183935,
+    0.4446021850549127, 0.4731724942563013, 0.5224080345153628, 0.45474394018203873,
+    0.4252448727637139, 0.5132468279603771, 0.48112423027950235, 0.5825233899015916,
+    0.5265802611824186, 0.4942187716970136, 0.4903148843498734, 0.4974545569633666,
+    0.5372329767614776, 0.5489016598682485, 0.5561378262004294, 0.5839267341804087,
+    0.412698569461356, 0.5311165042556252, 0.5805698809189256, 0.49390050961731247,
+    0.48692413774155846, 0.4551033003136937, 0.5503830476724992, 0.42076121137495764,
+    0.5582869848401307, 0.49044479686552567, 0.4801392321640208, 0.4838111174447639,
+    0.47588707137045777, 0.4329442708578731, 0.4900020737001835, 0.49341943892353646,
+    0.4377206530990228, 0.4312522770079011, 0.47628171868589353, 0.3113260053589098,
+    0.404356919123889, 0.42795953949322924, 0.5341204882610717, 0.44637012167533985,
+    0.5277314597340216, 0.46582778858784424, 0.48437039240635227, 0.5433738273989986,
+    0.47053855757878693, 0.4609111166880668, 0.5524300139646583, 0.5319037232720354,
+    0.5210919600470585, 0.41535074474124895, 0.5175050547614204, 0.42490239687835846,
+    0.40921977418629757, 0.5168552675684526, 0.2146291714437249, 0.19789079012305943,
+    0.3047729152576962, 0.2882683959035248, 0.30199773063076457, 0.3731104005571694,
+    0.39694728554231856, 0.4215655808098932, 0.4245369486370611, 0.48133708757554555,
+    0.5769344813892817, 0.5611803295239424, 0.4619546065539729, 0.4798205567594701,
+    0.5174151759940115, 0.5421121691902805, 0.5334101407382256, 0.6986026880308577,
+    0.5163258554090568, 0.5646811301041699, 0.5689384995902265, 0.5465049630606549,
+    0.4623781789761793, 0.7039328422703388, 0.649791692571005, 0.5757454784114354,
+    0.5034054717863893, 0.0859716218158747, 0.21890254298624978, 0.2886296159016975,
+    0.2774780729472138, 0.3083352153743731, 0.3397171783408564, 0.3348445271951992,
+    0.3061133613591199, 0.29825721081720885, 0.33221079971985884, 0.38114120384263783,
+    0.5208120556290419, 0.3359997570514679, 0.7919999957084656, 0.7260000705718994,
+    0.6460000276565552, 0.6859999895095825, 1.0, 0.37121790647506714, 0.0, 0.0, 0.0, 0.0,
+    1.0, 1, 0, 0, 0, 0, 1, 1979711, 0.5, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+  // Eugenia
+  {{
+    0.2222222222222222, 0.21111111111111114, 0.19999999999999996, 0.19444444444444442,
+    0.18888888888888888, 0.18333333333333335, 0.09999999999999998, 0.09999999999999998,
+    0.09999999999999998, 0.11111111111111116, 0.12638888888888888, 0.15694444444444444,
+    0.17222222222222228, 0.1972222222222222, 0.2222222222222222, 0.23611111111111116,
+    0.26388888888888884, 0.29166666666666663, 0.3055555555555556, 0.3305555555555556,
+    0.3555555555555555, 0.37222222222222223, 0.40555555555555556, 0.4222222222222223,
+    0.43425924513075087, 0.45833333333333337, 0.48240742153591576, 0.49444444444444446,
+    0.5138888888888888, 0.5527777777777778, 0.5722222222222222, 0.5902777777777778,
+    0.6263888888888889, 0.6444444444444444, 0.6592592663235135, 0.6888888888888889,
+    0.7185185114542643, 0.7333333333333334, 0.7666666666666666, 0.7833333333333333, 0.8,
+    0.8333333333333334, 0.85, 0.8611111111111112, 0.8444444444444444, 0.8166666666666667,
+    0.7777777777777778, 0.7444444444444445, 0.7111111111111111, 0.6777777777777778,
+    0.6555555555555556, 0.6444444444444444, 0.6333333333333333, 0.6166666666666667,
+    0.6111111111111112, 0.6055555555555556, 0.6055555555555556, 0.6055555555555556,
+    0.6055555555555556, 0.6083333333333334, 0.6138888888888889, 0.6194444444444445,
+    0.625, 0.6305555555555555, 0.6333333333333333, 0.6370370229085287, 0.644444465637207,
+    0.6518518659803603, 0.6555555555555556, 0.6611111111111111, 0.6722222222222223,
+    0.6777777777777778, 0.6861111111111111, 0.6944444444444444, 0.7055555555555555,
+    0.7166666666666667, 0.7222222222222222, 0.7277777777777779, 0.7277777777777779,
+    0.7277777777777779, 0.7277777777777779, 0.7111111111111111, 0.6916666666666667,
+    0.6722222222222223, 0.65, 0.6055555555555556, 0.5444444444444445, 0.5194444444444444,
+    0.49444444444444446, 0.4388888888888889, 0.41666666666666663, 0.3944444444444445,
+    0.36111111111111116, 0.34444444444444444, 0.3277777777777777, 0.3194444444444444,
+    0.3111111111111111, 0.3055555555555556, 0.2972222222222223, 0.28888888888888886,
+    0.2861111111111111, 0.2833333333333333, 0.2833333333333333, 0.2833333333333333,
+    0.2833333333333333, 0.2833333333333333, 0.2833333333333333, 0.2833333333333333,
+    0.2833333333333333, 0.2833333333333333, 0.2944444444444444, 0.2972222222222223,
+    0.30000000000000004, 0.3055555555555556, 0.3055555555555556, 0.3055555555555556,
+    0.30000000000000004, 0.2944444444444444, 0.2944444444444444, 0.28888888888888886,
+    0.28888888888888886, 0.28888888888888886, 0.28888888888888886, 0.28888888888888886,
+    0.28888888888888886, 0.28888888888888886, 0.2833333333333333, 0.27222222222222225,
+    0.2666666666666667, 0.26111111111111107, 0.25, 0.22777777777777775,
+    0.21666666666666667, 0.11111111111111116, 0.1444444444444445, 0.6055555555555556,
+    0.6333333333333333, 0.65, 0.6888888888888889, 0.7333333333333334, 0.7555555555555555,
+    0.22777777777777775, 0.28888888888888886, 0.41666666666666663, 0.19444444444444442,
+    0.19444444444444442, 0.1972222222222222, 0.19999999999999996, 0.21111111111111114,
+    0.23333333333333328, 0.24444444444444446, 0.25555555555555554, 0.2777777777777778,
+    0.28888888888888886, 0.29611112806532114, 0.3105555640326606, 0.32499999999999996,
+    0.3394444359673394, 0.3538888719346788, 0.36111111111111116, 0.36944444444444446,
+    0.38611111111111107, 0.4027777777777778, 0.4194444444444444, 0.4361111111111111,
+    0.4444444444444444, 0.45138888888888884, 0.4652777777777778, 0.47916666666666663,
+    0.4930555555555556, 0.5069444444444444, 0.5208333333333333, 0.5277777777777778,
+    0.5337963104248047, 0.5458333333333334, 0.557870356241862, 0.5699073791503906,
+    0.5819444020589193, 0.593981424967448, 0.6, 0.606481467352973, 0.6194444444444445,
+    0.6324074215359158, 0.6388888888888888, 0.6416666666666666, 0.6472222222222221,
+    0.6527777777777778, 0.6555555555555556, 0.6555555555555556, 0.6555555555555556,
+    0.6333333333333333, 0.5666666666666667, 0.5333333333333333, 0.4722222222222222,
+    0.40555555555555556, 0.34444444444444444, 0.3111111111111111, 0.2666666666666667,
+    0.2666666666666667, 0.2666666666666667, 0.2666666666666667, 0.27222222222222225,
+    0.2833333333333333, 0.2944444444444444, 0.3055555555555556, 0.3111111111111111,
+    0.32013888888888886, 0.33819444444444446, 0.35624999999999996, 0.37430555555555556,
+    0.3833333333333333, 0.39351853264702696, 0.41388888888888886, 0.43425924513075087,
+    0.4444444444444444, 0.45833333333333337, 0.48611111111111116, 0.5138888888888888,
+    0.5277777777777778, 0.5398148006863064, 0.5638888888888889, 0.5879629770914714, 0.6,
+    0.6125, 0.6375, 0.65, 0.6625, 0.6875, 0.7, 0.7194444444444444, 0.7388888888888889,
+    0.75, 0.4666666666666667, 0.37222222222222223, 0.34444444444444444,
+    0.32499999999999996, 0.3055555555555556, 0.3027777777777778, 0.2972222222222223,
+    0.2944444444444444, 0.2944444444444444, 0.2944444444444444, 0.2944444444444444,
+    0.2944444444444444, 0.2944444444444444, 0.2944444444444444, 0.2944444444444444,
+    0.2944444444444444, 0.2944444444444444, 0.2944444444444444, 0.2981481340196398,
+    0.3055555555555556, 0.31296297709147136, 0.31666666666666665, 0.3222222222222222,
+    0.33333333333333337, 0.3388888888888889, 0.34444444444444444, 0.35,
+    0.36111111111111116, 0.37222222222222223, 0.23888888888888893, 0.24097222222222225,
+    0.2451388888888889, 0.24930555555555556, 0.2534722222222222, 0.25555555555555554,
+    0.2569444444444444, 0.2597222222222222, 0.26111111111111107, 0.6166666666666667,
+    0.6166666666666667, 0.6166666666666667, 0.6166666666666667, 0.6180555555555556,
+    0.6208333333333333, 0.6222222222222222, 0.6244444529215495, 0.628888914320204,
+    0.6333333757188585, 0.637777837117513, 0.6422222985161675, 0.6444444444444444,
+    0.647685178120931, 0.6541666666666667, 0.6606481552124024, 0.667129643758138,
+    0.6736111323038737, 0.6800926208496094, 0.6833333333333333, 0.6868055555555556,
+    0.69375, 0.7006944444444445, 0.7076388888888889, 0.7145833333333333,
+    0.7215277777777778, 0.7284722222222222, 0.7354166666666666, 0.7388888888888889,
+    0.7423611111111111, 0.7493055555555556, 0.75625, 0.7631944444444445,
+    0.7701388888888889, 0.7770833333333333, 0.7840277777777778, 0.7909722222222222,
+    0.7944444444444445, 0.7984127044677735, 0.8063492033216688, 0.8142857021755643,
+    0.8222222010294596, 0.830158699883355, 0.8380952093336318, 0.8460317187839084, 0.85,
+    0.8538888931274414, 0.8616666687859429, 0.8694444444444445, 0.8772222201029459,
+    0.8849999957614475, 0.8888888888888888, 0.8916666666666666, 0.8972222222222223,
+    0.9027777777777778, 0.9083333333333333, 0.9111111111111111, 0.9120370388031006,
+    0.9138888888888889, 0.9157407389746772, 0.9166666666666666, 0.9166666666666666,
+    0.9166666666666666, 0.9166666666666666, 0.9111111111111111, 0.9055555555555556,
+    0.8777777777777778, 0.8611111111111112, 0.8444444444444444, 0.8222222222222222, 0.8,
+    0.7611111111111111, 0.7333333333333334, 0.7111111111111111, 0.7069444444444444,
+    0.6986111111111111, 0.6902777777777778, 0.6819444444444445, 0.6777777777777778,
+    0.6743055555555555, 0.6673611111111111, 0.6604166666666667, 0.6534722222222222, 0.65,
+    0.6490740670098198, 0.6472222222222221, 0.6453703774346246, 0.6444444444444444,
+    0.6430555555555555, 0.6402777777777777, 0.6388888888888888, 0.6347222222222222,
+    0.6263888888888889, 0.6222222222222222, 0.6194444444444445, 0.6166666666666667,
+    0.5888888888888889, 0.5722222222222222, 0.5555555555555556, 0.5111111111111111,
+    0.48611111111111116, 0.4222222222222223, 0.3666666666666667, 0.31666666666666665,
+    0.2777777777777778, 0.25, 0.22777777777777775, 0.22777777777777775,
+    0.22777777777777775, 0.2305555555555555, 0.23611111111111116, 0.2416666666666667,
+    0.24444444444444446, 0.25555555555555554, 0.2666666666666667, 0.2777777777777778,
+    0.28888888888888886, 0.3055555555555556, 0.3222222222222222, 0.3291666666666667,
+    0.34305555555555556, 0.35, 0.3569444444444444, 0.37083333333333335,
+    0.37777777777777777, 0.3833333333333333, 0.38888888888888884, 0.3930555555555556,
+    0.40555555555555556, 0.40555555555555556, 0.40555555555555556, 0.40555555555555556,
+    0.40555555555555556, 0.40555555555555556, 0.40555555555555556, 0.3666666666666667,
+    0.3666666666666667, 0.3666666666666667, 0.3666666666666667, 0.3666666666666667,
+    0.8722222222222222, 0.8722222222222222, 0.8777777777777778, 0.8888888888888888,
+    0.8888888888888888, 0.8888888888888888, 0.8888888888888888, 0.2833333333333333,
+    0.2777777777777778, 0.275, 0.27222222222222225, 0.2666666666666667,
+    0.2666666666666667, 0.25555555555555554, 0.25, 0.24444444444444446,
+    0.23333333333333328, 0.2222222222222222, 0.21111111111111114, 0.2055555555555556,
+    0.19444444444444442, 0.18333333333333335, 0.4388888888888889, 0.7333333333333334,
+    0.44999999999999996, 0.44999999999999996, 0.8055555555555556, 0.7888888888888889,
+    0.7388888888888889, 0.7, 0.6722222222222223, 0.3222222222222222, 0.7222222222222222,
+    0.31666666666666665, 0.18000005185604098, 1.0, 1.0, 1.0, 1.0, 1.0,
+    0.27521803975105286, 0.0, 0.0, 0.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 12616462, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0,
+  }},
+  // Eunomia
+  {{
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.009722222222222188, 0.029166666666666674, 0.03888888888888886, 0.05277777777777781,
+    0.06666666666666665, 0.07499999999999996, 0.08333333333333337, 0.10277777777777775,
+    0.12222222222222223, 0.13611111111111107, 0.15000000000000002, 0.16388888888888886,
+    0.1777777777777778, 0.19166666666666665, 0.2055555555555556, 0.23333333333333328,
+    0.25, 0.27222222222222225, 0.2777777777777778, 0.3055555555555556,
+    0.31666666666666665, 0.33333333333333337, 0.3388888888888889, 0.3666666666666667,
+    0.38888888888888884, 0.4111111111111111, 0.4222222222222223, 0.43333333333333335,
+    0.4555555555555556, 0.46111111111111114, 0.4833333333333333, 0.5, 0.5222222222222221,
+    0.5388888888888889, 0.5444444444444445, 0.5555555555555556, 0.5833333333333333, 0.6,
+    0.6111111111111112, 0.6333333333333333, 0.65, 0.6666666666666667, 0.6888888888888889,
+    0.7277777777777779, 0.7666666666666666, 0.7833333333333333, 0.8, 0.8277777777777777,
+    0.8444444444444444, 0.8722222222222222, 0.8833333333333333, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.3916666666666667, 0.38888888888888884,
+    0.4666666666666667, 0.4666666666666667, 0.4666666666666667, 0.4666666666666667,
+    0.4666666666666667, 0.4666666666666667, 0.4666666666666667, 0.4666666666666667,
+    0.4666666666666667, 0.4666666666666667, 0.4666666666666667, 0.4666666666666667,
+    0.4666666666666667, 0.4666666666666667, 0.46597222222222223, 0.46458333333333335,
+    0.46319444444444446, 0.4618055555555556, 0.46111111111111114, 0.4600000169542101,
+    0.45777778625488286, 0.4555555555555556, 0.45333332485622835, 0.4511110941569011,
+    0.44999999999999996, 0.44999999999999996, 0.44999999999999996, 0.44999999999999996,
+    0.44999999999999996, 0.44999999999999996, 0.44999999999999996, 0.44999999999999996,
+    0.44999999999999996, 0.44999999999999996, 0.44999999999999996, 0.44999999999999996,
+    0.44999999999999996, 0.44999999999999996, 0.4483333163791232, 0.44499999152289493,
+    0.44166666666666665, 0.43833334181043837, 0.4350000169542101, 0.43333333333333335,
+    0.43333333333333335, 0.43333333333333335, 0.43333333333333335, 0.43333333333333335,
+    0.43333333333333335, 0.43333333333333335, 0.4326388888888889, 0.43125,
+    0.42986111111111114, 0.42847222222222225, 0.4277777777777778, 0.4268518659803603,
+    0.42500000000000004, 0.4231481340196398, 0.4222222222222223, 0.42037035624186203,
+    0.41666666666666663, 0.41296297709147134, 0.4111111111111111, 0.4111111111111111,
+    0.4111111111111111, 0.4111111111111111, 0.4111111111111111, 0.4111111111111111,
+    0.4111111111111111, 0.41666666666666663, 0.4222222222222223, 0.4305555555555556,
+    0.4388888888888889, 0.4472222222222222, 0.4555555555555556, 0.46111111111111114,
+    0.4666666666666667, 0.4675925784640842, 0.46944444444444444, 0.4712963104248047,
+    0.4722222222222222, 0.4722222222222222, 0.4722222222222222, 0.4722222222222222,
+    0.4722222222222222, 0.475, 0.4805555555555555, 0.4833333333333333,
+    0.4833333333333333, 0.4833333333333333, 0.4833333333333333, 0.4833333333333333,
+    0.4847222222222223, 0.48750000000000004, 0.48888888888888893, 0.48981480068630645,
+    0.4916666666666667, 0.49351853264702694, 0.49444444444444446, 0.6333333333333333,
+    0.65, 0.6611111111111111, 0.6652777777777779, 0.6736111111111112, 0.6819444444444445,
+    0.6902777777777778, 0.6944444444444444, 0.7083333333333333, 0.7222222222222222,
+    0.7291666666666667, 0.7430555555555556, 0.75, 0.7555555555555555, 0.7666666666666666,
+    0.7722222222222223, 0.775, 0.7777777777777778, 0.7833333333333333,
+    0.7888888888888889, 0.7888888888888889, 0.7888888888888889, 0.7888888888888889,
+    0.7888888888888889, 0.7888888888888889, 0.7888888888888889, 0.7888888888888889,
+    0.7888888888888889, 0.7888888888888889, 0.7888888888888889, 0.7888888888888889,
+    0.7888888888888889, 0.7888888888888889, 0.7888888888888889, 0.7888888888888889,
+    0.30000000000000004, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.7944444444444445, 0.8388888888888889,
+    0.8611111111111112, 0.8888888888888888, 0.8888888888888888, 0.8888888888888888, 0.5,
+    0.5, 0.5, 0.4833333333333333, 0.5111111111111111, 0.5222222222222221,
+    0.5222222222222221, 0.5166666666666666, 0.5111111111111111, 0.5, 0.5,
+    0.5194444444444444, 0.3920001983642578, 1.0, 1.0, 1.0, 1.0, 1.0, 0.27521803975105286,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 0, 0.5, 0.5, 0.18399998545646667,
+    0.4759998917579651, 0.7799996733665466, 0,
+  }},
+  // Euphrosyne
+  {{
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.01666666666666672, 0.033333333333333326, 0.07777777777777772,
+    0.12222222222222223, 0.15555555555555556, 0.2777777777777778, 0.37222222222222223,
+    0.49444444444444446, 0.5555555555555556, 0.6333333333333333, 0.7222222222222222,
+    0.95, 0.9722222222222222, 0.9777777777777777, 0.9944444444444445, 0.9972222222222222,
+    0.95, 0.8611111111111112, 0.8111111111111111, 0.7833333333333333, 0.7722222222222223,
+    0.7444444444444445, 0.7166666666666667, 0.7, 0.6777777777777778, 0.44999999999999996,
+    0.3222222222222222, 0.25, 0.1444444444444445, 0.06666666666666665, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.95, 0.5, 0.5, 0.5, 0.5, 0.5, 0.95, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.8222222222222222, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.8888888888888888, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.8666666666666667, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.4555555555555556, 0.4555555555555556,
+    0.4555555555555556, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.8333333333333334,
+    0.8222222222222222, 0.8166666666666667, 0.8166666666666667, 0.8166666666666667,
+    0.2944444444444444, 0.27222222222222225, 0.26111111111111107, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.3277777777777777, 0.4083333333333333,
+    0.21666666666666667, 0.18333333333333335, 0.25555555555555554, 0.35,
+    0.3277777777777777, 0.5, 0.38611111111111107, 0.38888888888888884,
+    0.2972222222222223, 0.41600024700164795, 1.0, 1.0, 1.0, 1.0, 1.0,
+    0.27521803975105286, 0.4760001003742218, 0.0, 0.6160000562667847, 0.0, 0.0, 0, 1, 0,
+    1, 0, 0, 9865003, 0.5, 0.5, 0.18399998545646667, 0.4759998917579651, 0.5, 0,
+  }},
+  // Europa
+  {{
+    0.8611111111111112, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.9333333333333333, 0.01666666666666672, 0.019444444444444486,
+    0.022222222222222254, 0.022222222222222254, 0.022222222222222254,
+    0.022222222222222254, 0.02777777777777779, 0.033333333333333326,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.03472222222222221, 0.03749999999999998, 0.03888888888888886, 0.04166666666666663,
+    0.0444444444444444, 0.0444444444444444, 0.0444444444444444, 0.047222222222222276,
+    0.050000000000000044, 0.05138888888888893, 0.054166666666666696, 0.05555555555555558,
+    0.05555555555555558, 0.05555555555555558, 0.061111111111111116, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06944444444444442, 0.07222222222222219,
+    0.07499999999999996, 0.07777777777777772, 0.07777777777777772, 0.07777777777777772,
+    0.07777777777777772, 0.08333333333333337, 0.08333333333333337, 0.08333333333333337,
+    0.0888888888888889, 0.09444444444444444, 0.09999999999999998, 0.10277777777777775,
+    0.10555555555555551, 0.11111111111111116, 0.11111111111111116, 0.11111111111111116,
+    0.11388888888888893, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.11111111111111116, 0.11111111111111116,
+    0.11111111111111116, 0.11111111111111116, 0.10555555555555551, 0.10555555555555551,
+    0.09999999999999998, 0.09999999999999998, 0.09999999999999998, 0.09999999999999998,
+    0.09444444444444444, 0.09166666666666667, 0.0888888888888889, 0.0888888888888889,
+    0.07777777777777772, 0.07222222222222219, 0.06944444444444442, 0.06666666666666665,
+    0.06666666666666665, 0.05555555555555558, 0.050000000000000044, 0.0444444444444444,
+    0.033333333333333326, 0.02777777777777779, 0.07777777777777772, 0.07777777777777772,
+    0.07777777777777772, 0.07777777777777772, 0.07777777777777772, 0.07777777777777772,
+    0.07777777777777772, 0.07777777777777772, 0.07777777777777772, 0.07777777777777772,
+    0.07777777777777772, 0.07777777777777772, 0.07777777777777772, 0.07777777777777772,
+    0.07777777777777772, 0.07777777777777772, 0.07777777777777772, 0.08333333333333337,
+    0.08333333333333337, 0.0888888888888889, 0.09444444444444444, 0.09999999999999998,
+    0.10555555555555551, 0.6111111111111112, 0.6111111111111112, 0.6111111111111112,
+    0.6166666666666667, 0.6194444444444445, 0.6222222222222222, 0.6333333333333333,
+    0.6333333333333333, 0.6361111111111111, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6370370229085287, 0.6333333333333333, 0.629629643758138, 0.6277777777777778,
+    0.6277777777777778, 0.6277777777777778, 0.6277777777777778, 0.6277777777777778,
+    0.6277777777777778, 0.6277777777777778, 0.6277777777777778, 0.6277777777777778,
+    0.6277777777777778, 0.6277777777777778, 0.6277777777777778, 0.6277777777777778,
+    0.6277777777777778, 0.6277777777777778, 0.6277777777777778, 0.6277777777777778,
+    0.6277777777777778, 0.6277777777777778, 0.6277777777777778, 0.6277777777777778,
+    0.6277777777777778, 0.6277777777777778, 0.6277777777777778, 0.6277777777777778,
+    0.6277777777777778, 0.6277777777777778, 0.6277777777777778, 0.6277777777777778,
+    0.6277777777777778, 0.6277777777777778, 0.6277777777777778, 0.6277777777777778,
+    0.6277777777777778, 0.6291666666666667, 0.6319444444444444, 0.6333333333333333,
+    0.6333333333333333, 0.6333333333333333, 0.6333333333333333, 0.6333333333333333,
+    0.6333333333333333, 0.6333333333333333, 0.6347222222222222, 0.6375,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6416666666666666,
+    0.6444444444444444, 0.65, 0.65, 0.65, 0.6527777777777778, 0.6555555555555556,
+    0.6611111111111111, 0.6638888888888889, 0.6694444444444445, 0.6722222222222223,
+    0.6722222222222223, 0.6722222222222223, 0.675, 0.6777777777777778,
+    0.6777777777777778, 0.7, 0.0805555555555556, 0.21111111111111114, 0.7888888888888889,
+    0.21111111111111114, 0.7888888888888889, 0.21111111111111114, 0.7888888888888889,
+    0.2222222222222222, 0.0888888888888889, 0.9111111111111111, 0.0888888888888889,
+    0.9111111111111111, 0.0888888888888889, 0.9111111111111111, 0.0888888888888889,
+    0.9111111111111111, 0.7388888888888889, 0.2666666666666667, 0.7333333333333333,
+    0.2666666666666667, 0.7333333333333333, 0.2777777777777778, 0.7222222222222222,
+    0.2777777777777778, 0.7055555555555556, 0.2944444444444444, 0.7055555555555556,
+    0.1166666666666667, 0.12777777777777777, 0.1333333333333333, 0.1444444444444445,
+    0.15555555555555556, 0.17222222222222228, 0.19999999999999996, 0.23333333333333328,
+    0.2833333333333333, 0.18333333333333335, 0.18888888888888888, 0.21666666666666667,
+    1.0, 0.8860000967979431, 0.7759999632835388, 0.7740001678466797, 0.8380001783370972,
+    0.6780002117156982, 0.3640000820159912, 0.0, 0.0, 0.0, 0.0, 0.3420000374317169, 1, 0,
+    0, 0, 0, 0, 0, 0.5, 0.5, 0.5, 0.5, 0.5599995851516724, 0,
+  }},
+  // Hektor
+  {{
+    0.061111111111111116, 0.06466166178385413, 0.07176276312934027, 0.0788638644748264,
+    0.08596496582031254, 0.09306606716579857, 0.10016716851128471, 0.10726826985677085,
+    0.11436937120225699, 0.12147047254774301, 0.12857157389322915, 0.1356726752387153,
+    0.14277377658420143, 0.14987487792968746, 0.1569759792751736, 0.16407708062065973,
+    0.17117818196614587, 0.1782792833116319, 0.18538038465711804, 0.19248148600260417,
+    0.1995825873480903, 0.20668368869357634, 0.21378479003906248, 0.22088589138454862,
+    0.22798699273003475, 0.23508809407552078, 0.24218919542100692, 0.24929029676649306,
+    0.2563913981119792, 0.2634924994574652, 0.27059360080295136, 0.2776947021484375,
+    0.28479580349392364, 0.2918969048394098, 0.2989980061848958, 0.30609910753038194,
+    0.3132002088758681, 0.3203013102213542, 0.32740241156684025, 0.3345035129123264,
+    0.3416046142578125, 0.34870571560329866, 0.3558068169487847, 0.3629079182942708,
+    0.37000901963975696, 0.3771101209852431, 0.38421122233072913, 0.39131232367621527,
+    0.3984134250217014, 0.40551452636718754, 0.41261562771267357, 0.4197167290581597,
+    0.42681783040364585, 0.433918931749132, 0.441020033094618, 0.44812113444010415,
+    0.4552222357855903, 0.46232333713107643, 0.46942443847656246, 0.4765255398220486,
+    0.48362664116753473, 0.49072774251302087, 0.4978288438585069, 0.504929945203993,
+    0.5120310465494792, 0.5191321478949653, 0.5262332492404513, 0.5333343505859375,
+    0.5404354519314236, 0.5475365532769096, 0.5546376546223959, 0.5617387559678819,
+    0.5688398573133681, 0.5759409586588542, 0.5830420600043402, 0.5901431613498264,
+    0.5972442626953125, 0.6043453640407986, 0.6114464653862848, 0.6185475667317708,
+    0.6256486680772569, 0.6327497694227431, 0.6398508707682291, 0.6469519721137154,
+    0.6540530522664387, 0.6611541324191623, 0.6682552125718859, 0.6753562927246094,
+    0.6824573728773329, 0.6895584530300565, 0.69665953318278, 0.7037606133355034,
+    0.710861693488227, 0.7179627736409505, 0.725063853793674, 0.7321649339463976,
+    0.7392660140991211, 0.7463670942518446, 0.7534681744045681, 0.7605692545572916,
+    0.7676703347100152, 0.7747714148627387, 0.7818724950154623, 0.7889735751681858,
+    0.7960746553209093, 0.8031757354736329, 0.8102768156263563, 0.8173778957790798,
+    0.8244789653354221, 0.8315800560845269, 0.8386811468336317, 0.8457822375827365,
+    0.8528833283318413, 0.8599844190809462, 0.867085509830051, 0.8741866005791559,
+    0.8812876913282607, 0.8883887820773655, 0.8954898728264703, 0.9025909635755751,
+    0.9096920543246799, 0.9167931450737847, 0.9238942305246989, 0.930995315975613,
+    0.9380964014265273, 0.9451974868774414, 0.9522985723283556, 0.9593996551301744,
+    0.9665007405810886, 0.9736018260320027, 0.9807029114829169, 0.9878039969338311,
+    0.994905083378156, 1.0, 1.0, 0.46111111111111114, 0.47777777777777786,
+    0.46111111111111114, 0.5388888888888889, 0.46111111111111114, 0.46111111111111114,
+    0.46111111111111114, 0.4638888888888889, 0.4666666666666667, 0.46944444444444444,
+    0.5277777777777778, 0.4722222222222222, 0.5277777777777778, 0.4722222222222222,
+    0.5277777777777778, 0.47777777777777775, 0.5222222222222223, 0.47777777777777775,
+    0.5222222222222223, 0.5222222222222223, 0.5222222222222223, 0.5222222222222223,
+    0.5222222222222223, 0.5222222222222223, 0.5222222222222223, 0.5222222222222223,
+    0.47777777777777775, 0.5222222222222223, 0.47777777777777775, 0.5222222222222223,
+    0.47777777777777775, 0.5222222222222223, 0.47777777777777775, 0.5222222222222223,
+    0.47777777777777775, 0.5222222222222223, 0.5222222222222223, 0.47777777777777775,
+    0.5222222222222223, 0.47777777777777775, 0.5222222222222223, 0.47777777777777775,
+    0.5222222222222223, 0.47777777777777775, 0.5222222222222223, 0.5222222222222223,
+    0.5222222222222223, 0.5222222222222223, 0.5222222222222223, 0.5222222222222223,
+    0.5222222222222223, 0.5222222222222223, 0.47777777777777775, 0.5222222222222223,
+    0.47777777777777775, 0.5222222222222223, 0.47777777777777775, 0.5222222222222223,
+    0.5222222222222223, 0.5222222222222223, 0.5222222222222223, 0.5222222222222223,
+    0.5222222222222223, 0.5222222222222223, 0.5222222222222223, 0.5222222222222223,
+    0.47777777777777775, 0.5222222222222223, 0.47777777777777775, 0.5222222222222223,
+    0.47777777777777775, 0.5222222222222223, 0.47777777777777775, 0.5222222222222223,
+    0.47777777777777775, 0.47777777777777775, 0.5222222222222223, 0.47777777777777775,
+    0.5222222222222223, 0.47777777777777775, 0.5222222222222223, 0.47777777777777775,
+    0.5222222222222223, 0.47777777777777775, 0.5222222222222223, 0.47777777777777775,
+    0.5222222222222223, 0.47777777777777775, 0.5222222222222223, 0.5222222222222223,
+    0.5222222222222223, 0.47777777777777775, 0.5222222222222223, 0.47777777777777775,
+    0.5222222222222223, 0.47777777777777775, 0.5222222222222223, 0.47777777777777775,
+    0.5222222222222223, 0.47777777777777775, 0.5222222222222223, 0.47777777777777775,
+    0.5222222222222223, 0.47777777777777775, 0.5222222222222223, 0.47777777777777775,
+    0.47777777777777775, 0.47777777777777775, 0.47777777777777775, 0.47777777777777775,
+    0.5222222222222223, 0.47777777777777775, 0.47777777777777775, 0.47777777777777775,
+    0.47777777777777775, 0.47777777777777775, 0.5222222222222223, 0.5222222222222223,
+    0.5222222222222223, 0.5222222222222223, 0.5222222222222223, 0.5222222222222223,
+    0.5222222222222223, 0.5222222222222223, 0.5222222222222223, 0.5222222222222223,
+    0.47777777777777775, 0.5222222222222223, 0.5222222222222223, 0.47777777777777775,
+    0.5222222222222223, 0.5222222222222223, 0.5222222222222223, 0.5222222222222223,
+    0.5222222222222223, 0.3277777777777777, 0.34444444444444444, 0.6277777777777778,
+    0.37777777777777777, 0.6222222222222222, 0.37777777777777777, 0.6222222222222222,
+    0.37777777777777777, 0.37777777777777777, 0.37222222222222223, 0.6277777777777778,
+    0.37222222222222223, 0.3666666666666667, 0.36111111111111116, 0.3555555555555556,
+    0.35, 0.6611111111111111, 0.33333333333333326, 0.31666666666666665,
+    0.6888888888888889, 0.30000000000000004, 0.7055555555555555, 0.7222222222222222,
+    0.7361111111111112, 0.75, 0.7638888888888888, 0.2222222222222222, 0.7888888888888889,
+    0.18888888888888888, 0.1777777777777778, 0.1611111111111111, 0.17222222222222228,
+    0.8, 0.21944444444444444, 0.7611111111111111, 0.2777777777777778, 0.6972222222222222,
+    0.6722222222222223, 0.3388888888888889, 0.6388888888888888, 0.3833333333333333,
+    0.6055555555555556, 0.5930555555555556, 0.5680555555555555, 0.4444444444444444,
+    0.5493055555555555, 0.5368055555555555, 0.5243055555555556, 0.4881944444444444,
+    0.49444444444444446, 0.5027777777777778, 0.5194444444444445, 0.4722222222222222,
+    0.4666666666666667, 0.5444444444444444, 0.44999999999999996, 0.5541666666666667,
+    0.5625, 0.5666666666666667, 0.5694444444444444, 0.42500000000000004,
+    0.5777777777777777, 0.41666666666666663, 0.4111111111111111, 0.5902777777777778,
+    0.40694444444444444, 0.5944444444444444, 0.5972222222222222, 0.6027777777777777,
+    0.3916666666666667, 0.6111111111111112, 0.6120370229085287, 0.6138888888888889,
+    0.6157407548692492, 0.3833333333333333, 0.3833333333333333, 0.3833333333333333,
+    0.3833333333333333, 0.3819444444444444, 0.37916666666666665, 0.6222222222222222,
+    0.37777777777777777, 0.37777777777777777, 0.37777777777777777, 0.37777777777777777,
+    0.37777777777777777, 0.37777777777777777, 0.38055555555555554, 0.6166666666666667,
+    0.38888888888888884, 0.6111111111111112, 0.3944444444444445, 0.5944444444444444,
+    0.4111111111111111, 0.41388888888888886, 0.41666666666666663, 0.4222222222222223,
+    0.5666666666666667, 0.5555555555555556, 0.5527777777777778, 0.55, 0.4555555555555556,
+    0.5388888888888889, 0.46944444444444444, 0.47777777777777775, 0.49444444444444446,
+    0.5055555555555555, 0.4833333333333334, 0.5388888888888889, 0.5527777777777778,
+    0.43333333333333335, 0.3944444444444444, 0.3833333333333333, 0.6111111111111112,
+    0.4027777777777778, 0.41666666666666674, 0.4388888888888889, 0.46111111111111114,
+    0.5, 0.5166666666666667, 0.5333333333333333, 0.5611111111111111, 0.5666666666666667,
+    0.4222222222222223, 0.5888888888888889, 0.4111111111111111, 0.5888888888888889,
+    0.4111111111111111, 0.5888888888888889, 0.4111111111111111, 0.5888888888888889,
+    0.4111111111111111, 0.41666666666666663, 0.4222222222222223, 0.4277777777777778,
+    0.7444444444444445, 0.75, 0.7277777777777779, 0.6944444444444444, 0.6333333333333333,
+    0.5555555555555556, 0.5055555555555555, 0.41666666666666663, 0.38888888888888884,
+    0.36111111111111116, 0.3111111111111111, 0.26111111111111107, 0.2222222222222222,
+    0.18888888888888888, 0.1777777777777778, 0.15555555555555556, 0.15000000000000002,
+    0.14722222222222225, 0.1444444444444445, 0.1444444444444445, 0.1444444444444445,
+    0.15555555555555556, 0.1777777777777778, 0.23333333333333328, 0.30000000000000004,
+    0.34444444444444444, 0.44999999999999996, 0.3944444444444445, 0.4833333333333333,
+    0.40555555555555556, 0.3111111111111111, 0.3111111111111111, 0.40555555555555556,
+    0.5111111111111111, 0.5222222222222221, 0.46944444444444444, 0.21666666666666667,
+    0.26111111111111107, 0.19166666666666665, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    0.27521803975105286, 0.4760001003742218, 0.0, 0.6160000562667847, 0.0, 0.0, 0, 1, 0,
+    1, 0, 0, 4060084, 0.2719998061656952, 0.6159999370574951, 0.0, 0.5, 0.5, 0,
+  }},
+  // Herculina
+  {{
+    0.0733890894869915, 0.14352005040209415, 0.20860313038321823, 0.26726760073780975,
+    0.3185827410260602, 0.36203110029895946, 0.3974547187743647, 0.4249944855618064,
+    0.44503698425529337, 0.4581746677385027, 0.4651768032371649, 0.46696274728993326,
+    0.46456741364545373, 0.45909183232046746, 0.4516385256593247, 0.44323959364018006,
+    0.43479158513894156, 0.4270125183596737, 0.4204316534244108, 0.4154131539457132,
+    0.41220404935233035, 0.4109890935467384, 0.41193333249458863, 0.415198192888304,
+    0.4209267546748553, 0.4292047927076688, 0.4400121211239377, 0.45318107143172703,
+    0.4683752795925523, 0.4850944052692179, 0.5027023794374141, 0.5204715259607517,
+    0.5376340800724917, 0.5534355766557408, 0.567188709739493, 0.5783284007108925,
+    0.5864669958220587, 0.5914433106527974, 0.5933537657507351, 0.5925522552471172,
+    0.5896104027449409, 0.5852408436118989, 0.5801988527787904, 0.5751860040663409,
+    0.570779028504677, 0.5673971605881092, 0.5653062058667058, 0.564644202010271,
+    0.5654479747518045, 0.5676643565528197, 0.571141685536214, 0.5756103443813125,
+    0.5806691301255031, 0.5857935717621024, 0.590373703798293, 0.5937767150634746,
+    0.5954200450450298, 0.5948370742543557, 0.5917214099519059, 0.5859444531421206,
+    0.577550232400768, 0.5667375189726827, 0.5538400049670933, 0.5393112133254392,
+    0.523714055503173, 0.5077086387392665, 0.4920288739242032, 0.47744028633905466,
+    0.4646779909016314, 0.45437286971244495, 0.4469819543756306, 0.44274212089141274,
+    0.44166225257146824, 0.4435586147650158, 0.4481247928100678, 0.4550162279094257,
+    0.4639246119665512, 0.4746210640636096, 0.4869576227931742, 0.5008300555811931,
+    0.5161164929617051, 0.5326124000588459, 0.5499817654649481, 0.5677383008797908,
+    0.5852614286552489, 0.601842629896069, 0.6167505665568283, 0.6292997678587664,
+    0.6389082930688397, 0.6451344424292782, 0.6476899597868546, 0.6464348608287943,
+    0.6413641888955898, 0.6325974934812038, 0.6203773202871586, 0.6050754412390474,
+    0.5871984703087928, 0.5673814159515824, 0.5463603512304669, 0.524922764679087,
+    0.5038430236303828, 0.48381676573375404, 0.4654091682906126, 0.44902761087947585,
+    0.43492135031495566, 0.4232028225920415, 0.41388005198289857, 0.4068887636782375,
+    0.4021156642979121, 0.39940922382702404, 0.3985792075591737, 0.3993898454883329,
+    0.4015534376288493, 0.404731459030745, 0.4085489337533804, 0.4126248188506432,
+    0.4166161835054987, 0.42026747775473866, 0.4234496806548278, 0.426170243624781,
+    0.42853647656824095, 0.4306642611113561, 0.43254009390830916, 0.43386361057981954,
+    0.43391348000662006, 0.43148494965448814, 0.4249377966509904, 0.4123692458411491,
+    0.3918933853153333, 0.36197660664423326, 0.32175810016544404, 0.2712826237225262,
+    0.21159078403428458, 0.14464464674132202, 0.07310395314570835, 0.5095311696721448,
+    0.5188779320455682, 0.5278044630502248, 0.5359716414307129, 0.5429625470905243,
+    0.5483288854699505, 0.5516456285426442, 0.5525623206627985, 0.550843741198874,
+    0.5463977914488434, 0.5392923727536902, 0.529764232140703, 0.5182211632406027,
+    0.5052357425711942, 0.49152588244207646, 0.47791673118792305, 0.4652808064327592,
+    0.45445835657251815, 0.4461662596330037, 0.4409091244936018, 0.4389086934766423,
+    0.44006610190851336, 0.44396622763394616, 0.44992560004395066, 0.45707712687864527,
+    0.4644782371185478, 0.4712253610874472, 0.47655751308666205, 0.47993474226973837,
+    0.4810823588899758, 0.47999785004403933, 0.4769231068794593, 0.4722891713683614,
+    0.4666437422442963, 0.4605730202292483, 0.4546291503238952, 0.44927265476587747,
+    0.4448360872937504, 0.44151112713786533, 0.43935716577907385, 0.43832597110697324,
+    0.438295012034957, 0.43910189568469626, 0.44057395717480197, 0.44254966879982294,
+    0.44489125252111134, 0.44748985297623595, 0.45026545994907474, 0.45316360260339417,
+    0.4561501989063666, 0.4592054158984442, 0.46231730644203484, 0.465476267575586,
+    0.4686716476829215, 0.4718917060427093, 0.47512741195523694, 0.4783794179312433,
+    0.48166637663624506, 0.485032068695126, 0.488548858358109, 0.4923157749222866,
+    0.4964507292896175, 0.5010775972914976, 0.5063097874113319, 0.5122323135773954,
+    0.5188843797830879, 0.5262442446202937, 0.5342178664713366, 0.5426326435629449,
+    0.5512374551853892, 0.5597100964472563, 0.5676729581737835, 0.5747173138379967,
+    0.5804357365702697, 0.5844609367770356, 0.586507754299163, 0.5864134058359793,
+    0.5841698201870592, 0.579941543086516, 0.5740637339275761, 0.567017371961147,
+    0.5593826280281594, 0.5517756546183745, 0.5447777398028929, 0.5388678458511643,
+    0.5343693757026159, 0.5314195294159444, 0.529965378683673, 0.5297857873074983,
+    0.530533687107222, 0.5317899949384077, 0.5331192646457851, 0.5341181333549507,
+    0.534450347385362, 0.5338658339054707, 0.5322049242023638, 0.5293915201865312,
+    0.5254201567547913, 0.5203414827681453, 0.5142491020062703, 0.5072687510201521,
+    0.49954924150257324, 0.4912539801682479, 0.48255225358797854, 0.4736104388366357,
+    0.46458425742936166, 0.4556135989821052, 0.4468211041441712, 0.43831481093129765,
+    0.43019418209709, 0.42255817589896016, 0.4155138809074774, 0.40918446437852307,
+    0.40371543486797445, 0.3992781812165077, 0.39606936838867646, 0.39430432541500104,
+    0.3942025430220068, 0.3959642522813309, 0.3997389108862648, 0.40558895787060034,
+    0.4134546961822135, 0.4231277577525657, 0.43424059267898024, 0.446277525675677,
+    0.4586094038825281, 0.4705494584597284, 0.48142371500594894, 0.49064609334240317,
+    0.4977869464927402, 0.5026244891521513, 0.5051711861260529, 0.5056711551207909,
+    0.5045691941233738, 0.5024563233118053, 0.4914892575623026, 0.48133450780062037,
+    0.46924090356181564, 0.4556427688596274, 0.44151756982376916, 0.42806970961147084,
+    0.4164101614014721, 0.4073491224219712, 0.401360901912181, 0.3986947322197138,
+    0.3995322257787751, 0.4040712554032449, 0.4124614922553073, 0.4246059541617897,
+    0.4399273454640099, 0.45723215190589944, 0.47477231088368455, 0.4905220235327867,
+    0.5025962389216037, 0.5096779703880369, 0.5113164939681357, 0.5080054314835215,
+    0.5010262252198768, 0.4921175777876832, 0.48307871889598825, 0.47542115951930725,
+    0.47015308936367, 0.46772807160850705, 0.4681353909204526, 0.4710708634399377,
+    0.47611383665239865, 0.4828489116233772, 0.4909024039279902, 0.4999019365863045,
+    0.5093995396987504, 0.5188125845330719, 0.5274267017283816, 0.5344738187883087,
+    0.539260260794165, 0.5412936369666737, 0.5403575857010215, 0.536510821704377,
+    0.5300255549703502, 0.5213068158678993, 0.5108324092510976, 0.4991258206795227,
+    0.4867419445405954, 0.4742322814152823, 0.4620728248138477, 0.4505734709932085,
+    0.4398181448636117, 0.4296884739710955, 0.4199948454469473, 0.41068873600871025,
+    0.40208181944591015, 0.39497392214320237, 0.3906084065343475, 0.3904295345399893,
+    0.39569326922393205, 0.4070493955031512, 0.4242377808082401, 0.44601036179792697,
+    0.4703138240031908, 0.4946782526872131, 0.5166924836073143, 0.5344326945738167,
+    0.5467470858257506, 0.5533623915162068, 0.5548336363893001, 0.5523832941072016,
+    0.5476698880509528, 0.5425101415566886, 0.5385765993086661, 0.537110149444277,
+    0.5387073207348736, 0.5432408105432135, 0.5499375586765227, 0.5575856105018062,
+    0.5647983893136913, 0.5702569410341994, 0.5728796888912246, 0.5719151922699355,
+    0.5669875021881565, 0.5581266694160125, 0.545790706317516, 0.5308513371910591,
+    0.5145015996913559, 0.49806434680810235, 0.4827296119006685, 0.4692982467793869,
+    0.458027620978864, 0.4486464814040035, 0.44054123737492845, 0.4330472480714431,
+    0.42573989957869735, 0.41862601257189636, 0.41217613523043173, 0.40718980851405884,
+    0.4045318739099183, 0.40481364476448306, 0.4081171638557233, 0.41386496663654115,
+    0.42090712323787427, 0.4278273945086781, 0.433381137710629, 0.4369099349811265,
+    0.43857081100962986, 0.4392827787053066, 0.44040395935271137, 0.4432577407192047,
+    0.44867883493365557, 0.45673028301147944, 0.4666661422901545, 0.47712030624008955,
+    0.4864297068311477, 0.4929742537973645, 0.4954379112427315, 0.49294784896426325,
+    0.48510492474036115, 0.47195477400042896, 0.45395271927036185, 0.43195172216848315,
+    0.40720702649768786, 0.38136364557798114, 0.35638708963853305, 0.33441570792759845,
+    0.317545048079255, 0.3075846190448594, 0.30584106958927326, 0.31297363233853004,
+    0.3289433566030974, 0.35304987972122903, 0.3840306041865396, 0.4201928139999519,
+    0.4595568293991655, 0.47468970972146907, 0.4498379180031785, 0.4258473328034885,
+    0.403217652325219, 0.3825321406096818, 0.36442081035990687, 0.3495060437743772,
+    0.3383390797824638, 0.3313369774293151, 0.3287293722119633, 0.3305227035039583,
+    0.33648690851796653, 0.3461662970033631, 0.3589129715291945, 0.37393826850266254,
+    0.3903756909741654, 0.4073479273954507, 0.42403081750730814, 0.43970834273376214,
+    0.4538145399851509, 0.4659602625229879, 0.4759445724846001, 0.4837519868314496,
+    0.48953769503817024, 0.49360324615312506, 0.4963651935567301, 0.4983189681311004,
+    0.45484826868390704, 0.41939378327793364, 0.39811424108534227, 0.3922244861276316,
+    0.3994761284835602, 0.4154887424041729, 0.4357690399662711, 0.45725012163370843,
+    0.47868595563077754, 0.4555555555555556, 0.5004183022650943, 0.5002541710137584,
+    0.8740001916885376, 0.7919999957084656, 0.7260000705718994, 0.6460000276565552,
+    0.6859999895095825, 1.0, 0.27521803975105286, 0.0, 0.0, 0.0, 0.0, 1.0, 0, 0, 0, 0, 0,
+    1, 0, 0.5, 0.5, 0.5, 0.5, 1.0, 0,
+  }},
+  // Hygiea
+  {{
+    0.1333333333333333, 0.12087920856658277, 0.22172161943095736, 0.18531406730892805,
+    0.19492577961178, 0.007511663736322182, 0.21567383278510632, 0.85,
+    0.8111111111111111, 0.7666666666666666, 0.7055555555555555, 0.7027777777777777,
+    0.17724436388194026, 0.012950832041316486, 0.08766598776760401, 0.20188554091205752,
+    0.06297748830027566, 0.08494183703755749, 0.18148243169815545, 0.1600707739714731,
+    0.10298224880120964, 0.18295501441419432, 0.19129699204848452, 0.012055158462084086,
+    0.09368957322765188, 0.11352667832886991, 0.15611302604663005, 0.19189097402735014,
+    0.1388730424865242, 0.20028853185971415, 0.15786820401754195, 0.0665934931760003,
+    0.12337384547205293, 0.08165272049229974, 0.20341446521750128, 0.9277777777777778,
+    0.9277777777777778, 0.012589941443083726, 0.17079884296506015, 0.21984812326939263,
+    0.07134445048625339, 0.039486068913102045, 0.18043488034745034, 0.19108106496890484,
+    0.0794813282351151, 0.2024963029634286, 0.1735474633908925, 0.08777985025776015,
+    0.85, 0.8333333333333334, 0.8277777777777777, 0.8222222222222222,
+    0.06725837206127926, 0.049541929927838915, 0.09880019907409551, 0.08449410249533486,
+    0.14097944361548556, 0.19009146286856704, 0.016651848840944995, 0.010145342470041039,
+    0.18380934300070145, 0.023110873307303655, 0.062321369707306534,
+    0.043629714358703844, 0.020335080775462144, 0.16776172879345042,
+    0.014651111031602168, 0.20524252136671275, 0.01885558520515568, 0.09398338377211055,
+    0.06577742832618844, 0.12338102805202912, 0.01128413579835611, 0.16967049262047143,
+    0.06255263022565642, 0.04697257682383887, 0.11141814263349338, 0.12455723157618831,
+    0.05186921494112826, 0.09888282326624474, 0.20160492652376988, 0.1741054557967371,
+    0.5777777777777777, 0.5555555555555556, 0.5388888888888889, 0.5277777777777778,
+    0.5166666666666666, 0.5111111111111111, 0.5055555555555555, 0.18963503266229337,
+    0.15160560783914256, 0.05093677559203405, 0.22156674736637705, 0.22046911589523266,
+    0.14398798821696954, 0.038586171319903745, 0.050088104167893506, 0.18662021016694072,
+    0.2052738403677272, 0.1686521077255423, 0.19113578497208467, 0.1271552837705639,
+    0.030401042104034114, 0.2277893829720739, 0.21215190285869734, 0.14752417494006945,
+    0.12520701870093023, 0.10894650215433191, 0.10134581569810926, 0.09354798537675134,
+    0.40555555555555556, 0.4, 0.3944444444444445, 0.38888888888888884,
+    0.38055555555555554, 0.37222222222222223, 0.04164710290877139, 0.19311773376392957,
+    0.19393694246411125, 0.1932769215093433, 0.11175145564718383, 0.15288534682882535,
+    0.054312613230217625, 0.05704823365800915, 0.02198741792236016, 0.009136974634237063,
+    0.08356809236208924, 0.2220115241883392, 0.11724604693043938, 0.008004927125379733,
+    0.00514555666329998, 0.38888888888888884, 0.1498923819794219, 0.20962599048087774,
+    0.1541224719614666, 0.2909109842778524, 0.08491527106457464, 0.3121858831643216,
+    0.9344898076247219, 0.8794125464169971, 0.3041726899552411, 0.8426047468383668,
+    0.9676375710506224, 0.11020214477519696, 0.45004227020007886, 0.39131802202238497,
+    0.3453856869779916, 0.9375572137000066, 0.7453751994687031, 0.9412471946676859,
+    0.904439743550585, 0.3086147744448788, 0.15450525074078614, 0.6064734930301333,
+    0.20937049270589642, 0.2994668735574288, 0.1423242145146374, 0.24485315161370202,
+    0.942232822015716, 0.5797979981781087, 0.2657996877973677, 0.2792375743487411,
+    0.9637599311806803, 0.37431648206998525, 0.8075348884618769, 0.6811010125462271,
+    0.14630290102864218, 0.109437785334765, 0.8407204903833846, 0.3464989277041576,
+    0.6366766265420193, 0.926719688710151, 0.3292288101521819, 0.45228631266724156,
+    0.17509783361877163, 0.9745092040002066, 0.10674549773240088, 0.502797532140403,
+    0.163029962671159, 0.38695828896764545, 0.9961474986319527, 0.7357416060372053,
+    0.12792256944464664, 0.5750681430890197, 0.6310873224935647, 0.7959099664710825,
+    0.9703751312887531, 0.24914694134327298, 0.16400888580316192, 0.9934026869490938,
+    0.7953890570886487, 0.48922797559546555, 0.5806666415645546, 0.8827647875641381,
+    0.7872503483685461, 0.20327541431568208, 0.30982858813309816, 0.22632611042198925,
+    0.30569876141623725, 0.026512775438466696, 0.0845936910794553, 0.5830767015373333,
+    0.3939871039797814, 0.8284295848672755, 0.3758989879393999, 0.373812131578162,
+    0.4501527969232703, 0.639641967762441, 0.6455447710330112, 0.7140344997318155,
+    0.9067565448465252, 0.7780282477937535, 0.49778441779291693, 0.46664942529280673,
+    0.9930817953774677, 0.26723779132104536, 0.2854831832232457, 0.1372666960039673,
+    0.415856985705144, 0.45522723235692714, 0.3916861969281563, 0.7084837162358961,
+    0.8627329226336143, 0.3043935463098372, 0.6872280090146162, 0.8221256781870176,
+    0.12745881010041105, 0.9555630580569738, 0.625009253090683, 0.4337693554194997,
+    0.5151650709602156, 0.7326527132284014, 0.008633923103673502, 0.18235373076256267,
+    0.6578252912661992, 0.15393633427484343, 0.5913734756710572, 0.3484100022688653,
+    0.2809099257301421, 0.6490326014532515, 0.5410088281278594, 0.04921652274217725,
+    0.16999417701427433, 0.13680730179825012, 0.4430911241589763, 0.0662270187723874,
+    0.2279787000912758, 0.06936903253838084, 0.7698684959615678, 0.33786567229476383,
+    0.2946525250606964, 0.35050922410643276, 0.67154795695677, 0.7363802423859701,
+    0.06464118167473631, 0.739405351098793, 0.3535570759816953, 0.9044873812451156,
+    0.36051057203924086, 0.47527206564015195, 0.9808023611033448, 0.27251023998255774,
+    0.6506911479029454, 0.28846400565492164, 0.026973851230300938, 0.9589548580888088,
+    0.07737678129121844, 0.4643941000542777, 0.3946741943664352, 0.5092374859847357,
+    0.3388888888888889, 0.9356753493686494, 0.3620549774987749, 0.7310864518784843,
+    0.8218352414012312, 0.4327506044190872, 0.3351801088203973, 0.4265731421581939,
+    0.1048140391516536, 0.13729844397402324, 0.7247271396095943, 0.983175969834289,
+    0.11178513085745839, 0.44423605018120627, 0.4428782034485875, 0.7613144312904275,
+    0.9267947324298607, 0.24975289392514138, 0.2425732401561056, 0.006169497379057476,
+    0.7114228366505684, 0.5743061840401228, 0.8073657472968151, 0.4656952498277158,
+    0.37170978426481593, 0.5950082406908856, 0.667352388217439, 0.4054286931683997,
+    0.07855511096986245, 0.35710618358024904, 0.33669171360814976, 0.9705831756052791,
+    0.34896257921711404, 0.8178105060924723, 0.1422524620209883, 0.13035753189118637,
+    0.6715944988152994, 0.6822871195044113, 0.4401635808080012, 0.9096503298207295,
+    0.5300823602862714, 0.009555461153221867, 0.6884262863898878, 0.25655179815545615,
+    0.8797416115872454, 0.332659459014894, 0.9719591689880975, 0.25789298853089876,
+    0.2232147040921798, 0.5282837483600947, 0.3886312516735371, 0.853955713828674,
+    0.7409767477468134, 0.4061752058605282, 0.47631692526973074, 0.32620475284090766,
+    0.596859518401777, 0.5415247874737295, 0.8287352970984373, 0.556563197498541,
+    0.01730192009071918, 0.4520505348647721, 0.8421755730894116, 0.608058844644808,
+    0.40706475401355785, 0.7232763771828616, 0.3270915201117068, 0.3763511502895063,
+    0.4729882305506893, 0.0973676962672767, 0.8052257416217191, 0.1999651289690983,
+    0.5274255164335531, 0.5775028846290882, 0.9756286458341413, 0.870850719317816,
+    0.5988193051333083, 0.35765515539742193, 0.38936295190562864, 0.34394481942603555,
+    0.2786547968436277, 0.9676845725341495, 0.28050274994122903, 0.5863199978538247,
+    0.5102087490412271, 0.7053853784987517, 0.8508727919836635, 0.8192614396115903,
+    0.038806575270848076, 0.3250099334281093, 0.4264597893549163, 0.9896138572580147,
+    0.4004334469062933, 0.6577031621833913, 0.5094674058398189, 0.1862394331071106,
+    0.48273202525061765, 0.06488508412262511, 0.4313303334259109, 0.3494314461048711,
+    0.28301297998709707, 0.924924492219224, 0.580904063463528, 0.4788632204914826,
+    0.03646906885861351, 0.4877391177997684, 0.8162443093396767, 0.0677611713873465,
+    0.324823482369169, 0.42029328285188844, 0.9490022403461265, 0.34839784693422754,
+    0.9937263849058844, 0.5872081918620979, 0.964521883980232, 0.05446070361219191,
+    0.9733855259484269, 0.09747992189943733, 0.22165236254295717, 0.8591036098916863,
+    0.9345924843313173, 0.7497522367131708, 0.8170325767145472, 0.307772507991294,
+    0.13303852965163698, 0.7337300008766149, 0.5914327191052816, 0.1535946583172545,
+    0.32793331756456656, 0.027714403175997715, 0.2696043974713925, 0.8185316647390686,
+    0.057118167363323424, 0.05506136068324874, 0.4338747243789492, 0.22194908712747485,
+    0.8990998264016132, 0.9985980568636207, 0.32080558591175107, 0.6989723672123703,
+    0.05927994783408419, 0.022222222222222254, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    0.9777777777777777, 0.9722222222222222, 0.9444444444444444, 0.8944444444444445,
+    0.8833333333333333, 0.8722222222222222, 0.8722222222222222, 0.4209338083613415,
+    0.569952959928528, 0.08387094027208408, 0.18278132385922924, 0.8776385836731316,
+    0.3329998092526046, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.13888888888888884,
+    0.12222222222222223, 0.0805555555555556, 0.8879995942115784, 0.9360001683235168,
+    0.9640000462532043, 0.952000081539154, 0.9660000205039978, 0.9680001139640808,
+    0.2752180285130085, 0.3760000169277191, 0.3160000145435333, 0.3280000388622284,
+    0.31800004839897156, 0.30800002813339233, 0, 1, 1, 1, 1, 1, 0, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0,
+  }},
+  // Intermnia
+  {{
+    0.21666666666666667, 0.22499999999999998, 0.23333333333333328, 0.23888888888888893,
+    0.25, 0.26111111111111107, 0.2666666666666667, 0.27222222222222225,
+    0.28888888888888886, 0.30000000000000004, 0.3138888888888889, 0.3277777777777777,
+    0.3555555555555555, 0.3680555555555556, 0.3930555555555556, 0.40555555555555556,
+    0.42500000000000004, 0.4444444444444444, 0.4638888888888889, 0.4833333333333333,
+    0.49583333333333335, 0.5208333333333333, 0.5333333333333333, 0.5486111111111112,
+    0.5791666666666666, 0.5944444444444444, 0.6194444444444445, 0.6444444444444444,
+    0.6666666666666667, 0.6916666666666667, 0.7166666666666667, 0.7361111111111112,
+    0.7555555555555555, 0.7888888888888889, 0.8333333333333334, 0.8555555555555556,
+    0.8666666666666667, 0.8777777777777778, 0.1777777777777778, 0.1777777777777778,
+    0.1777777777777778, 0.1777777777777778, 0.1777777777777778, 0.1777777777777778,
+    0.1777777777777778, 0.1777777777777778, 0.1777777777777778, 0.1777777777777778,
+    0.18333333333333335, 0.19444444444444442, 0.19999999999999996, 0.2018518235948351,
+    0.2055555555555556, 0.2092592875162761, 0.21111111111111114, 0.2152777777777778,
+    0.2236111111111111, 0.2319444444444444, 0.2402777777777778, 0.24444444444444446,
+    0.24791666666666667, 0.2548611111111111, 0.2618055555555555, 0.26875000000000004,
+    0.27222222222222225, 0.27962960137261283, 0.2944444868299696, 0.30925928751627607,
+    0.31666666666666665, 0.3277777777777777, 0.35, 0.36111111111111116,
+    0.3736111111111111, 0.39861111111111114, 0.4111111111111111, 0.42638888888888893,
+    0.4569444444444445, 0.4722222222222222, 0.48611111111111116, 0.5138888888888888,
+    0.5277777777777778, 0.5666666666666667, 0.6055555555555556, 0.6388888888888888,
+    0.6722222222222223, 0.7166666666666667, 0.7777777777777778, 0.8222222222222222,
+    0.8416666666666667, 0.18963503266229337, 0.15160560783914256, 0.05093677559203405,
+    0.25555555555555554, 0.24444444444444446, 0.2416666666666667, 0.23888888888888893,
+    0.23888888888888893, 0.23888888888888893, 0.23888888888888893, 0.23888888888888893,
+    0.23888888888888893, 0.2416666666666667, 0.24444444444444446, 0.25,
+    0.26111111111111107, 0.2666666666666667, 0.2777777777777778, 0.28888888888888886,
+    0.30000000000000004, 0.3222222222222222, 0.33333333333333337, 0.3458333333333333,
+    0.37083333333333335, 0.3833333333333333, 0.4, 0.43333333333333335,
+    0.44999999999999996, 0.4652777777777778, 0.49583333333333335, 0.5111111111111111,
+    0.525, 0.5388888888888889, 0.5555555555555556, 0.5888888888888889,
+    0.6055555555555556, 0.6208333333333333, 0.6513888888888889, 0.6666666666666667,
+    0.6944444444444444, 0.7222222222222222, 0.7375, 0.7680555555555555,
+    0.7833333333333333, 0.8083333333333333, 0.8333333333333334, 0.01666666666666672,
+    0.019444444444444486, 0.022222222222222254, 0.022222222222222254,
+    0.022222222222222254, 0.022222222222222254, 0.02777777777777779,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.033333333333333326, 0.03472222222222221, 0.03749999999999998, 0.03888888888888886,
+    0.04166666666666663, 0.0444444444444444, 0.0444444444444444, 0.0444444444444444,
+    0.047222222222222276, 0.050000000000000044, 0.05138888888888893,
+    0.054166666666666696, 0.05555555555555558, 0.05555555555555558, 0.05555555555555558,
+    0.061111111111111116, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.06944444444444442, 0.07222222222222219, 0.07499999999999996, 0.07777777777777772,
+    0.07777777777777772, 0.07777777777777772, 0.07777777777777772, 0.08333333333333337,
+    0.08333333333333337, 0.08333333333333337, 0.0888888888888889, 0.09444444444444444,
+    0.09999999999999998, 0.10277777777777775, 0.10555555555555551, 0.11111111111111116,
+    0.11111111111111116, 0.11111111111111116, 0.11388888888888893, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.11111111111111116, 0.11111111111111116, 0.11111111111111116, 0.11111111111111116,
+    0.10555555555555551, 0.10555555555555551, 0.09999999999999998, 0.09999999999999998,
+    0.09999999999999998, 0.09999999999999998, 0.09444444444444444, 0.09166666666666667,
+    0.0888888888888889, 0.0888888888888889, 0.07777777777777772, 0.07222222222222219,
+    0.06944444444444442, 0.06666666666666665, 0.06666666666666665, 0.05555555555555558,
+    0.050000000000000044, 0.0444444444444444, 0.033333333333333326, 0.02777777777777779,
+    0.07777777777777772, 0.07777777777777772, 0.07777777777777772, 0.07777777777777772,
+    0.07777777777777772, 0.07777777777777772, 0.07777777777777772, 0.07777777777777772,
+    0.07777777777777772, 0.07777777777777772, 0.07777777777777772, 0.07777777777777772,
+    0.07777777777777772, 0.07777777777777772, 0.07777777777777772, 0.07777777777777772,
+    0.07777777777777772, 0.08333333333333337, 0.08333333333333337, 0.0888888888888889,
+    0.09444444444444444, 0.09999999999999998, 0.10555555555555551, 0.06666666666666665,
+    0.06527777777777777, 0.0625, 0.061111111111111116, 0.061111111111111116,
+    0.061111111111111116, 0.061111111111111116, 0.061111111111111116,
+    0.061111111111111116, 0.061111111111111116, 0.05555555555555558,
+    0.054166666666666696, 0.05138888888888893, 0.050000000000000044,
+    0.050000000000000044, 0.050000000000000044, 0.050000000000000044,
+    0.050000000000000044, 0.050000000000000044, 0.050000000000000044,
+    0.050000000000000044, 0.050000000000000044, 0.050000000000000044,
+    0.050000000000000044, 0.050000000000000044, 0.050000000000000044,
+    0.050000000000000044, 0.050000000000000044, 0.050000000000000044,
+    0.050000000000000044, 0.050000000000000044, 0.050000000000000044,
+    0.050000000000000044, 0.050000000000000044, 0.050000000000000044,
+    0.050000000000000044, 0.050000000000000044, 0.05138888888888893,
+    0.054166666666666696, 0.05555555555555558, 0.05555555555555558, 0.05833333333333335,
+    0.06666666666666665, 0.06666666666666665, 0.21481484307183163, 0.2296296861436632,
+    0.24444452921549475, 0.25925937228732643, 0.2666666666666667, 0.27182540893554685,
+    0.28214289347330734, 0.2924603780110677, 0.3027778201633029, 0.3130952623155382,
+    0.3234127044677735, 0.33373014662000866, 0.3388888888888889, 0.34499999152289496,
+    0.35722219679090716, 0.36944440205891926, 0.3816666073269315, 0.39388881259494357,
+    0.4061110178629558, 0.4183332231309679, 0.4305554283989801, 0.4427776336669922,
+    0.4549998389350043, 0.46111111111111114, 0.4683333502875434, 0.48277778625488277,
+    0.49722222222222223, 0.5116666581895617, 0.526111094156901, 0.5333333333333333,
+    0.5377777947319878, 0.5466666751437717, 0.5555555555555556, 0.5644444359673394,
+    0.5733333163791232, 0.5777777777777777, 0.5861111111111111, 0.6027777777777779,
+    0.6111111111111112, 0.6166666666666667, 0.6277777777777778, 0.6333333333333333,
+    0.6444444444444444, 0.6555555555555556, 0.6555555555555556, 0.6555555555555556,
+    0.6472222222222221, 0.6388888888888888, 0.6305555555555555, 0.6138888888888889,
+    0.6055555555555556, 0.5944444444444444, 0.5722222222222222, 0.5611111111111111, 0.55,
+    0.5277777777777778, 0.5166666666666666, 0.5041666666666667, 0.47916666666666663,
+    0.4666666666666667, 0.4555555555555556, 0.43333333333333335, 0.4111111111111111, 0.4,
+    0.3916666666666667, 0.375, 0.3666666666666667, 0.3569444444444444, 0.3375,
+    0.3277777777777777, 0.2944444444444444, 0.28055555555555556, 0.2666666666666667,
+    0.26111111111111107, 0.25555555555555554, 0.25, 0.24722222222222223,
+    0.24444444444444446, 0.23333333333333328, 0.22777777777777775, 0.2222222222222222,
+    0.21666666666666667, 0.20833333333333337, 0.19999999999999996, 0.19444444444444442,
+    0.19444444444444442, 0.19444444444444442, 0.18888888888888888, 0.18888888888888888,
+    0.18333333333333335, 0.1777777777777778, 0.09999999999999998, 0.09999999999999998,
+    0.09999999999999998, 0.09999999999999998, 0.09999999999999998, 0.09999999999999998,
+    0.09999999999999998, 0.09999999999999998, 0.09999999999999998, 0.09999999999999998,
+    0.09999999999999998, 0.09999999999999998, 0.09999999999999998, 0.09999999999999998,
+    0.09999999999999998, 0.09999999999999998, 0.09999999999999998, 0.09999999999999998,
+    0.09999999999999998, 0.09999999999999998, 0.09999999999999998, 0.09999999999999998,
+    0.09999999999999998, 0.09999999999999998, 0.09999999999999998, 0.09444444444444444,
+    0.09166666666666667, 0.08333333333333337, 0.08333333333333337, 0.08333333333333337,
+    0.0888888888888889, 0.09999999999999998, 0.11111111111111116, 0.11111111111111116,
+    0.11111111111111116, 0.061111111111111116, 0.43333333333333335, 0.37222222222222223,
+    0.3666666666666667, 1.0, 0.8860000967979431, 0.7759999632835388, 0.7740001678466797,
+    0.8380001783370972, 0.6780002117156982, 0.6472180485725403, 0.0, 0.0, 0.0, 0.0,
+    0.3420000374317169, 0, 0, 0, 0, 0, 0, 0, 0.7600005269050598, 0.5, 0.5, 0.5, 1.0, 0,
+  }},
+  // Iris
+  {{
+    0.2222222222222222, 0.21111111111111114, 0.19999999999999996, 0.19444444444444442,
+    0.18888888888888888, 0.18333333333333335, 0.09999999999999998, 0.09999999999999998,
+    0.09999999999999998, 0.11111111111111116, 0.12638888888888888, 0.15694444444444444,
+    0.17222222222222228, 0.22777777777777775, 0.22777777777777775, 0.22777777777777775,
+    0.22777777777777775, 0.22777777777777775, 0.22777777777777775, 0.22777777777777775,
+    0.22777777777777775, 0.22777777777777775, 0.22777777777777775, 0.22777777777777775,
+    0.22777777777777775, 0.22777777777777775, 0.22777777777777775, 0.22777777777777775,
+    0.22777777777777775, 0.22777777777777775, 0.22777777777777775, 0.22777777777777775,
+    0.2222222222222222, 0.2222222222222222, 0.2222222222222222, 0.2222222222222222,
+    0.21944444444444444, 0.21666666666666667, 0.21666666666666667, 0.21666666666666667,
+    0.21111111111111114, 0.21111111111111114, 0.21111111111111114, 0.21111111111111114,
+    0.21111111111111114, 0.21111111111111114, 0.21111111111111114, 0.21111111111111114,
+    0.7111111111111111, 0.4722222222222222, 0.3388888888888889, 0.2944444444444444,
+    0.26111111111111107, 0.23888888888888893, 0.19444444444444442, 0.1611111111111111,
+    0.15000000000000002, 0.12777777777777777, 0.11111111111111116, 0.09999999999999998,
+    0.07777777777777772, 0.06666666666666665, 0.05555555555555558, 0.05555555555555558,
+    0.050000000000000044, 0.050000000000000044, 0.050000000000000044,
+    0.050000000000000044, 0.061111111111111116, 0.09444444444444444, 0.10833333333333328,
+    0.1333333333333333, 0.8, 0.7722222222222223, 0.7, 0.6666666666666667,
+    0.6166666666666667, 0.5833333333333333, 0.5222222222222221, 0.4722222222222222,
+    0.44999999999999996, 0.4111111111111111, 0.3833333333333333, 0.35,
+    0.3277777777777777, 0.3055555555555556, 0.2833333333333333, 0.25555555555555554,
+    0.23333333333333328, 0.21111111111111114, 0.18888888888888888, 0.1777777777777778,
+    0.17083333333333328, 0.15694444444444444, 0.15000000000000002, 0.14722222222222225,
+    0.1444444444444445, 0.1333333333333333, 0.12777777777777777, 0.125,
+    0.12222222222222223, 0.12222222222222223, 0.11944444444444446, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.11388888888888893, 0.11111111111111116,
+    0.10833333333333328, 0.10555555555555551, 0.09999999999999998, 0.09999999999999998,
+    0.09999999999999998, 0.09722222222222221, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.21111111111111114, 0.16666666666666663,
+    0.1333333333333333, 0.11111111111111116, 0.08333333333333337, 0.061111111111111116,
+    0.0444444444444444, 0.03888888888888886, 0.03888888888888886, 0.03888888888888886,
+    0.03888888888888886, 0.03888888888888886, 0.03888888888888886, 0.5,
+    0.28055555555555556, 0.2666666666666667, 0.26111111111111107, 0.25555555555555554,
+    0.7444444444444445, 0.75, 0.7611111111111111, 0.7722222222222223, 0.775,
+    0.7777777777777778, 0.7805555555555556, 0.7861111111111111, 0.7888888888888889,
+    0.7888888888888889, 0.7888888888888889, 0.7888888888888889, 0.7888888888888889,
+    0.7888888888888889, 0.7888888888888889, 0.7888888888888889, 0.7888888888888889,
+    0.7888888888888889, 0.7888888888888889, 0.7888888888888889, 0.7888888888888889,
+    0.7777777777777778, 0.7777777777777778, 0.7777777777777778, 0.7777777777777778,
+    0.7777777777777778, 0.7722222222222223, 0.7388888888888889, 0.6888888888888889,
+    0.4930555555555556, 0.3027777777777778, 0.2833333333333333, 0.2833333333333333,
+    0.3222222222222222, 0.2944444444444444, 0.25555555555555554, 0.24444444444444446,
+    0.2305555555555555, 0.21666666666666667, 0.21111111111111114, 0.2055555555555556,
+    0.2055555555555556, 0.2055555555555556, 0.20277777777777772, 0.19999999999999996,
+    0.19999999999999996, 0.19999999999999996, 0.19999999999999996, 0.19999999999999996,
+    0.19999999999999996, 0.19999999999999996, 0.19999999999999996, 0.20833333333333337,
+    0.21666666666666667, 0.2236111111111111, 0.23750000000000004, 0.24444444444444446,
+    0.2777777777777778, 0.2972222222222223, 0.31666666666666665, 0.36111111111111116,
+    0.40555555555555556, 0.7555555555555555, 0.7555555555555555, 0.7555555555555555,
+    0.7555555555555555, 0.7555555555555555, 0.7555555555555555, 0.7555555555555555,
+    0.7444444444444445, 0.7222222222222222, 0.6833333333333333, 0.6722222222222223,
+    0.6722222222222223, 0.6694444444444445, 0.6666666666666667, 0.6611111111111111,
+    0.6611111111111111, 0.6611111111111111, 0.6611111111111111, 0.6611111111111111,
+    0.6611111111111111, 0.6611111111111111, 0.6611111111111111, 0.6611111111111111,
+    0.6611111111111111, 0.6611111111111111, 0.6611111111111111, 0.6611111111111111,
+    0.6638888888888889, 0.6722222222222223, 0.6777777777777778, 0.6666666666666667,
+    0.6222222222222222, 0.5722222222222222, 0.5055555555555555, 0.4222222222222223,
+    0.3388888888888889, 0.30000000000000004, 0.27222222222222225, 0.25,
+    0.41666666666666663, 0.4222222222222223, 0.46111111111111114, 0.5333333333333333,
+    0.5222222222222221, 0.5166666666666666, 0.5083333333333333, 0.23333333333333328,
+    0.23333333333333328, 0.23333333333333328, 0.23888888888888893, 0.24444444444444446,
+    0.27222222222222225, 0.30000000000000004, 0.31666666666666665, 0.35,
+    0.3666666666666667, 0.41666666666666663, 0.44999999999999996, 0.47777777777777775,
+    0.5111111111111111, 0.5388888888888889, 0.55, 0.5611111111111111, 0.5722222222222222,
+    0.5722222222222222, 0.5722222222222222, 0.5722222222222222, 0.5722222222222222,
+    0.21666666666666667, 0.21666666666666667, 0.21666666666666667, 0.21666666666666667,
+    0.21666666666666667, 0.21666666666666667, 0.21666666666666667, 0.21666666666666667,
+    0.21666666666666667, 0.21944444444444444, 0.2222222222222222, 0.2236111111111111,
+    0.22638888888888886, 0.22777777777777775, 0.2305555555555555, 0.23611111111111116,
+    0.2416666666666667, 0.24444444444444446, 0.24722222222222223, 0.25277777777777777,
+    0.25555555555555554, 0.2597222222222222, 0.2680555555555556, 0.27222222222222225,
+    0.27592595418294275, 0.2833333333333333, 0.2907406700981988, 0.2944444444444444,
+    0.2972222222222223, 0.3027777777777778, 0.3055555555555556, 0.30925924513075087,
+    0.31666666666666665, 0.32407408820258243, 0.3277777777777777, 0.33611111111111114,
+    0.35277777777777775, 0.36111111111111116, 0.375, 0.38888888888888884,
+    0.41666666666666663, 0.8333333333333334, 0.8388888888888889, 0.85,
+    0.8555555555555556, 0.8611111111111112, 0.8611111111111112, 0.8611111111111112,
+    0.8722222222222222, 0.8722222222222222, 0.8722222222222222, 0.8722222222222222,
+    0.8722222222222222, 0.8722222222222222, 0.8722222222222222, 0.8555555555555556,
+    0.8305555555555555, 0.8055555555555556, 0.7861111111111111, 0.7666666666666666,
+    0.7166666666666667, 0.6833333333333333, 0.6611111111111111, 0.6444444444444444,
+    0.6277777777777778, 0.5888888888888889, 0.5555555555555556, 0.5333333333333333,
+    0.5111111111111111, 0.47777777777777775, 0.46111111111111114, 0.4388888888888889,
+    0.4222222222222223, 0.38888888888888884, 0.37777777777777777, 0.36111111111111116,
+    0.33333333333333337, 0.3111111111111111, 0.2944444444444444, 0.2833333333333333,
+    0.7277777777777779, 0.7333333333333334, 0.7444444444444445, 0.75, 0.7555555555555555,
+    0.7611111111111111, 0.7666666666666666, 0.7722222222222223, 0.40555555555555556,
+    0.28888888888888886, 0.1972222222222222, 0.7833333333333333, 0.7888888888888889,
+    0.7888888888888889, 0.7944444444444445, 0.7944444444444445, 0.8055555555555556,
+    0.8111111111111111, 0.23333333333333328, 0.19999999999999996, 0.16666666666666663,
+    0.15833333333333333, 0.8111111111111111, 0.8083333333333333, 0.8055555555555556,
+    0.3833333333333333, 0.36111111111111116, 0.34444444444444444, 0.31666666666666665,
+    0.30000000000000004, 0.2833333333333333, 0.27222222222222225, 0.25, 0.25,
+    0.5444444444444445, 0.6444444444444444, 0.6444444444444444, 0.65, 0.6666666666666667,
+    0.6777777777777778, 0.6916666666666667, 0.7055555555555555, 0.7166666666666667,
+    0.7277777777777779, 0.7444444444444445, 0.75, 0.7611111111111111, 0.7777777777777778,
+    0.7888888888888889, 0.7944444444444445, 0.8055555555555556, 0.8222222222222222,
+    0.8222222222222222, 0.8333333333333334, 0.8333333333333334, 0.6888888888888889,
+    0.6555555555555556, 0.6611111111111111, 0.7555555555555555, 0.47777777777777775,
+    0.38888888888888884, 0.35, 0.3277777777777777, 0.3277777777777777,
+    0.3277777777777777, 0.3277777777777777, 0.3666666666666667, 0.5388888888888889,
+    0.2777777777777778, 0.7333333333333334, 0.7027777777777777, 0.2666666666666667,
+    0.7722222222222223, 0.75, 0.7111111111111111, 0.24444444444444446,
+    0.6277777777777778, 0.6166666666666667, 0.6111111111111112, 0.6111111111111112,
+    0.6277777777777778, 0.6583333333333333, 0.15555555555555556, 0.15000000000000002,
+    0.15555555555555556, 0.7277777777777779, 0.7444444444444445, 0.6611111111111111, 0.5,
+    0.35, 0.25277777777777777, 0.6861111111111111, 0.8305555555555555,
+    0.6861111111111111, 0.6020000576972961, 1.0, 1.0, 1.0, 1.0, 1.0, 0.27521803975105286,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 12616462, 0.5, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+  // Juno
+  {{
+    0.9722222222222222, 0.9687134504318238, 0.9616959068510268, 0.9546783659193251,
+    0.9476608170403374, 0.9406432787577311, 0.9336257298787435, 0.9266081915961372,
+    0.9195906427171495, 0.9125731044345432, 0.9055555661519369, 0.8985380278693305,
+    0.8915204895867241, 0.8845029513041178, 0.8774854130215115, 0.8704678747389052,
+    0.8634503364562989, 0.8564327981736926, 0.8494152598910861, 0.8423977216084798,
+    0.8353801833258735, 0.8283626450432672, 0.8213450961642795, 0.8143275578816732,
+    0.8073100195990668, 0.8002924813164605, 0.7932749430338542, 0.7862574047512478,
+    0.7792398664686415, 0.7722223281860352, 0.7652047899034289, 0.7581872516208225,
+    0.7511697133382161, 0.7441521750556098, 0.7371346367730034, 0.7301170984903971,
+    0.7230995602077908, 0.7160820219251844, 0.7090644836425781, 0.7020469453599718,
+    0.6950294070773655, 0.6880118687947592, 0.6809943305121529, 0.6739767922295464,
+    0.6669592539469401, 0.6599417156643338, 0.6529241773817274, 0.645906639099121,
+    0.6388891008165147, 0.6318715413411458, 0.6248539818657769, 0.617836422390408,
+    0.6108188629150391, 0.6038013034396701, 0.5967837439643012, 0.5897661844889324,
+    0.5827486250135634, 0.5757310655381944, 0.5687135060628254, 0.5616959465874566,
+    0.5546783871120877, 0.5476608276367188, 0.5406432681613498, 0.5336257086859809,
+    0.526608149210612, 0.5195905897352431, 0.5125730302598741, 0.5055554707845051,
+    0.4985379113091363, 0.4915203518337674, 0.48450279235839844, 0.47748523288302946,
+    0.4704676734076606, 0.46345011393229163, 0.45643255445692277, 0.4494149949815538,
+    0.44239743550618493, 0.43537987603081596, 0.4283623165554471, 0.4213447570800781,
+    0.41432719760470915, 0.4073096381293403, 0.4002920786539713, 0.39327451917860246,
+    0.3862569597032335, 0.3792394002278646, 0.37222184075249565, 0.3652042812771268,
+    0.3581867218017578, 0.35116916232638884, 0.34415160285102, 0.337134043375651,
+    0.33011648390028214, 0.32309892442491317, 0.3160813649495443, 0.30906380547417533,
+    0.3020462459988065, 0.2950286865234375, 0.28801108466254344, 0.28099356757269967,
+    0.2739760504828559, 0.2669585333930121, 0.25994101630316835, 0.2529234992133247,
+    0.24590598212348092, 0.23888846503363714, 0.23187094794379337, 0.2248534308539496,
+    0.21783591376410594, 0.21081839667426217, 0.2038008795844184, 0.19678336249457462,
+    0.18976584540473085, 0.1827483283148872, 0.17573081122504342, 0.16871329413519964,
+    0.16169577704535587, 0.1546782599555121, 0.14766074286566844, 0.14064322577582467,
+    0.1336257086859809, 0.12660819159613712, 0.11959067450629335, 0.11257315741644969,
+    0.10555564032660592, 0.09853812323676214, 0.09152060614691837, 0.0845030890570746,
+    0.07748557196723094, 0.07046805487738717, 0.06345053778754339, 0.05643302069769962,
+    0.04941550360785585, 0.04239798651801219, 0.03888888888888886, 0.17222222222222228,
+    0.17222222222222228, 0.17222222222222228, 0.17222222222222228, 0.17222222222222228,
+    0.17222222222222228, 0.17222222222222228, 0.17222222222222228, 0.17222222222222228,
+    0.17222222222222228, 0.22777777777777775, 0.2055555555555556, 0.24444444444444446,
+    0.22777777777777775, 0.22777777777777775, 0.22777777777777775, 0.22777777777777775,
+    0.22777777777777775, 0.22777777777777775, 0.22777777777777775, 0.22777777777777775,
+    0.22777777777777775, 0.22777777777777775, 0.2319444444444444, 0.2402777777777778,
+    0.24444444444444446, 0.24444444444444446, 0.24444444444444446, 0.24444444444444446,
+    0.24444444444444446, 0.24444444444444446, 0.24444444444444446, 0.24444444444444446,
+    0.24444444444444446, 0.24444444444444446, 0.26111111111111107, 0.24444444444444446,
+    0.24444444444444446, 0.24444444444444446, 0.24444444444444446, 0.24444444444444446,
+    0.24444444444444446, 0.24444444444444446, 0.24444444444444446, 0.24444444444444446,
+    0.24444444444444446, 0.24444444444444446, 0.24444444444444446, 0.24444444444444446,
+    0.24444444444444446, 0.24444444444444446, 0.24444444444444446, 0.24444444444444446,
+    0.24444444444444446, 0.24444444444444446, 0.24444444444444446, 0.24444444444444446,
+    0.24444444444444446, 0.24444444444444446, 0.24444444444444446, 0.24444444444444446,
+    0.24444444444444446, 0.24444444444444446, 0.24444444444444446, 0.24444444444444446,
+    0.24444444444444446, 0.24375000000000002, 0.24236111111111114, 0.24097222222222225,
+    0.23958333333333337, 0.23888888888888893, 0.23888888888888893, 0.23888888888888893,
+    0.23888888888888893, 0.23888888888888893, 0.23888888888888893, 0.23888888888888893,
+    0.23888888888888893, 0.23888888888888893, 0.23888888888888893, 0.23888888888888893,
+    0.23888888888888893, 0.23888888888888893, 0.23888888888888893, 0.23888888888888893,
+    0.23888888888888893, 0.25, 0.25, 0.23888888888888893, 0.23888888888888893,
+    0.23888888888888893, 0.23888888888888893, 0.23888888888888893, 0.23888888888888893,
+    0.23888888888888893, 0.23888888888888893, 0.23888888888888893, 0.23888888888888893,
+    0.23888888888888893, 0.23888888888888893, 0.23888888888888893, 0.23888888888888893,
+    0.23888888888888893, 0.23888888888888893, 0.23888888888888893, 0.23888888888888893,
+    0.23611111111111116, 0.23333333333333328, 0.2305555555555555, 0.22777777777777775,
+    0.22777777777777775, 0.22777777777777775, 0.24722222222222223, 0.22777777777777775,
+    0.22777777777777775, 0.2222222222222222, 0.2222222222222222, 0.21666666666666667,
+    0.21666666666666667, 0.21666666666666667, 0.2055555555555556, 0.2055555555555556,
+    0.19999999999999996, 0.19444444444444442, 0.18888888888888888, 0.18333333333333335,
+    0.1777777777777778, 0.17222222222222228, 0.1694444444444444, 0.16666666666666663,
+    0.1611111111111111, 0.15833333333333333, 0.15555555555555556, 0.15000000000000002,
+    0.14722222222222225, 0.9666666666666667, 0.9222222222222223, 0.8888888888888888,
+    0.8777777777777778, 0.85, 0.8277777777777777, 0.85, 0.8444444444444444,
+    0.8055555555555556, 0.7833333333333333, 0.7611111111111111, 0.7333333333333334, 0.7,
+    0.6777777777777778, 0.6611111111111111, 0.65, 0.6444444444444444, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6388888888888888, 0.6388888888888888,
+    0.6388888888888888, 0.6388888888888888, 0.6444444444444444, 0.65, 0.6555555555555556,
+    0.6666666666666667, 0.6888888888888889, 0.7222222222222222, 0.75, 0.7777777777777778,
+    0.8, 0.8111111111111111, 0.8277777777777777, 0.8388888888888889, 0.8555555555555556,
+    0.8666666666666667, 0.8722222222222222, 0.8833333333333333, 0.8888888888888888,
+    0.8944444444444445, 0.9, 0.9, 0.9, 0.9055555555555556, 0.9055555555555556,
+    0.9055555555555556, 0.9083333333333333, 0.9111111111111111, 0.9138888888888889,
+    0.9166666666666666, 0.9166666666666666, 0.9194444444444444, 0.925,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9277777777777778, 0.9277777777777778, 0.9277777777777778,
+    0.9277777777777778, 0.9333333333333333, 0.9388888888888889, 0.9388888888888889,
+    0.9388888888888889, 0.9388888888888889, 0.9388888888888889, 0.9388888888888889,
+    0.9388888888888889, 0.9388888888888889, 0.9388888888888889, 0.9638888888888889,
+    0.9222222222222223, 0.9166666666666666, 0.9166666666666666, 0.9166666666666666,
+    0.9055555555555556, 0.9, 0.8944444444444445, 0.8833333333333333, 0.35, 0.35, 0.35,
+    0.3555555555555555, 0.3555555555555555, 0.3555555555555555, 0.3666666666666667,
+    0.37222222222222223, 0.37777777777777777, 0.37777777777777777, 0.37777777777777777,
+    0.37777777777777777, 0.37777777777777777, 0.37777777777777777, 0.37777777777777777,
+    0.37777777777777777, 0.37222222222222223, 0.3666666666666667, 0.3555555555555555,
+    0.35277777777777775, 0.34444444444444444, 0.34444444444444444, 0.33333333333333337,
+    0.3277777777777777, 0.31666666666666665, 0.3111111111111111, 0.30000000000000004,
+    0.3666666666666667, 0.3944444444444445, 0.40555555555555556, 0.41666666666666663,
+    0.41666666666666663, 0.4111111111111111, 0.38888888888888884, 0.3388888888888889,
+    0.30833333333333335, 0.4444444444444444, 0.4555555555555556, 0.4555555555555556,
+    0.2179999947547913, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0, 0, 0,
+    0, 0, 0, 4060084, 0.8759997487068176, 0.5, 0.1879999190568924, 0.5, 0.5, 0,
+  }},
+  // Pallas
+  {{
+    0.06666666666666665, 0.0444444444444444, 0.0444444444444444, 0.0444444444444444,
+    0.0444444444444444, 0.0444444444444444, 0.0444444444444444, 0.0444444444444444,
+    0.043518490261501785, 0.04166666666666663, 0.039814843071831585, 0.03888888888888886,
+    0.03888888888888886, 0.03888888888888886, 0.03888888888888886, 0.03888888888888886,
+    0.03888888888888886, 0.03888888888888886, 0.03888888888888886, 0.03888888888888886,
+    0.03888888888888886, 0.03888888888888886, 0.03888888888888886, 0.03888888888888886,
+    0.03888888888888886, 0.03888888888888886, 0.03888888888888886, 0.03888888888888886,
+    0.03888888888888886, 0.03888888888888886, 0.03888888888888886, 0.03888888888888886,
+    0.03888888888888886, 0.03888888888888886, 0.04166666666666663, 0.0444444444444444,
+    0.04583333333333328, 0.04861111111111116, 0.050000000000000044, 0.054166666666666696,
+    0.0625, 0.06666666666666665, 0.06944444444444442, 0.07499999999999996,
+    0.07777777777777772, 0.08194444444444449, 0.09027777777777779, 0.09444444444444444,
+    0.09722222222222221, 0.10277777777777775, 0.10833333333333328, 0.11111111111111116,
+    0.11388888888888893, 0.11944444444444446, 0.12222222222222223, 0.125,
+    0.13055555555555554, 0.13611111111111107, 0.13888888888888884, 0.1430555555555556,
+    0.1513888888888889, 0.15555555555555556, 0.15555555555555556, 0.15555555555555556,
+    0.15555555555555556, 0.15555555555555556, 0.15555555555555556, 0.15555555555555556,
+    0.15555555555555556, 0.15555555555555556, 0.15555555555555556, 0.15555555555555556,
+    0.15555555555555556, 0.15555555555555556, 0.15555555555555556, 0.15555555555555556,
+    0.15555555555555556, 0.15555555555555556, 0.15555555555555556, 0.15555555555555556,
+    0.15555555555555556, 0.15555555555555556, 0.15555555555555556, 0.15555555555555556,
+    0.15555555555555556, 0.15555555555555556, 0.15555555555555556, 0.15555555555555556,
+    0.15555555555555556, 0.15555555555555556, 0.1444444444444445, 0.1430555555555556,
+    0.14027777777777772, 0.13888888888888884, 0.13888888888888884, 0.13611111111111107,
+    0.1333333333333333, 0.12777777777777777, 0.12638888888888888, 0.12361111111111112,
+    0.12222222222222223, 0.11388888888888893, 0.10555555555555551, 0.10277777777777775,
+    0.09722222222222221, 0.09444444444444444, 0.09166666666666667, 0.0888888888888889,
+    0.08333333333333337, 0.07777777777777772, 0.07222222222222219, 0.07222222222222219,
+    0.061111111111111116, 0.05555555555555558, 0.05555555555555558, 0.050000000000000044,
+    0.0444444444444444, 0.0444444444444444, 0.0444444444444444, 0.04166666666666663,
+    0.03888888888888886, 0.03888888888888886, 0.03888888888888886, 0.036111111111111094,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.033333333333333326, 0.033333333333333326, 0.033333333333333326,
+    0.033333333333333326, 0.036111111111111094, 0.0028838582493650455,
+    0.4826310474721326, 0.7123188952445287, 0.10761660737179823, 0.37104845874533887,
+    0.7045746830439195, 0.3842018696899542, 0.4293540398958035, 0.585134593069748,
+    0.09600390330126429, 0.45039665806082246, 0.3372399079126881, 0.9362140549035921,
+    0.3955602118644521, 0.586973067879976, 0.6655833197099261, 0.9896839610592383,
+    0.0630590044646479, 0.530080074692636, 0.3323679639213518, 0.4496415434736982,
+    0.8417892954809157, 0.48006196184233013, 0.8921575978469203, 0.9083552243236991,
+    0.8674605379537444, 0.4152410657686701, 0.22824745960420473, 0.09599172252732668,
+    0.5671385138042109, 0.16876986954124695, 0.518659472982405, 0.6137964452832722,
+    0.24588306603065457, 0.3248054091720942, 0.0486630853120803, 0.8529879547451662,
+    0.32120815563798194, 0.8141251459821104, 0.1792882707107072, 0.4269377056047326,
+    0.9381196555282897, 0.23692484241987521, 0.7672908508298468, 0.2338269843994621,
+    0.37697831326557424, 0.35171834557652476, 0.9771072342621007, 0.12222222222222223,
+    0.530218996155283, 0.8848318449913851, 0.7014243467077802, 0.9034456335545636,
+    0.8318447862744326, 0.6110080470189839, 0.9138954739420079, 0.18278657361701034,
+    0.7144257534929976, 0.43856289070774707, 0.47015496448192107, 0.5104919383984539,
+    0.44422478643326163, 0.32413189054317465, 0.1617389452739787, 0.8704686759624459,
+    0.4626221170890182, 0.9842261135889087, 0.11450680737181845, 0.17089234663684333,
+    0.17960627360774173, 0.6132510483412072, 0.36914742141031215, 0.031943097913593954,
+    0.6336474591203228, 0.07590852073983945, 0.31003907469430253, 0.8988212742570355,
+    0.2853044102583745, 0.25814830996743615, 0.8231064968778306, 0.36181669947929346,
+    0.5547134366320932, 0.02356227710308717, 0.3273148572815223, 0.9685810183192783,
+    0.0095162512953883, 0.1155816522917602, 0.8863555645557892, 0.5659204842014465,
+    0.8835769813485413, 0.8720547052883934, 0.9256799492260697, 0.6356902672171436,
+    0.4077571073082668, 0.7642459610747561, 0.010077939576319639, 0.515500744701522,
+    0.2286011255654522, 0.4486512572866139, 0.8403669847197588, 0.5968529168965966,
+    0.06765939971102175, 0.7840289529913076, 0.08932203752951601, 0.25439927106998417,
+    0.4872366813072054, 0.3034618055601165, 0.161496937416845, 0.08472446368254993,
+    0.6187944310563154, 0.7825288063333015, 0.4037816211937501, 0.7493385584871839,
+    0.9811513615223426, 0.9154765382985117, 0.3748496506898913, 0.8884693537451227,
+    0.4349022649442571, 0.11609905814792604, 0.05842209340965693, 0.5208004628197334,
+    0.038309792909036855, 0.5815908761079899, 0.23942246932338612, 0.12114369100165606,
+    0.568212841230329, 0.8537848246666168, 0.2980467318033392, 0.5123181609971688,
+    0.2952567192854035, 0.5031403687056345, 0.3447631420508134, 0.8800628872782866,
+    0.8183670377024389, 0.7489277396943752, 0.4, 0.17135177751251718,
+    0.09550873593680004, 0.19923317381170164, 0.08258503555714125, 0.9659054165106005,
+    0.5117625964305308, 0.0656173025211495, 0.37014695744492965, 0.32354770577084185,
+    0.9475703209574836, 0.026356637767785795, 0.837410768768814, 0.6388573205090871,
+    0.23186450596406205, 0.9554267206800897, 0.7211656499142128, 0.7416471481491617,
+    0.2638652702381475, 0.15230798939956997, 0.48464193244065434, 0.7637492756011091,
+    0.9848630766287738, 0.016017364887921826, 0.39511439473501436, 0.7539375568614749,
+    0.6205097141278555, 0.2612414142130246, 0.905004580801005, 0.8704811608691517,
+    0.14901684576356844, 0.977033649226647, 0.2144828934819396, 0.45192774146005077,
+    0.9080783300075658, 0.49009975131845057, 0.8492256800481005, 0.09956462797557297,
+    0.49326337593307185, 0.7914195594316835, 0.9108827301225492, 0.5450321912152646,
+    0.09421525171145945, 0.21048813146365625, 0.031023817679377896, 0.452271031810971,
+    0.21167764734939443, 0.8434305342970759, 0.2704963546670098, 0.9772049514449427,
+    0.0704187552768531, 0.002032993632025748, 0.33565776579201706, 0.0752856872151692,
+    0.6783413204725101, 0.2249968670732182, 0.9222222222222223, 0.27128347082711235,
+    0.22043539477684354, 0.28635534388106876, 0.43040860133580344, 0.5411603614643192,
+    0.6805449170050033, 0.05148737922580471, 0.8020111460246044, 0.729257350989929,
+    0.5229163223078767, 0.767204169616792, 0.43931178550552, 0.09412961551688848,
+    0.43998493023084834, 0.8725052468193476, 0.5221741229821005, 0.3807132932471022,
+    0.03462995382784484, 0.17115950031180166, 0.07429578296078576, 0.3428624919626845,
+    0.9319899593483291, 0.4512444756411175, 0.2634887914238445, 0.3834149353008128,
+    0.7828019478461546, 0.9153027795524954, 0.8618575430125143, 0.8851670723347116,
+    0.44877545138471586, 0.5363036136332872, 0.14951574408675572, 0.2792495422550841,
+    0.09127550721610067, 0.20496840600604688, 0.7368737695708252, 0.4955111384008423,
+    0.3188802580339969, 0.4953578902283967, 0.5586697697955917, 0.7954527409650979,
+    0.881566313966813, 0.49708208727874215, 0.1681129540398083, 0.19947388744127015,
+    0.21148172947464916, 0.31874641181848773, 0.1810644725128865, 0.24042950328431212,
+    0.3818096367333847, 0.6930598845883292, 0.7001234967042707, 0.0298796258181398,
+    0.9994193055271113, 0.43003890270597744, 0.2935650066065698, 0.49041911370819136,
+    0.7258954161818549, 0.5583715877190207, 0.25450936065884966, 0.784131340744763,
+    0.31224329909579013, 0.362547428806813, 0.023836790016575016, 0.40416207958023437,
+    0.6605559415542832, 0.6160345754269756, 0.3098639803229094, 0.8753157870131909,
+    0.5894699722127918, 0.5223870946744579, 0.6954832788484401, 0.29806626661055846,
+    0.11475573534636047, 0.9816103292567182, 0.7985660070848924, 0.9724280788961219,
+    0.7153144451889935, 0.1611111111111111, 0.44923449283093486, 0.12234342014651034,
+    0.1431559623840306, 0.633934971496026, 0.11308026435829932, 0.0343299225956194,
+    0.16855810689818307, 0.44216744998819774, 0.9285722973455516, 0.9730473429642604,
+    0.16857832748017743, 0.37510217931353385, 0.5873531813685405, 0.3552316624317082,
+    0.7481869267513219, 0.6673217318622748, 0.2601237886046107, 0.36829911747805383,
+    0.8929800362850187, 0.9910449806940173, 0.6599507005894244, 0.6374431771240394,
+    0.8756117181771194, 0.3086559592449978, 0.17736696691087817, 0.7496901388691434,
+    0.637734827374637, 0.9671503831256555, 0.3919257502034645, 0.10432194339958595,
+    0.05989953974286594, 0.764166241721872, 0.3924397288319944, 0.24223590915056536,
+    0.39580833310457497, 0.6288306832409132, 0.10052228340597408, 0.1740433814707757,
+    0.33799973130226135, 0.9360001683235168, 0.9640000462532043, 0.952000081539154,
+    0.9660000205039978, 0.9680001139640808, 0.2752180285130085, 0.3760000169277191,
+    0.3160000145435333, 0.3280000388622284, 0.31800004839897156, 0.30800002813339233, 0,
+    1, 1, 1, 1, 1, 0, 0.5, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+  // Patientia
+  {{
+    0.09444444444444444, 0.09444444444444444, 0.16666666666666663, 0.12222222222222223,
+    0.022222222222222254, 0.033333333333333326, 0.047222222222222276,
+    0.061111111111111116, 0.08333333333333337, 0.09722222222222221, 0.11111111111111116,
+    0.5555555555555556, 0.5111111111111111, 0.5, 0.49444444444444446,
+    0.49444444444444446, 0.49444444444444446, 0.49444444444444446, 0.49444444444444446,
+    0.49444444444444446, 0.49444444444444446, 0.5, 0.5055555555555555,
+    0.5092592451307509, 0.5166666666666666, 0.5240740882025825, 0.5277777777777778,
+    0.5324074215359158, 0.5416666666666667, 0.5509259117974175, 0.5555555555555556,
+    0.27222222222222225, 0.27222222222222225, 0.27222222222222225, 0.27361111111111114,
+    0.2763888888888889, 0.2777777777777778, 0.28055555555555556, 0.2833333333333333,
+    0.2833333333333333, 0.2833333333333333, 0.2833333333333333, 0.2833333333333333,
+    0.2833333333333333, 0.2833333333333333, 0.2833333333333333, 0.28888888888888886,
+    0.2944444444444444, 0.2944444444444444, 0.2944444444444444, 0.30000000000000004,
+    0.30000000000000004, 0.30000000000000004, 0.2833333333333333, 0.25555555555555554,
+    0.24722222222222223, 0.23888888888888893, 0.22777777777777775, 0.21666666666666667,
+    0.20972222222222225, 0.1958333333333333, 0.18888888888888888, 0.18333333333333335,
+    0.18333333333333335, 0.18333333333333335, 0.16666666666666663, 0.16666666666666663,
+    0.16666666666666663, 0.16666666666666663, 0.16666666666666663, 0.16666666666666663,
+    0.16666666666666663, 0.16666666666666663, 0.17222222222222228, 0.1777777777777778,
+    0.18055555555555558, 0.18333333333333335, 0.18888888888888888, 0.19444444444444442,
+    0.19999999999999996, 0.2055555555555556, 0.21666666666666667, 0.22777777777777775,
+    0.24444444444444446, 0.27222222222222225, 0.2833333333333333, 0.3111111111111111,
+    0.3111111111111111, 0.3111111111111111, 0.28888888888888886, 0.27222222222222225,
+    0.25555555555555554, 0.2222222222222222, 0.19444444444444442, 0.18611111111111112,
+    0.1694444444444444, 0.1611111111111111, 0.7777777777777778, 0.13888888888888884,
+    0.12777777777777777, 0.1166666666666667, 0.11388888888888893, 0.10833333333333328,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.9055555555555556, 0.09999999999999998,
+    0.09999999999999998, 0.09444444444444444, 0.08333333333333337, 0.07222222222222219,
+    0.06388888888888888, 0.05555555555555558, 0.050000000000000044, 0.050000000000000044,
+    0.0444444444444444, 0.06666666666666665, 0.06666666666666665, 0.0444444444444444,
+    0.07222222222222219, 0.09444444444444444, 0.1166666666666667, 0.12222222222222223,
+    0.12222222222222223, 0.12222222222222223, 0.12222222222222223, 0.10277777777777775,
+    0.48888888888888893, 0.49444444444444446, 0.5, 0.5, 0.5, 0.5111111111111111,
+    0.5138888888888888, 0.5166666666666666, 0.5222222222222221, 0.5277777777777778,
+    0.5333333333333333, 0.5361111111111111, 0.5388888888888889, 0.5388888888888889,
+    0.5388888888888889, 0.42120215932180105, 0.4425563741455929, 0.4425563741455929,
+    0.4425563741455929, 0.4425563741455929, 0.4425563741455929, 0.4425563741455929,
+    0.4425563741455929, 0.4425563741455929, 0.4425563741455929, 0.4582924532168463,
+    0.45863016614626456, 0.45879902261097366, 0.4589678790756828, 0.45930559200510107,
+    0.45947444846981017, 0.46048758725806493, 0.46150072604631975, 0.46217615190515615,
+    0.46285157776399266, 0.46717430326054626, 0.47390357109213427, 0.4753807274454097,
+    0.4768578837986852, 0.4785812328775064, 0.4803045819563278, 0.4825203164862409,
+    0.484736051016154, 0.49210312213538965, 0.4940773416015422, 0.4960515610676949,
+    0.49964105100615414, 0.5061380277947652, 0.5096916228338401, 0.5109838392116852,
+    0.5122760555895307, 0.5132452178729147, 0.5142143801562986, 0.5129383164831764,
+    0.5130836908256841, 0.5130836908256841, 0.5130836908256841, 0.5130836908256841,
+    0.5130836908256841, 0.5130836908256841, 0.5130836908256841, 0.5130836908256841,
+    0.5130836908256841, 0.5130836908256841, 0.5130836908256841, 0.5130836908256841,
+    0.5130836908256841, 0.5130836908256841, 0.5130836908256841, 0.5130110036544303,
+    0.5128656293119226, 0.5127202549694151, 0.5125748806269075, 0.5125021934556535,
+    0.5112519741100882, 0.5112519741100882, 0.5112519741100882, 0.5112519741100882,
+    0.5112519741100882, 0.5112519741100882, 0.5112145922789015, 0.5111398286165281,
+    0.5110650649541545, 0.510990301291781, 0.5109155376294073, 0.510840773967034,
+    0.5107660103046603, 0.5107286264770609, 0.5107122718635289, 0.5106795626364645,
+    0.5106468534094003, 0.5106141441823362, 0.510581434955272, 0.5105487257282078,
+    0.5105160165011436, 0.5104833072740793, 0.5104669526605472, 0.5103797283877781,
+    0.5102052788440337, 0.5100308293002889, 0.5098563797565442, 0.5096819302127998,
+    0.5095074806690553, 0.5094202573944925, 0.508360478437612, 0.5081249720027496,
+    0.5078894655678874, 0.5077717123504564, 0.5076539591330251, 0.5074184526981629,
+    0.5071829462633005, 0.5069474398284384, 0.5067119333935759, 0.5064764269587136,
+    0.5062409205238513, 0.5061231673064202, 0.5058876608715577, 0.5054166480018333,
+    0.5049456351321086, 0.5044746222623838, 0.5040036093926594, 0.503768102957797,
+    0.5033265283924302, 0.5024433792616964, 0.5015602301309628, 0.5006770810002291,
+    0.5002355064348621, 0.49973505526077994, 0.4987812541995875, 0.4983043536689914,
+    0.4978451166600413, 0.4969266410250468, 0.4960081653900524, 0.4955489283811023,
+    0.5000998968909595, 0.43333333333333335, 0.43194444444444446, 0.4291666666666667,
+    0.4277777777777778, 0.42592591179741757, 0.4222222222222223, 0.4185185326470269,
+    0.4148148430718316, 0.44168002780914306, 0.45261500000000005, 0.46719499999999997,
+    0.47342795, 0.4880425775, 0.4928255465, 0.49784766395, 0.50215233605, 0.503486784401,
+    0.5062762119218, 0.5127093291416449, 0.5155336245064552, 0.5216058595407965,
+    0.5266895911974545, 0.5292314570257837, 0.5285959905687013, 0.5308836698141973,
+    0.5331713490596935, 0.5319131254746706, 0.5247656148240049, 0.5255160880004898,
+    0.5236399050592775, 0.5236399050592775, 0.5236399050592775, 0.5239776179886957,
+    0.5243153309181139, 0.5243153309181139, 0.5243153309181139, 0.5219445852260415,
+    0.5220661623444102, 0.5221877394627789, 0.5223093165811475, 0.5224308936995162,
+    0.5224916810992554, 0.5224916810992554, 0.5224916810992554, 0.5224916810992554,
+    0.5202425129893298, 0.5207896079349874, 0.5207896079349874, 0.5187106471414886,
+    0.5187106471414886, 0.5187106471414886, 0.5168395824273397, 0.5168395824273397,
+    0.5168395824273397, 0.5168395824273397, 0.5168395824273397, 0.5151556241846058,
+    0.5151556241846058, 0.5151556241846058, 0.5151556241846058, 0.5151556241846058,
+    0.5151556241846058, 0.5151556241846058, 0.5151556241846058, 0.5151556241846058,
+    0.5137297990146066, 0.5139092735115296, 0.5139990107599912, 0.5141784852569141,
+    0.51453743425076, 0.5147169087476829, 0.514896383244606, 0.515075857741529,
+    0.515075857741529, 0.515075857741529, 0.515075857741529, 0.5136490354909914,
+    0.5138105625382221, 0.5138913260618373, 0.514052853109068, 0.5142143801562986,
+    0.51453743425076, 0.5148604883452214, 0.5136651881957144, 0.5139559368807297,
+    0.5142466855657448, 0.5130836908256841, 0.5130836908256841, 0.5130836908256841,
+    0.5117753217431157, 0.5117753217431157, 0.5117753217431157, 0.5117753217431157,
+    0.5117753217431157, 0.5117753217431157, 0.5117753217431157, 0.5117164451344,
+    0.5115986919169689, 0.5115398153082533, 0.510359339303506, 0.5103063503556619,
+    0.5102533614078179, 0.510200372459974, 0.510173877986052, 0.5099831174503947,
+    0.5096015971876271, 0.5092200769248595, 0.5088385566620921, 0.5084570363993246,
+    0.5082662758636673, 0.5080792556672543, 0.5077052160829757, 0.5073311764986972,
+    0.5069571369144187, 0.5065830973301402, 0.5062090577458616, 0.5058350181615829,
+    0.5054609793858517, 0.5050869389930259, 0.5047128986002003, 0.5043388582073745,
+    0.5039648178145488, 0.5035907774217231, 0.5032167370288974, 0.5028426966360715,
+    0.5024686562432459, 0.5020946158504201, 0.5019076021223847, 0.5013777126439445,
+    0.500317933687064, 0.499788044208624, 0.49942771936328456, 0.49866467851433066,
+    0.49828315808985374, 0.4998092397877616, 0.44999999999999996, 0.44999999999999996,
+    0.46111111111111114, 0.4833333333333333, 0.5666666666666667, 0.5666666666666667,
+    0.5166666666666666, 0.49444444444444446, 0.48888888888888893, 0.48888888888888893,
+    0.48888888888888893, 0.48888888888888893, 0.48888888888888893, 0.48888888888888893,
+    0.49444444444444446, 0.5111111111111111, 0.5166666666666666, 0.5166666666666666,
+    0.5222222222222221, 0.5222222222222221, 0.5222222222222221, 0.5222222222222221,
+    0.5222222222222221, 0.5222222222222221, 0.5222222222222221, 0.5222222222222221,
+    0.5166666666666666, 0.5166666666666666, 0.5166666666666666, 0.5055555555555555,
+    0.49444444444444446, 0.49444444444444446, 0.4722222222222222, 0.46111111111111114,
+    0.44999999999999996, 0.44999999999999996, 0.48888888888888893, 0.4555555555555556,
+    0.46111111111111114, 0.8080001473426819, 1.0, 1.0, 1.0, 1.0, 1.0,
+    0.27521803975105286, 0.4760001003742218, 0.0, 0.6160000562667847, 0.0, 0.0, 0, 1, 0,
+    1, 0, 0, 4060084, 0.5, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+  // Sylvia
+  {{
+    0.4305555555555556, 0.4722222222222222, 0.5055555555555555, 0.5388888888888889,
+    0.6333333333333333, 0.75, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.4277777777777778,
+    0.4277777777777778, 0.4111111111111111, 0.3944444444444445, 0.37777777777777777,
+    0.37222222222222223, 0.3666666666666667, 0.36111111111111116, 0.35,
+    0.34444444444444444, 0.3388888888888889, 0.3388888888888889, 0.3388888888888889,
+    0.3388888888888889, 0.3388888888888889, 0.3388888888888889, 0.3388888888888889,
+    0.3388888888888889, 0.3388888888888889, 0.34444444444444444, 0.35,
+    0.3583333333333333, 0.375, 0.3833333333333333, 0.3916666666666667,
+    0.4083333333333333, 0.41666666666666663, 0.4388888888888889, 0.46111111111111114,
+    0.48611111111111116, 0.5111111111111111, 0.5361111111111111, 0.5611111111111111,
+    0.6055555555555556, 0.6305555555555555, 0.7166666666666667, 0.5611111111111111,
+    0.5333333333333333, 0.5, 0.47777777777777775, 0.4555555555555556,
+    0.44166666666666665, 0.4277777777777778, 0.41388888888888886, 0.4,
+    0.3930555555555556, 0.37916666666666665, 0.37222222222222223, 0.3666666666666667,
+    0.3555555555555555, 0.35, 0.34444444444444444, 0.3388888888888889, 0.3375,
+    0.33472222222222225, 0.33333333333333337, 0.33333333333333337, 0.33333333333333337,
+    0.33333333333333337, 0.33333333333333337, 0.33333333333333337, 0.33333333333333337,
+    0.33333333333333337, 0.33333333333333337, 0.33611111111111114, 0.3416666666666667,
+    0.3472222222222222, 0.35, 0.3555555555555555, 0.37222222222222223,
+    0.3222222222222222, 0.30000000000000004, 0.2777777777777778, 0.24444444444444446,
+    0.21111111111111114, 0.18888888888888888, 0.16666666666666663, 0.15555555555555556,
+    0.1527777777777778, 0.15000000000000002, 0.1444444444444445, 0.1444444444444445,
+    0.1444444444444445, 0.1444444444444445, 0.1444444444444445, 0.1444444444444445,
+    0.14722222222222225, 0.15000000000000002, 0.1527777777777778, 0.15833333333333333,
+    0.1611111111111111, 0.16388888888888886, 0.16666666666666663, 0.17500000000000004,
+    0.18333333333333335, 0.18888888888888888, 0.19444444444444442, 0.19444444444444442,
+    0.18888888888888888, 0.18333333333333335, 0.18333333333333335, 0.18333333333333335,
+    0.18333333333333335, 0.18333333333333335, 0.18333333333333335, 0.18333333333333335,
+    0.18333333333333335, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.05555555555555558, 0.09444444444444444, 0.09999999999999998,
+    0.27222222222222225, 0.22777777777777775, 0.21805555555555556, 0.19861111111111107,
+    0.18888888888888888, 0.16666666666666663, 0.16296293470594614, 0.15555555555555556,
+    0.14814817640516498, 0.1444444444444445, 0.1444444444444445, 0.1444444444444445,
+    0.1444444444444445, 0.1444444444444445, 0.1444444444444445, 0.1444444444444445,
+    0.1444444444444445, 0.1444444444444445, 0.1444444444444445, 0.1444444444444445,
+    0.1444444444444445, 0.1444444444444445, 0.1444444444444445, 0.14777781168619797,
+    0.15444446139865453, 0.1611111111111111, 0.16777776082356766, 0.17444441053602433,
+    0.1777777777777778, 0.18162392510308156, 0.18931621975368929, 0.1970085144042969,
+    0.2047008090549045, 0.21239310370551212, 0.22008539835611984, 0.22777769300672746,
+    0.23546998765733507, 0.24316228230794268, 0.2508545769585504, 0.258546871609158,
+    0.2662391662597656, 0.27393146091037324, 0.2777777777777778, 0.28388892279730904,
+    0.29611108567979605, 0.30833329094780815, 0.32055549621582036, 0.33277770148383246,
+    0.3388888888888889, 0.34444444444444444, 0.3555555555555555, 0.3666666666666667,
+    0.37777777777777777, 0.38888888888888884, 0.3944444444444445, 0.40069444444444446,
+    0.4131944444444444, 0.4256944444444445, 0.43819444444444444, 0.4444444444444444,
+    0.4555555555555556, 0.47777777777777775, 0.48888888888888893, 0.4965277777777778,
+    0.5118055555555556, 0.5270833333333333, 0.5423611111111111, 0.55, 0.5583333333333333,
+    0.575, 0.5916666666666667, 0.6, 0.6152777777777778, 0.6458333333333333,
+    0.6611111111111111, 0.6708333333333334, 0.6902777777777778, 0.7, 0.7166666666666667,
+    0.7333333333333334, 0.7555555555555555, 0.75, 0.7277777777777779, 0.7,
+    0.6833333333333333, 0.65, 0.6361111111111111, 0.6222222222222222, 0.5944444444444444,
+    0.5805555555555555, 0.5666666666666667, 0.5555555555555556, 0.5444444444444445,
+    0.5388888888888889, 0.5333333333333333, 0.5333333333333333, 0.5333333333333333,
+    0.5333333333333333, 0.5333333333333333, 0.5333333333333333, 0.5416666666666667, 0.55,
+    0.5666666666666667, 0.575, 0.5833333333333333, 0.5944444444444444,
+    0.6166666666666667, 0.6111111111111112, 0.5888888888888889, 0.5666666666666667,
+    0.5277777777777778, 0.5, 0.4916666666666667, 0.4833333333333333, 0.4555555555555556,
+    0.44999999999999996, 0.4444444444444444, 0.4388888888888889, 0.4277777777777778,
+    0.4222222222222223, 0.4194444444444444, 0.41666666666666663, 0.4125,
+    0.4041666666666667, 0.4, 0.4, 0.4, 0.4, 0.39722222222222225, 0.3944444444444445,
+    0.3916666666666667, 0.38888888888888884, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.27222222222222225, 0.30000000000000004, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5611111111111111, 0.5888888888888889, 0.6111111111111112, 0.6611111111111111,
+    0.75, 0.8027777777777778, 0.48888888888888893, 0.4666666666666667,
+    0.4388888888888889, 0.4277777777777778, 0.4277777777777778, 0.4277777777777778,
+    0.44166666666666665, 0.4111111111111111, 0.3388888888888889, 0.4666666666666667,
+    0.4111111111111111, 0.21944444444444444, 0.48600006103515625, 1.0, 1.0, 1.0, 1.0,
+    1.0, 0.27521803975105286, 0.1080000102519989, 0.0, 0.0, 0.0, 0.8020000457763672, 0,
+    1, 0, 0, 0, 1, 0, 0.5, 0.5, 0.5, 0.5, 0.7799996733665466, 0,
+  }},
+  // Thisbe
+  {{
+    0.1333333333333333, 0.12777777777777777, 0.125, 0.09485976577096396,
+    0.1071423285940459, 0.5779420405254152, 0.10761888000920027, 0.10471803397575748,
+    0.11530902795055971, 0.12303259604191989, 0.12222222222222223, 0.11013945219407442,
+    0.11601547102986845, 0.12222222222222223, 0.08946370273038745, 0.006502466110839003,
+    0.10343548330944143, 0.09047138913581214, 0.7394630670737894, 0.10673823908287662,
+    0.11185867092365102, 0.10055697028105509, 0.104392308636443, 0.09599208966476316,
+    0.12311147434481176, 0.10587323609331596, 0.11340104329086116, 0.11898373778806817,
+    0.31103390998729885, 0.1043459235983881, 0.10910046781537762, 0.09642338807926062,
+    0.10752350895135106, 0.0937239054762708, 0.11786332802202407, 0.686778571185835,
+    0.10858002316338924, 0.9333333333333333, 0.10913703227684869, 0.810266116482228,
+    0.12365616275774967, 0.7682463864005685, 0.1166666666666667, 0.3128720679885984,
+    0.09605070255584415, 0.12308292621195327, 0.11261897546788403, 0.11257041922647812,
+    0.1014300904596885, 0.11944444444444446, 0.10702712447897934, 0.11199779667162175,
+    0.1043661936368432, 0.11473283970195934, 0.2166439035847784, 0.08489457242086504,
+    0.1166666666666667, 0.10260812049104509, 0.09441900501011535, 0.11311250254394142,
+    0.09756012093112472, 0.07824070670031731, 0.1166666666666667, 0.1166666666666667,
+    0.10180958200843257, 0.092668159021703, 0.1166666666666667, 0.0999600117600196,
+    0.12268636011393685, 0.10630381976615692, 0.09464422911604202, 0.09938514982817548,
+    0.12119724891752506, 0.1232071279995874, 0.1134590135091784, 0.6595716143338415,
+    0.09304952654741108, 0.12021002387844008, 0.11656916309646238, 0.11535772722957455,
+    0.1051790687682627, 0.11650493010904828, 0.12918920606767634, 0.08022613357901767,
+    0.09093288428870262, 0.09767442309062987, 0.10696641153474726, 0.10637545606116205,
+    0.09039175979270662, 0.12222222222222223, 0.4328822000445868, 0.11111739321264708,
+    0.10606523645744978, 0.11663614189679578, 0.1108912707584239, 0.10661226940718461,
+    0.08923710068491184, 0.1062211150085473, 0.10416595327991096, 0.09371729652376079,
+    0.09234949958311077, 0.0962684769652775, 0.107465312122227, 0.2283821485556727,
+    0.1728524793434332, 0.11451131948488219, 0.3332839650039272, 0.04388136217932676,
+    0.7286519274169357, 0.08975875607837347, 0.9534297316245874, 0.11523195246847752,
+    0.11083847148679979, 0.12352544151609376, 0.10705504015498174, 0.34178843102211937,
+    0.09836756056107536, 0.5366822783186104, 0.21101939855243257, 0.09678064033123743,
+    0.09252590976985971, 0.10749936101821617, 0.3975718301670605, 0.919363002563956,
+    0.10054354146699113, 0.1212957200340581, 0.16098883925857588, 0.1762188367292422,
+    0.2004479447835887, 0.1174002616563588, 0.10243338237881994, 0.09356222769121206,
+    0.25010350077991006, 0.12043562955744716, 0.12198455500640308, 0.7,
+    0.7027777777777777, 0.7055555555555555, 0.7055555555555555, 0.7111111111111111,
+    0.7166666666666667, 0.7222222222222222, 0.7277777777777779, 0.7333333333333334,
+    0.7333333333333334, 0.7333333333333334, 0.7444444444444445, 0.7472222222222222, 0.75,
+    0.7555555555555555, 0.7611111111111111, 0.7666666666666666, 0.7694444444444444,
+    0.7722222222222223, 0.7777777777777778, 0.7777777777777778, 0.7777777777777778,
+    0.7777777777777778, 0.7777777777777778, 0.7777777777777778, 0.7777777777777778,
+    0.7777777777777778, 0.7777777777777778, 0.7777777777777778, 0.7777777777777778,
+    0.7777777777777778, 0.7777777777777778, 0.7777777777777778, 0.7777777777777778,
+    0.7777777777777778, 0.7777777777777778, 0.7777777777777778, 0.7777777777777778,
+    0.7777777777777778, 0.7777777777777778, 0.7777777777777778, 0.7777777777777778,
+    0.7777777777777778, 0.7777777777777778, 0.7777777777777778, 0.7777777777777778,
+    0.7777777777777778, 0.7777777777777778, 0.7777777777777778, 0.7722222222222223,
+    0.7666666666666666, 0.7666666666666666, 0.7666666666666666, 0.7666666666666666,
+    0.7666666666666666, 0.7652777777777777, 0.7625, 0.7611111111111111,
+    0.760185178120931, 0.7583333333333333, 0.7564814885457357, 0.7555555555555555,
+    0.7527777777777778, 0.7472222222222222, 0.7444444444444445, 0.7435185114542644,
+    0.7416666666666667, 0.739814821879069, 0.7388888888888889, 0.7388888888888889,
+    0.7388888888888889, 0.7388888888888889, 0.7375, 0.7347222222222223,
+    0.7333333333333334, 0.7314814885457357, 0.7277777777777779, 0.7240740670098198,
+    0.7222222222222222, 0.7222222222222222, 0.7222222222222222, 0.7222222222222222,
+    0.7222222222222222, 0.7222222222222222, 0.7222222222222222, 0.7222222222222222,
+    0.7222222222222222, 0.7222222222222222, 0.7222222222222222, 0.7222222222222222,
+    0.7222222222222222, 0.7222222222222222, 0.7222222222222222, 0.7222222222222222,
+    0.7222222222222222, 0.7222222222222222, 0.7222222222222222, 0.7222222222222222,
+    0.7222222222222222, 0.7222222222222222, 0.7222222222222222, 0.7222222222222222,
+    0.7222222222222222, 0.7222222222222222, 0.7222222222222222, 0.7222222222222222,
+    0.7222222222222222, 0.7222222222222222, 0.7222222222222222, 0.7222222222222222,
+    0.7222222222222222, 0.7222222222222222, 0.7222222222222222, 0.7222222222222222,
+    0.7222222222222222, 0.7222222222222222, 0.7222222222222222, 0.7222222222222222,
+    0.7222222222222222, 0.7222222222222222, 0.7222222222222222, 0.7222222222222222,
+    0.7222222222222222, 0.7222222222222222, 0.7208333333333333, 0.7180555555555556,
+    0.7166666666666667, 0.7166666666666667, 0.7166666666666667, 0.7166666666666667,
+    0.7166666666666667, 0.7166666666666667, 0.7166666666666667, 0.7166666666666667,
+    0.7166666666666667, 0.05555555555555558, 0.05555555555555558, 0.02777777777777779,
+    0.02777777777777779, 0.033333333333333326, 0.033333333333333326, 0.0444444444444444,
+    0.0444444444444444, 0.050000000000000044, 0.050000000000000044, 0.050000000000000044,
+    0.05555555555555558, 0.061111111111111116, 0.061111111111111116,
+    0.061111111111111116, 0.061111111111111116, 0.061111111111111116,
+    0.061111111111111116, 0.06388888888888888, 0.06666666666666665, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.06666666666666665, 0.06666666666666665, 0.06944444444444442, 0.07222222222222219,
+    0.07777777777777772, 0.0888888888888889, 0.0888888888888889, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09999999999999998, 0.10138888888888886, 0.10416666666666663,
+    0.10555555555555551, 0.10555555555555551, 0.10555555555555551, 0.11111111111111116,
+    0.11111111111111116, 0.11111111111111116, 0.11111111111111116, 0.11111111111111116,
+    0.11111111111111116, 0.11111111111111116, 0.11111111111111116, 0.11111111111111116,
+    0.11111111111111116, 0.11111111111111116, 0.11111111111111116, 0.11111111111111116,
+    0.11111111111111116, 0.11111111111111116, 0.11111111111111116, 0.10555555555555551,
+    0.09999999999999998, 0.09999999999999998, 0.09999999999999998, 0.0888888888888889,
+    0.08333333333333337, 0.08333333333333337, 0.07777777777777772, 0.07777777777777772,
+    0.07222222222222219, 0.07222222222222219, 0.06666666666666665, 0.061111111111111116,
+    0.05555555555555558, 0.050000000000000044, 0.0444444444444444, 0.0444444444444444,
+    0.0444444444444444, 0.0444444444444444, 0.061111111111111116, 0.061111111111111116,
+    0.061111111111111116, 0.061111111111111116, 0.061111111111111116,
+    0.061111111111111116, 0.06666666666666665, 0.07222222222222219, 0.07777777777777772,
+    0.08333333333333337, 0.08333333333333337, 0.08333333333333337, 0.08333333333333337,
+    0.08333333333333337, 0.07222222222222219, 0.07222222222222219, 0.07222222222222219,
+    0.07222222222222219, 0.06666666666666665, 0.06666666666666665, 0.06666666666666665,
+    0.05555555555555558, 0.05555555555555558, 0.0444444444444444, 0.0444444444444444,
+    0.0444444444444444, 0.04166666666666663, 0.07222222222222219, 0.0888888888888889,
+    0.12777777777777777, 0.15000000000000002, 0.15000000000000002, 0.15000000000000002,
+    0.15000000000000002, 0.1444444444444445, 0.09166666666666667, 0.06944444444444442,
+    0.05833333333333335, 0.0888888888888889, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    0.27521803975105286, 0.0, 1.0, 0.0, 0.0, 0.0, 0, 0, 1, 0, 0, 0, 0, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0,
+  }},
+  // Ursula
+  {{
+    0.9675972284378292, 0.9737619507325039, 0.9349569920686089, 0.9730052043199166, 1.0,
+    0.9323904470984209, 0.9778472367932993, 0.9790282556717604, 0.904778464023805,
+    0.9966720000828131, 0.9673208840852622, 0.8564100539639783, 0.7517710236865999,
+    0.9422148870229836, 0.9151592738410491, 0.8312379848456991, 0.800187936569973,
+    0.9940051132429029, 0.8255780037005193, 0.9849778728482328, 0.7855634114349351,
+    0.8775931747240622, 0.9083450096709597, 0.7316344413924691, 0.728498260806082,
+    0.8038798471742429, 0.964215644310434, 0.8393987573924704, 0.9507141239377584,
+    0.7388321351037022, 0.6764226059183654, 0.746497681579247, 0.8014120265499501,
+    0.7618080235277201, 0.8300710385176563, 0.7132731370889166, 0.7693728510088432,
+    0.9016568167205542, 0.7225087169929348, 0.7273739180959387, 0.8432329133573286,
+    0.7016171061478023, 0.7116136222099926, 0.653635672964742, 0.6737994303960867,
+    0.9163541906166244, 0.7051815159875386, 0.7301987753761955, 0.6274615317856739,
+    0.5917210723042514, 0.7628386305510996, 0.6640273044295018, 0.7637386792621768,
+    0.6459204888146061, 0.6895021564251409, 0.5327213898905763, 0.470487711780308,
+    0.7127034174465842, 0.7107196143866273, 0.5961463153235861, 0.5202969902649486,
+    0.6148917037995355, 0.558924447085691, 0.49880394337842626, 0.6614907629171531,
+    0.4789987871441561, 0.6612917085138651, 0.5330668645567422, 0.5357869007183452,
+    0.4169329625465612, 0.3448345538577391, 0.5921857483527146, 0.38917274088217885,
+    0.5527098333379146, 0.4855884614461328, 0.39075250781129006, 0.42859092441485336,
+    0.44588918827844554, 0.4838245831449003, 0.36480415293643115, 0.29326864451441764,
+    0.5559995977936854, 0.32768038294211793, 0.36235891066315773, 0.2741467905329669,
+    0.4275027979642087, 0.366126148920221, 0.4258392095505637, 0.36930488982779164,
+    0.2870588447434984, 0.44345703033422706, 0.23196508216789988, 0.1443377555428387,
+    0.20759838776081715, 0.16243937029166772, 0.33906971237395417, 0.2527200596256337,
+    0.1652097274720785, 0.34135998633591247, 0.3137352284105213, 0.3298332701963019,
+    0.10218302820446308, 0.1890516669590048, 0.14979878367568794, 0.15731362711526697,
+    0.2502882294531503, 0.24962447525036272, 0.1333333333333333, 0.10555555555555551,
+    0.07777777777777772, 0.05555555555555558, 0.03888888888888886, 0.03888888888888886,
+    0.03888888888888886, 0.03888888888888886, 0.0444444444444444, 0.050000000000000044,
+    0.06666666666666665, 0.07222222222222219, 0.0888888888888889, 0.09999999999999998,
+    0.1166666666666667, 0.1333333333333333, 0.1333333333333333, 0.12222222222222223,
+    0.1166666666666667, 0.1166666666666667, 0.1166666666666667, 0.1166666666666667,
+    0.11111111111111116, 0.09999999999999998, 0.0888888888888889, 0.08333333333333337,
+    0.06666666666666665, 0.06666666666666665, 0.07420059904732157, 0.03299101820504674,
+    0.2176337043758365, 0.19859002504742312, 0.04510965631518543, 0.14567361660438138,
+    0.1590495756478777, 0.08352345518960874, 0.21508176094570164, 0.29727079702982734,
+    0.3718916645929716, 0.28318275532821446, 0.34208213690346434, 0.28599234531296014,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09999999999999998, 0.10555555555555551, 0.1166666666666667,
+    0.15000000000000002, 0.1694444444444444, 0.18888888888888888, 0.2777777777777778,
+    0.33333333333333337, 0.38888888888888884, 0.5222222222222221, 0.7222222222222222,
+    0.8, 0.8222222222222222, 0.8333333333333334, 0.8333333333333334, 0.8333333333333334,
+    0.8277777777777777, 0.8222222222222222, 0.8, 0.7888888888888889, 0.7722222222222223,
+    0.7555555555555555, 0.7388888888888889, 0.7277777777777779, 0.7194444444444444, 0.7,
+    0.6888888888888889, 0.6805555555555556, 0.6722222222222223, 0.6611111111111111,
+    0.6555555555555556, 0.65, 0.6472222222222221, 0.6416666666666666, 0.6361111111111111,
+    0.6305555555555555, 0.6277777777777778, 0.6277777777777778, 0.6277777777777778,
+    0.6277777777777778, 0.6277777777777778, 0.6277777777777778, 0.6277777777777778,
+    0.6277777777777778, 0.6277777777777778, 0.6444444444444444, 0.6722222222222223, 0.7,
+    0.75, 0.8444444444444444, 0.9444444444444444, 0.9444444444444444, 0.8944444444444445,
+    0.8333333333333334, 0.7555555555555555, 0.7277777777777779, 0.7, 0.6444444444444444,
+    0.5888888888888889, 0.5527777777777778, 0.5166666666666666, 0.48611111111111116,
+    0.4555555555555556, 0.4111111111111111, 0.37777777777777777, 0.36944444444444446,
+    0.36111111111111116, 0.33333333333333337, 0.3222222222222222, 0.3111111111111111,
+    0.3055555555555556, 0.3027777777777778, 0.30000000000000004, 0.30000000000000004,
+    0.30000000000000004, 0.30000000000000004, 0.30000000000000004, 0.30000000000000004,
+    0.30000000000000004, 0.30000000000000004, 0.30000000000000004, 0.30000000000000004,
+    0.30000000000000004, 0.30000000000000004, 0.30092591179741757, 0.3027777777777778,
+    0.30462964375813806, 0.3055555555555556, 0.3074074215359158, 0.3111111111111111,
+    0.3148148006863064, 0.31666666666666665, 0.32499999999999996, 0.3416666666666667,
+    0.35, 0.3509259117974175, 0.35277777777777775, 0.354629643758138, 0.3555555555555555,
+    0.35648146735297304, 0.3583333333333333, 0.3601851993136935, 0.36111111111111116,
+    0.36111111111111116, 0.36111111111111116, 0.36111111111111116, 0.36111111111111116,
+    0.36111111111111116, 0.36111111111111116, 0.3597222222222223, 0.3569444444444444,
+    0.3555555555555555, 0.3277777777777777, 0.3138888888888889, 0.30000000000000004,
+    0.30628456339601706, 0.0, 0.05555555555555558, 0.05555555555555558,
+    0.05555555555555558, 0.05833333333333335, 0.06388888888888888, 0.06944444444444442,
+    0.07222222222222219, 0.07361111111111107, 0.07638888888888884, 0.07777777777777772,
+    0.07777777777777772, 0.07777777777777772, 0.07777777777777772, 0.07777777777777772,
+    0.0783950805664062, 0.07962968614366317, 0.08086429172092013, 0.0820988972981771,
+    0.08333350287543406, 0.08456810845269103, 0.08580271402994788, 0.08703731960720484,
+    0.08827192518446181, 0.0888888888888889, 0.0888888888888889, 0.0888888888888889,
+    0.0888888888888889, 0.0888888888888889, 0.0888888888888889, 0.0888888888888889,
+    0.0888888888888889, 0.0888888888888889, 0.0888888888888889, 0.0888888888888889,
+    0.0888888888888889, 0.0888888888888889, 0.0888888888888889, 0.0888888888888889,
+    0.0888888888888889, 0.0888888888888889, 0.0888888888888889, 0.0888888888888889,
+    0.0888888888888889, 0.0888888888888889, 0.0888888888888889, 0.0888888888888889,
+    0.0888888888888889, 0.0888888888888889, 0.08981484307183163, 0.09166666666666667,
+    0.09351849026150172, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.09444444444444444,
+    0.09444444444444444, 0.09444444444444444, 0.09444444444444444, 0.05555555555555558,
+    0.05555555555555558, 0.050000000000000044, 0.0444444444444444, 0.04166666666666663,
+    0.022222222222222254, 0.05555555555555558, 0.05555555555555558, 0.05555555555555558,
+    0.02777777777777779, 0.033333333333333326, 0.0444444444444444, 0.03888888888888886,
+    0.061111111111111116, 0.07777777777777772, 0.09999999999999998, 0.12777777777777777,
+    0.1333333333333333, 0.1333333333333333, 0.1333333333333333, 0.1333333333333333,
+    0.1333333333333333, 0.13888888888888884, 0.14166666666666672, 0.1444444444444445,
+    0.1444444444444445, 0.1444444444444445, 0.1611111111111111, 0.1611111111111111,
+    0.1611111111111111, 0.15555555555555556, 0.14166666666666672, 0.01666666666666672,
+    0.02777777777777779, 0.07777777777777772, 0.09999999999999998, 0.09999999999999998,
+    0.09999999999999998, 0.09999999999999998, 0.11111111111111116, 0.11111111111111116,
+    0.050000000000000044, 0.09444444444444444, 0.1333333333333333, 0.02199983969330788,
+    1.0, 1.0, 1.0, 1.0, 1.0, 0.6440005898475647, 1.0, 1.0, 1.0, 1.0, 1.0, 1, 1, 1, 1, 1,
+    1, 0, 0.04000014066696167, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+  // Vesta
+  {{
+    0.6305555555555555, 0.6, 0.5833333333333333, 0.55, 0.5111111111111111,
+    0.4722222222222222, 0.4555555555555556, 0.4388888888888889, 0.40555555555555556,
+    0.37777777777777777, 0.36111111111111116, 0.3555555555555555, 0.3416666666666667,
+    0.3277777777777777, 0.3138888888888889, 0.30000000000000004, 0.28888888888888886,
+    0.2777777777777778, 0.2694444444444445, 0.26111111111111107, 0.25, 0.25,
+    0.25555555555555554, 0.2944444444444444, 0.3055555555555556, 0.3222222222222222,
+    0.23333333333333328, 0.22777777777777775, 0.23888888888888893, 0.25555555555555554,
+    0.27222222222222225, 0.2972222222222223, 0.3222222222222222, 0.3416666666666667,
+    0.36111111111111116, 0.37777777777777777, 0.4111111111111111, 0.4277777777777778,
+    0.45833333333333337, 0.48888888888888893, 0.5277777777777778, 0.5611111111111111,
+    0.5944444444444444, 0.6333333333333333, 0.6666666666666667, 0.675,
+    0.6888888888888889, 0.65, 0.6277777777777778, 0.6027777777777779, 0.5777777777777777,
+    0.5611111111111111, 0.5277777777777778, 0.5138888888888888, 0.5, 0.49444444444444446,
+    0.48888888888888893, 0.47777777777777775, 0.475, 0.4722222222222222,
+    0.4722222222222222, 0.4722222222222222, 0.4722222222222222, 0.4722222222222222,
+    0.4666666666666667, 0.46111111111111114, 0.46111111111111114, 0.46111111111111114,
+    0.46111111111111114, 0.46111111111111114, 0.46111111111111114, 0.46111111111111114,
+    0.46111111111111114, 0.4388888888888889, 0.4277777777777778, 0.4111111111111111,
+    0.3944444444444445, 0.38611111111111107, 0.37777777777777777, 0.375,
+    0.37222222222222223, 0.3666666666666667, 0.36111111111111116, 0.3583333333333333,
+    0.3555555555555555, 0.3555555555555555, 0.3555555555555555, 0.3555555555555555,
+    0.3555555555555555, 0.3555555555555555, 0.3833333333333333, 0.33333333333333337,
+    0.3055555555555556, 0.28888888888888886, 0.2833333333333333, 0.27222222222222225,
+    0.27083333333333337, 0.2680555555555556, 0.2666666666666667, 0.2666666666666667,
+    0.2666666666666667, 0.2666666666666667, 0.2666666666666667, 0.2666666666666667,
+    0.2666666666666667, 0.2666666666666667, 0.2666666666666667, 0.2666666666666667,
+    0.2694444444444445, 0.27222222222222225, 0.275, 0.2777777777777778,
+    0.28194444444444444, 0.29027777777777775, 0.2944444444444444, 0.30000000000000004,
+    0.3055555555555556, 0.3194444444444444, 0.33333333333333337, 0.3472222222222222,
+    0.36111111111111116, 0.38888888888888884, 0.4, 0.4111111111111111,
+    0.4388888888888889, 0.4555555555555556, 0.46111111111111114, 0.47777777777777775,
+    0.47777777777777775, 0.47777777777777775, 0.4833333333333333, 0.4833333333333333,
+    0.4666666666666667, 0.4444444444444444, 0.41666666666666663, 0.11111111111111116,
+    0.15555555555555556, 0.19444444444444442, 0.23333333333333328, 0.2833333333333333,
+    0.36111111111111116, 0.4, 0.4444444444444444, 0.5, 0.5, 0.5, 0.5, 0.6361111111111111,
+    0.6444444444444444, 0.65, 0.6527777777777778, 0.6555555555555556, 0.6555555555555556,
+    0.6555555555555556, 0.6555555555555556, 0.6555555555555556, 0.6555555555555556,
+    0.6555555555555556, 0.6555555555555556, 0.6555555555555556, 0.6555555555555556,
+    0.6555555555555556, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.1611111111111111,
+    0.1611111111111111, 0.15555555555555556, 0.15000000000000002, 0.15000000000000002,
+    0.15000000000000002, 0.15000000000000002, 0.15000000000000002, 0.15000000000000002,
+    0.15000000000000002, 0.15000000000000002, 0.15000000000000002, 0.15000000000000002,
+    0.15000000000000002, 0.15000000000000002, 0.15000000000000002, 0.15000000000000002,
+    0.15000000000000002, 0.15000000000000002, 0.15185182359483507, 0.15555555555555556,
+    0.15925928751627605, 0.1611111111111111, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.85, 0.85, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.0888888888888889, 0.5, 0.5, 0.5, 0.21944444444444444, 0.2055555555555556,
+    0.19999999999999996, 0.19999999999999996, 0.19999999999999996, 0.19999999999999996,
+    0.27222222222222225, 0.3055555555555556, 0.37222222222222223, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.23888888888888893, 0.23888888888888893, 0.23888888888888893,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.8222222222222222, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.7277777777777779, 0.7277777777777779, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.31666666666666665, 0.3111111111111111,
+    0.3055555555555556, 0.3055555555555556, 0.30000000000000004, 0.30000000000000004,
+    0.30000000000000004, 0.2944444444444444, 0.2944444444444444, 0.5, 0.7444444444444445,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.19999999999999996, 0.19444444444444442,
+    0.19444444444444442, 0.21111111111111114, 0.22777777777777775, 0.27222222222222225,
+    0.30000000000000004, 0.35, 0.3680555555555556, 0.4041666666666667,
+    0.4222222222222223, 0.4305555555555556, 0.4388888888888889, 0.4388888888888889,
+    0.4388888888888889, 0.4388888888888889, 0.4388888888888889, 0.4277777777777778,
+    0.38888888888888884, 0.3111111111111111, 0.2833333333333333, 0.2416666666666667, 0.5,
+    0.5, 0.5, 0.5, 0.13055555555555554, 0.5, 0.7944444444444445, 0.5, 0.7555555555555555,
+    0.7555555555555555, 0.5, 0.5, 0.5, 0.7555555555555555, 0.5, 0.24444444444444446,
+    0.7539997100830078, 1.0, 1.0, 1.0, 1.0, 1.0, 0.2752180285130085, 0.0, 0.0, 0.0, 0.0,
+    0.0, 1, 0, 0, 0, 0, 0, 0, 0.5, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+}};
 
-    case presetHektor: {
-      value[ID::time0 + 0]->setFromNormalized(0.061111111111111116);
-      value[ID::time0 + 1]->setFromNormalized(0.06466166178385413);
-      value[ID::time0 + 2]->setFromNormalized(0.07176276312934027);
-      value[ID::time0 + 3]->setFromNormalized(0.0788638644748264);
-      value[ID::time0 + 4]->setFromNormalized(0.08596496582031254);
-      value[ID::time0 + 5]->setFromNormalized(0.09306606716579857);
-      value[ID::time0 + 6]->setFromNormalized(0.10016716851128471);
-      value[ID::time0 + 7]->setFromNormalized(0.10726826985677085);
-      value[ID::time0 + 8]->setFromNormalized(0.11436937120225699);
-      value[ID::time0 + 9]->setFromNormalized(0.12147047254774301);
-      value[ID::time0 + 10]->setFromNormalized(0.12857157389322915);
-      value[ID::time0 + 11]->setFromNormalized(0.1356726752387153);
-      value[ID::time0 + 12]->setFromNormalized(0.14277377658420143);
-      value[ID::time0 + 13]->setFromNormalized(0.14987487792968746);
-      value[ID::time0 + 14]->setFromNormalized(0.1569759792751736);
-      value[ID::time0 + 15]->setFromNormalized(0.16407708062065973);
-      value[ID::time0 + 16]->setFromNormalized(0.17117818196614587);
-      value[ID::time0 + 17]->setFromNormalized(0.1782792833116319);
-      value[ID::time0 + 18]->setFromNormalized(0.18538038465711804);
-      value[ID::time0 + 19]->setFromNormalized(0.19248148600260417);
-      value[ID::time0 + 20]->setFromNormalized(0.1995825873480903);
-      value[ID::time0 + 21]->setFromNormalized(0.20668368869357634);
-      value[ID::time0 + 22]->setFromNormalized(0.21378479003906248);
-      value[ID::time0 + 23]->setFromNormalized(0.22088589138454862);
-      value[ID::time0 + 24]->setFromNormalized(0.22798699273003475);
-      value[ID::time0 + 25]->setFromNormalized(0.23508809407552078);
-      value[ID::time0 + 26]->setFromNormalized(0.24218919542100692);
-      value[ID::time0 + 27]->setFromNormalized(0.24929029676649306);
-      value[ID::time0 + 28]->setFromNormalized(0.2563913981119792);
-      value[ID::time0 + 29]->setFromNormalized(0.2634924994574652);
-      value[ID::time0 + 30]->setFromNormalized(0.27059360080295136);
-      value[ID::time0 + 31]->setFromNormalized(0.2776947021484375);
-      value[ID::time0 + 32]->setFromNormalized(0.28479580349392364);
-      value[ID::time0 + 33]->setFromNormalized(0.2918969048394098);
-      value[ID::time0 + 34]->setFromNormalized(0.2989980061848958);
-      value[ID::time0 + 35]->setFromNormalized(0.30609910753038194);
-      value[ID::time0 + 36]->setFromNormalized(0.3132002088758681);
-      value[ID::time0 + 37]->setFromNormalized(0.3203013102213542);
-      value[ID::time0 + 38]->setFromNormalized(0.32740241156684025);
-      value[ID::time0 + 39]->setFromNormalized(0.3345035129123264);
-      value[ID::time0 + 40]->setFromNormalized(0.3416046142578125);
-      value[ID::time0 + 41]->setFromNormalized(0.34870571560329866);
-      value[ID::time0 + 42]->setFromNormalized(0.3558068169487847);
-      value[ID::time0 + 43]->setFromNormalized(0.3629079182942708);
-      value[ID::time0 + 44]->setFromNormalized(0.37000901963975696);
-      value[ID::time0 + 45]->setFromNormalized(0.3771101209852431);
-      value[ID::time0 + 46]->setFromNormalized(0.38421122233072913);
-      value[ID::time0 + 47]->setFromNormalized(0.39131232367621527);
-      value[ID::time0 + 48]->setFromNormalized(0.3984134250217014);
-      value[ID::time0 + 49]->setFromNormalized(0.40551452636718754);
-      value[ID::time0 + 50]->setFromNormalized(0.41261562771267357);
-      value[ID::time0 + 51]->setFromNormalized(0.4197167290581597);
-      value[ID::time0 + 52]->setFromNormalized(0.42681783040364585);
-      value[ID::time0 + 53]->setFromNormalized(0.433918931749132);
-      value[ID::time0 + 54]->setFromNormalized(0.441020033094618);
-      value[ID::time0 + 55]->setFromNormalized(0.44812113444010415);
-      value[ID::time0 + 56]->setFromNormalized(0.4552222357855903);
-      value[ID::time0 + 57]->setFromNormalized(0.46232333713107643);
-      value[ID::time0 + 58]->setFromNormalized(0.46942443847656246);
-      value[ID::time0 + 59]->setFromNormalized(0.4765255398220486);
-      value[ID::time0 + 60]->setFromNormalized(0.48362664116753473);
-      value[ID::time0 + 61]->setFromNormalized(0.49072774251302087);
-      value[ID::time0 + 62]->setFromNormalized(0.4978288438585069);
-      value[ID::time0 + 63]->setFromNormalized(0.504929945203993);
-      value[ID::time0 + 64]->setFromNormalized(0.5120310465494792);
-      value[ID::time0 + 65]->setFromNormalized(0.5191321478949653);
-      value[ID::time0 + 66]->setFromNormalized(0.5262332492404513);
-      value[ID::time0 + 67]->setFromNormalized(0.5333343505859375);
-      value[ID::time0 + 68]->setFromNormalized(0.5404354519314236);
-      value[ID::time0 + 69]->setFromNormalized(0.5475365532769096);
-      value[ID::time0 + 70]->setFromNormalized(0.5546376546223959);
-      value[ID::time0 + 71]->setFromNormalized(0.5617387559678819);
-      value[ID::time0 + 72]->setFromNormalized(0.5688398573133681);
-      value[ID::time0 + 73]->setFromNormalized(0.5759409586588542);
-      value[ID::time0 + 74]->setFromNormalized(0.5830420600043402);
-      value[ID::time0 + 75]->setFromNormalized(0.5901431613498264);
-      value[ID::time0 + 76]->setFromNormalized(0.5972442626953125);
-      value[ID::time0 + 77]->setFromNormalized(0.6043453640407986);
-      value[ID::time0 + 78]->setFromNormalized(0.6114464653862848);
-      value[ID::time0 + 79]->setFromNormalized(0.6185475667317708);
-      value[ID::time0 + 80]->setFromNormalized(0.6256486680772569);
-      value[ID::time0 + 81]->setFromNormalized(0.6327497694227431);
-      value[ID::time0 + 82]->setFromNormalized(0.6398508707682291);
-      value[ID::time0 + 83]->setFromNormalized(0.6469519721137154);
-      value[ID::time0 + 84]->setFromNormalized(0.6540530522664387);
-      value[ID::time0 + 85]->setFromNormalized(0.6611541324191623);
-      value[ID::time0 + 86]->setFromNormalized(0.6682552125718859);
-      value[ID::time0 + 87]->setFromNormalized(0.6753562927246094);
-      value[ID::time0 + 88]->setFromNormalized(0.6824573728773329);
-      value[ID::time0 + 89]->setFromNormalized(0.6895584530300565);
-      value[ID::time0 + 90]->setFromNormalized(0.69665953318278);
-      value[ID::time0 + 91]->setFromNormalized(0.7037606133355034);
-      value[ID::time0 + 92]->setFromNormalized(0.710861693488227);
-      value[ID::time0 + 93]->setFromNormalized(0.7179627736409505);
-      value[ID::time0 + 94]->setFromNormalized(0.725063853793674);
-      value[ID::time0 + 95]->setFromNormalized(0.7321649339463976);
-      value[ID::time0 + 96]->setFromNormalized(0.7392660140991211);
-      value[ID::time0 + 97]->setFromNormalized(0.7463670942518446);
-      value[ID::time0 + 98]->setFromNormalized(0.7534681744045681);
-      value[ID::time0 + 99]->setFromNormalized(0.7605692545572916);
-      value[ID::time0 + 100]->setFromNormalized(0.7676703347100152);
-      value[ID::time0 + 101]->setFromNormalized(0.7747714148627387);
-      value[ID::time0 + 102]->setFromNormalized(0.7818724950154623);
-      value[ID::time0 + 103]->setFromNormalized(0.7889735751681858);
-      value[ID::time0 + 104]->setFromNormalized(0.7960746553209093);
-      value[ID::time0 + 105]->setFromNormalized(0.8031757354736329);
-      value[ID::time0 + 106]->setFromNormalized(0.8102768156263563);
-      value[ID::time0 + 107]->setFromNormalized(0.8173778957790798);
-      value[ID::time0 + 108]->setFromNormalized(0.8244789653354221);
-      value[ID::time0 + 109]->setFromNormalized(0.8315800560845269);
-      value[ID::time0 + 110]->setFromNormalized(0.8386811468336317);
-      value[ID::time0 + 111]->setFromNormalized(0.8457822375827365);
-      value[ID::time0 + 112]->setFromNormalized(0.8528833283318413);
-      value[ID::time0 + 113]->setFromNormalized(0.8599844190809462);
-      value[ID::time0 + 114]->setFromNormalized(0.867085509830051);
-      value[ID::time0 + 115]->setFromNormalized(0.8741866005791559);
-      value[ID::time0 + 116]->setFromNormalized(0.8812876913282607);
-      value[ID::time0 + 117]->setFromNormalized(0.8883887820773655);
-      value[ID::time0 + 118]->setFromNormalized(0.8954898728264703);
-      value[ID::time0 + 119]->setFromNormalized(0.9025909635755751);
-      value[ID::time0 + 120]->setFromNormalized(0.9096920543246799);
-      value[ID::time0 + 121]->setFromNormalized(0.9167931450737847);
-      value[ID::time0 + 122]->setFromNormalized(0.9238942305246989);
-      value[ID::time0 + 123]->setFromNormalized(0.930995315975613);
-      value[ID::time0 + 124]->setFromNormalized(0.9380964014265273);
-      value[ID::time0 + 125]->setFromNormalized(0.9451974868774414);
-      value[ID::time0 + 126]->setFromNormalized(0.9522985723283556);
-      value[ID::time0 + 127]->setFromNormalized(0.9593996551301744);
-      value[ID::time0 + 128]->setFromNormalized(0.9665007405810886);
-      value[ID::time0 + 129]->setFromNormalized(0.9736018260320027);
-      value[ID::time0 + 130]->setFromNormalized(0.9807029114829169);
-      value[ID::time0 + 131]->setFromNormalized(0.9878039969338311);
-      value[ID::time0 + 132]->setFromNormalized(0.994905083378156);
-      value[ID::time0 + 133]->setFromNormalized(1.0);
-      value[ID::time0 + 134]->setFromNormalized(1.0);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.46111111111111114);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.47777777777777786);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.46111111111111114);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.5388888888888889);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.46111111111111114);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.46111111111111114);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.46111111111111114);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.4638888888888889);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.4666666666666667);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.46944444444444444);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.5277777777777778);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.4722222222222222);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.5277777777777778);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.4722222222222222);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.5277777777777778);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.5222222222222223);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.5222222222222223);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.3277777777777777);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.34444444444444444);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.6222222222222222);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.6222222222222222);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.3666666666666667);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.36111111111111116);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.3555555555555556);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.35);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.6611111111111111);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.33333333333333326);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.31666666666666665);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.6888888888888889);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.7055555555555555);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.7222222222222222);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.7361111111111112);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.75);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.7638888888888888);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.2222222222222222);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.18888888888888888);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.1777777777777778);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.1611111111111111);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.17222222222222228);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.8);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.21944444444444444);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.7611111111111111);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.2777777777777778);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.6972222222222222);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.6722222222222223);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.3388888888888889);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.6055555555555556);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.5930555555555556);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.5680555555555555);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.4444444444444444);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.5493055555555555);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.5368055555555555);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.5243055555555556);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.4881944444444444);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.49444444444444446);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.5027777777777778);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.5194444444444445);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.4722222222222222);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.5444444444444444);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.44999999999999996);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.5541666666666667);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.5625);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.5666666666666667);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.5694444444444444);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.42500000000000004);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.5777777777777777);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.41666666666666663);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.5902777777777778);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.40694444444444444);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.5944444444444444);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.5972222222222222);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.6027777777777777);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.3916666666666667);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.6120370229085287);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.6138888888888889);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.6157407548692492);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.3819444444444444);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.37916666666666665);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.6222222222222222);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.38055555555555554);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.6166666666666667);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.3944444444444445);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.5944444444444444);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.41388888888888886);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.41666666666666663);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.4222222222222223);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.5666666666666667);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.5555555555555556);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.5527777777777778);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.55);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.4555555555555556);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.5388888888888889);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.46944444444444444);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.47777777777777775);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.49444444444444446);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.5055555555555555);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.4833333333333334);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.5388888888888889);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.5527777777777778);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.43333333333333335);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.3944444444444444);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.4027777777777778);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.41666666666666674);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.4388888888888889);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.46111111111111114);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.5166666666666667);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.5333333333333333);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.5611111111111111);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.5666666666666667);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.4222222222222223);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.5888888888888889);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.5888888888888889);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.5888888888888889);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.5888888888888889);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.41666666666666663);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.4222222222222223);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.4277777777777778);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.7444444444444445);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.75);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.7277777777777779);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.6944444444444444);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.6333333333333333);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.5555555555555556);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.5055555555555555);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.41666666666666663);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.38888888888888884);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.36111111111111116);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.3111111111111111);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.26111111111111107);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.2222222222222222);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.18888888888888888);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.1777777777777778);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.15555555555555556);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.15000000000000002);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.14722222222222225);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.1444444444444445);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.1444444444444445);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.1444444444444445);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.15555555555555556);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.1777777777777778);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.23333333333333328);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.30000000000000004);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.34444444444444444);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.44999999999999996);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.3944444444444445);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.4833333333333333);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.40555555555555556);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.3111111111111111);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.3111111111111111);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.40555555555555556);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.5111111111111111);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.5222222222222221);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.46944444444444444);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.21666666666666667);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.26111111111111107);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.19166666666666665);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::d1FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d2FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d3FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.27521803975105286);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.4760001003742218);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.6160000562667847);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(1);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(1);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(0);
-      value[ID::seed]->setFromInt(4060084);
-      value[ID::stereoCross]->setFromNormalized(0.2719998061656952);
-      value[ID::stereoSpread]->setFromNormalized(0.6159999370574951);
-      value[ID::dry]->setFromNormalized(0.0);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetHerculina: {
-      value[ID::time0 + 0]->setFromNormalized(0.0733890894869915);
-      value[ID::time0 + 1]->setFromNormalized(0.14352005040209415);
-      value[ID::time0 + 2]->setFromNormalized(0.20860313038321823);
-      value[ID::time0 + 3]->setFromNormalized(0.26726760073780975);
-      value[ID::time0 + 4]->setFromNormalized(0.3185827410260602);
-      value[ID::time0 + 5]->setFromNormalized(0.36203110029895946);
-      value[ID::time0 + 6]->setFromNormalized(0.3974547187743647);
-      value[ID::time0 + 7]->setFromNormalized(0.4249944855618064);
-      value[ID::time0 + 8]->setFromNormalized(0.44503698425529337);
-      value[ID::time0 + 9]->setFromNormalized(0.4581746677385027);
-      value[ID::time0 + 10]->setFromNormalized(0.4651768032371649);
-      value[ID::time0 + 11]->setFromNormalized(0.46696274728993326);
-      value[ID::time0 + 12]->setFromNormalized(0.46456741364545373);
-      value[ID::time0 + 13]->setFromNormalized(0.45909183232046746);
-      value[ID::time0 + 14]->setFromNormalized(0.4516385256593247);
-      value[ID::time0 + 15]->setFromNormalized(0.44323959364018006);
-      value[ID::time0 + 16]->setFromNormalized(0.43479158513894156);
-      value[ID::time0 + 17]->setFromNormalized(0.4270125183596737);
-      value[ID::time0 + 18]->setFromNormalized(0.4204316534244108);
-      value[ID::time0 + 19]->setFromNormalized(0.4154131539457132);
-      value[ID::time0 + 20]->setFromNormalized(0.41220404935233035);
-      value[ID::time0 + 21]->setFromNormalized(0.4109890935467384);
-      value[ID::time0 + 22]->setFromNormalized(0.41193333249458863);
-      value[ID::time0 + 23]->setFromNormalized(0.415198192888304);
-      value[ID::time0 + 24]->setFromNormalized(0.4209267546748553);
-      value[ID::time0 + 25]->setFromNormalized(0.4292047927076688);
-      value[ID::time0 + 26]->setFromNormalized(0.4400121211239377);
-      value[ID::time0 + 27]->setFromNormalized(0.45318107143172703);
-      value[ID::time0 + 28]->setFromNormalized(0.4683752795925523);
-      value[ID::time0 + 29]->setFromNormalized(0.4850944052692179);
-      value[ID::time0 + 30]->setFromNormalized(0.5027023794374141);
-      value[ID::time0 + 31]->setFromNormalized(0.5204715259607517);
-      value[ID::time0 + 32]->setFromNormalized(0.5376340800724917);
-      value[ID::time0 + 33]->setFromNormalized(0.5534355766557408);
-      value[ID::time0 + 34]->setFromNormalized(0.567188709739493);
-      value[ID::time0 + 35]->setFromNormalized(0.5783284007108925);
-      value[ID::time0 + 36]->setFromNormalized(0.5864669958220587);
-      value[ID::time0 + 37]->setFromNormalized(0.5914433106527974);
-      value[ID::time0 + 38]->setFromNormalized(0.5933537657507351);
-      value[ID::time0 + 39]->setFromNormalized(0.5925522552471172);
-      value[ID::time0 + 40]->setFromNormalized(0.5896104027449409);
-      value[ID::time0 + 41]->setFromNormalized(0.5852408436118989);
-      value[ID::time0 + 42]->setFromNormalized(0.5801988527787904);
-      value[ID::time0 + 43]->setFromNormalized(0.5751860040663409);
-      value[ID::time0 + 44]->setFromNormalized(0.570779028504677);
-      value[ID::time0 + 45]->setFromNormalized(0.5673971605881092);
-      value[ID::time0 + 46]->setFromNormalized(0.5653062058667058);
-      value[ID::time0 + 47]->setFromNormalized(0.564644202010271);
-      value[ID::time0 + 48]->setFromNormalized(0.5654479747518045);
-      value[ID::time0 + 49]->setFromNormalized(0.5676643565528197);
-      value[ID::time0 + 50]->setFromNormalized(0.571141685536214);
-      value[ID::time0 + 51]->setFromNormalized(0.5756103443813125);
-      value[ID::time0 + 52]->setFromNormalized(0.5806691301255031);
-      value[ID::time0 + 53]->setFromNormalized(0.5857935717621024);
-      value[ID::time0 + 54]->setFromNormalized(0.590373703798293);
-      value[ID::time0 + 55]->setFromNormalized(0.5937767150634746);
-      value[ID::time0 + 56]->setFromNormalized(0.5954200450450298);
-      value[ID::time0 + 57]->setFromNormalized(0.5948370742543557);
-      value[ID::time0 + 58]->setFromNormalized(0.5917214099519059);
-      value[ID::time0 + 59]->setFromNormalized(0.5859444531421206);
-      value[ID::time0 + 60]->setFromNormalized(0.577550232400768);
-      value[ID::time0 + 61]->setFromNormalized(0.5667375189726827);
-      value[ID::time0 + 62]->setFromNormalized(0.5538400049670933);
-      value[ID::time0 + 63]->setFromNormalized(0.5393112133254392);
-      value[ID::time0 + 64]->setFromNormalized(0.523714055503173);
-      value[ID::time0 + 65]->setFromNormalized(0.5077086387392665);
-      value[ID::time0 + 66]->setFromNormalized(0.4920288739242032);
-      value[ID::time0 + 67]->setFromNormalized(0.47744028633905466);
-      value[ID::time0 + 68]->setFromNormalized(0.4646779909016314);
-      value[ID::time0 + 69]->setFromNormalized(0.45437286971244495);
-      value[ID::time0 + 70]->setFromNormalized(0.4469819543756306);
-      value[ID::time0 + 71]->setFromNormalized(0.44274212089141274);
-      value[ID::time0 + 72]->setFromNormalized(0.44166225257146824);
-      value[ID::time0 + 73]->setFromNormalized(0.4435586147650158);
-      value[ID::time0 + 74]->setFromNormalized(0.4481247928100678);
-      value[ID::time0 + 75]->setFromNormalized(0.4550162279094257);
-      value[ID::time0 + 76]->setFromNormalized(0.4639246119665512);
-      value[ID::time0 + 77]->setFromNormalized(0.4746210640636096);
-      value[ID::time0 + 78]->setFromNormalized(0.4869576227931742);
-      value[ID::time0 + 79]->setFromNormalized(0.5008300555811931);
-      value[ID::time0 + 80]->setFromNormalized(0.5161164929617051);
-      value[ID::time0 + 81]->setFromNormalized(0.5326124000588459);
-      value[ID::time0 + 82]->setFromNormalized(0.5499817654649481);
-      value[ID::time0 + 83]->setFromNormalized(0.5677383008797908);
-      value[ID::time0 + 84]->setFromNormalized(0.5852614286552489);
-      value[ID::time0 + 85]->setFromNormalized(0.601842629896069);
-      value[ID::time0 + 86]->setFromNormalized(0.6167505665568283);
-      value[ID::time0 + 87]->setFromNormalized(0.6292997678587664);
-      value[ID::time0 + 88]->setFromNormalized(0.6389082930688397);
-      value[ID::time0 + 89]->setFromNormalized(0.6451344424292782);
-      value[ID::time0 + 90]->setFromNormalized(0.6476899597868546);
-      value[ID::time0 + 91]->setFromNormalized(0.6464348608287943);
-      value[ID::time0 + 92]->setFromNormalized(0.6413641888955898);
-      value[ID::time0 + 93]->setFromNormalized(0.6325974934812038);
-      value[ID::time0 + 94]->setFromNormalized(0.6203773202871586);
-      value[ID::time0 + 95]->setFromNormalized(0.6050754412390474);
-      value[ID::time0 + 96]->setFromNormalized(0.5871984703087928);
-      value[ID::time0 + 97]->setFromNormalized(0.5673814159515824);
-      value[ID::time0 + 98]->setFromNormalized(0.5463603512304669);
-      value[ID::time0 + 99]->setFromNormalized(0.524922764679087);
-      value[ID::time0 + 100]->setFromNormalized(0.5038430236303828);
-      value[ID::time0 + 101]->setFromNormalized(0.48381676573375404);
-      value[ID::time0 + 102]->setFromNormalized(0.4654091682906126);
-      value[ID::time0 + 103]->setFromNormalized(0.44902761087947585);
-      value[ID::time0 + 104]->setFromNormalized(0.43492135031495566);
-      value[ID::time0 + 105]->setFromNormalized(0.4232028225920415);
-      value[ID::time0 + 106]->setFromNormalized(0.41388005198289857);
-      value[ID::time0 + 107]->setFromNormalized(0.4068887636782375);
-      value[ID::time0 + 108]->setFromNormalized(0.4021156642979121);
-      value[ID::time0 + 109]->setFromNormalized(0.39940922382702404);
-      value[ID::time0 + 110]->setFromNormalized(0.3985792075591737);
-      value[ID::time0 + 111]->setFromNormalized(0.3993898454883329);
-      value[ID::time0 + 112]->setFromNormalized(0.4015534376288493);
-      value[ID::time0 + 113]->setFromNormalized(0.404731459030745);
-      value[ID::time0 + 114]->setFromNormalized(0.4085489337533804);
-      value[ID::time0 + 115]->setFromNormalized(0.4126248188506432);
-      value[ID::time0 + 116]->setFromNormalized(0.4166161835054987);
-      value[ID::time0 + 117]->setFromNormalized(0.42026747775473866);
-      value[ID::time0 + 118]->setFromNormalized(0.4234496806548278);
-      value[ID::time0 + 119]->setFromNormalized(0.426170243624781);
-      value[ID::time0 + 120]->setFromNormalized(0.42853647656824095);
-      value[ID::time0 + 121]->setFromNormalized(0.4306642611113561);
-      value[ID::time0 + 122]->setFromNormalized(0.43254009390830916);
-      value[ID::time0 + 123]->setFromNormalized(0.43386361057981954);
-      value[ID::time0 + 124]->setFromNormalized(0.43391348000662006);
-      value[ID::time0 + 125]->setFromNormalized(0.43148494965448814);
-      value[ID::time0 + 126]->setFromNormalized(0.4249377966509904);
-      value[ID::time0 + 127]->setFromNormalized(0.4123692458411491);
-      value[ID::time0 + 128]->setFromNormalized(0.3918933853153333);
-      value[ID::time0 + 129]->setFromNormalized(0.36197660664423326);
-      value[ID::time0 + 130]->setFromNormalized(0.32175810016544404);
-      value[ID::time0 + 131]->setFromNormalized(0.2712826237225262);
-      value[ID::time0 + 132]->setFromNormalized(0.21159078403428458);
-      value[ID::time0 + 133]->setFromNormalized(0.14464464674132202);
-      value[ID::time0 + 134]->setFromNormalized(0.07310395314570835);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.5095311696721448);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.5188779320455682);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.5278044630502248);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.5359716414307129);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.5429625470905243);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.5483288854699505);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.5516456285426442);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.5525623206627985);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.550843741198874);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.5463977914488434);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.5392923727536902);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.529764232140703);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.5182211632406027);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.5052357425711942);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.49152588244207646);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.47791673118792305);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.4652808064327592);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.45445835657251815);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.4461662596330037);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.4409091244936018);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.4389086934766423);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.44006610190851336);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.44396622763394616);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.44992560004395066);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.45707712687864527);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.4644782371185478);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.4712253610874472);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.47655751308666205);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.47993474226973837);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.4810823588899758);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.47999785004403933);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.4769231068794593);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.4722891713683614);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.4666437422442963);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.4605730202292483);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.4546291503238952);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.44927265476587747);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.4448360872937504);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.44151112713786533);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.43935716577907385);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.43832597110697324);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.438295012034957);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.43910189568469626);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.44057395717480197);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.44254966879982294);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.44489125252111134);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.44748985297623595);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.45026545994907474);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.45316360260339417);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.4561501989063666);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.4592054158984442);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.46231730644203484);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.465476267575586);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.4686716476829215);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.4718917060427093);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.47512741195523694);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.4783794179312433);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.48166637663624506);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.485032068695126);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.488548858358109);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.4923157749222866);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.4964507292896175);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.5010775972914976);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.5063097874113319);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.5122323135773954);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.5188843797830879);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.5262442446202937);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.5342178664713366);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.5426326435629449);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.5512374551853892);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.5597100964472563);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.5676729581737835);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.5747173138379967);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.5804357365702697);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.5844609367770356);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.586507754299163);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.5864134058359793);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.5841698201870592);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.579941543086516);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.5740637339275761);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.567017371961147);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.5593826280281594);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.5517756546183745);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.5447777398028929);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.5388678458511643);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.5343693757026159);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.5314195294159444);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.529965378683673);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.5297857873074983);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.530533687107222);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.5317899949384077);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.5331192646457851);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.5341181333549507);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.534450347385362);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.5338658339054707);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.5322049242023638);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.5293915201865312);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.5254201567547913);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.5203414827681453);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.5142491020062703);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.5072687510201521);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.49954924150257324);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.4912539801682479);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.48255225358797854);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.4736104388366357);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.46458425742936166);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.4556135989821052);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.4468211041441712);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.43831481093129765);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.43019418209709);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.42255817589896016);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.4155138809074774);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.40918446437852307);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.40371543486797445);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.3992781812165077);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.39606936838867646);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.39430432541500104);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.3942025430220068);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.3959642522813309);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.3997389108862648);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.40558895787060034);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.4134546961822135);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.4231277577525657);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.43424059267898024);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.446277525675677);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.4586094038825281);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.4705494584597284);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.48142371500594894);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.49064609334240317);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.4977869464927402);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.5026244891521513);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.5051711861260529);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.5056711551207909);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.5045691941233738);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.5024563233118053);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.4914892575623026);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.48133450780062037);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.46924090356181564);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.4556427688596274);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.44151756982376916);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.42806970961147084);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.4164101614014721);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.4073491224219712);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.401360901912181);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.3986947322197138);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.3995322257787751);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.4040712554032449);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.4124614922553073);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.4246059541617897);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.4399273454640099);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.45723215190589944);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.47477231088368455);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.4905220235327867);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.5025962389216037);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.5096779703880369);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.5113164939681357);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.5080054314835215);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.5010262252198768);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.4921175777876832);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.48307871889598825);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.47542115951930725);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.47015308936367);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.46772807160850705);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.4681353909204526);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.4710708634399377);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.47611383665239865);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.4828489116233772);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.4909024039279902);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.4999019365863045);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.5093995396987504);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.5188125845330719);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.5274267017283816);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.5344738187883087);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.539260260794165);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.5412936369666737);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.5403575857010215);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.536510821704377);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.5300255549703502);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.5213068158678993);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.5108324092510976);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.4991258206795227);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.4867419445405954);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.4742322814152823);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.4620728248138477);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.4505734709932085);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.4398181448636117);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.4296884739710955);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.4199948454469473);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.41068873600871025);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.40208181944591015);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.39497392214320237);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.3906084065343475);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.3904295345399893);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.39569326922393205);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.4070493955031512);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.4242377808082401);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.44601036179792697);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.4703138240031908);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.4946782526872131);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.5166924836073143);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.5344326945738167);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.5467470858257506);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.5533623915162068);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.5548336363893001);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.5523832941072016);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.5476698880509528);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.5425101415566886);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.5385765993086661);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.537110149444277);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.5387073207348736);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.5432408105432135);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.5499375586765227);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.5575856105018062);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.5647983893136913);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.5702569410341994);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.5728796888912246);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.5719151922699355);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.5669875021881565);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.5581266694160125);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.545790706317516);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.5308513371910591);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.5145015996913559);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.49806434680810235);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.4827296119006685);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.4692982467793869);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.458027620978864);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.4486464814040035);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.44054123737492845);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.4330472480714431);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.42573989957869735);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.41862601257189636);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.41217613523043173);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.40718980851405884);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.4045318739099183);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.40481364476448306);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.4081171638557233);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.41386496663654115);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.42090712323787427);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.4278273945086781);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.433381137710629);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.4369099349811265);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.43857081100962986);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.4392827787053066);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.44040395935271137);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.4432577407192047);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.44867883493365557);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.45673028301147944);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.4666661422901545);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.47712030624008955);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.4864297068311477);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.4929742537973645);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.4954379112427315);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.49294784896426325);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.48510492474036115);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.47195477400042896);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.45395271927036185);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.43195172216848315);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.40720702649768786);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.38136364557798114);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.35638708963853305);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.33441570792759845);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.317545048079255);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.3075846190448594);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.30584106958927326);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.31297363233853004);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.3289433566030974);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.35304987972122903);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.3840306041865396);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.4201928139999519);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.4595568293991655);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.47468970972146907);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.4498379180031785);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.4258473328034885);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.403217652325219);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.3825321406096818);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.36442081035990687);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.3495060437743772);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.3383390797824638);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.3313369774293151);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.3287293722119633);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.3305227035039583);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.33648690851796653);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.3461662970033631);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.3589129715291945);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.37393826850266254);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.3903756909741654);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.4073479273954507);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.42403081750730814);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.43970834273376214);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.4538145399851509);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.4659602625229879);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.4759445724846001);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.4837519868314496);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.48953769503817024);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.49360324615312506);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.4963651935567301);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.4983189681311004);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.45484826868390704);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.41939378327793364);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.39811424108534227);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.3922244861276316);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.3994761284835602);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.4154887424041729);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.4357690399662711);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.45725012163370843);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.47868595563077754);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.4555555555555556);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.5004183022650943);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.5002541710137584);
-      value[ID::timeMultiply]->setFromNormalized(0.8740001916885376);
-      value[ID::innerFeedMultiply]->setFromNormalized(0.7919999957084656);
-      value[ID::d1FeedMultiply]->setFromNormalized(0.7260000705718994);
-      value[ID::d2FeedMultiply]->setFromNormalized(0.6460000276565552);
-      value[ID::d3FeedMultiply]->setFromNormalized(0.6859999895095825);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.27521803975105286);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(1.0);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(0);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(1);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(1.0);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetHygiea: {
-      value[ID::time0 + 0]->setFromNormalized(0.1333333333333333);
-      value[ID::time0 + 1]->setFromNormalized(0.12087920856658277);
-      value[ID::time0 + 2]->setFromNormalized(0.22172161943095736);
-      value[ID::time0 + 3]->setFromNormalized(0.18531406730892805);
-      value[ID::time0 + 4]->setFromNormalized(0.19492577961178);
-      value[ID::time0 + 5]->setFromNormalized(0.007511663736322182);
-      value[ID::time0 + 6]->setFromNormalized(0.21567383278510632);
-      value[ID::time0 + 7]->setFromNormalized(0.85);
-      value[ID::time0 + 8]->setFromNormalized(0.8111111111111111);
-      value[ID::time0 + 9]->setFromNormalized(0.7666666666666666);
-      value[ID::time0 + 10]->setFromNormalized(0.7055555555555555);
-      value[ID::time0 + 11]->setFromNormalized(0.7027777777777777);
-      value[ID::time0 + 12]->setFromNormalized(0.17724436388194026);
-      value[ID::time0 + 13]->setFromNormalized(0.012950832041316486);
-      value[ID::time0 + 14]->setFromNormalized(0.08766598776760401);
-      value[ID::time0 + 15]->setFromNormalized(0.20188554091205752);
-      value[ID::time0 + 16]->setFromNormalized(0.06297748830027566);
-      value[ID::time0 + 17]->setFromNormalized(0.08494183703755749);
-      value[ID::time0 + 18]->setFromNormalized(0.18148243169815545);
-      value[ID::time0 + 19]->setFromNormalized(0.1600707739714731);
-      value[ID::time0 + 20]->setFromNormalized(0.10298224880120964);
-      value[ID::time0 + 21]->setFromNormalized(0.18295501441419432);
-      value[ID::time0 + 22]->setFromNormalized(0.19129699204848452);
-      value[ID::time0 + 23]->setFromNormalized(0.012055158462084086);
-      value[ID::time0 + 24]->setFromNormalized(0.09368957322765188);
-      value[ID::time0 + 25]->setFromNormalized(0.11352667832886991);
-      value[ID::time0 + 26]->setFromNormalized(0.15611302604663005);
-      value[ID::time0 + 27]->setFromNormalized(0.19189097402735014);
-      value[ID::time0 + 28]->setFromNormalized(0.1388730424865242);
-      value[ID::time0 + 29]->setFromNormalized(0.20028853185971415);
-      value[ID::time0 + 30]->setFromNormalized(0.15786820401754195);
-      value[ID::time0 + 31]->setFromNormalized(0.0665934931760003);
-      value[ID::time0 + 32]->setFromNormalized(0.12337384547205293);
-      value[ID::time0 + 33]->setFromNormalized(0.08165272049229974);
-      value[ID::time0 + 34]->setFromNormalized(0.20341446521750128);
-      value[ID::time0 + 35]->setFromNormalized(0.9277777777777778);
-      value[ID::time0 + 36]->setFromNormalized(0.9277777777777778);
-      value[ID::time0 + 37]->setFromNormalized(0.012589941443083726);
-      value[ID::time0 + 38]->setFromNormalized(0.17079884296506015);
-      value[ID::time0 + 39]->setFromNormalized(0.21984812326939263);
-      value[ID::time0 + 40]->setFromNormalized(0.07134445048625339);
-      value[ID::time0 + 41]->setFromNormalized(0.039486068913102045);
-      value[ID::time0 + 42]->setFromNormalized(0.18043488034745034);
-      value[ID::time0 + 43]->setFromNormalized(0.19108106496890484);
-      value[ID::time0 + 44]->setFromNormalized(0.0794813282351151);
-      value[ID::time0 + 45]->setFromNormalized(0.2024963029634286);
-      value[ID::time0 + 46]->setFromNormalized(0.1735474633908925);
-      value[ID::time0 + 47]->setFromNormalized(0.08777985025776015);
-      value[ID::time0 + 48]->setFromNormalized(0.85);
-      value[ID::time0 + 49]->setFromNormalized(0.8333333333333334);
-      value[ID::time0 + 50]->setFromNormalized(0.8277777777777777);
-      value[ID::time0 + 51]->setFromNormalized(0.8222222222222222);
-      value[ID::time0 + 52]->setFromNormalized(0.06725837206127926);
-      value[ID::time0 + 53]->setFromNormalized(0.049541929927838915);
-      value[ID::time0 + 54]->setFromNormalized(0.09880019907409551);
-      value[ID::time0 + 55]->setFromNormalized(0.08449410249533486);
-      value[ID::time0 + 56]->setFromNormalized(0.14097944361548556);
-      value[ID::time0 + 57]->setFromNormalized(0.19009146286856704);
-      value[ID::time0 + 58]->setFromNormalized(0.016651848840944995);
-      value[ID::time0 + 59]->setFromNormalized(0.010145342470041039);
-      value[ID::time0 + 60]->setFromNormalized(0.18380934300070145);
-      value[ID::time0 + 61]->setFromNormalized(0.023110873307303655);
-      value[ID::time0 + 62]->setFromNormalized(0.062321369707306534);
-      value[ID::time0 + 63]->setFromNormalized(0.043629714358703844);
-      value[ID::time0 + 64]->setFromNormalized(0.020335080775462144);
-      value[ID::time0 + 65]->setFromNormalized(0.16776172879345042);
-      value[ID::time0 + 66]->setFromNormalized(0.014651111031602168);
-      value[ID::time0 + 67]->setFromNormalized(0.20524252136671275);
-      value[ID::time0 + 68]->setFromNormalized(0.01885558520515568);
-      value[ID::time0 + 69]->setFromNormalized(0.09398338377211055);
-      value[ID::time0 + 70]->setFromNormalized(0.06577742832618844);
-      value[ID::time0 + 71]->setFromNormalized(0.12338102805202912);
-      value[ID::time0 + 72]->setFromNormalized(0.01128413579835611);
-      value[ID::time0 + 73]->setFromNormalized(0.16967049262047143);
-      value[ID::time0 + 74]->setFromNormalized(0.06255263022565642);
-      value[ID::time0 + 75]->setFromNormalized(0.04697257682383887);
-      value[ID::time0 + 76]->setFromNormalized(0.11141814263349338);
-      value[ID::time0 + 77]->setFromNormalized(0.12455723157618831);
-      value[ID::time0 + 78]->setFromNormalized(0.05186921494112826);
-      value[ID::time0 + 79]->setFromNormalized(0.09888282326624474);
-      value[ID::time0 + 80]->setFromNormalized(0.20160492652376988);
-      value[ID::time0 + 81]->setFromNormalized(0.1741054557967371);
-      value[ID::time0 + 82]->setFromNormalized(0.5777777777777777);
-      value[ID::time0 + 83]->setFromNormalized(0.5555555555555556);
-      value[ID::time0 + 84]->setFromNormalized(0.5388888888888889);
-      value[ID::time0 + 85]->setFromNormalized(0.5277777777777778);
-      value[ID::time0 + 86]->setFromNormalized(0.5166666666666666);
-      value[ID::time0 + 87]->setFromNormalized(0.5111111111111111);
-      value[ID::time0 + 88]->setFromNormalized(0.5055555555555555);
-      value[ID::time0 + 89]->setFromNormalized(0.18963503266229337);
-      value[ID::time0 + 90]->setFromNormalized(0.15160560783914256);
-      value[ID::time0 + 91]->setFromNormalized(0.05093677559203405);
-      value[ID::time0 + 92]->setFromNormalized(0.22156674736637705);
-      value[ID::time0 + 93]->setFromNormalized(0.22046911589523266);
-      value[ID::time0 + 94]->setFromNormalized(0.14398798821696954);
-      value[ID::time0 + 95]->setFromNormalized(0.038586171319903745);
-      value[ID::time0 + 96]->setFromNormalized(0.050088104167893506);
-      value[ID::time0 + 97]->setFromNormalized(0.18662021016694072);
-      value[ID::time0 + 98]->setFromNormalized(0.2052738403677272);
-      value[ID::time0 + 99]->setFromNormalized(0.1686521077255423);
-      value[ID::time0 + 100]->setFromNormalized(0.19113578497208467);
-      value[ID::time0 + 101]->setFromNormalized(0.1271552837705639);
-      value[ID::time0 + 102]->setFromNormalized(0.030401042104034114);
-      value[ID::time0 + 103]->setFromNormalized(0.2277893829720739);
-      value[ID::time0 + 104]->setFromNormalized(0.21215190285869734);
-      value[ID::time0 + 105]->setFromNormalized(0.14752417494006945);
-      value[ID::time0 + 106]->setFromNormalized(0.12520701870093023);
-      value[ID::time0 + 107]->setFromNormalized(0.10894650215433191);
-      value[ID::time0 + 108]->setFromNormalized(0.10134581569810926);
-      value[ID::time0 + 109]->setFromNormalized(0.09354798537675134);
-      value[ID::time0 + 110]->setFromNormalized(0.40555555555555556);
-      value[ID::time0 + 111]->setFromNormalized(0.4);
-      value[ID::time0 + 112]->setFromNormalized(0.3944444444444445);
-      value[ID::time0 + 113]->setFromNormalized(0.38888888888888884);
-      value[ID::time0 + 114]->setFromNormalized(0.38055555555555554);
-      value[ID::time0 + 115]->setFromNormalized(0.37222222222222223);
-      value[ID::time0 + 116]->setFromNormalized(0.04164710290877139);
-      value[ID::time0 + 117]->setFromNormalized(0.19311773376392957);
-      value[ID::time0 + 118]->setFromNormalized(0.19393694246411125);
-      value[ID::time0 + 119]->setFromNormalized(0.1932769215093433);
-      value[ID::time0 + 120]->setFromNormalized(0.11175145564718383);
-      value[ID::time0 + 121]->setFromNormalized(0.15288534682882535);
-      value[ID::time0 + 122]->setFromNormalized(0.054312613230217625);
-      value[ID::time0 + 123]->setFromNormalized(0.05704823365800915);
-      value[ID::time0 + 124]->setFromNormalized(0.02198741792236016);
-      value[ID::time0 + 125]->setFromNormalized(0.009136974634237063);
-      value[ID::time0 + 126]->setFromNormalized(0.08356809236208924);
-      value[ID::time0 + 127]->setFromNormalized(0.2220115241883392);
-      value[ID::time0 + 128]->setFromNormalized(0.11724604693043938);
-      value[ID::time0 + 129]->setFromNormalized(0.008004927125379733);
-      value[ID::time0 + 130]->setFromNormalized(0.00514555666329998);
-      value[ID::time0 + 131]->setFromNormalized(0.38888888888888884);
-      value[ID::time0 + 132]->setFromNormalized(0.1498923819794219);
-      value[ID::time0 + 133]->setFromNormalized(0.20962599048087774);
-      value[ID::time0 + 134]->setFromNormalized(0.1541224719614666);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.2909109842778524);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.08491527106457464);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.3121858831643216);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.9344898076247219);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.8794125464169971);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.3041726899552411);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.8426047468383668);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.9676375710506224);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.11020214477519696);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.45004227020007886);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.39131802202238497);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.3453856869779916);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.9375572137000066);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.7453751994687031);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.9412471946676859);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.904439743550585);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.3086147744448788);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.15450525074078614);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.6064734930301333);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.20937049270589642);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.2994668735574288);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.1423242145146374);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.24485315161370202);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.942232822015716);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.5797979981781087);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.2657996877973677);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.2792375743487411);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.9637599311806803);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.37431648206998525);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.8075348884618769);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.6811010125462271);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.14630290102864218);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.109437785334765);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.8407204903833846);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.3464989277041576);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.6366766265420193);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.926719688710151);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.3292288101521819);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.45228631266724156);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.17509783361877163);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.9745092040002066);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.10674549773240088);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.502797532140403);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.163029962671159);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.38695828896764545);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.9961474986319527);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.7357416060372053);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.12792256944464664);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.5750681430890197);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.6310873224935647);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.7959099664710825);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.9703751312887531);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.24914694134327298);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.16400888580316192);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.9934026869490938);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.7953890570886487);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.48922797559546555);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.5806666415645546);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.8827647875641381);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.7872503483685461);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.20327541431568208);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.30982858813309816);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.22632611042198925);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.30569876141623725);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.026512775438466696);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.0845936910794553);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.5830767015373333);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.3939871039797814);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.8284295848672755);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.3758989879393999);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.373812131578162);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.4501527969232703);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.639641967762441);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.6455447710330112);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.7140344997318155);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.9067565448465252);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.7780282477937535);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.49778441779291693);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.46664942529280673);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.9930817953774677);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.26723779132104536);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.2854831832232457);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.1372666960039673);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.415856985705144);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.45522723235692714);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.3916861969281563);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.7084837162358961);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.8627329226336143);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.3043935463098372);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.6872280090146162);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.8221256781870176);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.12745881010041105);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.9555630580569738);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.625009253090683);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.4337693554194997);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.5151650709602156);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.7326527132284014);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.008633923103673502);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.18235373076256267);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.6578252912661992);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.15393633427484343);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.5913734756710572);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.3484100022688653);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.2809099257301421);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.6490326014532515);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.5410088281278594);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.04921652274217725);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.16999417701427433);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.13680730179825012);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.4430911241589763);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.0662270187723874);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.2279787000912758);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.06936903253838084);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.7698684959615678);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.33786567229476383);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.2946525250606964);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.35050922410643276);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.67154795695677);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.7363802423859701);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.06464118167473631);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.739405351098793);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.3535570759816953);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.9044873812451156);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.36051057203924086);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.47527206564015195);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.9808023611033448);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.27251023998255774);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.6506911479029454);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.28846400565492164);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.026973851230300938);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.9589548580888088);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.07737678129121844);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.4643941000542777);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.3946741943664352);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.5092374859847357);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.3388888888888889);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.9356753493686494);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.3620549774987749);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.7310864518784843);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.8218352414012312);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.4327506044190872);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.3351801088203973);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.4265731421581939);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.1048140391516536);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.13729844397402324);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.7247271396095943);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.983175969834289);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.11178513085745839);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.44423605018120627);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.4428782034485875);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.7613144312904275);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.9267947324298607);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.24975289392514138);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.2425732401561056);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.006169497379057476);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.7114228366505684);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.5743061840401228);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.8073657472968151);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.4656952498277158);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.37170978426481593);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.5950082406908856);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.667352388217439);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.4054286931683997);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.07855511096986245);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.35710618358024904);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.33669171360814976);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.9705831756052791);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.34896257921711404);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.8178105060924723);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.1422524620209883);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.13035753189118637);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.6715944988152994);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.6822871195044113);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.4401635808080012);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.9096503298207295);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.5300823602862714);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.009555461153221867);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.6884262863898878);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.25655179815545615);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.8797416115872454);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.332659459014894);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.9719591689880975);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.25789298853089876);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.2232147040921798);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.5282837483600947);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.3886312516735371);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.853955713828674);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.7409767477468134);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.4061752058605282);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.47631692526973074);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.32620475284090766);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.596859518401777);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.5415247874737295);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.8287352970984373);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.556563197498541);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.01730192009071918);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.4520505348647721);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.8421755730894116);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.608058844644808);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.40706475401355785);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.7232763771828616);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.3270915201117068);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.3763511502895063);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.4729882305506893);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.0973676962672767);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.8052257416217191);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.1999651289690983);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.5274255164335531);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.5775028846290882);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.9756286458341413);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.870850719317816);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.5988193051333083);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.35765515539742193);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.38936295190562864);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.34394481942603555);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.2786547968436277);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.9676845725341495);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.28050274994122903);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.5863199978538247);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.5102087490412271);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.7053853784987517);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.8508727919836635);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.8192614396115903);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.038806575270848076);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.3250099334281093);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.4264597893549163);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.9896138572580147);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.4004334469062933);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.6577031621833913);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.5094674058398189);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.1862394331071106);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.48273202525061765);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.06488508412262511);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.4313303334259109);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.3494314461048711);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.28301297998709707);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.924924492219224);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.580904063463528);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.4788632204914826);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.03646906885861351);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.4877391177997684);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.8162443093396767);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.0677611713873465);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.324823482369169);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.42029328285188844);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.9490022403461265);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.34839784693422754);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.9937263849058844);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.5872081918620979);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.964521883980232);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.05446070361219191);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.9733855259484269);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.09747992189943733);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.22165236254295717);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.8591036098916863);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.9345924843313173);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.7497522367131708);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.8170325767145472);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.307772507991294);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.13303852965163698);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.7337300008766149);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.5914327191052816);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.1535946583172545);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.32793331756456656);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.027714403175997715);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.2696043974713925);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.8185316647390686);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.057118167363323424);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.05506136068324874);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.4338747243789492);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.22194908712747485);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.8990998264016132);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.9985980568636207);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.32080558591175107);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.6989723672123703);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.05927994783408419);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.022222222222222254);
-      value[ID::d2Feed0 + 7]->setFromNormalized(1.0);
-      value[ID::d2Feed0 + 8]->setFromNormalized(1.0);
-      value[ID::d2Feed0 + 9]->setFromNormalized(1.0);
-      value[ID::d2Feed0 + 10]->setFromNormalized(1.0);
-      value[ID::d2Feed0 + 11]->setFromNormalized(1.0);
-      value[ID::d2Feed0 + 12]->setFromNormalized(1.0);
-      value[ID::d2Feed0 + 13]->setFromNormalized(1.0);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.9777777777777777);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.9722222222222222);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.9444444444444444);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.8944444444444445);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.8833333333333333);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.8722222222222222);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.8722222222222222);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.4209338083613415);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.569952959928528);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.08387094027208408);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.18278132385922924);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.8776385836731316);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.3329998092526046);
-      value[ID::d3Feed0 + 0]->setFromNormalized(1.0);
-      value[ID::d3Feed0 + 1]->setFromNormalized(1.0);
-      value[ID::d3Feed0 + 2]->setFromNormalized(1.0);
-      value[ID::d3Feed0 + 3]->setFromNormalized(1.0);
-      value[ID::d3Feed0 + 4]->setFromNormalized(1.0);
-      value[ID::d3Feed0 + 5]->setFromNormalized(1.0);
-      value[ID::d3Feed0 + 6]->setFromNormalized(1.0);
-      value[ID::d3Feed0 + 7]->setFromNormalized(1.0);
-      value[ID::d3Feed0 + 8]->setFromNormalized(1.0);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.13888888888888884);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.12222222222222223);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.0805555555555556);
-      value[ID::timeMultiply]->setFromNormalized(0.8879995942115784);
-      value[ID::innerFeedMultiply]->setFromNormalized(0.9360001683235168);
-      value[ID::d1FeedMultiply]->setFromNormalized(0.9640000462532043);
-      value[ID::d2FeedMultiply]->setFromNormalized(0.952000081539154);
-      value[ID::d3FeedMultiply]->setFromNormalized(0.9660000205039978);
-      value[ID::d4FeedMultiply]->setFromNormalized(0.9680001139640808);
-      value[ID::timeOffsetRange]->setFromNormalized(0.2752180285130085);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.3760000169277191);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.3160000145435333);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.3280000388622284);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.31800004839897156);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.30800002813339233);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(1);
-      value[ID::d1FeedModulation]->setFromInt(1);
-      value[ID::d2FeedModulation]->setFromInt(1);
-      value[ID::d3FeedModulation]->setFromInt(1);
-      value[ID::d4FeedModulation]->setFromInt(1);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetIntermnia: {
-      value[ID::time0 + 0]->setFromNormalized(0.21666666666666667);
-      value[ID::time0 + 1]->setFromNormalized(0.22499999999999998);
-      value[ID::time0 + 2]->setFromNormalized(0.23333333333333328);
-      value[ID::time0 + 3]->setFromNormalized(0.23888888888888893);
-      value[ID::time0 + 4]->setFromNormalized(0.25);
-      value[ID::time0 + 5]->setFromNormalized(0.26111111111111107);
-      value[ID::time0 + 6]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 7]->setFromNormalized(0.27222222222222225);
-      value[ID::time0 + 8]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 9]->setFromNormalized(0.30000000000000004);
-      value[ID::time0 + 10]->setFromNormalized(0.3138888888888889);
-      value[ID::time0 + 11]->setFromNormalized(0.3277777777777777);
-      value[ID::time0 + 12]->setFromNormalized(0.3555555555555555);
-      value[ID::time0 + 13]->setFromNormalized(0.3680555555555556);
-      value[ID::time0 + 14]->setFromNormalized(0.3930555555555556);
-      value[ID::time0 + 15]->setFromNormalized(0.40555555555555556);
-      value[ID::time0 + 16]->setFromNormalized(0.42500000000000004);
-      value[ID::time0 + 17]->setFromNormalized(0.4444444444444444);
-      value[ID::time0 + 18]->setFromNormalized(0.4638888888888889);
-      value[ID::time0 + 19]->setFromNormalized(0.4833333333333333);
-      value[ID::time0 + 20]->setFromNormalized(0.49583333333333335);
-      value[ID::time0 + 21]->setFromNormalized(0.5208333333333333);
-      value[ID::time0 + 22]->setFromNormalized(0.5333333333333333);
-      value[ID::time0 + 23]->setFromNormalized(0.5486111111111112);
-      value[ID::time0 + 24]->setFromNormalized(0.5791666666666666);
-      value[ID::time0 + 25]->setFromNormalized(0.5944444444444444);
-      value[ID::time0 + 26]->setFromNormalized(0.6194444444444445);
-      value[ID::time0 + 27]->setFromNormalized(0.6444444444444444);
-      value[ID::time0 + 28]->setFromNormalized(0.6666666666666667);
-      value[ID::time0 + 29]->setFromNormalized(0.6916666666666667);
-      value[ID::time0 + 30]->setFromNormalized(0.7166666666666667);
-      value[ID::time0 + 31]->setFromNormalized(0.7361111111111112);
-      value[ID::time0 + 32]->setFromNormalized(0.7555555555555555);
-      value[ID::time0 + 33]->setFromNormalized(0.7888888888888889);
-      value[ID::time0 + 34]->setFromNormalized(0.8333333333333334);
-      value[ID::time0 + 35]->setFromNormalized(0.8555555555555556);
-      value[ID::time0 + 36]->setFromNormalized(0.8666666666666667);
-      value[ID::time0 + 37]->setFromNormalized(0.8777777777777778);
-      value[ID::time0 + 38]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 39]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 40]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 41]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 42]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 43]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 44]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 45]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 46]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 47]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 48]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 49]->setFromNormalized(0.19444444444444442);
-      value[ID::time0 + 50]->setFromNormalized(0.19999999999999996);
-      value[ID::time0 + 51]->setFromNormalized(0.2018518235948351);
-      value[ID::time0 + 52]->setFromNormalized(0.2055555555555556);
-      value[ID::time0 + 53]->setFromNormalized(0.2092592875162761);
-      value[ID::time0 + 54]->setFromNormalized(0.21111111111111114);
-      value[ID::time0 + 55]->setFromNormalized(0.2152777777777778);
-      value[ID::time0 + 56]->setFromNormalized(0.2236111111111111);
-      value[ID::time0 + 57]->setFromNormalized(0.2319444444444444);
-      value[ID::time0 + 58]->setFromNormalized(0.2402777777777778);
-      value[ID::time0 + 59]->setFromNormalized(0.24444444444444446);
-      value[ID::time0 + 60]->setFromNormalized(0.24791666666666667);
-      value[ID::time0 + 61]->setFromNormalized(0.2548611111111111);
-      value[ID::time0 + 62]->setFromNormalized(0.2618055555555555);
-      value[ID::time0 + 63]->setFromNormalized(0.26875000000000004);
-      value[ID::time0 + 64]->setFromNormalized(0.27222222222222225);
-      value[ID::time0 + 65]->setFromNormalized(0.27962960137261283);
-      value[ID::time0 + 66]->setFromNormalized(0.2944444868299696);
-      value[ID::time0 + 67]->setFromNormalized(0.30925928751627607);
-      value[ID::time0 + 68]->setFromNormalized(0.31666666666666665);
-      value[ID::time0 + 69]->setFromNormalized(0.3277777777777777);
-      value[ID::time0 + 70]->setFromNormalized(0.35);
-      value[ID::time0 + 71]->setFromNormalized(0.36111111111111116);
-      value[ID::time0 + 72]->setFromNormalized(0.3736111111111111);
-      value[ID::time0 + 73]->setFromNormalized(0.39861111111111114);
-      value[ID::time0 + 74]->setFromNormalized(0.4111111111111111);
-      value[ID::time0 + 75]->setFromNormalized(0.42638888888888893);
-      value[ID::time0 + 76]->setFromNormalized(0.4569444444444445);
-      value[ID::time0 + 77]->setFromNormalized(0.4722222222222222);
-      value[ID::time0 + 78]->setFromNormalized(0.48611111111111116);
-      value[ID::time0 + 79]->setFromNormalized(0.5138888888888888);
-      value[ID::time0 + 80]->setFromNormalized(0.5277777777777778);
-      value[ID::time0 + 81]->setFromNormalized(0.5666666666666667);
-      value[ID::time0 + 82]->setFromNormalized(0.6055555555555556);
-      value[ID::time0 + 83]->setFromNormalized(0.6388888888888888);
-      value[ID::time0 + 84]->setFromNormalized(0.6722222222222223);
-      value[ID::time0 + 85]->setFromNormalized(0.7166666666666667);
-      value[ID::time0 + 86]->setFromNormalized(0.7777777777777778);
-      value[ID::time0 + 87]->setFromNormalized(0.8222222222222222);
-      value[ID::time0 + 88]->setFromNormalized(0.8416666666666667);
-      value[ID::time0 + 89]->setFromNormalized(0.18963503266229337);
-      value[ID::time0 + 90]->setFromNormalized(0.15160560783914256);
-      value[ID::time0 + 91]->setFromNormalized(0.05093677559203405);
-      value[ID::time0 + 92]->setFromNormalized(0.25555555555555554);
-      value[ID::time0 + 93]->setFromNormalized(0.24444444444444446);
-      value[ID::time0 + 94]->setFromNormalized(0.2416666666666667);
-      value[ID::time0 + 95]->setFromNormalized(0.23888888888888893);
-      value[ID::time0 + 96]->setFromNormalized(0.23888888888888893);
-      value[ID::time0 + 97]->setFromNormalized(0.23888888888888893);
-      value[ID::time0 + 98]->setFromNormalized(0.23888888888888893);
-      value[ID::time0 + 99]->setFromNormalized(0.23888888888888893);
-      value[ID::time0 + 100]->setFromNormalized(0.23888888888888893);
-      value[ID::time0 + 101]->setFromNormalized(0.2416666666666667);
-      value[ID::time0 + 102]->setFromNormalized(0.24444444444444446);
-      value[ID::time0 + 103]->setFromNormalized(0.25);
-      value[ID::time0 + 104]->setFromNormalized(0.26111111111111107);
-      value[ID::time0 + 105]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 106]->setFromNormalized(0.2777777777777778);
-      value[ID::time0 + 107]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 108]->setFromNormalized(0.30000000000000004);
-      value[ID::time0 + 109]->setFromNormalized(0.3222222222222222);
-      value[ID::time0 + 110]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 111]->setFromNormalized(0.3458333333333333);
-      value[ID::time0 + 112]->setFromNormalized(0.37083333333333335);
-      value[ID::time0 + 113]->setFromNormalized(0.3833333333333333);
-      value[ID::time0 + 114]->setFromNormalized(0.4);
-      value[ID::time0 + 115]->setFromNormalized(0.43333333333333335);
-      value[ID::time0 + 116]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 117]->setFromNormalized(0.4652777777777778);
-      value[ID::time0 + 118]->setFromNormalized(0.49583333333333335);
-      value[ID::time0 + 119]->setFromNormalized(0.5111111111111111);
-      value[ID::time0 + 120]->setFromNormalized(0.525);
-      value[ID::time0 + 121]->setFromNormalized(0.5388888888888889);
-      value[ID::time0 + 122]->setFromNormalized(0.5555555555555556);
-      value[ID::time0 + 123]->setFromNormalized(0.5888888888888889);
-      value[ID::time0 + 124]->setFromNormalized(0.6055555555555556);
-      value[ID::time0 + 125]->setFromNormalized(0.6208333333333333);
-      value[ID::time0 + 126]->setFromNormalized(0.6513888888888889);
-      value[ID::time0 + 127]->setFromNormalized(0.6666666666666667);
-      value[ID::time0 + 128]->setFromNormalized(0.6944444444444444);
-      value[ID::time0 + 129]->setFromNormalized(0.7222222222222222);
-      value[ID::time0 + 130]->setFromNormalized(0.7375);
-      value[ID::time0 + 131]->setFromNormalized(0.7680555555555555);
-      value[ID::time0 + 132]->setFromNormalized(0.7833333333333333);
-      value[ID::time0 + 133]->setFromNormalized(0.8083333333333333);
-      value[ID::time0 + 134]->setFromNormalized(0.8333333333333334);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.01666666666666672);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.019444444444444486);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.022222222222222254);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.022222222222222254);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.022222222222222254);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.022222222222222254);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.02777777777777779);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.03472222222222221);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.03749999999999998);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.03888888888888886);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.04166666666666663);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.0444444444444444);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.0444444444444444);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.0444444444444444);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.047222222222222276);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.050000000000000044);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.05138888888888893);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.054166666666666696);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.05555555555555558);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.05555555555555558);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.05555555555555558);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.061111111111111116);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.06666666666666665);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.06666666666666665);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.06666666666666665);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.06944444444444442);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.07222222222222219);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.07499999999999996);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.08333333333333337);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.08333333333333337);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.08333333333333337);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.0888888888888889);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.09444444444444444);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.10277777777777775);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.10555555555555551);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.11388888888888893);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.10555555555555551);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.10555555555555551);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.09444444444444444);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.09166666666666667);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.0888888888888889);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.0888888888888889);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.07222222222222219);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.06944444444444442);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.06666666666666665);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.06666666666666665);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.05555555555555558);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.050000000000000044);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.0444444444444444);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.033333333333333326);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.02777777777777779);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.07777777777777772);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.08333333333333337);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.08333333333333337);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.0888888888888889);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.09444444444444444);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.10555555555555551);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.06527777777777777);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.0625);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.061111111111111116);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.061111111111111116);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.061111111111111116);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.061111111111111116);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.061111111111111116);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.061111111111111116);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.061111111111111116);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.05555555555555558);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.054166666666666696);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.05138888888888893);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.05138888888888893);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.054166666666666696);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.05555555555555558);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.05555555555555558);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.05833333333333335);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.21481484307183163);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.2296296861436632);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.24444452921549475);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.25925937228732643);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.2666666666666667);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.27182540893554685);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.28214289347330734);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.2924603780110677);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.3027778201633029);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.3130952623155382);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.3234127044677735);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.33373014662000866);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.3388888888888889);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.34499999152289496);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.35722219679090716);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.36944440205891926);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.3816666073269315);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.39388881259494357);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.4061110178629558);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.4183332231309679);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.4305554283989801);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.4427776336669922);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.4549998389350043);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.46111111111111114);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.4683333502875434);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.48277778625488277);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.49722222222222223);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.5116666581895617);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.526111094156901);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.5333333333333333);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.5377777947319878);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.5466666751437717);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.5555555555555556);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.5644444359673394);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.5733333163791232);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.5777777777777777);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.5861111111111111);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.6027777777777779);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.6111111111111112);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.6166666666666667);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.6333333333333333);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.6444444444444444);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.6555555555555556);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.6555555555555556);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.6555555555555556);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.6472222222222221);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.6305555555555555);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.6138888888888889);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.6055555555555556);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.5944444444444444);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.5722222222222222);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.5611111111111111);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.55);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.5277777777777778);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.5166666666666666);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.5041666666666667);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.47916666666666663);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.4666666666666667);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.4555555555555556);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.43333333333333335);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.4111111111111111);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.4);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.3916666666666667);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.375);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.3666666666666667);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.3569444444444444);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.3375);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.3277777777777777);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.2944444444444444);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.28055555555555556);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.2666666666666667);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.26111111111111107);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.25555555555555554);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.25);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.24722222222222223);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.24444444444444446);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.23333333333333328);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.22777777777777775);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.2222222222222222);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.20833333333333337);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.19999999999999996);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.19444444444444442);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.19444444444444442);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.19444444444444442);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.18888888888888888);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.18888888888888888);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.18333333333333335);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.1777777777777778);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.09444444444444444);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.09166666666666667);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.08333333333333337);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.08333333333333337);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.08333333333333337);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.0888888888888889);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.09999999999999998);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.11111111111111116);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.11111111111111116);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.11111111111111116);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.061111111111111116);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.43333333333333335);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.37222222222222223);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.3666666666666667);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(0.8860000967979431);
-      value[ID::d1FeedMultiply]->setFromNormalized(0.7759999632835388);
-      value[ID::d2FeedMultiply]->setFromNormalized(0.7740001678466797);
-      value[ID::d3FeedMultiply]->setFromNormalized(0.8380001783370972);
-      value[ID::d4FeedMultiply]->setFromNormalized(0.6780002117156982);
-      value[ID::timeOffsetRange]->setFromNormalized(0.6472180485725403);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.3420000374317169);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(0);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(0);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.7600005269050598);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(1.0);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetIris: {
-      value[ID::time0 + 0]->setFromNormalized(0.2222222222222222);
-      value[ID::time0 + 1]->setFromNormalized(0.21111111111111114);
-      value[ID::time0 + 2]->setFromNormalized(0.19999999999999996);
-      value[ID::time0 + 3]->setFromNormalized(0.19444444444444442);
-      value[ID::time0 + 4]->setFromNormalized(0.18888888888888888);
-      value[ID::time0 + 5]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 6]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 7]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 8]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 9]->setFromNormalized(0.11111111111111116);
-      value[ID::time0 + 10]->setFromNormalized(0.12638888888888888);
-      value[ID::time0 + 11]->setFromNormalized(0.15694444444444444);
-      value[ID::time0 + 12]->setFromNormalized(0.17222222222222228);
-      value[ID::time0 + 13]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 14]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 15]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 16]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 17]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 18]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 19]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 20]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 21]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 22]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 23]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 24]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 25]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 26]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 27]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 28]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 29]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 30]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 31]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 32]->setFromNormalized(0.2222222222222222);
-      value[ID::time0 + 33]->setFromNormalized(0.2222222222222222);
-      value[ID::time0 + 34]->setFromNormalized(0.2222222222222222);
-      value[ID::time0 + 35]->setFromNormalized(0.2222222222222222);
-      value[ID::time0 + 36]->setFromNormalized(0.21944444444444444);
-      value[ID::time0 + 37]->setFromNormalized(0.21666666666666667);
-      value[ID::time0 + 38]->setFromNormalized(0.21666666666666667);
-      value[ID::time0 + 39]->setFromNormalized(0.21666666666666667);
-      value[ID::time0 + 40]->setFromNormalized(0.21111111111111114);
-      value[ID::time0 + 41]->setFromNormalized(0.21111111111111114);
-      value[ID::time0 + 42]->setFromNormalized(0.21111111111111114);
-      value[ID::time0 + 43]->setFromNormalized(0.21111111111111114);
-      value[ID::time0 + 44]->setFromNormalized(0.21111111111111114);
-      value[ID::time0 + 45]->setFromNormalized(0.21111111111111114);
-      value[ID::time0 + 46]->setFromNormalized(0.21111111111111114);
-      value[ID::time0 + 47]->setFromNormalized(0.21111111111111114);
-      value[ID::time0 + 48]->setFromNormalized(0.7111111111111111);
-      value[ID::time0 + 49]->setFromNormalized(0.4722222222222222);
-      value[ID::time0 + 50]->setFromNormalized(0.3388888888888889);
-      value[ID::time0 + 51]->setFromNormalized(0.2944444444444444);
-      value[ID::time0 + 52]->setFromNormalized(0.26111111111111107);
-      value[ID::time0 + 53]->setFromNormalized(0.23888888888888893);
-      value[ID::time0 + 54]->setFromNormalized(0.19444444444444442);
-      value[ID::time0 + 55]->setFromNormalized(0.1611111111111111);
-      value[ID::time0 + 56]->setFromNormalized(0.15000000000000002);
-      value[ID::time0 + 57]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 58]->setFromNormalized(0.11111111111111116);
-      value[ID::time0 + 59]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 60]->setFromNormalized(0.07777777777777772);
-      value[ID::time0 + 61]->setFromNormalized(0.06666666666666665);
-      value[ID::time0 + 62]->setFromNormalized(0.05555555555555558);
-      value[ID::time0 + 63]->setFromNormalized(0.05555555555555558);
-      value[ID::time0 + 64]->setFromNormalized(0.050000000000000044);
-      value[ID::time0 + 65]->setFromNormalized(0.050000000000000044);
-      value[ID::time0 + 66]->setFromNormalized(0.050000000000000044);
-      value[ID::time0 + 67]->setFromNormalized(0.050000000000000044);
-      value[ID::time0 + 68]->setFromNormalized(0.061111111111111116);
-      value[ID::time0 + 69]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 70]->setFromNormalized(0.10833333333333328);
-      value[ID::time0 + 71]->setFromNormalized(0.1333333333333333);
-      value[ID::time0 + 72]->setFromNormalized(0.8);
-      value[ID::time0 + 73]->setFromNormalized(0.7722222222222223);
-      value[ID::time0 + 74]->setFromNormalized(0.7);
-      value[ID::time0 + 75]->setFromNormalized(0.6666666666666667);
-      value[ID::time0 + 76]->setFromNormalized(0.6166666666666667);
-      value[ID::time0 + 77]->setFromNormalized(0.5833333333333333);
-      value[ID::time0 + 78]->setFromNormalized(0.5222222222222221);
-      value[ID::time0 + 79]->setFromNormalized(0.4722222222222222);
-      value[ID::time0 + 80]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 81]->setFromNormalized(0.4111111111111111);
-      value[ID::time0 + 82]->setFromNormalized(0.3833333333333333);
-      value[ID::time0 + 83]->setFromNormalized(0.35);
-      value[ID::time0 + 84]->setFromNormalized(0.3277777777777777);
-      value[ID::time0 + 85]->setFromNormalized(0.3055555555555556);
-      value[ID::time0 + 86]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 87]->setFromNormalized(0.25555555555555554);
-      value[ID::time0 + 88]->setFromNormalized(0.23333333333333328);
-      value[ID::time0 + 89]->setFromNormalized(0.21111111111111114);
-      value[ID::time0 + 90]->setFromNormalized(0.18888888888888888);
-      value[ID::time0 + 91]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 92]->setFromNormalized(0.17083333333333328);
-      value[ID::time0 + 93]->setFromNormalized(0.15694444444444444);
-      value[ID::time0 + 94]->setFromNormalized(0.15000000000000002);
-      value[ID::time0 + 95]->setFromNormalized(0.14722222222222225);
-      value[ID::time0 + 96]->setFromNormalized(0.1444444444444445);
-      value[ID::time0 + 97]->setFromNormalized(0.1333333333333333);
-      value[ID::time0 + 98]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 99]->setFromNormalized(0.125);
-      value[ID::time0 + 100]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 101]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 102]->setFromNormalized(0.11944444444444446);
-      value[ID::time0 + 103]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 104]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 105]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 106]->setFromNormalized(0.11388888888888893);
-      value[ID::time0 + 107]->setFromNormalized(0.11111111111111116);
-      value[ID::time0 + 108]->setFromNormalized(0.10833333333333328);
-      value[ID::time0 + 109]->setFromNormalized(0.10555555555555551);
-      value[ID::time0 + 110]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 111]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 112]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 113]->setFromNormalized(0.09722222222222221);
-      value[ID::time0 + 114]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 115]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 116]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 117]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 118]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 119]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 120]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 121]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 122]->setFromNormalized(0.21111111111111114);
-      value[ID::time0 + 123]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 124]->setFromNormalized(0.1333333333333333);
-      value[ID::time0 + 125]->setFromNormalized(0.11111111111111116);
-      value[ID::time0 + 126]->setFromNormalized(0.08333333333333337);
-      value[ID::time0 + 127]->setFromNormalized(0.061111111111111116);
-      value[ID::time0 + 128]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 129]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 130]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 131]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 132]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 133]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 134]->setFromNormalized(0.03888888888888886);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.28055555555555556);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.2666666666666667);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.26111111111111107);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.25555555555555554);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.7444444444444445);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.75);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.7722222222222223);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.775);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.7805555555555556);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.7861111111111111);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.7722222222222223);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.7388888888888889);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.6888888888888889);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.4930555555555556);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.3027777777777778);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.2833333333333333);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.2833333333333333);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.3222222222222222);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.2944444444444444);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.25555555555555554);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.2305555555555555);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.21666666666666667);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.21111111111111114);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.2055555555555556);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.2055555555555556);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.2055555555555556);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.20277777777777772);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.19999999999999996);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.19999999999999996);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.19999999999999996);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.19999999999999996);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.19999999999999996);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.19999999999999996);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.19999999999999996);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.19999999999999996);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.20833333333333337);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.21666666666666667);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.2236111111111111);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.23750000000000004);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.2777777777777778);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.2972222222222223);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.31666666666666665);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.36111111111111116);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.40555555555555556);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.7555555555555555);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.7555555555555555);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.7555555555555555);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.7555555555555555);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.7555555555555555);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.7555555555555555);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.7555555555555555);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.7444444444444445);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.6833333333333333);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.6722222222222223);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.6722222222222223);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.6694444444444445);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.6666666666666667);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.6638888888888889);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.6722222222222223);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.6777777777777778);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.6666666666666667);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.6222222222222222);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.5055555555555555);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.4222222222222223);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.3388888888888889);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.27222222222222225);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.25);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.41666666666666663);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.4222222222222223);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.46111111111111114);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.5333333333333333);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.5222222222222221);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.5166666666666666);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.5083333333333333);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.23333333333333328);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.23333333333333328);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.23333333333333328);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.27222222222222225);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.31666666666666665);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.35);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.3666666666666667);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.41666666666666663);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.44999999999999996);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.5111111111111111);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.5388888888888889);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.55);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.5611111111111111);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.5722222222222222);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.5722222222222222);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.21666666666666667);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.21944444444444444);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.2222222222222222);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.2236111111111111);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.22638888888888886);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.22777777777777775);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.2305555555555555);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.23611111111111116);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.2416666666666667);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.24444444444444446);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.24722222222222223);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.25277777777777777);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.25555555555555554);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.2597222222222222);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.2680555555555556);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.27222222222222225);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.27592595418294275);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.2833333333333333);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.2907406700981988);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.2944444444444444);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.2972222222222223);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.3027777777777778);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.3055555555555556);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.30925924513075087);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.31666666666666665);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.32407408820258243);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.3277777777777777);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.33611111111111114);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.35277777777777775);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.36111111111111116);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.375);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.41666666666666663);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.8333333333333334);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.8388888888888889);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.85);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.8555555555555556);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.8611111111111112);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.8611111111111112);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.8611111111111112);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.8722222222222222);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.8722222222222222);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.8722222222222222);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.8722222222222222);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.8722222222222222);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.8722222222222222);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.8722222222222222);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.8555555555555556);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.8305555555555555);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.8055555555555556);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.7861111111111111);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.7666666666666666);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.7166666666666667);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.6833333333333333);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.6611111111111111);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.6444444444444444);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.6277777777777778);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.5888888888888889);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.5555555555555556);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.5333333333333333);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.5111111111111111);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.47777777777777775);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.46111111111111114);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.4388888888888889);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.4222222222222223);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.37777777777777777);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.36111111111111116);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.33333333333333337);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.3111111111111111);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.2944444444444444);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.2833333333333333);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.7277777777777779);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.7333333333333334);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.7444444444444445);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.75);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.7555555555555555);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.7611111111111111);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.7666666666666666);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.7722222222222223);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.40555555555555556);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.28888888888888886);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.1972222222222222);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.7833333333333333);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.7944444444444445);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.7944444444444445);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.8055555555555556);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.8111111111111111);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.23333333333333328);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.19999999999999996);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.16666666666666663);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.15833333333333333);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.8111111111111111);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.8083333333333333);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.8055555555555556);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.3833333333333333);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.36111111111111116);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.34444444444444444);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.31666666666666665);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.2833333333333333);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.27222222222222225);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.25);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.25);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.5444444444444445);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.6444444444444444);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.6444444444444444);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.65);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.6666666666666667);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.6777777777777778);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.6916666666666667);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.7055555555555555);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.7166666666666667);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.7277777777777779);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.7444444444444445);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.75);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.7611111111111111);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.7777777777777778);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.7888888888888889);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.7944444444444445);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.8055555555555556);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.8222222222222222);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.8222222222222222);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.8333333333333334);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.8333333333333334);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.6888888888888889);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.6555555555555556);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.6611111111111111);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.7555555555555555);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.47777777777777775);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.38888888888888884);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.35);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.3277777777777777);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.3277777777777777);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.3277777777777777);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.3277777777777777);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.3666666666666667);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.5388888888888889);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.2777777777777778);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.7333333333333334);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.7027777777777777);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.2666666666666667);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.7722222222222223);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.75);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.7111111111111111);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.24444444444444446);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.6277777777777778);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.6166666666666667);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.6111111111111112);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.6111111111111112);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.6277777777777778);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.6583333333333333);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.15555555555555556);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.15000000000000002);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.15555555555555556);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.7277777777777779);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.7444444444444445);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.6611111111111111);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.35);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.25277777777777777);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.6861111111111111);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.8305555555555555);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.6861111111111111);
-      value[ID::timeMultiply]->setFromNormalized(0.6020000576972961);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::d1FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d2FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d3FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.27521803975105286);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(0);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(0);
-      value[ID::seed]->setFromInt(12616462);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetJuno: {
-      value[ID::time0 + 0]->setFromNormalized(0.9722222222222222);
-      value[ID::time0 + 1]->setFromNormalized(0.9687134504318238);
-      value[ID::time0 + 2]->setFromNormalized(0.9616959068510268);
-      value[ID::time0 + 3]->setFromNormalized(0.9546783659193251);
-      value[ID::time0 + 4]->setFromNormalized(0.9476608170403374);
-      value[ID::time0 + 5]->setFromNormalized(0.9406432787577311);
-      value[ID::time0 + 6]->setFromNormalized(0.9336257298787435);
-      value[ID::time0 + 7]->setFromNormalized(0.9266081915961372);
-      value[ID::time0 + 8]->setFromNormalized(0.9195906427171495);
-      value[ID::time0 + 9]->setFromNormalized(0.9125731044345432);
-      value[ID::time0 + 10]->setFromNormalized(0.9055555661519369);
-      value[ID::time0 + 11]->setFromNormalized(0.8985380278693305);
-      value[ID::time0 + 12]->setFromNormalized(0.8915204895867241);
-      value[ID::time0 + 13]->setFromNormalized(0.8845029513041178);
-      value[ID::time0 + 14]->setFromNormalized(0.8774854130215115);
-      value[ID::time0 + 15]->setFromNormalized(0.8704678747389052);
-      value[ID::time0 + 16]->setFromNormalized(0.8634503364562989);
-      value[ID::time0 + 17]->setFromNormalized(0.8564327981736926);
-      value[ID::time0 + 18]->setFromNormalized(0.8494152598910861);
-      value[ID::time0 + 19]->setFromNormalized(0.8423977216084798);
-      value[ID::time0 + 20]->setFromNormalized(0.8353801833258735);
-      value[ID::time0 + 21]->setFromNormalized(0.8283626450432672);
-      value[ID::time0 + 22]->setFromNormalized(0.8213450961642795);
-      value[ID::time0 + 23]->setFromNormalized(0.8143275578816732);
-      value[ID::time0 + 24]->setFromNormalized(0.8073100195990668);
-      value[ID::time0 + 25]->setFromNormalized(0.8002924813164605);
-      value[ID::time0 + 26]->setFromNormalized(0.7932749430338542);
-      value[ID::time0 + 27]->setFromNormalized(0.7862574047512478);
-      value[ID::time0 + 28]->setFromNormalized(0.7792398664686415);
-      value[ID::time0 + 29]->setFromNormalized(0.7722223281860352);
-      value[ID::time0 + 30]->setFromNormalized(0.7652047899034289);
-      value[ID::time0 + 31]->setFromNormalized(0.7581872516208225);
-      value[ID::time0 + 32]->setFromNormalized(0.7511697133382161);
-      value[ID::time0 + 33]->setFromNormalized(0.7441521750556098);
-      value[ID::time0 + 34]->setFromNormalized(0.7371346367730034);
-      value[ID::time0 + 35]->setFromNormalized(0.7301170984903971);
-      value[ID::time0 + 36]->setFromNormalized(0.7230995602077908);
-      value[ID::time0 + 37]->setFromNormalized(0.7160820219251844);
-      value[ID::time0 + 38]->setFromNormalized(0.7090644836425781);
-      value[ID::time0 + 39]->setFromNormalized(0.7020469453599718);
-      value[ID::time0 + 40]->setFromNormalized(0.6950294070773655);
-      value[ID::time0 + 41]->setFromNormalized(0.6880118687947592);
-      value[ID::time0 + 42]->setFromNormalized(0.6809943305121529);
-      value[ID::time0 + 43]->setFromNormalized(0.6739767922295464);
-      value[ID::time0 + 44]->setFromNormalized(0.6669592539469401);
-      value[ID::time0 + 45]->setFromNormalized(0.6599417156643338);
-      value[ID::time0 + 46]->setFromNormalized(0.6529241773817274);
-      value[ID::time0 + 47]->setFromNormalized(0.645906639099121);
-      value[ID::time0 + 48]->setFromNormalized(0.6388891008165147);
-      value[ID::time0 + 49]->setFromNormalized(0.6318715413411458);
-      value[ID::time0 + 50]->setFromNormalized(0.6248539818657769);
-      value[ID::time0 + 51]->setFromNormalized(0.617836422390408);
-      value[ID::time0 + 52]->setFromNormalized(0.6108188629150391);
-      value[ID::time0 + 53]->setFromNormalized(0.6038013034396701);
-      value[ID::time0 + 54]->setFromNormalized(0.5967837439643012);
-      value[ID::time0 + 55]->setFromNormalized(0.5897661844889324);
-      value[ID::time0 + 56]->setFromNormalized(0.5827486250135634);
-      value[ID::time0 + 57]->setFromNormalized(0.5757310655381944);
-      value[ID::time0 + 58]->setFromNormalized(0.5687135060628254);
-      value[ID::time0 + 59]->setFromNormalized(0.5616959465874566);
-      value[ID::time0 + 60]->setFromNormalized(0.5546783871120877);
-      value[ID::time0 + 61]->setFromNormalized(0.5476608276367188);
-      value[ID::time0 + 62]->setFromNormalized(0.5406432681613498);
-      value[ID::time0 + 63]->setFromNormalized(0.5336257086859809);
-      value[ID::time0 + 64]->setFromNormalized(0.526608149210612);
-      value[ID::time0 + 65]->setFromNormalized(0.5195905897352431);
-      value[ID::time0 + 66]->setFromNormalized(0.5125730302598741);
-      value[ID::time0 + 67]->setFromNormalized(0.5055554707845051);
-      value[ID::time0 + 68]->setFromNormalized(0.4985379113091363);
-      value[ID::time0 + 69]->setFromNormalized(0.4915203518337674);
-      value[ID::time0 + 70]->setFromNormalized(0.48450279235839844);
-      value[ID::time0 + 71]->setFromNormalized(0.47748523288302946);
-      value[ID::time0 + 72]->setFromNormalized(0.4704676734076606);
-      value[ID::time0 + 73]->setFromNormalized(0.46345011393229163);
-      value[ID::time0 + 74]->setFromNormalized(0.45643255445692277);
-      value[ID::time0 + 75]->setFromNormalized(0.4494149949815538);
-      value[ID::time0 + 76]->setFromNormalized(0.44239743550618493);
-      value[ID::time0 + 77]->setFromNormalized(0.43537987603081596);
-      value[ID::time0 + 78]->setFromNormalized(0.4283623165554471);
-      value[ID::time0 + 79]->setFromNormalized(0.4213447570800781);
-      value[ID::time0 + 80]->setFromNormalized(0.41432719760470915);
-      value[ID::time0 + 81]->setFromNormalized(0.4073096381293403);
-      value[ID::time0 + 82]->setFromNormalized(0.4002920786539713);
-      value[ID::time0 + 83]->setFromNormalized(0.39327451917860246);
-      value[ID::time0 + 84]->setFromNormalized(0.3862569597032335);
-      value[ID::time0 + 85]->setFromNormalized(0.3792394002278646);
-      value[ID::time0 + 86]->setFromNormalized(0.37222184075249565);
-      value[ID::time0 + 87]->setFromNormalized(0.3652042812771268);
-      value[ID::time0 + 88]->setFromNormalized(0.3581867218017578);
-      value[ID::time0 + 89]->setFromNormalized(0.35116916232638884);
-      value[ID::time0 + 90]->setFromNormalized(0.34415160285102);
-      value[ID::time0 + 91]->setFromNormalized(0.337134043375651);
-      value[ID::time0 + 92]->setFromNormalized(0.33011648390028214);
-      value[ID::time0 + 93]->setFromNormalized(0.32309892442491317);
-      value[ID::time0 + 94]->setFromNormalized(0.3160813649495443);
-      value[ID::time0 + 95]->setFromNormalized(0.30906380547417533);
-      value[ID::time0 + 96]->setFromNormalized(0.3020462459988065);
-      value[ID::time0 + 97]->setFromNormalized(0.2950286865234375);
-      value[ID::time0 + 98]->setFromNormalized(0.28801108466254344);
-      value[ID::time0 + 99]->setFromNormalized(0.28099356757269967);
-      value[ID::time0 + 100]->setFromNormalized(0.2739760504828559);
-      value[ID::time0 + 101]->setFromNormalized(0.2669585333930121);
-      value[ID::time0 + 102]->setFromNormalized(0.25994101630316835);
-      value[ID::time0 + 103]->setFromNormalized(0.2529234992133247);
-      value[ID::time0 + 104]->setFromNormalized(0.24590598212348092);
-      value[ID::time0 + 105]->setFromNormalized(0.23888846503363714);
-      value[ID::time0 + 106]->setFromNormalized(0.23187094794379337);
-      value[ID::time0 + 107]->setFromNormalized(0.2248534308539496);
-      value[ID::time0 + 108]->setFromNormalized(0.21783591376410594);
-      value[ID::time0 + 109]->setFromNormalized(0.21081839667426217);
-      value[ID::time0 + 110]->setFromNormalized(0.2038008795844184);
-      value[ID::time0 + 111]->setFromNormalized(0.19678336249457462);
-      value[ID::time0 + 112]->setFromNormalized(0.18976584540473085);
-      value[ID::time0 + 113]->setFromNormalized(0.1827483283148872);
-      value[ID::time0 + 114]->setFromNormalized(0.17573081122504342);
-      value[ID::time0 + 115]->setFromNormalized(0.16871329413519964);
-      value[ID::time0 + 116]->setFromNormalized(0.16169577704535587);
-      value[ID::time0 + 117]->setFromNormalized(0.1546782599555121);
-      value[ID::time0 + 118]->setFromNormalized(0.14766074286566844);
-      value[ID::time0 + 119]->setFromNormalized(0.14064322577582467);
-      value[ID::time0 + 120]->setFromNormalized(0.1336257086859809);
-      value[ID::time0 + 121]->setFromNormalized(0.12660819159613712);
-      value[ID::time0 + 122]->setFromNormalized(0.11959067450629335);
-      value[ID::time0 + 123]->setFromNormalized(0.11257315741644969);
-      value[ID::time0 + 124]->setFromNormalized(0.10555564032660592);
-      value[ID::time0 + 125]->setFromNormalized(0.09853812323676214);
-      value[ID::time0 + 126]->setFromNormalized(0.09152060614691837);
-      value[ID::time0 + 127]->setFromNormalized(0.0845030890570746);
-      value[ID::time0 + 128]->setFromNormalized(0.07748557196723094);
-      value[ID::time0 + 129]->setFromNormalized(0.07046805487738717);
-      value[ID::time0 + 130]->setFromNormalized(0.06345053778754339);
-      value[ID::time0 + 131]->setFromNormalized(0.05643302069769962);
-      value[ID::time0 + 132]->setFromNormalized(0.04941550360785585);
-      value[ID::time0 + 133]->setFromNormalized(0.04239798651801219);
-      value[ID::time0 + 134]->setFromNormalized(0.03888888888888886);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.2055555555555556);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.2319444444444444);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.2402777777777778);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.26111111111111107);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.24444444444444446);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.24375000000000002);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.24236111111111114);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.24097222222222225);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.23958333333333337);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.25);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.25);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.23888888888888893);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.23611111111111116);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.23333333333333328);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.2305555555555555);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.24722222222222223);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.2222222222222222);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.2222222222222222);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.21666666666666667);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.21666666666666667);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.21666666666666667);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.2055555555555556);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.2055555555555556);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.19999999999999996);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.19444444444444442);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.18888888888888888);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.18333333333333335);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.1777777777777778);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.17222222222222228);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.1694444444444444);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.16666666666666663);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.1611111111111111);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.15833333333333333);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.15555555555555556);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.14722222222222225);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.9666666666666667);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.9222222222222223);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.8888888888888888);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.8777777777777778);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.85);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.8277777777777777);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.85);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.8444444444444444);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.8055555555555556);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.7833333333333333);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.7611111111111111);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.7333333333333334);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.7);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.6777777777777778);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.6611111111111111);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.65);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.6444444444444444);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.6388888888888888);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.6444444444444444);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.65);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.6555555555555556);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.6666666666666667);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.6888888888888889);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.7222222222222222);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.75);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.7777777777777778);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.8);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.8111111111111111);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.8277777777777777);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.8388888888888889);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.8555555555555556);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.8666666666666667);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.8722222222222222);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.8833333333333333);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.8888888888888888);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.8944444444444445);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.9);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.9);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.9);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.9055555555555556);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.9055555555555556);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.9055555555555556);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.9083333333333333);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.9111111111111111);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.9138888888888889);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.9166666666666666);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.9166666666666666);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.9194444444444444);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.925);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.9277777777777778);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.9333333333333333);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.9388888888888889);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.9638888888888889);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.9222222222222223);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.9166666666666666);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.9166666666666666);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.9166666666666666);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.9055555555555556);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.9);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.8944444444444445);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.8833333333333333);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.35);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.35);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.35);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.3555555555555555);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.3555555555555555);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.3555555555555555);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.3666666666666667);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.37222222222222223);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.37777777777777777);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.37777777777777777);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.37777777777777777);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.37777777777777777);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.37777777777777777);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.37777777777777777);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.37777777777777777);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.37777777777777777);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.37222222222222223);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.3666666666666667);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.3555555555555555);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.35277777777777775);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.34444444444444444);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.34444444444444444);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.33333333333333337);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.3277777777777777);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.31666666666666665);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.3111111111111111);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.30000000000000004);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.3666666666666667);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.3944444444444445);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.40555555555555556);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.41666666666666663);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.41666666666666663);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.4111111111111111);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.38888888888888884);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.3388888888888889);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.30833333333333335);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.4444444444444444);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.4555555555555556);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.4555555555555556);
-      value[ID::timeMultiply]->setFromNormalized(0.2179999947547913);
-      value[ID::innerFeedMultiply]->setFromNormalized(0.5);
-      value[ID::d1FeedMultiply]->setFromNormalized(0.5);
-      value[ID::d2FeedMultiply]->setFromNormalized(0.5);
-      value[ID::d3FeedMultiply]->setFromNormalized(0.5);
-      value[ID::d4FeedMultiply]->setFromNormalized(0.5);
-      value[ID::timeOffsetRange]->setFromNormalized(0.5);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.5);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.5);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.5);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.5);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.5);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(0);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(0);
-      value[ID::seed]->setFromInt(4060084);
-      value[ID::stereoCross]->setFromNormalized(0.8759997487068176);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.1879999190568924);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetPallas: {
-      value[ID::time0 + 0]->setFromNormalized(0.06666666666666665);
-      value[ID::time0 + 1]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 2]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 3]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 4]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 5]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 6]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 7]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 8]->setFromNormalized(0.043518490261501785);
-      value[ID::time0 + 9]->setFromNormalized(0.04166666666666663);
-      value[ID::time0 + 10]->setFromNormalized(0.039814843071831585);
-      value[ID::time0 + 11]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 12]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 13]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 14]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 15]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 16]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 17]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 18]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 19]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 20]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 21]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 22]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 23]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 24]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 25]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 26]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 27]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 28]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 29]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 30]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 31]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 32]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 33]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 34]->setFromNormalized(0.04166666666666663);
-      value[ID::time0 + 35]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 36]->setFromNormalized(0.04583333333333328);
-      value[ID::time0 + 37]->setFromNormalized(0.04861111111111116);
-      value[ID::time0 + 38]->setFromNormalized(0.050000000000000044);
-      value[ID::time0 + 39]->setFromNormalized(0.054166666666666696);
-      value[ID::time0 + 40]->setFromNormalized(0.0625);
-      value[ID::time0 + 41]->setFromNormalized(0.06666666666666665);
-      value[ID::time0 + 42]->setFromNormalized(0.06944444444444442);
-      value[ID::time0 + 43]->setFromNormalized(0.07499999999999996);
-      value[ID::time0 + 44]->setFromNormalized(0.07777777777777772);
-      value[ID::time0 + 45]->setFromNormalized(0.08194444444444449);
-      value[ID::time0 + 46]->setFromNormalized(0.09027777777777779);
-      value[ID::time0 + 47]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 48]->setFromNormalized(0.09722222222222221);
-      value[ID::time0 + 49]->setFromNormalized(0.10277777777777775);
-      value[ID::time0 + 50]->setFromNormalized(0.10833333333333328);
-      value[ID::time0 + 51]->setFromNormalized(0.11111111111111116);
-      value[ID::time0 + 52]->setFromNormalized(0.11388888888888893);
-      value[ID::time0 + 53]->setFromNormalized(0.11944444444444446);
-      value[ID::time0 + 54]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 55]->setFromNormalized(0.125);
-      value[ID::time0 + 56]->setFromNormalized(0.13055555555555554);
-      value[ID::time0 + 57]->setFromNormalized(0.13611111111111107);
-      value[ID::time0 + 58]->setFromNormalized(0.13888888888888884);
-      value[ID::time0 + 59]->setFromNormalized(0.1430555555555556);
-      value[ID::time0 + 60]->setFromNormalized(0.1513888888888889);
-      value[ID::time0 + 61]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 62]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 63]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 64]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 65]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 66]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 67]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 68]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 69]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 70]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 71]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 72]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 73]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 74]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 75]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 76]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 77]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 78]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 79]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 80]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 81]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 82]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 83]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 84]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 85]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 86]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 87]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 88]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 89]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 90]->setFromNormalized(0.1444444444444445);
-      value[ID::time0 + 91]->setFromNormalized(0.1430555555555556);
-      value[ID::time0 + 92]->setFromNormalized(0.14027777777777772);
-      value[ID::time0 + 93]->setFromNormalized(0.13888888888888884);
-      value[ID::time0 + 94]->setFromNormalized(0.13888888888888884);
-      value[ID::time0 + 95]->setFromNormalized(0.13611111111111107);
-      value[ID::time0 + 96]->setFromNormalized(0.1333333333333333);
-      value[ID::time0 + 97]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 98]->setFromNormalized(0.12638888888888888);
-      value[ID::time0 + 99]->setFromNormalized(0.12361111111111112);
-      value[ID::time0 + 100]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 101]->setFromNormalized(0.11388888888888893);
-      value[ID::time0 + 102]->setFromNormalized(0.10555555555555551);
-      value[ID::time0 + 103]->setFromNormalized(0.10277777777777775);
-      value[ID::time0 + 104]->setFromNormalized(0.09722222222222221);
-      value[ID::time0 + 105]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 106]->setFromNormalized(0.09166666666666667);
-      value[ID::time0 + 107]->setFromNormalized(0.0888888888888889);
-      value[ID::time0 + 108]->setFromNormalized(0.08333333333333337);
-      value[ID::time0 + 109]->setFromNormalized(0.07777777777777772);
-      value[ID::time0 + 110]->setFromNormalized(0.07222222222222219);
-      value[ID::time0 + 111]->setFromNormalized(0.07222222222222219);
-      value[ID::time0 + 112]->setFromNormalized(0.061111111111111116);
-      value[ID::time0 + 113]->setFromNormalized(0.05555555555555558);
-      value[ID::time0 + 114]->setFromNormalized(0.05555555555555558);
-      value[ID::time0 + 115]->setFromNormalized(0.050000000000000044);
-      value[ID::time0 + 116]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 117]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 118]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 119]->setFromNormalized(0.04166666666666663);
-      value[ID::time0 + 120]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 121]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 122]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 123]->setFromNormalized(0.036111111111111094);
-      value[ID::time0 + 124]->setFromNormalized(0.033333333333333326);
-      value[ID::time0 + 125]->setFromNormalized(0.033333333333333326);
-      value[ID::time0 + 126]->setFromNormalized(0.033333333333333326);
-      value[ID::time0 + 127]->setFromNormalized(0.033333333333333326);
-      value[ID::time0 + 128]->setFromNormalized(0.033333333333333326);
-      value[ID::time0 + 129]->setFromNormalized(0.033333333333333326);
-      value[ID::time0 + 130]->setFromNormalized(0.033333333333333326);
-      value[ID::time0 + 131]->setFromNormalized(0.033333333333333326);
-      value[ID::time0 + 132]->setFromNormalized(0.033333333333333326);
-      value[ID::time0 + 133]->setFromNormalized(0.033333333333333326);
-      value[ID::time0 + 134]->setFromNormalized(0.036111111111111094);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.0028838582493650455);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.4826310474721326);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.7123188952445287);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.10761660737179823);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.37104845874533887);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.7045746830439195);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.3842018696899542);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.4293540398958035);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.585134593069748);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.09600390330126429);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.45039665806082246);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.3372399079126881);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.9362140549035921);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.3955602118644521);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.586973067879976);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.6655833197099261);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.9896839610592383);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.0630590044646479);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.530080074692636);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.3323679639213518);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.4496415434736982);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.8417892954809157);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.48006196184233013);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.8921575978469203);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.9083552243236991);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.8674605379537444);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.4152410657686701);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.22824745960420473);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.09599172252732668);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.5671385138042109);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.16876986954124695);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.518659472982405);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.6137964452832722);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.24588306603065457);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.3248054091720942);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.0486630853120803);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.8529879547451662);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.32120815563798194);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.8141251459821104);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.1792882707107072);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.4269377056047326);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.9381196555282897);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.23692484241987521);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.7672908508298468);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.2338269843994621);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.37697831326557424);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.35171834557652476);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.9771072342621007);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.12222222222222223);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.530218996155283);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.8848318449913851);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.7014243467077802);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.9034456335545636);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.8318447862744326);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.6110080470189839);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.9138954739420079);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.18278657361701034);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.7144257534929976);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.43856289070774707);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.47015496448192107);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.5104919383984539);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.44422478643326163);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.32413189054317465);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.1617389452739787);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.8704686759624459);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.4626221170890182);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.9842261135889087);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.11450680737181845);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.17089234663684333);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.17960627360774173);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.6132510483412072);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.36914742141031215);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.031943097913593954);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.6336474591203228);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.07590852073983945);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.31003907469430253);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.8988212742570355);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.2853044102583745);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.25814830996743615);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.8231064968778306);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.36181669947929346);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.5547134366320932);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.02356227710308717);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.3273148572815223);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.9685810183192783);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.0095162512953883);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.1155816522917602);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.8863555645557892);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.5659204842014465);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.8835769813485413);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.8720547052883934);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.9256799492260697);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.6356902672171436);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.4077571073082668);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.7642459610747561);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.010077939576319639);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.515500744701522);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.2286011255654522);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.4486512572866139);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.8403669847197588);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.5968529168965966);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.06765939971102175);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.7840289529913076);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.08932203752951601);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.25439927106998417);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.4872366813072054);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.3034618055601165);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.161496937416845);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.08472446368254993);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.6187944310563154);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.7825288063333015);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.4037816211937501);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.7493385584871839);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.9811513615223426);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.9154765382985117);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.3748496506898913);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.8884693537451227);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.4349022649442571);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.11609905814792604);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.05842209340965693);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.5208004628197334);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.038309792909036855);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.5815908761079899);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.23942246932338612);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.12114369100165606);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.568212841230329);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.8537848246666168);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.2980467318033392);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.5123181609971688);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.2952567192854035);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.5031403687056345);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.3447631420508134);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.8800628872782866);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.8183670377024389);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.7489277396943752);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.4);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.17135177751251718);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.09550873593680004);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.19923317381170164);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.08258503555714125);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.9659054165106005);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.5117625964305308);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.0656173025211495);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.37014695744492965);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.32354770577084185);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.9475703209574836);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.026356637767785795);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.837410768768814);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.6388573205090871);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.23186450596406205);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.9554267206800897);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.7211656499142128);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.7416471481491617);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.2638652702381475);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.15230798939956997);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.48464193244065434);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.7637492756011091);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.9848630766287738);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.016017364887921826);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.39511439473501436);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.7539375568614749);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.6205097141278555);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.2612414142130246);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.905004580801005);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.8704811608691517);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.14901684576356844);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.977033649226647);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.2144828934819396);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.45192774146005077);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.9080783300075658);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.49009975131845057);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.8492256800481005);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.09956462797557297);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.49326337593307185);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.7914195594316835);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.9108827301225492);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.5450321912152646);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.09421525171145945);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.21048813146365625);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.031023817679377896);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.452271031810971);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.21167764734939443);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.8434305342970759);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.2704963546670098);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.9772049514449427);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.0704187552768531);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.002032993632025748);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.33565776579201706);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.0752856872151692);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.6783413204725101);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.2249968670732182);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.9222222222222223);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.27128347082711235);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.22043539477684354);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.28635534388106876);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.43040860133580344);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.5411603614643192);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.6805449170050033);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.05148737922580471);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.8020111460246044);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.729257350989929);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.5229163223078767);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.767204169616792);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.43931178550552);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.09412961551688848);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.43998493023084834);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.8725052468193476);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.5221741229821005);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.3807132932471022);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.03462995382784484);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.17115950031180166);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.07429578296078576);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.3428624919626845);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.9319899593483291);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.4512444756411175);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.2634887914238445);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.3834149353008128);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.7828019478461546);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.9153027795524954);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.8618575430125143);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.8851670723347116);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.44877545138471586);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.5363036136332872);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.14951574408675572);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.2792495422550841);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.09127550721610067);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.20496840600604688);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.7368737695708252);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.4955111384008423);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.3188802580339969);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.4953578902283967);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.5586697697955917);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.7954527409650979);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.881566313966813);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.49708208727874215);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.1681129540398083);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.19947388744127015);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.21148172947464916);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.31874641181848773);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.1810644725128865);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.24042950328431212);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.3818096367333847);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.6930598845883292);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.7001234967042707);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.0298796258181398);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.9994193055271113);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.43003890270597744);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.2935650066065698);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.49041911370819136);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.7258954161818549);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.5583715877190207);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.25450936065884966);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.784131340744763);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.31224329909579013);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.362547428806813);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.023836790016575016);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.40416207958023437);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.6605559415542832);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.6160345754269756);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.3098639803229094);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.8753157870131909);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.5894699722127918);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.5223870946744579);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.6954832788484401);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.29806626661055846);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.11475573534636047);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.9816103292567182);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.7985660070848924);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.9724280788961219);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.7153144451889935);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.1611111111111111);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.44923449283093486);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.12234342014651034);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.1431559623840306);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.633934971496026);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.11308026435829932);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.0343299225956194);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.16855810689818307);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.44216744998819774);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.9285722973455516);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.9730473429642604);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.16857832748017743);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.37510217931353385);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.5873531813685405);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.3552316624317082);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.7481869267513219);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.6673217318622748);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.2601237886046107);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.36829911747805383);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.8929800362850187);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.9910449806940173);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.6599507005894244);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.6374431771240394);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.8756117181771194);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.3086559592449978);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.17736696691087817);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.7496901388691434);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.637734827374637);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.9671503831256555);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.3919257502034645);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.10432194339958595);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.05989953974286594);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.764166241721872);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.3924397288319944);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.24223590915056536);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.39580833310457497);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.6288306832409132);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.10052228340597408);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.1740433814707757);
-      value[ID::timeMultiply]->setFromNormalized(0.33799973130226135);
-      value[ID::innerFeedMultiply]->setFromNormalized(0.9360001683235168);
-      value[ID::d1FeedMultiply]->setFromNormalized(0.9640000462532043);
-      value[ID::d2FeedMultiply]->setFromNormalized(0.952000081539154);
-      value[ID::d3FeedMultiply]->setFromNormalized(0.9660000205039978);
-      value[ID::d4FeedMultiply]->setFromNormalized(0.9680001139640808);
-      value[ID::timeOffsetRange]->setFromNormalized(0.2752180285130085);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.3760000169277191);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.3160000145435333);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.3280000388622284);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.31800004839897156);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.30800002813339233);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(1);
-      value[ID::d1FeedModulation]->setFromInt(1);
-      value[ID::d2FeedModulation]->setFromInt(1);
-      value[ID::d3FeedModulation]->setFromInt(1);
-      value[ID::d4FeedModulation]->setFromInt(1);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetPatientia: {
-      value[ID::time0 + 0]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 1]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 2]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 3]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 4]->setFromNormalized(0.022222222222222254);
-      value[ID::time0 + 5]->setFromNormalized(0.033333333333333326);
-      value[ID::time0 + 6]->setFromNormalized(0.047222222222222276);
-      value[ID::time0 + 7]->setFromNormalized(0.061111111111111116);
-      value[ID::time0 + 8]->setFromNormalized(0.08333333333333337);
-      value[ID::time0 + 9]->setFromNormalized(0.09722222222222221);
-      value[ID::time0 + 10]->setFromNormalized(0.11111111111111116);
-      value[ID::time0 + 11]->setFromNormalized(0.5555555555555556);
-      value[ID::time0 + 12]->setFromNormalized(0.5111111111111111);
-      value[ID::time0 + 13]->setFromNormalized(0.5);
-      value[ID::time0 + 14]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 15]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 16]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 17]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 18]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 19]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 20]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 21]->setFromNormalized(0.5);
-      value[ID::time0 + 22]->setFromNormalized(0.5055555555555555);
-      value[ID::time0 + 23]->setFromNormalized(0.5092592451307509);
-      value[ID::time0 + 24]->setFromNormalized(0.5166666666666666);
-      value[ID::time0 + 25]->setFromNormalized(0.5240740882025825);
-      value[ID::time0 + 26]->setFromNormalized(0.5277777777777778);
-      value[ID::time0 + 27]->setFromNormalized(0.5324074215359158);
-      value[ID::time0 + 28]->setFromNormalized(0.5416666666666667);
-      value[ID::time0 + 29]->setFromNormalized(0.5509259117974175);
-      value[ID::time0 + 30]->setFromNormalized(0.5555555555555556);
-      value[ID::time0 + 31]->setFromNormalized(0.27222222222222225);
-      value[ID::time0 + 32]->setFromNormalized(0.27222222222222225);
-      value[ID::time0 + 33]->setFromNormalized(0.27222222222222225);
-      value[ID::time0 + 34]->setFromNormalized(0.27361111111111114);
-      value[ID::time0 + 35]->setFromNormalized(0.2763888888888889);
-      value[ID::time0 + 36]->setFromNormalized(0.2777777777777778);
-      value[ID::time0 + 37]->setFromNormalized(0.28055555555555556);
-      value[ID::time0 + 38]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 39]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 40]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 41]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 42]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 43]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 44]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 45]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 46]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 47]->setFromNormalized(0.2944444444444444);
-      value[ID::time0 + 48]->setFromNormalized(0.2944444444444444);
-      value[ID::time0 + 49]->setFromNormalized(0.2944444444444444);
-      value[ID::time0 + 50]->setFromNormalized(0.30000000000000004);
-      value[ID::time0 + 51]->setFromNormalized(0.30000000000000004);
-      value[ID::time0 + 52]->setFromNormalized(0.30000000000000004);
-      value[ID::time0 + 53]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 54]->setFromNormalized(0.25555555555555554);
-      value[ID::time0 + 55]->setFromNormalized(0.24722222222222223);
-      value[ID::time0 + 56]->setFromNormalized(0.23888888888888893);
-      value[ID::time0 + 57]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 58]->setFromNormalized(0.21666666666666667);
-      value[ID::time0 + 59]->setFromNormalized(0.20972222222222225);
-      value[ID::time0 + 60]->setFromNormalized(0.1958333333333333);
-      value[ID::time0 + 61]->setFromNormalized(0.18888888888888888);
-      value[ID::time0 + 62]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 63]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 64]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 65]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 66]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 67]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 68]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 69]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 70]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 71]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 72]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 73]->setFromNormalized(0.17222222222222228);
-      value[ID::time0 + 74]->setFromNormalized(0.1777777777777778);
-      value[ID::time0 + 75]->setFromNormalized(0.18055555555555558);
-      value[ID::time0 + 76]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 77]->setFromNormalized(0.18888888888888888);
-      value[ID::time0 + 78]->setFromNormalized(0.19444444444444442);
-      value[ID::time0 + 79]->setFromNormalized(0.19999999999999996);
-      value[ID::time0 + 80]->setFromNormalized(0.2055555555555556);
-      value[ID::time0 + 81]->setFromNormalized(0.21666666666666667);
-      value[ID::time0 + 82]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 83]->setFromNormalized(0.24444444444444446);
-      value[ID::time0 + 84]->setFromNormalized(0.27222222222222225);
-      value[ID::time0 + 85]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 86]->setFromNormalized(0.3111111111111111);
-      value[ID::time0 + 87]->setFromNormalized(0.3111111111111111);
-      value[ID::time0 + 88]->setFromNormalized(0.3111111111111111);
-      value[ID::time0 + 89]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 90]->setFromNormalized(0.27222222222222225);
-      value[ID::time0 + 91]->setFromNormalized(0.25555555555555554);
-      value[ID::time0 + 92]->setFromNormalized(0.2222222222222222);
-      value[ID::time0 + 93]->setFromNormalized(0.19444444444444442);
-      value[ID::time0 + 94]->setFromNormalized(0.18611111111111112);
-      value[ID::time0 + 95]->setFromNormalized(0.1694444444444444);
-      value[ID::time0 + 96]->setFromNormalized(0.1611111111111111);
-      value[ID::time0 + 97]->setFromNormalized(0.7777777777777778);
-      value[ID::time0 + 98]->setFromNormalized(0.13888888888888884);
-      value[ID::time0 + 99]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 100]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 101]->setFromNormalized(0.11388888888888893);
-      value[ID::time0 + 102]->setFromNormalized(0.10833333333333328);
-      value[ID::time0 + 103]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 104]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 105]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 106]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 107]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 108]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 109]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 110]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 111]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 112]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 113]->setFromNormalized(0.9055555555555556);
-      value[ID::time0 + 114]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 115]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 116]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 117]->setFromNormalized(0.08333333333333337);
-      value[ID::time0 + 118]->setFromNormalized(0.07222222222222219);
-      value[ID::time0 + 119]->setFromNormalized(0.06388888888888888);
-      value[ID::time0 + 120]->setFromNormalized(0.05555555555555558);
-      value[ID::time0 + 121]->setFromNormalized(0.050000000000000044);
-      value[ID::time0 + 122]->setFromNormalized(0.050000000000000044);
-      value[ID::time0 + 123]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 124]->setFromNormalized(0.06666666666666665);
-      value[ID::time0 + 125]->setFromNormalized(0.06666666666666665);
-      value[ID::time0 + 126]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 127]->setFromNormalized(0.07222222222222219);
-      value[ID::time0 + 128]->setFromNormalized(0.09444444444444444);
-      value[ID::time0 + 129]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 130]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 131]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 132]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 133]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 134]->setFromNormalized(0.10277777777777775);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.48888888888888893);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.49444444444444446);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.5111111111111111);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.5138888888888888);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.5166666666666666);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.5222222222222221);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.5277777777777778);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.5333333333333333);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.5361111111111111);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.5388888888888889);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.5388888888888889);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.5388888888888889);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.42120215932180105);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.4425563741455929);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.4425563741455929);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.4425563741455929);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.4425563741455929);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.4425563741455929);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.4425563741455929);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.4425563741455929);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.4425563741455929);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.4425563741455929);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.4582924532168463);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.45863016614626456);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.45879902261097366);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.4589678790756828);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.45930559200510107);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.45947444846981017);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.46048758725806493);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.46150072604631975);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.46217615190515615);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.46285157776399266);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.46717430326054626);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.47390357109213427);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.4753807274454097);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.4768578837986852);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.4785812328775064);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.4803045819563278);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.4825203164862409);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.484736051016154);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.49210312213538965);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.4940773416015422);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.4960515610676949);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.49964105100615414);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.5061380277947652);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.5096916228338401);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.5109838392116852);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.5122760555895307);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.5132452178729147);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.5142143801562986);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.5129383164831764);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.5130836908256841);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.5130110036544303);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.5128656293119226);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.5127202549694151);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.5125748806269075);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.5125021934556535);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.5112519741100882);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.5112519741100882);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.5112519741100882);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.5112519741100882);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.5112519741100882);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.5112519741100882);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.5112145922789015);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.5111398286165281);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.5110650649541545);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.510990301291781);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.5109155376294073);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.510840773967034);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.5107660103046603);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.5107286264770609);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.5107122718635289);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.5106795626364645);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.5106468534094003);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.5106141441823362);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.510581434955272);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.5105487257282078);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.5105160165011436);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.5104833072740793);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.5104669526605472);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.5103797283877781);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.5102052788440337);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.5100308293002889);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.5098563797565442);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.5096819302127998);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.5095074806690553);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.5094202573944925);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.508360478437612);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.5081249720027496);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.5078894655678874);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.5077717123504564);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.5076539591330251);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.5074184526981629);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.5071829462633005);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.5069474398284384);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.5067119333935759);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.5064764269587136);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.5062409205238513);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.5061231673064202);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.5058876608715577);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.5054166480018333);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.5049456351321086);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.5044746222623838);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.5040036093926594);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.503768102957797);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.5033265283924302);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.5024433792616964);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.5015602301309628);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.5006770810002291);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.5002355064348621);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.49973505526077994);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.4987812541995875);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.4983043536689914);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.4978451166600413);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.4969266410250468);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.4960081653900524);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.4955489283811023);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.5000998968909595);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.43333333333333335);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.43194444444444446);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.4291666666666667);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.4277777777777778);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.42592591179741757);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.4222222222222223);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.4185185326470269);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.4148148430718316);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.44168002780914306);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.45261500000000005);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.46719499999999997);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.47342795);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.4880425775);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.4928255465);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.49784766395);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.50215233605);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.503486784401);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.5062762119218);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.5127093291416449);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.5155336245064552);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.5216058595407965);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.5266895911974545);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.5292314570257837);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.5285959905687013);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.5308836698141973);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.5331713490596935);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.5319131254746706);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.5247656148240049);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.5255160880004898);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.5236399050592775);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.5236399050592775);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.5236399050592775);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.5239776179886957);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.5243153309181139);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.5243153309181139);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.5243153309181139);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.5219445852260415);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.5220661623444102);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.5221877394627789);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.5223093165811475);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.5224308936995162);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.5224916810992554);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.5224916810992554);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.5224916810992554);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.5224916810992554);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.5202425129893298);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.5207896079349874);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.5207896079349874);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.5187106471414886);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.5187106471414886);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.5187106471414886);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.5168395824273397);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.5168395824273397);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.5168395824273397);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.5168395824273397);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.5168395824273397);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.5151556241846058);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.5151556241846058);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.5151556241846058);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.5151556241846058);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.5151556241846058);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.5151556241846058);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.5151556241846058);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.5151556241846058);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.5151556241846058);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.5137297990146066);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.5139092735115296);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.5139990107599912);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.5141784852569141);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.51453743425076);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.5147169087476829);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.514896383244606);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.515075857741529);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.515075857741529);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.515075857741529);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.515075857741529);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.5136490354909914);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.5138105625382221);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.5138913260618373);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.514052853109068);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.5142143801562986);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.51453743425076);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.5148604883452214);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.5136651881957144);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.5139559368807297);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.5142466855657448);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.5130836908256841);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.5130836908256841);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.5130836908256841);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.5117753217431157);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.5117753217431157);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.5117753217431157);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.5117753217431157);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.5117753217431157);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.5117753217431157);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.5117753217431157);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.5117164451344);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.5115986919169689);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.5115398153082533);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.510359339303506);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.5103063503556619);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.5102533614078179);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.510200372459974);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.510173877986052);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.5099831174503947);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.5096015971876271);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.5092200769248595);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.5088385566620921);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.5084570363993246);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.5082662758636673);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.5080792556672543);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.5077052160829757);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.5073311764986972);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.5069571369144187);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.5065830973301402);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.5062090577458616);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.5058350181615829);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.5054609793858517);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.5050869389930259);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.5047128986002003);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.5043388582073745);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.5039648178145488);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.5035907774217231);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.5032167370288974);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.5028426966360715);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.5024686562432459);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.5020946158504201);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.5019076021223847);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.5013777126439445);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.500317933687064);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.499788044208624);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.49942771936328456);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.49866467851433066);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.49828315808985374);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.4998092397877616);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.44999999999999996);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.44999999999999996);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.46111111111111114);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.4833333333333333);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.5666666666666667);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.5666666666666667);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.5166666666666666);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.49444444444444446);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.48888888888888893);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.48888888888888893);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.48888888888888893);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.48888888888888893);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.48888888888888893);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.48888888888888893);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.49444444444444446);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.5111111111111111);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.5166666666666666);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.5166666666666666);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.5222222222222221);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.5222222222222221);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.5222222222222221);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.5222222222222221);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.5222222222222221);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.5222222222222221);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.5222222222222221);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.5222222222222221);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.5166666666666666);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.5166666666666666);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.5166666666666666);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.5055555555555555);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.49444444444444446);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.49444444444444446);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.4722222222222222);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.46111111111111114);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.44999999999999996);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.44999999999999996);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.48888888888888893);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.4555555555555556);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.46111111111111114);
-      value[ID::timeMultiply]->setFromNormalized(0.8080001473426819);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::d1FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d2FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d3FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.27521803975105286);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.4760001003742218);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.6160000562667847);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(1);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(1);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(0);
-      value[ID::seed]->setFromInt(4060084);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetSylvia: {
-      value[ID::time0 + 0]->setFromNormalized(0.4305555555555556);
-      value[ID::time0 + 1]->setFromNormalized(0.4722222222222222);
-      value[ID::time0 + 2]->setFromNormalized(0.5055555555555555);
-      value[ID::time0 + 3]->setFromNormalized(0.5388888888888889);
-      value[ID::time0 + 4]->setFromNormalized(0.6333333333333333);
-      value[ID::time0 + 5]->setFromNormalized(0.75);
-      value[ID::time0 + 6]->setFromNormalized(0.0);
-      value[ID::time0 + 7]->setFromNormalized(0.0);
-      value[ID::time0 + 8]->setFromNormalized(0.0);
-      value[ID::time0 + 9]->setFromNormalized(0.0);
-      value[ID::time0 + 10]->setFromNormalized(0.0);
-      value[ID::time0 + 11]->setFromNormalized(0.0);
-      value[ID::time0 + 12]->setFromNormalized(0.4277777777777778);
-      value[ID::time0 + 13]->setFromNormalized(0.4277777777777778);
-      value[ID::time0 + 14]->setFromNormalized(0.4111111111111111);
-      value[ID::time0 + 15]->setFromNormalized(0.3944444444444445);
-      value[ID::time0 + 16]->setFromNormalized(0.37777777777777777);
-      value[ID::time0 + 17]->setFromNormalized(0.37222222222222223);
-      value[ID::time0 + 18]->setFromNormalized(0.3666666666666667);
-      value[ID::time0 + 19]->setFromNormalized(0.36111111111111116);
-      value[ID::time0 + 20]->setFromNormalized(0.35);
-      value[ID::time0 + 21]->setFromNormalized(0.34444444444444444);
-      value[ID::time0 + 22]->setFromNormalized(0.3388888888888889);
-      value[ID::time0 + 23]->setFromNormalized(0.3388888888888889);
-      value[ID::time0 + 24]->setFromNormalized(0.3388888888888889);
-      value[ID::time0 + 25]->setFromNormalized(0.3388888888888889);
-      value[ID::time0 + 26]->setFromNormalized(0.3388888888888889);
-      value[ID::time0 + 27]->setFromNormalized(0.3388888888888889);
-      value[ID::time0 + 28]->setFromNormalized(0.3388888888888889);
-      value[ID::time0 + 29]->setFromNormalized(0.3388888888888889);
-      value[ID::time0 + 30]->setFromNormalized(0.3388888888888889);
-      value[ID::time0 + 31]->setFromNormalized(0.34444444444444444);
-      value[ID::time0 + 32]->setFromNormalized(0.35);
-      value[ID::time0 + 33]->setFromNormalized(0.3583333333333333);
-      value[ID::time0 + 34]->setFromNormalized(0.375);
-      value[ID::time0 + 35]->setFromNormalized(0.3833333333333333);
-      value[ID::time0 + 36]->setFromNormalized(0.3916666666666667);
-      value[ID::time0 + 37]->setFromNormalized(0.4083333333333333);
-      value[ID::time0 + 38]->setFromNormalized(0.41666666666666663);
-      value[ID::time0 + 39]->setFromNormalized(0.4388888888888889);
-      value[ID::time0 + 40]->setFromNormalized(0.46111111111111114);
-      value[ID::time0 + 41]->setFromNormalized(0.48611111111111116);
-      value[ID::time0 + 42]->setFromNormalized(0.5111111111111111);
-      value[ID::time0 + 43]->setFromNormalized(0.5361111111111111);
-      value[ID::time0 + 44]->setFromNormalized(0.5611111111111111);
-      value[ID::time0 + 45]->setFromNormalized(0.6055555555555556);
-      value[ID::time0 + 46]->setFromNormalized(0.6305555555555555);
-      value[ID::time0 + 47]->setFromNormalized(0.7166666666666667);
-      value[ID::time0 + 48]->setFromNormalized(0.5611111111111111);
-      value[ID::time0 + 49]->setFromNormalized(0.5333333333333333);
-      value[ID::time0 + 50]->setFromNormalized(0.5);
-      value[ID::time0 + 51]->setFromNormalized(0.47777777777777775);
-      value[ID::time0 + 52]->setFromNormalized(0.4555555555555556);
-      value[ID::time0 + 53]->setFromNormalized(0.44166666666666665);
-      value[ID::time0 + 54]->setFromNormalized(0.4277777777777778);
-      value[ID::time0 + 55]->setFromNormalized(0.41388888888888886);
-      value[ID::time0 + 56]->setFromNormalized(0.4);
-      value[ID::time0 + 57]->setFromNormalized(0.3930555555555556);
-      value[ID::time0 + 58]->setFromNormalized(0.37916666666666665);
-      value[ID::time0 + 59]->setFromNormalized(0.37222222222222223);
-      value[ID::time0 + 60]->setFromNormalized(0.3666666666666667);
-      value[ID::time0 + 61]->setFromNormalized(0.3555555555555555);
-      value[ID::time0 + 62]->setFromNormalized(0.35);
-      value[ID::time0 + 63]->setFromNormalized(0.34444444444444444);
-      value[ID::time0 + 64]->setFromNormalized(0.3388888888888889);
-      value[ID::time0 + 65]->setFromNormalized(0.3375);
-      value[ID::time0 + 66]->setFromNormalized(0.33472222222222225);
-      value[ID::time0 + 67]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 68]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 69]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 70]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 71]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 72]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 73]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 74]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 75]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 76]->setFromNormalized(0.33611111111111114);
-      value[ID::time0 + 77]->setFromNormalized(0.3416666666666667);
-      value[ID::time0 + 78]->setFromNormalized(0.3472222222222222);
-      value[ID::time0 + 79]->setFromNormalized(0.35);
-      value[ID::time0 + 80]->setFromNormalized(0.3555555555555555);
-      value[ID::time0 + 81]->setFromNormalized(0.37222222222222223);
-      value[ID::time0 + 82]->setFromNormalized(0.3222222222222222);
-      value[ID::time0 + 83]->setFromNormalized(0.30000000000000004);
-      value[ID::time0 + 84]->setFromNormalized(0.2777777777777778);
-      value[ID::time0 + 85]->setFromNormalized(0.24444444444444446);
-      value[ID::time0 + 86]->setFromNormalized(0.21111111111111114);
-      value[ID::time0 + 87]->setFromNormalized(0.18888888888888888);
-      value[ID::time0 + 88]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 89]->setFromNormalized(0.15555555555555556);
-      value[ID::time0 + 90]->setFromNormalized(0.1527777777777778);
-      value[ID::time0 + 91]->setFromNormalized(0.15000000000000002);
-      value[ID::time0 + 92]->setFromNormalized(0.1444444444444445);
-      value[ID::time0 + 93]->setFromNormalized(0.1444444444444445);
-      value[ID::time0 + 94]->setFromNormalized(0.1444444444444445);
-      value[ID::time0 + 95]->setFromNormalized(0.1444444444444445);
-      value[ID::time0 + 96]->setFromNormalized(0.1444444444444445);
-      value[ID::time0 + 97]->setFromNormalized(0.1444444444444445);
-      value[ID::time0 + 98]->setFromNormalized(0.14722222222222225);
-      value[ID::time0 + 99]->setFromNormalized(0.15000000000000002);
-      value[ID::time0 + 100]->setFromNormalized(0.1527777777777778);
-      value[ID::time0 + 101]->setFromNormalized(0.15833333333333333);
-      value[ID::time0 + 102]->setFromNormalized(0.1611111111111111);
-      value[ID::time0 + 103]->setFromNormalized(0.16388888888888886);
-      value[ID::time0 + 104]->setFromNormalized(0.16666666666666663);
-      value[ID::time0 + 105]->setFromNormalized(0.17500000000000004);
-      value[ID::time0 + 106]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 107]->setFromNormalized(0.18888888888888888);
-      value[ID::time0 + 108]->setFromNormalized(0.19444444444444442);
-      value[ID::time0 + 109]->setFromNormalized(0.19444444444444442);
-      value[ID::time0 + 110]->setFromNormalized(0.18888888888888888);
-      value[ID::time0 + 111]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 112]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 113]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 114]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 115]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 116]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 117]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 118]->setFromNormalized(0.18333333333333335);
-      value[ID::time0 + 119]->setFromNormalized(0.0);
-      value[ID::time0 + 120]->setFromNormalized(0.0);
-      value[ID::time0 + 121]->setFromNormalized(0.0);
-      value[ID::time0 + 122]->setFromNormalized(0.0);
-      value[ID::time0 + 123]->setFromNormalized(0.0);
-      value[ID::time0 + 124]->setFromNormalized(0.0);
-      value[ID::time0 + 125]->setFromNormalized(0.0);
-      value[ID::time0 + 126]->setFromNormalized(0.0);
-      value[ID::time0 + 127]->setFromNormalized(0.0);
-      value[ID::time0 + 128]->setFromNormalized(0.0);
-      value[ID::time0 + 129]->setFromNormalized(0.0);
-      value[ID::time0 + 130]->setFromNormalized(0.0);
-      value[ID::time0 + 131]->setFromNormalized(0.0);
-      value[ID::time0 + 132]->setFromNormalized(0.0);
-      value[ID::time0 + 133]->setFromNormalized(0.0);
-      value[ID::time0 + 134]->setFromNormalized(0.0);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.05555555555555558);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.09444444444444444);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.27222222222222225);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.22777777777777775);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.21805555555555556);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.19861111111111107);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.18888888888888888);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.16666666666666663);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.16296293470594614);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.15555555555555556);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.14814817640516498);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.1444444444444445);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.14777781168619797);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.15444446139865453);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.1611111111111111);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.16777776082356766);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.17444441053602433);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.1777777777777778);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.18162392510308156);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.18931621975368929);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.1970085144042969);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.2047008090549045);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.21239310370551212);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.22008539835611984);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.22777769300672746);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.23546998765733507);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.24316228230794268);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.2508545769585504);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.258546871609158);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.2662391662597656);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.27393146091037324);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.2777777777777778);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.28388892279730904);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.29611108567979605);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.30833329094780815);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.32055549621582036);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.33277770148383246);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.3388888888888889);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.34444444444444444);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.3555555555555555);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.3666666666666667);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.37777777777777777);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.38888888888888884);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.3944444444444445);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.40069444444444446);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.4131944444444444);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.4256944444444445);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.43819444444444444);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.4444444444444444);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.4555555555555556);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.47777777777777775);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.48888888888888893);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.4965277777777778);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.5118055555555556);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.5270833333333333);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.5423611111111111);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.55);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.5583333333333333);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.575);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.5916666666666667);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.6);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.6152777777777778);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.6458333333333333);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.6708333333333334);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.6902777777777778);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.7);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.7166666666666667);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.7333333333333334);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.7555555555555555);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.75);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.7277777777777779);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.7);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.6833333333333333);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.65);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.6361111111111111);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.6222222222222222);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.5944444444444444);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.5805555555555555);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.5666666666666667);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.5555555555555556);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.5444444444444445);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.5388888888888889);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.5333333333333333);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.5333333333333333);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.5333333333333333);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.5333333333333333);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.5333333333333333);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.5333333333333333);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.5416666666666667);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.55);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.5666666666666667);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.575);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.5833333333333333);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.5944444444444444);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.6166666666666667);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.6111111111111112);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.5888888888888889);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.5666666666666667);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.5277777777777778);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.4916666666666667);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.4833333333333333);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.4555555555555556);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.44999999999999996);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.4444444444444444);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.4388888888888889);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.4277777777777778);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.4222222222222223);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.4194444444444444);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.41666666666666663);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.4125);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.4041666666666667);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.4);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.4);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.4);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.4);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.39722222222222225);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.3944444444444445);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.3916666666666667);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.38888888888888884);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.27222222222222225);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.30000000000000004);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.5611111111111111);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.5888888888888889);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.6111111111111112);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.6611111111111111);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.75);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.8027777777777778);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.48888888888888893);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.4666666666666667);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.4388888888888889);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.4277777777777778);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.4277777777777778);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.4277777777777778);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.44166666666666665);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.4111111111111111);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.3388888888888889);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.4666666666666667);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.4111111111111111);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.21944444444444444);
-      value[ID::timeMultiply]->setFromNormalized(0.48600006103515625);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::d1FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d2FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d3FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.27521803975105286);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.1080000102519989);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.8020000457763672);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(1);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(1);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.7799996733665466);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetThisbe: {
-      value[ID::time0 + 0]->setFromNormalized(0.1333333333333333);
-      value[ID::time0 + 1]->setFromNormalized(0.12777777777777777);
-      value[ID::time0 + 2]->setFromNormalized(0.125);
-      value[ID::time0 + 3]->setFromNormalized(0.09485976577096396);
-      value[ID::time0 + 4]->setFromNormalized(0.1071423285940459);
-      value[ID::time0 + 5]->setFromNormalized(0.5779420405254152);
-      value[ID::time0 + 6]->setFromNormalized(0.10761888000920027);
-      value[ID::time0 + 7]->setFromNormalized(0.10471803397575748);
-      value[ID::time0 + 8]->setFromNormalized(0.11530902795055971);
-      value[ID::time0 + 9]->setFromNormalized(0.12303259604191989);
-      value[ID::time0 + 10]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 11]->setFromNormalized(0.11013945219407442);
-      value[ID::time0 + 12]->setFromNormalized(0.11601547102986845);
-      value[ID::time0 + 13]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 14]->setFromNormalized(0.08946370273038745);
-      value[ID::time0 + 15]->setFromNormalized(0.006502466110839003);
-      value[ID::time0 + 16]->setFromNormalized(0.10343548330944143);
-      value[ID::time0 + 17]->setFromNormalized(0.09047138913581214);
-      value[ID::time0 + 18]->setFromNormalized(0.7394630670737894);
-      value[ID::time0 + 19]->setFromNormalized(0.10673823908287662);
-      value[ID::time0 + 20]->setFromNormalized(0.11185867092365102);
-      value[ID::time0 + 21]->setFromNormalized(0.10055697028105509);
-      value[ID::time0 + 22]->setFromNormalized(0.104392308636443);
-      value[ID::time0 + 23]->setFromNormalized(0.09599208966476316);
-      value[ID::time0 + 24]->setFromNormalized(0.12311147434481176);
-      value[ID::time0 + 25]->setFromNormalized(0.10587323609331596);
-      value[ID::time0 + 26]->setFromNormalized(0.11340104329086116);
-      value[ID::time0 + 27]->setFromNormalized(0.11898373778806817);
-      value[ID::time0 + 28]->setFromNormalized(0.31103390998729885);
-      value[ID::time0 + 29]->setFromNormalized(0.1043459235983881);
-      value[ID::time0 + 30]->setFromNormalized(0.10910046781537762);
-      value[ID::time0 + 31]->setFromNormalized(0.09642338807926062);
-      value[ID::time0 + 32]->setFromNormalized(0.10752350895135106);
-      value[ID::time0 + 33]->setFromNormalized(0.0937239054762708);
-      value[ID::time0 + 34]->setFromNormalized(0.11786332802202407);
-      value[ID::time0 + 35]->setFromNormalized(0.686778571185835);
-      value[ID::time0 + 36]->setFromNormalized(0.10858002316338924);
-      value[ID::time0 + 37]->setFromNormalized(0.9333333333333333);
-      value[ID::time0 + 38]->setFromNormalized(0.10913703227684869);
-      value[ID::time0 + 39]->setFromNormalized(0.810266116482228);
-      value[ID::time0 + 40]->setFromNormalized(0.12365616275774967);
-      value[ID::time0 + 41]->setFromNormalized(0.7682463864005685);
-      value[ID::time0 + 42]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 43]->setFromNormalized(0.3128720679885984);
-      value[ID::time0 + 44]->setFromNormalized(0.09605070255584415);
-      value[ID::time0 + 45]->setFromNormalized(0.12308292621195327);
-      value[ID::time0 + 46]->setFromNormalized(0.11261897546788403);
-      value[ID::time0 + 47]->setFromNormalized(0.11257041922647812);
-      value[ID::time0 + 48]->setFromNormalized(0.1014300904596885);
-      value[ID::time0 + 49]->setFromNormalized(0.11944444444444446);
-      value[ID::time0 + 50]->setFromNormalized(0.10702712447897934);
-      value[ID::time0 + 51]->setFromNormalized(0.11199779667162175);
-      value[ID::time0 + 52]->setFromNormalized(0.1043661936368432);
-      value[ID::time0 + 53]->setFromNormalized(0.11473283970195934);
-      value[ID::time0 + 54]->setFromNormalized(0.2166439035847784);
-      value[ID::time0 + 55]->setFromNormalized(0.08489457242086504);
-      value[ID::time0 + 56]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 57]->setFromNormalized(0.10260812049104509);
-      value[ID::time0 + 58]->setFromNormalized(0.09441900501011535);
-      value[ID::time0 + 59]->setFromNormalized(0.11311250254394142);
-      value[ID::time0 + 60]->setFromNormalized(0.09756012093112472);
-      value[ID::time0 + 61]->setFromNormalized(0.07824070670031731);
-      value[ID::time0 + 62]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 63]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 64]->setFromNormalized(0.10180958200843257);
-      value[ID::time0 + 65]->setFromNormalized(0.092668159021703);
-      value[ID::time0 + 66]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 67]->setFromNormalized(0.0999600117600196);
-      value[ID::time0 + 68]->setFromNormalized(0.12268636011393685);
-      value[ID::time0 + 69]->setFromNormalized(0.10630381976615692);
-      value[ID::time0 + 70]->setFromNormalized(0.09464422911604202);
-      value[ID::time0 + 71]->setFromNormalized(0.09938514982817548);
-      value[ID::time0 + 72]->setFromNormalized(0.12119724891752506);
-      value[ID::time0 + 73]->setFromNormalized(0.1232071279995874);
-      value[ID::time0 + 74]->setFromNormalized(0.1134590135091784);
-      value[ID::time0 + 75]->setFromNormalized(0.6595716143338415);
-      value[ID::time0 + 76]->setFromNormalized(0.09304952654741108);
-      value[ID::time0 + 77]->setFromNormalized(0.12021002387844008);
-      value[ID::time0 + 78]->setFromNormalized(0.11656916309646238);
-      value[ID::time0 + 79]->setFromNormalized(0.11535772722957455);
-      value[ID::time0 + 80]->setFromNormalized(0.1051790687682627);
-      value[ID::time0 + 81]->setFromNormalized(0.11650493010904828);
-      value[ID::time0 + 82]->setFromNormalized(0.12918920606767634);
-      value[ID::time0 + 83]->setFromNormalized(0.08022613357901767);
-      value[ID::time0 + 84]->setFromNormalized(0.09093288428870262);
-      value[ID::time0 + 85]->setFromNormalized(0.09767442309062987);
-      value[ID::time0 + 86]->setFromNormalized(0.10696641153474726);
-      value[ID::time0 + 87]->setFromNormalized(0.10637545606116205);
-      value[ID::time0 + 88]->setFromNormalized(0.09039175979270662);
-      value[ID::time0 + 89]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 90]->setFromNormalized(0.4328822000445868);
-      value[ID::time0 + 91]->setFromNormalized(0.11111739321264708);
-      value[ID::time0 + 92]->setFromNormalized(0.10606523645744978);
-      value[ID::time0 + 93]->setFromNormalized(0.11663614189679578);
-      value[ID::time0 + 94]->setFromNormalized(0.1108912707584239);
-      value[ID::time0 + 95]->setFromNormalized(0.10661226940718461);
-      value[ID::time0 + 96]->setFromNormalized(0.08923710068491184);
-      value[ID::time0 + 97]->setFromNormalized(0.1062211150085473);
-      value[ID::time0 + 98]->setFromNormalized(0.10416595327991096);
-      value[ID::time0 + 99]->setFromNormalized(0.09371729652376079);
-      value[ID::time0 + 100]->setFromNormalized(0.09234949958311077);
-      value[ID::time0 + 101]->setFromNormalized(0.0962684769652775);
-      value[ID::time0 + 102]->setFromNormalized(0.107465312122227);
-      value[ID::time0 + 103]->setFromNormalized(0.2283821485556727);
-      value[ID::time0 + 104]->setFromNormalized(0.1728524793434332);
-      value[ID::time0 + 105]->setFromNormalized(0.11451131948488219);
-      value[ID::time0 + 106]->setFromNormalized(0.3332839650039272);
-      value[ID::time0 + 107]->setFromNormalized(0.04388136217932676);
-      value[ID::time0 + 108]->setFromNormalized(0.7286519274169357);
-      value[ID::time0 + 109]->setFromNormalized(0.08975875607837347);
-      value[ID::time0 + 110]->setFromNormalized(0.9534297316245874);
-      value[ID::time0 + 111]->setFromNormalized(0.11523195246847752);
-      value[ID::time0 + 112]->setFromNormalized(0.11083847148679979);
-      value[ID::time0 + 113]->setFromNormalized(0.12352544151609376);
-      value[ID::time0 + 114]->setFromNormalized(0.10705504015498174);
-      value[ID::time0 + 115]->setFromNormalized(0.34178843102211937);
-      value[ID::time0 + 116]->setFromNormalized(0.09836756056107536);
-      value[ID::time0 + 117]->setFromNormalized(0.5366822783186104);
-      value[ID::time0 + 118]->setFromNormalized(0.21101939855243257);
-      value[ID::time0 + 119]->setFromNormalized(0.09678064033123743);
-      value[ID::time0 + 120]->setFromNormalized(0.09252590976985971);
-      value[ID::time0 + 121]->setFromNormalized(0.10749936101821617);
-      value[ID::time0 + 122]->setFromNormalized(0.3975718301670605);
-      value[ID::time0 + 123]->setFromNormalized(0.919363002563956);
-      value[ID::time0 + 124]->setFromNormalized(0.10054354146699113);
-      value[ID::time0 + 125]->setFromNormalized(0.1212957200340581);
-      value[ID::time0 + 126]->setFromNormalized(0.16098883925857588);
-      value[ID::time0 + 127]->setFromNormalized(0.1762188367292422);
-      value[ID::time0 + 128]->setFromNormalized(0.2004479447835887);
-      value[ID::time0 + 129]->setFromNormalized(0.1174002616563588);
-      value[ID::time0 + 130]->setFromNormalized(0.10243338237881994);
-      value[ID::time0 + 131]->setFromNormalized(0.09356222769121206);
-      value[ID::time0 + 132]->setFromNormalized(0.25010350077991006);
-      value[ID::time0 + 133]->setFromNormalized(0.12043562955744716);
-      value[ID::time0 + 134]->setFromNormalized(0.12198455500640308);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.7);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.7027777777777777);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.7055555555555555);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.7055555555555555);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.7111111111111111);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.7166666666666667);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.7277777777777779);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.7333333333333334);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.7333333333333334);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.7333333333333334);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.7444444444444445);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.7472222222222222);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.75);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.7555555555555555);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.7666666666666666);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.7694444444444444);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.7722222222222223);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.7777777777777778);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.7722222222222223);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.7666666666666666);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.7666666666666666);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.7666666666666666);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.7666666666666666);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.7666666666666666);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.7652777777777777);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.7625);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.7611111111111111);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.760185178120931);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.7583333333333333);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.7564814885457357);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.7555555555555555);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.7527777777777778);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.7472222222222222);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.7444444444444445);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.7435185114542644);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.7416666666666667);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.739814821879069);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.7388888888888889);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.7388888888888889);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.7388888888888889);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.7388888888888889);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.7375);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.7347222222222223);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.7333333333333334);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.7314814885457357);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.7277777777777779);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.7240740670098198);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.7208333333333333);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.7180555555555556);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.7166666666666667);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.7166666666666667);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.7166666666666667);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.7166666666666667);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.7166666666666667);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.7166666666666667);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.7166666666666667);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.7166666666666667);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.7166666666666667);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.05555555555555558);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.05555555555555558);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.02777777777777779);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.02777777777777779);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.033333333333333326);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.033333333333333326);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.0444444444444444);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.0444444444444444);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.05555555555555558);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.061111111111111116);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.061111111111111116);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.061111111111111116);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.061111111111111116);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.061111111111111116);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.061111111111111116);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.06388888888888888);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.06944444444444442);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.07222222222222219);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.07777777777777772);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.09999999999999998);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.10138888888888886);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.10416666666666663);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.10555555555555551);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.10555555555555551);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.10555555555555551);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.11111111111111116);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.10555555555555551);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.09999999999999998);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.09999999999999998);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.09999999999999998);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.08333333333333337);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.08333333333333337);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.07777777777777772);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.07777777777777772);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.07222222222222219);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.07222222222222219);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.06666666666666665);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.061111111111111116);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.05555555555555558);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.0444444444444444);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.0444444444444444);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.0444444444444444);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.0444444444444444);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.061111111111111116);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.061111111111111116);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.061111111111111116);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.061111111111111116);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.061111111111111116);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.061111111111111116);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.06666666666666665);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.07222222222222219);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.07777777777777772);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.08333333333333337);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.08333333333333337);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.08333333333333337);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.08333333333333337);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.08333333333333337);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.07222222222222219);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.07222222222222219);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.07222222222222219);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.07222222222222219);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.06666666666666665);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.06666666666666665);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.06666666666666665);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.05555555555555558);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.05555555555555558);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.0444444444444444);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.0444444444444444);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.0444444444444444);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.04166666666666663);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.07222222222222219);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.0888888888888889);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.12777777777777777);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.15000000000000002);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.15000000000000002);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.15000000000000002);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.15000000000000002);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.1444444444444445);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.09166666666666667);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.06944444444444442);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.05833333333333335);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.0888888888888889);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::d1FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d2FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d3FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.27521803975105286);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(1.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::timeModulation]->setFromInt(0);
-      value[ID::innerFeedModulation]->setFromInt(0);
-      value[ID::d1FeedModulation]->setFromInt(1);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(0);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetUrsula: {
-      value[ID::time0 + 0]->setFromNormalized(0.9675972284378292);
-      value[ID::time0 + 1]->setFromNormalized(0.9737619507325039);
-      value[ID::time0 + 2]->setFromNormalized(0.9349569920686089);
-      value[ID::time0 + 3]->setFromNormalized(0.9730052043199166);
-      value[ID::time0 + 4]->setFromNormalized(1.0);
-      value[ID::time0 + 5]->setFromNormalized(0.9323904470984209);
-      value[ID::time0 + 6]->setFromNormalized(0.9778472367932993);
-      value[ID::time0 + 7]->setFromNormalized(0.9790282556717604);
-      value[ID::time0 + 8]->setFromNormalized(0.904778464023805);
-      value[ID::time0 + 9]->setFromNormalized(0.9966720000828131);
-      value[ID::time0 + 10]->setFromNormalized(0.9673208840852622);
-      value[ID::time0 + 11]->setFromNormalized(0.8564100539639783);
-      value[ID::time0 + 12]->setFromNormalized(0.7517710236865999);
-      value[ID::time0 + 13]->setFromNormalized(0.9422148870229836);
-      value[ID::time0 + 14]->setFromNormalized(0.9151592738410491);
-      value[ID::time0 + 15]->setFromNormalized(0.8312379848456991);
-      value[ID::time0 + 16]->setFromNormalized(0.800187936569973);
-      value[ID::time0 + 17]->setFromNormalized(0.9940051132429029);
-      value[ID::time0 + 18]->setFromNormalized(0.8255780037005193);
-      value[ID::time0 + 19]->setFromNormalized(0.9849778728482328);
-      value[ID::time0 + 20]->setFromNormalized(0.7855634114349351);
-      value[ID::time0 + 21]->setFromNormalized(0.8775931747240622);
-      value[ID::time0 + 22]->setFromNormalized(0.9083450096709597);
-      value[ID::time0 + 23]->setFromNormalized(0.7316344413924691);
-      value[ID::time0 + 24]->setFromNormalized(0.728498260806082);
-      value[ID::time0 + 25]->setFromNormalized(0.8038798471742429);
-      value[ID::time0 + 26]->setFromNormalized(0.964215644310434);
-      value[ID::time0 + 27]->setFromNormalized(0.8393987573924704);
-      value[ID::time0 + 28]->setFromNormalized(0.9507141239377584);
-      value[ID::time0 + 29]->setFromNormalized(0.7388321351037022);
-      value[ID::time0 + 30]->setFromNormalized(0.6764226059183654);
-      value[ID::time0 + 31]->setFromNormalized(0.746497681579247);
-      value[ID::time0 + 32]->setFromNormalized(0.8014120265499501);
-      value[ID::time0 + 33]->setFromNormalized(0.7618080235277201);
-      value[ID::time0 + 34]->setFromNormalized(0.8300710385176563);
-      value[ID::time0 + 35]->setFromNormalized(0.7132731370889166);
-      value[ID::time0 + 36]->setFromNormalized(0.7693728510088432);
-      value[ID::time0 + 37]->setFromNormalized(0.9016568167205542);
-      value[ID::time0 + 38]->setFromNormalized(0.7225087169929348);
-      value[ID::time0 + 39]->setFromNormalized(0.7273739180959387);
-      value[ID::time0 + 40]->setFromNormalized(0.8432329133573286);
-      value[ID::time0 + 41]->setFromNormalized(0.7016171061478023);
-      value[ID::time0 + 42]->setFromNormalized(0.7116136222099926);
-      value[ID::time0 + 43]->setFromNormalized(0.653635672964742);
-      value[ID::time0 + 44]->setFromNormalized(0.6737994303960867);
-      value[ID::time0 + 45]->setFromNormalized(0.9163541906166244);
-      value[ID::time0 + 46]->setFromNormalized(0.7051815159875386);
-      value[ID::time0 + 47]->setFromNormalized(0.7301987753761955);
-      value[ID::time0 + 48]->setFromNormalized(0.6274615317856739);
-      value[ID::time0 + 49]->setFromNormalized(0.5917210723042514);
-      value[ID::time0 + 50]->setFromNormalized(0.7628386305510996);
-      value[ID::time0 + 51]->setFromNormalized(0.6640273044295018);
-      value[ID::time0 + 52]->setFromNormalized(0.7637386792621768);
-      value[ID::time0 + 53]->setFromNormalized(0.6459204888146061);
-      value[ID::time0 + 54]->setFromNormalized(0.6895021564251409);
-      value[ID::time0 + 55]->setFromNormalized(0.5327213898905763);
-      value[ID::time0 + 56]->setFromNormalized(0.470487711780308);
-      value[ID::time0 + 57]->setFromNormalized(0.7127034174465842);
-      value[ID::time0 + 58]->setFromNormalized(0.7107196143866273);
-      value[ID::time0 + 59]->setFromNormalized(0.5961463153235861);
-      value[ID::time0 + 60]->setFromNormalized(0.5202969902649486);
-      value[ID::time0 + 61]->setFromNormalized(0.6148917037995355);
-      value[ID::time0 + 62]->setFromNormalized(0.558924447085691);
-      value[ID::time0 + 63]->setFromNormalized(0.49880394337842626);
-      value[ID::time0 + 64]->setFromNormalized(0.6614907629171531);
-      value[ID::time0 + 65]->setFromNormalized(0.4789987871441561);
-      value[ID::time0 + 66]->setFromNormalized(0.6612917085138651);
-      value[ID::time0 + 67]->setFromNormalized(0.5330668645567422);
-      value[ID::time0 + 68]->setFromNormalized(0.5357869007183452);
-      value[ID::time0 + 69]->setFromNormalized(0.4169329625465612);
-      value[ID::time0 + 70]->setFromNormalized(0.3448345538577391);
-      value[ID::time0 + 71]->setFromNormalized(0.5921857483527146);
-      value[ID::time0 + 72]->setFromNormalized(0.38917274088217885);
-      value[ID::time0 + 73]->setFromNormalized(0.5527098333379146);
-      value[ID::time0 + 74]->setFromNormalized(0.4855884614461328);
-      value[ID::time0 + 75]->setFromNormalized(0.39075250781129006);
-      value[ID::time0 + 76]->setFromNormalized(0.42859092441485336);
-      value[ID::time0 + 77]->setFromNormalized(0.44588918827844554);
-      value[ID::time0 + 78]->setFromNormalized(0.4838245831449003);
-      value[ID::time0 + 79]->setFromNormalized(0.36480415293643115);
-      value[ID::time0 + 80]->setFromNormalized(0.29326864451441764);
-      value[ID::time0 + 81]->setFromNormalized(0.5559995977936854);
-      value[ID::time0 + 82]->setFromNormalized(0.32768038294211793);
-      value[ID::time0 + 83]->setFromNormalized(0.36235891066315773);
-      value[ID::time0 + 84]->setFromNormalized(0.2741467905329669);
-      value[ID::time0 + 85]->setFromNormalized(0.4275027979642087);
-      value[ID::time0 + 86]->setFromNormalized(0.366126148920221);
-      value[ID::time0 + 87]->setFromNormalized(0.4258392095505637);
-      value[ID::time0 + 88]->setFromNormalized(0.36930488982779164);
-      value[ID::time0 + 89]->setFromNormalized(0.2870588447434984);
-      value[ID::time0 + 90]->setFromNormalized(0.44345703033422706);
-      value[ID::time0 + 91]->setFromNormalized(0.23196508216789988);
-      value[ID::time0 + 92]->setFromNormalized(0.1443377555428387);
-      value[ID::time0 + 93]->setFromNormalized(0.20759838776081715);
-      value[ID::time0 + 94]->setFromNormalized(0.16243937029166772);
-      value[ID::time0 + 95]->setFromNormalized(0.33906971237395417);
-      value[ID::time0 + 96]->setFromNormalized(0.2527200596256337);
-      value[ID::time0 + 97]->setFromNormalized(0.1652097274720785);
-      value[ID::time0 + 98]->setFromNormalized(0.34135998633591247);
-      value[ID::time0 + 99]->setFromNormalized(0.3137352284105213);
-      value[ID::time0 + 100]->setFromNormalized(0.3298332701963019);
-      value[ID::time0 + 101]->setFromNormalized(0.10218302820446308);
-      value[ID::time0 + 102]->setFromNormalized(0.1890516669590048);
-      value[ID::time0 + 103]->setFromNormalized(0.14979878367568794);
-      value[ID::time0 + 104]->setFromNormalized(0.15731362711526697);
-      value[ID::time0 + 105]->setFromNormalized(0.2502882294531503);
-      value[ID::time0 + 106]->setFromNormalized(0.24962447525036272);
-      value[ID::time0 + 107]->setFromNormalized(0.1333333333333333);
-      value[ID::time0 + 108]->setFromNormalized(0.10555555555555551);
-      value[ID::time0 + 109]->setFromNormalized(0.07777777777777772);
-      value[ID::time0 + 110]->setFromNormalized(0.05555555555555558);
-      value[ID::time0 + 111]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 112]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 113]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 114]->setFromNormalized(0.03888888888888886);
-      value[ID::time0 + 115]->setFromNormalized(0.0444444444444444);
-      value[ID::time0 + 116]->setFromNormalized(0.050000000000000044);
-      value[ID::time0 + 117]->setFromNormalized(0.06666666666666665);
-      value[ID::time0 + 118]->setFromNormalized(0.07222222222222219);
-      value[ID::time0 + 119]->setFromNormalized(0.0888888888888889);
-      value[ID::time0 + 120]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 121]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 122]->setFromNormalized(0.1333333333333333);
-      value[ID::time0 + 123]->setFromNormalized(0.1333333333333333);
-      value[ID::time0 + 124]->setFromNormalized(0.12222222222222223);
-      value[ID::time0 + 125]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 126]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 127]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 128]->setFromNormalized(0.1166666666666667);
-      value[ID::time0 + 129]->setFromNormalized(0.11111111111111116);
-      value[ID::time0 + 130]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 131]->setFromNormalized(0.0888888888888889);
-      value[ID::time0 + 132]->setFromNormalized(0.08333333333333337);
-      value[ID::time0 + 133]->setFromNormalized(0.06666666666666665);
-      value[ID::time0 + 134]->setFromNormalized(0.06666666666666665);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.07420059904732157);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.03299101820504674);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.2176337043758365);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.19859002504742312);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.04510965631518543);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.14567361660438138);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.1590495756478777);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.08352345518960874);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.21508176094570164);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.29727079702982734);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.3718916645929716);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.28318275532821446);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.34208213690346434);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.28599234531296014);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.09444444444444444);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.09444444444444444);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.09444444444444444);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.09444444444444444);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.09444444444444444);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.10555555555555551);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.1166666666666667);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.1694444444444444);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.18888888888888888);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.2777777777777778);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.33333333333333337);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.38888888888888884);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.5222222222222221);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.7222222222222222);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.8);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.8222222222222222);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.8333333333333334);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.8333333333333334);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.8333333333333334);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.8277777777777777);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.8222222222222222);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.8);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.7888888888888889);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.7722222222222223);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.7555555555555555);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.7388888888888889);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.7277777777777779);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.7194444444444444);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.7);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.6888888888888889);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.6805555555555556);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.6722222222222223);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.6611111111111111);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.65);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.6472222222222221);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.6416666666666666);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.6361111111111111);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.6305555555555555);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.6277777777777778);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.6277777777777778);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.6277777777777778);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.6277777777777778);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.6277777777777778);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.6277777777777778);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.6277777777777778);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.6277777777777778);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.6277777777777778);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.6444444444444444);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.6722222222222223);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.7);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.75);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.8444444444444444);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.9444444444444444);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.9444444444444444);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.8944444444444445);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.8333333333333334);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.7555555555555555);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.7277777777777779);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.7);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.6444444444444444);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.5888888888888889);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.5527777777777778);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.5166666666666666);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.48611111111111116);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.4555555555555556);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.4111111111111111);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.37777777777777777);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.36944444444444446);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.36111111111111116);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.33333333333333337);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.3222222222222222);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.3111111111111111);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.3055555555555556);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.3027777777777778);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.30092591179741757);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.3027777777777778);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.30462964375813806);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.3055555555555556);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.3074074215359158);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.3111111111111111);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.3148148006863064);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.31666666666666665);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.32499999999999996);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.3416666666666667);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.35);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.3509259117974175);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.35277777777777775);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.354629643758138);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.3555555555555555);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.35648146735297304);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.3583333333333333);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.3601851993136935);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.36111111111111116);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.36111111111111116);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.36111111111111116);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.36111111111111116);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.36111111111111116);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.36111111111111116);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.36111111111111116);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.3597222222222223);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.3569444444444444);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.3555555555555555);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.3277777777777777);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.3138888888888889);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.30628456339601706);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.0);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.05555555555555558);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.05555555555555558);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.05555555555555558);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.05833333333333335);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.06388888888888888);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.06944444444444442);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.07222222222222219);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.07361111111111107);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.07638888888888884);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.07777777777777772);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.07777777777777772);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.07777777777777772);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.07777777777777772);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.07777777777777772);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.0783950805664062);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.07962968614366317);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.08086429172092013);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.0820988972981771);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.08333350287543406);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.08456810845269103);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.08580271402994788);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.08703731960720484);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.08827192518446181);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.0888888888888889);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.08981484307183163);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.09166666666666667);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.09351849026150172);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.09444444444444444);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.05555555555555558);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.05555555555555558);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.050000000000000044);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.0444444444444444);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.04166666666666663);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.022222222222222254);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.05555555555555558);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.05555555555555558);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.05555555555555558);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.02777777777777779);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.033333333333333326);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.0444444444444444);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.03888888888888886);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.061111111111111116);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.07777777777777772);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.09999999999999998);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.12777777777777777);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.1333333333333333);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.1333333333333333);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.1333333333333333);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.1333333333333333);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.1333333333333333);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.13888888888888884);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.14166666666666672);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.1444444444444445);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.1444444444444445);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.1444444444444445);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.1611111111111111);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.1611111111111111);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.1611111111111111);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.15555555555555556);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.14166666666666672);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.01666666666666672);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.02777777777777779);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.07777777777777772);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.09999999999999998);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.09999999999999998);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.09999999999999998);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.09999999999999998);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.11111111111111116);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.11111111111111116);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.050000000000000044);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.09444444444444444);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.1333333333333333);
-      value[ID::timeMultiply]->setFromNormalized(0.02199983969330788);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::d1FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d2FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d3FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.6440005898475647);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(1.0);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(1.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(1.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(1.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(1.0);
-      value[ID::timeModulation]->setFromInt(1);
-      value[ID::innerFeedModulation]->setFromInt(1);
-      value[ID::d1FeedModulation]->setFromInt(1);
-      value[ID::d2FeedModulation]->setFromInt(1);
-      value[ID::d3FeedModulation]->setFromInt(1);
-      value[ID::d4FeedModulation]->setFromInt(1);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.04000014066696167);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetVesta: {
-      value[ID::time0 + 0]->setFromNormalized(0.6305555555555555);
-      value[ID::time0 + 1]->setFromNormalized(0.6);
-      value[ID::time0 + 2]->setFromNormalized(0.5833333333333333);
-      value[ID::time0 + 3]->setFromNormalized(0.55);
-      value[ID::time0 + 4]->setFromNormalized(0.5111111111111111);
-      value[ID::time0 + 5]->setFromNormalized(0.4722222222222222);
-      value[ID::time0 + 6]->setFromNormalized(0.4555555555555556);
-      value[ID::time0 + 7]->setFromNormalized(0.4388888888888889);
-      value[ID::time0 + 8]->setFromNormalized(0.40555555555555556);
-      value[ID::time0 + 9]->setFromNormalized(0.37777777777777777);
-      value[ID::time0 + 10]->setFromNormalized(0.36111111111111116);
-      value[ID::time0 + 11]->setFromNormalized(0.3555555555555555);
-      value[ID::time0 + 12]->setFromNormalized(0.3416666666666667);
-      value[ID::time0 + 13]->setFromNormalized(0.3277777777777777);
-      value[ID::time0 + 14]->setFromNormalized(0.3138888888888889);
-      value[ID::time0 + 15]->setFromNormalized(0.30000000000000004);
-      value[ID::time0 + 16]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 17]->setFromNormalized(0.2777777777777778);
-      value[ID::time0 + 18]->setFromNormalized(0.2694444444444445);
-      value[ID::time0 + 19]->setFromNormalized(0.26111111111111107);
-      value[ID::time0 + 20]->setFromNormalized(0.25);
-      value[ID::time0 + 21]->setFromNormalized(0.25);
-      value[ID::time0 + 22]->setFromNormalized(0.25555555555555554);
-      value[ID::time0 + 23]->setFromNormalized(0.2944444444444444);
-      value[ID::time0 + 24]->setFromNormalized(0.3055555555555556);
-      value[ID::time0 + 25]->setFromNormalized(0.3222222222222222);
-      value[ID::time0 + 26]->setFromNormalized(0.23333333333333328);
-      value[ID::time0 + 27]->setFromNormalized(0.22777777777777775);
-      value[ID::time0 + 28]->setFromNormalized(0.23888888888888893);
-      value[ID::time0 + 29]->setFromNormalized(0.25555555555555554);
-      value[ID::time0 + 30]->setFromNormalized(0.27222222222222225);
-      value[ID::time0 + 31]->setFromNormalized(0.2972222222222223);
-      value[ID::time0 + 32]->setFromNormalized(0.3222222222222222);
-      value[ID::time0 + 33]->setFromNormalized(0.3416666666666667);
-      value[ID::time0 + 34]->setFromNormalized(0.36111111111111116);
-      value[ID::time0 + 35]->setFromNormalized(0.37777777777777777);
-      value[ID::time0 + 36]->setFromNormalized(0.4111111111111111);
-      value[ID::time0 + 37]->setFromNormalized(0.4277777777777778);
-      value[ID::time0 + 38]->setFromNormalized(0.45833333333333337);
-      value[ID::time0 + 39]->setFromNormalized(0.48888888888888893);
-      value[ID::time0 + 40]->setFromNormalized(0.5277777777777778);
-      value[ID::time0 + 41]->setFromNormalized(0.5611111111111111);
-      value[ID::time0 + 42]->setFromNormalized(0.5944444444444444);
-      value[ID::time0 + 43]->setFromNormalized(0.6333333333333333);
-      value[ID::time0 + 44]->setFromNormalized(0.6666666666666667);
-      value[ID::time0 + 45]->setFromNormalized(0.675);
-      value[ID::time0 + 46]->setFromNormalized(0.6888888888888889);
-      value[ID::time0 + 47]->setFromNormalized(0.65);
-      value[ID::time0 + 48]->setFromNormalized(0.6277777777777778);
-      value[ID::time0 + 49]->setFromNormalized(0.6027777777777779);
-      value[ID::time0 + 50]->setFromNormalized(0.5777777777777777);
-      value[ID::time0 + 51]->setFromNormalized(0.5611111111111111);
-      value[ID::time0 + 52]->setFromNormalized(0.5277777777777778);
-      value[ID::time0 + 53]->setFromNormalized(0.5138888888888888);
-      value[ID::time0 + 54]->setFromNormalized(0.5);
-      value[ID::time0 + 55]->setFromNormalized(0.49444444444444446);
-      value[ID::time0 + 56]->setFromNormalized(0.48888888888888893);
-      value[ID::time0 + 57]->setFromNormalized(0.47777777777777775);
-      value[ID::time0 + 58]->setFromNormalized(0.475);
-      value[ID::time0 + 59]->setFromNormalized(0.4722222222222222);
-      value[ID::time0 + 60]->setFromNormalized(0.4722222222222222);
-      value[ID::time0 + 61]->setFromNormalized(0.4722222222222222);
-      value[ID::time0 + 62]->setFromNormalized(0.4722222222222222);
-      value[ID::time0 + 63]->setFromNormalized(0.4722222222222222);
-      value[ID::time0 + 64]->setFromNormalized(0.4666666666666667);
-      value[ID::time0 + 65]->setFromNormalized(0.46111111111111114);
-      value[ID::time0 + 66]->setFromNormalized(0.46111111111111114);
-      value[ID::time0 + 67]->setFromNormalized(0.46111111111111114);
-      value[ID::time0 + 68]->setFromNormalized(0.46111111111111114);
-      value[ID::time0 + 69]->setFromNormalized(0.46111111111111114);
-      value[ID::time0 + 70]->setFromNormalized(0.46111111111111114);
-      value[ID::time0 + 71]->setFromNormalized(0.46111111111111114);
-      value[ID::time0 + 72]->setFromNormalized(0.46111111111111114);
-      value[ID::time0 + 73]->setFromNormalized(0.4388888888888889);
-      value[ID::time0 + 74]->setFromNormalized(0.4277777777777778);
-      value[ID::time0 + 75]->setFromNormalized(0.4111111111111111);
-      value[ID::time0 + 76]->setFromNormalized(0.3944444444444445);
-      value[ID::time0 + 77]->setFromNormalized(0.38611111111111107);
-      value[ID::time0 + 78]->setFromNormalized(0.37777777777777777);
-      value[ID::time0 + 79]->setFromNormalized(0.375);
-      value[ID::time0 + 80]->setFromNormalized(0.37222222222222223);
-      value[ID::time0 + 81]->setFromNormalized(0.3666666666666667);
-      value[ID::time0 + 82]->setFromNormalized(0.36111111111111116);
-      value[ID::time0 + 83]->setFromNormalized(0.3583333333333333);
-      value[ID::time0 + 84]->setFromNormalized(0.3555555555555555);
-      value[ID::time0 + 85]->setFromNormalized(0.3555555555555555);
-      value[ID::time0 + 86]->setFromNormalized(0.3555555555555555);
-      value[ID::time0 + 87]->setFromNormalized(0.3555555555555555);
-      value[ID::time0 + 88]->setFromNormalized(0.3555555555555555);
-      value[ID::time0 + 89]->setFromNormalized(0.3555555555555555);
-      value[ID::time0 + 90]->setFromNormalized(0.3833333333333333);
-      value[ID::time0 + 91]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 92]->setFromNormalized(0.3055555555555556);
-      value[ID::time0 + 93]->setFromNormalized(0.28888888888888886);
-      value[ID::time0 + 94]->setFromNormalized(0.2833333333333333);
-      value[ID::time0 + 95]->setFromNormalized(0.27222222222222225);
-      value[ID::time0 + 96]->setFromNormalized(0.27083333333333337);
-      value[ID::time0 + 97]->setFromNormalized(0.2680555555555556);
-      value[ID::time0 + 98]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 99]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 100]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 101]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 102]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 103]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 104]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 105]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 106]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 107]->setFromNormalized(0.2666666666666667);
-      value[ID::time0 + 108]->setFromNormalized(0.2694444444444445);
-      value[ID::time0 + 109]->setFromNormalized(0.27222222222222225);
-      value[ID::time0 + 110]->setFromNormalized(0.275);
-      value[ID::time0 + 111]->setFromNormalized(0.2777777777777778);
-      value[ID::time0 + 112]->setFromNormalized(0.28194444444444444);
-      value[ID::time0 + 113]->setFromNormalized(0.29027777777777775);
-      value[ID::time0 + 114]->setFromNormalized(0.2944444444444444);
-      value[ID::time0 + 115]->setFromNormalized(0.30000000000000004);
-      value[ID::time0 + 116]->setFromNormalized(0.3055555555555556);
-      value[ID::time0 + 117]->setFromNormalized(0.3194444444444444);
-      value[ID::time0 + 118]->setFromNormalized(0.33333333333333337);
-      value[ID::time0 + 119]->setFromNormalized(0.3472222222222222);
-      value[ID::time0 + 120]->setFromNormalized(0.36111111111111116);
-      value[ID::time0 + 121]->setFromNormalized(0.38888888888888884);
-      value[ID::time0 + 122]->setFromNormalized(0.4);
-      value[ID::time0 + 123]->setFromNormalized(0.4111111111111111);
-      value[ID::time0 + 124]->setFromNormalized(0.4388888888888889);
-      value[ID::time0 + 125]->setFromNormalized(0.4555555555555556);
-      value[ID::time0 + 126]->setFromNormalized(0.46111111111111114);
-      value[ID::time0 + 127]->setFromNormalized(0.47777777777777775);
-      value[ID::time0 + 128]->setFromNormalized(0.47777777777777775);
-      value[ID::time0 + 129]->setFromNormalized(0.47777777777777775);
-      value[ID::time0 + 130]->setFromNormalized(0.4833333333333333);
-      value[ID::time0 + 131]->setFromNormalized(0.4833333333333333);
-      value[ID::time0 + 132]->setFromNormalized(0.4666666666666667);
-      value[ID::time0 + 133]->setFromNormalized(0.4444444444444444);
-      value[ID::time0 + 134]->setFromNormalized(0.41666666666666663);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.11111111111111116);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.15555555555555556);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.19444444444444442);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.23333333333333328);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.2833333333333333);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.36111111111111116);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.4);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.4444444444444444);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.6361111111111111);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.6444444444444444);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.65);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.6527777777777778);
-      value[ID::innerFeed0 + 16]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 17]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 18]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 19]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 20]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 21]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 22]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 23]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 24]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 25]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 26]->setFromNormalized(0.6555555555555556);
-      value[ID::innerFeed0 + 27]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 28]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 29]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 30]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 31]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 32]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 33]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 34]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 35]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 36]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 37]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 38]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 39]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 40]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 41]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 42]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 43]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 44]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 45]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 46]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 47]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 48]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 49]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 50]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 51]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 52]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 53]->setFromNormalized(0.1611111111111111);
-      value[ID::innerFeed0 + 54]->setFromNormalized(0.1611111111111111);
-      value[ID::innerFeed0 + 55]->setFromNormalized(0.15555555555555556);
-      value[ID::innerFeed0 + 56]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 57]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 58]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 59]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 60]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 61]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 62]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 63]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 64]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 65]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 66]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 67]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 68]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 69]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 70]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 71]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 72]->setFromNormalized(0.15185182359483507);
-      value[ID::innerFeed0 + 73]->setFromNormalized(0.15555555555555556);
-      value[ID::innerFeed0 + 74]->setFromNormalized(0.15925928751627605);
-      value[ID::innerFeed0 + 75]->setFromNormalized(0.1611111111111111);
-      value[ID::innerFeed0 + 76]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 77]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 78]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 79]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 80]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 81]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 82]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 83]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 84]->setFromNormalized(0.85);
-      value[ID::innerFeed0 + 85]->setFromNormalized(0.85);
-      value[ID::innerFeed0 + 86]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 87]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 88]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 89]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 90]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 91]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 92]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 93]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 94]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 95]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 96]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 97]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 98]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 99]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 100]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 101]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 102]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 103]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 104]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 105]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 106]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 107]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 108]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 109]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 110]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 111]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 112]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 113]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 114]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 115]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 116]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 117]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 118]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 119]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 120]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 121]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 122]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 123]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 124]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 125]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 126]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 127]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 128]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 129]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 130]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 131]->setFromNormalized(0.0888888888888889);
-      value[ID::innerFeed0 + 132]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 133]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 134]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 0]->setFromNormalized(0.21944444444444444);
-      value[ID::d1Feed0 + 1]->setFromNormalized(0.2055555555555556);
-      value[ID::d1Feed0 + 2]->setFromNormalized(0.19999999999999996);
-      value[ID::d1Feed0 + 3]->setFromNormalized(0.19999999999999996);
-      value[ID::d1Feed0 + 4]->setFromNormalized(0.19999999999999996);
-      value[ID::d1Feed0 + 5]->setFromNormalized(0.19999999999999996);
-      value[ID::d1Feed0 + 6]->setFromNormalized(0.27222222222222225);
-      value[ID::d1Feed0 + 7]->setFromNormalized(0.3055555555555556);
-      value[ID::d1Feed0 + 8]->setFromNormalized(0.37222222222222223);
-      value[ID::d1Feed0 + 9]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 10]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 11]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 12]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 13]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 14]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 15]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 16]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 17]->setFromNormalized(0.23888888888888893);
-      value[ID::d1Feed0 + 18]->setFromNormalized(0.23888888888888893);
-      value[ID::d1Feed0 + 19]->setFromNormalized(0.23888888888888893);
-      value[ID::d1Feed0 + 20]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 21]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 22]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 23]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 24]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 25]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 26]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 27]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 28]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 29]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 30]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 31]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 32]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 33]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 34]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 35]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 36]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 37]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 38]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 39]->setFromNormalized(0.8222222222222222);
-      value[ID::d1Feed0 + 40]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 41]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 42]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 43]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 44]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 45]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 46]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 47]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 48]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 49]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 50]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 51]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 52]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 53]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 54]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 55]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 56]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 57]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 58]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 59]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 60]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 61]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 62]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 63]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 64]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 65]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 66]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 67]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 68]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 69]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 70]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 71]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 72]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 73]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 74]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 75]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 76]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 77]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 78]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 79]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 80]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 81]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 82]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 83]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 84]->setFromNormalized(0.7277777777777779);
-      value[ID::d1Feed0 + 85]->setFromNormalized(0.7277777777777779);
-      value[ID::d1Feed0 + 86]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 87]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 88]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 89]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 90]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 91]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 92]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 93]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 94]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 95]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 96]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 97]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 98]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 99]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 100]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 101]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 102]->setFromNormalized(0.31666666666666665);
-      value[ID::d1Feed0 + 103]->setFromNormalized(0.3111111111111111);
-      value[ID::d1Feed0 + 104]->setFromNormalized(0.3055555555555556);
-      value[ID::d1Feed0 + 105]->setFromNormalized(0.3055555555555556);
-      value[ID::d1Feed0 + 106]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 107]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 108]->setFromNormalized(0.30000000000000004);
-      value[ID::d1Feed0 + 109]->setFromNormalized(0.2944444444444444);
-      value[ID::d1Feed0 + 110]->setFromNormalized(0.2944444444444444);
-      value[ID::d1Feed0 + 111]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 112]->setFromNormalized(0.7444444444444445);
-      value[ID::d1Feed0 + 113]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 114]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 115]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 116]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 117]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 118]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 119]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 120]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 121]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 122]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 123]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 124]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 125]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 126]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 127]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 128]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 129]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 130]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 131]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 132]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 133]->setFromNormalized(0.5);
-      value[ID::d1Feed0 + 134]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 0]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 1]->setFromNormalized(0.19999999999999996);
-      value[ID::d2Feed0 + 2]->setFromNormalized(0.19444444444444442);
-      value[ID::d2Feed0 + 3]->setFromNormalized(0.19444444444444442);
-      value[ID::d2Feed0 + 4]->setFromNormalized(0.21111111111111114);
-      value[ID::d2Feed0 + 5]->setFromNormalized(0.22777777777777775);
-      value[ID::d2Feed0 + 6]->setFromNormalized(0.27222222222222225);
-      value[ID::d2Feed0 + 7]->setFromNormalized(0.30000000000000004);
-      value[ID::d2Feed0 + 8]->setFromNormalized(0.35);
-      value[ID::d2Feed0 + 9]->setFromNormalized(0.3680555555555556);
-      value[ID::d2Feed0 + 10]->setFromNormalized(0.4041666666666667);
-      value[ID::d2Feed0 + 11]->setFromNormalized(0.4222222222222223);
-      value[ID::d2Feed0 + 12]->setFromNormalized(0.4305555555555556);
-      value[ID::d2Feed0 + 13]->setFromNormalized(0.4388888888888889);
-      value[ID::d2Feed0 + 14]->setFromNormalized(0.4388888888888889);
-      value[ID::d2Feed0 + 15]->setFromNormalized(0.4388888888888889);
-      value[ID::d2Feed0 + 16]->setFromNormalized(0.4388888888888889);
-      value[ID::d2Feed0 + 17]->setFromNormalized(0.4388888888888889);
-      value[ID::d2Feed0 + 18]->setFromNormalized(0.4277777777777778);
-      value[ID::d2Feed0 + 19]->setFromNormalized(0.38888888888888884);
-      value[ID::d2Feed0 + 20]->setFromNormalized(0.3111111111111111);
-      value[ID::d2Feed0 + 21]->setFromNormalized(0.2833333333333333);
-      value[ID::d2Feed0 + 22]->setFromNormalized(0.2416666666666667);
-      value[ID::d2Feed0 + 23]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 24]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 25]->setFromNormalized(0.5);
-      value[ID::d2Feed0 + 26]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 0]->setFromNormalized(0.13055555555555554);
-      value[ID::d3Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 2]->setFromNormalized(0.7944444444444445);
-      value[ID::d3Feed0 + 3]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 4]->setFromNormalized(0.7555555555555555);
-      value[ID::d3Feed0 + 5]->setFromNormalized(0.7555555555555555);
-      value[ID::d3Feed0 + 6]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 7]->setFromNormalized(0.5);
-      value[ID::d3Feed0 + 8]->setFromNormalized(0.5);
-      value[ID::d4Feed0 + 0]->setFromNormalized(0.7555555555555555);
-      value[ID::d4Feed0 + 1]->setFromNormalized(0.5);
-      value[ID::d4Feed0 + 2]->setFromNormalized(0.24444444444444446);
-      value[ID::timeMultiply]->setFromNormalized(0.7539997100830078);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::d1FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d2FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d3FeedMultiply]->setFromNormalized(1.0);
-      value[ID::d4FeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetRange]->setFromNormalized(0.2752180285130085);
-      value[ID::innerFeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d1FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d2FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d3FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::d4FeedOffsetRange]->setFromNormalized(0.0);
-      value[ID::timeModulation]->setFromInt(1);
-      value[ID::innerFeedModulation]->setFromInt(0);
-      value[ID::d1FeedModulation]->setFromInt(0);
-      value[ID::d2FeedModulation]->setFromInt(0);
-      value[ID::d3FeedModulation]->setFromInt(0);
-      value[ID::d4FeedModulation]->setFromInt(0);
-      value[ID::seed]->setFromInt(0);
-      value[ID::stereoCross]->setFromNormalized(0.5);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
+void GlobalParameter::loadProgram(uint32_t index)
+{
+  if (index >= presetBank.size()) {
+    resetParameter();
+    return;
   }
+  value.load(presetBank[index]);
 }
 
 #endif
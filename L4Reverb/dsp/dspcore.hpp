@@ -61,6 +61,7 @@ public:
     void refreshSeed();                                                                  \
                                                                                          \
     float sampleRate = 44100.0f;                                                         \
+    SmootherCommon<float> smootherCommon;                                                \
                                                                                          \
     std::minstd_rand timeRng{0};                                                         \
     std::minstd_rand innerRng{0};                                                        \
@@ -25,66 +25,69 @@
 #include "../../common/dsp/constants.hpp"
 #include "../../common/dsp/smoother.hpp"
 
+#include "../../lib/vcl/vectorclass.h"
+
 namespace SomeDSP {
 
-// 2x oversampled delay.
-template<typename Sample> class Delay {
+// 2x oversampled stereo delay. Left and right are interleaved in `buf`, so a write of both
+// channels touches one cache line. Lane 0 and 1 of Vec4f are left and right. Lane 2 and 3
+// are unused.
+class StereoDelay {
 public:
-  Sample w1 = 0;
-  Sample rFraction = 0.0;
+  Vec4f w1 = 0.0f;
   int wptr = 0;
-  int rptr = 0;
   int size = 0;
-  std::vector<Sample> buf;
+  std::vector<float> buf;
 
-  void setup(Sample sampleRate, Sample maxTime)
+  void setup(float sampleRate, float maxTime)
   {
-    size = int(Sample(2) * sampleRate * maxTime) + 1;
+    size = int(2.0f * sampleRate * maxTime) + 1;
     if (size < 4) size = 4;
 
-    buf.resize(size);
+    buf.resize(2 * size);
 
     reset();
   }
 
   void reset()
   {
-    w1 = 0;
-    std::fill(buf.begin(), buf.end(), 0);
+    w1 = 0.0f;
+    std::fill(buf.begin(), buf.end(), 0.0f);
   }
 
-  Sample process(Sample input, Sample sampleRate, Sample seconds)
+  Vec4f process(Vec4f input, float sampleRate, Vec4f seconds)
   {
     // Set delay time.
-    Sample timeInSample = std::clamp<Sample>(Sample(2) * sampleRate * seconds, 0, size);
+    Vec4f timeInSample = min(max(2.0f * sampleRate * seconds, 0.0f), float(size));
 
-    int timeInt = int(timeInSample);
-    rFraction = timeInSample - Sample(timeInt);
+    Vec4i timeInt = truncatei(timeInSample);
+    Vec4f rFraction = timeInSample - to_float(timeInt);
 
-    rptr = wptr - timeInt;
-    if (rptr < 0) rptr += size;
+    int rptrL = wptr - timeInt[0];
+    if (rptrL < 0) rptrL += size;
+    int rptrR = wptr - timeInt[1];
+    if (rptrR < 0) rptrR += size;
 
     // Write to buffer.
-    buf[wptr] = Sample(0.5) * (input + w1);
+    (0.5f * (input + w1)).store_partial(2, &buf[2 * wptr]);
     ++wptr;
     if (wptr >= size) wptr -= size;
 
-    buf[wptr] = input;
+    input.store_partial(2, &buf[2 * wptr]);
     ++wptr;
     if (wptr >= size) wptr -= size;
 
     w1 = input;
 
     // Read from buffer.
-    const size_t i1 = rptr;
-    ++rptr;
-    if (rptr >= size) rptr -= size;
-
-    const size_t i0 = rptr;
-    ++rptr;
-    if (rptr >= size) rptr -= size;
-
-    return buf[i0] - rFraction * (buf[i0] - buf[i1]);
+    const int i1L = rptrL;
+    const int i1R = rptrR;
+    if (++rptrL >= size) rptrL -= size;
+    if (++rptrR >= size) rptrR -= size;
+
+    Vec4f buf0(buf[2 * rptrL], buf[2 * rptrR + 1], 0.0f, 0.0f);
+    Vec4f buf1(buf[2 * i1L], buf[2 * i1R + 1], 0.0f, 0.0f);
+    return buf0 - rFraction * (buf0 - buf1);
   }
 };
 
@@ -92,21 +95,21 @@ public:
 Allpass filter with arbitrary length delay.
 https://ccrma.stanford.edu/~jos/pasp/Allpass_Two_Combs.html
 */
-template<typename Sample> class LongAllpass {
+class StereoAllpass {
 public:
-  Sample buffer = 0;
-  Delay<Sample> delay;
+  Vec4f buffer = 0.0f;
+  StereoDelay delay;
 
-  void setup(Sample sampleRate, Sample maxTime) { delay.setup(sampleRate, maxTime); }
+  void setup(float sampleRate, float maxTime) { delay.setup(sampleRate, maxTime); }
 
   void reset()
   {
-    buffer = 0;
+    buffer = 0.0f;
     delay.reset();
   }
 
   // gain in [0, 1].
-  Sample process(Sample input, Sample sampleRate, Sample seconds, Sample gain)
+  Vec4f process(Vec4f input, float sampleRate, Vec4f seconds, Vec4f gain)
   {
     input -= gain * buffer;
     auto output = buffer + gain * input;
@@ -115,43 +118,52 @@ public:
   }
 };
 
-template<typename Sample> struct LongAllpassData {
-  Sample seconds = 0;
-  Sample outerFeed = 0; // in [-1, 1].
-  Sample innerFeed = 0; // in [-1, 1].
-  Sample lowpassKp = 0; // in [ 0, 1].
+struct StereoAllpassData {
+  Vec4f seconds = 0.0f;
+  Vec4f outerFeed = 0.0f; // in [-1, 1].
+  Vec4f innerFeed = 0.0f; // in [-1, 1].
+  Vec4f lowpassKp = 0.0f; // in [ 0, 1].
 };
 
-template<typename Sample, size_t nest> class NestedLongAllpass {
+// Nested allpass for left and right. Both channels are processed in the same lanes of
+// Vec4f, instead of running 2 structurally identical scalar chains.
+template<size_t nest> class StereoLongAllpass {
 public:
-  std::array<Sample, nest> in{};
-  std::array<Sample, nest> buffer{};
-  std::array<LongAllpass<Sample>, nest> allpass;
-  std::array<LongAllpassData<Sample>, nest> data;
-  std::array<PController<Sample>, nest> lowpass;
+  std::array<Vec4f, nest> in{};
+  std::array<Vec4f, nest> buffer{};
+  std::array<StereoAllpass, nest> allpass;
+  std::array<StereoAllpassData, nest> data;
+  std::array<PController<Vec4f>, nest> lowpass;
 
-  void setup(Sample sampleRate, Sample maxTime)
+  void setup(float sampleRate, float maxTime)
   {
     for (auto &ap : allpass) ap.setup(sampleRate, maxTime);
   }
 
   void reset()
   {
-    in.fill(0);
-    buffer.fill(0);
+    in.fill(0.0f);
+    buffer.fill(0.0f);
     for (auto &ap : allpass) ap.reset();
-    for (auto &dat : data) dat = {0, 0, 0};
+    for (auto &dat : data) dat = {};
     for (auto &lp : lowpass) lp.reset();
   }
 
-  Sample process(Sample input, Sample sampleRate)
+  std::array<float, 2>
+  process(float inL, float inR, float sampleRate, float stereoCross = 0.2f)
   {
+    for (size_t idx = 0; idx < nest; idx += 2) {
+      Vec4f swapped = permute4<1, 0, 2, 3>(buffer[idx]);
+      buffer[idx] -= stereoCross * (swapped + buffer[idx]);
+    }
+
+    Vec4f input(inL, inR, 0.0f, 0.0f);
     for (size_t idx = 0; idx < nest; ++idx) {
       input -= data[idx].outerFeed * buffer[idx];
       in[idx] = input;
     }
 
-    Sample out = in.back();
+    Vec4f out = in.back();
     for (size_t idx = nest - 1; idx < nest; --idx) {
       auto apOut
         = allpass[idx].process(out, sampleRate, data[idx].seconds, data[idx].innerFeed);
@@ -161,37 +173,7 @@ public:
       buffer[idx] = lowpass[idx].process(apOut);
     }
 
-    return out;
-  }
-};
-
-template<typename Sample, size_t nest> class StereoLongAllpass {
-public:
-  NestedLongAllpass<Sample, nest> apL;
-  NestedLongAllpass<Sample, nest> apR;
-
-  void setup(Sample sampleRate, Sample maxTime)
-  {
-    apL.setup(sampleRate, maxTime);
-    apR.setup(sampleRate, maxTime);
-  }
-
-  void reset()
-  {
-    apL.reset();
-    apR.reset();
-  }
-
-  std::array<Sample, 2>
-  process(Sample inL, Sample inR, Sample sampleRate, Sample stereoCross = 0.2)
-  {
-    for (size_t idx = 0; idx < nest; idx += 2) {
-      Sample tmpL = apL.buffer[idx];
-      apL.buffer[idx] -= stereoCross * (apR.buffer[idx] + apL.buffer[idx]);
-      apR.buffer[idx] -= stereoCross * (tmpL + apR.buffer[idx]);
-    }
-
-    return {apL.process(inL, sampleRate), apR.process(inR, sampleRate)};
+    return {out[0], out[1]};
   }
 };
 
@@ -33,8 +33,8 @@ void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.2f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.2f);
 
   delay.setup(sampleRate, Scales::time.getMax());
 
@@ -64,8 +64,8 @@ void DSPCORE_NAME::reset()
     auto timeOffset
       = calcOffset(param.value[ID::timeOffset0 + idx]->getFloat(), timeOffsetMul);
     auto time = param.value[ID::time0 + idx]->getFloat();
-    interpTime[0][idx].reset(timeOffset[0] * timeMul * time);
-    interpTime[1][idx].reset(timeOffset[1] * timeMul * time);
+    interpTime[idx].reset(
+      Vec4f(timeOffset[0] * timeMul * time, timeOffset[1] * timeMul * time, 0.0f, 0.0f));
     lowpassLfoTime[0][idx].reset();
     lowpassLfoTime[1][idx].reset();
     lowpassLfoTime[0][idx].kp = timeLfoLowpassKp;
@@ -74,14 +74,16 @@ void DSPCORE_NAME::reset()
     auto outerOffset
       = calcOffset(param.value[ID::outerFeedOffset0 + idx]->getFloat(), outerOffsetMul);
     auto outerFeed = param.value[ID::outerFeed0 + idx]->getFloat();
-    interpOuterFeed[0][idx].reset(outerOffset[0] * outerMul * outerFeed);
-    interpOuterFeed[1][idx].reset(outerOffset[1] * outerMul * outerFeed);
+    interpOuterFeed[idx].reset(Vec4f(
+      outerOffset[0] * outerMul * outerFeed, outerOffset[1] * outerMul * outerFeed, 0.0f,
+      0.0f));
 
     auto innerOffset
       = calcOffset(param.value[ID::innerFeedOffset0 + idx]->getFloat(), innerOffsetMul);
     auto innerFeed = param.value[ID::innerFeed0 + idx]->getFloat();
-    interpInnerFeed[0][idx].reset(innerOffset[0] * innerMul * innerFeed);
-    interpInnerFeed[1][idx].reset(innerOffset[1] * innerMul * innerFeed);
+    interpInnerFeed[idx].reset(Vec4f(
+      innerOffset[0] * innerMul * innerFeed, innerOffset[1] * innerMul * innerFeed, 0.0f,
+      0.0f));
 
     interpLowpassCutoff[idx].reset(param.value[ID::lowpassCutoff0 + idx]->getFloat());
   }
@@ -97,7 +99,7 @@ void DSPCORE_NAME::setParameters(float tempo)
 {
   using ID = ParameterID::ID;
 
-  SmootherCommon<float>::setTime(param.value[ID::smoothness]->getFloat());
+  smootherCommon.setTime(param.value[ID::smoothness]->getFloat());
 
   auto timeMul = param.value[ID::timeMultiply]->getFloat();
   auto outerMul = param.value[ID::outerFeedMultiply]->getFloat();
@@ -115,53 +117,55 @@ void DSPCORE_NAME::setParameters(float tempo)
     auto timeLfo = param.value[ID::timeLfoAmount0 + idx]->getFloat();
     lowpassLfoTime[0][idx].kp = timeLfoLowpassKp;
     lowpassLfoTime[1][idx].kp = timeLfoLowpassKp;
-    interpTime[0][idx].push(std::clamp<float>(
+    const auto timeL = std::clamp<float>(
       timeOffset[0] * timeMul * time
         + timeLfo * lowpassLfoTime[0][idx].process(dist(rng)),
-      0.0f, 1.0f));
-    interpTime[1][idx].push(std::clamp<float>(
+      0.0f, 1.0f);
+    const auto timeR = std::clamp<float>(
       timeOffset[1] * timeMul * time
         + timeLfo * lowpassLfoTime[1][idx].process(dist(rng)),
-      0.0f, 1.0f));
+      0.0f, 1.0f);
+    interpTime[idx].push(smootherCommon, Vec4f(timeL, timeR, 0.0f, 0.0f));
 
     auto outerOffset
       = calcOffset(param.value[ID::outerFeedOffset0 + idx]->getFloat(), outerOffsetMul);
     auto outerFeed = param.value[ID::outerFeed0 + idx]->getFloat();
-    interpOuterFeed[0][idx].push(outerOffset[0] * outerMul * outerFeed);
-    interpOuterFeed[1][idx].push(outerOffset[1] * outerMul * outerFeed);
+    interpOuterFeed[idx].push(
+      smootherCommon,
+      Vec4f(
+        outerOffset[0] * outerMul * outerFeed, outerOffset[1] * outerMul * outerFeed,
+        0.0f, 0.0f));
 
     auto innerOffset
       = calcOffset(param.value[ID::innerFeedOffset0 + idx]->getFloat(), innerOffsetMul);
     auto innerFeed = param.value[ID::innerFeed0 + idx]->getFloat();
-    interpInnerFeed[0][idx].push(innerOffset[0] * innerMul * innerFeed);
-    interpInnerFeed[1][idx].push(innerOffset[1] * innerMul * innerFeed);
-
-    interpLowpassCutoff[idx].push(param.value[ID::lowpassCutoff0 + idx]->getFloat());
+    interpInnerFeed[idx].push(
+      smootherCommon,
+      Vec4f(
+        innerOffset[0] * innerMul * innerFeed, innerOffset[1] * innerMul * innerFeed,
+        0.0f, 0.0f));
+
+    interpLowpassCutoff[idx].push(
+      smootherCommon, param.value[ID::lowpassCutoff0 + idx]->getFloat());
   }
-  interpStereoCross.push(param.value[ID::stereoCross]->getFloat());
-  interpStereoSpread.push(param.value[ID::stereoSpread]->getFloat());
-  interpDry.push(param.value[ID::dry]->getFloat());
-  interpWet.push(param.value[ID::wet]->getFloat());
+  interpStereoCross.push(smootherCommon, param.value[ID::stereoCross]->getFloat());
+  interpStereoSpread.push(smootherCommon, param.value[ID::stereoSpread]->getFloat());
+  interpDry.push(smootherCommon, param.value[ID::dry]->getFloat());
+  interpWet.push(smootherCommon, param.value[ID::wet]->getFloat());
 }
 
 void DSPCORE_NAME::process(
   const size_t length, const float *in0, const float *in1, float *out0, float *out1)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     for (size_t idx = 0; idx < nestingDepth; ++idx) {
-      auto lpCut = interpLowpassCutoff[idx].process();
-
-      delay.apL.data[idx].seconds = interpTime[0][idx].process();
-      delay.apL.data[idx].outerFeed = interpOuterFeed[0][idx].process();
-      delay.apL.data[idx].innerFeed = interpInnerFeed[0][idx].process();
-      delay.apL.data[idx].lowpassKp = lpCut;
-
-      delay.apR.data[idx].seconds = interpTime[1][idx].process();
-      delay.apR.data[idx].outerFeed = interpOuterFeed[1][idx].process();
-      delay.apR.data[idx].innerFeed = interpInnerFeed[1][idx].process();
-      delay.apR.data[idx].lowpassKp = lpCut;
+      auto &data = delay.data[idx];
+      data.seconds = interpTime[idx].process();
+      data.outerFeed = interpOuterFeed[idx].process();
+      data.innerFeed = interpInnerFeed[idx].process();
+      data.lowpassKp = interpLowpassCutoff[idx].process();
     }
 
     auto delayOut
@@ -60,14 +60,15 @@ public:
                                                                                          \
   private:                                                                               \
     float sampleRate = 44100.0f;                                                         \
+    SmootherCommon<float> smootherCommon;                                                \
                                                                                          \
     std::minstd_rand rng{0};                                                             \
     std::array<std::array<PController<float>, nestingDepth>, 2> lowpassLfoTime;          \
                                                                                          \
-    StereoLongAllpass<float, nestingDepth> delay;                                        \
-    std::array<std::array<ExpSmoother<float>, nestingDepth>, 2> interpTime;              \
-    std::array<std::array<ExpSmoother<float>, nestingDepth>, 2> interpOuterFeed;         \
-    std::array<std::array<ExpSmoother<float>, nestingDepth>, 2> interpInnerFeed;         \
+    StereoLongAllpass<nestingDepth> delay;                                               \
+    std::array<ExpSmoother4, nestingDepth> interpTime;                                   \
+    std::array<ExpSmoother4, nestingDepth> interpOuterFeed;                              \
+    std::array<ExpSmoother4, nestingDepth> interpInnerFeed;                              \
     std::array<ExpSmoother<float>, nestingDepth> interpLowpassCutoff;                    \
     ExpSmoother<float> interpStereoCross;                                                \
     ExpSmoother<float> interpStereoSpread;                                               \
@@ -20,2895 +20,615 @@
 // Generated from preset dump.
 #ifndef TEST_BUILD
 
-void GlobalParameter::loadProgram(uint32_t index)
-{
-  using ID = ParameterID::ID;
-
-  switch (index) {
-    default:
-      resetParameter();
-      break;
-
-    case presetDefault: {
-      value[ID::time0 + 0]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 1]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 2]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 3]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 4]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 5]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 6]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 7]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 8]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 9]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 10]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 11]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 12]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 13]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 14]->setFromNormalized(0.5869779495764822);
-      value[ID::time0 + 15]->setFromNormalized(0.5869779495764822);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.5);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.0);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.13760901425650426);
-      value[ID::stereoCross]->setFromNormalized(0.0);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetBadPhase: {
-      value[ID::time0 + 0]->setFromNormalized(0.18571428571428572);
-      value[ID::time0 + 1]->setFromNormalized(0.26428571428571423);
-      value[ID::time0 + 2]->setFromNormalized(0.3214285714285714);
-      value[ID::time0 + 3]->setFromNormalized(0.44285714285714284);
-      value[ID::time0 + 4]->setFromNormalized(0.5357142857142857);
-      value[ID::time0 + 5]->setFromNormalized(0.6142857142857143);
-      value[ID::time0 + 6]->setFromNormalized(0.6857142857142857);
-      value[ID::time0 + 7]->setFromNormalized(0.7428571428571429);
-      value[ID::time0 + 8]->setFromNormalized(0.7);
-      value[ID::time0 + 9]->setFromNormalized(0.4285714285714286);
-      value[ID::time0 + 10]->setFromNormalized(0.5714285714285714);
-      value[ID::time0 + 11]->setFromNormalized(0.5071428571428571);
-      value[ID::time0 + 12]->setFromNormalized(0.4642857142857143);
-      value[ID::time0 + 13]->setFromNormalized(0.4285714285714286);
-      value[ID::time0 + 14]->setFromNormalized(0.3571428571428571);
-      value[ID::time0 + 15]->setFromNormalized(0.3214285714285714);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.9357142857142857);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.7160714285714286);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.2767857142857143);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.05714285714285716);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.2678571428571429);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.6892857142857143);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.9071428571428571);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.7666666575840542);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.48571428571428577);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.1428571428571429);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.26190474373953687);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.4999999455043248);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.7380952017647879);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.6285714285714286);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.37142857142857144);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.11428571428571432);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.13571428571428568);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.2678571428571429);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.5321428571428571);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.7964285714285715);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.9142857142857143);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.5214285714285714);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.11428571428571432);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.0714285714285714);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.28214285714285714);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.7035714285714285);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.9142857142857143);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.7428571428571429);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.5767857142857142);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.24464285714285716);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.07857142857142863);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.3214285714285714);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.5428571428571429);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.5928571428571429);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.5285714285714286);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.7142857142857143);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.5357142857142857);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.7214285714285714);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.4642857142857143);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.4357142857142857);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.41428571428571426);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.5928571428571429);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.5714285714285714);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.33571428571428574);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.5785714285714285);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.6785714285714286);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.5642857142857143);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.3642857142857143);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.55);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.4571428571428572);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.22857142857142854);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.6214285714285714);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.17142857142857137);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.7285714285714286);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.6142857142857143);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.44999999999999996);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.3571428571428571);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.27142857142857146);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.2571428571428571);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.3214285714285714);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.5428571428571429);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.7142857142857143);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.6571428571428571);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.5214285714285714);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.35);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.22857142857142854);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.20714285714285718);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.20714285714285718);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.2571428571428571);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.5571428571428572);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.6071428571428572);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.5071428571428571);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.6928571428571428);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.5214285714285714);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.3928571428571429);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.40714285714285714);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.4714285714285714);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.5642857142857143);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.5357142857142857);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.27142857142857146);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.35);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.3571428571428571);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.30000000000000004);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.0);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(0.9357142857142857);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(0.9357142857142857);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(0.9357142857142857);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(0.95);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(0.95);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(0.95);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(0.95);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(0.95);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(0.9285714285714286);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(0.8357142857142857);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(0.6785714285714286);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(0.5714285714285714);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(0.4642857142857143);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(0.27142857142857146);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(0.18571428571428572);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.35560888051986694);
-      value[ID::stereoCross]->setFromNormalized(0.3880000710487366);
-      value[ID::stereoSpread]->setFromNormalized(0.8519997596740723);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.7520002126693726);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetBarrel: {
-      value[ID::time0 + 0]->setFromNormalized(0.24285714285714288);
-      value[ID::time0 + 1]->setFromNormalized(0.2857142857142857);
-      value[ID::time0 + 2]->setFromNormalized(0.2928571428571428);
-      value[ID::time0 + 3]->setFromNormalized(0.2928571428571428);
-      value[ID::time0 + 4]->setFromNormalized(0.2928571428571428);
-      value[ID::time0 + 5]->setFromNormalized(0.2928571428571428);
-      value[ID::time0 + 6]->setFromNormalized(0.2928571428571428);
-      value[ID::time0 + 7]->setFromNormalized(0.2928571428571428);
-      value[ID::time0 + 8]->setFromNormalized(0.2928571428571428);
-      value[ID::time0 + 9]->setFromNormalized(0.2928571428571428);
-      value[ID::time0 + 10]->setFromNormalized(0.2928571428571428);
-      value[ID::time0 + 11]->setFromNormalized(0.3214285714285714);
-      value[ID::time0 + 12]->setFromNormalized(0.3214285714285714);
-      value[ID::time0 + 13]->setFromNormalized(0.35);
-      value[ID::time0 + 14]->setFromNormalized(0.3857142857142857);
-      value[ID::time0 + 15]->setFromNormalized(0.3857142857142857);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.0357142857142857);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.042857142857142816);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.12142857142857144);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.1428571428571429);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.13571428571428568);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.16428571428571426);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.19285714285714284);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.26428571428571423);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.37857142857142856);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.6);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.7428571428571429);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.7857142857142857);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.7857142857142857);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.7571428571428571);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.7071428571428571);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.7071428571428571);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.23571428571428577);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.1428571428571429);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.12857142857142856);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.12857142857142856);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.11428571428571432);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.11428571428571432);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.15714285714285714);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.30000000000000004);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.3928571428571429);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.41428571428571426);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.44999999999999996);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.55);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.6785714285714286);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.7);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.6928571428571428);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.5357142857142857);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.55);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.5428571428571429);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.5285714285714286);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.5285714285714286);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.5142857142857142);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.4571428571428572);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.5071428571428571);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.4214285714285714);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.5071428571428571);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.5642857142857143);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.6357142857142857);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.6642857142857144);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.4714285714285714);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.4714285714285714);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.6420918328421457);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.40714285714285714);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.40714285714285714);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.40714285714285714);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.4285714285714286);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.47857142857142854);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.0);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(0.4980000853538513);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.13760901425650426);
-      value[ID::stereoCross]->setFromNormalized(0.0);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetBoing: {
-      value[ID::time0 + 0]->setFromNormalized(0.4);
-      value[ID::time0 + 1]->setFromNormalized(0.39770409720284594);
-      value[ID::time0 + 2]->setFromNormalized(0.3931122371128627);
-      value[ID::time0 + 3]->setFromNormalized(0.38852037702287945);
-      value[ID::time0 + 4]->setFromNormalized(0.3839285169328962);
-      value[ID::time0 + 5]->setFromNormalized(0.37933665684291296);
-      value[ID::time0 + 6]->setFromNormalized(0.3747447967529297);
-      value[ID::time0 + 7]->setFromNormalized(0.37015293666294646);
-      value[ID::time0 + 8]->setFromNormalized(0.3655610765729632);
-      value[ID::time0 + 9]->setFromNormalized(0.36096921648297986);
-      value[ID::time0 + 10]->setFromNormalized(0.3563773563929966);
-      value[ID::time0 + 11]->setFromNormalized(0.35178549630301337);
-      value[ID::time0 + 12]->setFromNormalized(0.3471936362130301);
-      value[ID::time0 + 13]->setFromNormalized(0.3426017761230469);
-      value[ID::time0 + 14]->setFromNormalized(0.33800991603306363);
-      value[ID::time0 + 15]->setFromNormalized(0.33571428571428574);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.55);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.5622449057442802);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.5867346899850028);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.6112244742257255);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.6357142584664481);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.6602040427071707);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.6846938269478935);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.7091836111886161);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.7336733954293387);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.7581631796700614);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.7826529502868652);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.8071427481515067);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.8316325460161482);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.8561223438807897);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.8806121417454311);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.8928571428571429);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.5785714285714285);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.5872449057442801);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.6045918328421456);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.6219387599400112);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.6392856870378767);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.6566326141357421);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.6739795412336077);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.6913264683314733);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.7086733954293387);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.7260203225272042);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.7433672496250698);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.7607141767229353);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.778061090196882);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.7954080309186663);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.8127549716404506);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.8214285714285714);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.55);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.41428571428571426);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.41428571428571426);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.41428571428571426);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.44285714285714284);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.4714285714285714);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.4714285714285714);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.4714285714285714);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.4714285714285714);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.48571428571428577);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.48571428571428577);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.5285714285714286);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.5357142857142857);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.5785714285714285);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.5788265228271484);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.5793367385864258);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.5798469543457031);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.5803571701049804);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.5808673858642578);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.5813776016235351);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.5818878173828125);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.5823980331420898);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.5829082489013672);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.5834184646606445);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.5839286804199219);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.5844388961791992);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.5849491119384765);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.5854593276977539);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.5857142857142856);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.4214285714285714);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.41505099705287385);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.402295902797154);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.38954080854143414);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.3767857142857143);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.3640306200299944);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.35127552577427457);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.3385204315185547);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.32576533726283485);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.313010243007115);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.30025514875139514);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.2875000544956752);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.2747449602399553);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.26198986598423546);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.2492347717285156);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.24285714285714288);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.07857142857142863);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.07831627982003353);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.07780609130859373);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.07729590279715404);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.07678571428571423);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.07627552577427454);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.07576533726283485);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.07525514875139505);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.07474496023995536);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.07423477172851567);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.07372458321707587);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.07321439470563618);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.07270420619419637);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.07219401768275668);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.07168382917131699);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.0714285714285714);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.13760901425650426);
-      value[ID::stereoCross]->setFromNormalized(0.0);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5199999809265137);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetColdPlace: {
-      value[ID::time0 + 0]->setFromNormalized(0.30000000000000004);
-      value[ID::time0 + 1]->setFromNormalized(0.3119898114885603);
-      value[ID::time0 + 2]->setFromNormalized(0.33596937997000553);
-      value[ID::time0 + 3]->setFromNormalized(0.35994894845145087);
-      value[ID::time0 + 4]->setFromNormalized(0.3839285169328962);
-      value[ID::time0 + 5]->setFromNormalized(0.40790808541434154);
-      value[ID::time0 + 6]->setFromNormalized(0.43188765389578687);
-      value[ID::time0 + 7]->setFromNormalized(0.4558672223772321);
-      value[ID::time0 + 8]->setFromNormalized(0.47984679085867743);
-      value[ID::time0 + 9]->setFromNormalized(0.5038263593401228);
-      value[ID::time0 + 10]->setFromNormalized(0.5278059278215681);
-      value[ID::time0 + 11]->setFromNormalized(0.5517854690551758);
-      value[ID::time0 + 12]->setFromNormalized(0.5757650647844588);
-      value[ID::time0 + 13]->setFromNormalized(0.5997446605137416);
-      value[ID::time0 + 14]->setFromNormalized(0.6237242562430245);
-      value[ID::time0 + 15]->setFromNormalized(0.6357142857142857);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.48571428571428577);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.15000000000000002);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.8857142857142857);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.9);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.8857142857142857);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.2785714285714286);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.2571428571428571);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.2857142857142857);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.37142857142857144);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.40714285714285714);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.8928571428571429);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.8857142857142857);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.8785714285714286);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.41428571428571426);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.41428571428571426);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.5142857142857142);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.11428571428571432);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.11428571428571432);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.12857142857142856);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.16428571428571426);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.85);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.6428571428571428);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.5642857142857143);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.55);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.16428571428571426);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.16428571428571426);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.3285714285714286);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.2857142857142857);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.23571428571428577);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.2142857142857143);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.16428571428571426);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.3214285714285714);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.6);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.9214285714285715);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.2857142857142857);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.6142857142857143);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.3928571428571429);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.75);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.2857142857142857);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.4714285714285714);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.6);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.6642857142857144);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.3642857142857143);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.30714285714285716);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.5714285714285714);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.3642857142857143);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.3214285714285714);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.3642857142857143);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.4928571428571429);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.5785714285714285);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.5857142857142856);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.40714285714285714);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.34285714285714286);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.3285714285714286);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.3285714285714286);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.5214285714285714);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.4714285714285714);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.44285714285714284);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.4285714285714286);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.3928571428571429);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.3928571428571429);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.4714285714285714);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.44999999999999996);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.47857142857142854);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.4714285714285714);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.48571428571428577);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.5214285714285714);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.4642857142857143);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.41428571428571426);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.4);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.3857142857142857);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.3857142857142857);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.3857142857142857);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.3857142857142857);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.3857142857142857);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.3857142857142857);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.0);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(0.4980000853538513);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.13760901425650426);
-      value[ID::stereoCross]->setFromNormalized(0.0);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetDamped: {
-      value[ID::time0 + 0]->setFromNormalized(0.18571428571428572);
-      value[ID::time0 + 1]->setFromNormalized(0.26428571428571423);
-      value[ID::time0 + 2]->setFromNormalized(0.2142857142857143);
-      value[ID::time0 + 3]->setFromNormalized(0.23571428571428577);
-      value[ID::time0 + 4]->setFromNormalized(0.2785714285714286);
-      value[ID::time0 + 5]->setFromNormalized(0.3214285714285714);
-      value[ID::time0 + 6]->setFromNormalized(0.3571428571428571);
-      value[ID::time0 + 7]->setFromNormalized(0.3857142857142857);
-      value[ID::time0 + 8]->setFromNormalized(0.41428571428571426);
-      value[ID::time0 + 9]->setFromNormalized(0.4285714285714286);
-      value[ID::time0 + 10]->setFromNormalized(0.4642857142857143);
-      value[ID::time0 + 11]->setFromNormalized(0.4928571428571429);
-      value[ID::time0 + 12]->setFromNormalized(0.5357142857142857);
-      value[ID::time0 + 13]->setFromNormalized(0.55);
-      value[ID::time0 + 14]->setFromNormalized(0.5714285714285714);
-      value[ID::time0 + 15]->setFromNormalized(0.5714285714285714);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.7571428571428571);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.7571428571428571);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.7571428571428571);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.7571428571428571);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.7571428571428571);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.7571428571428571);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.7714285714285715);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.7857142857142857);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.8357142857142857);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.8357142857142857);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.8357142857142857);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.8357142857142857);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.8357142857142857);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.8357142857142857);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.8357142857142857);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.8357142857142857);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.05714285714285716);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.2142857142857143);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.11428571428571432);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.09285714285714286);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.0714285714285714);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.0714285714285714);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.12857142857142856);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.1428571428571429);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.1428571428571429);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.1428571428571429);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.1428571428571429);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.1428571428571429);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.1428571428571429);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.5428571428571429);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.5928571428571429);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.5285714285714286);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.7142857142857143);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.5357142857142857);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.7214285714285714);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.4642857142857143);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.4357142857142857);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.41428571428571426);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.5928571428571429);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.5714285714285714);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.33571428571428574);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.5785714285714285);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.6785714285714286);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.5642857142857143);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.3642857142857143);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.55);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.4571428571428572);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.22857142857142854);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.6214285714285714);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.17142857142857137);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.7285714285714286);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.6142857142857143);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.44999999999999996);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.3571428571428571);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.27142857142857146);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.2571428571428571);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.3214285714285714);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.5428571428571429);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.7142857142857143);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.6571428571428571);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.5214285714285714);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.35);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.22857142857142854);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.20714285714285718);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.20714285714285718);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.2571428571428571);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.5571428571428572);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.6071428571428572);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.5071428571428571);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.6928571428571428);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.5214285714285714);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.3928571428571429);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.40714285714285714);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.4714285714285714);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.5642857142857143);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.5357142857142857);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.0);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(0.47857142857142854);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(0.5928571428571429);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(0.7214285714285714);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(0.7357142857142858);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(0.7071428571428571);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(0.6785714285714286);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(0.6357142857142857);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(0.6071428571428572);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(0.6071428571428572);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(0.6285714285714286);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(0.5642857142857143);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(0.4571428571428572);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(0.40714285714285714);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(0.40714285714285714);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(0.3857142857142857);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(0.3642857142857143);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.35560888051986694);
-      value[ID::stereoCross]->setFromNormalized(0.0);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.7120000123977661);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetHappyLittleTrees: {
-      value[ID::time0 + 0]->setFromNormalized(0.4642857142857143);
-      value[ID::time0 + 1]->setFromNormalized(0.4540816170828683);
-      value[ID::time0 + 2]->setFromNormalized(0.43367347717285154);
-      value[ID::time0 + 3]->setFromNormalized(0.4132653372628349);
-      value[ID::time0 + 4]->setFromNormalized(0.3928571973528181);
-      value[ID::time0 + 5]->setFromNormalized(0.3724490574428013);
-      value[ID::time0 + 6]->setFromNormalized(0.35204091753278455);
-      value[ID::time0 + 7]->setFromNormalized(0.3316327776227679);
-      value[ID::time0 + 8]->setFromNormalized(0.3112246377127511);
-      value[ID::time0 + 9]->setFromNormalized(0.29081649780273433);
-      value[ID::time0 + 10]->setFromNormalized(0.27040835789271767);
-      value[ID::time0 + 11]->setFromNormalized(0.2500002179827009);
-      value[ID::time0 + 12]->setFromNormalized(0.2295920780726841);
-      value[ID::time0 + 13]->setFromNormalized(0.20918393816266745);
-      value[ID::time0 + 14]->setFromNormalized(0.18877579825265067);
-      value[ID::time0 + 15]->setFromNormalized(0.1785714285714286);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.5357142857142857);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.525);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.5035714285714286);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.4821428571428571);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.46071428571428574);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.4392857142857143);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.4178571428571428);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.39642857142857146);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.375);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.35357142857142854);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.3321428571428572);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.3107142857142857);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.28928571428571426);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.2678571428571429);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.24642857142857144);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.23571428571428577);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.7928571428571428);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.7928571428571428);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.6773809160505022);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.7928571428571428);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.639030647277832);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.6048469815935407);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.5706633159092495);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.5364796229771205);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.5022959572928292);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.46811229160853796);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.43392862592424664);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.3997449602399553);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.3655612945556641);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.3313776288713728);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.3142857142857143);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.12857142857142856);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.13571428571428568);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.2142857142857143);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.2857142857142857);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.3142857142857143);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.3642857142857143);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.3928571428571429);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.3928571428571429);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.3928571428571429);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.3857142857142857);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.3571428571428571);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.3285714285714286);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.3214285714285714);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.27142857142857146);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.2571428571428571);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.4571428571428572);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.5071428571428571);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.4214285714285714);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.5071428571428571);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.5642857142857143);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.6357142857142857);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.6642857142857144);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.4714285714285714);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.4714285714285714);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.6420918328421457);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.40714285714285714);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.40714285714285714);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.40714285714285714);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.4285714285714286);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.47857142857142854);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.7428571428571429);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.2785714285714286);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.2851648603166853);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.29835166931152346);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.3115384783063616);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.32472528730119976);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.3379120962960379);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.35109890529087606);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.3642857142857143);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.3774725232805525);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.3906593322753906);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.4038461412702288);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.4170329502650669);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.4302197592599052);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.44340656825474334);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.44999999999999996);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(0.40714285714285714);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(0.48571428571428577);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(0.5571428571428572);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(0.5714285714285714);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(0.6285714285714286);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(0.6785714285714286);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(0.7071428571428571);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(0.6285714285714286);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(0.5928571428571429);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(0.55);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(0.4642857142857143);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(0.40714285714285714);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(0.3928571428571429);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(0.34285714285714286);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(0.3142857142857143);
-      value[ID::timeMultiply]->setFromNormalized(0.4980000853538513);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.13760901425650426);
-      value[ID::stereoCross]->setFromNormalized(0.0);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetInterleave: {
-      value[ID::time0 + 0]->setFromNormalized(0.26428571428571423);
-      value[ID::time0 + 1]->setFromNormalized(0.24285714285714288);
-      value[ID::time0 + 2]->setFromNormalized(0.24285714285714288);
-      value[ID::time0 + 3]->setFromNormalized(0.2785714285714286);
-      value[ID::time0 + 4]->setFromNormalized(0.34285714285714286);
-      value[ID::time0 + 5]->setFromNormalized(0.3857142857142857);
-      value[ID::time0 + 6]->setFromNormalized(0.4714285714285714);
-      value[ID::time0 + 7]->setFromNormalized(0.5214285714285714);
-      value[ID::time0 + 8]->setFromNormalized(0.5928571428571429);
-      value[ID::time0 + 9]->setFromNormalized(0.6071428571428572);
-      value[ID::time0 + 10]->setFromNormalized(0.6142857142857143);
-      value[ID::time0 + 11]->setFromNormalized(0.6285714285714286);
-      value[ID::time0 + 12]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 13]->setFromNormalized(0.4285714285714286);
-      value[ID::time0 + 14]->setFromNormalized(0.37857142857142856);
-      value[ID::time0 + 15]->setFromNormalized(0.3214285714285714);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.25);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.7928571428571428);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.30714285714285716);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.8);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.2928571428571428);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.6846938269478935);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.22142857142857142);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.7336733954293387);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.26428571428571423);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.7826529502868652);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.2142857142857143);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.8316325460161482);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.22142857142857142);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.8806121417454311);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.2142857142857143);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.18571428571428572);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.8928571428571429);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.16428571428571426);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.9071428571428571);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.15000000000000002);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.85);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.1785714285714286);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.8857142857142857);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.20714285714285718);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.7260203225272042);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.1785714285714286);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.7607141767229353);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.20714285714285718);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.7954080309186663);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.27142857142857146);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.8214285714285714);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.8357142857142857);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.19999999999999996);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.7214285714285714);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.27142857142857146);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.6571428571428571);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.33571428571428574);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.6071428571428572);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.41428571428571426);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.5571428571428572);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.37142857142857144);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.6571428571428571);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.3142857142857143);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.7357142857142858);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.2857142857142857);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.8357142857142857);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.1785714285714286);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.5285714285714286);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.4571428571428572);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.5714285714285714);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.4214285714285714);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.6);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.4);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.6357142857142857);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.37142857142857144);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.6714285714285715);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.3571428571428571);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.7428571428571429);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.2785714285714286);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.7928571428571428);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.22857142857142854);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.8285714285714285);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.17142857142857137);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.6);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.402295902797154);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.5785714285714285);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.3767857142857143);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.5785714285714285);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.3928571428571429);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.5857142857142856);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.4285714285714286);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.6428571428571428);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.41428571428571426);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.6);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.37142857142857144);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.6214285714285714);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.41428571428571426);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.6214285714285714);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.19285714285714284);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.19107142857142856);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.1875);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.18392857142857144);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.18035714285714288);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.17678571428571432);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.17321428571428577);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.1696428571428571);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.16607142857142854);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.16249999999999998);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.15892857142857142);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.15535714285714286);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.1517857142857143);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.14821428571428574);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.14464285714285718);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.1428571428571429);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(0.44999999999999996);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(0.5142857142857142);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(0.6571428571428571);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(0.7857142857142857);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(0.7571428571428571);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(0.6785714285714286);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(0.5714285714285714);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(0.5714285714285714);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.539608895778656);
-      value[ID::stereoCross]->setFromNormalized(0.0);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5199999809265137);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetLateToParty: {
-      value[ID::time0 + 0]->setFromNormalized(0.16428571428571426);
-      value[ID::time0 + 1]->setFromNormalized(0.22142857142857142);
-      value[ID::time0 + 2]->setFromNormalized(0.24285714285714288);
-      value[ID::time0 + 3]->setFromNormalized(0.24285714285714288);
-      value[ID::time0 + 4]->setFromNormalized(0.5714285714285714);
-      value[ID::time0 + 5]->setFromNormalized(0.6142857142857143);
-      value[ID::time0 + 6]->setFromNormalized(0.6714285714285715);
-      value[ID::time0 + 7]->setFromNormalized(0.7357142857142858);
-      value[ID::time0 + 8]->setFromNormalized(0.7642857142857142);
-      value[ID::time0 + 9]->setFromNormalized(0.7785714285714286);
-      value[ID::time0 + 10]->setFromNormalized(0.7428571428571429);
-      value[ID::time0 + 11]->setFromNormalized(0.6857142857142857);
-      value[ID::time0 + 12]->setFromNormalized(0.6214285714285714);
-      value[ID::time0 + 13]->setFromNormalized(0.5642857142857143);
-      value[ID::time0 + 14]->setFromNormalized(0.48571428571428577);
-      value[ID::time0 + 15]->setFromNormalized(0.4357142857142857);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.3928571428571429);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.3928571428571429);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.40714285714285714);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.40714285714285714);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.4285714285714286);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.4285714285714286);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.40145992221164334);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.4285714285714286);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.4285714285714286);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.4285714285714286);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.6071428571428572);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.6357142857142857);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.6857142857142857);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.6857142857142857);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.6857142857142857);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.6857142857142857);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.12142857142857144);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.22857142857142854);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.22857142857142854);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.26428571428571423);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.37142857142857144);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.6285714285714286);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.6714285714285715);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.6714285714285715);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.6642857142857144);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.65);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.65);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.65);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.65);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.6428571428571428);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.5714285714285714);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.55);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.5357142857142857);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.5785714285714285);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.6071428571428572);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.6071428571428572);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.6071428571428572);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.6);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.4214285714285714);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.3642857142857143);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.3142857142857143);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.3142857142857143);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.3142857142857143);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.3142857142857143);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.3142857142857143);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.4);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.6214285714285714);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.9077618181021228);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.21355070333919868);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.35819787461124986);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.242874848814988);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.7132529709724198);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.877701334455369);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.8373704530395507);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.5348530419535192);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.65);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.22142857142857142);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.2785714285714286);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.2928571428571428);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.43378608525218937);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.4887122970104089);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.6928571428571428);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.7142857142857143);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.8613785057259497);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.6372324926603804);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.21828763949627672);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.5377589691842053);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.9046775175613491);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.7174356533155044);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.20468929630144594);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.8939253268242326);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.4739514413765647);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.09612098069068353);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.5595606928599709);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.28801715396624294);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.7029637336538773);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.21038964815305616);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.2700431931030437);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.91490279961712);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.3142857142857143);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.3142857142857143);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.27142857142857146);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.2571428571428571);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.2571428571428571);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.2571428571428571);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.2571428571428571);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.2857142857142857);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.3642857142857143);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.4);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.4214285714285714);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(0.28799980878829956);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.13760901425650426);
-      value[ID::stereoCross]->setFromNormalized(0.0);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
+using PresetBank = std::array<
+  std::array<double, ParameterID::ID_ENUM_LENGTH>,
+  GlobalParameter::Preset_ENUM_LENGTH>;
 
-    case presetLongLongReverb: {
-      value[ID::time0 + 0]->setFromNormalized(0.4285714285714286);
-      value[ID::time0 + 1]->setFromNormalized(0.4771428789411273);
-      value[ID::time0 + 2]->setFromNormalized(0.5742856979370117);
-      value[ID::time0 + 3]->setFromNormalized(0.6714285441807338);
-      value[ID::time0 + 4]->setFromNormalized(0.7685713904244559);
-      value[ID::time0 + 5]->setFromNormalized(0.8657142639160156);
-      value[ID::time0 + 6]->setFromNormalized(0.9142857142857143);
-      value[ID::time0 + 7]->setFromNormalized(0.5239010947091238);
-      value[ID::time0 + 8]->setFromNormalized(0.5750000272478376);
-      value[ID::time0 + 9]->setFromNormalized(0.6260989325387137);
-      value[ID::time0 + 10]->setFromNormalized(0.6771978378295899);
-      value[ID::time0 + 11]->setFromNormalized(0.7282967431204659);
-      value[ID::time0 + 12]->setFromNormalized(0.779395648411342);
-      value[ID::time0 + 13]->setFromNormalized(0.8304945537022181);
-      value[ID::time0 + 14]->setFromNormalized(0.8815934589930943);
-      value[ID::time0 + 15]->setFromNormalized(0.9071428571428571);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.44999999999999996);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.2571428571428571);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.25);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.25);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.25);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.2785714285714286);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.2785714285714286);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.2785714285714286);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.2785714285714286);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.2857142857142857);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.34285714285714286);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.3642857142857143);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.4357142857142857);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.5214285714285714);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.8571428571428572);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.8714285714285714);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.41428571428571426);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.9142857142857143);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.09285714285714286);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.07857142857142863);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.07857142857142863);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.07857142857142863);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.13571428571428568);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.16428571428571426);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.20714285714285718);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.4357142857142857);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.2142857142857143);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.25);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.8785714285714286);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.8785714285714286);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.8857142857142857);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.8857142857142857);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.40714285714285714);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.24285714285714288);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.4357142857142857);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.6357142857142857);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.6428571428571428);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.5142857142857142);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.3571428571428571);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.3142857142857143);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.27142857142857146);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.2571428571428571);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.2571428571428571);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.2571428571428571);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.3214285714285714);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.6);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.6142857142857143);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.5714285714285714);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.09285714285714286);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.12142857142857144);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.22142857142857142);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.27142857142857146);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.4357142857142857);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.5571428571428572);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.65);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.7428571428571429);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.8071428571428572);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.8214285714285714);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.8214285714285714);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.5142857142857142);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.22857142857142854);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.19999999999999996);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.17142857142857137);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.12142857142857144);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.22142857142857142);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.11428571428571432);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.2142857142857143);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.3642857142857143);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.6);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.85);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.7785714285714286);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.5214285714285714);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.3571428571428571);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.27142857142857146);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.25);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.25);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.8571428571428572);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.7642857142857142);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.6214285714285714);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.40714285714285714);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.0);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.13760901425650426);
-      value[ID::stereoCross]->setFromNormalized(0.0);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.9079999327659607);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
+static constexpr PresetBank presetBank{{
+  // Default
+  {{
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822,
+    0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5869779495764822, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.05, 1.0, 1.0,
+    0.13760901425650426, 0.0, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+  // BadPhase
+  {{
+    0.18571428571428572, 0.26428571428571423, 0.3214285714285714, 0.44285714285714284,
+    0.5357142857142857, 0.6142857142857143, 0.6857142857142857, 0.7428571428571429, 0.7,
+    0.4285714285714286, 0.5714285714285714, 0.5071428571428571, 0.4642857142857143,
+    0.4285714285714286, 0.3571428571428571, 0.3214285714285714, 0.9357142857142857,
+    0.7160714285714286, 0.2767857142857143, 0.05714285714285716, 0.2678571428571429,
+    0.6892857142857143, 0.9071428571428571, 0.7666666575840542, 0.48571428571428577,
+    0.1428571428571429, 0.26190474373953687, 0.4999999455043248, 0.7380952017647879,
+    0.6285714285714286, 0.37142857142857144, 0.11428571428571432, 0.13571428571428568,
+    0.2678571428571429, 0.5321428571428571, 0.7964285714285715, 0.9142857142857143,
+    0.5214285714285714, 0.11428571428571432, 0.0714285714285714, 0.28214285714285714,
+    0.7035714285714285, 0.9142857142857143, 0.7428571428571429, 0.5767857142857142,
+    0.24464285714285716, 0.07857142857142863, 0.3214285714285714, 0.5428571428571429,
+    0.5928571428571429, 0.5285714285714286, 0.7142857142857143, 0.5357142857142857,
+    0.7214285714285714, 0.4642857142857143, 0.4357142857142857, 0.41428571428571426,
+    0.5928571428571429, 0.5714285714285714, 0.33571428571428574, 0.5785714285714285,
+    0.6785714285714286, 0.5642857142857143, 0.3642857142857143, 0.55, 0.4571428571428572,
+    0.22857142857142854, 0.6214285714285714, 0.17142857142857137, 0.6785714285714286,
+    0.7285714285714286, 0.6142857142857143, 0.44999999999999996, 0.3571428571428571,
+    0.27142857142857146, 0.2571428571428571, 0.3214285714285714, 0.5428571428571429,
+    0.7142857142857143, 0.6571428571428571, 0.5214285714285714, 0.35,
+    0.22857142857142854, 0.20714285714285718, 0.20714285714285718, 0.2571428571428571,
+    0.5571428571428572, 0.6071428571428572, 0.5071428571428571, 0.6928571428571428,
+    0.5214285714285714, 0.3928571428571429, 0.40714285714285714, 0.4714285714285714,
+    0.5642857142857143, 0.5357142857142857, 0.27142857142857146, 0.35,
+    0.3571428571428571, 0.30000000000000004, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 1.0, 0.9357142857142857, 0.9357142857142857, 0.9357142857142857, 0.95,
+    0.95, 0.95, 0.95, 0.95, 0.9285714285714286, 0.8357142857142857, 0.6785714285714286,
+    0.5714285714285714, 0.4642857142857143, 0.27142857142857146, 0.18571428571428572,
+    1.0, 1.0, 1.0, 0.05, 1.0, 1.0, 0.35560888051986694, 0.3880000710487366,
+    0.8519997596740723, 0.5, 0.7520002126693726, 0.5, 0,
+  }},
+  // Barrel
+  {{
+    0.24285714285714288, 0.2857142857142857, 0.2928571428571428, 0.2928571428571428,
+    0.2928571428571428, 0.2928571428571428, 0.2928571428571428, 0.2928571428571428,
+    0.2928571428571428, 0.2928571428571428, 0.2928571428571428, 0.3214285714285714,
+    0.3214285714285714, 0.35, 0.3857142857142857, 0.3857142857142857, 0.0357142857142857,
+    0.042857142857142816, 0.12142857142857144, 0.1428571428571429, 0.13571428571428568,
+    0.16428571428571426, 0.19285714285714284, 0.26428571428571423, 0.37857142857142856,
+    0.6, 0.7428571428571429, 0.7857142857142857, 0.7857142857142857, 0.7571428571428571,
+    0.7071428571428571, 0.7071428571428571, 0.23571428571428577, 0.1428571428571429,
+    0.12857142857142856, 0.12857142857142856, 0.11428571428571432, 0.11428571428571432,
+    0.15714285714285714, 0.30000000000000004, 0.3928571428571429, 0.41428571428571426,
+    0.44999999999999996, 0.55, 0.6785714285714286, 0.7, 0.6928571428571428,
+    0.5357142857142857, 0.55, 0.5428571428571429, 0.5285714285714286, 0.5285714285714286,
+    0.5142857142857142, 0.5, 0.4571428571428572, 0.4571428571428572, 0.4571428571428572,
+    0.4571428571428572, 0.4571428571428572, 0.4571428571428572, 0.4571428571428572,
+    0.4571428571428572, 0.4571428571428572, 0.4571428571428572, 0.5, 0.5071428571428571,
+    0.4214285714285714, 0.5071428571428571, 0.5642857142857143, 0.6357142857142857,
+    0.6642857142857144, 0.6785714285714286, 0.6785714285714286, 0.6785714285714286,
+    0.6785714285714286, 0.6785714285714286, 0.6785714285714286, 0.6785714285714286,
+    0.4714285714285714, 0.4714285714285714, 0.4571428571428572, 0.4571428571428572,
+    0.4571428571428572, 0.4571428571428572, 0.4571428571428572, 0.6420918328421457,
+    0.4571428571428572, 0.4571428571428572, 0.4571428571428572, 0.4571428571428572,
+    0.40714285714285714, 0.40714285714285714, 0.40714285714285714, 0.4285714285714286,
+    0.5, 0.47857142857142854, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 0.4980000853538513, 1.0, 1.0, 0.05, 1.0, 1.0, 0.13760901425650426,
+    0.0, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+  // Boing
+  {{
+    0.4, 0.39770409720284594, 0.3931122371128627, 0.38852037702287945,
+    0.3839285169328962, 0.37933665684291296, 0.3747447967529297, 0.37015293666294646,
+    0.3655610765729632, 0.36096921648297986, 0.3563773563929966, 0.35178549630301337,
+    0.3471936362130301, 0.3426017761230469, 0.33800991603306363, 0.33571428571428574,
+    0.55, 0.5622449057442802, 0.5867346899850028, 0.6112244742257255, 0.6357142584664481,
+    0.6602040427071707, 0.6846938269478935, 0.7091836111886161, 0.7336733954293387,
+    0.7581631796700614, 0.7826529502868652, 0.8071427481515067, 0.8316325460161482,
+    0.8561223438807897, 0.8806121417454311, 0.8928571428571429, 0.5785714285714285,
+    0.5872449057442801, 0.6045918328421456, 0.6219387599400112, 0.6392856870378767,
+    0.6566326141357421, 0.6739795412336077, 0.6913264683314733, 0.7086733954293387,
+    0.7260203225272042, 0.7433672496250698, 0.7607141767229353, 0.778061090196882,
+    0.7954080309186663, 0.8127549716404506, 0.8214285714285714, 0.55, 0.4571428571428572,
+    0.41428571428571426, 0.41428571428571426, 0.41428571428571426, 0.44285714285714284,
+    0.4571428571428572, 0.4571428571428572, 0.4714285714285714, 0.4714285714285714,
+    0.4714285714285714, 0.4714285714285714, 0.48571428571428577, 0.48571428571428577,
+    0.5285714285714286, 0.5357142857142857, 0.5785714285714285, 0.5788265228271484,
+    0.5793367385864258, 0.5798469543457031, 0.5803571701049804, 0.5808673858642578,
+    0.5813776016235351, 0.5818878173828125, 0.5823980331420898, 0.5829082489013672,
+    0.5834184646606445, 0.5839286804199219, 0.5844388961791992, 0.5849491119384765,
+    0.5854593276977539, 0.5857142857142856, 0.4214285714285714, 0.41505099705287385,
+    0.402295902797154, 0.38954080854143414, 0.3767857142857143, 0.3640306200299944,
+    0.35127552577427457, 0.3385204315185547, 0.32576533726283485, 0.313010243007115,
+    0.30025514875139514, 0.2875000544956752, 0.2747449602399553, 0.26198986598423546,
+    0.2492347717285156, 0.24285714285714288, 0.07857142857142863, 0.07831627982003353,
+    0.07780609130859373, 0.07729590279715404, 0.07678571428571423, 0.07627552577427454,
+    0.07576533726283485, 0.07525514875139505, 0.07474496023995536, 0.07423477172851567,
+    0.07372458321707587, 0.07321439470563618, 0.07270420619419637, 0.07219401768275668,
+    0.07168382917131699, 0.0714285714285714, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.05, 1.0, 1.0,
+    0.13760901425650426, 0.0, 0.5, 0.5, 0.5199999809265137, 0.5, 0,
+  }},
+  // ColdPlace
+  {{
+    0.30000000000000004, 0.3119898114885603, 0.33596937997000553, 0.35994894845145087,
+    0.3839285169328962, 0.40790808541434154, 0.43188765389578687, 0.4558672223772321,
+    0.47984679085867743, 0.5038263593401228, 0.5278059278215681, 0.5517854690551758,
+    0.5757650647844588, 0.5997446605137416, 0.6237242562430245, 0.6357142857142857,
+    0.48571428571428577, 0.15000000000000002, 0.8857142857142857, 0.9,
+    0.8857142857142857, 0.2785714285714286, 0.2571428571428571, 0.2857142857142857,
+    0.37142857142857144, 0.40714285714285714, 0.8928571428571429, 0.8857142857142857,
+    0.8785714285714286, 0.5, 0.41428571428571426, 0.41428571428571426,
+    0.5142857142857142, 0.11428571428571432, 0.11428571428571432, 0.12857142857142856,
+    0.16428571428571426, 0.85, 0.6428571428571428, 0.5642857142857143, 0.55,
+    0.16428571428571426, 0.16428571428571426, 0.3285714285714286, 0.2857142857142857,
+    0.23571428571428577, 0.2142857142857143, 0.16428571428571426, 0.3214285714285714,
+    0.6, 0.9214285714285715, 0.2857142857142857, 0.6142857142857143, 0.3928571428571429,
+    0.75, 0.2857142857142857, 0.4714285714285714, 0.6, 0.6642857142857144,
+    0.3642857142857143, 0.30714285714285716, 0.5714285714285714, 0.4571428571428572,
+    0.6785714285714286, 0.3642857142857143, 0.3214285714285714, 0.3642857142857143,
+    0.4928571428571429, 0.5785714285714285, 0.5857142857142856, 0.40714285714285714,
+    0.34285714285714286, 0.3285714285714286, 0.3285714285714286, 0.5214285714285714,
+    0.4714285714285714, 0.44285714285714284, 0.4285714285714286, 0.3928571428571429,
+    0.3928571428571429, 0.4714285714285714, 0.44999999999999996, 0.47857142857142854,
+    0.4714285714285714, 0.48571428571428577, 0.5214285714285714, 0.4642857142857143,
+    0.4571428571428572, 0.41428571428571426, 0.4, 0.3857142857142857, 0.3857142857142857,
+    0.3857142857142857, 0.3857142857142857, 0.3857142857142857, 0.3857142857142857, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    0.4980000853538513, 1.0, 1.0, 0.05, 1.0, 1.0, 0.13760901425650426, 0.0, 0.5, 0.5,
+    0.5, 0.5, 0,
+  }},
+  // Damped
+  {{
+    0.18571428571428572, 0.26428571428571423, 0.2142857142857143, 0.23571428571428577,
+    0.2785714285714286, 0.3214285714285714, 0.3571428571428571, 0.3857142857142857,
+    0.41428571428571426, 0.4285714285714286, 0.4642857142857143, 0.4928571428571429,
+    0.5357142857142857, 0.55, 0.5714285714285714, 0.5714285714285714, 0.7571428571428571,
+    0.7571428571428571, 0.7571428571428571, 0.7571428571428571, 0.7571428571428571,
+    0.7571428571428571, 0.7714285714285715, 0.7857142857142857, 0.8357142857142857,
+    0.8357142857142857, 0.8357142857142857, 0.8357142857142857, 0.8357142857142857,
+    0.8357142857142857, 0.8357142857142857, 0.8357142857142857, 0.05714285714285716,
+    0.2142857142857143, 0.15000000000000002, 0.11428571428571432, 0.09285714285714286,
+    0.0714285714285714, 0.0714285714285714, 0.09999999999999998, 0.09999999999999998,
+    0.12857142857142856, 0.1428571428571429, 0.1428571428571429, 0.1428571428571429,
+    0.1428571428571429, 0.1428571428571429, 0.1428571428571429, 0.5428571428571429,
+    0.5928571428571429, 0.5285714285714286, 0.7142857142857143, 0.5357142857142857,
+    0.7214285714285714, 0.4642857142857143, 0.4357142857142857, 0.41428571428571426,
+    0.5928571428571429, 0.5714285714285714, 0.33571428571428574, 0.5785714285714285,
+    0.6785714285714286, 0.5642857142857143, 0.3642857142857143, 0.55, 0.4571428571428572,
+    0.22857142857142854, 0.6214285714285714, 0.17142857142857137, 0.6785714285714286,
+    0.7285714285714286, 0.6142857142857143, 0.44999999999999996, 0.3571428571428571,
+    0.27142857142857146, 0.2571428571428571, 0.3214285714285714, 0.5428571428571429,
+    0.7142857142857143, 0.6571428571428571, 0.5214285714285714, 0.35,
+    0.22857142857142854, 0.20714285714285718, 0.20714285714285718, 0.2571428571428571,
+    0.5571428571428572, 0.6071428571428572, 0.5071428571428571, 0.6928571428571428,
+    0.5214285714285714, 0.3928571428571429, 0.40714285714285714, 0.4714285714285714,
+    0.5642857142857143, 0.5357142857142857, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.47857142857142854, 0.5928571428571429,
+    0.7214285714285714, 0.7357142857142858, 0.7071428571428571, 0.6785714285714286,
+    0.6357142857142857, 0.6071428571428572, 0.6071428571428572, 0.6285714285714286,
+    0.5642857142857143, 0.4571428571428572, 0.40714285714285714, 0.40714285714285714,
+    0.3857142857142857, 0.3642857142857143, 1.0, 1.0, 1.0, 0.05, 1.0, 1.0,
+    0.35560888051986694, 0.0, 0.5, 0.5, 0.7120000123977661, 0.5, 0,
+  }},
+  // HappyLittleTrees
+  {{
+    0.4642857142857143, 0.4540816170828683, 0.43367347717285154, 0.4132653372628349,
+    0.3928571973528181, 0.3724490574428013, 0.35204091753278455, 0.3316327776227679,
+    0.3112246377127511, 0.29081649780273433, 0.27040835789271767, 0.2500002179827009,
+    0.2295920780726841, 0.20918393816266745, 0.18877579825265067, 0.1785714285714286,
+    0.5357142857142857, 0.525, 0.5035714285714286, 0.4821428571428571,
+    0.46071428571428574, 0.4392857142857143, 0.4178571428571428, 0.39642857142857146,
+    0.375, 0.35357142857142854, 0.3321428571428572, 0.3107142857142857,
+    0.28928571428571426, 0.2678571428571429, 0.24642857142857144, 0.23571428571428577,
+    0.09999999999999998, 0.7928571428571428, 0.7928571428571428, 0.6773809160505022,
+    0.7928571428571428, 0.639030647277832, 0.6048469815935407, 0.5706633159092495,
+    0.5364796229771205, 0.5022959572928292, 0.46811229160853796, 0.43392862592424664,
+    0.3997449602399553, 0.3655612945556641, 0.3313776288713728, 0.3142857142857143,
+    0.12857142857142856, 0.13571428571428568, 0.2142857142857143, 0.2857142857142857,
+    0.3142857142857143, 0.3642857142857143, 0.3928571428571429, 0.3928571428571429,
+    0.3928571428571429, 0.3857142857142857, 0.3571428571428571, 0.3285714285714286,
+    0.3214285714285714, 0.27142857142857146, 0.2571428571428571, 0.4571428571428572, 0.5,
+    0.5071428571428571, 0.4214285714285714, 0.5071428571428571, 0.5642857142857143,
+    0.6357142857142857, 0.6642857142857144, 0.6785714285714286, 0.6785714285714286,
+    0.6785714285714286, 0.6785714285714286, 0.6785714285714286, 0.6785714285714286,
+    0.6785714285714286, 0.4714285714285714, 0.4714285714285714, 0.4571428571428572,
+    0.4571428571428572, 0.4571428571428572, 0.4571428571428572, 0.4571428571428572,
+    0.6420918328421457, 0.4571428571428572, 0.4571428571428572, 0.4571428571428572,
+    0.4571428571428572, 0.40714285714285714, 0.40714285714285714, 0.40714285714285714,
+    0.4285714285714286, 0.5, 0.47857142857142854, 0.7428571428571429, 0.2785714285714286,
+    0.2851648603166853, 0.29835166931152346, 0.3115384783063616, 0.32472528730119976,
+    0.3379120962960379, 0.35109890529087606, 0.3642857142857143, 0.3774725232805525,
+    0.3906593322753906, 0.4038461412702288, 0.4170329502650669, 0.4302197592599052,
+    0.44340656825474334, 0.44999999999999996, 1.0, 0.40714285714285714,
+    0.48571428571428577, 0.5571428571428572, 0.5714285714285714, 0.6285714285714286,
+    0.6785714285714286, 0.7071428571428571, 0.6285714285714286, 0.5928571428571429, 0.55,
+    0.4642857142857143, 0.40714285714285714, 0.3928571428571429, 0.34285714285714286,
+    0.3142857142857143, 0.4980000853538513, 1.0, 1.0, 0.05, 1.0, 1.0,
+    0.13760901425650426, 0.0, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+  // Interleave
+  {{
+    0.26428571428571423, 0.24285714285714288, 0.24285714285714288, 0.2785714285714286,
+    0.34285714285714286, 0.3857142857142857, 0.4714285714285714, 0.5214285714285714,
+    0.5928571428571429, 0.6071428571428572, 0.6142857142857143, 0.6285714285714286,
+    0.44999999999999996, 0.4285714285714286, 0.37857142857142856, 0.3214285714285714,
+    0.6785714285714286, 0.25, 0.7928571428571428, 0.30714285714285716, 0.8,
+    0.2928571428571428, 0.6846938269478935, 0.22142857142857142, 0.7336733954293387,
+    0.26428571428571423, 0.7826529502868652, 0.2142857142857143, 0.8316325460161482,
+    0.22142857142857142, 0.8806121417454311, 0.2142857142857143, 0.18571428571428572,
+    0.8928571428571429, 0.16428571428571426, 0.9071428571428571, 0.15000000000000002,
+    0.85, 0.1785714285714286, 0.8857142857142857, 0.20714285714285718,
+    0.7260203225272042, 0.1785714285714286, 0.7607141767229353, 0.20714285714285718,
+    0.7954080309186663, 0.27142857142857146, 0.8214285714285714, 0.8357142857142857,
+    0.19999999999999996, 0.7214285714285714, 0.27142857142857146, 0.6571428571428571,
+    0.33571428571428574, 0.6071428571428572, 0.41428571428571426, 0.5571428571428572,
+    0.37142857142857144, 0.6571428571428571, 0.3142857142857143, 0.7357142857142858,
+    0.2857142857142857, 0.8357142857142857, 0.1785714285714286, 0.5285714285714286,
+    0.4571428571428572, 0.5714285714285714, 0.4214285714285714, 0.6, 0.4,
+    0.6357142857142857, 0.37142857142857144, 0.6714285714285715, 0.3571428571428571,
+    0.7428571428571429, 0.2785714285714286, 0.7928571428571428, 0.22857142857142854,
+    0.8285714285714285, 0.17142857142857137, 0.4571428571428572, 0.6, 0.402295902797154,
+    0.5785714285714285, 0.3767857142857143, 0.5785714285714285, 0.3928571428571429,
+    0.5857142857142856, 0.4285714285714286, 0.6428571428571428, 0.41428571428571426, 0.6,
+    0.37142857142857144, 0.6214285714285714, 0.41428571428571426, 0.6214285714285714,
+    0.19285714285714284, 0.19107142857142856, 0.1875, 0.18392857142857144,
+    0.18035714285714288, 0.17678571428571432, 0.17321428571428577, 0.1696428571428571,
+    0.16607142857142854, 0.16249999999999998, 0.15892857142857142, 0.15535714285714286,
+    0.1517857142857143, 0.14821428571428574, 0.14464285714285718, 0.1428571428571429,
+    0.44999999999999996, 1.0, 0.5142857142857142, 1.0, 0.6571428571428571, 1.0,
+    0.7857142857142857, 1.0, 0.7571428571428571, 1.0, 0.6785714285714286, 1.0,
+    0.5714285714285714, 1.0, 0.5714285714285714, 1.0, 1.0, 1.0, 1.0, 0.05, 1.0, 1.0,
+    0.539608895778656, 0.0, 0.5, 0.5, 0.5199999809265137, 0.5, 0,
+  }},
+  // LateToParty
+  {{
+    0.16428571428571426, 0.22142857142857142, 0.24285714285714288, 0.24285714285714288,
+    0.5714285714285714, 0.6142857142857143, 0.6714285714285715, 0.7357142857142858,
+    0.7642857142857142, 0.7785714285714286, 0.7428571428571429, 0.6857142857142857,
+    0.6214285714285714, 0.5642857142857143, 0.48571428571428577, 0.4357142857142857,
+    0.3928571428571429, 0.3928571428571429, 0.40714285714285714, 0.40714285714285714,
+    0.4285714285714286, 0.4285714285714286, 0.40145992221164334, 0.4285714285714286,
+    0.4285714285714286, 0.4285714285714286, 0.6071428571428572, 0.6357142857142857,
+    0.6857142857142857, 0.6857142857142857, 0.6857142857142857, 0.6857142857142857,
+    0.12142857142857144, 0.22857142857142854, 0.22857142857142854, 0.26428571428571423,
+    0.37142857142857144, 0.6285714285714286, 0.6714285714285715, 0.6714285714285715,
+    0.6642857142857144, 0.65, 0.65, 0.65, 0.65, 0.6428571428571428, 0.5714285714285714,
+    0.55, 0.5357142857142857, 0.5785714285714285, 0.6071428571428572, 0.6071428571428572,
+    0.6071428571428572, 0.6, 0.5, 0.4214285714285714, 0.3642857142857143,
+    0.3142857142857143, 0.3142857142857143, 0.3142857142857143, 0.3142857142857143,
+    0.3142857142857143, 0.4, 0.6214285714285714, 0.9077618181021228, 0.21355070333919868,
+    0.35819787461124986, 0.242874848814988, 0.7132529709724198, 0.877701334455369,
+    0.8373704530395507, 0.5348530419535192, 0.65, 0.22142857142857142,
+    0.2785714285714286, 0.2928571428571428, 0.43378608525218937, 0.4887122970104089,
+    0.6928571428571428, 0.7142857142857143, 0.8613785057259497, 0.6372324926603804,
+    0.21828763949627672, 0.5377589691842053, 0.9046775175613491, 0.7174356533155044,
+    0.20468929630144594, 0.8939253268242326, 0.4739514413765647, 0.09612098069068353,
+    0.5595606928599709, 0.28801715396624294, 0.7029637336538773, 0.21038964815305616,
+    0.2700431931030437, 0.91490279961712, 0.0, 0.0, 0.0, 0.0, 0.0, 0.3142857142857143,
+    0.3142857142857143, 0.27142857142857146, 0.2571428571428571, 0.2571428571428571,
+    0.2571428571428571, 0.2571428571428571, 0.2857142857142857, 0.3642857142857143, 0.4,
+    0.4214285714285714, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.05, 0.28799980878829956, 1.0, 0.13760901425650426,
+    0.0, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+  // LongLongReverb
+  {{
+    0.4285714285714286, 0.4771428789411273, 0.5742856979370117, 0.6714285441807338,
+    0.7685713904244559, 0.8657142639160156, 0.9142857142857143, 0.5239010947091238,
+    0.5750000272478376, 0.6260989325387137, 0.6771978378295899, 0.7282967431204659,
+    0.779395648411342, 0.8304945537022181, 0.8815934589930943, 0.9071428571428571,
+    0.44999999999999996, 0.2571428571428571, 0.25, 0.25, 0.25, 0.2785714285714286,
+    0.2785714285714286, 0.2785714285714286, 0.2785714285714286, 0.2857142857142857,
+    0.34285714285714286, 0.3642857142857143, 0.4357142857142857, 0.5214285714285714,
+    0.8571428571428572, 0.8714285714285714, 0.41428571428571426, 0.9142857142857143,
+    0.09285714285714286, 0.07857142857142863, 0.07857142857142863, 0.07857142857142863,
+    0.13571428571428568, 0.16428571428571426, 0.20714285714285718, 0.4357142857142857,
+    0.2142857142857143, 0.25, 0.8785714285714286, 0.8785714285714286, 0.8857142857142857,
+    0.8857142857142857, 0.40714285714285714, 0.24285714285714288, 0.4357142857142857,
+    0.6357142857142857, 0.6428571428571428, 0.5142857142857142, 0.3571428571428571,
+    0.3142857142857143, 0.27142857142857146, 0.2571428571428571, 0.2571428571428571,
+    0.2571428571428571, 0.3214285714285714, 0.6, 0.6142857142857143, 0.5714285714285714,
+    0.09285714285714286, 0.12142857142857144, 0.22142857142857142, 0.27142857142857146,
+    0.4357142857142857, 0.5571428571428572, 0.65, 0.7428571428571429, 0.8071428571428572,
+    0.8214285714285714, 0.8214285714285714, 0.5142857142857142, 0.22857142857142854,
+    0.19999999999999996, 0.17142857142857137, 0.12142857142857144, 0.22142857142857142,
+    0.11428571428571432, 0.2142857142857143, 0.3642857142857143, 0.6, 0.85,
+    0.7785714285714286, 0.5214285714285714, 0.3571428571428571, 0.27142857142857146,
+    0.25, 0.25, 0.8571428571428572, 0.7642857142857142, 0.6214285714285714,
+    0.40714285714285714, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 0.05, 1.0, 1.0, 0.13760901425650426, 0.0, 0.5, 0.5,
+    0.9079999327659607, 0.5, 0,
+  }},
+  // MessingUp
+  {{
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.6,
+    0.5, 0.3642857142857143, 0.5, 0.6428571428571428, 0.5, 0.34285714285714286, 0.5,
+    0.75, 0.5, 0.3857142857142857, 0.5, 0.65, 0.5, 0.37857142857142856, 0.5,
+    0.3214285714285714, 0.5, 0.6642857142857144, 0.5, 0.4, 0.5, 0.6642857142857144, 0.5,
+    0.4214285714285714, 0.5, 0.6714285714285715, 0.5, 0.4285714285714286, 0.5,
+    0.6714285714285715, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.6571428571428571, 0.6568877628871372, 0.6563775471278599,
+    0.6558673313685826, 0.6553571156093052, 0.6548468998500279, 0.6543366840907505,
+    0.6538264683314732, 0.6533162525721958, 0.6528060368129185, 0.6522958210536411,
+    0.6517856052943638, 0.6512753895350865, 0.6507651737758091, 0.6502549580165318, 0.65,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 0.05, 1.0, 1.0, 1.0, 0.04399999976158142, 0.5, 0.12400007992982864,
+    0.6240001320838928, 0.5, 0,
+  }},
+  // ModulateTimeBaseMultiplier
+  {{
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    0.30714285714285716, 0.25393696988826947, 0.3723134445750581, 0.36576594583931643,
+    0.2577275040991525, 0.8921630722481981, 0.42291514898418625, 0.10896908669067551,
+    0.2621409051567597, 0.1746882911800416, 0.5785781098092331, 0.3713614293559621,
+    0.5992788142819261, 0.06775594074964142, 0.19735509388502537, 0.8603813692016752,
+    0.3299965056038226, 0.7371183919947024, 0.8232061019493677, 0.7404932510590917,
+    0.4144362849553338, 0.0572060381079601, 0.0456307127938963, 0.30157553245328217,
+    0.30167998886402664, 0.5330366237741656, 0.33666448539963845, 0.34254700232312446,
+    0.8412908509413897, 0.43002028589095387, 0.48017486940622145, 0.9405026029941623,
+    0.7620660833443672, 0.432461379638106, 0.95, 0.95, 0.4285190533075047,
+    0.6673220935845844, 0.03998924455522401, 0.14947420912239529, 0.7346476454371598,
+    0.8493904500140603, 0.05450639543800834, 0.6319840817899999, 0.19657564416270967,
+    0.023222797204960455, 0.9714285714285714, 0.054761271996385474, 0.5764444907068175,
+    0.7145040382502114, 0.5812514392971732, 0.16218506608762173, 0.09261495986804885,
+    0.6481417271192212, 0.7648890994881081, 0.9334440286901761, 0.386186265201112,
+    0.3633188314533362, 0.08996277440925804, 0.4081307918986946, 0.3246835347341445,
+    0.5063827446711069, 0.6369180734560923, 0.6553394312836199, 0.8556530349262427,
+    0.9188989724291281, 0.17142857142857137, 0.4249003478222929, 0.8642522825972677,
+    0.2038793246563495, 0.3518677734110942, 0.48954301245537946, 0.9004532110019392,
+    0.5372916359463404, 0.7937950158320802, 0.13050601575127302, 0.3230239990469168,
+    0.5808693259685441, 0.48515429320767534, 0.318161345501745, 0.2571428571428571, 0.25,
+    0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25, 0.25,
+    0.23571428571428577, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 0.4980000853538513, 1.0, 1.0, 0.05, 0.4920000433921814,
+    0.3799998462200165, 0.13760901425650426, 0.0, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+  // NoisyModulation
+  {{
+    0.19285714285714284, 0.1785714285714286, 0.2142857142857143, 0.27142857142857146,
+    0.33571428571428574, 0.3571428571428571, 0.4, 0.4285714285714286, 0.4642857142857143,
+    0.5, 0.5357142857142857, 0.5571428571428572, 0.5857142857142856, 0.6071428571428572,
+    0.6071428571428572, 0.6071428571428572, 0.6642857142857144, 0.6642857142857144,
+    0.6642857142857144, 0.6642857142857144, 0.65, 0.6428571428571428, 0.6,
+    0.5928571428571429, 0.5928571428571429, 0.5928571428571429, 0.5928571428571429,
+    0.5928571428571429, 0.5928571428571429, 0.5928571428571429, 0.5928571428571429,
+    0.5928571428571429, 0.11428571428571432, 0.11428571428571432, 0.11428571428571432,
+    0.11428571428571432, 0.11428571428571432, 0.11428571428571432, 0.1428571428571429,
+    0.19285714285714284, 0.24285714285714288, 0.24285714285714288, 0.24285714285714288,
+    0.24285714285714288, 0.24285714285714288, 0.24285714285714288, 0.24285714285714288,
+    0.24285714285714288, 0.33571428571428574, 0.3928571428571429, 0.4214285714285714,
+    0.44285714285714284, 0.44285714285714284, 0.47857142857142854, 0.47857142857142854,
+    0.47857142857142854, 0.47857142857142854, 0.47857142857142854, 0.47857142857142854,
+    0.47857142857142854, 0.47857142857142854, 0.5, 0.4714285714285714,
+    0.41428571428571426, 0.5, 0.44285714285714284, 0.44285714285714284,
+    0.44285714285714284, 0.44285714285714284, 0.4642857142857143, 0.5142857142857142,
+    0.5428571428571429, 0.5571428571428572, 0.6214285714285714, 0.6357142857142857,
+    0.6785714285714286, 0.6785714285714286, 0.6785714285714286, 0.6214285714285714,
+    0.4928571428571429, 0.3142857142857143, 0.3857142857142857, 0.5428571428571429, 0.7,
+    0.7714285714285715, 0.7714285714285715, 0.7714285714285715, 0.7714285714285715,
+    0.7357142857142858, 0.5928571428571429, 0.4571428571428572, 0.3928571428571429, 0.35,
+    0.33571428571428574, 0.3142857142857143, 0.2857142857142857, 0.37142857142857144,
+    0.3142857142857143, 0.27142857142857146, 0.26428571428571423, 0.23571428571428577,
+    0.2142857142857143, 0.19999999999999996, 0.17142857142857137, 0.15714285714285714,
+    0.12857142857142856, 0.12857142857142856, 0.12857142857142856, 0.12857142857142856,
+    0.12857142857142856, 0.12857142857142856, 0.12857142857142856, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.05, 1.0,
+    1.0, 0.8096089363098145, 0.04399999976158142, 0.5, 0.11600007861852646,
+    0.64000004529953, 0.5, 0,
+  }},
+  // PerhapsHall
+  {{
+    0.2571428571428571, 0.2785714285714286, 0.30714285714285716, 0.3142857142857143,
+    0.3285714285714286, 0.37142857142857144, 0.37142857142857144, 0.37142857142857144,
+    0.37142857142857144, 0.37857142857142856, 0.3928571428571429, 0.4,
+    0.4357142857142857, 0.44999999999999996, 0.4571428571428572, 0.48571428571428577,
+    0.19285714285714284, 0.2142857142857143, 0.27142857142857146, 0.4,
+    0.4571428571428572, 0.5357142857142857, 0.6714285714285715, 0.7142857142857143,
+    0.7571428571428571, 0.7714285714285715, 0.7714285714285715, 0.7285714285714286,
+    0.6714285714285715, 0.6214285714285714, 0.5785714285714285, 0.5071428571428571, 0.25,
+    0.22857142857142854, 0.22857142857142854, 0.22857142857142854, 0.25,
+    0.7142857142857143, 0.2928571428571428, 0.3571428571428571, 0.40714285714285714,
+    0.8214285714285714, 0.4571428571428572, 0.5214285714285714, 0.5714285714285714,
+    0.5857142857142856, 0.6, 0.6, 0.19999999999999996, 0.2142857142857143, 0.35,
+    0.48571428571428577, 0.6214285714285714, 0.6357142857142857, 0.6071428571428572,
+    0.47857142857142854, 0.40714285714285714, 0.3857142857142857, 0.3857142857142857,
+    0.3857142857142857, 0.3857142857142857, 0.3857142857142857, 0.4214285714285714, 0.5,
+    0.5857142857142856, 0.7071428571428571, 0.75, 0.7785714285714286, 0.7785714285714286,
+    0.65, 0.3857142857142857, 0.3642857142857143, 0.3642857142857143,
+    0.37142857142857144, 0.41428571428571426, 0.44285714285714284, 0.5357142857142857,
+    0.5785714285714285, 0.5928571428571429, 0.5928571428571429, 0.5, 0.5,
+    0.4642857142857143, 0.6357142857142857, 0.6928571428571428, 0.7071428571428571,
+    0.7071428571428571, 0.6714285714285715, 0.5571428571428572, 0.5357142857142857,
+    0.5357142857142857, 0.5357142857142857, 0.5357142857142857, 0.5357142857142857,
+    0.5142857142857142, 0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.05, 1.0, 1.0, 0.13760901425650426, 0.0, 0.5, 0.5,
+    0.5199999809265137, 0.5, 0,
+  }},
+  // Pipe
+  {{
+    0.2142857142857143, 0.2142857142857143, 0.22142857142857142, 0.22857142857142854,
+    0.22857142857142854, 0.22857142857142854, 0.22857142857142854, 0.22857142857142854,
+    0.22857142857142854, 0.22857142857142854, 0.24285714285714288, 0.24285714285714288,
+    0.24285714285714288, 0.24285714285714288, 0.22857142857142854, 0.22857142857142854,
+    0.12142857142857144, 0.4285714285714286, 0.5, 0.6285714285714286, 0.6857142857142857,
+    0.8285714285714285, 0.4928571428571429, 0.7928571428571428, 0.4928571428571429,
+    0.48571428571428577, 0.48571428571428577, 0.48571428571428577, 0.48571428571428577,
+    0.7285714285714286, 0.48571428571428577, 0.5142857142857142, 0.4285714285714286,
+    0.3214285714285714, 0.7285714285714286, 0.6214285714285714, 0.4571428571428572,
+    0.37857142857142856, 0.3214285714285714, 0.3214285714285714, 0.3214285714285714,
+    0.37857142857142856, 0.4642857142857143, 0.5642857142857143, 0.5928571428571429,
+    0.5928571428571429, 0.5357142857142857, 0.5571428571428572, 0.6857142857142857,
+    0.4928571428571429, 0.6285714285714286, 0.7285714285714286, 0.7285714285714286,
+    0.7285714285714286, 0.7642857142857142, 0.6357142857142857, 0.5928571428571429,
+    0.5642857142857143, 0.5357142857142857, 0.5214285714285714, 0.5, 0.44285714285714284,
+    0.40714285714285714, 0.40714285714285714, 0.5, 0.6214285714285714,
+    0.5428571428571429, 0.4357142857142857, 0.40714285714285714, 0.40714285714285714,
+    0.40714285714285714, 0.4357142857142857, 0.5142857142857142, 0.6142857142857143,
+    0.6571428571428571, 0.6857142857142857, 0.6857142857142857, 0.6571428571428571, 0.6,
+    0.5428571428571429, 0.7785714285714286, 0.44999999999999996, 0.47857142857142854,
+    0.4714285714285714, 0.4214285714285714, 0.3928571428571429, 0.3928571428571429,
+    0.3928571428571429, 0.3928571428571429, 0.3928571428571429, 0.41428571428571426,
+    0.48571428571428577, 0.5428571428571429, 0.7785714285714286, 0.6428571428571428,
+    0.6214285714285714, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0, 0.6785714285714286, 0.55, 0.37142857142857144,
+    0.2928571428571428, 0.2928571428571428, 0.26428571428571423, 0.26428571428571423,
+    0.7642857142857142, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.05, 1.0, 1.0,
+    0.13760901425650426, 0.04399999976158142, 0.5, 0.11600007861852646, 0.64000004529953,
+    0.5, 0,
+  }},
+  // R2L
+  {{
+    0.7285714285714286, 0.7102040699550083, 0.6734693799700056, 0.6367346899850028, 0.6,
+    0.5632653100149971, 0.5265306200299944, 0.4897959572928292, 0.4530612400599888,
+    0.41632652282714844, 0.37959180559430805, 0.34285708836146767, 0.3061223711286273,
+    0.2693876538957868, 0.2326529366629464, 0.2142857142857143, 0.8857142857142857,
+    0.8632653100149972, 0.8183673449925014, 0.7734693799700056, 0.7285714285714286,
+    0.6836734771728515, 0.6387755257742745, 0.5938775743756975, 0.5489796229771206,
+    0.5040816170828684, 0.45918366568429125, 0.41428571428571426, 0.36938776288713726,
+    0.32448981148856026, 0.27959186008998327, 0.2571428571428571, 0.8642857142857143,
+    0.84056122643607, 0.7931122507367815, 0.7456632614135742, 0.6982142857142857,
+    0.6507653100149973, 0.6033163343157086, 0.5558673586164202, 0.5084183829171317,
+    0.46096937997000553, 0.41352037702287947, 0.3660713740757533, 0.31862237112862724,
+    0.27117336818150106, 0.223724365234375, 0.19999999999999996, 0.8428571428571429,
+    0.8153061185564314, 0.7602040699550083, 0.7051020213535855, 0.6499999727521624,
+    0.5948979241507394, 0.539795902797154, 0.4846938541957311, 0.429591805594308,
+    0.374489756992885, 0.319387708391462, 0.26428565979003904, 0.20918361118861606,
+    0.15408156258719308, 0.0989795139857701, 0.0714285714285714, 0.7928571428571428,
+    0.7709183556692941, 0.7270408085414342, 0.6831632614135742, 0.6392857142857142,
+    0.5954081671578544, 0.5515306200299944, 0.5076531001499721, 0.4637755257742745,
+    0.419897951398577, 0.3760203770228795, 0.3321428026471819, 0.2882652282714844,
+    0.24438765389578687, 0.20051007952008926, 0.1785714285714286, 0.8785714285714286,
+    0.8522959164210728, 0.7997448921203614, 0.7471938814435686, 0.6946428571428571,
+    0.6420918328421457, 0.5895408085414342, 0.536989756992885, 0.4844387599400112,
+    0.43188776288713726, 0.37933676583426335, 0.32678576878138954, 0.2742347717285156,
+    0.2216837746756417, 0.1691327776227679, 0.1428571428571429, 0.16428571428571426,
+    0.1599490029471261, 0.1512755257742745, 0.142602048601423, 0.1339285714285714,
+    0.1252550942557199, 0.1165816170828683, 0.10790813991001669, 0.09923466273716519,
+    0.09056118556431358, 0.08188770839146209, 0.07321417672293529, 0.06454075404575887,
+    0.05586733136858257, 0.04719390869140627, 0.042857142857142816, 0.8928571428571429,
+    0.8660714285714286, 0.8125, 0.7589285714285714, 0.7053571428571428,
+    0.6517857142857143, 0.5982142857142857, 0.5446428571428572, 0.4910714285714286,
+    0.4375, 0.3839285714285714, 0.3303571428571429, 0.2767857142857143,
+    0.2232142857142857, 0.1696428571428571, 0.1428571428571429, 0.4980000853538513, 1.0,
+    1.0, 0.05, 0.4920000433921814, 0.3799998462200165, 0.13760901425650426,
+    0.4920000433921814, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+  // RightBehind
+  {{
+    0.22857142857142854, 0.17142857142857137, 0.13571428571428568, 0.1071428571428571,
+    0.08571428571428574, 0.08571428571428574, 0.08571428571428574, 0.08571428571428574,
+    0.09999999999999998, 0.09999999999999998, 0.09999999999999998, 0.12857142857142856,
+    0.15714285714285714, 0.20714285714285718, 0.25, 0.2928571428571428,
+    0.3642857142857143, 0.3214285714285714, 0.3214285714285714, 0.2597806830841498,
+    0.9599488472700328, 0.05763539520245953, 0.40145992221164334, 0.6987668512764651,
+    0.8728516229208492, 0.7936002050841053, 0.9517959771352608, 0.6869304241480849,
+    0.28967534491900837, 0.4768554408479598, 0.8569947995613796, 0.20714285714285718,
+    0.12142857142857144, 0.07857142857142863, 0.0714285714285714, 0.050000000000000044,
+    0.08571428571428574, 0.4571428571428572, 0.4285714285714286, 0.4642857142857143,
+    0.5785714285714285, 0.6428571428571428, 0.6571428571428571, 0.6571428571428571,
+    0.6571428571428571, 0.6357142857142857, 0.8642857142857143, 0.9142857142857143, 0.25,
+    0.25, 0.2857142857142857, 0.3142857142857143, 0.3642857142857143,
+    0.40714285714285714, 0.4642857142857143, 0.4928571428571429, 0.5571428571428572,
+    0.5571428571428572, 0.55, 0.55, 0.5642857142857143, 0.5785714285714285,
+    0.6214285714285714, 0.6214285714285714, 0.9077618181021228, 0.21355070333919868,
+    0.35819787461124986, 0.242874848814988, 0.7132529709724198, 0.877701334455369,
+    0.8373704530395507, 0.5348530419535192, 0.65, 0.22142857142857142,
+    0.2785714285714286, 0.2928571428571428, 0.43378608525218937, 0.4887122970104089,
+    0.6928571428571428, 0.7142857142857143, 0.8613785057259497, 0.6372324926603804,
+    0.21828763949627672, 0.5377589691842053, 0.9046775175613491, 0.7174356533155044,
+    0.20468929630144594, 0.8939253268242326, 0.4739514413765647, 0.09612098069068353,
+    0.5595606928599709, 0.28801715396624294, 0.7029637336538773, 0.21038964815305616,
+    0.2700431931030437, 0.91490279961712, 0.12857142857142856, 0.134693854195731,
+    0.14693875994001115, 0.15918366568429132, 0.17142857142857137, 0.18367347717285154,
+    0.1959183829171317, 0.20816328866141187, 0.22040819440569193, 0.2326531001499721,
+    0.24489800589425226, 0.2571429116385323, 0.2693878173828125, 0.28163272312709264,
+    0.2938776288713728, 0.30000000000000004, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.05, 0.28799980878829956, 1.0,
+    0.13760901425650426, 0.0, 0.5, 0.5, 0.9079999327659607, 0.5, 0,
+  }},
+  // SadMic
+  {{
+    0.17142857142857137, 0.20714285714285718, 0.22857142857142854, 0.22857142857142854,
+    0.22857142857142854, 0.2142857142857143, 0.16428571428571426, 0.15714285714285714,
+    0.15714285714285714, 0.15714285714285714, 0.15714285714285714, 0.1785714285714286,
+    0.22142857142857142, 0.22857142857142854, 0.23571428571428577, 0.26428571428571423,
+    0.3928571428571429, 0.3928571428571429, 0.3928571428571429, 0.41428571428571426,
+    0.4285714285714286, 0.5, 0.55, 0.55, 0.55, 0.55, 0.55, 0.5357142857142857,
+    0.5357142857142857, 0.5, 0.5, 0.41428571428571426, 0.5285714285714286,
+    0.48571428571428577, 0.4642857142857143, 0.4642857142857143, 0.4928571428571429,
+    0.5071428571428571, 0.5214285714285714, 0.5714285714285714, 0.6, 0.65,
+    0.6642857142857144, 0.6928571428571428, 0.7, 0.7, 0.7, 0.4, 0.4928571428571429,
+    0.6714285714285715, 0.6714285714285715, 0.6642857142857144, 0.6357142857142857, 0.6,
+    0.5642857142857143, 0.4571428571428572, 0.3857142857142857, 0.33571428571428574,
+    0.3142857142857143, 0.2785714285714286, 0.2785714285714286, 0.35, 0.5285714285714286,
+    0.5285714285714286, 0.27142857142857146, 0.27142857142857146, 0.2857142857142857,
+    0.37857142857142856, 0.4571428571428572, 0.5428571428571429, 0.6357142857142857,
+    0.8357142857142857, 0.8, 0.7785714285714286, 0.9, 0.6928571428571428,
+    0.5357142857142857, 0.3571428571428571, 0.23571428571428577, 0.2142857142857143,
+    0.4714285714285714, 0.44999999999999996, 0.47857142857142854, 0.4714285714285714,
+    0.48571428571428577, 0.5214285714285714, 0.4642857142857143, 0.4571428571428572,
+    0.4214285714285714, 0.4214285714285714, 0.4214285714285714, 0.5428571428571429,
+    0.6571428571428571, 0.7571428571428571, 0.5714285714285714, 0.6857142857142857, 0.0,
+    0.0, 0.0, 0.0, 0.1071428571428571, 0.1071428571428571, 0.1071428571428571,
+    0.12857142857142856, 0.13571428571428568, 0.13571428571428568, 0.13571428571428568,
+    0.13571428571428568, 0.13571428571428568, 0.15000000000000002, 0.12857142857142856,
+    0.1071428571428571, 0.12142857142857144, 0.2142857142857143, 0.3571428571428571,
+    0.5285714285714286, 0.8, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 0.05, 1.0, 1.0, 0.13760901425650426, 0.0, 0.5, 0.0, 0.5, 0.5, 0,
+  }},
+  // Sober
+  {{
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.6,
+    0.5, 0.3642857142857143, 0.5, 0.6428571428571428, 0.5, 0.34285714285714286, 0.5,
+    0.75, 0.5, 0.3857142857142857, 0.5, 0.65, 0.5, 0.37857142857142856, 0.5,
+    0.3214285714285714, 0.5, 0.6642857142857144, 0.5, 0.4, 0.5, 0.6642857142857144, 0.5,
+    0.4214285714285714, 0.5, 0.6714285714285715, 0.5, 0.4285714285714286, 0.5,
+    0.6714285714285715, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5,
+    0.5, 0.5, 0.3928571428571429, 0.3920918600899833, 0.3905612400599888,
+    0.38903062002999445, 0.38749999999999996, 0.3859693799700056, 0.3844387599400112,
+    0.3829081399100167, 0.38137751988002233, 0.37984689985002795, 0.37831627982003346,
+    0.3767856597900391, 0.3752550397600446, 0.3737244197300502, 0.37219379970005584,
+    0.37142857142857144, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.05, 1.0, 1.0, 1.0, 0.04399999976158142, 0.5,
+    0.11600007861852646, 0.64000004529953, 0.5, 0,
+  }},
+  // Windy
+  {{
+    0.12142857142857144, 0.12142857142857144, 0.17142857142857137, 0.24285714285714288,
+    0.30000000000000004, 0.37857142857142856, 0.5071428571428571, 0.6,
+    0.6285714285714286, 0.6214285714285714, 0.6, 0.55, 0.48571428571428577,
+    0.41428571428571426, 0.3642857142857143, 0.3142857142857143, 0.7285714285714286,
+    0.6642857142857144, 0.4642857142857143, 0.33571428571428574, 0.3142857142857143,
+    0.3142857142857143, 0.34285714285714286, 0.37857142857142856, 0.4571428571428572,
+    0.55, 0.6357142857142857, 0.7, 0.7285714285714286, 0.65, 0.65, 0.65,
+    0.09999999999999998, 0.44285714285714284, 0.23571428571428577, 0.17142857142857137,
+    0.12857142857142856, 0.8357142857142857, 0.85, 0.8571428571428572,
+    0.8571428571428572, 0.8214285714285714, 0.8214285714285714, 0.8214285714285714,
+    0.8214285714285714, 0.8214285714285714, 0.8214285714285714, 0.6357142857142857,
+    0.47857142857142854, 0.6071428571428572, 0.5214285714285714, 0.4571428571428572,
+    0.3928571428571429, 0.3571428571428571, 0.7, 0.33571428571428574, 0.6714285714285715,
+    0.3642857142857143, 0.7142857142857143, 0.37142857142857144, 0.6428571428571428,
+    0.37142857142857144, 0.8142857142857143, 0.3285714285714286, 0.5, 0.5071428571428571,
+    0.4214285714285714, 0.5071428571428571, 0.6857142857142857, 0.6857142857142857,
+    0.6214285714285714, 0.5642857142857143, 0.4642857142857143, 0.4, 0.3571428571428571,
+    0.34285714285714286, 0.34285714285714286, 0.44999999999999996, 0.5928571428571429,
+    0.6142857142857143, 0.4714285714285714, 0.44999999999999996, 0.41428571428571426,
+    0.4, 0.37142857142857144, 0.3142857142857143, 0.2928571428571428, 0.2928571428571428,
+    0.2928571428571428, 0.2928571428571428, 0.2928571428571428, 0.2928571428571428,
+    0.3571428571428571, 0.2928571428571428, 0.24285714285714288, 0.19999999999999996,
+    0.24285714285714288, 0.2857142857142857, 0.4214285714285714, 0.4928571428571429,
+    0.55, 0.6571428571428571, 0.7571428571428571, 0.65, 0.47857142857142854,
+    0.3642857142857143, 0.3285714285714286, 0.3214285714285714, 0.30714285714285716,
+    0.2928571428571428, 0.2571428571428571, 0.19285714285714284, 1.0,
+    0.40714285714285714, 0.48571428571428577, 0.5571428571428572, 0.5714285714285714,
+    0.6285714285714286, 0.6785714285714286, 0.7071428571428571, 0.6285714285714286,
+    0.5928571428571429, 0.55, 0.4642857142857143, 0.40714285714285714,
+    0.3928571428571429, 0.34285714285714286, 0.3142857142857143, 0.4980000853538513, 1.0,
+    1.0, 0.05, 1.0, 1.0, 0.13760901425650426, 0.0, 0.5, 0.5, 0.5, 0.5, 0,
+  }},
+}};
 
-    case presetMessingUp: {
-      value[ID::time0 + 0]->setFromNormalized(0.0);
-      value[ID::time0 + 1]->setFromNormalized(0.0);
-      value[ID::time0 + 2]->setFromNormalized(0.0);
-      value[ID::time0 + 3]->setFromNormalized(0.0);
-      value[ID::time0 + 4]->setFromNormalized(0.0);
-      value[ID::time0 + 5]->setFromNormalized(0.0);
-      value[ID::time0 + 6]->setFromNormalized(0.0);
-      value[ID::time0 + 7]->setFromNormalized(0.0);
-      value[ID::time0 + 8]->setFromNormalized(0.0);
-      value[ID::time0 + 9]->setFromNormalized(0.0);
-      value[ID::time0 + 10]->setFromNormalized(0.0);
-      value[ID::time0 + 11]->setFromNormalized(0.0);
-      value[ID::time0 + 12]->setFromNormalized(0.0);
-      value[ID::time0 + 13]->setFromNormalized(0.0);
-      value[ID::time0 + 14]->setFromNormalized(0.0);
-      value[ID::time0 + 15]->setFromNormalized(0.0);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.6);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.3642857142857143);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.6428571428571428);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.34285714285714286);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.75);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.3857142857142857);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.65);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.37857142857142856);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.3214285714285714);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.6642857142857144);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.4);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.6642857142857144);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.4214285714285714);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.6714285714285715);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.4285714285714286);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.6714285714285715);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.5);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.6571428571428571);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.6568877628871372);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.6563775471278599);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.6558673313685826);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.6553571156093052);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.6548468998500279);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.6543366840907505);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.6538264683314732);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.6533162525721958);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.6528060368129185);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.6522958210536411);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.6517856052943638);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.6512753895350865);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.6507651737758091);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.6502549580165318);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.65);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(1.0);
-      value[ID::stereoCross]->setFromNormalized(0.04399999976158142);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.12400007992982864);
-      value[ID::wet]->setFromNormalized(0.6240001320838928);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetModulateTimeBaseMultiplier: {
-      value[ID::time0 + 0]->setFromNormalized(1.0);
-      value[ID::time0 + 1]->setFromNormalized(1.0);
-      value[ID::time0 + 2]->setFromNormalized(1.0);
-      value[ID::time0 + 3]->setFromNormalized(1.0);
-      value[ID::time0 + 4]->setFromNormalized(1.0);
-      value[ID::time0 + 5]->setFromNormalized(1.0);
-      value[ID::time0 + 6]->setFromNormalized(1.0);
-      value[ID::time0 + 7]->setFromNormalized(1.0);
-      value[ID::time0 + 8]->setFromNormalized(1.0);
-      value[ID::time0 + 9]->setFromNormalized(1.0);
-      value[ID::time0 + 10]->setFromNormalized(1.0);
-      value[ID::time0 + 11]->setFromNormalized(1.0);
-      value[ID::time0 + 12]->setFromNormalized(1.0);
-      value[ID::time0 + 13]->setFromNormalized(1.0);
-      value[ID::time0 + 14]->setFromNormalized(1.0);
-      value[ID::time0 + 15]->setFromNormalized(1.0);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.30714285714285716);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.25393696988826947);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.3723134445750581);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.36576594583931643);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.2577275040991525);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.8921630722481981);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.42291514898418625);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.10896908669067551);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.2621409051567597);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.1746882911800416);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.5785781098092331);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.3713614293559621);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.5992788142819261);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.06775594074964142);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.19735509388502537);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.8603813692016752);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.3299965056038226);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.7371183919947024);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.8232061019493677);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.7404932510590917);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.4144362849553338);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.0572060381079601);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.0456307127938963);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.30157553245328217);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.30167998886402664);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.5330366237741656);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.33666448539963845);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.34254700232312446);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.8412908509413897);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.43002028589095387);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.48017486940622145);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.9405026029941623);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.7620660833443672);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.432461379638106);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.95);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.95);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.4285190533075047);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.6673220935845844);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.03998924455522401);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.14947420912239529);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.7346476454371598);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.8493904500140603);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.05450639543800834);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.6319840817899999);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.19657564416270967);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.023222797204960455);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.9714285714285714);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.054761271996385474);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.5764444907068175);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.7145040382502114);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.5812514392971732);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.16218506608762173);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.09261495986804885);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.6481417271192212);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.7648890994881081);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.9334440286901761);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.386186265201112);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.3633188314533362);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.08996277440925804);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.4081307918986946);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.3246835347341445);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.5063827446711069);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.6369180734560923);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.6553394312836199);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.8556530349262427);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.9188989724291281);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.17142857142857137);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.4249003478222929);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.8642522825972677);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.2038793246563495);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.3518677734110942);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.48954301245537946);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.9004532110019392);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.5372916359463404);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.7937950158320802);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.13050601575127302);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.3230239990469168);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.5808693259685441);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.48515429320767534);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.318161345501745);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.2571428571428571);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.25);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.25);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.25);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.25);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.25);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.25);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.25);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.25);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.25);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.25);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.25);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.25);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.25);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.25);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.23571428571428577);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(0.4980000853538513);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(0.4920000433921814);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(0.3799998462200165);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.13760901425650426);
-      value[ID::stereoCross]->setFromNormalized(0.0);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetNoisyModulation: {
-      value[ID::time0 + 0]->setFromNormalized(0.19285714285714284);
-      value[ID::time0 + 1]->setFromNormalized(0.1785714285714286);
-      value[ID::time0 + 2]->setFromNormalized(0.2142857142857143);
-      value[ID::time0 + 3]->setFromNormalized(0.27142857142857146);
-      value[ID::time0 + 4]->setFromNormalized(0.33571428571428574);
-      value[ID::time0 + 5]->setFromNormalized(0.3571428571428571);
-      value[ID::time0 + 6]->setFromNormalized(0.4);
-      value[ID::time0 + 7]->setFromNormalized(0.4285714285714286);
-      value[ID::time0 + 8]->setFromNormalized(0.4642857142857143);
-      value[ID::time0 + 9]->setFromNormalized(0.5);
-      value[ID::time0 + 10]->setFromNormalized(0.5357142857142857);
-      value[ID::time0 + 11]->setFromNormalized(0.5571428571428572);
-      value[ID::time0 + 12]->setFromNormalized(0.5857142857142856);
-      value[ID::time0 + 13]->setFromNormalized(0.6071428571428572);
-      value[ID::time0 + 14]->setFromNormalized(0.6071428571428572);
-      value[ID::time0 + 15]->setFromNormalized(0.6071428571428572);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.6642857142857144);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.6642857142857144);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.6642857142857144);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.6642857142857144);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.65);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.6428571428571428);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.6);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.5928571428571429);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.5928571428571429);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.5928571428571429);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.5928571428571429);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.5928571428571429);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.5928571428571429);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.5928571428571429);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.5928571428571429);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.5928571428571429);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.11428571428571432);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.11428571428571432);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.11428571428571432);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.11428571428571432);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.11428571428571432);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.11428571428571432);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.1428571428571429);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.19285714285714284);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.24285714285714288);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.24285714285714288);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.24285714285714288);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.24285714285714288);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.24285714285714288);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.24285714285714288);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.24285714285714288);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.24285714285714288);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.33571428571428574);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.3928571428571429);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.4214285714285714);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.44285714285714284);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.44285714285714284);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.47857142857142854);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.47857142857142854);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.47857142857142854);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.47857142857142854);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.47857142857142854);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.47857142857142854);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.47857142857142854);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.47857142857142854);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.4714285714285714);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.41428571428571426);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.44285714285714284);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.44285714285714284);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.44285714285714284);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.44285714285714284);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.4642857142857143);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.5142857142857142);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.5428571428571429);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.5571428571428572);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.6214285714285714);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.6357142857142857);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.6785714285714286);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.6214285714285714);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.4928571428571429);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.3142857142857143);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.3857142857142857);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.5428571428571429);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.7);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.7714285714285715);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.7714285714285715);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.7714285714285715);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.7714285714285715);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.7357142857142858);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.5928571428571429);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.3928571428571429);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.35);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.33571428571428574);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.3142857142857143);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.2857142857142857);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.37142857142857144);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.3142857142857143);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.27142857142857146);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.26428571428571423);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.23571428571428577);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.2142857142857143);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.19999999999999996);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.17142857142857137);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.15714285714285714);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.12857142857142856);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.12857142857142856);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.12857142857142856);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.12857142857142856);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.12857142857142856);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.12857142857142856);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.12857142857142856);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.8096089363098145);
-      value[ID::stereoCross]->setFromNormalized(0.04399999976158142);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.11600007861852646);
-      value[ID::wet]->setFromNormalized(0.64000004529953);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetPerhapsHall: {
-      value[ID::time0 + 0]->setFromNormalized(0.2571428571428571);
-      value[ID::time0 + 1]->setFromNormalized(0.2785714285714286);
-      value[ID::time0 + 2]->setFromNormalized(0.30714285714285716);
-      value[ID::time0 + 3]->setFromNormalized(0.3142857142857143);
-      value[ID::time0 + 4]->setFromNormalized(0.3285714285714286);
-      value[ID::time0 + 5]->setFromNormalized(0.37142857142857144);
-      value[ID::time0 + 6]->setFromNormalized(0.37142857142857144);
-      value[ID::time0 + 7]->setFromNormalized(0.37142857142857144);
-      value[ID::time0 + 8]->setFromNormalized(0.37142857142857144);
-      value[ID::time0 + 9]->setFromNormalized(0.37857142857142856);
-      value[ID::time0 + 10]->setFromNormalized(0.3928571428571429);
-      value[ID::time0 + 11]->setFromNormalized(0.4);
-      value[ID::time0 + 12]->setFromNormalized(0.4357142857142857);
-      value[ID::time0 + 13]->setFromNormalized(0.44999999999999996);
-      value[ID::time0 + 14]->setFromNormalized(0.4571428571428572);
-      value[ID::time0 + 15]->setFromNormalized(0.48571428571428577);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.19285714285714284);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.2142857142857143);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.27142857142857146);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.4);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.4571428571428572);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.5357142857142857);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.6714285714285715);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.7142857142857143);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.7571428571428571);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.7714285714285715);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.7714285714285715);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.7285714285714286);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.6714285714285715);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.6214285714285714);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.5785714285714285);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.5071428571428571);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.25);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.22857142857142854);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.22857142857142854);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.22857142857142854);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.25);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.7142857142857143);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.2928571428571428);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.3571428571428571);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.40714285714285714);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.8214285714285714);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.5214285714285714);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.5714285714285714);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.5857142857142856);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.6);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.6);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.19999999999999996);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.2142857142857143);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.35);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.48571428571428577);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.6214285714285714);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.6357142857142857);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.6071428571428572);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.47857142857142854);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.40714285714285714);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.3857142857142857);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.3857142857142857);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.3857142857142857);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.3857142857142857);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.3857142857142857);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.4214285714285714);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.5857142857142856);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.7071428571428571);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.75);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.7785714285714286);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.7785714285714286);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.65);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.3857142857142857);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.3642857142857143);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.3642857142857143);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.37142857142857144);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.41428571428571426);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.44285714285714284);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.5357142857142857);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.5785714285714285);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.5928571428571429);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.5928571428571429);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.4642857142857143);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.6357142857142857);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.6928571428571428);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.7071428571428571);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.7071428571428571);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.6714285714285715);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.5571428571428572);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.5357142857142857);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.5357142857142857);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.5357142857142857);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.5357142857142857);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.5357142857142857);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.5142857142857142);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.5);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.0);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.13760901425650426);
-      value[ID::stereoCross]->setFromNormalized(0.0);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5199999809265137);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetPipe: {
-      value[ID::time0 + 0]->setFromNormalized(0.2142857142857143);
-      value[ID::time0 + 1]->setFromNormalized(0.2142857142857143);
-      value[ID::time0 + 2]->setFromNormalized(0.22142857142857142);
-      value[ID::time0 + 3]->setFromNormalized(0.22857142857142854);
-      value[ID::time0 + 4]->setFromNormalized(0.22857142857142854);
-      value[ID::time0 + 5]->setFromNormalized(0.22857142857142854);
-      value[ID::time0 + 6]->setFromNormalized(0.22857142857142854);
-      value[ID::time0 + 7]->setFromNormalized(0.22857142857142854);
-      value[ID::time0 + 8]->setFromNormalized(0.22857142857142854);
-      value[ID::time0 + 9]->setFromNormalized(0.22857142857142854);
-      value[ID::time0 + 10]->setFromNormalized(0.24285714285714288);
-      value[ID::time0 + 11]->setFromNormalized(0.24285714285714288);
-      value[ID::time0 + 12]->setFromNormalized(0.24285714285714288);
-      value[ID::time0 + 13]->setFromNormalized(0.24285714285714288);
-      value[ID::time0 + 14]->setFromNormalized(0.22857142857142854);
-      value[ID::time0 + 15]->setFromNormalized(0.22857142857142854);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.12142857142857144);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.4285714285714286);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.6285714285714286);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.6857142857142857);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.8285714285714285);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.4928571428571429);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.7928571428571428);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.4928571428571429);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.48571428571428577);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.48571428571428577);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.48571428571428577);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.48571428571428577);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.7285714285714286);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.48571428571428577);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.5142857142857142);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.4285714285714286);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.3214285714285714);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.7285714285714286);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.6214285714285714);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.37857142857142856);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.3214285714285714);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.3214285714285714);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.3214285714285714);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.37857142857142856);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.4642857142857143);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.5642857142857143);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.5928571428571429);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.5928571428571429);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.5357142857142857);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.5571428571428572);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.6857142857142857);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.4928571428571429);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.6285714285714286);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.7285714285714286);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.7285714285714286);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.7285714285714286);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.7642857142857142);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.6357142857142857);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.5928571428571429);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.5642857142857143);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.5357142857142857);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.5214285714285714);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.44285714285714284);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.40714285714285714);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.40714285714285714);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.6214285714285714);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.5428571428571429);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.4357142857142857);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.40714285714285714);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.40714285714285714);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.40714285714285714);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.4357142857142857);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.5142857142857142);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.6142857142857143);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.6571428571428571);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.6857142857142857);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.6857142857142857);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.6571428571428571);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.6);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.5428571428571429);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.7785714285714286);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.44999999999999996);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.47857142857142854);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.4714285714285714);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.4214285714285714);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.3928571428571429);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.3928571428571429);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.3928571428571429);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.3928571428571429);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.3928571428571429);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.41428571428571426);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.48571428571428577);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.5428571428571429);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.7785714285714286);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.6428571428571428);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.6214285714285714);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.0);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(0.6785714285714286);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(0.55);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(0.37142857142857144);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(0.2928571428571428);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(0.2928571428571428);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(0.26428571428571423);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(0.26428571428571423);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(0.7642857142857142);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.13760901425650426);
-      value[ID::stereoCross]->setFromNormalized(0.04399999976158142);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.11600007861852646);
-      value[ID::wet]->setFromNormalized(0.64000004529953);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetR2L: {
-      value[ID::time0 + 0]->setFromNormalized(0.7285714285714286);
-      value[ID::time0 + 1]->setFromNormalized(0.7102040699550083);
-      value[ID::time0 + 2]->setFromNormalized(0.6734693799700056);
-      value[ID::time0 + 3]->setFromNormalized(0.6367346899850028);
-      value[ID::time0 + 4]->setFromNormalized(0.6);
-      value[ID::time0 + 5]->setFromNormalized(0.5632653100149971);
-      value[ID::time0 + 6]->setFromNormalized(0.5265306200299944);
-      value[ID::time0 + 7]->setFromNormalized(0.4897959572928292);
-      value[ID::time0 + 8]->setFromNormalized(0.4530612400599888);
-      value[ID::time0 + 9]->setFromNormalized(0.41632652282714844);
-      value[ID::time0 + 10]->setFromNormalized(0.37959180559430805);
-      value[ID::time0 + 11]->setFromNormalized(0.34285708836146767);
-      value[ID::time0 + 12]->setFromNormalized(0.3061223711286273);
-      value[ID::time0 + 13]->setFromNormalized(0.2693876538957868);
-      value[ID::time0 + 14]->setFromNormalized(0.2326529366629464);
-      value[ID::time0 + 15]->setFromNormalized(0.2142857142857143);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.8857142857142857);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.8632653100149972);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.8183673449925014);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.7734693799700056);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.7285714285714286);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.6836734771728515);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.6387755257742745);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.5938775743756975);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.5489796229771206);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.5040816170828684);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.45918366568429125);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.41428571428571426);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.36938776288713726);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.32448981148856026);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.27959186008998327);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.2571428571428571);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.8642857142857143);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.84056122643607);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.7931122507367815);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.7456632614135742);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.6982142857142857);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.6507653100149973);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.6033163343157086);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.5558673586164202);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.5084183829171317);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.46096937997000553);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.41352037702287947);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.3660713740757533);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.31862237112862724);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.27117336818150106);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.223724365234375);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.19999999999999996);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.8428571428571429);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.8153061185564314);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.7602040699550083);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.7051020213535855);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.6499999727521624);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.5948979241507394);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.539795902797154);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.4846938541957311);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.429591805594308);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.374489756992885);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.319387708391462);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.26428565979003904);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.20918361118861606);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.15408156258719308);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.0989795139857701);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.0714285714285714);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.7928571428571428);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.7709183556692941);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.7270408085414342);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.6831632614135742);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.6392857142857142);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.5954081671578544);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.5515306200299944);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.5076531001499721);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.4637755257742745);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.419897951398577);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.3760203770228795);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.3321428026471819);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.2882652282714844);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.24438765389578687);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.20051007952008926);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.1785714285714286);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.8785714285714286);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.8522959164210728);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.7997448921203614);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.7471938814435686);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.6946428571428571);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.6420918328421457);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.5895408085414342);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.536989756992885);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.4844387599400112);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.43188776288713726);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.37933676583426335);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.32678576878138954);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.2742347717285156);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.2216837746756417);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.1691327776227679);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.1428571428571429);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.16428571428571426);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.1599490029471261);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.1512755257742745);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.142602048601423);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.1339285714285714);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.1252550942557199);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.1165816170828683);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.10790813991001669);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.09923466273716519);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.09056118556431358);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.08188770839146209);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.07321417672293529);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.06454075404575887);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.05586733136858257);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.04719390869140627);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.042857142857142816);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(0.8928571428571429);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(0.8660714285714286);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(0.8125);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(0.7589285714285714);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(0.7053571428571428);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(0.6517857142857143);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(0.5982142857142857);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(0.5446428571428572);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(0.4910714285714286);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(0.4375);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(0.3839285714285714);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(0.3303571428571429);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(0.2767857142857143);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(0.2232142857142857);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(0.1696428571428571);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(0.1428571428571429);
-      value[ID::timeMultiply]->setFromNormalized(0.4980000853538513);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(0.4920000433921814);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(0.3799998462200165);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.13760901425650426);
-      value[ID::stereoCross]->setFromNormalized(0.4920000433921814);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetRightBehind: {
-      value[ID::time0 + 0]->setFromNormalized(0.22857142857142854);
-      value[ID::time0 + 1]->setFromNormalized(0.17142857142857137);
-      value[ID::time0 + 2]->setFromNormalized(0.13571428571428568);
-      value[ID::time0 + 3]->setFromNormalized(0.1071428571428571);
-      value[ID::time0 + 4]->setFromNormalized(0.08571428571428574);
-      value[ID::time0 + 5]->setFromNormalized(0.08571428571428574);
-      value[ID::time0 + 6]->setFromNormalized(0.08571428571428574);
-      value[ID::time0 + 7]->setFromNormalized(0.08571428571428574);
-      value[ID::time0 + 8]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 9]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 10]->setFromNormalized(0.09999999999999998);
-      value[ID::time0 + 11]->setFromNormalized(0.12857142857142856);
-      value[ID::time0 + 12]->setFromNormalized(0.15714285714285714);
-      value[ID::time0 + 13]->setFromNormalized(0.20714285714285718);
-      value[ID::time0 + 14]->setFromNormalized(0.25);
-      value[ID::time0 + 15]->setFromNormalized(0.2928571428571428);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.3642857142857143);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.3214285714285714);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.3214285714285714);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.2597806830841498);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.9599488472700328);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.05763539520245953);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.40145992221164334);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.6987668512764651);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.8728516229208492);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.7936002050841053);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.9517959771352608);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.6869304241480849);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.28967534491900837);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.4768554408479598);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.8569947995613796);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.20714285714285718);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.12142857142857144);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.07857142857142863);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.0714285714285714);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.050000000000000044);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.08571428571428574);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.4285714285714286);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.4642857142857143);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.5785714285714285);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.6428571428571428);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.6571428571428571);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.6571428571428571);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.6571428571428571);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.6357142857142857);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.8642857142857143);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.9142857142857143);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.25);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.25);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.2857142857142857);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.3142857142857143);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.3642857142857143);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.40714285714285714);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.4642857142857143);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.4928571428571429);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.5571428571428572);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.5571428571428572);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.55);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.55);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.5642857142857143);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.5785714285714285);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.6214285714285714);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.6214285714285714);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.9077618181021228);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.21355070333919868);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.35819787461124986);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.242874848814988);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.7132529709724198);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.877701334455369);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.8373704530395507);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.5348530419535192);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.65);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.22142857142857142);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.2785714285714286);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.2928571428571428);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.43378608525218937);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.4887122970104089);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.6928571428571428);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.7142857142857143);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.8613785057259497);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.6372324926603804);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.21828763949627672);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.5377589691842053);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.9046775175613491);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.7174356533155044);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.20468929630144594);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.8939253268242326);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.4739514413765647);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.09612098069068353);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.5595606928599709);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.28801715396624294);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.7029637336538773);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.21038964815305616);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.2700431931030437);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.91490279961712);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.12857142857142856);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.134693854195731);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.14693875994001115);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.15918366568429132);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.17142857142857137);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.18367347717285154);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.1959183829171317);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.20816328866141187);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.22040819440569193);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.2326531001499721);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.24489800589425226);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.2571429116385323);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.2693878173828125);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.28163272312709264);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.2938776288713728);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.30000000000000004);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(0.28799980878829956);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.13760901425650426);
-      value[ID::stereoCross]->setFromNormalized(0.0);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.9079999327659607);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetSadMic: {
-      value[ID::time0 + 0]->setFromNormalized(0.17142857142857137);
-      value[ID::time0 + 1]->setFromNormalized(0.20714285714285718);
-      value[ID::time0 + 2]->setFromNormalized(0.22857142857142854);
-      value[ID::time0 + 3]->setFromNormalized(0.22857142857142854);
-      value[ID::time0 + 4]->setFromNormalized(0.22857142857142854);
-      value[ID::time0 + 5]->setFromNormalized(0.2142857142857143);
-      value[ID::time0 + 6]->setFromNormalized(0.16428571428571426);
-      value[ID::time0 + 7]->setFromNormalized(0.15714285714285714);
-      value[ID::time0 + 8]->setFromNormalized(0.15714285714285714);
-      value[ID::time0 + 9]->setFromNormalized(0.15714285714285714);
-      value[ID::time0 + 10]->setFromNormalized(0.15714285714285714);
-      value[ID::time0 + 11]->setFromNormalized(0.1785714285714286);
-      value[ID::time0 + 12]->setFromNormalized(0.22142857142857142);
-      value[ID::time0 + 13]->setFromNormalized(0.22857142857142854);
-      value[ID::time0 + 14]->setFromNormalized(0.23571428571428577);
-      value[ID::time0 + 15]->setFromNormalized(0.26428571428571423);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.3928571428571429);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.3928571428571429);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.3928571428571429);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.41428571428571426);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.4285714285714286);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.55);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.55);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.55);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.55);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.55);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.5357142857142857);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.5357142857142857);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.41428571428571426);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.5285714285714286);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.48571428571428577);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.4642857142857143);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.4642857142857143);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.4928571428571429);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.5071428571428571);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.5214285714285714);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.5714285714285714);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.6);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.65);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.6642857142857144);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.6928571428571428);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.7);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.7);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.7);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.4);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.4928571428571429);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.6714285714285715);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.6714285714285715);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.6642857142857144);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.6357142857142857);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.6);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.5642857142857143);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.3857142857142857);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.33571428571428574);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.3142857142857143);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.2785714285714286);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.2785714285714286);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.35);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.5285714285714286);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.5285714285714286);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.27142857142857146);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.27142857142857146);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.2857142857142857);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.37857142857142856);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.4571428571428572);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.5428571428571429);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.6357142857142857);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.8357142857142857);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.8);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.7785714285714286);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.9);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.6928571428571428);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.5357142857142857);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.3571428571428571);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.23571428571428577);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.2142857142857143);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.4714285714285714);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.44999999999999996);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.47857142857142854);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.4714285714285714);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.48571428571428577);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.5214285714285714);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.4642857142857143);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.4571428571428572);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.4214285714285714);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.4214285714285714);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.4214285714285714);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.5428571428571429);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.6571428571428571);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.7571428571428571);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.5714285714285714);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.6857142857142857);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.0);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.1071428571428571);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.1071428571428571);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.1071428571428571);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.12857142857142856);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.13571428571428568);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.13571428571428568);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.13571428571428568);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.13571428571428568);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.13571428571428568);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.15000000000000002);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.12857142857142856);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.1071428571428571);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(0.12142857142857144);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(0.2142857142857143);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(0.3571428571428571);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(0.5285714285714286);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(0.8);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.13760901425650426);
-      value[ID::stereoCross]->setFromNormalized(0.0);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.0);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetSober: {
-      value[ID::time0 + 0]->setFromNormalized(0.0);
-      value[ID::time0 + 1]->setFromNormalized(0.0);
-      value[ID::time0 + 2]->setFromNormalized(0.0);
-      value[ID::time0 + 3]->setFromNormalized(0.0);
-      value[ID::time0 + 4]->setFromNormalized(0.0);
-      value[ID::time0 + 5]->setFromNormalized(0.0);
-      value[ID::time0 + 6]->setFromNormalized(0.0);
-      value[ID::time0 + 7]->setFromNormalized(0.0);
-      value[ID::time0 + 8]->setFromNormalized(0.0);
-      value[ID::time0 + 9]->setFromNormalized(0.0);
-      value[ID::time0 + 10]->setFromNormalized(0.0);
-      value[ID::time0 + 11]->setFromNormalized(0.0);
-      value[ID::time0 + 12]->setFromNormalized(0.0);
-      value[ID::time0 + 13]->setFromNormalized(0.0);
-      value[ID::time0 + 14]->setFromNormalized(0.0);
-      value[ID::time0 + 15]->setFromNormalized(0.0);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.6);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.3642857142857143);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.6428571428571428);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.34285714285714286);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.75);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.3857142857142857);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.65);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.5);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.37857142857142856);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.3214285714285714);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.6642857142857144);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.4);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.6642857142857144);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.4214285714285714);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.6714285714285715);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.4285714285714286);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.5);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.6714285714285715);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.5);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.5);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.5);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.3928571428571429);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.3920918600899833);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.3905612400599888);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.38903062002999445);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.38749999999999996);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.3859693799700056);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.3844387599400112);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.3829081399100167);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.38137751988002233);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.37984689985002795);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.37831627982003346);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.3767856597900391);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.3752550397600446);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.3737244197300502);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.37219379970005584);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.37142857142857144);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(1.0);
-      value[ID::timeMultiply]->setFromNormalized(1.0);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(1.0);
-      value[ID::stereoCross]->setFromNormalized(0.04399999976158142);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.11600007861852646);
-      value[ID::wet]->setFromNormalized(0.64000004529953);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
-
-    case presetWindy: {
-      value[ID::time0 + 0]->setFromNormalized(0.12142857142857144);
-      value[ID::time0 + 1]->setFromNormalized(0.12142857142857144);
-      value[ID::time0 + 2]->setFromNormalized(0.17142857142857137);
-      value[ID::time0 + 3]->setFromNormalized(0.24285714285714288);
-      value[ID::time0 + 4]->setFromNormalized(0.30000000000000004);
-      value[ID::time0 + 5]->setFromNormalized(0.37857142857142856);
-      value[ID::time0 + 6]->setFromNormalized(0.5071428571428571);
-      value[ID::time0 + 7]->setFromNormalized(0.6);
-      value[ID::time0 + 8]->setFromNormalized(0.6285714285714286);
-      value[ID::time0 + 9]->setFromNormalized(0.6214285714285714);
-      value[ID::time0 + 10]->setFromNormalized(0.6);
-      value[ID::time0 + 11]->setFromNormalized(0.55);
-      value[ID::time0 + 12]->setFromNormalized(0.48571428571428577);
-      value[ID::time0 + 13]->setFromNormalized(0.41428571428571426);
-      value[ID::time0 + 14]->setFromNormalized(0.3642857142857143);
-      value[ID::time0 + 15]->setFromNormalized(0.3142857142857143);
-      value[ID::outerFeed0 + 0]->setFromNormalized(0.7285714285714286);
-      value[ID::outerFeed0 + 1]->setFromNormalized(0.6642857142857144);
-      value[ID::outerFeed0 + 2]->setFromNormalized(0.4642857142857143);
-      value[ID::outerFeed0 + 3]->setFromNormalized(0.33571428571428574);
-      value[ID::outerFeed0 + 4]->setFromNormalized(0.3142857142857143);
-      value[ID::outerFeed0 + 5]->setFromNormalized(0.3142857142857143);
-      value[ID::outerFeed0 + 6]->setFromNormalized(0.34285714285714286);
-      value[ID::outerFeed0 + 7]->setFromNormalized(0.37857142857142856);
-      value[ID::outerFeed0 + 8]->setFromNormalized(0.4571428571428572);
-      value[ID::outerFeed0 + 9]->setFromNormalized(0.55);
-      value[ID::outerFeed0 + 10]->setFromNormalized(0.6357142857142857);
-      value[ID::outerFeed0 + 11]->setFromNormalized(0.7);
-      value[ID::outerFeed0 + 12]->setFromNormalized(0.7285714285714286);
-      value[ID::outerFeed0 + 13]->setFromNormalized(0.65);
-      value[ID::outerFeed0 + 14]->setFromNormalized(0.65);
-      value[ID::outerFeed0 + 15]->setFromNormalized(0.65);
-      value[ID::innerFeed0 + 0]->setFromNormalized(0.09999999999999998);
-      value[ID::innerFeed0 + 1]->setFromNormalized(0.44285714285714284);
-      value[ID::innerFeed0 + 2]->setFromNormalized(0.23571428571428577);
-      value[ID::innerFeed0 + 3]->setFromNormalized(0.17142857142857137);
-      value[ID::innerFeed0 + 4]->setFromNormalized(0.12857142857142856);
-      value[ID::innerFeed0 + 5]->setFromNormalized(0.8357142857142857);
-      value[ID::innerFeed0 + 6]->setFromNormalized(0.85);
-      value[ID::innerFeed0 + 7]->setFromNormalized(0.8571428571428572);
-      value[ID::innerFeed0 + 8]->setFromNormalized(0.8571428571428572);
-      value[ID::innerFeed0 + 9]->setFromNormalized(0.8214285714285714);
-      value[ID::innerFeed0 + 10]->setFromNormalized(0.8214285714285714);
-      value[ID::innerFeed0 + 11]->setFromNormalized(0.8214285714285714);
-      value[ID::innerFeed0 + 12]->setFromNormalized(0.8214285714285714);
-      value[ID::innerFeed0 + 13]->setFromNormalized(0.8214285714285714);
-      value[ID::innerFeed0 + 14]->setFromNormalized(0.8214285714285714);
-      value[ID::innerFeed0 + 15]->setFromNormalized(0.6357142857142857);
-      value[ID::timeOffset0 + 0]->setFromNormalized(0.47857142857142854);
-      value[ID::timeOffset0 + 1]->setFromNormalized(0.6071428571428572);
-      value[ID::timeOffset0 + 2]->setFromNormalized(0.5214285714285714);
-      value[ID::timeOffset0 + 3]->setFromNormalized(0.4571428571428572);
-      value[ID::timeOffset0 + 4]->setFromNormalized(0.3928571428571429);
-      value[ID::timeOffset0 + 5]->setFromNormalized(0.3571428571428571);
-      value[ID::timeOffset0 + 6]->setFromNormalized(0.7);
-      value[ID::timeOffset0 + 7]->setFromNormalized(0.33571428571428574);
-      value[ID::timeOffset0 + 8]->setFromNormalized(0.6714285714285715);
-      value[ID::timeOffset0 + 9]->setFromNormalized(0.3642857142857143);
-      value[ID::timeOffset0 + 10]->setFromNormalized(0.7142857142857143);
-      value[ID::timeOffset0 + 11]->setFromNormalized(0.37142857142857144);
-      value[ID::timeOffset0 + 12]->setFromNormalized(0.6428571428571428);
-      value[ID::timeOffset0 + 13]->setFromNormalized(0.37142857142857144);
-      value[ID::timeOffset0 + 14]->setFromNormalized(0.8142857142857143);
-      value[ID::timeOffset0 + 15]->setFromNormalized(0.3285714285714286);
-      value[ID::outerFeedOffset0 + 0]->setFromNormalized(0.5);
-      value[ID::outerFeedOffset0 + 1]->setFromNormalized(0.5071428571428571);
-      value[ID::outerFeedOffset0 + 2]->setFromNormalized(0.4214285714285714);
-      value[ID::outerFeedOffset0 + 3]->setFromNormalized(0.5071428571428571);
-      value[ID::outerFeedOffset0 + 4]->setFromNormalized(0.6857142857142857);
-      value[ID::outerFeedOffset0 + 5]->setFromNormalized(0.6857142857142857);
-      value[ID::outerFeedOffset0 + 6]->setFromNormalized(0.6214285714285714);
-      value[ID::outerFeedOffset0 + 7]->setFromNormalized(0.5642857142857143);
-      value[ID::outerFeedOffset0 + 8]->setFromNormalized(0.4642857142857143);
-      value[ID::outerFeedOffset0 + 9]->setFromNormalized(0.4);
-      value[ID::outerFeedOffset0 + 10]->setFromNormalized(0.3571428571428571);
-      value[ID::outerFeedOffset0 + 11]->setFromNormalized(0.34285714285714286);
-      value[ID::outerFeedOffset0 + 12]->setFromNormalized(0.34285714285714286);
-      value[ID::outerFeedOffset0 + 13]->setFromNormalized(0.44999999999999996);
-      value[ID::outerFeedOffset0 + 14]->setFromNormalized(0.5928571428571429);
-      value[ID::outerFeedOffset0 + 15]->setFromNormalized(0.6142857142857143);
-      value[ID::innerFeedOffset0 + 0]->setFromNormalized(0.4714285714285714);
-      value[ID::innerFeedOffset0 + 1]->setFromNormalized(0.44999999999999996);
-      value[ID::innerFeedOffset0 + 2]->setFromNormalized(0.41428571428571426);
-      value[ID::innerFeedOffset0 + 3]->setFromNormalized(0.4);
-      value[ID::innerFeedOffset0 + 4]->setFromNormalized(0.37142857142857144);
-      value[ID::innerFeedOffset0 + 5]->setFromNormalized(0.3142857142857143);
-      value[ID::innerFeedOffset0 + 6]->setFromNormalized(0.2928571428571428);
-      value[ID::innerFeedOffset0 + 7]->setFromNormalized(0.2928571428571428);
-      value[ID::innerFeedOffset0 + 8]->setFromNormalized(0.2928571428571428);
-      value[ID::innerFeedOffset0 + 9]->setFromNormalized(0.2928571428571428);
-      value[ID::innerFeedOffset0 + 10]->setFromNormalized(0.2928571428571428);
-      value[ID::innerFeedOffset0 + 11]->setFromNormalized(0.2928571428571428);
-      value[ID::innerFeedOffset0 + 12]->setFromNormalized(0.3571428571428571);
-      value[ID::innerFeedOffset0 + 13]->setFromNormalized(0.2928571428571428);
-      value[ID::innerFeedOffset0 + 14]->setFromNormalized(0.24285714285714288);
-      value[ID::innerFeedOffset0 + 15]->setFromNormalized(0.19999999999999996);
-      value[ID::timeLfoAmount0 + 0]->setFromNormalized(0.24285714285714288);
-      value[ID::timeLfoAmount0 + 1]->setFromNormalized(0.2857142857142857);
-      value[ID::timeLfoAmount0 + 2]->setFromNormalized(0.4214285714285714);
-      value[ID::timeLfoAmount0 + 3]->setFromNormalized(0.4928571428571429);
-      value[ID::timeLfoAmount0 + 4]->setFromNormalized(0.55);
-      value[ID::timeLfoAmount0 + 5]->setFromNormalized(0.6571428571428571);
-      value[ID::timeLfoAmount0 + 6]->setFromNormalized(0.7571428571428571);
-      value[ID::timeLfoAmount0 + 7]->setFromNormalized(0.65);
-      value[ID::timeLfoAmount0 + 8]->setFromNormalized(0.47857142857142854);
-      value[ID::timeLfoAmount0 + 9]->setFromNormalized(0.3642857142857143);
-      value[ID::timeLfoAmount0 + 10]->setFromNormalized(0.3285714285714286);
-      value[ID::timeLfoAmount0 + 11]->setFromNormalized(0.3214285714285714);
-      value[ID::timeLfoAmount0 + 12]->setFromNormalized(0.30714285714285716);
-      value[ID::timeLfoAmount0 + 13]->setFromNormalized(0.2928571428571428);
-      value[ID::timeLfoAmount0 + 14]->setFromNormalized(0.2571428571428571);
-      value[ID::timeLfoAmount0 + 15]->setFromNormalized(0.19285714285714284);
-      value[ID::lowpassCutoff0 + 0]->setFromNormalized(1.0);
-      value[ID::lowpassCutoff0 + 1]->setFromNormalized(0.40714285714285714);
-      value[ID::lowpassCutoff0 + 2]->setFromNormalized(0.48571428571428577);
-      value[ID::lowpassCutoff0 + 3]->setFromNormalized(0.5571428571428572);
-      value[ID::lowpassCutoff0 + 4]->setFromNormalized(0.5714285714285714);
-      value[ID::lowpassCutoff0 + 5]->setFromNormalized(0.6285714285714286);
-      value[ID::lowpassCutoff0 + 6]->setFromNormalized(0.6785714285714286);
-      value[ID::lowpassCutoff0 + 7]->setFromNormalized(0.7071428571428571);
-      value[ID::lowpassCutoff0 + 8]->setFromNormalized(0.6285714285714286);
-      value[ID::lowpassCutoff0 + 9]->setFromNormalized(0.5928571428571429);
-      value[ID::lowpassCutoff0 + 10]->setFromNormalized(0.55);
-      value[ID::lowpassCutoff0 + 11]->setFromNormalized(0.4642857142857143);
-      value[ID::lowpassCutoff0 + 12]->setFromNormalized(0.40714285714285714);
-      value[ID::lowpassCutoff0 + 13]->setFromNormalized(0.3928571428571429);
-      value[ID::lowpassCutoff0 + 14]->setFromNormalized(0.34285714285714286);
-      value[ID::lowpassCutoff0 + 15]->setFromNormalized(0.3142857142857143);
-      value[ID::timeMultiply]->setFromNormalized(0.4980000853538513);
-      value[ID::outerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedMultiply]->setFromNormalized(1.0);
-      value[ID::timeOffsetMultiply]->setFromNormalized(0.05);
-      value[ID::outerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::innerFeedOffsetMultiply]->setFromNormalized(1.0);
-      value[ID::timeLfoLowpass]->setFromNormalized(0.13760901425650426);
-      value[ID::stereoCross]->setFromNormalized(0.0);
-      value[ID::stereoSpread]->setFromNormalized(0.5);
-      value[ID::dry]->setFromNormalized(0.5);
-      value[ID::wet]->setFromNormalized(0.5);
-      value[ID::smoothness]->setFromNormalized(0.5);
-      value[ID::bypass]->setFromInt(0);
-    } break;
+void GlobalParameter::loadProgram(uint32_t index)
+{
+  if (index >= presetBank.size()) {
+    resetParameter();
+    return;
   }
+  value.load(presetBank[index]);
 }
 
 #endif
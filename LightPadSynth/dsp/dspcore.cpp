@@ -81,6 +81,7 @@ void NOTE_NAME::noteOn(
   float pan,
   float phase,
   float sampleRate,
+  const SmootherCommon<float> &smootherCommon,
   Wavetable &wavetable,
   NoteProcessInfo &info,
   GlobalParameter &param)
@@ -117,11 +118,11 @@ void NOTE_NAME::noteOn(
   while (delaySeconds > delayMaxTime) delaySeconds *= 0.5f;
 
   gainEnvelope.reset(
-    sampleRate, param.value[ID::gainA]->getFloat(), param.value[ID::gainD]->getFloat(),
-    param.value[ID::gainS]->getFloat(), param.value[ID::gainR]->getFloat(),
-    param.value[ID::gainCurve]->getFloat(), noteFreq);
+    smootherCommon, sampleRate, param.value[ID::gainA]->getFloat(),
+    param.value[ID::gainD]->getFloat(), param.value[ID::gainS]->getFloat(),
+    param.value[ID::gainR]->getFloat(), param.value[ID::gainCurve]->getFloat(), noteFreq);
   filterEnvelope.reset(
-    sampleRate, param.value[ID::filterA]->getFloat(),
+    smootherCommon, sampleRate, param.value[ID::filterA]->getFloat(),
     param.value[ID::filterD]->getFloat(), param.value[ID::filterS]->getFloat(),
     param.value[ID::filterR]->getFloat(), noteFreq);
   delayGate.reset(sampleRate, param.value[ID::delayAttack]->getFloat(), noteFreq);
@@ -181,8 +182,8 @@ void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.04f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.04f);
 
   for (auto &note : notes) note.setup(sampleRate);
 
@@ -206,36 +207,43 @@ void DSPCORE_NAME::setParameters(float tempo)
 {
   using ID = ParameterID::ID;
 
-  SmootherCommon<float>::setTime(param.value[ID::smoothness]->getFloat());
+  smootherCommon.setTime(param.value[ID::smoothness]->getFloat());
 
-  interpMasterGain.push(param.value[ID::gain]->getFloat());
+  interpMasterGain.push(smootherCommon, param.value[ID::gain]->getFloat());
 
-  info.masterPitch.push(calcMasterPitch(
-    int32_t(param.value[ID::oscOctave]->getInt()) - 12,
-    param.value[ID::oscSemi]->getInt() - 120, param.value[ID::oscMilli]->getInt() - 1000,
-    param.value[ID::pitchBend]->getFloat()));
+  info.masterPitch.push(
+    smootherCommon,
+    calcMasterPitch(
+      int32_t(param.value[ID::oscOctave]->getInt()) - 12,
+      param.value[ID::oscSemi]->getInt() - 120,
+      param.value[ID::oscMilli]->getInt() - 1000,
+      param.value[ID::pitchBend]->getFloat()));
 
   auto equalTemperament = param.value[ID::equalTemperament]->getFloat() + 1;
-  info.equalTemperament.push(equalTemperament);
-  info.pitchA4Hz.push(param.value[ID::pitchA4Hz]->getFloat() + 100);
-
-  info.filterCutoff.push(param.value[ID::filterCutoff]->getFloat());
-  info.filterResonance.push(param.value[ID::filterResonance]->getFloat());
-  info.filterAmount.push(param.value[ID::filterAmount]->getFloat());
-  info.filterKeyFollow.push(param.value[ID::filterKeyFollow]->getFloat());
-
-  info.delayMix.push(param.value[ID::delayMix]->getFloat());
-  info.delayDetune.push(calcDelayPitch(
-    param.value[ID::delayDetuneSemi]->getInt() - 120,
-    param.value[ID::delayDetuneMilli]->getInt() - 1000, equalTemperament));
-  info.delayFeedback.push(param.value[ID::delayFeedback]->getFloat());
+  info.equalTemperament.push(smootherCommon, equalTemperament);
+  info.pitchA4Hz.push(smootherCommon, param.value[ID::pitchA4Hz]->getFloat() + 100);
+
+  info.filterCutoff.push(smootherCommon, param.value[ID::filterCutoff]->getFloat());
+  info.filterResonance.push(smootherCommon, param.value[ID::filterResonance]->getFloat());
+  info.filterAmount.push(smootherCommon, param.value[ID::filterAmount]->getFloat());
+  info.filterKeyFollow.push(smootherCommon, param.value[ID::filterKeyFollow]->getFloat());
+
+  info.delayMix.push(smootherCommon, param.value[ID::delayMix]->getFloat());
+  info.delayDetune.push(
+    smootherCommon,
+    calcDelayPitch(
+      param.value[ID::delayDetuneSemi]->getInt() - 120,
+      param.value[ID::delayDetuneMilli]->getInt() - 1000, equalTemperament));
+  info.delayFeedback.push(smootherCommon, param.value[ID::delayFeedback]->getFloat());
 
   const float beat = float(param.value[ID::lfoTempoNumerator]->getInt() + 1)
     / float(param.value[ID::lfoTempoDenominator]->getInt() + 1);
   info.lfoFrequency.push(
+    smootherCommon,
     param.value[ID::lfoFrequencyMultiplier]->getFloat() * tempo / 240.0f / beat);
-  info.lfoAmount.push(param.value[ID::lfoDelayAmount]->getFloat());
+  info.lfoAmount.push(smootherCommon, param.value[ID::lfoDelayAmount]->getFloat());
   info.lfoLowpass.push(
+    smootherCommon,
     PController<float>::cutoffToP(sampleRate, param.value[ID::lfoLowpass]->getFloat()));
 
   nVoice = 16 * (param.value[ID::nVoice]->getInt() + 1);
@@ -244,11 +252,12 @@ void DSPCORE_NAME::setParameters(float tempo)
   for (auto &note : notes) {
     if (note.state == NoteState::rest) continue;
     note.gainEnvelope.set(
-      sampleRate, param.value[ID::gainA]->getFloat(), param.value[ID::gainD]->getFloat(),
-      param.value[ID::gainS]->getFloat(), param.value[ID::gainR]->getFloat(),
-      param.value[ID::gainCurve]->getFloat(), note.noteFreq);
+      smootherCommon, sampleRate, param.value[ID::gainA]->getFloat(),
+      param.value[ID::gainD]->getFloat(), param.value[ID::gainS]->getFloat(),
+      param.value[ID::gainR]->getFloat(), param.value[ID::gainCurve]->getFloat(),
+      note.noteFreq);
     note.filterEnvelope.set(
-      sampleRate, param.value[ID::filterA]->getFloat(),
+      smootherCommon, sampleRate, param.value[ID::filterA]->getFloat(),
       param.value[ID::filterD]->getFloat(), param.value[ID::filterS]->getFloat(),
       param.value[ID::filterR]->getFloat(), note.noteFreq);
     note.delayGate.atk.set(sampleRate, param.value[ID::delayAttack]->getFloat());
@@ -267,7 +276,7 @@ void DSPCORE_NAME::setParameters(float tempo)
 
 void DSPCORE_NAME::process(const size_t length, float *out0, float *out1)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   std::array<float, 2> frame{};
   for (uint32_t i = 0; i < length; ++i) {
@@ -441,8 +450,8 @@ void DSPCORE_NAME::noteOn(int32_t identifier, int16_t pitch, float tuning, float
 
   if (nUnison <= 1) {
     notes[noteIndices[0]].noteOn(
-      identifier, float(pitch) + tuning, velocity, 0.5f, 0.0f, sampleRate, wavetable,
-      info, param);
+      identifier, float(pitch) + tuning, velocity, 0.5f, 0.0f, sampleRate,
+      smootherCommon, wavetable, info, param);
     return;
   }
 
@@ -461,7 +470,7 @@ void DSPCORE_NAME::noteOn(int32_t identifier, int16_t pitch, float tuning, float
     auto phase = unisonPhase * unison / float(nUnison);
     notes[noteIndices[unison]].noteOn(
       identifier, notePitch, distGain(info.rng) * velocity, unisonPan[unison], phase,
-      sampleRate, wavetable, info, param);
+      sampleRate, smootherCommon, wavetable, info, param);
   }
 }
 
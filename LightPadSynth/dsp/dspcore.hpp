@@ -127,6 +127,7 @@ struct NoteProcessInfo {
       float pan,                                                                         \
       float phase,                                                                       \
       float sampleRate,                                                                  \
+      const SmootherCommon<float> &smootherCommon,                                       \
       Wavetable &wavetable,                                                              \
       NoteProcessInfo &info,                                                             \
       GlobalParameter &param);                                                           \
@@ -237,6 +238,7 @@ public:
     void setUnisonPan(size_t nUnison);                                                   \
                                                                                          \
     float sampleRate = 44100.0f;                                                         \
+    SmootherCommon<float> smootherCommon;                                                \
                                                                                          \
     std::vector<PeakInfo<float>> peakInfos;                                              \
                                                                                          \
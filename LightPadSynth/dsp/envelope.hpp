@@ -136,6 +136,7 @@ public:
 template<typename Sample> class ExpADSREnvelope {
 public:
   void reset(
+    const SmootherCommon<Sample> &common,
     Sample sampleRate,
     Sample attackTime,
     Sample decayTime,
@@ -156,12 +157,13 @@ public:
 
     dec.reset(sampleRate, decayTime);
 
-    sus.push(std::clamp<Sample>(sustainLevel, Sample(0), Sample(1)));
+    sus.push(common, std::clamp<Sample>(sustainLevel, Sample(0), Sample(1)));
 
     rel.reset(sampleRate, adaptTime(releaseTime, noteFreq));
   }
 
   void set(
+    const SmootherCommon<Sample> &common,
     Sample sampleRate,
     Sample attackTime,
     Sample decayTime,
@@ -186,7 +188,7 @@ public:
         // Fall through.
 
       case State::sustain:
-        sus.push(std::clamp<Sample>(sustainLevel, Sample(0), Sample(1)));
+        sus.push(common, std::clamp<Sample>(sustainLevel, Sample(0), Sample(1)));
         // Fall through.
 
       case State::release:
@@ -266,6 +268,7 @@ public:
   }
 
   void reset(
+    const SmootherCommon<Sample> &common,
     Sample sampleRate,
     Sample attackTime,
     Sample decayTime,
@@ -276,10 +279,11 @@ public:
     state = State::attack;
     value = Sample(1);
     sus.reset(sustainLevel);
-    set(sampleRate, attackTime, decayTime, sustainLevel, releaseTime, noteFreq);
+    set(common, sampleRate, attackTime, decayTime, sustainLevel, releaseTime, noteFreq);
   }
 
   void set(
+    const SmootherCommon<Sample> &common,
     Sample sampleRate,
     Sample attackTime,
     Sample decayTime,
@@ -287,7 +291,7 @@ public:
     Sample releaseTime,
     Sample noteFreq)
   {
-    sus.push(std::clamp<Sample>(sustainLevel, Sample(0), Sample(1)));
+    sus.push(common, std::clamp<Sample>(sustainLevel, Sample(0), Sample(1)));
     trimNoteFreq(noteFreq);
     atk = secondToDelta(sampleRate, adaptTime(attackTime, noteFreq));
     dec = secondToDelta(sampleRate, adaptTime(decayTime, noteFreq));
@@ -47,6 +47,11 @@ ifeq ($(HAVE_LIBLO),true)
 BASE_FLAGS += -DHAVE_LIBLO
 endif
 
+# DSP load meter. See common/dspload.hpp.
+ifeq ($(DSP_LOAD_METER),true)
+BASE_FLAGS += -DDSP_LOAD_METER
+endif
+
 # ---------------------------------------------------------------------------------------------------------------------
 # Set files to build
 
@@ -46,15 +46,15 @@ void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.2f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.2f);
 
   startup();
 }
 
 void DSPCORE_NAME::reset()
 {
-  for (auto &shaper : shaperNaive) shaper.reset();
+  oversampler.reset();
   for (auto &shaper : shaperBlep) shaper.reset();
   for (auto &lp : lowpass) lp.reset();
   startup();
@@ -64,7 +64,9 @@ void DSPCORE_NAME::startup() {}
 
 uint32_t DSPCORE_NAME::getLatency()
 {
-  if (shaperType == 2) // 4 point PolyBLEP residual.
+  if (shaperType == 1) // Oversampling.
+    return oversampler.getLatency();
+  else if (shaperType == 2) // 4 point PolyBLEP residual.
     return 4;
   else if (shaperType == 3) // 8 point PolyBLEP residual.
     return 8;
@@ -75,17 +77,24 @@ void DSPCORE_NAME::setParameters(float tempo)
 {
   using ID = ParameterID::ID;
 
-  SmootherCommon<float>::setTime(param.value[ID::smoothness]->getFloat());
+  smootherCommon.setTime(param.value[ID::smoothness]->getFloat());
 
-  interpInputGain.push(param.value[ID::inputGain]->getFloat());
-  interpClipGain.push(param.value[ID::clipGain]->getFloat());
-  interpOutputGain.push(param.value[ID::outputGain]->getFloat());
-  interpAdd.push(param.value[ID::add]->getFloat() * param.value[ID::moreAdd]->getFloat());
-  interpMul.push(param.value[ID::mul]->getFloat() * param.value[ID::moreMul]->getFloat());
-  interpCutoff.push(param.value[ID::lowpassCutoff]->getFloat());
+  interpInputGain.push(smootherCommon, param.value[ID::inputGain]->getFloat());
+  interpClipGain.push(smootherCommon, param.value[ID::clipGain]->getFloat());
+  interpOutputGain.push(smootherCommon, param.value[ID::outputGain]->getFloat());
+  interpAdd.push(
+    smootherCommon,
+    param.value[ID::add]->getFloat() * param.value[ID::moreAdd]->getFloat());
+  interpMul.push(
+    smootherCommon,
+    param.value[ID::mul]->getFloat() * param.value[ID::moreMul]->getFloat());
+  interpCutoff.push(smootherCommon, param.value[ID::lowpassCutoff]->getFloat());
 
   shaperType = param.value[ID::type]->getInt();
   activateLowpass = param.value[ID::lowpass]->getInt();
+  oversampler.setup(
+    1 + param.value[ID::oversampleFactor]->getInt(),
+    param.value[ID::linearPhase]->getInt());
 
   bool hardclip = param.value[ID::hardclip]->getInt();
   for (auto &shaper : shaperNaive) shaper.hardclip = hardclip;
@@ -95,7 +104,7 @@ void DSPCORE_NAME::setParameters(float tempo)
 void DSPCORE_NAME::process(
   const size_t length, const float *in0, const float *in1, float *out0, float *out1)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   std::array<float, 2> frame;
   for (uint32_t i = 0; i < length; ++i) {
@@ -129,14 +138,22 @@ void DSPCORE_NAME::process(
         frame[1] = clipGain * shaperNaive[1].process(inGain * frame[1]);
         break;
 
-      case 1: // Naive 4x oversampling.
+      case 1: // Oversampling.
         shaperNaive[0].add = add;
         shaperNaive[1].add = add;
         shaperNaive[0].mul = mul;
         shaperNaive[1].mul = mul;
 
-        frame[0] = clipGain * shaperNaive[0].process4x(inGain * frame[0]);
-        frame[1] = clipGain * shaperNaive[1].process4x(inGain * frame[1]);
+        oversampler.upsample(inGain * frame[0], inGain * frame[1]);
+        for (size_t ch = 0; ch < 2; ++ch) {
+          auto &buf = oversampler.buffer[ch];
+          for (size_t j = 0; j < oversampler.factor(); ++j)
+            buf[j] = shaperNaive[ch].process(buf[j]);
+        }
+        frame = oversampler.downsample();
+
+        frame[0] *= clipGain;
+        frame[1] *= clipGain;
         break;
 
       case 2: // 4 point PolyBLEP residual.
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "../../common/dsp/constants.hpp"
+#include "../../common/dsp/oversampler.hpp"
 #include "../../common/dsp/smoother.hpp"
 #include "../parameter.hpp"
 
@@ -60,12 +61,14 @@ public:
                                                                                          \
   private:                                                                               \
     float sampleRate = 44100.0f;                                                         \
+    SmootherCommon<float> smootherCommon;                                                \
                                                                                          \
     std::array<ModuloShaper<float>, 2> shaperNaive;                                      \
+    Oversampler oversampler;                                                             \
     std::array<ModuloShaperPolyBLEP<double>, 2> shaperBlep;                              \
     std::array<Butter8Lowpass<float>, 2> lowpass;                                        \
                                                                                          \
-    uint32_t shaperType = 0; /* 0: naive, 1: 4x naive, 2: P-BLEP4, 3: P-BLEP8 */         \
+    uint32_t shaperType = 0; /* 0: naive, 1: oversampling, 2: P-BLEP4, 3: P-BLEP8 */     \
     bool activateLowpass = true;                                                         \
     ExpSmoother<float> interpInputGain;                                                  \
     ExpSmoother<float> interpClipGain;                                                   \
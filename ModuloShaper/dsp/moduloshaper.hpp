@@ -15,10 +15,10 @@
 // You should have received a copy of the GNU General Public License
 // along with ModuloShaper.  If not, see <https://www.gnu.org/licenses/>.
 
-#include "../../common/dsp/decimationLowpass.hpp"
 #include "../../common/dsp/somemath.hpp"
 
 #include <algorithm>
+#include <array>
 
 namespace SomeDSP {
 
@@ -102,15 +102,6 @@ template<typename Sample> struct ModuloShaper {
   Sample mul = 1;
   bool hardclip = true;
 
-  Sample x1 = 0;
-  DecimationLowpass16<Sample> lowpass;
-
-  void reset()
-  {
-    x1 = 0;
-    lowpass.reset();
-  }
-
   Sample process(Sample x0)
   {
     if (hardclip) x0 = std::clamp(x0, Sample(-1), Sample(1));
@@ -120,18 +111,6 @@ template<typename Sample> struct ModuloShaper {
     Sample height = somepow(add, floored);
     return sign * ((x0 - floored) * somepow(mul, floored) * height + Sample(1) - height);
   }
-
-  float process4x(Sample x0)
-  {
-    if (hardclip) x0 = std::clamp(x0, Sample(-1), Sample(1));
-    Sample diff = x0 - x1;
-    for (int i = 0; i < 16; ++i) lowpass.push(process(x1 + i / Sample(16) * diff));
-    x1 = x0;
-    if (std::isfinite(lowpass.output())) return lowpass.output();
-
-    reset();
-    return 0;
-  }
 };
 
 template<typename Sample> class ModuloShaperPolyBLEP {
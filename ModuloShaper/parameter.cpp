@@ -34,3 +34,5 @@ IntScale<double> Scales::type(3);
 LogScale<double> Scales::lowpassCutoff(20.0, 20000.0, 0.5, 200.0);
 
 LogScale<double> Scales::smoothness(0.0, 0.5, 0.1, 0.04);
+
+IntScale<double> Scales::oversampleFactor(3);
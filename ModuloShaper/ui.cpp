@@ -82,7 +82,7 @@ constexpr float knobY = knobHeight + labelY;
 constexpr float checkboxWidth = 60.0f;
 constexpr float splashHeight = 30.0f;
 constexpr uint32_t defaultWidth = uint32_t(6 * knobX + 30);
-constexpr uint32_t defaultHeight = uint32_t(40 + 2 * knobY + 2 * margin + labelY);
+constexpr uint32_t defaultHeight = uint32_t(40 + 2 * knobY + 2 * margin + 2 * labelY);
 
 class ModuloShaperUI : public PluginUIBase {
 protected:
@@ -103,14 +103,7 @@ public:
 
     setGeometryConstraints(defaultWidth, defaultHeight, true, true);
 
-    if (palette.fontPath().size() > 0)
-      fontId = createFontFromFile("main", palette.fontPath().c_str());
-
-    if (fontId < 0) {
-      fontId = createFontFromMemory(
-        "main", (unsigned char *)(FontData::TinosBoldItalicData),
-        FontData::TinosBoldItalicDataSize, false);
-    }
+    loadFont();
 
     using ID = ParameterID::ID;
 
@@ -146,11 +139,21 @@ public:
 
     addLabel(left0, top2, 1.5f * knobX, labelHeight, uiTextSize, "Anti-aliasing");
     std::vector<std::string> typeItems{
-      "None", "16x OverSampling", "PolyBLEP 4", "PolyBLEP 8"};
+      "None", "OverSampling", "PolyBLEP 4", "PolyBLEP 8"};
     addOptionMenu(
       left0 + 1.5f * knobX, top2, 2 * knobX, labelHeight, uiTextSize, ID::type,
       typeItems);
 
+    const auto top3 = top2 + labelY;
+    addLabel(left0, top3, 1.5f * knobX, labelHeight, uiTextSize, "Factor");
+    std::vector<std::string> oversampleFactorItems{"2x", "4x", "8x", "16x"};
+    addOptionMenu(
+      left0 + 1.5f * knobX, top3, knobX, labelHeight, uiTextSize, ID::oversampleFactor,
+      oversampleFactorItems);
+    addCheckbox(
+      left0 + 2.5f * knobX + 2 * margin, top3, 1.5f * knobX, labelHeight, uiTextSize,
+      "Linear Phase", ID::linearPhase);
+
     // Plugin name.
     const auto splashTop = defaultHeight - splashHeight - 15.0f;
     const auto splashLeft = defaultWidth + 2 * margin - 2 * knobX - 15.0f;
@@ -26,18 +26,22 @@
   #define PROCESSING_UNIT_NAME ProcessingUnit_AVX512
   #define NOTE_NAME Note_AVX512
   #define DSPCORE_NAME DSPCore_AVX512
+  #define DSPBATCH_NAME DSPBatch_AVX512
 #elif INSTRSET >= 8
   #define PROCESSING_UNIT_NAME ProcessingUnit_AVX2
   #define NOTE_NAME Note_AVX2
   #define DSPCORE_NAME DSPCore_AVX2
+  #define DSPBATCH_NAME DSPBatch_AVX2
 #elif INSTRSET >= 5
   #define PROCESSING_UNIT_NAME ProcessingUnit_SSE41
   #define NOTE_NAME Note_SSE41
   #define DSPCORE_NAME DSPCore_SSE41
+  #define DSPBATCH_NAME DSPBatch_SSE41
 #elif INSTRSET >= 2
   #define PROCESSING_UNIT_NAME ProcessingUnit_SSE2
   #define NOTE_NAME Note_SSE2
   #define DSPCORE_NAME DSPCore_SSE2
+  #define DSPBATCH_NAME DSPBatch_SSE2
 #else
   #error Unsupported instruction set
 #endif
@@ -46,33 +50,48 @@ void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.2f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.2f);
 
   startup();
 }
 
 void DSPCORE_NAME::reset()
 {
-  for (auto &shpr : shaper) shpr.reset();
+  oversampler.reset();
+  isFirstPush = true;
   startup();
 }
 
 void DSPCORE_NAME::startup() {}
 
-uint32_t DSPCORE_NAME::getLatency() { return 0; }
+uint32_t DSPCORE_NAME::getLatency() { return oversample ? oversampler.getLatency() : 0; }
 
 void DSPCORE_NAME::setParameters(float tempo)
 {
   using ID = ParameterID::ID;
 
-  SmootherCommon<float>::setTime(param.value[ID::smoothness]->getFloat());
+  // Queued changes are already written to `param`.
+  parameterQueue.clear();
+
+  smootherCommon.setTime(param.value[ID::smoothness]->getFloat());
 
   interpDrive.push(
+    smootherCommon,
     param.value[ID::drive]->getFloat() * param.value[ID::boost]->getFloat());
-  interpOutputGain.push(param.value[ID::outputGain]->getFloat());
+  interpOutputGain.push(smootherCommon, param.value[ID::outputGain]->getFloat());
+
+  // Smoothers start from the first values after reset, instead of ramping from 0.
+  if (isFirstPush) {
+    for (auto smoother : {&interpDrive, &interpOutputGain})
+      smoother->reset(smoother->target);
+    isFirstPush = false;
+  }
 
   oversample = param.value[ID::oversample]->getInt();
+  oversampler.setup(
+    1 + param.value[ID::oversampleFactor]->getInt(),
+    param.value[ID::linearPhase]->getInt());
   for (auto &shpr : shaper) {
     shpr.flip = param.value[ID::flip]->getInt();
     shpr.inverse = param.value[ID::inverse]->getInt();
@@ -80,31 +99,178 @@ void DSPCORE_NAME::setParameters(float tempo)
   }
 }
 
+void DSPCORE_NAME::applyParameter(uint32_t id, double value)
+{
+  using ID = ParameterID::ID;
+
+  switch (id) {
+    case ID::drive:
+      interpDrive.push(smootherCommon, value * param.value[ID::boost]->getFloat());
+      break;
+    case ID::boost:
+      interpDrive.push(smootherCommon, param.value[ID::drive]->getFloat() * value);
+      break;
+    case ID::outputGain:
+      interpOutputGain.push(smootherCommon, value);
+      break;
+    case ID::order:
+      for (auto &shpr : shaper) shpr.order = uint32_t(value);
+      break;
+    case ID::flip:
+      for (auto &shpr : shaper) shpr.flip = uint32_t(value);
+      break;
+    case ID::inverse:
+      for (auto &shpr : shaper) shpr.inverse = uint32_t(value);
+      break;
+    case ID::oversample:
+      oversample = uint32_t(value);
+      break;
+    case ID::smoothness:
+      smootherCommon.setTime(value);
+      // `kp` is copied on push. Re-push to change the time of ramps in progress.
+      for (auto smoother : {&interpDrive, &interpOutputGain})
+        smoother->push(smootherCommon, smoother->target);
+      break;
+    case ID::oversampleFactor:
+      oversampler.setup(1 + uint32_t(value), param.value[ID::linearPhase]->getInt());
+      break;
+    case ID::linearPhase:
+      oversampler.setup(1 + param.value[ID::oversampleFactor]->getInt(), uint32_t(value));
+      break;
+    default:
+      break;
+  }
+}
+
 void DSPCORE_NAME::process(
   const size_t length, const float *in0, const float *in1, float *out0, float *out1)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   std::array<float, 2> frame;
-  for (uint32_t i = 0; i < length; ++i) {
-    auto drive = interpDrive.process();
-    auto outGain = interpOutputGain.process();
-
-    frame[0] = in0[i];
-    frame[1] = in1[i];
-
-    shaper[0].drive = drive;
-    shaper[1].drive = drive;
-
-    if (oversample) {
-      frame[0] = outGain * shaper[0].process16(frame[0]);
-      frame[1] = outGain * shaper[1].process16(frame[1]);
-    } else {
-      frame[0] = outGain * shaper[0].process(frame[0]);
-      frame[1] = outGain * shaper[1].process(frame[1]);
+  for (size_t i = 0; i < length;) {
+    const size_t end = parameterQueue.dispatch(i, length, [&](const auto &event) {
+      applyParameter(event.id, event.value);
+    });
+
+    for (; i < end; ++i) {
+      auto drive = interpDrive.process();
+      auto outGain = interpOutputGain.process();
+
+      frame[0] = in0[i];
+      frame[1] = in1[i];
+
+      shaper[0].drive = drive;
+      shaper[1].drive = drive;
+
+      if (oversample) {
+        oversampler.upsample(frame[0], frame[1]);
+        for (size_t ch = 0; ch < 2; ++ch) {
+          auto &buf = oversampler.buffer[ch];
+          for (size_t j = 0; j < oversampler.factor(); ++j)
+            buf[j] = shaper[ch].process(buf[j]);
+        }
+        frame = oversampler.downsample();
+
+        frame[0] *= outGain;
+        frame[1] *= outGain;
+      } else {
+        frame[0] = outGain * shaper[0].process(frame[0]);
+        frame[1] = outGain * shaper[1].process(frame[1]);
+      }
+
+      out0[i] = std::clamp(frame[0], -128.0f, 128.0f);
+      out1[i] = std::clamp(frame[1], -128.0f, 128.0f);
     }
+  }
+}
+
+void DSPBATCH_NAME::setup(double sampleRate, size_t nStream)
+{
+  this->sampleRate = sampleRate;
+  this->nStream = nStream;
+
+  group.resize((nStream + LaneVec::size() - 1) / LaneVec::size());
+  isFirstPush.resize(nStream);
+  reset();
+}
+
+void DSPBATCH_NAME::reset()
+{
+  for (auto &grp : group) grp.oversampler.reset();
 
-    out0[i] = std::clamp(frame[0], -128.0f, 128.0f);
-    out1[i] = std::clamp(frame[1], -128.0f, 128.0f);
+  // Smoothers start from the values of next `setParameters()`.
+  std::fill(isFirstPush.begin(), isFirstPush.end(), true);
+}
+
+uint32_t DSPBATCH_NAME::getLatency()
+{
+  return group.empty() ? 0 : group[0].oversampler.getLatency();
+}
+
+void DSPBATCH_NAME::setParameters(size_t stream, const GlobalParameter &param)
+{
+  using ID = ParameterID::ID;
+
+  if (stream >= nStream) return;
+
+  if (stream == 0) {
+    // Turning off oversampling is the same as 1x.
+    const size_t nStage = param.value[ID::oversample]->getInt()
+      ? 1 + param.value[ID::oversampleFactor]->getInt()
+      : 0;
+    for (auto &each : group)
+      each.oversampler.setup(nStage, param.value[ID::linearPhase]->getInt());
+  }
+
+  auto &grp = group[stream / LaneVec::size()];
+  const int lane = int(stream % LaneVec::size());
+
+  const bool isFirst = isFirstPush[stream];
+  isFirstPush[stream] = false;
+  auto push = [&](ExpSmootherLane<LaneVec> &smoother, float value) {
+    smoother.push(lane, value);
+    if (isFirst) smoother.reset(lane, value);
+  };
+
+  const float smoothness = param.value[ID::smoothness]->getFloat();
+  grp.drive.setTime(lane, sampleRate, smoothness);
+  grp.outputGain.setTime(lane, sampleRate, smoothness);
+
+  push(
+    grp.drive, param.value[ID::drive]->getFloat() * param.value[ID::boost]->getFloat());
+  push(grp.outputGain, param.value[ID::outputGain]->getFloat());
+  grp.order.insert(lane, param.value[ID::order]->getInt());
+  grp.flip.insert(lane, param.value[ID::flip]->getInt());
+  grp.inverse.insert(lane, param.value[ID::inverse]->getInt());
+}
+
+void DSPBATCH_NAME::process(size_t length, const float *const *in, float *const *out)
+{
+  alignas(64) std::array<float, LaneVec::size()> input{};
+  alignas(64) std::array<float, LaneVec::size()> output{};
+
+  for (size_t index = 0; index < group.size(); ++index) {
+    auto &grp = group[index];
+    const size_t first = index * LaneVec::size();
+    const size_t nLane = std::min<size_t>(LaneVec::size(), nStream - first);
+
+    for (size_t i = 0; i < length; ++i) {
+      for (size_t lane = 0; lane < nLane; ++lane) input[lane] = in[first + lane][i];
+      LaneVec x;
+      x.load_a(input.data());
+
+      auto outGain = grp.outputGain.process();
+      grp.shaper.set(grp.drive.process(), grp.order, grp.flip, grp.inverse);
+
+      auto &ovs = grp.oversampler;
+      ovs.upsample(x);
+      for (size_t j = 0; j < ovs.factor(); ++j)
+        ovs.buffer[j] = grp.shaper.process(ovs.buffer[j]);
+      x = outGain * ovs.downsample();
+      min(max(x, -128.0f), 128.0f).store_a(output.data());
+
+      for (size_t lane = 0; lane < nLane; ++lane) out[first + lane][i] = output[lane];
+    }
   }
 }
@@ -15,8 +15,9 @@
 // You should have received a copy of the GNU General Public License
 // along with OddPowShaper.  If not, see <https://www.gnu.org/licenses/>.
 
-#include "../../common/dsp/decimationLowpass.hpp"
 #include "../../common/dsp/somemath.hpp"
+#include "../../lib/vcl/vectorclass.h"
+#include "../../lib/vcl/vectormath_exp.h"
 
 #include <algorithm>
 
@@ -29,15 +30,6 @@ public:
   bool flip = false;
   bool inverse = false;
 
-  Sample x1 = 0;
-  DecimationLowpass16<Sample> lowpass;
-
-  void reset()
-  {
-    x1 = 0;
-    lowpass.reset();
-  }
-
   Sample process(Sample x0)
   {
     Sample absed = somefabs(x0 * drive);
@@ -55,17 +47,44 @@ public:
 
     return std::isfinite(output) ? output : 0;
   }
+};
 
-  Sample process16(Sample x0)
+/**
+`OddPowShaper` on lanes of `Vec`. Each lane has its own parameters. `flip` and `inverse`
+are 1 for on, and 0 for off. `order` is the same integer as the scalar one.
+*/
+template<typename Vec> class OddPowShaperLane {
+public:
+  void set(Vec drive, Vec order, Vec flip, Vec inverse)
   {
-    Sample diff = x0 - x1;
-    for (int i = 0; i < 16; ++i) lowpass.push(process(x1 + i / Sample(16) * diff));
-    x1 = x0;
-    if (std::isfinite(lowpass.output())) return lowpass.output();
+    this->drive = drive;
+    this->exponent = order + 1.0f;
+    this->flip = flip;
+    this->inverse = inverse;
+  }
 
-    reset();
-    return 0;
+  Vec process(Vec x0)
+  {
+    Vec absed = abs(x0 * drive);
+
+    Vec y2 = absed - 2.0f * floor(0.5f * absed) - 1.0f;
+    y2 *= y2;
+
+    Vec expo = pow(y2, exponent);
+    auto isInverse = inverse != 0.0f;
+    expo = select(isInverse, 1.0f / (1.0f + expo), expo);
+    expo = select(flip != 0.0f, 1.0f - expo, expo);
+
+    Vec output = sign_combine(pow(absed, expo), x0);
+    output = select(isInverse, output, output / drive);
+    return select(is_finite(output), output, Vec(0.0f));
   }
+
+private:
+  Vec drive = 1.0f;
+  Vec exponent = 1.0f;
+  Vec flip = 0.0f;
+  Vec inverse = 0.0f;
 };
 
 } // namespace SomeDSP
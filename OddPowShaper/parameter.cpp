@@ -29,3 +29,5 @@ LogScale<double> Scales::outputGain(0.0, 1.0, 0.5, 0.1);
 IntScale<double> Scales::order(15);
 
 LogScale<double> Scales::smoothness(0.0, 0.5, 0.1, 0.04);
+
+IntScale<double> Scales::oversampleFactor(3);
@@ -26,6 +26,7 @@
 #include <utility>
 
 #include "DistrhoPlugin.hpp"
+#include "../common/dspload.hpp"
 #include "dsp/dspcore.hpp"
 
 START_NAMESPACE_DISTRHO
@@ -34,7 +35,9 @@ class OddPowShaper : public Plugin {
 public:
   // Plugin(nParameters, nPrograms, nStates).
   OddPowShaper()
-    : Plugin(ParameterID::ID_ENUM_LENGTH, GlobalParameter::Preset::Preset_ENUM_LENGTH, 0)
+    : Plugin(
+      ParameterID::ID_ENUM_LENGTH + DSPLoadMeter::nParameter,
+      GlobalParameter::Preset::Preset_ENUM_LENGTH, 0)
   {
     auto iset = instrset_detect();
     if (iset >= 10) {
@@ -51,6 +54,7 @@ public:
     }
     dsp->param.validate();
 
+    setLatency(dsp->getLatency());
     sampleRateChanged(getSampleRate());
   }
 
@@ -76,6 +80,11 @@ protected:
 
   void initParameter(uint32_t index, Parameter &parameter) override
   {
+    if (index >= ParameterID::ID_ENUM_LENGTH) {
+      DSPLoadMeter::initParameter(index - ParameterID::ID_ENUM_LENGTH, parameter);
+      return;
+    }
+
     dsp->param.initParameter(index, parameter);
 
     switch (index) {
@@ -89,12 +98,17 @@ protected:
 
   float getParameterValue(uint32_t index) const override
   {
+    if (index >= ParameterID::ID_ENUM_LENGTH)
+      return loadMeter.getParameter(index - ParameterID::ID_ENUM_LENGTH);
     return dsp->param.getFloat(index);
   }
 
   void setParameterValue(uint32_t index, float value) override
   {
     dsp->param.setParameterValue(index, value);
+
+    // DPF doesn't provide the frame of a change, so it's applied at start of next block.
+    dsp->pushParameter(0, index);
   }
 
   void initProgramName(uint32_t index, String &programName) override
@@ -102,14 +116,22 @@ protected:
     dsp->param.initProgramName(index, programName);
   }
 
-  void loadProgram(uint32_t index) override { dsp->param.loadProgram(index); }
+  void loadProgram(uint32_t index) override
+  {
+    dsp->param.loadProgram(index);
+    dsp->parameterQueue.requestResync();
+  }
 
   void initState(uint32_t /* index */, String & /* key */, String & /* defaultValue */) {}
 
   String getState(const char *) const { return String("N/A"); }
   void setState(const char * /* key */, const char *) {}
 
-  void sampleRateChanged(double newSampleRate) { dsp->setup(newSampleRate); }
+  void sampleRateChanged(double newSampleRate)
+  {
+    loadMeter.setup(newSampleRate);
+    dsp->setup(newSampleRate);
+  }
   void activate() { dsp->startup(); }
   void deactivate() { dsp->reset(); }
 
@@ -127,12 +149,16 @@ protected:
     if (!wasPlaying && timePos.playing) dsp->startup();
     wasPlaying = timePos.playing;
 
-    dsp->setParameters(timePos.bbt.beatsPerMinute);
+    if (dsp->parameterQueue.takeResync()) dsp->setParameters(timePos.bbt.beatsPerMinute);
+    auto probe = loadMeter.probe(frames);
     dsp->process(frames, inputs[0], inputs[1], outputs[0], outputs[1]);
+
+    setLatency(dsp->getLatency());
   }
 
 private:
   std::unique_ptr<DSPInterface> dsp;
+  DSPLoadMeter loadMeter;
   bool wasPlaying = false;
 
   DISTRHO_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OddPowShaper)
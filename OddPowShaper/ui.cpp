@@ -78,7 +78,7 @@ constexpr float knobY = knobHeight + labelY;
 constexpr float checkboxWidth = 60.0f;
 constexpr float splashHeight = 20.0f;
 constexpr uint32_t defaultWidth = uint32_t(5 * knobX + 30);
-constexpr uint32_t defaultHeight = uint32_t(30 + knobX + labelY + 3 * margin);
+constexpr uint32_t defaultHeight = uint32_t(30 + knobX + 2 * labelY + 3 * margin);
 
 class OddPowShaperUI : public PluginUIBase {
 protected:
@@ -99,14 +99,7 @@ public:
 
     setGeometryConstraints(defaultWidth, defaultHeight, true, true);
 
-    if (palette.fontPath().size() > 0)
-      fontId = createFontFromFile("main", palette.fontPath().c_str());
-
-    if (fontId < 0) {
-      fontId = createFontFromMemory(
-        "main", (unsigned char *)(FontData::TinosBoldItalicData),
-        FontData::TinosBoldItalicDataSize, false);
-    }
+    loadFont();
 
     using ID = ParameterID::ID;
 
@@ -123,6 +116,16 @@ public:
       left0 + knobX, top1, knobX, labelHeight, uiTextSize, ID::order, Scales::order,
       false, 0, 1);
 
+    const auto top2 = top1 + labelY;
+    addLabel(left0, top2, knobX, labelHeight, uiTextSize, "Factor");
+    std::vector<std::string> oversampleFactorItems{"2x", "4x", "8x", "16x"};
+    addOptionMenu(
+      left0 + knobX, top2, knobX, labelHeight, uiTextSize, ID::oversampleFactor,
+      oversampleFactorItems);
+    addCheckbox(
+      left0 + 2 * knobX + 2 * margin, top2, 1.5f * knobX, labelHeight, uiTextSize,
+      "Linear Phase", ID::linearPhase);
+
     const auto checkboxLeft1 = left0 + 3 * knobX + 2 * margin;
     const auto checkboxHeight = labelY - margin;
     addCheckbox(checkboxLeft1, top0, knobX, labelHeight, uiTextSize, "Flip", ID::flip);
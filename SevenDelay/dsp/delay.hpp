@@ -17,65 +17,96 @@
 
 #pragma once
 
+#include "../../lib/vcl/vectorclass.h"
+
 #include <algorithm>
+#include <array>
 #include <stdlib.h>
+#include <type_traits>
 #include <vector>
 
-template<typename Sample, unsigned char Order> class FractionalDelayLagrange {
-public:
-  void reset()
-  {
-    xd.fill(0.0);
-    diff.fill(0.0);
-  }
+/**
+Lagrange interpolation of last `Order + 1` inputs, evaluated at `Order` fixed fractions
+`(Order - 1 - i) / Order` where i is in [0, Order). Used to write `Order` times upsampled
+signal.
 
-  void push(Sample input)
-  {
-    diff[0] = input - xd[0];
-    for (size_t i = 1; i < Order; ++i) diff[i] = diff[i - 1] - xd[i];
+Interpolated value is a weighted sum of inputs, and weights only depend on fraction. So
+weights are precomputed for each fraction, and each lane of `Vec8f` computes one fraction.
 
-    xd[0] = input;
-    for (size_t i = 1; i < Order; ++i) xd[i] = diff[i - 1];
-  }
+Weights are expanded from Newton's backward difference form:
 
-  Sample at(Sample fraction)
+```
+y = x[0] + sum_{k=1}^{Order} c_k * nabla^k x[0],
+c_k = prod_{m=0}^{k-1} (m - delta) / (m + 1),
+nabla^k x[0] = sum_{j=0}^{k} (-1)^j * binom(k, j) * x[j],
+```
+
+where `x[j]` is j samples before the latest input. `delta = fraction + (Order - 1) / 2`,
+and the division is integer division.
+*/
+template<unsigned char Order> class LagrangePolyphase {
+public:
+  static_assert(Order >= 1 && Order <= 8, "Order must be in [1, 8].");
+
+  LagrangePolyphase()
   {
-    Sample delta = fraction + (Order - 1) / 2;
-    Sample sig = 0.0;
-
-    size_t i = Order;
-    while (i > 0) {
-      size_t next = i - 1;
-      sig = (next - delta) / i * (diff[next] + sig);
-      i = next;
+    std::array<std::array<double, 8>, Order + 1> weight{};
+    for (size_t phase = 0; phase < Order; ++phase) {
+      const double delta = double(Order - 1 - phase) / Order + (Order - 1) / 2;
+      weight[0][phase] = 1.0;
+
+      double c_k = 1.0;
+      for (size_t k = 1; k <= Order; ++k) {
+        c_k *= (double(k - 1) - delta) / double(k);
+
+        double binomial = 1.0;
+        for (size_t j = 0; j <= k; ++j) {
+          weight[j][phase] += (j % 2 == 0 ? c_k : -c_k) * binomial;
+          binomial = binomial * double(k - j) / double(j + 1);
+        }
+      }
     }
 
-    return sig + xd[0];
+    for (size_t j = 0; j <= Order; ++j) {
+      std::array<float, 8> w;
+      for (size_t i = 0; i < w.size(); ++i) w[i] = float(weight[j][i]);
+      co[j].load(w.data());
+    }
   }
 
-  Sample process(Sample input, Sample fraction)
+  void reset() { x.fill(0.0f); }
+
+  // Writes `Order` samples to `dest`.
+  void write(float input, float *dest)
   {
-    push(input);
-    return at(fraction);
+    for (size_t j = Order; j > 0; --j) x[j] = x[j - 1];
+    x[0] = input;
+
+    Vec8f sum = 0.0f;
+    for (size_t j = 0; j <= Order; ++j) sum = mul_add(Vec8f(x[j]), co[j], sum);
+    sum.store_partial(Order, dest);
   }
 
 private:
-  std::array<Sample, Order> xd{};
-  std::array<Sample, Order> diff{};
+  std::array<Vec8f, Order + 1> co;
+  std::array<float, Order + 1> x{};
 };
 
 template<typename Sample, unsigned char Order> class DelayLagrange {
 public:
+  static_assert(std::is_same<Sample, float>::value, "Writer is implemented with Vec8f.");
+
   void setup(Sample sampleRate, Sample time, Sample maxTime)
   {
     this->sampleRate = overSample * sampleRate;
 
+    // Size is a multiple of `overSample`, so a write of `overSample` samples never wraps.
     auto size = (size_t)(maxTime * this->sampleRate);
-    if (size >= INT32_MAX)
-      size = INT32_MAX;
-    else if (size == 0)
-      size += 1;
+    if (size >= INT32_MAX) size = INT32_MAX;
+    size = std::max((size + overSample - 1) / overSample, size_t(1)) * overSample;
+    if (size >= INT32_MAX) size -= overSample;
     buf.resize(size, 0.0);
+    wptr = 0;
 
     setTime(time);
   }
@@ -100,15 +131,9 @@ public:
 
   Sample process(Sample input)
   {
-    wInterp.push(input);
-
-    for (size_t i = 1; i <= overSample; ++i) {
-      Sample wFraction = (overSample - (Sample)i) / overSample;
-
-      buf[wptr] = wInterp.at(wFraction);
-      wptr += 1;
-      while ((size_t)wptr >= buf.size()) wptr -= (int32_t)buf.size();
-    }
+    wInterp.write(input, buf.data() + wptr);
+    wptr += overSample;
+    if ((size_t)wptr >= buf.size()) wptr = 0;
 
     rptr += overSample;
     while (rptr >= (int32_t)buf.size()) rptr -= (int32_t)buf.size();
@@ -125,8 +150,8 @@ private:
   static const size_t fix = (overSample * (Order - 1)) / 2;
   Sample sampleRate = 44100.0;
   Sample rFraction = 0.0;
-  std::vector<Sample> buf{1};
+  std::vector<Sample> buf = std::vector<Sample>(overSample, Sample(0));
   int32_t wptr = 0;
   int32_t rptr = 0;
-  FractionalDelayLagrange<Sample, Order> wInterp;
+  LagrangePolyphase<Order> wInterp;
 };
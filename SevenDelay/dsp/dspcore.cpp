@@ -17,6 +17,10 @@
 
 #include "dspcore.hpp"
 #include "../../common/dsp/constants.hpp"
+#include "../../lib/vcl/vectormath_exp.h"
+#include "../../lib/vcl/vectormath_trig.h"
+
+#include <algorithm>
 
 constexpr size_t channel = 2;
 
@@ -27,14 +31,13 @@ float clamp(float value, float min, float max)
 
 void DSPCore::setup(double sampleRate)
 {
-  SmootherCommon<float>::setSampleRate(sampleRate);
+  smootherCommon.setSampleRate(sampleRate);
 
   for (size_t i = 0; i < delay.size(); ++i)
     delay[i].setup(sampleRate, 1.0f, maxDelayTime);
 
-  for (size_t i = 0; i < filter.size(); ++i) filter[i].setup(sampleRate);
-
-  for (size_t i = 0; i < dcKiller.size(); ++i) dcKiller[i].setup(sampleRate, 0.1);
+  filter.setup(sampleRate);
+  dcKiller.setup(sampleRate, 0.1f);
 
   lfoPhaseTick = twopi / sampleRate;
 
@@ -43,11 +46,9 @@ void DSPCore::setup(double sampleRate)
 
 void DSPCore::reset()
 {
-  for (size_t i = 0; i < channel; ++i) {
-    delay[i].reset();
-    filter[i].reset();
-    dcKiller[i].reset();
-  }
+  for (size_t i = 0; i < channel; ++i) delay[i].reset();
+  filter.reset();
+  dcKiller.reset();
 
   delayOut.fill(0.0f);
 
@@ -66,7 +67,7 @@ void DSPCore::startup()
 
 void DSPCore::setParameters(double tempo)
 {
-  SmootherCommon<float>::setTime(param.value[ParameterID::smoothness]->getFloat());
+  smootherCommon.setTime(param.value[ParameterID::smoothness]->getFloat());
 
   // This won't work if sync is on and tempo < 15. Up to 8 sec or 8/16 beat.
   // 15.0 is come from (60 sec per minute) * (4 beat) / (16 beat).
@@ -80,111 +81,141 @@ void DSPCore::setParameters(double tempo)
 
   float offset = param.value[ParameterID::offset]->getFloat();
   if (offset < 0.0) {
-    interpTime[0].push(time * (1.0 + offset));
-    interpTime[1].push(time);
+    interpTime[0].push(smootherCommon, time * (1.0 + offset));
+    interpTime[1].push(smootherCommon, time);
   } else if (offset > 0.0) {
-    interpTime[0].push(time);
-    interpTime[1].push(time * (1.0 - offset));
+    interpTime[0].push(smootherCommon, time);
+    interpTime[1].push(smootherCommon, time * (1.0 - offset));
   } else {
-    interpTime[0].push(time);
-    interpTime[1].push(time);
+    interpTime[0].push(smootherCommon, time);
+    interpTime[1].push(smootherCommon, time);
   }
 
-  interpWetMix.push(param.value[ParameterID::wetMix]->getFloat());
-  interpDryMix.push(param.value[ParameterID::dryMix]->getFloat());
-  interpFeedback.push(
-    param.value[ParameterID::negativeFeedback]->getInt()
+  interpWetMix.push(smootherCommon, param.value[ParameterID::wetMix]->getFloat());
+  interpDryMix.push(smootherCommon, param.value[ParameterID::dryMix]->getFloat());
+  interpFeedback.push(smootherCommon, param.value[ParameterID::negativeFeedback]->getInt()
       ? -param.value[ParameterID::feedback]->getFloat()
       : param.value[ParameterID::feedback]->getFloat());
-  interpLfoTimeAmount.push(param.value[ParameterID::lfoTimeAmount]->getFloat());
-  interpLfoToneAmount.push(param.value[ParameterID::lfoToneAmount]->getFloat());
+  interpLfoTimeAmount.push(
+    smootherCommon, param.value[ParameterID::lfoTimeAmount]->getFloat());
+  interpLfoToneAmount.push(
+    smootherCommon, param.value[ParameterID::lfoToneAmount]->getFloat());
   if (param.value[ParameterID::lfoTempoSync]->getInt()) {
     const float beat = float(param.value[ParameterID::lfoTempoNumerator]->getInt() + 1)
       / float(param.value[ParameterID::lfoTempoDenominator]->getInt() + 1);
     const float multiplier = Scales::lfoFrequencyMultiplier.map(
       param.value[ParameterID::lfoFrequency]->getNormalized());
-    interpLfoFrequency.push(multiplier * tempo / 480.0f / beat);
+    interpLfoFrequency.push(smootherCommon, multiplier * tempo / 480.0f / beat);
   } else {
-    interpLfoFrequency.push(param.value[ParameterID::lfoFrequency]->getFloat());
+    interpLfoFrequency.push(
+      smootherCommon, param.value[ParameterID::lfoFrequency]->getFloat());
   }
-  interpLfoShape.push(param.value[ParameterID::lfoShape]->getFloat());
+  interpLfoShape.push(smootherCommon, param.value[ParameterID::lfoShape]->getFloat());
 
   float inPan = 2 * param.value[ParameterID::inPan]->getFloat();
   float panInL
     = clamp(inPan + param.value[ParameterID::inSpread]->getFloat() - 1.0, 0.0, 1.0);
   float panInR = clamp(inPan - param.value[ParameterID::inSpread]->getFloat(), 0.0, 1.0);
-  interpPanIn[0].push(panInL);
-  interpPanIn[1].push(panInR);
+  interpPanIn[0].push(smootherCommon, panInL);
+  interpPanIn[1].push(smootherCommon, panInR);
 
   float outPan = 2 * param.value[ParameterID::outPan]->getFloat();
   float panOutL
     = clamp(outPan + param.value[ParameterID::outSpread]->getFloat() - 1.0, 0.0, 1.0);
   float panOutR
     = clamp(outPan - param.value[ParameterID::outSpread]->getFloat(), 0.0, 1.0);
-  interpPanOut[0].push(panOutL);
-  interpPanOut[1].push(panOutR);
+  interpPanOut[0].push(smootherCommon, panOutL);
+  interpPanOut[1].push(smootherCommon, panOutR);
 
-  interpToneCutoff.push(param.value[ParameterID::toneCutoff]->getFloat());
-  interpToneQ.push(param.value[ParameterID::toneQ]->getFloat());
+  interpToneCutoff.push(smootherCommon, param.value[ParameterID::toneCutoff]->getFloat());
+  interpToneQ.push(smootherCommon, param.value[ParameterID::toneQ]->getFloat());
   interpToneMix.push(
+    smootherCommon,
     Scales::toneMix.map(param.value[ParameterID::toneCutoff]->getNormalized()));
 
-  interpDCKill.push(param.value[ParameterID::dckill]->getFloat());
+  interpDCKill.push(smootherCommon, param.value[ParameterID::dckill]->getFloat());
   interpDCKillMix.push(
+    smootherCommon,
     Scales::dckillMix.reverseMap(param.value[ParameterID::dckill]->getNormalized()));
 }
 
 void DSPCore::process(
   const size_t length, const float *in0, const float *in1, float *out0, float *out1)
 {
-  SmootherCommon<float>::setBufferSize(length);
-
-  for (size_t i = 0; i < length; ++i) {
-    auto sign = (pi < lfoPhase) - (lfoPhase < pi);
-    const float lfo = sign * powf(fabsf(sin(lfoPhase)), interpLfoShape.process());
-    const float lfoTime = interpLfoTimeAmount.process() * (1.0f + lfo);
-
-    delay[0].setTime(interpTime[0].process() + lfoTime);
-    delay[1].setTime(interpTime[1].process() + lfoTime);
-
-    const float feedback = interpFeedback.process();
-    const float inL = in0[i] + feedback * delayOut[0];
-    const float inR = in1[i] + feedback * delayOut[1];
-    delayOut[0] = delay[0].process(inL + interpPanIn[0].process() * (inR - inL));
-    delayOut[1] = delay[1].process(inL + interpPanIn[1].process() * (inR - inL));
-
-    const float lfoTone = interpLfoToneAmount.process() * (0.5f * lfo + 0.5f);
-    float toneCutoff = interpToneCutoff.process() * lfoTone * lfoTone;
-    if (toneCutoff < 20.0f) toneCutoff = 20.0f;
-    const float toneQ = interpToneQ.process();
-    filter[0].setCutoffQ(toneCutoff, toneQ);
-    filter[1].setCutoffQ(toneCutoff, toneQ);
-    float filterOutL = filter[0].process(delayOut[0]);
-    float filterOutR = filter[1].process(delayOut[1]);
-    const float toneMix = interpToneMix.process();
-    delayOut[0] = filterOutL + toneMix * (delayOut[0] - filterOutL);
-    delayOut[1] = filterOutR + toneMix * (delayOut[1] - filterOutR);
-
-    const float dckill = interpDCKill.process();
-    dcKiller[0].setCutoff(dckill);
-    dcKiller[1].setCutoff(dckill);
-    filterOutL = dcKiller[0].process(delayOut[0]);
-    filterOutR = dcKiller[1].process(delayOut[1]);
-    const float dckillMix = interpDCKillMix.process();
-    // dckillmix == 1 -> delayout
-    delayOut[0] = filterOutL + dckillMix * (delayOut[0] - filterOutL);
-    delayOut[1] = filterOutR + dckillMix * (delayOut[1] - filterOutR);
-
-    const float wet = interpWetMix.process();
-    const float dry = interpDryMix.process();
-    const float outL = wet * delayOut[0];
-    const float outR = wet * delayOut[1];
-    out0[i] = dry * in0[i] + outL + interpPanOut[0].process() * (outR - outL);
-    out1[i] = dry * in1[i] + outL + interpPanOut[1].process() * (outR - outL);
-
-    if (!(param.value[ParameterID::lfoHold]->getInt())) {
-      lfoPhase += interpLfoFrequency.process() * lfoPhaseTick;
-      if (lfoPhase > twopi) lfoPhase -= pi;
+  smootherCommon.setBufferSize(length);
+
+  const bool lfoHold = param.value[ParameterID::lfoHold]->getInt();
+
+  alignas(64) std::array<float, controlInterval> lfoPhases{};
+  alignas(64) std::array<float, controlInterval> lfoShapes{};
+  alignas(64) std::array<float, controlInterval> lfo{};
+
+  for (size_t start = 0; start < length; start += controlInterval) {
+    const size_t nSample = std::min(controlInterval, length - start);
+
+    // Tone and DC killer parameters are only used at the end of control interval.
+    float lfoToneAmount = 0;
+    float toneCutoff = 0;
+    float toneQ = 0;
+    float dckill = 0;
+    for (size_t j = 0; j < nSample; ++j) {
+      lfoPhases[j] = float(lfoPhase);
+      lfoShapes[j] = interpLfoShape.process();
+      lfoToneAmount = interpLfoToneAmount.process();
+      toneCutoff = interpToneCutoff.process();
+      toneQ = interpToneQ.process();
+      dckill = interpDCKill.process();
+
+      if (!lfoHold) {
+        lfoPhase += interpLfoFrequency.process() * lfoPhaseTick;
+        if (lfoPhase > twopi) lfoPhase -= pi;
+      }
+    }
+
+    Vec16f phase;
+    Vec16f shape;
+    phase.load_a(lfoPhases.data());
+    shape.load_a(lfoShapes.data());
+    Vec16f sign = select(phase > pi, Vec16f(1.0f), Vec16f(0.0f))
+      - select(phase < pi, Vec16f(1.0f), Vec16f(0.0f));
+    (sign * pow(abs(sin(phase)), shape)).store_a(lfo.data());
+
+    const float lfoTone = lfoToneAmount * (0.5f * lfo[nSample - 1] + 0.5f);
+    filter.setCutoffQ(std::max(toneCutoff * lfoTone * lfoTone, 20.0f), toneQ, nSample);
+    dcKiller.setCutoff(dckill, nSample);
+
+    for (size_t j = 0; j < nSample; ++j) {
+      const size_t i = start + j;
+
+      const float lfoTime = interpLfoTimeAmount.process() * (1.0f + lfo[j]);
+      delay[0].setTime(interpTime[0].process() + lfoTime);
+      delay[1].setTime(interpTime[1].process() + lfoTime);
+
+      const float feedback = interpFeedback.process();
+      const float inL = in0[i] + feedback * delayOut[0];
+      const float inR = in1[i] + feedback * delayOut[1];
+      const float panInL = interpPanIn[0].process();
+      const float panInR = interpPanIn[1].process();
+      Vec4f sig(
+        delay[0].process(inL + panInL * (inR - inL)),
+        delay[1].process(inL + panInR * (inR - inL)), 0.0f, 0.0f);
+
+      Vec4f filtered = filter.process(sig);
+      sig = filtered + interpToneMix.process() * (sig - filtered);
+
+      // dckillmix == 1 -> delayout
+      filtered = dcKiller.process(sig);
+      sig = filtered + interpDCKillMix.process() * (sig - filtered);
+
+      delayOut[0] = sig[0];
+      delayOut[1] = sig[1];
+
+      const float wet = interpWetMix.process();
+      const float dry = interpDryMix.process();
+      const float outL = wet * delayOut[0];
+      const float outR = wet * delayOut[1];
+      out0[i] = dry * in0[i] + outL + interpPanOut[0].process() * (outR - outL);
+      out1[i] = dry * in1[i] + outL + interpPanOut[1].process() * (outR - outL);
     }
   }
 }
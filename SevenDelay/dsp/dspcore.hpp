@@ -27,8 +27,8 @@
 
 // Lagrange delay is very slow at debug build. If that's the case set Order to 1.
 using DelayTypeName = DelayLagrange<float, 7>;
-using FilterTypeName = SomeDSP::SVF<float>;
-using DCKillerTypeName = SomeDSP::BiquadHighPass<float>;
+using FilterTypeName = SomeDSP::SVFStereo;
+using DCKillerTypeName = SomeDSP::BiquadHighPassStereo;
 
 using namespace SomeDSP;
 
@@ -46,6 +46,11 @@ public:
 protected:
   const float pi = 3.14159265358979323846;
 
+  // Filter coefficients are updated once per this number of samples.
+  static constexpr size_t controlInterval = 16;
+
+  SmootherCommon<float> smootherCommon;
+
   std::array<LinearSmoother<float>, 2> interpTime{};
   std::array<LinearSmoother<float>, 2> interpPanIn{};
   std::array<LinearSmoother<float>, 2> interpPanOut{};
@@ -66,6 +71,6 @@ protected:
   double lfoPhaseTick;
   std::array<float, 2> delayOut{};
   std::array<DelayTypeName, 2> delay;
-  std::array<FilterTypeName, 2> filter;
-  std::array<DCKillerTypeName, 2> dcKiller;
+  FilterTypeName filter;
+  DCKillerTypeName dcKiller;
 };
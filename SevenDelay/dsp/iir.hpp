@@ -18,126 +18,155 @@
 #pragma once
 
 #include "../../common/dsp/constants.hpp"
+#include "../../lib/vcl/vectorclass.h"
 
+#include <array>
 #include <cmath>
 
 namespace SomeDSP {
 
-inline double somesin(double x) { return ::sin(x); }
-inline float somesin(float x) { return ::sinf(x); }
-inline double somecos(double x) { return ::cos(x); }
-inline float somecos(float x) { return ::cosf(x); }
-inline double sometan(double x) { return ::tan(x); }
-inline float sometan(float x) { return ::tanf(x); }
+// Filters in this file process left and right channel in lane 0 and 1 of `Vec4f`.
+// Coefficients are shared by both channels, and meant to be set at control rate.
 
-template<typename Sample> class SVF {
+/**
+Each coefficient is broadcasted to all lanes, and linearly interpolated to the new value
+over `nSample` samples. So `process()` of filters doesn't compute trigonometric functions
+or divisions.
+*/
+template<size_t N> class CoefficientRamp {
 public:
-  void setup(Sample sampleRate) { this->sampleRate = sampleRate; }
+  std::array<Vec4f, N> value{};
 
-  void setCoefficient()
+  // Next `set()` jumps to the target.
+  void reset() { isFresh = true; }
+
+  void set(const std::array<float, N> &target, size_t nSample)
   {
-    Sample omega_c = sometan(Sample(pi) * cutoff / sampleRate);
-    g = omega_c / (Sample(1.0) + omega_c);
-    twoR = 2 * resonance;
-    g1 = twoR + g;
-    d = Sample(1.0) / (Sample(1.0) + Sample(2.0) * resonance + g * g);
+    if (isFresh || nSample == 0) {
+      for (size_t i = 0; i < N; ++i) value[i] = target[i];
+      counter = 0;
+      isFresh = false;
+      return;
+    }
+
+    for (size_t i = 0; i < N; ++i) ramp[i] = (target[i] - value[i][0]) / float(nSample);
+    counter = nSample;
   }
 
-  // q in (0, 1].
-  void setCutoffQ(Sample hz, Sample q)
+  void process()
   {
-    cutoff = hz > 0.0 ? hz : 0.0;
-    resonance = q < Sample(1e-5) ? Sample(1e-5) : q;
-    setCoefficient();
+    if (counter == 0) return;
+    --counter;
+    for (size_t i = 0; i < N; ++i) value[i] += ramp[i];
   }
 
+private:
+  std::array<Vec4f, N> ramp{};
+  size_t counter = 0;
+  bool isFresh = true;
+};
+
+class SVFStereo {
+public:
+  void setup(float sampleRate) { this->sampleRate = sampleRate; }
+
   void reset()
   {
-    yLP = yBP = yHP = 0.0;
-    s1 = s2 = 0.0;
+    s1 = s2 = 0.0f;
+    co.reset();
+  }
+
+  // q in (0, 1].
+  void setCutoffQ(float hz, float q, size_t nSample)
+  {
+    const float cutoff = hz > 0.0f ? hz : 0.0f;
+    const float resonance = q < 1e-5f ? 1e-5f : q;
+
+    const float omega_c = tanf(float(pi) * cutoff / sampleRate);
+    const float g = omega_c / (1.0f + omega_c);
+    const float twoR = 2.0f * resonance;
+    co.set({g, twoR + g, 1.0f / (1.0f + 2.0f * resonance + g * g), twoR}, nSample);
   }
 
-  Sample process(Sample input)
+  Vec4f process(Vec4f input)
   {
-    yHP = (input - g1 * s1 - s2) * d;
+    co.process();
+    const auto &g = co.value[0];
+    const auto &g1 = co.value[1];
+    const auto &d = co.value[2];
+    const auto &twoR = co.value[3];
+
+    Vec4f yHP = (input - g1 * s1 - s2) * d;
 
-    Sample v1 = g * yHP;
-    yBP = v1 + s1;
+    Vec4f v1 = g * yHP;
+    Vec4f yBP = v1 + s1;
     s1 = yBP + v1;
 
-    Sample v2 = g * yBP;
-    yLP = v2 + s2;
+    Vec4f v2 = g * yBP;
+    Vec4f yLP = v2 + s2;
     s2 = yLP + v2;
 
-    Sample output = input - Sample(2.0) * twoR * yBP;
-    if (std::isfinite(output)) return output;
+    Vec4f output = input - 2.0f * twoR * yBP;
+    auto isFinite = is_finite(output);
+    if (horizontal_and(isFinite)) return output;
 
-    reset();
-    return 0.0;
+    s1 = select(isFinite, s1, Vec4f(0.0f));
+    s2 = select(isFinite, s2, Vec4f(0.0f));
+    return select(isFinite, output, Vec4f(0.0f));
   }
 
 protected:
-  Sample sampleRate = 44100;
-  Sample cutoff = 0.5;
-  Sample resonance = 0.5;
+  float sampleRate = 44100;
 
-  Sample yLP = 0.0;
-  Sample yBP = 0.0;
-  Sample yHP = 0.0;
+  Vec4f s1 = 0.0f;
+  Vec4f s2 = 0.0f;
 
-  Sample s1 = 0.0;
-  Sample s2 = 0.0;
-
-  Sample g = 0.0;
-  Sample g1 = 0.0;
-  Sample d = 0.0;
-  Sample twoR = 0.0;
+  CoefficientRamp<4> co; // g, g1, d, twoR.
 };
 
 // http://www.musicdsp.org/files/Audio-EQ-Cookbook.txt
-template<typename Sample> class BiquadHighPass {
+class BiquadHighPassStereo {
 public:
   // q in (0, 1].
-  void setup(Sample sampleRate, Sample q)
+  void setup(float sampleRate, float q)
   {
     fs = sampleRate;
-    this->q = q < Sample(1e-5) ? Sample(1e-5) : q;
+    this->q = q < 1e-5f ? 1e-5f : q;
   }
 
   void reset()
   {
-    b0 = b1 = b2 = 0.0;
-    a0 = a1 = a2 = 0.0;
-    x1 = x2 = 0.0;
-    y1 = y2 = 0.0;
+    x1 = x2 = 0.0f;
+    y1 = y2 = 0.0f;
+    co.reset();
   }
 
-  void setCutoff(Sample hz)
+  void setCutoff(float hz, size_t nSample)
   {
-    f0 = hz > 0.0 ? hz : 0.0;
-
-    Sample w0 = Sample(twopi) * f0 / fs;
-    Sample cos_w0 = somecos(w0);
-    Sample sin_w0 = somesin(w0);
-
-    Sample alpha = sin_w0 / (Sample(2.0) * q);
-    b0 = (Sample(1.0) + cos_w0) / Sample(2.0);
-    b1 = -(Sample(1.0) + cos_w0);
-    b2 = (Sample(1.0) + cos_w0) / Sample(2.0);
-    a0 = Sample(1.0) + alpha;
-    a1 = -Sample(2.0) * cos_w0;
-    a2 = Sample(1.0) - alpha;
-
-    b0 /= a0;
-    b1 /= a0;
-    b2 /= a0;
-    a1 /= a0;
-    a2 /= a0;
+    const float f0 = hz > 0.0f ? hz : 0.0f;
+
+    const float w0 = float(twopi) * f0 / fs;
+    const float cos_w0 = cosf(w0);
+    const float sin_w0 = sinf(w0);
+
+    const float alpha = sin_w0 / (2.0f * q);
+    const float a0 = 1.0f + alpha;
+    const float b0 = (1.0f + cos_w0) / 2.0f;
+    co.set(
+      {b0 / a0, -(1.0f + cos_w0) / a0, b0 / a0, -2.0f * cos_w0 / a0, (1.0f - alpha) / a0},
+      nSample);
   }
 
-  Sample process(Sample input)
+  Vec4f process(Vec4f input)
   {
-    Sample output = b0 * input + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+    co.process();
+    const auto &b0 = co.value[0];
+    const auto &b1 = co.value[1];
+    const auto &b2 = co.value[2];
+    const auto &a1 = co.value[3];
+    const auto &a2 = co.value[4];
+
+    Vec4f output = b0 * input + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
 
     x2 = x1;
     x1 = input;
@@ -149,20 +178,15 @@ public:
   }
 
 protected:
-  Sample fs = 44100;
-  Sample f0 = 0.5;
-  Sample q = 0.5;
-
-  Sample b0 = 0.0;
-  Sample b1 = 0.0;
-  Sample b2 = 0.0;
-  Sample a0 = 0.0;
-  Sample a1 = 0.0;
-  Sample a2 = 0.0;
-  Sample x1 = 0.0;
-  Sample x2 = 0.0;
-  Sample y1 = 0.0;
-  Sample y2 = 0.0;
+  float fs = 44100;
+  float q = 0.5;
+
+  Vec4f x1 = 0.0f;
+  Vec4f x2 = 0.0f;
+  Vec4f y1 = 0.0f;
+  Vec4f y2 = 0.0f;
+
+  CoefficientRamp<5> co; // b0, b1, b2, a1, a2.
 };
 
 } // namespace SomeDSP
@@ -21,6 +21,7 @@
 // along with SevenDelay.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "DistrhoPlugin.hpp"
+#include "../common/dspload.hpp"
 #include "dsp/dspcore.hpp"
 
 START_NAMESPACE_DISTRHO
@@ -29,7 +30,9 @@ class SevenDelay : public Plugin {
 public:
   // Plugin(nParameters, nPrograms, nStates).
   SevenDelay()
-    : Plugin(ParameterID::ID_ENUM_LENGTH, GlobalParameter::Preset::Preset_ENUM_LENGTH, 0)
+    : Plugin(
+      ParameterID::ID_ENUM_LENGTH + DSPLoadMeter::nParameter,
+      GlobalParameter::Preset::Preset_ENUM_LENGTH, 0)
   {
     sampleRateChanged(getSampleRate());
   }
@@ -55,6 +58,11 @@ protected:
 
   void initParameter(uint32_t index, Parameter &parameter) override
   {
+    if (index >= ParameterID::ID_ENUM_LENGTH) {
+      DSPLoadMeter::initParameter(index - ParameterID::ID_ENUM_LENGTH, parameter);
+      return;
+    }
+
     dsp.param.initParameter(index, parameter);
 
     switch (index) {
@@ -68,6 +76,8 @@ protected:
 
   float getParameterValue(uint32_t index) const override
   {
+    if (index >= ParameterID::ID_ENUM_LENGTH)
+      return loadMeter.getParameter(index - ParameterID::ID_ENUM_LENGTH);
     return dsp.param.getFloat(index);
   }
 
@@ -83,7 +93,11 @@ protected:
 
   void loadProgram(uint32_t index) override { dsp.param.loadProgram(index); }
 
-  void sampleRateChanged(double newSampleRate) { dsp.setup(newSampleRate); }
+  void sampleRateChanged(double newSampleRate)
+  {
+    loadMeter.setup(newSampleRate);
+    dsp.setup(newSampleRate);
+  }
 
   void activate() { dsp.startup(); }
 
@@ -105,11 +119,13 @@ protected:
     wasPlaying = timePos.playing;
 
     dsp.setParameters(timePos.bbt.beatsPerMinute);
+    auto probe = loadMeter.probe(frames);
     dsp.process(frames, inputs[0], inputs[1], outputs[0], outputs[1]);
   }
 
 private:
   DSPCore dsp;
+  DSPLoadMeter loadMeter;
   bool wasPlaying = false;
 
   DISTRHO_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SevenDelay)
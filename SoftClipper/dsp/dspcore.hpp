@@ -18,12 +18,16 @@
 #pragma once
 
 #include "../../common/dsp/constants.hpp"
+#include "../../common/dsp/oversampler.hpp"
 #include "../../common/dsp/smoother.hpp"
+#include "../../common/parameterqueue.hpp"
 #include "../parameter.hpp"
 
 #include "softclipper.hpp"
 
 #include <array>
+#include <memory>
+#include <vector>
 
 using namespace SomeDSP;
 
@@ -32,17 +36,44 @@ public:
   virtual ~DSPInterface(){};
 
   GlobalParameter param;
+  ParameterQueue<256> parameterQueue;
+
+  // Realtime safe. Call after writing the value to `param`.
+  void pushParameter(uint32_t frame, uint32_t id)
+  {
+    parameterQueue.push(frame, id, param.getFloat(id));
+  }
 
   virtual void setup(double sampleRate) = 0;
   virtual void reset() = 0;   // Stop sounds.
   virtual void startup() = 0; // Reset phase, random seed etc.
   virtual uint32_t getLatency() = 0;
-  virtual void setParameters(float tempo) = 0;
+  virtual void setParameters(float tempo) = 0; // Reads all values in `param`.
   virtual void process(
     const size_t length, const float *in0, const float *in1, float *out0, float *out1)
     = 0;
 };
 
+/**
+Processes independent mono streams in SIMD lanes, for hosts running many instances. Each
+stream has its own parameters and states. `laneWidth()` streams are packed into a vector.
+A stereo instance takes 2 streams. Bypass is left to the caller.
+
+Oversampling settings are shared in a batch, and taken from stream 0. Instances with
+different oversampling settings should go into different batches.
+*/
+class DSPBatchInterface {
+public:
+  virtual ~DSPBatchInterface(){};
+
+  virtual void setup(double sampleRate, size_t nStream) = 0; // Not realtime safe.
+  virtual void reset() = 0;
+  virtual size_t laneWidth() = 0;
+  virtual uint32_t getLatency() = 0;
+  virtual void setParameters(size_t stream, const GlobalParameter &param) = 0;
+  virtual void process(size_t length, const float *const *in, float *const *out) = 0;
+};
+
 #define DSPCORE_CLASS(INSTRSET)                                                          \
   class DSPCore_##INSTRSET final : public DSPInterface {                                 \
   public:                                                                                \
@@ -59,11 +90,16 @@ public:
       float *out1) override;                                                             \
                                                                                          \
   private:                                                                               \
+    void applyParameter(uint32_t id, double value);                                      \
+                                                                                         \
     float sampleRate = 44100.0f;                                                         \
+    SmootherCommon<float> smootherCommon;                                                \
                                                                                          \
     std::array<SoftClipper<float>, 2> shaper;                                            \
+    Oversampler oversampler;                                                             \
                                                                                          \
     bool oversample = true;                                                              \
+    bool isFirstPush = true;                                                             \
     ExpSmoother<float> interpInputGain;                                                  \
     ExpSmoother<float> interpOutputGain;                                                 \
     ExpSmoother<float> interpClip;                                                       \
@@ -76,3 +112,49 @@ DSPCORE_CLASS(AVX512)
 DSPCORE_CLASS(AVX2)
 DSPCORE_CLASS(SSE41)
 DSPCORE_CLASS(SSE2)
+
+#define DSPBATCH_CLASS(INSTRSET, LANE)                                                   \
+  class DSPBatch_##INSTRSET final : public DSPBatchInterface {                           \
+  public:                                                                                \
+    using LaneVec = LANE;                                                                \
+                                                                                         \
+    void setup(double sampleRate, size_t nStream) override;                              \
+    void reset() override;                                                               \
+    size_t laneWidth() override { return LaneVec::size(); }                              \
+    uint32_t getLatency() override;                                                      \
+    void setParameters(size_t stream, const GlobalParameter &param) override;            \
+    void process(size_t length, const float *const *in, float *const *out) override;     \
+                                                                                         \
+  private:                                                                               \
+    struct Group {                                                                       \
+      LaneOversampler<LaneVec> oversampler;                                              \
+      SoftClipperLane<LaneVec> shaper;                                                   \
+      ExpSmootherLane<LaneVec> inputGain;                                                \
+      ExpSmootherLane<LaneVec> outputGain;                                               \
+      ExpSmootherLane<LaneVec> clip;                                                     \
+      ExpSmootherLane<LaneVec> order;                                                    \
+      ExpSmootherLane<LaneVec> ratio;                                                    \
+      ExpSmootherLane<LaneVec> slope;                                                    \
+    };                                                                                   \
+                                                                                         \
+    float sampleRate = 44100.0f;                                                         \
+    size_t nStream = 0;                                                                  \
+    std::vector<Group> group;                                                            \
+    std::vector<bool> isFirstPush;                                                       \
+  };
+
+DSPBATCH_CLASS(AVX512, Vec16f)
+DSPBATCH_CLASS(AVX2, Vec8f)
+DSPBATCH_CLASS(SSE41, Vec4f)
+DSPBATCH_CLASS(SSE2, Vec4f)
+
+// Picks the widest lanes available on this CPU. Returns nullptr when SSE2 is missing.
+inline std::unique_ptr<DSPBatchInterface> createDSPBatch()
+{
+  auto iset = instrset_detect();
+  if (iset >= 10) return std::make_unique<DSPBatch_AVX512>();
+  if (iset >= 8) return std::make_unique<DSPBatch_AVX2>();
+  if (iset >= 5) return std::make_unique<DSPBatch_SSE41>();
+  if (iset >= 2) return std::make_unique<DSPBatch_SSE2>();
+  return nullptr;
+}
@@ -15,8 +15,9 @@
 // You should have received a copy of the GNU General Public License
 // along with SoftClipper.  If not, see <https://www.gnu.org/licenses/>.
 
-#include "../../common/dsp/decimationLowpass.hpp"
 #include "../../common/dsp/somemath.hpp"
+#include "../../lib/vcl/vectorclass.h"
+#include "../../lib/vcl/vectormath_exp.h"
 
 #include <algorithm>
 
@@ -29,15 +30,6 @@ public:
   Sample ratio = 1; // In [0, 1].
   Sample slope = 0; // In [0, 1].
 
-  Sample x1 = 0;
-  DecimationLowpass16<Sample> lowpass;
-
-  void reset()
-  {
-    x1 = 0;
-    lowpass.reset();
-  }
-
   void set(Sample clip, Sample order, Sample ratio, Sample slope)
   {
     this->clipY = clip;
@@ -61,17 +53,45 @@ public:
     return somecopysign(
       slope * (absed - xs) + clipY + scale * somepow(xc - xs, order), x0);
   }
+};
 
-  Sample process16(Sample x0)
+/**
+`SoftClipper` on lanes of `Vec`. Each lane has its own parameters. Terms that only depend
+on parameters are computed in `set()`, and reused for oversampled samples.
+*/
+template<typename Vec> class SoftClipperLane {
+public:
+  void set(Vec clip, Vec order, Vec ratio, Vec slope)
   {
-    Sample diff = x0 - x1;
-    for (int i = 0; i < 16; ++i) lowpass.push(process(x1 + i / Sample(16) * diff));
-    x1 = x0;
-    if (std::isfinite(lowpass.output())) return lowpass.output();
+    this->clipY = clip;
+    this->order = order;
+    this->slope = slope;
+
+    rc = clip * ratio;
+    xc = rc + order * (clip - rc);
+    scale = (rc - clip) / pow(xc - rc, order);
+    xs = xc - pow(-slope / (scale * order), 1.0f / (order - 1.0f));
+    tail = clip + scale * pow(xc - xs, order);
+  }
 
-    reset();
-    return 0;
+  Vec process(Vec x0)
+  {
+    Vec absed = abs(x0);
+    Vec curve = clipY + scale * pow(xc - absed, order);
+    Vec line = slope * (absed - xs) + tail;
+    Vec output = sign_combine(select(absed < xs, curve, line), x0);
+    return select(absed <= rc, x0, output);
   }
+
+private:
+  Vec clipY = 1.0f;
+  Vec order = 2.0f;
+  Vec slope = 0.0f;
+  Vec rc = 1.0f;
+  Vec xc = 1.0f;
+  Vec scale = 0.0f;
+  Vec xs = 1.0f;
+  Vec tail = 1.0f;
 };
 
 } // namespace SomeDSP
@@ -29,3 +29,5 @@ LogScale<double> Scales::clip(0.0, 32.0, 0.5, 4.0);
 IntScale<double> Scales::orderInteger(16);
 
 LogScale<double> Scales::smoothness(0.0, 0.5, 0.1, 0.04);
+
+IntScale<double> Scales::oversampleFactor(3);
@@ -50,6 +50,9 @@ enum ID {
 
   smoothness,
 
+  oversampleFactor,
+  linearPhase,
+
   ID_ENUM_LENGTH,
 };
 } // namespace ParameterID
@@ -64,15 +67,15 @@ struct Scales {
   static SomeDSP::IntScale<double> orderInteger;
 
   static SomeDSP::LogScale<double> smoothness;
+
+  static SomeDSP::IntScale<double> oversampleFactor;
 };
 
 struct GlobalParameter : public ParameterInterface {
-  std::vector<std::unique_ptr<ValueInterface>> value;
+  ValueArray<ParameterID::ID_ENUM_LENGTH> value;
 
   GlobalParameter()
   {
-    value.resize(ParameterID::ID_ENUM_LENGTH);
-
     using ID = ParameterID::ID;
     using LinearValue = FloatValue<SomeDSP::LinearScale<double>>;
     using LogValue = FloatValue<SomeDSP::LogScale<double>>;
@@ -105,6 +108,11 @@ struct GlobalParameter : public ParameterInterface {
 
     value[ID::smoothness] = std::make_unique<LogValue>(
       0.1, Scales::smoothness, "smoothness", kParameterIsAutomable);
+
+    value[ID::oversampleFactor] = std::make_unique<IntValue>(
+      3, Scales::oversampleFactor, "oversampleFactor", kParameterIsAutomable);
+    value[ID::linearPhase] = std::make_unique<IntValue>(
+      0, Scales::boolScale, "linearPhase", kParameterIsAutomable | kParameterIsBoolean);
   }
 
 #ifndef TEST_BUILD
@@ -117,10 +125,7 @@ struct GlobalParameter : public ParameterInterface {
 
   size_t idLength() override { return value.size(); }
 
-  void resetParameter()
-  {
-    for (auto &val : value) val->setFromNormalized(val->getDefaultNormalized());
-  }
+  void resetParameter() { value.reset(); }
 
   double getNormalized(uint32_t index) const override
   {
@@ -80,7 +80,7 @@ constexpr float knobY = knobHeight + labelY;
 constexpr float checkboxWidth = 60.0f;
 constexpr float splashHeight = 20.0f;
 constexpr uint32_t defaultWidth = uint32_t(8 * knobX + 30);
-constexpr uint32_t defaultHeight = uint32_t(30 + knobX + labelY + 3 * margin);
+constexpr uint32_t defaultHeight = uint32_t(30 + 3 * labelY + labelHeight);
 
 class SoftClipperUI : public PluginUIBase {
 protected:
@@ -101,14 +101,7 @@ public:
 
     setGeometryConstraints(defaultWidth, defaultHeight, true, true);
 
-    if (palette.fontPath().size() > 0)
-      fontId = createFontFromFile("main", palette.fontPath().c_str());
-
-    if (fontId < 0) {
-      fontId = createFontFromMemory(
-        "main", (unsigned char *)(FontData::TinosBoldItalicData),
-        FontData::TinosBoldItalicDataSize, false);
-    }
+    loadFont();
 
     using ID = ParameterID::ID;
 
@@ -141,6 +134,17 @@ public:
     addCheckbox(
       left1, top0 + 2 * labelY, knobX, labelHeight, uiTextSize, "OverSample",
       ID::oversample);
+    addCheckbox(
+      left2, top0 + 2 * labelY, 1.5f * knobX, labelHeight, uiTextSize, "Linear Phase",
+      ID::linearPhase);
+
+    auto factorLabel
+      = addLabel(left1, top0 + 3 * labelY, knobX, labelHeight, uiTextSize, "Factor");
+    factorLabel->setTextAlign(ALIGN_LEFT | ALIGN_MIDDLE);
+    std::vector<std::string> oversampleFactorItems{"2x", "4x", "8x", "16x"};
+    addOptionMenu(
+      left2, top0 + 3 * labelY, knobX, labelHeight, uiTextSize, ID::oversampleFactor,
+      oversampleFactorItems);
 
     // Plugin name.
     const auto splashTop = defaultHeight - splashHeight - 15.0f;
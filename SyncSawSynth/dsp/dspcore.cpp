@@ -16,7 +16,29 @@
 // along with SyncSawSynth.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "dspcore.hpp"
-#include <iostream>
+
+#include "../../lib/juce_FastMathApproximations.h"
+#include "../../lib/vcl/vectormath_exp.h"
+
+#if INSTRSET >= 10
+  #define PROCESSING_UNIT_NAME ProcessingUnit_AVX512
+  #define NOTE_NAME Note_AVX512
+  #define DSPCORE_NAME DSPCore_AVX512
+#elif INSTRSET >= 8
+  #define PROCESSING_UNIT_NAME ProcessingUnit_AVX2
+  #define NOTE_NAME Note_AVX2
+  #define DSPCORE_NAME DSPCore_AVX2
+#elif INSTRSET >= 5
+  #define PROCESSING_UNIT_NAME ProcessingUnit_SSE41
+  #define NOTE_NAME Note_SSE41
+  #define DSPCORE_NAME DSPCore_SSE41
+#elif INSTRSET >= 2
+  #define PROCESSING_UNIT_NAME ProcessingUnit_SSE2
+  #define NOTE_NAME Note_SSE2
+  #define DSPCORE_NAME DSPCore_SSE2
+#else
+  #error Unsupported instruction set
+#endif
 
 inline float clamp(float value, float min, float max)
 {
@@ -28,7 +50,7 @@ inline float midiNoteToFrequency(float pitch, float tuning)
   return 440.0f * powf(2.0f, ((pitch - 69.0f) * 100.0f + tuning) / 1200.0f);
 }
 
-float paramToPitch(float semi, float cent, float bend)
+inline float paramToPitch(float semi, float cent, float bend)
 {
   return powf(2.0f, (100.0f * floorf(semi) + cent + (bend - 0.5f) * 400.0f) / 1200.0f);
 }
@@ -40,221 +62,145 @@ inline float tuneFixedFreq(float value, float mod)
   return 2.0f * value * value * value * (1.0f + mod);
 }
 
-template<typename Sample>
-void Note<Sample>::setup(
+void NOTE_NAME::noteOn(
   int32_t noteId,
-  Sample normalizedKey,
-  Sample frequency,
-  Sample velocity,
+  float normalizedKey,
+  float frequency,
+  float velocity,
+  std::array<PROCESSING_UNIT_NAME, nUnit> &units,
   GlobalParameter &param)
 {
+  using ID = ParameterID::ID;
+
   state = NoteState::active;
   id = noteId;
-  this->normalizedKey = normalizedKey;
-  this->frequency = frequency;
-  this->velocity = velocity;
-
-  if (param.value[ParameterID::osc1PhaseLock]->getInt())
-    saw1.setPhase(param.value[ParameterID::osc1Phase]->getFloat());
-  if (param.value[ParameterID::osc2PhaseLock]->getInt())
-    saw2.setPhase(param.value[ParameterID::osc2Phase]->getFloat());
-
-  if (!param.value[ParameterID::filterDirty]->getInt()) {
-    oscBuffer.fill(0.0f);
-    filter.clear();
+
+  auto &unit = units[arrayIndex];
+  unit.isActive = true;
+
+  unit.normalizedKey.insert(vecIndex, normalizedKey);
+  unit.frequency.insert(vecIndex, frequency);
+  unit.velocity.insert(vecIndex, velocity);
+
+  if (param.value[ID::osc1PhaseLock]->getInt())
+    unit.saw1.setPhase(vecIndex, param.value[ID::osc1Phase]->getFloat());
+  if (param.value[ID::osc2PhaseLock]->getInt())
+    unit.saw2.setPhase(vecIndex, param.value[ID::osc2Phase]->getFloat());
+
+  if (!param.value[ID::filterDirty]->getInt()) {
+    unit.oscBuffer1.insert(vecIndex, 0.0f);
+    unit.oscBuffer2.insert(vecIndex, 0.0f);
+    unit.filter.clear(vecIndex);
   }
 
-  bypassFilter = param.value[ParameterID::filterType]->getInt() == 4;
-  if (!bypassFilter) {
-    switch (param.value[ParameterID::filterType]->getInt()) {
+  const auto filterType = param.value[ID::filterType]->getInt();
+  unit.bypassFilter.insert(vecIndex, filterType == 4);
+  if (filterType != 4) {
+    switch (filterType) {
       default:
       case 0:
-        filter.type = BiquadType::lowpass;
+        unit.filter.setType(vecIndex, BiquadType::lowpass);
         break;
 
       case 1:
-        filter.type = BiquadType::highpass;
+        unit.filter.setType(vecIndex, BiquadType::highpass);
         break;
 
       case 2:
-        filter.type = BiquadType::bandpass;
+        unit.filter.setType(vecIndex, BiquadType::bandpass);
         break;
 
       case 3:
-        filter.type = BiquadType::notch;
+        unit.filter.setType(vecIndex, BiquadType::notch);
         break;
     }
-    switch (uint32_t(param.value[ParameterID::filterShaper]->getInt())) {
+    switch (uint32_t(param.value[ID::filterShaper]->getInt())) {
       default:
       case 0:
-        filter.shaper = ShaperType::hardclip;
+        unit.filter.setShaper(vecIndex, ShaperType::hardclip);
         break;
 
       case 1:
-        filter.shaper = ShaperType::tanh;
+        unit.filter.setShaper(vecIndex, ShaperType::tanh);
         break;
 
       case 2:
-        filter.shaper = ShaperType::sinRunge;
+        unit.filter.setShaper(vecIndex, ShaperType::sinRunge);
         break;
 
       case 3:
-        filter.shaper = ShaperType::cubicExpDecayAbs;
+        unit.filter.setShaper(vecIndex, ShaperType::cubicExpDecayAbs);
         break;
     }
   }
 
-  gainEnvelope.reset(
-    param.value[ParameterID::gainA]->getFloat(),
-    param.value[ParameterID::gainD]->getFloat(),
-    param.value[ParameterID::gainS]->getFloat(),
-    param.value[ParameterID::gainR]->getFloat());
-  filterEnvelope.reset(
-    param.value[ParameterID::filterA]->getFloat(),
-    param.value[ParameterID::filterD]->getFloat(),
-    param.value[ParameterID::filterS]->getFloat(),
-    param.value[ParameterID::filterR]->getFloat());
-  modEnvelope.reset(
-    param.value[ParameterID::modEnvelopeA]->getFloat(),
-    param.value[ParameterID::modEnvelopeCurve]->getFloat());
+  unit.gainEnvelope.reset(vecIndex);
+  unit.filterEnvelope.reset(
+    vecIndex, param.value[ID::filterA]->getFloat(), param.value[ID::filterD]->getFloat(),
+    param.value[ID::filterS]->getFloat(), param.value[ID::filterR]->getFloat());
+  unit.modEnvelope.reset(
+    vecIndex, param.value[ID::modEnvelopeA]->getFloat(),
+    param.value[ID::modEnvelopeCurve]->getFloat());
+
+  unit.controlJump.insert(vecIndex, true);
 }
 
-template<typename Sample> void Note<Sample>::release()
+void NOTE_NAME::release(std::array<PROCESSING_UNIT_NAME, nUnit> &units)
 {
   if (state == NoteState::rest) return;
   state = NoteState::release;
-  gainEnvelope.release();
-  filterEnvelope.release();
+  units[arrayIndex].gainEnvelope.release(vecIndex);
+  units[arrayIndex].filterEnvelope.release(vecIndex);
 }
 
-template<typename Sample> void Note<Sample>::rest() { state = NoteState::rest; }
+void NOTE_NAME::rest() { state = NoteState::rest; }
 
-template<typename Sample> Sample Note<Sample>::process(NoteProcessInfo<Sample> &info)
+bool NOTE_NAME::isAttacking(std::array<PROCESSING_UNIT_NAME, nUnit> &units)
 {
-  if (state == NoteState::rest) return 0;
+  return units[arrayIndex].gainEnvelope.isAttacking(vecIndex);
+}
 
-  const float modEnv = modEnvelope.process();
+bool NOTE_NAME::isTerminated(std::array<PROCESSING_UNIT_NAME, nUnit> &units)
+{
+  return units[arrayIndex].gainEnvelope.isTerminated(vecIndex);
+}
 
-  saw1.setOrder(info.osc1PTROrder);
-  switch (info.osc1SyncType) {
-    default:
-    case 0: // Off
-      saw1.setOscFreq(
-        frequency
-        * (1.0f + info.modEnvelopeToFreq1 * modEnv * modEnv + info.modLFOToFreq1 * info.modLFO)
-        * info.osc1Pitch);
-      saw1.setSyncFreq(0.0f);
-      break;
-    case 1: { // Ratio
-      saw1.setOscFreq(
-        frequency
-        * (1.0f + info.modEnvelopeToSync1 * modEnv * modEnv + info.modLFOToSync1 * info.modLFO)
-        * info.osc1Pitch * info.osc1Sync);
-      saw1.setSyncFreq(
-        frequency
-        * (1.0f + info.modEnvelopeToFreq1 * modEnv * modEnv + info.modLFOToFreq1 * info.modLFO)
-        * info.osc1Pitch);
-    } break;
-    case 2: // Fixed-Master
-      saw1.setOscFreq(
-        frequency
-        * (1.0f + info.modEnvelopeToFreq1 * modEnv * modEnv + info.modLFOToFreq1 * info.modLFO)
-        * info.osc1Pitch);
-      saw1.setSyncFreq(tuneFixedFreq(
-        info.osc1Sync,
-        info.modEnvelopeToSync1 + 0.5f + 0.5f * info.modEnvelopeToSync1 * info.modLFO));
-      break;
-    case 3: // Fixed-Slave
-      saw1.setOscFreq(tuneFixedFreq(
-        info.osc1Sync,
-        info.modEnvelopeToFreq1 + 0.5f + 0.5f * info.modEnvelopeToFreq1 * info.modLFO));
-      saw1.setSyncFreq(
-        frequency
-        * (1.0f + info.modEnvelopeToSync1 * modEnv * modEnv + info.modLFOToSync1 * info.modLFO)
-        * info.osc1Pitch);
-      break;
-  }
+float NOTE_NAME::getGain(std::array<PROCESSING_UNIT_NAME, nUnit> &units)
+{
+  return units[arrayIndex].gain[vecIndex];
+}
 
-  saw2.setOrder(info.osc2PTROrder);
-  switch (info.osc2SyncType) {
-    default:
-    case 0: // Off
-      saw2.setOscFreq(
-        frequency
-        * (1.0f + info.modEnvelopeToFreq2 * modEnv * modEnv + info.modLFOToFreq2 * info.modLFO)
-        * info.osc2Pitch);
-      saw2.setSyncFreq(0.0f);
-      break;
-    case 1: // Ratio
-      saw2.setOscFreq(
-        frequency
-        * (1.0f + info.modEnvelopeToSync2 * modEnv * modEnv + info.modLFOToSync2 * info.modLFO)
-        * info.osc2Pitch * info.osc2Sync);
-      saw2.setSyncFreq(
-        frequency
-        * (1.0f + info.modEnvelopeToFreq2 * modEnv * modEnv + info.modLFOToFreq2 * info.modLFO)
-        * info.osc2Pitch);
-      break;
-    case 2: // Fixed-Master
-      saw2.setOscFreq(
-        frequency
-        * (1.0f + info.modEnvelopeToFreq2 * modEnv * modEnv + info.modLFOToFreq2 * info.modLFO)
-        * info.osc2Pitch);
-      saw2.setSyncFreq(tuneFixedFreq(
-        info.osc2Sync,
-        info.modEnvelopeToSync2 + 0.5f + 0.5f * info.modEnvelopeToSync2 * info.modLFO));
-      break;
-    case 3: // Fixed-Slave
-      saw2.setOscFreq(tuneFixedFreq(
-        info.osc2Sync,
-        info.modEnvelopeToFreq2 + 0.5f + 0.5f * info.modEnvelopeToFreq2 * info.modLFO));
-      saw2.setSyncFreq(
-        frequency
-        * (1.0f + info.modEnvelopeToSync2 * modEnv * modEnv + info.modLFOToSync2 * info.modLFO)
-        * info.osc2Pitch);
-      break;
+DSPCORE_NAME::DSPCORE_NAME()
+{
+  for (size_t i = 0; i < notes.size(); ++i) {
+    for (size_t j = 0; j < notes[i].size(); ++j) {
+      auto index = i + j * maxVoice;
+      notes[i][j].vecIndex = index % 16;
+      notes[i][j].arrayIndex = index / 16;
+    }
   }
+}
 
-  auto toSync1 = info.fmOsc1ToSync1 * oscBuffer[0] + info.fmOsc2ToSync1 * oscBuffer[1];
-  auto outSaw1 = saw1.process(0.0f, toSync1);
-  auto toFreq2 = info.fmOsc1ToFreq2 * oscBuffer[0];
-  auto outSaw2 = saw2.process(toFreq2, 0.0f);
-  oscBuffer[0] = outSaw1;
-  oscBuffer[1] = outSaw2;
-
-  const auto gainEnv = gainEnvelope.process();
-  if (gainEnvelope.isTerminated()) rest();
-  gain = velocity
-    * (gainEnv
-       + info.gainEnvelopeCurve
-         * (juce::dsp::FastMathApproximations::tanh(3.0f * info.gainEnvelopeCurve * gainEnv) - gainEnv));
-
-  if (bypassFilter) return gain * (info.osc1Gain * outSaw1 + info.osc2Gain * outSaw2);
-
-  filterEnv = filterEnvelope.process();
-  filter.setCutoffQ(
-    info.filterCutoff
-      * powf(
-        2.0f,
-        8.0f * info.filterCutoffAmount * filterEnv
-          + info.filterKeyToCutoff * normalizedKey),
-    info.filterResonance + info.filterResonanceAmount * filterEnv * filterEnv);
-  filter.feedback = clamp(
-    info.filterFeedback + 2.0f * info.filterKeyToFeedback * normalizedKey, 0.0f, 1.0f);
-  filter.saturation = info.filterSaturation;
-  return gain * filter.process(info.osc1Gain * outSaw1 + info.osc2Gain * outSaw2);
+void PROCESSING_UNIT_NAME::setup(float sampleRate, uint32_t controlInterval)
+{
+  saw1.setup(sampleRate);
+  saw2.setup(sampleRate);
+  filter.setup(sampleRate);
+  gainEnvelope.setup(sampleRate);
+
+  // Modulation envelopes run at control rate.
+  filterEnvelope.setup(sampleRate / controlInterval);
+  modEnvelope.setup(sampleRate / controlInterval);
 }
 
-void DSPCore::setup(double sampleRate)
+void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.2f);
+  smootherCommon.setSampleRate(this->sampleRate / controlInterval);
+  smootherCommon.setTime(0.2f);
 
-  for (auto &note : notes) {
-    for (auto &nt : note) nt = std::make_unique<Note<float>>(sampleRate);
-  }
+  for (auto &unit : units) unit.setup(this->sampleRate, controlInterval);
 
   // 2 msec + 1 sample transition time.
   transitionBuffer.resize(1 + int(sampleRate * 0.005), 0.0);
@@ -262,73 +208,122 @@ void DSPCore::setup(double sampleRate)
   startup();
 }
 
-void DSPCore::free() {}
+void PROCESSING_UNIT_NAME::reset()
+{
+  isActive = false;
+  gainEnvelope.terminate();
+}
 
-void DSPCore::reset()
+void DSPCORE_NAME::reset()
 {
   for (auto &note : notes) {
-    for (auto &nt : note) nt->rest();
+    for (auto &nt : note) nt.rest();
   }
+  for (auto &unit : units) unit.reset();
   startup();
 }
 
-void DSPCore::startup() { lfoPhase = 0.0f; }
+void DSPCORE_NAME::startup()
+{
+  lfoPhase = 0.0f;
+  controlCounter = 0;
+}
+
+void PROCESSING_UNIT_NAME::setParameters(
+  const SmootherCommon<float> &smootherCommon,
+  NoteProcessInfo &info,
+  GlobalParameter &param)
+{
+  using ID = ParameterID::ID;
+
+  saw1.setOrder(info.osc1PTROrder);
+  saw2.setOrder(info.osc2PTROrder);
 
-void DSPCore::setParameters(float tempo)
+  gainEnvelope.set(
+    smootherCommon, param.value[ID::gainA]->getFloat(),
+    param.value[ID::gainD]->getFloat(), param.value[ID::gainS]->getFloat(),
+    param.value[ID::gainR]->getFloat());
+}
+
+void DSPCORE_NAME::setParameters(float tempo)
 {
-  interpMasterGain.push(param.value[ParameterID::gain]->getFloat());
+  interpMasterGain.push(smootherCommon, param.value[ParameterID::gain]->getFloat());
 
-  interpOsc1Gain.push(param.value[ParameterID::osc1Gain]->getFloat());
-  interpOsc1Pitch.push(paramToPitch(
-    param.value[ParameterID::osc1Semi]->getFloat(),
-    param.value[ParameterID::osc1Cent]->getFloat(),
-    param.value[ParameterID::pitchBend]->getFloat()));
-  interpOsc1Sync.push(param.value[ParameterID::osc1Sync]->getFloat());
+  interpOsc1Gain.push(smootherCommon, param.value[ParameterID::osc1Gain]->getFloat());
+  interpOsc1Pitch.push(
+    smootherCommon,
+    paramToPitch(
+      param.value[ParameterID::osc1Semi]->getFloat(),
+      param.value[ParameterID::osc1Cent]->getFloat(),
+      param.value[ParameterID::pitchBend]->getFloat()));
+  interpOsc1Sync.push(smootherCommon, param.value[ParameterID::osc1Sync]->getFloat());
 
   interpOsc2Gain.push(
-    (param.value[ParameterID::osc2Invert]->getInt() ? -1.0f : 1.0f)
+    smootherCommon, (param.value[ParameterID::osc2Invert]->getInt() ? -1.0f : 1.0f)
     * param.value[ParameterID::osc2Gain]->getFloat());
-  interpOsc2Pitch.push(paramToPitch(
-    param.value[ParameterID::osc2Semi]->getFloat(),
-    param.value[ParameterID::osc2Cent]->getFloat(),
-    param.value[ParameterID::pitchBend]->getFloat()));
-  interpOsc2Sync.push(param.value[ParameterID::osc2Sync]->getFloat());
-
-  interpFMOsc1ToSync1.push(param.value[ParameterID::fmOsc1ToSync1]->getFloat());
-  interpFMOsc1ToFreq2.push(param.value[ParameterID::fmOsc1ToFreq2]->getFloat());
-  interpFMOsc2ToSync1.push(param.value[ParameterID::fmOsc2ToSync1]->getFloat());
-
-  interpModEnvelopeToFreq1.push(param.value[ParameterID::modEnvelopeToFreq1]->getFloat());
-  interpModEnvelopeToSync1.push(param.value[ParameterID::modEnvelopeToSync1]->getFloat());
-  interpModEnvelopeToFreq2.push(param.value[ParameterID::modEnvelopeToFreq2]->getFloat());
-  interpModEnvelopeToSync2.push(param.value[ParameterID::modEnvelopeToSync2]->getFloat());
+  interpOsc2Pitch.push(
+    smootherCommon,
+    paramToPitch(
+      param.value[ParameterID::osc2Semi]->getFloat(),
+      param.value[ParameterID::osc2Cent]->getFloat(),
+      param.value[ParameterID::pitchBend]->getFloat()));
+  interpOsc2Sync.push(smootherCommon, param.value[ParameterID::osc2Sync]->getFloat());
+
+  interpFMOsc1ToSync1.push(
+    smootherCommon, param.value[ParameterID::fmOsc1ToSync1]->getFloat());
+  interpFMOsc1ToFreq2.push(
+    smootherCommon, param.value[ParameterID::fmOsc1ToFreq2]->getFloat());
+  interpFMOsc2ToSync1.push(
+    smootherCommon, param.value[ParameterID::fmOsc2ToSync1]->getFloat());
+
+  interpModEnvelopeToFreq1.push(
+    smootherCommon, param.value[ParameterID::modEnvelopeToFreq1]->getFloat());
+  interpModEnvelopeToSync1.push(
+    smootherCommon, param.value[ParameterID::modEnvelopeToSync1]->getFloat());
+  interpModEnvelopeToFreq2.push(
+    smootherCommon, param.value[ParameterID::modEnvelopeToFreq2]->getFloat());
+  interpModEnvelopeToSync2.push(
+    smootherCommon, param.value[ParameterID::modEnvelopeToSync2]->getFloat());
   if (param.value[ParameterID::lfoTempoSync]->getInt()) {
     const float beat = float(param.value[ParameterID::lfoTempoNumerator]->getInt() + 1)
       / float(param.value[ParameterID::lfoTempoDenominator]->getInt() + 1);
     const float multiplier = Scales::lfoFrequencyMultiplier.map(
       param.value[ParameterID::modLFOFrequency]->getNormalized());
-    interpModLFOFrequency.push(multiplier * tempo / 480.0f / beat);
+    interpModLFOFrequency.push(smootherCommon, multiplier * tempo / 480.0f / beat);
   } else {
-    interpModLFOFrequency.push(param.value[ParameterID::modLFOFrequency]->getFloat());
+    interpModLFOFrequency.push(
+      smootherCommon, param.value[ParameterID::modLFOFrequency]->getFloat());
   }
-  interpModLFONoiseMix.push(param.value[ParameterID::modLFONoiseMix]->getFloat());
-  interpModLFOToFreq1.push(param.value[ParameterID::modLFOToFreq1]->getFloat());
-  interpModLFOToSync1.push(param.value[ParameterID::modLFOToSync1]->getFloat());
-  interpModLFOToFreq2.push(param.value[ParameterID::modLFOToFreq2]->getFloat());
-  interpModLFOToSync2.push(param.value[ParameterID::modLFOToSync2]->getFloat());
-
-  interpGainEnvelopeCurve.push(param.value[ParameterID::gainEnvelopeCurve]->getFloat());
-
-  interpFilterCutoff.push(param.value[ParameterID::filterCutoff]->getFloat());
-  interpFilterResonance.push(param.value[ParameterID::filterResonance]->getFloat());
-  interpFilterFeedback.push(param.value[ParameterID::filterFeedback]->getFloat());
-  interpFilterSaturation.push(param.value[ParameterID::filterSaturation]->getFloat());
-  interpFilterCutoffAmount.push(param.value[ParameterID::filterCutoffAmount]->getFloat());
+  interpModLFONoiseMix.push(
+    smootherCommon, param.value[ParameterID::modLFONoiseMix]->getFloat());
+  interpModLFOToFreq1.push(
+    smootherCommon, param.value[ParameterID::modLFOToFreq1]->getFloat());
+  interpModLFOToSync1.push(
+    smootherCommon, param.value[ParameterID::modLFOToSync1]->getFloat());
+  interpModLFOToFreq2.push(
+    smootherCommon, param.value[ParameterID::modLFOToFreq2]->getFloat());
+  interpModLFOToSync2.push(
+    smootherCommon, param.value[ParameterID::modLFOToSync2]->getFloat());
+
+  interpGainEnvelopeCurve.push(
+    smootherCommon, param.value[ParameterID::gainEnvelopeCurve]->getFloat());
+
+  interpFilterCutoff.push(
+    smootherCommon, param.value[ParameterID::filterCutoff]->getFloat());
+  interpFilterResonance.push(
+    smootherCommon, param.value[ParameterID::filterResonance]->getFloat());
+  interpFilterFeedback.push(
+    smootherCommon, param.value[ParameterID::filterFeedback]->getFloat());
+  interpFilterSaturation.push(
+    smootherCommon, param.value[ParameterID::filterSaturation]->getFloat());
+  interpFilterCutoffAmount.push(
+    smootherCommon, param.value[ParameterID::filterCutoffAmount]->getFloat());
   interpFilterResonanceAmount.push(
-    param.value[ParameterID::filterResonanceAmount]->getFloat());
-  interpFilterKeyToCutoff.push(param.value[ParameterID::filterKeyToCutoff]->getFloat());
+    smootherCommon, param.value[ParameterID::filterResonanceAmount]->getFloat());
+  interpFilterKeyToCutoff.push(
+    smootherCommon, param.value[ParameterID::filterKeyToCutoff]->getFloat());
   interpFilterKeyToFeedback.push(
-    param.value[ParameterID::filterKeyToFeedback]->getFloat());
+    smootherCommon, param.value[ParameterID::filterKeyToFeedback]->getFloat());
 
   switch (uint32_t(param.value[ParameterID::nVoice]->getInt())) {
     case 0:
@@ -356,82 +351,242 @@ void DSPCore::setParameters(float tempo)
       nVoice = 32;
       break;
   }
-}
 
-void DSPCore::process(const size_t length, float *out0, float *out1)
-{
-  SmootherCommon<float>::setBufferSize(length);
+  const uint32_t interval = 1 << param.value[ParameterID::modulationInterval]->getInt();
+  if (controlInterval != interval) {
+    controlInterval = interval;
+    controlCounter = 0;
 
-  bool unison = param.value[ParameterID::unison]->getInt();
-  for (auto &note : notes) {
-    if (note[0]->state == NoteState::rest) continue;
-    note[0]->gainEnvelope.set(
-      param.value[ParameterID::gainA]->getFloat(),
-      param.value[ParameterID::gainD]->getFloat(),
-      param.value[ParameterID::gainS]->getFloat(),
-      param.value[ParameterID::gainR]->getFloat());
-    if (unison) {
-      if (note[1]->state == NoteState::rest) continue;
-      note[1]->gainEnvelope.set(
-        param.value[ParameterID::gainA]->getFloat(),
-        param.value[ParameterID::gainD]->getFloat(),
-        param.value[ParameterID::gainS]->getFloat(),
-        param.value[ParameterID::gainR]->getFloat());
-    }
+    smootherCommon.setSampleRate(sampleRate / controlInterval);
+    smootherCommon.setTime(0.2f);
+
+    for (auto &unit : units) unit.setup(sampleRate, controlInterval);
   }
 
   noteInfo.osc1SyncType = param.value[ParameterID::osc1SyncType]->getInt();
   noteInfo.osc1PTROrder = param.value[ParameterID::osc1PTROrder]->getInt();
   noteInfo.osc2SyncType = param.value[ParameterID::osc2SyncType]->getInt();
   noteInfo.osc2PTROrder = param.value[ParameterID::osc2PTROrder]->getInt();
+  for (auto &unit : units) unit.setParameters(smootherCommon, noteInfo, param);
+}
+
+void PROCESSING_UNIT_NAME::processControl(NoteProcessInfo &info, uint32_t nStep)
+{
+  const Vec16f modEnv = modEnvelope.process();
+  const Vec16f filterEnv
+    = horizontal_and(bypassFilter) ? Vec16f(0.0f) : filterEnvelope.process();
+  pushControl(info, modEnv, filterEnv, nStep);
+}
+
+// Called on note-on between control ticks. Only the new lanes are updated.
+void PROCESSING_UNIT_NAME::startControl(NoteProcessInfo &info)
+{
+  pushControl(info, modEnvelope.getValue(), filterEnvelope.getValue(), 0);
+}
+
+void PROCESSING_UNIT_NAME::pushControl(
+  NoteProcessInfo &info, Vec16f modEnv, Vec16f filterEnv, uint32_t nStep)
+{
+  auto pushRamp = [&](ControlRamp<Vec16f> &ramp, Vec16f target) {
+    if (nStep > 0) ramp.push(target, nStep);
+    ramp.jump(target, controlJump);
+  };
+
+  const Vec16f modEnv2 = modEnv * modEnv;
+
+  const Vec16f freq1 = frequency
+    * (1.0f + info.modEnvelopeToFreq1 * modEnv2 + info.modLFOToFreq1 * info.modLFO)
+    * info.osc1Pitch;
+  const Vec16f sync1 = frequency
+    * (1.0f + info.modEnvelopeToSync1 * modEnv2 + info.modLFOToSync1 * info.modLFO)
+    * info.osc1Pitch;
+  switch (info.osc1SyncType) {
+    default:
+    case 0: // Off
+      pushRamp(rampOscFreq1, freq1);
+      pushRamp(rampSyncFreq1, 0.0f);
+      break;
+    case 1: // Ratio
+      pushRamp(rampOscFreq1, sync1 * info.osc1Sync);
+      pushRamp(rampSyncFreq1, freq1);
+      break;
+    case 2: // Fixed-Master
+      pushRamp(rampOscFreq1, freq1);
+      pushRamp(
+        rampSyncFreq1,
+        tuneFixedFreq(
+          info.osc1Sync,
+          info.modEnvelopeToSync1 + 0.5f
+            + 0.5f * info.modEnvelopeToSync1 * info.modLFO));
+      break;
+    case 3: // Fixed-Slave
+      pushRamp(
+        rampOscFreq1,
+        tuneFixedFreq(
+          info.osc1Sync,
+          info.modEnvelopeToFreq1 + 0.5f
+            + 0.5f * info.modEnvelopeToFreq1 * info.modLFO));
+      pushRamp(rampSyncFreq1, sync1);
+      break;
+  }
+
+  const Vec16f freq2 = frequency
+    * (1.0f + info.modEnvelopeToFreq2 * modEnv2 + info.modLFOToFreq2 * info.modLFO)
+    * info.osc2Pitch;
+  const Vec16f sync2 = frequency
+    * (1.0f + info.modEnvelopeToSync2 * modEnv2 + info.modLFOToSync2 * info.modLFO)
+    * info.osc2Pitch;
+  switch (info.osc2SyncType) {
+    default:
+    case 0: // Off
+      pushRamp(rampOscFreq2, freq2);
+      pushRamp(rampSyncFreq2, 0.0f);
+      break;
+    case 1: // Ratio
+      pushRamp(rampOscFreq2, sync2 * info.osc2Sync);
+      pushRamp(rampSyncFreq2, freq2);
+      break;
+    case 2: // Fixed-Master
+      pushRamp(rampOscFreq2, freq2);
+      pushRamp(
+        rampSyncFreq2,
+        tuneFixedFreq(
+          info.osc2Sync,
+          info.modEnvelopeToSync2 + 0.5f
+            + 0.5f * info.modEnvelopeToSync2 * info.modLFO));
+      break;
+    case 3: // Fixed-Slave
+      pushRamp(
+        rampOscFreq2,
+        tuneFixedFreq(
+          info.osc2Sync,
+          info.modEnvelopeToFreq2 + 0.5f
+            + 0.5f * info.modEnvelopeToFreq2 * info.modLFO));
+      pushRamp(rampSyncFreq2, sync2);
+      break;
+  }
+
+  if (!horizontal_and(bypassFilter)) {
+    filter.setCutoffQ(
+      info.filterCutoff
+        * exp2(
+          8.0f * info.filterCutoffAmount * filterEnv
+          + info.filterKeyToCutoff * normalizedKey),
+      info.filterResonance + info.filterResonanceAmount * filterEnv * filterEnv, nStep,
+      controlJump);
+    pushRamp(
+      rampFilterFeedback,
+      min(
+        max(info.filterFeedback + 2.0f * info.filterKeyToFeedback * normalizedKey, 0.0f),
+        1.0f));
+  }
+
+  controlJump = false;
+}
+
+Vec16f PROCESSING_UNIT_NAME::process(NoteProcessInfo &info)
+{
+  saw1.setOscFreq(rampOscFreq1.process());
+  saw1.setSyncFreq(rampSyncFreq1.process());
+  saw2.setOscFreq(rampOscFreq2.process());
+  saw2.setSyncFreq(rampSyncFreq2.process());
+
+  const Vec16f toSync1 = info.fmOsc1ToSync1 * oscBuffer1 + info.fmOsc2ToSync1 * oscBuffer2;
+  const Vec16f outSaw1 = saw1.process(0.0f, toSync1);
+  const Vec16f toFreq2 = info.fmOsc1ToFreq2 * oscBuffer1;
+  const Vec16f outSaw2 = saw2.process(toFreq2, 0.0f);
+  oscBuffer1 = outSaw1;
+  oscBuffer2 = outSaw2;
+
+  const Vec16f gainEnv = gainEnvelope.process();
+  isActive = !gainEnvelope.isTerminated();
+  gain = velocity
+    * (gainEnv
+       + info.gainEnvelopeCurve
+         * (juce::dsp::FastMathApproximations::tanh<Vec16f>(
+              3.0f * info.gainEnvelopeCurve * gainEnv)
+            - gainEnv));
+
+  const Vec16f oscMix = info.osc1Gain * outSaw1 + info.osc2Gain * outSaw2;
+  if (horizontal_and(bypassFilter)) return gain * oscMix;
+
+  filter.feedback = rampFilterFeedback.process();
+  filter.saturation = info.filterSaturation;
+  return gain * select(bypassFilter, oscMix, filter.process(oscMix));
+}
+
+void DSPCORE_NAME::process(const size_t length, float *out0, float *out1)
+{
+  smootherCommon.setBufferSize(length);
+
+  // Units for unison voices are frozen while unison is off.
+  const size_t nActiveUnit
+    = param.value[ParameterID::unison]->getInt() ? nUnit : nUnit / 2;
+
   for (size_t i = 0; i < length; ++i) {
     processMidiNote(i);
 
-    noteInfo.osc1Gain = interpOsc1Gain.process();
-    noteInfo.osc1Pitch = interpOsc1Pitch.process();
-    noteInfo.osc1Sync = interpOsc1Sync.process();
-    noteInfo.osc2Gain = interpOsc2Gain.process();
-    noteInfo.osc2Pitch = interpOsc2Pitch.process();
-    noteInfo.osc2Sync = interpOsc2Sync.process();
-    noteInfo.fmOsc1ToSync1 = interpFMOsc1ToSync1.process();
-    noteInfo.fmOsc1ToFreq2 = interpFMOsc1ToFreq2.process();
-    noteInfo.fmOsc2ToSync1 = interpFMOsc2ToSync1.process();
-    noteInfo.modEnvelopeToFreq1 = interpModEnvelopeToFreq1.process();
-    noteInfo.modEnvelopeToSync1 = interpModEnvelopeToSync1.process();
-    noteInfo.modEnvelopeToFreq2 = interpModEnvelopeToFreq2.process();
-    noteInfo.modEnvelopeToSync2 = interpModEnvelopeToSync2.process();
-
-    lfoPhase += 2.0 * float(pi) * interpModLFOFrequency.process() / sampleRate;
-    if (lfoPhase >= float(pi)) lfoPhase -= float(pi);
-    lfoValue = sinf(lfoPhase);
-    // lfoValue = (lfoValue + 1.0f) * 0.5f;
-    const float noiseSig = clamp(noise.process(), -1.0f, 1.0f) / 16.0f;
-    noteInfo.modLFO = clamp(
-      lfoValue + interpModLFONoiseMix.process() * (noiseSig - lfoValue), -1.0f, 1.0f);
-
-    noteInfo.modLFOToFreq1 = interpModLFOToFreq1.process();
-    noteInfo.modLFOToSync1 = interpModLFOToSync1.process();
-    noteInfo.modLFOToFreq2 = interpModLFOToFreq2.process();
-    noteInfo.modLFOToSync2 = interpModLFOToSync2.process();
-    noteInfo.gainEnvelopeCurve = interpGainEnvelopeCurve.process();
-    noteInfo.filterCutoff = interpFilterCutoff.process();
-    noteInfo.filterResonance = interpFilterResonance.process();
-    noteInfo.filterFeedback = interpFilterFeedback.process();
-    noteInfo.filterSaturation = interpFilterSaturation.process();
-    noteInfo.filterCutoffAmount = interpFilterCutoffAmount.process();
-    noteInfo.filterResonanceAmount = interpFilterResonanceAmount.process();
-    noteInfo.filterKeyToCutoff = interpFilterKeyToCutoff.process();
-    noteInfo.filterKeyToFeedback = interpFilterKeyToFeedback.process();
-
-    float sample = 0.0f;
-    for (auto &note : notes) {
-      if (note[0]->state == NoteState::rest) continue;
-      sample += note[0]->process(noteInfo);
-      if (unison) {
-        if (note[1]->state == NoteState::rest) continue;
-        sample += note[1]->process(noteInfo);
+    if (controlCounter == 0) {
+      rampMasterGain.push(interpMasterGain.process(), controlInterval);
+      rampOsc1Gain.push(interpOsc1Gain.process(), controlInterval);
+      noteInfo.osc1Pitch = interpOsc1Pitch.process();
+      noteInfo.osc1Sync = interpOsc1Sync.process();
+      rampOsc2Gain.push(interpOsc2Gain.process(), controlInterval);
+      noteInfo.osc2Pitch = interpOsc2Pitch.process();
+      noteInfo.osc2Sync = interpOsc2Sync.process();
+      rampFMOsc1ToSync1.push(interpFMOsc1ToSync1.process(), controlInterval);
+      rampFMOsc1ToFreq2.push(interpFMOsc1ToFreq2.process(), controlInterval);
+      rampFMOsc2ToSync1.push(interpFMOsc2ToSync1.process(), controlInterval);
+      noteInfo.modEnvelopeToFreq1 = interpModEnvelopeToFreq1.process();
+      noteInfo.modEnvelopeToSync1 = interpModEnvelopeToSync1.process();
+      noteInfo.modEnvelopeToFreq2 = interpModEnvelopeToFreq2.process();
+      noteInfo.modEnvelopeToSync2 = interpModEnvelopeToSync2.process();
+
+      const float controlRate = sampleRate / controlInterval;
+      lfoPhase += 2.0 * float(pi) * interpModLFOFrequency.process() / controlRate;
+      if (lfoPhase >= float(pi)) lfoPhase -= float(pi);
+      float lfoSig = sinf(lfoPhase);
+      // lfoSig = (lfoSig + 1.0f) * 0.5f;
+      const float noiseSig = clamp(noise.process(), -1.0f, 1.0f) / 16.0f;
+      lfoValue = clamp(
+        lfoSig + interpModLFONoiseMix.process() * (noiseSig - lfoSig), -1.0f, 1.0f);
+      noteInfo.modLFO = lfoValue;
+
+      noteInfo.modLFOToFreq1 = interpModLFOToFreq1.process();
+      noteInfo.modLFOToSync1 = interpModLFOToSync1.process();
+      noteInfo.modLFOToFreq2 = interpModLFOToFreq2.process();
+      noteInfo.modLFOToSync2 = interpModLFOToSync2.process();
+      rampGainEnvelopeCurve.push(interpGainEnvelopeCurve.process(), controlInterval);
+      noteInfo.filterCutoff = interpFilterCutoff.process();
+      noteInfo.filterResonance = interpFilterResonance.process();
+      noteInfo.filterFeedback = interpFilterFeedback.process();
+      rampFilterSaturation.push(interpFilterSaturation.process(), controlInterval);
+      noteInfo.filterCutoffAmount = interpFilterCutoffAmount.process();
+      noteInfo.filterResonanceAmount = interpFilterResonanceAmount.process();
+      noteInfo.filterKeyToCutoff = interpFilterKeyToCutoff.process();
+      noteInfo.filterKeyToFeedback = interpFilterKeyToFeedback.process();
+
+      for (size_t idx = 0; idx < nActiveUnit; ++idx) {
+        if (!units[idx].isActive) continue;
+        units[idx].processControl(noteInfo, controlInterval);
       }
     }
+    if (++controlCounter >= controlInterval) controlCounter = 0;
+
+    noteInfo.osc1Gain = rampOsc1Gain.process();
+    noteInfo.osc2Gain = rampOsc2Gain.process();
+    noteInfo.fmOsc1ToSync1 = rampFMOsc1ToSync1.process();
+    noteInfo.fmOsc1ToFreq2 = rampFMOsc1ToFreq2.process();
+    noteInfo.fmOsc2ToSync1 = rampFMOsc2ToSync1.process();
+    noteInfo.gainEnvelopeCurve = rampGainEnvelopeCurve.process();
+    noteInfo.filterSaturation = rampFilterSaturation.process();
+
+    Vec16f sum = 0.0f;
+    for (size_t idx = 0; idx < nActiveUnit; ++idx) {
+      if (!units[idx].isActive) continue;
+      sum += units[idx].process(noteInfo);
+    }
+    float sample = horizontal_add(sum);
 
     if (isTransitioning) {
       sample += transitionBuffer[mptIndex];
@@ -440,28 +595,39 @@ void DSPCore::process(const size_t length, float *out0, float *out1)
       if (mptIndex == mptStop) isTransitioning = false;
     }
 
-    const float masterGain = interpMasterGain.process();
+    const float masterGain = rampMasterGain.process();
     out0[i] = masterGain * sample;
     out1[i] = masterGain * sample;
   }
+
+  updateNoteState();
+}
+
+void DSPCORE_NAME::updateNoteState()
+{
+  for (auto &note : notes) {
+    for (auto &nt : note) {
+      if (nt.state != NoteState::rest && nt.isTerminated(units)) nt.rest();
+    }
+  }
 }
 
-void DSPCore::noteOn(int32_t noteId, int16_t pitch, float tuning, float velocity)
+void DSPCORE_NAME::noteOn(int32_t noteId, int16_t pitch, float tuning, float velocity)
 {
+  updateNoteState();
+
   size_t i = 0;
   size_t mostSilent = 0;
   float gain = 1.0f;
   for (; i < nVoice; ++i) {
-    if (notes[i][0]->id == noteId) break;
-    if (notes[i][0]->state == NoteState::rest) break;
-    if (!notes[i][0]->gainEnvelope.isAttacking() && notes[i][0]->gain < gain) {
-      gain = notes[i][0]->gain;
+    if (notes[i][0].id == noteId) break;
+    if (notes[i][0].state == NoteState::rest) break;
+    if (!notes[i][0].isAttacking(units) && notes[i][0].getGain(units) < gain) {
+      gain = notes[i][0].getGain(units);
       mostSilent = i;
     }
   }
   if (i >= nVoice) {
-    isTransitioning = true;
-
     i = mostSilent;
 
     noteInfo.osc1Gain = interpOsc1Gain.getValue();
@@ -496,48 +662,66 @@ void DSPCore::noteOn(int32_t noteId, int16_t pitch, float tuning, float velocity
     noteInfo.filterKeyToCutoff = interpFilterKeyToCutoff.getValue();
     noteInfo.filterKeyToFeedback = interpFilterKeyToFeedback.getValue();
 
-    // Beware the negative overflow. mptStop is size_t.
-    mptStop = mptIndex - 1;
-    if (mptStop >= transitionBuffer.size()) mptStop += transitionBuffer.size();
-
-    for (size_t j = 0; j < transitionBuffer.size(); ++j) {
-      if (notes[i][0]->state == NoteState::rest) {
-        mptStop = mptIndex + j;
-        if (mptStop >= transitionBuffer.size()) mptStop -= transitionBuffer.size();
-        break;
-      }
-
-      float sample = notes[i][0]->process(noteInfo);
-      if (
-        param.value[ParameterID::unison]->getInt()
-        && notes[i][1]->state != NoteState::rest) {
-        sample += notes[i][1]->process(noteInfo);
-      }
-      transitionBuffer[(mptIndex + j) % transitionBuffer.size()]
-        += sample * (0.5 + 0.5 * cosf(pi * (float)j / transitionBuffer.size()));
-    }
+    fillTransitionBuffer(i);
   }
 
   auto normalizedKey = float(pitch) / 127.0f;
   auto frequency = midiNoteToFrequency(pitch, tuning);
-  notes[i][0]->setup(noteId, normalizedKey, frequency, velocity, param);
+  notes[i][0].noteOn(noteId, normalizedKey, frequency, velocity, units, param);
+  units[notes[i][0].arrayIndex].startControl(noteInfo);
   if (param.value[ParameterID::unison]->getInt()) {
-    notes[i][1]->setup(noteId, normalizedKey, frequency, velocity, param);
-    notes[i][1]->saw1.addPhase(0.1777);
-    notes[i][1]->saw2.addPhase(0.6883f);
+    auto &note = notes[i][1];
+    note.noteOn(noteId, normalizedKey, frequency, velocity, units, param);
+    units[note.arrayIndex].startControl(noteInfo);
+    units[note.arrayIndex].saw1.addPhase(note.vecIndex, 0.1777f);
+    units[note.arrayIndex].saw2.addPhase(note.vecIndex, 0.6883f);
   } else {
-    notes[i][1]->release();
+    notes[i][1].release(units);
+  }
+}
+
+void DSPCORE_NAME::fillTransitionBuffer(size_t noteIndex)
+{
+  isTransitioning = true;
+
+  // Beware the negative overflow. mptStop is size_t.
+  mptStop = mptIndex - 1;
+  if (mptStop >= transitionBuffer.size()) mptStop += transitionBuffer.size();
+
+  // Copy units to render the tail of stolen note ahead of time.
+  auto &note0 = notes[noteIndex][0];
+  auto &note1 = notes[noteIndex][1];
+  auto unit0 = units[note0.arrayIndex];
+  auto unit1 = units[note1.arrayIndex];
+  const bool isUnison = param.value[ParameterID::unison]->getInt();
+
+  for (size_t j = 0; j < transitionBuffer.size(); ++j) {
+    if (unit0.gainEnvelope.isTerminated(note0.vecIndex)) {
+      mptStop = mptIndex + j;
+      if (mptStop >= transitionBuffer.size()) mptStop -= transitionBuffer.size();
+      break;
+    }
+
+    const bool isControlTick = (controlCounter + j) % controlInterval == 0;
+    if (isControlTick) unit0.processControl(noteInfo, controlInterval);
+    float sample = unit0.process(noteInfo)[note0.vecIndex];
+    if (isUnison && !unit1.gainEnvelope.isTerminated(note1.vecIndex)) {
+      if (isControlTick) unit1.processControl(noteInfo, controlInterval);
+      sample += unit1.process(noteInfo)[note1.vecIndex];
+    }
+    transitionBuffer[(mptIndex + j) % transitionBuffer.size()]
+      += sample * (0.5f + 0.5f * cosf(float(pi) * j / transitionBuffer.size()));
   }
 }
 
-void DSPCore::noteOff(int32_t noteId)
+void DSPCORE_NAME::noteOff(int32_t noteId)
 {
   size_t i = 0;
   for (; i < notes.size(); ++i) {
-    if (notes[i][0]->id == noteId) break;
+    if (notes[i][0].id == noteId) break;
   }
   if (i >= notes.size()) return;
 
-  notes[i][0]->release();
-  notes[i][1]->release();
+  notes[i][0].release(units);
+  notes[i][1].release(units);
 }
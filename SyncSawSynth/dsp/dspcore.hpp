@@ -25,110 +25,148 @@
 #include "noise.hpp"
 #include "oscillator.hpp"
 
+#include "../../lib/vcl/vectorclass.h"
+
 #include <array>
 #include <cmath>
 #include <memory>
 
 using namespace SomeDSP;
 
-template<typename Sample> struct NoteProcessInfo {
-  Sample osc1Gain;
-  Sample osc1Pitch;
-  Sample osc1Sync;
+// 16 voices per unit. Units [0, nUnit / 2) are main voices, and the rest are unison voices.
+constexpr size_t nUnit = 4;
+
+struct NoteProcessInfo {
+  float osc1Gain;
+  float osc1Pitch;
+  float osc1Sync;
   int32_t osc1SyncType;
   uint32_t osc1PTROrder;
 
-  Sample osc2Gain;
-  Sample osc2Pitch;
-  Sample osc2Sync;
+  float osc2Gain;
+  float osc2Pitch;
+  float osc2Sync;
   int32_t osc2SyncType;
   uint32_t osc2PTROrder;
 
-  Sample fmOsc1ToSync1;
-  Sample fmOsc1ToFreq2;
-  Sample fmOsc2ToSync1;
-
-  Sample gainEnvelopeCurve;
-
-  Sample filterCutoff;
-  Sample filterResonance;
-  Sample filterFeedback;
-  Sample filterSaturation;
-  Sample filterCutoffAmount;
-  Sample filterResonanceAmount;
-  Sample filterKeyToCutoff;
-  Sample filterKeyToFeedback;
-
-  Sample modEnvelopeToFreq1;
-  Sample modEnvelopeToSync1;
-  Sample modEnvelopeToFreq2;
-  Sample modEnvelopeToSync2;
-  Sample modLFO;
-  Sample modLFOToFreq1;
-  Sample modLFOToSync1;
-  Sample modLFOToFreq2;
-  Sample modLFOToSync2;
+  float fmOsc1ToSync1;
+  float fmOsc1ToFreq2;
+  float fmOsc2ToSync1;
+
+  float gainEnvelopeCurve;
+
+  float filterCutoff;
+  float filterResonance;
+  float filterFeedback;
+  float filterSaturation;
+  float filterCutoffAmount;
+  float filterResonanceAmount;
+  float filterKeyToCutoff;
+  float filterKeyToFeedback;
+
+  float modEnvelopeToFreq1;
+  float modEnvelopeToSync1;
+  float modEnvelopeToFreq2;
+  float modEnvelopeToSync2;
+  float modLFO;
+  float modLFOToFreq1;
+  float modLFOToSync1;
+  float modLFOToFreq2;
+  float modLFOToSync2;
 };
 
 enum class NoteState { active, release, rest };
 
-template<typename Sample> class Note {
-public:
-  NoteState state = NoteState::rest;
-
-  int32_t id = -1;
-  Sample normalizedKey = 0.0;
-  Sample velocity = 0.0;
-  Sample gain = 0.0;
-  Sample frequency = 0.0;
-  bool bypassFilter = false;
-
-  Sample filterEnv = 0.0;
-
-  PTRSyncSaw<Sample> saw1;
-  PTRSyncSaw<Sample> saw2;
-  std::array<float, 2> oscBuffer = {0.0, 0.0};
-
-  SerialFilter4<Sample> filter;
-
-  ExpADSREnvelope<float> gainEnvelope;
-  LinearEnvelope<float> filterEnvelope;
-  PolyExpEnvelope<double> modEnvelope;
-
-  Note(Sample sampleRate)
-    : saw1(sampleRate, 0.0, 0.0)
-    , saw2(sampleRate, 0.0, 0.0)
-    , filter(sampleRate, 20000.0, 0.5)
-    , gainEnvelope(sampleRate, 0.2, 0.5, 0.2, 1.0)
-    , filterEnvelope(sampleRate, 0.2, 0.5, 0.2, 1.0)
-    , modEnvelope(sampleRate, 0.0, 1.0)
-  {
-  }
-
-  void setup(
-    int32_t noteId,
-    Sample normalizedKey,
-    Sample frequency,
-    Sample velocity,
-    GlobalParameter &param);
-  void release();
-  void rest();
-  Sample process(NoteProcessInfo<Sample> &info);
-};
+#define PROCESSING_UNIT_CLASS(INSTRSET)                                                  \
+  struct ProcessingUnit_##INSTRSET {                                                     \
+    PTRSyncSaw16 saw1;                                                                   \
+    PTRSyncSaw16 saw2;                                                                   \
+    Vec16f oscBuffer1 = 0.0f;                                                            \
+    Vec16f oscBuffer2 = 0.0f;                                                            \
+                                                                                         \
+    SerialFilter16 filter;                                                               \
+                                                                                         \
+    ExpADSREnvelope16 gainEnvelope;                                                      \
+    LinearEnvelope16 filterEnvelope;                                                     \
+    PolyExpEnvelope16 modEnvelope;                                                       \
+                                                                                         \
+    Vec16f normalizedKey = 0.0f;                                                         \
+    Vec16f frequency = 0.0f;                                                             \
+    Vec16f velocity = 0.0f;                                                              \
+    Vec16f gain = 0.0f;                                                                  \
+    Vec16ib bypassFilter = false;                                                        \
+                                                                                         \
+    /* Targets computed at control rate. Lanes in controlJump are started by note-on and \
+     * skip the interpolation. */                                                        \
+    ControlRamp<Vec16f> rampOscFreq1;                                                    \
+    ControlRamp<Vec16f> rampSyncFreq1;                                                   \
+    ControlRamp<Vec16f> rampOscFreq2;                                                    \
+    ControlRamp<Vec16f> rampSyncFreq2;                                                   \
+    ControlRamp<Vec16f> rampFilterFeedback;                                              \
+    Vec16ib controlJump = false;                                                         \
+                                                                                         \
+    bool isActive = false;                                                               \
+                                                                                         \
+    void setup(float sampleRate, uint32_t controlInterval);                              \
+    void setParameters(                                                                  \
+      const SmootherCommon<float> &smootherCommon,                                       \
+      NoteProcessInfo &info,                                                             \
+      GlobalParameter &param);                                                           \
+    void processControl(NoteProcessInfo &info, uint32_t nStep);                          \
+    void startControl(NoteProcessInfo &info);                                            \
+    void pushControl(                                                                    \
+      NoteProcessInfo &info, Vec16f modEnv, Vec16f filterEnv, uint32_t nStep);           \
+    Vec16f process(NoteProcessInfo &info);                                               \
+    void reset();                                                                        \
+  };
 
-class DSPCore {
+PROCESSING_UNIT_CLASS(AVX512)
+PROCESSING_UNIT_CLASS(AVX2)
+PROCESSING_UNIT_CLASS(SSE41)
+PROCESSING_UNIT_CLASS(SSE2)
+
+#define NOTE_CLASS(INSTRSET)                                                             \
+  class Note_##INSTRSET {                                                                \
+  public:                                                                                \
+    NoteState state = NoteState::rest;                                                   \
+                                                                                         \
+    int vecIndex = 0;                                                                    \
+    int arrayIndex = 0;                                                                  \
+    int32_t id = -1;                                                                     \
+                                                                                         \
+    void noteOn(                                                                         \
+      int32_t noteId,                                                                    \
+      float normalizedKey,                                                               \
+      float frequency,                                                                   \
+      float velocity,                                                                    \
+      std::array<ProcessingUnit_##INSTRSET, nUnit> &units,                               \
+      GlobalParameter &param);                                                           \
+    void release(std::array<ProcessingUnit_##INSTRSET, nUnit> &units);                   \
+    void rest();                                                                         \
+    bool isAttacking(std::array<ProcessingUnit_##INSTRSET, nUnit> &units);               \
+    bool isTerminated(std::array<ProcessingUnit_##INSTRSET, nUnit> &units);              \
+    float getGain(std::array<ProcessingUnit_##INSTRSET, nUnit> &units);                  \
+  };
+
+NOTE_CLASS(AVX512)
+NOTE_CLASS(AVX2)
+NOTE_CLASS(SSE41)
+NOTE_CLASS(SSE2)
+
+class DSPInterface {
 public:
+  virtual ~DSPInterface(){};
+
   static const size_t maxVoice = 32;
   GlobalParameter param;
 
-  void setup(double sampleRate);
-  void free();    // Release memory.
-  void reset();   // Stop sounds.
-  void startup(); // Reset phase, random seed etc.
-  void setParameters(float tempo);
-  void process(const size_t length, float *out0, float *out1);
-  void noteOn(int32_t noteId, int16_t pitch, float tuning, float velocity);
-  void noteOff(int32_t noteId);
+  virtual void setup(double sampleRate) = 0;
+  virtual void reset() = 0;   // Stop sounds.
+  virtual void startup() = 0; // Reset phase, random seed etc.
+  virtual void setParameters(float tempo) = 0;
+  virtual void process(const size_t length, float *out0, float *out1) = 0;
+  virtual void noteOn(int32_t noteId, int16_t pitch, float tuning, float velocity) = 0;
+  virtual void noteOff(int32_t noteId) = 0;
 
   struct MidiNote {
     bool isNoteOn;
@@ -141,85 +179,133 @@ public:
 
   std::vector<MidiNote> midiNotes;
 
-  void pushMidiNote(
+  virtual void pushMidiNote(
     bool isNoteOn,
     uint32_t frame,
     int32_t noteId,
     int16_t pitch,
     float tuning,
     float velocity)
-  {
-    MidiNote note;
-    note.isNoteOn = isNoteOn;
-    note.frame = frame;
-    note.id = noteId;
-    note.pitch = pitch;
-    note.tuning = tuning;
-    note.velocity = velocity;
-    midiNotes.push_back(note);
-  }
-
-  void processMidiNote(uint32_t frame)
-  {
-    while (true) {
-      auto it = std::find_if(midiNotes.begin(), midiNotes.end(), [&](const MidiNote &nt) {
-        return nt.frame == frame;
-      });
-      if (it == std::end(midiNotes)) return;
-      if (it->isNoteOn)
-        noteOn(it->id, it->pitch, it->tuning, it->velocity);
-      else
-        noteOff(it->id);
-      midiNotes.erase(it);
-    }
-  }
-
-private:
-  float sampleRate = 44100.0f;
-  float lfoPhase = 0.0f;
-  float lfoValue = 0.0f;
-
-  Pink<float> noise{0};
-
-  NoteProcessInfo<float> noteInfo;
-
-  ExpSmoother<float> interpMasterGain;
-  ExpSmoother<float> interpOsc1Gain;
-  ExpSmoother<float> interpOsc1Pitch;
-  ExpSmoother<float> interpOsc1Sync;
-  ExpSmoother<float> interpOsc2Gain;
-  ExpSmoother<float> interpOsc2Pitch;
-  ExpSmoother<float> interpOsc2Sync;
-  ExpSmoother<float> interpFMOsc1ToSync1;
-  ExpSmoother<float> interpFMOsc1ToFreq2;
-  ExpSmoother<float> interpFMOsc2ToSync1;
-  ExpSmoother<float> interpModEnvelopeToFreq1;
-  ExpSmoother<float> interpModEnvelopeToSync1;
-  ExpSmoother<float> interpModEnvelopeToFreq2;
-  ExpSmoother<float> interpModEnvelopeToSync2;
-  ExpSmoother<float> interpModLFOFrequency;
-  ExpSmoother<float> interpModLFONoiseMix;
-  ExpSmoother<float> interpModLFOToFreq1;
-  ExpSmoother<float> interpModLFOToSync1;
-  ExpSmoother<float> interpModLFOToFreq2;
-  ExpSmoother<float> interpModLFOToSync2;
-  ExpSmoother<float> interpGainEnvelopeCurve;
-  ExpSmoother<float> interpFilterCutoff;
-  ExpSmoother<float> interpFilterResonance;
-  ExpSmoother<float> interpFilterFeedback;
-  ExpSmoother<float> interpFilterSaturation;
-  ExpSmoother<float> interpFilterCutoffAmount;
-  ExpSmoother<float> interpFilterResonanceAmount;
-  ExpSmoother<float> interpFilterKeyToCutoff;
-  ExpSmoother<float> interpFilterKeyToFeedback;
-
-  size_t nVoice = 32;
-  std::array<std::array<std::unique_ptr<Note<float>>, 2>, maxVoice> notes;
-
-  // Transition happens when synth is playing all notes and user send a new note on.
-  // transitionBuffer is used to store a release of a note to reduce pop noise.
-  std::vector<float> transitionBuffer{};
-  bool isTransitioning = false;
-  size_t mptIndex = 0; // mpt for Max Poly Transition.
-  size_t mptStop = 0;
+    = 0;
+  virtual void processMidiNote(uint32_t frame) = 0;
 };
+
+#define DSPCORE_CLASS(INSTRSET)                                                          \
+  class DSPCore_##INSTRSET final : public DSPInterface {                                 \
+  public:                                                                                \
+    DSPCore_##INSTRSET();                                                                \
+                                                                                         \
+    void setup(double sampleRate) override;                                              \
+    void reset() override;                                                               \
+    void startup() override;                                                             \
+    void setParameters(float tempo) override;                                            \
+    void process(const size_t length, float *out0, float *out1) override;                \
+    void noteOn(int32_t noteId, int16_t pitch, float tuning, float velocity) override;   \
+    void noteOff(int32_t noteId) override;                                               \
+                                                                                         \
+    void pushMidiNote(                                                                   \
+      bool isNoteOn,                                                                     \
+      uint32_t frame,                                                                    \
+      int32_t noteId,                                                                    \
+      int16_t pitch,                                                                     \
+      float tuning,                                                                      \
+      float velocity) override                                                           \
+    {                                                                                    \
+      MidiNote note;                                                                     \
+      note.isNoteOn = isNoteOn;                                                          \
+      note.frame = frame;                                                                \
+      note.id = noteId;                                                                  \
+      note.pitch = pitch;                                                                \
+      note.tuning = tuning;                                                              \
+      note.velocity = velocity;                                                          \
+      midiNotes.push_back(note);                                                         \
+    }                                                                                    \
+                                                                                         \
+    void processMidiNote(uint32_t frame) override                                        \
+    {                                                                                    \
+      while (true) {                                                                     \
+        auto it                                                                          \
+          = std::find_if(midiNotes.begin(), midiNotes.end(), [&](const MidiNote &nt) {   \
+              return nt.frame == frame;                                                  \
+            });                                                                          \
+        if (it == std::end(midiNotes)) return;                                           \
+        if (it->isNoteOn)                                                                \
+          noteOn(it->id, it->pitch, it->tuning, it->velocity);                           \
+        else                                                                             \
+          noteOff(it->id);                                                               \
+        midiNotes.erase(it);                                                             \
+      }                                                                                  \
+    }                                                                                    \
+                                                                                         \
+  private:                                                                               \
+    void updateNoteState();                                                              \
+    void fillTransitionBuffer(size_t noteIndex);                                         \
+                                                                                         \
+    float sampleRate = 44100.0f;                                                         \
+    SmootherCommon<float> smootherCommon;                                                \
+    uint32_t controlInterval = 1;                                                        \
+    uint32_t controlCounter = 0;                                                         \
+    float lfoPhase = 0.0f;                                                               \
+    float lfoValue = 0.0f;                                                               \
+                                                                                         \
+    Pink<float> noise{0};                                                                \
+                                                                                         \
+    NoteProcessInfo noteInfo;                                                            \
+                                                                                         \
+    ExpSmoother<float> interpMasterGain;                                                 \
+    ExpSmoother<float> interpOsc1Gain;                                                   \
+    ExpSmoother<float> interpOsc1Pitch;                                                  \
+    ExpSmoother<float> interpOsc1Sync;                                                   \
+    ExpSmoother<float> interpOsc2Gain;                                                   \
+    ExpSmoother<float> interpOsc2Pitch;                                                  \
+    ExpSmoother<float> interpOsc2Sync;                                                   \
+    ExpSmoother<float> interpFMOsc1ToSync1;                                              \
+    ExpSmoother<float> interpFMOsc1ToFreq2;                                              \
+    ExpSmoother<float> interpFMOsc2ToSync1;                                              \
+    ExpSmoother<float> interpModEnvelopeToFreq1;                                         \
+    ExpSmoother<float> interpModEnvelopeToSync1;                                         \
+    ExpSmoother<float> interpModEnvelopeToFreq2;                                         \
+    ExpSmoother<float> interpModEnvelopeToSync2;                                         \
+    ExpSmoother<float> interpModLFOFrequency;                                            \
+    ExpSmoother<float> interpModLFONoiseMix;                                             \
+    ExpSmoother<float> interpModLFOToFreq1;                                              \
+    ExpSmoother<float> interpModLFOToSync1;                                              \
+    ExpSmoother<float> interpModLFOToFreq2;                                              \
+    ExpSmoother<float> interpModLFOToSync2;                                              \
+    ExpSmoother<float> interpGainEnvelopeCurve;                                          \
+    ExpSmoother<float> interpFilterCutoff;                                               \
+    ExpSmoother<float> interpFilterResonance;                                            \
+    ExpSmoother<float> interpFilterFeedback;                                             \
+    ExpSmoother<float> interpFilterSaturation;                                           \
+    ExpSmoother<float> interpFilterCutoffAmount;                                         \
+    ExpSmoother<float> interpFilterResonanceAmount;                                      \
+    ExpSmoother<float> interpFilterKeyToCutoff;                                          \
+    ExpSmoother<float> interpFilterKeyToFeedback;                                        \
+                                                                                         \
+    /* Smoothers above are processed at control rate. Ramps below fill the gap for the   \
+     * values used at audio rate. */                                                     \
+    ControlRamp<float> rampMasterGain;                                                   \
+    ControlRamp<float> rampOsc1Gain;                                                     \
+    ControlRamp<float> rampOsc2Gain;                                                     \
+    ControlRamp<float> rampFMOsc1ToSync1;                                                \
+    ControlRamp<float> rampFMOsc1ToFreq2;                                                \
+    ControlRamp<float> rampFMOsc2ToSync1;                                                \
+    ControlRamp<float> rampGainEnvelopeCurve;                                            \
+    ControlRamp<float> rampFilterSaturation;                                             \
+                                                                                         \
+    size_t nVoice = 32;                                                                  \
+    std::array<ProcessingUnit_##INSTRSET, nUnit> units;                                  \
+    std::array<std::array<Note_##INSTRSET, 2>, maxVoice> notes;                          \
+                                                                                         \
+    /* Transition happens when synth is playing all notes and user send a new note on.   \
+     * transitionBuffer is used to store a release of a note to reduce pop noise. */     \
+    std::vector<float> transitionBuffer{};                                               \
+    bool isTransitioning = false;                                                        \
+    size_t mptIndex = 0; /* mpt for Max Poly Transition. */                              \
+    size_t mptStop = 0;                                                                  \
+  };
+
+DSPCORE_CLASS(AVX512)
+DSPCORE_CLASS(AVX2)
+DSPCORE_CLASS(SSE41)
+DSPCORE_CLASS(SSE2)
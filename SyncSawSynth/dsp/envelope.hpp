@@ -15,361 +15,325 @@
 // You should have received a copy of the GNU General Public License
 // along with SyncSawSynth.  If not, see <https://www.gnu.org/licenses/>.
 
+
 #pragma once
 
 #include "../../common/dsp/constants.hpp"
 #include "../../common/dsp/smoother.hpp"
-#include "../../common/dsp/somemath.hpp"
+
+#include "../../lib/vcl/vectorclass.h"
+#include "../../lib/vcl/vectormath_exp.h"
+#include "../../lib/vcl/vectormath_trig.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace SomeDSP {
 
 // t in [0, 1].
-template<typename Sample> inline Sample cosinterp(Sample t)
-{
-  return 0.5 * (1.0 - somecos<Sample>(pi * t));
-}
+inline Vec16f cosinterp(Vec16f t) { return 0.5f * (1.0f - cos(float(pi) * t)); }
 
 // When using float, time will be shorten.
 // env(t) := exp(-beta * t)
-template<typename Sample> class ExpADSREnvelope {
+//
+// Attack, decay and release multipliers are shared by all 16 voices. set() is called on
+// every block, so they are the same for all voices anyway.
+class alignas(64) ExpADSREnvelope16 {
 public:
-  // attackTime, decayTime, releaseTime and declickTime are in seconds.
-  // sustainLevel in [0, 1]. 0.0 < threshold < 1.0.
-  ExpADSREnvelope(
-    Sample sampleRate,
-    Sample attackTime,
-    Sample decayTime,
-    Sample sustainLevel,
-    Sample releaseTime,
-    Sample declickTime = 0.001,
-    Sample threshold = 1e-5)
-    : sampleRate(sampleRate)
+  void setup(float sampleRate, float declickTime = 0.001f)
   {
-    reset(attackTime, decayTime, sustainLevel, releaseTime, declickTime, threshold);
+    this->sampleRate = sampleRate;
+    declickLength = int32_t(declickTime * sampleRate);
   }
 
-  void reset(
-    Sample attackTime,
-    Sample decayTime,
-    Sample sustainLevel,
-    Sample releaseTime,
-    Sample declickTime = 0.001,
-    Sample threshold = 1e-5)
+  void reset(int index)
   {
-    state = State::attack;
-    value = threshold;
-    lastAttack = value;
-    adTransitionCounter = adTransitionLength - 1;
-    set(attackTime, decayTime, sustainLevel, releaseTime, declickTime, threshold);
+    state.insert(index, stateAttack);
+    value.insert(index, threshold);
+    lastAttack.insert(index, threshold);
+    adTransitionCounter.insert(index, adTransitionLength - 1);
   }
 
-  // This method is slow.
+  // attackTime, decayTime and releaseTime are in seconds. sustainLevel in [0, 1].
   void set(
-    Sample attackTime,
-    Sample decayTime,
-    Sample sustainLevel,
-    Sample releaseTime,
-    Sample declickTime = 0.001,
-    Sample threshold = 1e-5)
+    const SmootherCommon<float> &common,
+    float attackTime,
+    float decayTime,
+    float sustainLevel,
+    float releaseTime)
   {
-    this->threshold = threshold;
-
-    const auto sampleLength = Sample(4.0) / sampleRate;
+    const auto sampleLength = 4.0f / sampleRate;
 
     if (attackTime < sampleLength) attackTime = sampleLength;
+    if (decayTime < sampleLength) decayTime = sampleLength;
 
-    this->decayTime = (decayTime < sampleLength) ? sampleLength : decayTime;
+    sustain.push(common, std::clamp(sustainLevel, 0.0f, 1.0f));
 
-    sustainLevel = std::max<Sample>(0.0, std::min<Sample>(sustainLevel, Sample(1.0)));
-    sustain.push(sustainLevel);
-
-    declickLength = int32_t(declickTime * sampleRate);
+    attackAlpha = powf(1.0f / threshold, 1.0f / (attackTime * sampleRate));
+    decayAlpha = powf(threshold, 1.0f / (decayTime * sampleRate));
 
     if (releaseTime * sampleRate <= declickLength)
       releaseAlpha = threshold;
     else
-      releaseAlpha = somepow<Sample>(
-        threshold, Sample(1.0) / (releaseTime * sampleRate - declickLength));
-
-    switch (state) {
-      case State::attack:
-        alpha = somepow<Sample>(
-          Sample(1.0) / threshold, Sample(1.0) / (attackTime * sampleRate));
-        break;
-
-      case State::adTransition:
-      case State::decay:
-        alpha = somepow<Sample>(threshold, Sample(1.0) / (decayTime * sampleRate));
-        break;
-
-      case State::release:
-        alpha = releaseAlpha;
-        break;
-
-      default:
-        break;
-    }
+      releaseAlpha = powf(threshold, 1.0f / (releaseTime * sampleRate - declickLength));
   }
 
-  void release()
+  void release(int index)
   {
-    switch (state) {
-      case State::attack:
-      case State::adTransition:
-        releaseRange = value;
+    const float v = value[index];
+    float range;
+    switch (state[index]) {
+      case stateAttack:
+      case stateAdTransition:
+        range = v;
         break;
 
-      case State::decay:
-        releaseRange = value - value * sustain.getValue() + sustain.getValue();
+      case stateDecay:
+        range = v - v * sustain.getValue() + sustain.getValue();
         break;
 
-      case State::terminated:
+      case stateTerminated:
         return;
 
       default:
-        releaseRange = sustain.getValue();
+        range = sustain.getValue();
         break;
     }
 
-    value = Sample(1.0);
-    alpha = releaseAlpha;
-    state = State::release;
+    value.insert(index, 1.0f);
+    releaseRange.insert(index, range);
+    state.insert(index, stateRelease);
   }
 
-  bool isAttacking() { return state == State::attack; }
-  bool isTerminated() { return state == State::terminated; }
-
-  Sample process()
+  void terminate()
   {
-    sustain.process();
-
-    Sample output;
-    switch (state) {
-      case State::attack:
-        lastAttack = value;
-        value *= alpha;
-        if (value >= Sample(1.0)) {
-          state = State::adTransition;
-          value = lastAttack;
-          adRange = Sample(1.0) - lastAttack;
-          goto AD_TRANSITION;
-        }
-        output = value;
-        break;
-
-      case State::adTransition:
-      AD_TRANSITION:
-        adRange *= Sample(0.5);
-        value += adRange;
-        adTransitionCounter -= 1;
-        if (adTransitionCounter < 0) {
-          state = State::decay;
-          alpha = somepow<Sample>(threshold, Sample(1.0) / (decayTime * sampleRate));
-        }
-        output = value;
-        break;
-
-      case State::decay:
-        value *= alpha;
-        output = value - value * sustain.getValue() + sustain.getValue();
-        if (output > sustain.getValue() + threshold) break;
-        state = State::sustain;
-        break;
-
-      case State::sustain:
-        return sustain.getValue();
-
-      case State::release:
-        value *= alpha;
-        if (value > threshold) {
-          output = value * releaseRange;
-          break;
-        }
-        value *= releaseRange;
-        state = State::declickOut;
-        output = value;
-        break;
+    value = 0.0f;
+    state = stateTerminated;
+  }
 
-      case State::declickOut:
-        value *= alpha;
-        declickCounter -= 1;
-        if (declickCounter > 0)
-          return value * cosinterp<Sample>(declickCounter / (Sample)declickLength);
-        value = 0.0;
-        state = State::terminated;
-        return value;
+  bool isAttacking(int index) { return state[index] == stateAttack; }
+  bool isTerminated(int index) { return state[index] == stateTerminated; }
+  bool isTerminated() { return horizontal_and(state == stateTerminated); }
 
-      default:
-        output = 0;
-        break;
+  Vec16f process()
+  {
+    sustain.process();
+    const float sus = sustain.getValue();
+
+    const Vec16ib isAttack = state == stateAttack;
+    const Vec16ib isDecay = state == stateDecay;
+    const Vec16ib isSustain = state == stateSustain;
+    const Vec16ib isRelease = state == stateRelease;
+    const Vec16ib isDeclickOut = state == stateDeclickOut;
+
+    // Attack. Transition to adTransition happens in the same sample.
+    const Vec16f attackValue = value * attackAlpha;
+    const Vec16ib attackEnd = isAttack & Vec16ib(attackValue >= 1.0f);
+    lastAttack = select(isAttack, value, lastAttack);
+    value = select(isAttack, select(attackEnd, lastAttack, attackValue), value);
+    adRange = select(attackEnd, 1.0f - lastAttack, adRange);
+    state = select(attackEnd, stateAdTransition, state);
+
+    // Transition from attack to decay.
+    const Vec16ib isAdTransition = state == stateAdTransition;
+    adRange = select(isAdTransition, 0.5f * adRange, adRange);
+    value = select(isAdTransition, value + adRange, value);
+    adTransitionCounter = select(isAdTransition, adTransitionCounter - 1, adTransitionCounter);
+    state = select(isAdTransition & (adTransitionCounter < 0), stateDecay, state);
+
+    // Decay.
+    value = select(isDecay, value * decayAlpha, value);
+    const Vec16f decayOut = value - value * sus + sus;
+    state = select(isDecay & Vec16ib(decayOut <= sus + threshold), stateSustain, state);
+
+    // Release.
+    value = select(isRelease | isDeclickOut, value * releaseAlpha, value);
+    const Vec16ib releaseEnd = isRelease & Vec16ib(value <= threshold);
+    const Vec16f releaseOut = value * releaseRange;
+    value = select(releaseEnd, releaseOut, value);
+    state = select(releaseEnd, stateDeclickOut, state);
+
+    Vec16f output = select(isAttack | isAdTransition, value, 0.0f);
+    output = select(isDecay, decayOut, output);
+    output = select(isRelease, releaseOut, output);
+
+    // Declick in. Skipped for the lanes in sustain or declickOut.
+    const Vec16ib isDeclickIn = ~(isSustain | isDeclickOut)
+      & (state != stateDeclickOut) & (declickCounter < declickLength);
+    if (horizontal_or(isDeclickIn)) {
+      declickCounter = select(isDeclickIn, declickCounter + 1, declickCounter);
+      output = select(
+        isDeclickIn, output * cosinterp(to_float(declickCounter) / float(declickLength)),
+        output);
     }
 
-    if (state != State::declickOut && declickCounter < declickLength) {
-      declickCounter += 1;
-      output *= cosinterp<Sample>(declickCounter / (Sample)declickLength);
+    // Declick out.
+    if (horizontal_or(isDeclickOut)) {
+      declickCounter = select(isDeclickOut, declickCounter - 1, declickCounter);
+      const Vec16ib declickOutEnd = isDeclickOut & (declickCounter <= 0);
+      value = select(declickOutEnd, 0.0f, value);
+      state = select(declickOutEnd, stateTerminated, state);
+      output = select(
+        isDeclickOut,
+        value * cosinterp(to_float(declickCounter) / float(declickLength)), output);
     }
 
-    return output;
+    return select(isSustain, sus, output);
   }
 
 protected:
-  enum class State : int32_t {
-    attack,
-    adTransition,
-    decay,
-    sustain,
-    release,
-    declickOut,
-    terminated
+  enum State : int32_t {
+    stateAttack,
+    stateAdTransition,
+    stateDecay,
+    stateSustain,
+    stateRelease,
+    stateDeclickOut,
+    stateTerminated
   };
 
-  static const int32_t adTransitionLength = 16;
-
-  int32_t declickLength;
-  int32_t declickCounter = 0;
-  int32_t adTransitionCounter = 0;
-
-  State state = State::attack;
-  Sample sampleRate;
-  Sample lastAttack;
-  Sample adRange;
-  Sample decayTime;
-  Sample releaseAlpha;
-  Sample releaseRange = 1.0;
-  Sample alpha;
-  Sample value;
-  Sample threshold = 1e-5;
-  LinearSmoother<Sample> sustain;
+  static constexpr int32_t adTransitionLength = 16;
+  static constexpr float threshold = 1e-5f;
+
+  float sampleRate = 44100.0f;
+  int32_t declickLength = 44;
+  float attackAlpha = 1.0f;
+  float decayAlpha = 1.0f;
+  float releaseAlpha = threshold;
+  LinearSmoother<float> sustain;
+
+  Vec16i state = stateTerminated;
+  Vec16i declickCounter = 0;
+  Vec16i adTransitionCounter = 0;
+  Vec16f lastAttack = 0.0f;
+  Vec16f adRange = 0.0f;
+  Vec16f releaseRange = 1.0f;
+  Vec16f value = 0.0f;
 };
 
-template<typename Sample> class LinearEnvelope {
+// Parameters are set per voice at note-on and kept until next note-on.
+class alignas(64) LinearEnvelope16 {
 public:
-  LinearEnvelope(
-    Sample sampleRate,
-    Sample attackTime,
-    Sample decayTime,
-    Sample sustainLevel,
-    Sample releaseTime)
-    : sampleRate(sampleRate)
+  // Running envelopes keep their time position when sample rate is changed.
+  void setup(float sampleRate)
   {
-    reset(attackTime, decayTime, sustainLevel, releaseTime);
+    if (this->sampleRate == sampleRate) return;
+    const float ratio = this->sampleRate / sampleRate;
+    attackDelta *= ratio;
+    decayDelta *= ratio;
+    releaseDelta *= ratio;
+    this->sampleRate = sampleRate;
   }
 
-  void reset(Sample attackTime, Sample decayTime, Sample sustainLevel, Sample releaseTime)
+  void reset(
+    int index, float attackTime, float decayTime, float sustainLevel, float releaseTime)
   {
-    set(attackTime, decayTime, sustainLevel, releaseTime);
-    state = State::attack;
-  }
+    const float sus = std::clamp(sustainLevel, 0.0f, 1.0f);
+    sustain.insert(index, sus);
+    decayRange.insert(index, 1.0f - sus);
 
-  void set(Sample attackTime, Sample decayTime, Sample sustainLevel, Sample releaseTime)
-  {
-    sustain = std::max<Sample>(0.0, std::min<Sample>(sustainLevel, 1.0));
-    decayRange = 1.0 - sustain;
+    attackDelta.insert(index, 1.0f / attackTime / sampleRate);
+    decayDelta.insert(index, 1.0f / decayTime / sampleRate);
+    releaseDelta.insert(index, 1.0f / releaseTime / sampleRate);
 
-    attackDelta = Sample(1.0) / attackTime / sampleRate;
-    decayDelta = Sample(1.0) / decayTime / sampleRate;
-    releaseDelta = Sample(1.0) / releaseTime / sampleRate;
+    state.insert(index, stateAttack);
   }
 
-  void release()
+  void release(int index)
   {
-    state = State::release;
-    releaseRange = value;
+    state.insert(index, stateRelease);
+    releaseRange.insert(index, value[index]);
   }
 
-  bool isTerminated() { return state == State::terminated; }
-
-  Sample process()
+  Vec16f process()
   {
-    switch (state) {
-      case State::attack:
-        value += attackDelta;
-        if (value >= 1.0) {
-          state = State::decay;
-          value = 1.0;
-        }
-        return value;
-
-      case State::decay:
-        value -= decayDelta * decayRange;
-        if (value <= sustain) {
-          state = State::sustain;
-          value = sustain;
-        }
-        return value;
-
-      case State::sustain:
-        return sustain;
-
-      case State::release:
-        value -= releaseDelta * releaseRange;
-        if (value < 0.0) {
-          state = State::terminated;
-          value = 0.0;
-        }
-        return value;
-
-      default:
-        break;
-    }
-    return 0.0;
+    const Vec16ib isAttack = state == stateAttack;
+    const Vec16ib isDecay = state == stateDecay;
+    const Vec16ib isRelease = state == stateRelease;
+
+    value = select(isAttack, value + attackDelta, value);
+    const Vec16ib attackEnd = isAttack & Vec16ib(value >= 1.0f);
+    value = select(attackEnd, 1.0f, value);
+    state = select(attackEnd, stateDecay, state);
+
+    value = select(isDecay, value - decayDelta * decayRange, value);
+    const Vec16ib decayEnd = isDecay & Vec16ib(value <= sustain);
+    value = select(decayEnd, sustain, value);
+    state = select(decayEnd, stateSustain, state);
+
+    value = select(isRelease, value - releaseDelta * releaseRange, value);
+    const Vec16ib releaseEnd = isRelease & Vec16ib(value < 0.0f);
+    value = select(releaseEnd, 0.0f, value);
+    state = select(releaseEnd, stateTerminated, state);
+
+    return getValue();
   }
 
+  // Output of last process() call.
+  Vec16f getValue() { return select(state == stateSustain, sustain, value); }
+
 protected:
-  enum class State : int32_t { attack, decay, sustain, release, terminated };
-  State state = State::attack;
-  Sample value = 0.0;
-  Sample sampleRate;
-  Sample sustain;
-  Sample attackDelta;
-  Sample decayDelta;
-  Sample decayRange;
-  Sample releaseDelta;
-  Sample releaseRange;
+  enum State : int32_t { stateAttack, stateDecay, stateSustain, stateRelease, stateTerminated };
+
+  float sampleRate = 44100.0f;
+  Vec16i state = stateTerminated;
+  Vec16f value = 0.0f;
+  Vec16f sustain = 0.0f;
+  Vec16f attackDelta = 0.0f;
+  Vec16f decayDelta = 0.0f;
+  Vec16f decayRange = 0.0f;
+  Vec16f releaseDelta = 0.0f;
+  Vec16f releaseRange = 0.0f;
 };
 
-// Almost always use double. float may be used if attack and curve is small.
 // env(t) := t^alpha * exp(-beta * t)
-// TODO: Find optimal range of alpha and beta.
-template<typename Sample> class PolyExpEnvelope {
+//
+// Computed in log domain, `exp(alpha * log(t) - beta * t - log(peak))`, because float
+// overflows on `t^alpha` and `exp(-beta * t)` underflows. Time is a sample counter to
+// avoid accumulation error.
+class alignas(64) PolyExpEnvelope16 {
 public:
-  // attack is in seconds. curve is arbitrary value.
-  PolyExpEnvelope(Sample sampleRate, Sample attack, Sample curve) : sampleRate(sampleRate)
+  // Running envelopes keep their time position when sample rate is changed.
+  void setup(float sampleRate)
   {
-    reset(attack, curve);
+    const float newTick = 1.0f / sampleRate;
+    if (tick == newTick) return;
+    counter *= tick / newTick;
+    tick = newTick;
   }
 
-  bool isReleasing() { return time >= attack; }
-
-  void reset(Sample attack, Sample curve)
+  // attack is in seconds. curve is arbitrary value.
+  void reset(int index, float attack, float curve)
   {
-    alpha = attack * curve;
-    peak = somepow<Sample>(alpha / curve, alpha) * someexp<Sample>(-alpha);
-    gamma = someexp<Sample>(-curve / sampleRate);
-    tick = 1.0 / sampleRate;
-
-    time = 0.0;
-    value = 1.0;
+    const float alpha = attack * curve;
+    this->alpha.insert(index, alpha);
+    beta.insert(index, curve);
+    logPeak.insert(index, alpha == 0.0f ? 0.0f : alpha * logf(alpha / curve) - alpha);
+    counter.insert(index, 0.0f);
   }
 
-  Sample process()
+  Vec16f process()
   {
-    auto output = somepow<Sample>(time, alpha) * value / peak;
-    if (!std::isfinite(output)) return 0.0; // TODO
-    time += tick;
-    value *= gamma;
+    const Vec16f output = getValue();
+    counter += 1.0f;
     return output;
   }
 
+  // Output of next process() call.
+  Vec16f getValue()
+  {
+    const Vec16f time = counter * tick;
+    const Vec16f logPoly = select(alpha == 0.0f, 0.0f, alpha * log(time));
+    const Vec16f output = exp(logPoly - beta * time - logPeak);
+    return select(is_finite(output), output, 0.0f);
+  }
+
 protected:
-  Sample sampleRate;
-  Sample value;
-  Sample peak;
-  Sample gamma;
-  Sample attack;
-  Sample tick;
-  Sample alpha;
-  Sample time;
+  float tick = 1.0f / 44100.0f;
+  Vec16f alpha = 0.0f;
+  Vec16f beta = 0.0f;
+  Vec16f logPeak = 0.0f;
+  Vec16f counter = 0.0f;
 };
 
 } // namespace SomeDSP
@@ -15,229 +15,184 @@
 // You should have received a copy of the GNU General Public License
 // along with SyncSawSynth.  If not, see <https://www.gnu.org/licenses/>.
 
+
 #pragma once
 
 #include <array>
-#include <memory>
 
 #include "../../common/dsp/constants.hpp"
-#include "../../common/dsp/somemath.hpp"
+#include "../../common/dsp/smoother.hpp"
 #include "../../lib/juce_FastMathApproximations.h"
 
+#include "../../lib/vcl/vectorclass.h"
+#include "../../lib/vcl/vectormath_exp.h"
+#include "../../lib/vcl/vectormath_hyp.h"
+#include "../../lib/vcl/vectormath_trig.h"
+
 namespace SomeDSP {
 
-enum class BiquadType {
+enum class BiquadType : int32_t {
   lowpass,
   highpass,
   bandpass,
   notch,
 };
 
-enum class ShaperType { hardclip, tanh, sinRunge, cubicExpDecayAbs };
+enum class ShaperType : int32_t { hardclip, tanh, sinRunge, cubicExpDecayAbs };
 
-template<typename Sample> class SerialFilter4 {
+// 4 serial biquads for 16 voices. Type and shaper can be set per voice.
+class alignas(64) SerialFilter16 {
 public:
-  BiquadType type = BiquadType::lowpass;
-  Sample fs;
-  Sample f0;
-  Sample q;
-
-  Sample b0 = 0.0;
-  Sample b1 = 0.0;
-  Sample b2 = 0.0;
-  Sample a0 = 0.0;
-  Sample a1 = 0.0;
-  Sample a2 = 0.0;
-
-  Sample w0 = 0.0;
-  Sample cos_w0 = 0.0;
-  Sample sin_w0 = 0.0;
-  Sample alpha = 0.0;
-
-  std::array<Sample, 4> x0{};
-  std::array<Sample, 4> x1{};
-  std::array<Sample, 4> x2{};
-  std::array<Sample, 4> y0{};
-  std::array<Sample, 4> y1{};
-  std::array<Sample, 4> y2{};
-
-  Sample feedback = 0.0;
-  Sample saturation = 1.0;
-  ShaperType shaper = ShaperType::sinRunge;
-
-  SerialFilter4(Sample sampleRate, Sample cutoff, Sample resonance)
-    : fs(sampleRate), f0(cutoff), q(resonance)
-  {
-  }
-
-  void reset()
-  {
-    b0 = b1 = b2 = 0.0f;
-    a0 = a1 = a2 = 0.0f;
-    clear();
-  }
-
-  void clear()
-  {
-    feedback = 0.0;
-    x1.fill(0);
-    x2.fill(0);
-    y1.fill(0);
-    y2.fill(0);
-  }
+  Vec16f feedback = 0.0f;
+  Vec16f saturation = 1.0f;
 
-  Sample clamp(Sample value, Sample min, Sample max)
-  {
-    return value < min ? min : value > max ? max : value;
-  }
+  void setup(float sampleRate) { fs = sampleRate; }
 
-  void setLowpass()
-  {
-    alpha = sin_w0 / (Sample(2.0) * q);
-    b0 = (Sample(1.0) - cos_w0) / Sample(2.0);
-    b1 = Sample(1.0) - cos_w0;
-    b2 = (Sample(1.0) - cos_w0) / Sample(2.0);
-    a0 = Sample(1.0) + alpha;
-    a1 = -Sample(2.0) * cos_w0;
-    a2 = Sample(1.0) - alpha;
-  }
+  void setType(int index, BiquadType type) { this->type.insert(index, int32_t(type)); }
 
-  void setHighpass()
+  void setShaper(int index, ShaperType shaper)
   {
-    alpha = sin_w0 / (Sample(2.0) * q);
-    b0 = (Sample(1.0) + cos_w0) / Sample(2.0);
-    b1 = -(Sample(1.0) + cos_w0);
-    b2 = (Sample(1.0) + cos_w0) / Sample(2.0);
-    a0 = Sample(1.0) + alpha;
-    a1 = -Sample(2.0) * cos_w0;
-    a2 = Sample(1.0) - alpha;
+    this->shaper.insert(index, int32_t(shaper));
   }
 
-  void setBandpass()
+  void clear(int index)
   {
-    // 0.34657359027997264 = log(2) / 2.
-    alpha = sin_w0 * somesinh<Sample>(Sample(0.34657359027997264) * q * w0 / sin_w0);
-    b0 = alpha;
-    b1 = 0.0;
-    b2 = -alpha;
-    a0 = Sample(1.0) + alpha;
-    a1 = -Sample(2.0) * cos_w0;
-    a2 = Sample(1.0) - alpha;
+    for (size_t i = 0; i < 4; ++i) {
+      x1[i].insert(index, 0.0f);
+      x2[i].insert(index, 0.0f);
+      y1[i].insert(index, 0.0f);
+      y2[i].insert(index, 0.0f);
+    }
   }
 
-  void setNotch()
+  // Coefficients reach the new values after `nStep` calls of process(). Lanes where `jump`
+  // is true are set immediately. When `nStep` is 0, only the `jump` lanes are updated.
+  void setCutoffQ(Vec16f hz, Vec16f q, uint32_t nStep = 1, Vec16ib jump = false)
   {
-    alpha = sin_w0 * somesinh<Sample>(Sample(0.34657359027997264) * q * w0 / sin_w0);
-    b0 = Sample(1.0);
-    b1 = -Sample(2.0) * cos_w0;
-    b2 = Sample(1.0);
-    a0 = Sample(1.0) + alpha;
-    a1 = -Sample(2.0) * cos_w0;
-    a2 = Sample(1.0) - alpha;
-  }
+    const Vec16f f0 = min(max(hz, 20.0f), 20000.0f);
+    q = min(max(q, 1e-5f), 1.0f);
+
+    const Vec16f w0 = float(twopi) * f0 / fs;
+    const Vec16f cos_w0 = juce::dsp::FastMathApproximations::cos<Vec16f>(w0);
+    const Vec16f sin_w0 = juce::dsp::FastMathApproximations::sin<Vec16f>(w0);
+
+    const Vec16ib isLowpass = type == int32_t(BiquadType::lowpass);
+    const Vec16ib isHighpass = type == int32_t(BiquadType::highpass);
+    const Vec16ib isBandpass = type == int32_t(BiquadType::bandpass);
+    const Vec16ib isNotch = type == int32_t(BiquadType::notch);
+
+    Vec16f alpha = sin_w0 / (2.0f * q);
+    const Vec16ib isBandwidth = isBandpass | isNotch;
+    if (horizontal_or(isBandwidth)) {
+      // 0.34657359027997264 = log(2) / 2.
+      alpha = select(
+        isBandwidth, sin_w0 * sinh(0.34657359027997264f * q * w0 / sin_w0), alpha);
+    }
 
-  void setCutoffQ(Sample hz, Sample q)
-  {
-    f0 = clamp(hz, Sample(20.0), Sample(20000.0));
-    this->q = clamp(q, Sample(1e-5), Sample(1.0));
-
-    w0 = twopi * f0 / fs;
-    cos_w0 = juce::dsp::FastMathApproximations::cos<Sample>(w0);
-    sin_w0 = juce::dsp::FastMathApproximations::sin<Sample>(w0);
-    switch (type) {
-      default:
-      case BiquadType::lowpass:
-        setLowpass();
-        break;
-
-      case BiquadType::highpass:
-        setHighpass();
-        break;
-
-      case BiquadType::bandpass:
-        setBandpass();
-        break;
-
-      case BiquadType::notch:
-        setNotch();
-        break;
+    const Vec16f a0 = 1.0f + alpha;
+    const Vec16f a1 = -2.0f * cos_w0 / a0;
+    const Vec16f a2 = (1.0f - alpha) / a0;
+
+    // Notch is the default.
+    Vec16f b0 = 1.0f;
+    Vec16f b1 = -2.0f * cos_w0;
+    b0 = select(isLowpass, 0.5f * (1.0f - cos_w0), b0);
+    b1 = select(isLowpass, 1.0f - cos_w0, b1);
+    b0 = select(isHighpass, 0.5f * (1.0f + cos_w0), b0);
+    b1 = select(isHighpass, -(1.0f + cos_w0), b1);
+    b0 = select(isBandpass, alpha, b0);
+    b1 = select(isBandpass, 0.0f, b1);
+    Vec16f b2 = select(isBandpass, -alpha, b0);
+
+    b0 /= a0;
+    b1 /= a0;
+    b2 /= a0;
+
+    if (nStep > 0) {
+      this->b0.push(b0, nStep);
+      this->b1.push(b1, nStep);
+      this->b2.push(b2, nStep);
+      this->a1.push(a1, nStep);
+      this->a2.push(a2, nStep);
     }
+    this->b0.jump(b0, jump);
+    this->b1.jump(b1, jump);
+    this->b2.jump(b2, jump);
+    this->a1.jump(a1, jump);
+    this->a2.jump(a2, jump);
   }
 
-  Sample shaperSinRunge(Sample x)
+  Vec16f process(Vec16f input)
   {
-    return somesin<Sample>(Sample(2.0 * pi) * x) / (Sample(1.0) + Sample(10.0) * x * x);
-  }
+    const Vec16f b0 = this->b0.process();
+    const Vec16f b1 = this->b1.process();
+    const Vec16f b2 = this->b2.process();
+    const Vec16f a1 = this->a1.process();
+    const Vec16f a2 = this->a2.process();
+
+    input = shape(saturation * (input - feedback * y1[3]));
+
+    // Each stage takes the output of previous stage at last sample.
+    std::array<Vec16f, 4> x0{input, y1[0], y1[1], y1[2]};
+    for (size_t i = 0; i < 4; ++i) {
+      const Vec16f y0 = b0 * x0[i] + b1 * x1[i] + b2 * x2[i] - a1 * y1[i] - a2 * y2[i];
+      x2[i] = x1[i];
+      x1[i] = x0[i];
+      y2[i] = y1[i];
+      y1[i] = y0;
+    }
 
-  Sample shaperCubicExpDecayAbs(Sample x)
-  {
-    // Solve x for: diff(x^3*exp(-x), x) = 0,
-    // then we get: x = 0, 27 * math.exp(-3).
-    // 0.7439087749328765 = 1 / (27 * math.exp(-3))
-    return Sample(0.7439087749328765) * x * x * x * someexp<Sample>(-somefabs<Sample>(x));
-  }
+    const Vec16fb isFinite = is_finite(y1[3]);
+    if (horizontal_and(isFinite)) return y1[3];
 
-  Sample shaperHardclip(Sample x)
-  {
-    return x < Sample(-1.0) ? Sample(-1.0) : x > Sample(1.0) ? Sample(1.0) : x;
+    for (size_t i = 0; i < 4; ++i) {
+      x1[i] = select(isFinite, x1[i], 0.0f);
+      x2[i] = select(isFinite, x2[i], 0.0f);
+      y1[i] = select(isFinite, y1[i], 0.0f);
+      y2[i] = select(isFinite, y2[i], 0.0f);
+    }
+    return y1[3];
   }
 
-  Sample process(Sample input)
+protected:
+  float fs = 44100.0f;
+  Vec16i type = int32_t(BiquadType::lowpass);
+  Vec16i shaper = int32_t(ShaperType::sinRunge);
+
+  // Coefficients are normalized by a0.
+  ControlRamp<Vec16f> b0;
+  ControlRamp<Vec16f> b1;
+  ControlRamp<Vec16f> b2;
+  ControlRamp<Vec16f> a1;
+  ControlRamp<Vec16f> a2;
+
+  std::array<Vec16f, 4> x1{};
+  std::array<Vec16f, 4> x2{};
+  std::array<Vec16f, 4> y1{};
+  std::array<Vec16f, 4> y2{};
+
+  // Shapers are only evaluated when at least one voice uses it.
+  Vec16f shape(Vec16f x)
   {
-    input = saturation * (input - feedback * y0[3]);
-    switch (shaper) {
-      default:
-      case ShaperType::hardclip:
-        input = shaperHardclip(input);
-        break;
-
-      case ShaperType::tanh:
-        // input = sometanh<Sample>(input);
-        input = juce::dsp::FastMathApproximations::tanh<Sample>(input);
-        break;
-
-      case ShaperType::sinRunge:
-        input = shaperSinRunge(input);
-        break;
-
-      case ShaperType::cubicExpDecayAbs:
-        input = shaperCubicExpDecayAbs(input);
-        break;
+    Vec16f out = min(max(x, -1.0f), 1.0f); // Hardclip.
+
+    const Vec16ib isTanh = shaper == int32_t(ShaperType::tanh);
+    if (horizontal_or(isTanh))
+      out = select(isTanh, juce::dsp::FastMathApproximations::tanh<Vec16f>(x), out);
+
+    const Vec16ib isSinRunge = shaper == int32_t(ShaperType::sinRunge);
+    if (horizontal_or(isSinRunge))
+      out = select(isSinRunge, sin(float(twopi) * x) / (1.0f + 10.0f * x * x), out);
+
+    const Vec16ib isCubic = shaper == int32_t(ShaperType::cubicExpDecayAbs);
+    if (horizontal_or(isCubic)) {
+      // Solve x for: diff(x^3*exp(-x), x) = 0,
+      // then we get: x = 0, 27 * math.exp(-3).
+      // 0.7439087749328765 = 1 / (27 * math.exp(-3))
+      out = select(isCubic, 0.7439087749328765f * x * x * x * exp(-abs(x)), out);
     }
 
-    x0[0] = input;
-    x0[1] = y0[0];
-    x0[2] = y0[1];
-    x0[3] = y0[2];
-
-    y0[0] = (b0 * x0[0] + b1 * x1[0] + b2 * x2[0] - a1 * y1[0] - a2 * y2[0]) / a0;
-    y0[1] = (b0 * x0[1] + b1 * x1[1] + b2 * x2[1] - a1 * y1[1] - a2 * y2[1]) / a0;
-    y0[2] = (b0 * x0[2] + b1 * x1[2] + b2 * x2[2] - a1 * y1[2] - a2 * y2[2]) / a0;
-    y0[3] = (b0 * x0[3] + b1 * x1[3] + b2 * x2[3] - a1 * y1[3] - a2 * y2[3]) / a0;
-
-    x2[0] = x1[0];
-    x2[1] = x1[1];
-    x2[2] = x1[2];
-    x2[3] = x1[3];
-
-    x1[0] = x0[0];
-    x1[1] = x0[1];
-    x1[2] = x0[2];
-    x1[3] = x0[3];
-
-    y2[0] = y1[0];
-    y2[1] = y1[1];
-    y2[2] = y1[2];
-    y2[3] = y1[3];
-
-    y1[0] = y0[0];
-    y1[1] = y0[1];
-    y1[2] = y0[2];
-    y1[3] = y0[3];
-
-    if (std::isfinite(y0[3])) return y0[3];
-    clear();
-    return 0.0;
+    return out;
   }
 };
 
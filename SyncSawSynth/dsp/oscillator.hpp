@@ -17,1006 +17,217 @@
 
 #pragma once
 
-#include "../../common/dsp/somemath.hpp"
+#include "../../common/dsp/constants.hpp"
+
+#include "../../lib/vcl/vectorclass.h"
+#include "../../lib/vcl/vectormath_trig.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
 
 namespace SomeDSP {
 
-template<typename Sample> class PTRSyncSaw {
-public:
-  PTRSyncSaw(Sample sampleRate, Sample oscFreq, Sample syncFreq) : sampleRate(sampleRate)
-  {
-    setOscFreq(oscFreq);
-    setSyncFreq(syncFreq);
-  }
+/*
+Coefficients of PTR (polynomial transition region) sawtooth.
+
+Order N PTR sawtooth is `h * P_k(n - k) + 2 * T * n - N * T - 1`, where `n = phase / T`,
+`k = floor(n)` and `h` is the height at the last phase reset. `P_k` is 0 when
+`k >= N - 1`. Each row holds a power of `(n - k)`, and each column holds `k`.
+
+Polynomials are shifted to each segment, so evaluation in float doesn't lose precision
+like the expanded form does. Order 12 to 16 (formerly double precision variants of order
+6 to 10) share the same tables.
+*/
+alignas(64) constexpr float ptrSawPoly2[3][16] = {
+  {2.0f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-1.0f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+};
 
-  void setOscFreq(Sample hz)
-  {
-    if (hz >= 0) oscTick = hz / sampleRate;
-  }
+alignas(64) constexpr float ptrSawPoly3[4][16] = {
+  {2.0f, 1.6666666f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -1.0f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -1.0f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-0.33333334f, 0.6666667f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+};
 
-  void setSyncFreq(Sample hz)
-  {
-    if (hz >= 0) syncTick = hz / sampleRate;
-  }
+alignas(64) constexpr float ptrSawPoly4[5][16] = {
+  {2.0f, 1.9166666f, 1.0f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.33333334f, -1.3333334f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.5f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.33333334f, 0.6666667f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-0.083333336f, 0.25f, -0.25f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+};
 
-  void setOrder(uint32_t order) { this->order = order; }
-  void setPhase(Sample phase) { oscPhase = phase - somefloor<Sample>(phase); }
+alignas(64) constexpr float ptrSawPoly5[6][16] = {
+  {2.0f, 1.9833333f, 1.55f, 0.45f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.083333336f, -0.9166667f, -0.9166667f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.16666667f, -0.5f, 0.5f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.16666667f, 0.16666667f, 0.16666667f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.083333336f, 0.25f, -0.25f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-0.016666668f, 0.06666667f, -0.1f, 0.06666667f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+};
 
-  void addPhase(Sample phase)
-  {
-    oscPhase += phase - somefloor<Sample>(phase);
-    if (oscPhase > 1.0) oscPhase -= 1.0;
-  }
+alignas(64) constexpr float ptrSawPoly6[7][16] = {
+  {2.0f, 1.9972222f, 1.8388889f, 1.0f, 0.16111112f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.016666668f, -0.43333334f, -1.1f, -0.43333334f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.041666668f, -0.41666666f, 0, 0.41666666f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.055555556f, -0.11111111f, 0.33333334f, -0.11111111f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.041666668f, 0.083333336f, 0, -0.083333336f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.016666668f, 0.06666667f, -0.1f, 0.06666667f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-0.0027777778f, 0.013888889f, -0.027777778f, 0.027777778f, -0.013888889f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+};
 
-  void ptr()
-  {
-    switch (order) {
-      case 0:
-        lastSig = ptrSaw0(oscPhase, oscTick);
-        break;
-
-      case 1:
-        lastSig = ptrSaw1(oscPhase, oscTick, height);
-        break;
-
-      case 2:
-        lastSig = ptrSaw2(oscPhase, oscTick, height);
-        break;
-
-      case 3:
-        lastSig = ptrSaw3(oscPhase, oscTick, height);
-        break;
-
-      case 4:
-        lastSig = ptrSaw4(oscPhase, oscTick, height);
-        break;
-
-      case 5:
-        lastSig = ptrSaw5(oscPhase, oscTick, height);
-        break;
-
-      case 6:
-        lastSig = ptrSaw6(oscPhase, oscTick, height);
-        break;
-
-      default:
-      case 7:
-        lastSig = ptrSaw7(oscPhase, oscTick, height);
-        break;
-
-      case 8:
-        lastSig = ptrSaw8(oscPhase, oscTick, height);
-        break;
-
-      case 9:
-        lastSig = ptrSaw9(oscPhase, oscTick, height);
-        break;
-
-      case 10:
-        lastSig = ptrSaw10(oscPhase, oscTick, height);
-        break;
-
-      case 11:
-        lastSig = -somesin<Sample>(oscPhase * Sample(2.0) * Sample(pi));
-        break;
-
-      case 12:
-        lastSig = ptrSaw6Double(oscPhase, oscTick, height);
-        break;
-
-      case 13:
-        lastSig = ptrSaw7Double(oscPhase, oscTick, height);
-        break;
-
-      case 14:
-        lastSig = ptrSaw8Double(oscPhase, oscTick, height);
-        break;
-
-      case 15:
-        lastSig = ptrSaw9Double(oscPhase, oscTick, height);
-        break;
-
-      case 16:
-        lastSig = ptrSaw10Double(oscPhase, oscTick, height);
-        break;
-    }
-  }
+alignas(64) constexpr float ptrSawPoly7[8][16] = {
+  {2.0f, 1.9996032f, 1.9519842f, 1.4793651f, 0.52063495f, 0.048015874f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.0027777778f, -0.15833333f, -0.8388889f, -0.8388889f, -0.15833333f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.008333334f, -0.20833333f, -0.33333334f, 0.33333334f, 0.20833333f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.013888889f, -0.125f, 0.1388889f, 0.1388889f, -0.125f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.013888889f, -0.013888889f, 0.11111111f, -0.11111111f, 0.013888889f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.008333334f, 0.025f, -0.016666668f, -0.016666668f, 0.025f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.0027777778f, 0.013888889f, -0.027777778f, 0.027777778f, -0.013888889f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-0.0003968254f, 0.0023809525f, -0.005952381f, 0.007936508f, -0.005952381f, 0.0023809525f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+};
 
-  Sample process(Sample modOsc = 0.0, Sample modSync = 0.0)
-  {
-    syncPhase += syncTick + modSync;
-    if (syncPhase >= Sample(1.0) || syncPhase < 0.0) {
-      syncPhase -= somefloor<Sample>(syncPhase);
-
-      oscPhase = syncPhase;
-      if (syncTick != 0.0) {
-        auto ratio = oscTick / syncTick;
-        height = ratio - somefloor<Sample>(ratio);
-      } else {
-        height = lastSig;
-        ptr();
-        lastSig = lastSig > Sample(1.0) ? Sample(1.0)
-                                        : lastSig < Sample(-1.0) ? Sample(-1.0) : lastSig;
-        return lastSig;
-      }
-    } else {
-      oscPhase += oscTick + modOsc;
-      if (oscPhase >= Sample(1.0) || oscPhase < 0.0) {
-        height = Sample(1.0);
-        oscPhase -= somefloor<Sample>(oscPhase);
-      }
-    }
-    ptr();
-    if (!std::isfinite(lastSig)) lastSig = 0.0;
-    return lastSig;
-  }
+alignas(64) constexpr float ptrSawPoly8[9][16] = {
+  {2.0f, 1.9999504f, 1.9876984f, 1.774752f, 1.0f, 0.22524801f, 0.0123015875f, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.0003968254f, -0.04761905f, -0.47261906f, -0.95873016f, -0.47261906f, -0.04761905f, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.0013888889f, -0.07777778f, -0.3402778f, 0, 0.3402778f, 0.07777778f, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.0027777778f, -0.06666667f, -0.041666668f, 0.22222222f, -0.041666668f, -0.06666667f, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.0034722222f, -0.027777778f, 0.065972224f, 0, -0.065972224f, 0.027777778f, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.0027777778f, 0, 0.025f, -0.044444446f, 0.025f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.0013888889f, 0.0055555557f, -0.0069444445f, 0, 0.0069444445f, -0.0055555557f, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.0003968254f, 0.0023809525f, -0.005952381f, 0.007936508f, -0.005952381f, 0.0023809525f, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-4.9603175e-05f, 0.00034722223f, -0.0010416667f, 0.0017361111f, -0.0017361111f, 0.0010416667f, -0.00034722223f, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+};
 
-protected:
-  uint32_t order = 7;
-  Sample sampleRate;
-  Sample oscPhase = 0.0; // Range in [0, 1)
-  Sample oscTick = 0.0;  // sec/sample
-  Sample height = 1.0;   // Range in [0, 1]. Sample value at phase reset of hardsync.
-  Sample syncPhase = 0.0;
-  Sample syncTick = 0.0;
-  Sample lastSig = 0.0;
-
-  float ptrSaw0(float phi, float T) { return float(2) * T * phi / T - float(1); }
-
-  float ptrSaw1(float phi, float T, float h = 1.0)
-  {
-    float n = phi / T;
-    if (n >= float(0)) return float(2) * T * n - T - float(1);
-    if (n < float(1))
-      return -float(2) * h * n + float(2) * T * n + float(2) * h - T - float(1);
-    return 0.0; // Just in case.
-  }
+alignas(64) constexpr float ptrSawPoly9[10][16] = {
+  {2.0f, 1.9999945f, 1.9972278f, 1.9167162f, 1.4304178f, 0.5695822f, 0.08328373f, 0.0027722663f, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -4.9603175e-05f, -0.012251984f, -0.21294643f, -0.77475196f, -0.77475196f, -0.21294643f, -0.012251984f, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.0001984127f, -0.023611112f, -0.2125f, -0.24305555f, 0.24305555f, 0.2125f, 0.023611112f, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.00046296295f, -0.025462963f, -0.0875f, 0.113425925f, 0.113425925f, -0.0875f, -0.025462963f, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.00069444446f, -0.015972223f, 0.00625f, 0.065972224f, -0.065972224f, -0.00625f, 0.015972223f, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.00069444446f, -0.0048611113f, 0.01875f, -0.013194445f, -0.013194445f, 0.01875f, -0.0048611113f, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.00046296295f, 0.00046296295f, 0.004166667f, -0.011574074f, 0.011574074f, -0.004166667f, -0.00046296295f, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.0001984127f, 0.0009920635f, -0.0017857143f, 0.0009920635f, 0.0009920635f, -0.0017857143f, 0.0009920635f, 0, 0, 0, 0, 0, 0, 0, 0},
+  {0, -4.9603175e-05f, 0.00034722223f, -0.0010416667f, 0.0017361111f, -0.0017361111f, 0.0010416667f, -0.00034722223f, 0, 0, 0, 0, 0, 0, 0, 0},
+  {-5.5114638e-06f, 4.409171e-05f, -0.000154321f, 0.000308642f, -0.00038580247f, 0.000308642f, -0.000154321f, 4.409171e-05f, 0, 0, 0, 0, 0, 0, 0, 0},
+};
 
-  float ptrSaw2(float phi, float T, float h = 1.0)
-  {
-    float n = phi / T;
-    if (n >= float(1)) return float(2) * T * n - float(2) * T - float(1);
-    if (n < float(1))
-      return -h * n * n + float(2) * T * n + float(2) * h - float(2) * T - float(1);
-    if (n < float(2))
-      return h * n * n - float(4) * h * n + float(2) * T * n + float(4) * h - float(2) * T
-        - float(1);
-    return 0.0; // Just in case.
-  }
+alignas(64) constexpr float ptrSawPoly10[11][16] = {
+  {2.0f, 1.9999994f, 1.9994411f, 1.9730743f, 1.7221968f, 1.0f, 0.27780312f, 0.026925705f, 0.00055886246f, 0, 0, 0, 0, 0, 0, 0},
+  {0, -5.5114638e-06f, -0.002766755f, -0.080511466f, -0.4862985f, -0.86083555f, -0.4862985f, -0.080511466f, -0.002766755f, 0, 0, 0, 0, 0, 0, 0},
+  {0, -2.4801588e-05f, -0.0061011906f, -0.10034722f, -0.28090277f, 0, 0.28090277f, 0.10034722f, 0.0061011906f, 0, 0, 0, 0, 0, 0, 0},
+  {0, -6.613757e-05f, -0.0078042326f, -0.062962964f, -0.010185185f, 0.16203703f, -0.010185185f, -0.062962964f, -0.0078042326f, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.00011574074f, -0.00625f, -0.015509259f, 0.050231483f, 0, -0.050231483f, 0.015509259f, 0.00625f, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.00013888889f, -0.0030555555f, 0.0044444446f, 0.011944445f, -0.02638889f, 0.011944445f, 0.0044444446f, -0.0030555555f, 0, 0, 0, 0, 0, 0, 0},
+  {0, -0.00011574074f, -0.00069444446f, 0.0039351853f, -0.005324074f, 0, 0.005324074f, -0.0039351853f, 0.00069444446f, 0, 0, 0, 0, 0, 0, 0},
+  {0, -6.613757e-05f, 0.00013227513f, 0.00052910054f, -0.0022486772f, 0.0033068783f, -0.0022486772f, 0.00052910054f, 0.00013227513f, 0, 0, 0, 0, 0, 0, 0},
+  {0, -2.4801588e-05f, 0.00014880953f, -0.00034722223f, 0.00034722223f, 0, -0.00034722223f, 0.00034722223f, -0.00014880953f, 0, 0, 0, 0, 0, 0, 0},
+  {0, -5.5114638e-06f, 4.409171e-05f, -0.000154321f, 0.000308642f, -0.00038580247f, 0.000308642f, -0.000154321f, 4.409171e-05f, 0, 0, 0, 0, 0, 0, 0},
+  {-5.511464e-07f, 4.9603173e-06f, -1.9841269e-05f, 4.6296296e-05f, -6.9444446e-05f, 6.9444446e-05f, -4.6296296e-05f, 1.9841269e-05f, -4.9603173e-06f, 0, 0, 0, 0, 0, 0, 0},
+};
 
-  float ptrSaw3(float phi, float T, float h = 1.0)
-  {
-    float n = phi / T;
-    if (n >= float(2)) return float(2) * T * n - float(3) * T - float(1);
-    if (n < float(1))
-      return -(h * n * n * n) / float(3) + float(2) * T * n + float(2) * h - float(3) * T
-        - float(1);
-    if (n < float(2))
-      return (float(2) * h * n * n * n) / float(3) - float(3) * h * n * n
-        + float(3) * h * n + float(2) * T * n + h - float(3) * T - float(1);
-    if (n < float(3))
-      return -(h * n * n * n) / float(3) + float(3) * h * n * n - float(9) * h * n
-        + float(2) * T * n + float(9) * h - float(3) * T - float(1);
-    return 0.0; // Just in case.
-  }
+class alignas(64) PTRSyncSaw16 {
+public:
+  void setup(float sampleRate) { this->sampleRate = sampleRate; }
 
-  float ptrSaw4(float phi, float T, float h = 1.0)
-  {
-    float n = phi / T;
-    if (n >= float(3)) return float(2) * T * n - float(4) * T - float(1);
-    if (n < float(1))
-      return -(h * n * n * n * n) / float(12) + float(2) * T * n + float(2) * h
-        - float(4) * T - float(1);
-    if (n < float(2))
-      return (h * n * n * n * n) / float(4) - (float(4) * h * n * n * n) / float(3)
-        + float(2) * h * n * n - (float(4) * h * n) / float(3) + float(2) * T * n
-        + (float(7) * h) / float(3) - float(4) * T - float(1);
-    if (n < float(3))
-      return -(h * n * n * n * n) / float(4) + (float(8) * h * n * n * n) / float(3)
-        - float(10) * h * n * n + (float(44) * h * n) / float(3) + float(2) * T * n
-        - (float(17) * h) / float(3) - float(4) * T - float(1);
-    if (n < float(4))
-      return (h * n * n * n * n) / float(12) - (float(4) * h * n * n * n) / float(3)
-        + float(8) * h * n * n - (float(64) * h * n) / float(3) + float(2) * T * n
-        + (float(64) * h) / float(3) - float(4) * T - float(1);
-    return 0.0; // Just in case.
-  }
+  void setOscFreq(Vec16f hz) { oscTick = select(hz >= 0.0f, hz / sampleRate, oscTick); }
+  void setSyncFreq(Vec16f hz) { syncTick = select(hz >= 0.0f, hz / sampleRate, syncTick); }
 
-  float ptrSaw5(float phi, float T, float h = 1.0)
+  // Kernel is picked here instead of in process(), so the per-sample path doesn't branch
+  // on order.
+  void setOrder(uint32_t order)
   {
-    float n = phi / T;
-    if (n >= float(4)) return float(2) * T * n - float(5) * T - float(1);
-    if (n < float(1))
-      return -(h * n * n * n * n * n) / float(60) + float(2) * T * n + float(2) * h
-        - float(5) * T - float(1);
-    if (n < float(2))
-      return (h * n * n * n * n * n) / float(15)
-        - (float(5) * h * n * n * n * n) / float(12)
-        + (float(5) * h * n * n * n) / float(6) - (float(5) * h * n * n) / float(6)
-        + (float(5) * h * n) / float(12) + float(2) * T * n + (float(23) * h) / float(12)
-        - float(5) * T - float(1);
-    if (n < float(3))
-      return -(h * n * n * n * n * n) / float(10)
-        + (float(5) * h * n * n * n * n) / float(4)
-        - (float(35) * h * n * n * n) / float(6) + (float(25) * h * n * n) / float(2)
-        - (float(155) * h * n) / float(12) + float(2) * T * n + (float(29) * h) / float(4)
-        - float(5) * T - float(1);
-    if (n < float(4))
-      return (h * n * n * n * n * n) / float(15)
-        - (float(5) * h * n * n * n * n) / float(4)
-        + (float(55) * h * n * n * n) / float(6) - (float(65) * h * n * n) / float(2)
-        + (float(655) * h * n) / float(12) + float(2) * T * n
-        - (float(133) * h) / float(4) - float(5) * T - float(1);
-    if (n < float(5))
-      return -(h * n * n * n * n * n) / float(60)
-        + (float(5) * h * n * n * n * n) / float(12)
-        - (float(25) * h * n * n * n) / float(6) + (float(125) * h * n * n) / float(6)
-        - (float(625) * h * n) / float(12) + float(2) * T * n
-        + (float(625) * h) / float(12) - float(5) * T - float(1);
-    return 0.0; // Just in case.
-  }
+    // Indexed by order.
+    static constexpr std::array<PtrFunc, 17> ptrTable{
+      &PTRSyncSaw16::ptrSaw0,
+      &PTRSyncSaw16::ptrSaw1,
+      &PTRSyncSaw16::ptrSawN<2, ptrSawPoly2>,
+      &PTRSyncSaw16::ptrSawN<3, ptrSawPoly3>,
+      &PTRSyncSaw16::ptrSawN<4, ptrSawPoly4>,
+      &PTRSyncSaw16::ptrSawN<5, ptrSawPoly5>,
+      &PTRSyncSaw16::ptrSawN<6, ptrSawPoly6>,
+      &PTRSyncSaw16::ptrSawN<7, ptrSawPoly7>,
+      &PTRSyncSaw16::ptrSawN<8, ptrSawPoly8>,
+      &PTRSyncSaw16::ptrSawN<9, ptrSawPoly9>,
+      &PTRSyncSaw16::ptrSawN<10, ptrSawPoly10>,
+      &PTRSyncSaw16::ptrSine,
+      &PTRSyncSaw16::ptrSawN<6, ptrSawPoly6>,
+      &PTRSyncSaw16::ptrSawN<7, ptrSawPoly7>,
+      &PTRSyncSaw16::ptrSawN<8, ptrSawPoly8>,
+      &PTRSyncSaw16::ptrSawN<9, ptrSawPoly9>,
+      &PTRSyncSaw16::ptrSawN<10, ptrSawPoly10>,
+    };
 
-  float ptrSaw6(float phi, float T, float h = 1.0)
-  {
-    float n = phi / T;
-    if (n >= float(5)) return float(2) * T * n - float(6) * T - float(1);
-    if (n < float(1))
-      return -(h * n * n * n * n * n * n) / float(360) + float(2) * T * n + float(2) * h
-        - float(6) * T - float(1);
-    if (n < float(2))
-      return (h * n * n * n * n * n * n) / float(72) - (h * n * n * n * n * n) / float(10)
-        + (h * n * n * n * n) / float(4) - (h * n * n * n) / float(3)
-        + (h * n * n) / float(4) - (h * n) / float(10) + float(2) * T * n
-        + (float(121) * h) / float(60) - float(6) * T - float(1);
-    if (n < float(3))
-      return -(h * n * n * n * n * n * n) / float(36)
-        + (float(2) * h * n * n * n * n * n) / float(5)
-        - (float(9) * h * n * n * n * n) / float(4)
-        + (float(19) * h * n * n * n) / float(3) - (float(39) * h * n * n) / float(4)
-        + (float(79) * h * n) / float(10) + float(2) * T * n - (float(13) * h) / float(20)
-        - float(6) * T - float(1);
-    if (n < float(4))
-      return (h * n * n * n * n * n * n) / float(36)
-        - (float(3) * h * n * n * n * n * n) / float(5)
-        + (float(21) * h * n * n * n * n) / float(4)
-        - (float(71) * h * n * n * n) / float(3) + (float(231) * h * n * n) / float(4)
-        - (float(731) * h * n) / float(10) + float(2) * T * n
-        + (float(797) * h) / float(20) - float(6) * T - float(1);
-    if (n < float(5))
-      return -(h * n * n * n * n * n * n) / float(72)
-        + (float(2) * h * n * n * n * n * n) / float(5)
-        - (float(19) * h * n * n * n * n) / float(4)
-        + (float(89) * h * n * n * n) / float(3) - (float(409) * h * n * n) / float(4)
-        + (float(1829) * h * n) / float(10) + float(2) * T * n
-        - (float(7849) * h) / float(60) - float(6) * T - float(1);
-    if (n < float(6))
-      return (h * n * n * n * n * n * n) / float(360)
-        - (h * n * n * n * n * n) / float(10) + (float(3) * h * n * n * n * n) / float(2)
-        - float(12) * h * n * n * n + float(54) * h * n * n
-        - (float(648) * h * n) / float(5) + float(2) * T * n + (float(648) * h) / float(5)
-        - float(6) * T - float(1);
-    return 0.0; // Just in case.
+    if (order >= ptrTable.size()) order = 7;
+    ptrFunc = ptrTable[order];
   }
 
-  float ptrSaw7(float phi, float T, float h = 1.0)
+  void setPhase(int index, float phase)
   {
-    float n = phi / T;
-    if (n >= float(6)) return float(2) * T * n - float(7) * T - float(1);
-    if (n < float(1)) {
-      return -(h * n * n * n * n * n * n * n) / float(2520) + float(2) * T * n
-        + float(2) * h - float(7) * T - float(1);
-    }
-    if (n < float(2))
-      return (h * n * n * n * n * n * n * n) / float(420)
-        - (float(7) * h * n * n * n * n * n * n) / float(360)
-        + (float(7) * h * n * n * n * n * n) / float(120)
-        - (float(7) * h * n * n * n * n) / float(72)
-        + (float(7) * h * n * n * n) / float(72) - (float(7) * h * n * n) / float(120)
-        + (float(7) * h * n) / float(360) + float(2) * T * n
-        + (float(719) * h) / float(360) - float(7) * T - float(1);
-    if (n < float(3))
-      return -(h * n * n * n * n * n * n * n) / float(168)
-        + (float(7) * h * n * n * n * n * n * n) / float(72)
-        - (float(77) * h * n * n * n * n * n) / float(120)
-        + (float(161) * h * n * n * n * n) / float(72)
-        - (float(329) * h * n * n * n) / float(72) + (float(133) * h * n * n) / float(24)
-        - (float(1337) * h * n) / float(360) + float(2) * T * n
-        + (float(1103) * h) / float(360) - float(7) * T - float(1);
-    if (n < float(4))
-      return (h * n * n * n * n * n * n * n) / float(126)
-        - (float(7) * h * n * n * n * n * n * n) / float(36)
-        + (float(119) * h * n * n * n * n * n) / float(60)
-        - (float(98) * h * n * n * n * n) / float(9)
-        + (float(1253) * h * n * n * n) / float(36) - (float(196) * h * n * n) / float(3)
-        + (float(12089) * h * n) / float(180) + float(2) * T * n
-        - (float(1229) * h) / float(45) - float(7) * T - float(1);
-    if (n < float(5))
-      return -(h * n * n * n * n * n * n * n) / float(168)
-        + (float(7) * h * n * n * n * n * n * n) / float(36)
-        - (float(161) * h * n * n * n * n * n) / float(60)
-        + (float(182) * h * n * n * n * n) / float(9)
-        - (float(3227) * h * n * n * n) / float(36) + (float(700) * h * n * n) / float(3)
-        - (float(59591) * h * n) / float(180) + float(2) * T * n
-        + (float(9011) * h) / float(45) - float(7) * T - float(1);
-    if (n < float(6))
-      return (h * n * n * n * n * n * n * n) / float(420)
-        - (float(7) * h * n * n * n * n * n * n) / float(72)
-        + (float(203) * h * n * n * n * n * n) / float(120)
-        - (float(1169) * h * n * n * n * n) / float(72)
-        + (float(6671) * h * n * n * n) / float(72)
-        - (float(7525) * h * n * n) / float(24) + (float(208943) * h * n) / float(360)
-        + float(2) * T * n - (float(162287) * h) / float(360) - float(7) * T - float(1);
-    if (n < float(7))
-      return -(h * n * n * n * n * n * n * n) / float(2520)
-        + (float(7) * h * n * n * n * n * n * n) / float(360)
-        - (float(49) * h * n * n * n * n * n) / float(120)
-        + (float(343) * h * n * n * n * n) / float(72)
-        - (float(2401) * h * n * n * n) / float(72)
-        + (float(16807) * h * n * n) / float(120) - (float(117649) * h * n) / float(360)
-        + float(2) * T * n + (float(117649) * h) / float(360) - float(7) * T - float(1);
-    return 0.0; // Just in case.
+    oscPhase.insert(index, phase - std::floor(phase));
   }
 
-  float ptrSaw8(float phi, float T, float h = 1.0)
+  void addPhase(int index, float phase)
   {
-    float n = phi / T;
-    if (n >= float(7)) return float(2) * T * n - float(8) * T - float(1);
-    if (n < float(1))
-      return -(h * n * n * n * n * n * n * n * n) / float(20160) + float(2) * T * n
-        + float(2) * h - float(8) * T - float(1);
-    if (n < float(2))
-      return (h * n * n * n * n * n * n * n * n) / float(2880)
-        - (h * n * n * n * n * n * n * n) / float(315)
-        + (h * n * n * n * n * n * n) / float(90) - (h * n * n * n * n * n) / float(45)
-        + (h * n * n * n * n) / float(36) - (h * n * n * n) / float(45)
-        + (h * n * n) / float(90) - (h * n) / float(315) + float(2) * T * n
-        + (float(5041) * h) / float(2520) - float(8) * T - float(1);
-    if (n < float(3))
-      return -(h * n * n * n * n * n * n * n * n) / float(960)
-        + (float(2) * h * n * n * n * n * n * n * n) / float(105)
-        - (float(13) * h * n * n * n * n * n * n) / float(90)
-        + (float(3) * h * n * n * n * n * n) / float(5)
-        - (float(55) * h * n * n * n * n) / float(36)
-        + (float(37) * h * n * n * n) / float(15) - (float(223) * h * n * n) / float(90)
-        + (float(149) * h * n) / float(105) + float(2) * T * n
-        + (float(829) * h) / float(504) - float(8) * T - float(1);
-    if (n < float(4))
-      return (h * n * n * n * n * n * n * n * n) / float(576)
-        - (h * n * n * n * n * n * n * n) / float(21)
-        + (float(5) * h * n * n * n * n * n * n) / float(9)
-        - (float(18) * h * n * n * n * n * n) / float(5)
-        + (float(128) * h * n * n * n * n) / float(9)
-        - (float(106) * h * n * n * n) / float(3) + (float(488) * h * n * n) / float(9)
-        - (float(4954) * h * n) / float(105) + float(2) * T * n
-        + (float(6259) * h) / float(315) - float(8) * T - float(1);
-    if (n < float(5))
-      return -(h * n * n * n * n * n * n * n * n) / float(576)
-        + (float(4) * h * n * n * n * n * n * n * n) / float(63)
-        - h * n * n * n * n * n * n + (float(398) * h * n * n * n * n * n) / float(45)
-        - float(48) * h * n * n * n * n + (float(1474) * h * n * n * n) / float(9)
-        - float(344) * h * n * n + (float(128498) * h * n) / float(315) + float(2) * T * n
-        - (float(7269) * h) / float(35) - float(8) * T - float(1);
-    if (n < float(6))
-      return (h * n * n * n * n * n * n * n * n) / float(960)
-        - (h * n * n * n * n * n * n * n) / float(21)
-        + (float(17) * h * n * n * n * n * n * n) / float(18)
-        - (float(53) * h * n * n * n * n * n) / float(5)
-        + (float(2647) * h * n * n * n * n) / float(36)
-        - (float(967) * h * n * n * n) / float(3) + (float(15683) * h * n * n) / float(18)
-        - (float(139459) * h * n) / float(105) + float(2) * T * n
-        + (float(2211007) * h) / float(2520) - float(8) * T - float(1);
-    if (n < float(7))
-      return -(h * n * n * n * n * n * n * n * n) / float(2880)
-        + (float(2) * h * n * n * n * n * n * n * n) / float(105)
-        - (float(41) * h * n * n * n * n * n * n) / float(90)
-        + (float(31) * h * n * n * n * n * n) / float(5)
-        - (float(1889) * h * n * n * n * n) / float(36)
-        + (float(4237) * h * n * n * n) / float(15)
-        - (float(84881) * h * n * n) / float(90) + (float(187133) * h * n) / float(105)
-        + float(2) * T * n - (float(3667649) * h) / float(2520) - float(8) * T - float(1);
-    if (n < float(8))
-      return (h * n * n * n * n * n * n * n * n) / float(20160)
-        - (h * n * n * n * n * n * n * n) / float(315)
-        + (float(4) * h * n * n * n * n * n * n) / float(45)
-        - (float(64) * h * n * n * n * n * n) / float(45)
-        + (float(128) * h * n * n * n * n) / float(9)
-        - (float(4096) * h * n * n * n) / float(45)
-        + (float(16384) * h * n * n) / float(45) - (float(262144) * h * n) / float(315)
-        + float(2) * T * n + (float(262144) * h) / float(315) - float(8) * T - float(1);
-    return 0.0; // Just in case.
+    float value = oscPhase[index] + phase - std::floor(phase);
+    if (value > 1.0f) value -= 1.0f;
+    oscPhase.insert(index, value);
   }
 
-  float ptrSaw9(float phi, float T, float h = 1.0)
+  Vec16f process(Vec16f modOsc, Vec16f modSync)
   {
-    float n = phi / T;
-    if (n >= float(8)) return float(2) * T * n - float(9) * T - float(1);
-    if (n < float(1))
-      return -(h * n * n * n * n * n * n * n * n * n) / float(181440) + float(2) * T * n
-        + float(2) * h - float(9) * T - float(1);
-    if (n < float(2))
-      return (h * n * n * n * n * n * n * n * n * n) / float(22680)
-        - (h * n * n * n * n * n * n * n * n) / float(2240)
-        + (h * n * n * n * n * n * n * n) / float(560)
-        - (h * n * n * n * n * n * n) / float(240) + (h * n * n * n * n * n) / float(160)
-        - (h * n * n * n * n) / float(160) + (h * n * n * n) / float(240)
-        - (h * n * n) / float(560) + (h * n) / float(2240) + float(2) * T * n
-        + (float(40319) * h) / float(20160) - float(9) * T - float(1);
-    if (n < float(3))
-      return -(h * n * n * n * n * n * n * n * n * n) / float(6480)
-        + (h * n * n * n * n * n * n * n * n) / float(320)
-        - (float(3) * h * n * n * n * n * n * n * n) / float(112)
-        + (float(31) * h * n * n * n * n * n * n) / float(240)
-        - (float(63) * h * n * n * n * n * n) / float(160)
-        + (float(127) * h * n * n * n * n) / float(160)
-        - (float(17) * h * n * n * n) / float(16) + (float(73) * h * n * n) / float(80)
-        - (float(1023) * h * n) / float(2240) + float(2) * T * n
-        + (float(42367) * h) / float(20160) - float(9) * T - float(1);
-    if (n < float(4))
-      return (h * n * n * n * n * n * n * n * n * n) / float(3240)
-        - (float(3) * h * n * n * n * n * n * n * n * n) / float(320)
-        + (float(69) * h * n * n * n * n * n * n * n) / float(560)
-        - (float(221) * h * n * n * n * n * n * n) / float(240)
-        + (float(693) * h * n * n * n * n * n) / float(160)
-        - (float(2141) * h * n * n * n * n) / float(160)
-        + (float(2183) * h * n * n * n) / float(80)
-        - (float(2843) * h * n * n) / float(80) + (float(60213) * h * n) / float(2240)
-        + float(2) * T * n - (float(141341) * h) / float(20160) - float(9) * T - float(1);
-    if (n < float(5))
-      return -(h * n * n * n * n * n * n * n * n * n) / float(2592)
-        + (h * n * n * n * n * n * n * n * n) / float(64)
-        - (float(31) * h * n * n * n * n * n * n * n) / float(112)
-        + (float(45) * h * n * n * n * n * n * n) / float(16)
-        - (float(2891) * h * n * n * n * n * n) / float(160)
-        + (float(2439) * h * n * n * n * n) / float(32)
-        - (float(10159) * h * n * n * n) / float(48)
-        + (float(5985) * h * n * n) / float(16) - (float(857291) * h * n) / float(2240)
-        + float(2) * T * n + (float(78415) * h) / float(448) - float(9) * T - float(1);
-    if (n < float(6))
-      return (h * n * n * n * n * n * n * n * n * n) / float(3240)
-        - (h * n * n * n * n * n * n * n * n) / float(64)
-        + (float(39) * h * n * n * n * n * n * n * n) / float(112)
-        - (float(215) * h * n * n * n * n * n * n) / float(48)
-        + (float(5859) * h * n * n * n * n * n) / float(160)
-        - (float(6311) * h * n * n * n * n) / float(32)
-        + (float(11197) * h * n * n * n) / float(16)
-        - (float(25265) * h * n * n) / float(16) + (float(4611459) * h * n) / float(2240)
-        + float(2) * T * n - (float(4763015) * h) / float(4032) - float(9) * T - float(1);
-    if (n < float(7))
-      return -(h * n * n * n * n * n * n * n * n * n) / float(6480)
-        + (float(3) * h * n * n * n * n * n * n * n * n) / float(320)
-        - (float(141) * h * n * n * n * n * n * n * n) / float(560)
-        + (float(941) * h * n * n * n * n * n * n) / float(240)
-        - (float(6237) * h * n * n * n * n * n) / float(160)
-        + (float(41021) * h * n * n * n * n) / float(160)
-        - (float(89167) * h * n * n * n) / float(80)
-        + (float(246923) * h * n * n) / float(80)
-        - (float(11064957) * h * n) / float(2240) + float(2) * T * n
-        + (float(70243421) * h) / float(20160) - float(9) * T - float(1);
-    if (n < float(8))
-      return (h * n * n * n * n * n * n * n * n * n) / float(22680)
-        - (h * n * n * n * n * n * n * n * n) / float(320)
-        + (float(11) * h * n * n * n * n * n * n * n) / float(112)
-        - (float(431) * h * n * n * n * n * n * n) / float(240)
-        + (float(3367) * h * n * n * n * n * n) / float(160)
-        - (float(26207) * h * n * n * n * n) / float(160)
-        + (float(40619) * h * n * n * n) / float(48)
-        - (float(223673) * h * n * n) / float(80)
-        + (float(11994247) * h * n) / float(2240) + float(2) * T * n
-        - (float(91171007) * h) / float(20160) - float(9) * T - float(1);
-    if (n < float(9))
-      return -(h * n * n * n * n * n * n * n * n * n) / float(181440)
-        + (h * n * n * n * n * n * n * n * n) / float(2240)
-        - (float(9) * h * n * n * n * n * n * n * n) / float(560)
-        + (float(27) * h * n * n * n * n * n * n) / float(80)
-        - (float(729) * h * n * n * n * n * n) / float(160)
-        + (float(6561) * h * n * n * n * n) / float(160)
-        - (float(19683) * h * n * n * n) / float(80)
-        + (float(531441) * h * n * n) / float(560)
-        - (float(4782969) * h * n) / float(2240) + float(2) * T * n
-        + (float(4782969) * h) / float(2240) - float(9) * T - float(1);
-    return 0.0; // Just in case.
-  }
+    syncPhase += syncTick + modSync;
+    Vec16fb isSync = (syncPhase >= 1.0f) | (syncPhase < 0.0f);
+    syncPhase = select(isSync, syncPhase - floor(syncPhase), syncPhase);
 
-  float ptrSaw10(float phi, float T, float h = 1.0)
-  {
-    float n = phi / T;
-    if (n >= float(9)) return float(2) * T * n - float(10) * T - float(1);
-    if (n < float(1))
-      return -(h * n * n * n * n * n * n * n * n * n * n) / float(1814400)
-        + float(2) * T * n + float(2) * h - float(10) * T - float(1);
-    if (n < float(2))
-      return (h * n * n * n * n * n * n * n * n * n * n) / float(201600)
-        - (h * n * n * n * n * n * n * n * n * n) / float(18144)
-        + (h * n * n * n * n * n * n * n * n) / float(4032)
-        - (h * n * n * n * n * n * n * n) / float(1512)
-        + (h * n * n * n * n * n * n) / float(864) - (h * n * n * n * n * n) / float(720)
-        + (h * n * n * n * n) / float(864) - (h * n * n * n) / float(1512)
-        + (h * n * n) / float(4032) - (h * n) / float(18144) + float(2) * T * n
-        + (float(362881) * h) / float(181440) - float(10) * T - float(1);
-    if (n < float(3))
-      return -(h * n * n * n * n * n * n * n * n * n * n) / float(50400)
-        + (h * n * n * n * n * n * n * n * n * n) / float(2268)
-        - (float(17) * h * n * n * n * n * n * n * n * n) / float(4032)
-        + (float(5) * h * n * n * n * n * n * n * n) / float(216)
-        - (float(71) * h * n * n * n * n * n * n) / float(864)
-        + (float(143) * h * n * n * n * n * n) / float(720)
-        - (float(287) * h * n * n * n * n) / float(864)
-        + (float(575) * h * n * n * n) / float(1512)
-        - (float(1151) * h * n * n) / float(4032) + (float(329) * h * n) / float(2592)
-        + float(2) * T * n + (float(358273) * h) / float(181440) - float(10) * T
-        - float(1);
-    if (n < float(4))
-      return (h * n * n * n * n * n * n * n * n * n * n) / float(21600)
-        - (h * n * n * n * n * n * n * n * n * n) / float(648)
-        + (float(13) * h * n * n * n * n * n * n * n * n) / float(576)
-        - (float(289) * h * n * n * n * n * n * n * n) / float(1512)
-        + (float(901) * h * n * n * n * n * n * n) / float(864)
-        - (float(2773) * h * n * n * n * n * n) / float(720)
-        + (float(8461) * h * n * n * n * n) / float(864)
-        - (float(3667) * h * n * n * n) / float(216)
-        + (float(11083) * h * n * n) / float(576) - (float(233893) * h * n) / float(18144)
-        + float(2) * T * n + (float(1066861) * h) / float(181440) - float(10) * T
-        - float(1);
-    if (n < float(5))
-      return -(h * n * n * n * n * n * n * n * n * n * n) / float(14400)
-        + (h * n * n * n * n * n * n * n * n * n) / float(324)
-        - (float(35) * h * n * n * n * n * n * n * n * n) / float(576)
-        + (float(1055) * h * n * n * n * n * n * n * n) / float(1512)
-        - (float(4475) * h * n * n * n * n * n * n) / float(864)
-        + (float(18731) * h * n * n * n * n * n) / float(720)
-        - (float(77555) * h * n * n * n * n) / float(864)
-        + (float(45485) * h * n * n * n) / float(216)
-        - (float(185525) * h * n * n) / float(576)
-        + (float(5271131) * h * n) / float(18144) + float(2) * T * n
-        - (float(4190647) * h) / float(36288) - float(10) * T - float(1);
-    if (n < float(6))
-      return (h * n * n * n * n * n * n * n * n * n * n) / float(14400)
-        - (float(5) * h * n * n * n * n * n * n * n * n * n) / float(1296)
-        + (float(55) * h * n * n * n * n * n * n * n * n) / float(576)
-        - (float(2095) * h * n * n * n * n * n * n * n) / float(1512)
-        + (float(11275) * h * n * n * n * n * n * n) / float(864)
-        - (float(60019) * h * n * n * n * n * n) / float(720)
-        + (float(316195) * h * n * n * n * n) / float(864)
-        - (float(235765) * h * n * n * n) / float(216)
-        + (float(1220725) * h * n * n) / float(576)
-        - (float(43947619) * h * n) / float(18144) + float(2) * T * n
-        + (float(45028103) * h) / float(36288) - float(10) * T - float(1);
-    if (n < float(7))
-      return -(h * n * n * n * n * n * n * n * n * n * n) / float(21600)
-        + (h * n * n * n * n * n * n * n * n * n) / float(324)
-        - (float(53) * h * n * n * n * n * n * n * n * n) / float(576)
-        + (float(2441) * h * n * n * n * n * n * n * n) / float(1512)
-        - (float(15941) * h * n * n * n * n * n * n) / float(864)
-        + (float(103277) * h * n * n * n * n * n) / float(720)
-        - (float(663581) * h * n * n * n * n) / float(864)
-        + (float(604043) * h * n * n * n) / float(216)
-        - (float(3818123) * h * n * n) / float(576)
-        + (float(167683997) * h * n) / float(18144) + float(2) * T * n
-        - (float(1044649181) * h) / float(181440) - float(10) * T - float(1);
-    if (n < float(8))
-      return (h * n * n * n * n * n * n * n * n * n * n) / float(50400)
-        - (h * n * n * n * n * n * n * n * n * n) / float(648)
-        + (float(31) * h * n * n * n * n * n * n * n * n) / float(576)
-        - (float(1675) * h * n * n * n * n * n * n * n) / float(1512)
-        + (float(12871) * h * n * n * n * n * n * n) / float(864)
-        - (float(98407) * h * n * n * n * n * n) / float(720)
-        + (float(748207) * h * n * n * n * n) / float(864)
-        - (float(807745) * h * n * n * n) / float(216)
-        + (float(6064393) * h * n * n) / float(576)
-        - (float(316559287) * h * n) / float(18144) + float(2) * T * n
-        + (float(2345053807) * h) / float(181440) - float(10) * T - float(1);
-    if (n < float(9))
-      return -(h * n * n * n * n * n * n * n * n * n * n) / float(201600)
-        + (h * n * n * n * n * n * n * n * n * n) / float(2268)
-        - (float(71) * h * n * n * n * n * n * n * n * n) / float(4032)
-        + (float(629) * h * n * n * n * n * n * n * n) / float(1512)
-        - (float(5561) * h * n * n * n * n * n * n) / float(864)
-        + (float(49049) * h * n * n * n * n * n) / float(720)
-        - (float(431441) * h * n * n * n * n) / float(864)
-        + (float(3782969) * h * n * n * n) / float(1512)
-        - (float(33046721) * h * n * n) / float(4032)
-        + (float(287420489) * h * n) / float(18144) + float(2) * T * n
-        - (float(2486784401) * h) / float(181440) - float(10) * T - float(1);
-    if (n < float(10))
-      return (h * n * n * n * n * n * n * n * n * n * n) / float(1814400)
-        - (h * n * n * n * n * n * n * n * n * n) / float(18144)
-        + (float(5) * h * n * n * n * n * n * n * n * n) / float(2016)
-        - (float(25) * h * n * n * n * n * n * n * n) / float(378)
-        + (float(125) * h * n * n * n * n * n * n) / float(108)
-        - (float(125) * h * n * n * n * n * n) / float(9)
-        + (float(3125) * h * n * n * n * n) / float(27)
-        - (float(125000) * h * n * n * n) / float(189)
-        + (float(156250) * h * n * n) / float(63) - (float(3125000) * h * n) / float(567)
-        + float(2) * T * n + (float(3125000) * h) / float(567) - float(10) * T - float(1);
-    return 0.0; // Just in case.
-  }
+    // When syncTick is 0, lastSig is used as height and output is clamped.
+    Vec16fb isFree = syncTick == 0.0f;
+    Vec16f ratio = oscTick / syncTick;
+    Vec16f syncHeight = select(isFree, lastSig, ratio - floor(ratio));
 
-  double ptrSaw6Double(double phi, double T, double h = 1.0)
-  {
-    double n = phi / T;
-    if (n >= double(5)) return double(2) * T * n - double(6) * T - double(1);
-    if (n < double(1))
-      return -(h * n * n * n * n * n * n) / double(360) + double(2) * T * n
-        + double(2) * h - double(6) * T - double(1);
-    if (n < double(2))
-      return (h * n * n * n * n * n * n) / double(72)
-        - (h * n * n * n * n * n) / double(10) + (h * n * n * n * n) / double(4)
-        - (h * n * n * n) / double(3) + (h * n * n) / double(4) - (h * n) / double(10)
-        + double(2) * T * n + (double(121) * h) / double(60) - double(6) * T - double(1);
-    if (n < double(3))
-      return -(h * n * n * n * n * n * n) / double(36)
-        + (double(2) * h * n * n * n * n * n) / double(5)
-        - (double(9) * h * n * n * n * n) / double(4)
-        + (double(19) * h * n * n * n) / double(3) - (double(39) * h * n * n) / double(4)
-        + (double(79) * h * n) / double(10) + double(2) * T * n
-        - (double(13) * h) / double(20) - double(6) * T - double(1);
-    if (n < double(4))
-      return (h * n * n * n * n * n * n) / double(36)
-        - (double(3) * h * n * n * n * n * n) / double(5)
-        + (double(21) * h * n * n * n * n) / double(4)
-        - (double(71) * h * n * n * n) / double(3) + (double(231) * h * n * n) / double(4)
-        - (double(731) * h * n) / double(10) + double(2) * T * n
-        + (double(797) * h) / double(20) - double(6) * T - double(1);
-    if (n < double(5))
-      return -(h * n * n * n * n * n * n) / double(72)
-        + (double(2) * h * n * n * n * n * n) / double(5)
-        - (double(19) * h * n * n * n * n) / double(4)
-        + (double(89) * h * n * n * n) / double(3) - (double(409) * h * n * n) / double(4)
-        + (double(1829) * h * n) / double(10) + double(2) * T * n
-        - (double(7849) * h) / double(60) - double(6) * T - double(1);
-    if (n < double(6))
-      return (h * n * n * n * n * n * n) / double(360)
-        - (h * n * n * n * n * n) / double(10)
-        + (double(3) * h * n * n * n * n) / double(2) - double(12) * h * n * n * n
-        + double(54) * h * n * n - (double(648) * h * n) / double(5) + double(2) * T * n
-        + (double(648) * h) / double(5) - double(6) * T - double(1);
-    return 0.0; // Just in case.
-  }
+    Vec16f phase = oscPhase + oscTick + modOsc;
+    Vec16fb isWrap = (phase >= 1.0f) | (phase < 0.0f);
+    phase = select(isWrap, phase - floor(phase), phase);
 
-  double ptrSaw7Double(double phi, double T, double h = 1.0)
-  {
-    double n = phi / T;
-    if (n >= double(6)) return double(2) * T * n - double(7) * T - double(1);
-    if (n < double(1))
-      return -(h * n * n * n * n * n * n * n) / double(2520) + double(2) * T * n
-        + double(2) * h - double(7) * T - double(1);
-    if (n < double(2))
-      return (h * n * n * n * n * n * n * n) / double(420)
-        - (double(7) * h * n * n * n * n * n * n) / double(360)
-        + (double(7) * h * n * n * n * n * n) / double(120)
-        - (double(7) * h * n * n * n * n) / double(72)
-        + (double(7) * h * n * n * n) / double(72) - (double(7) * h * n * n) / double(120)
-        + (double(7) * h * n) / double(360) + double(2) * T * n
-        + (double(719) * h) / double(360) - double(7) * T - double(1);
-    if (n < double(3))
-      return -(h * n * n * n * n * n * n * n) / double(168)
-        + (double(7) * h * n * n * n * n * n * n) / double(72)
-        - (double(77) * h * n * n * n * n * n) / double(120)
-        + (double(161) * h * n * n * n * n) / double(72)
-        - (double(329) * h * n * n * n) / double(72)
-        + (double(133) * h * n * n) / double(24) - (double(1337) * h * n) / double(360)
-        + double(2) * T * n + (double(1103) * h) / double(360) - double(7) * T
-        - double(1);
-    if (n < double(4))
-      return (h * n * n * n * n * n * n * n) / double(126)
-        - (double(7) * h * n * n * n * n * n * n) / double(36)
-        + (double(119) * h * n * n * n * n * n) / double(60)
-        - (double(98) * h * n * n * n * n) / double(9)
-        + (double(1253) * h * n * n * n) / double(36)
-        - (double(196) * h * n * n) / double(3) + (double(12089) * h * n) / double(180)
-        + double(2) * T * n - (double(1229) * h) / double(45) - double(7) * T - double(1);
-    if (n < double(5))
-      return -(h * n * n * n * n * n * n * n) / double(168)
-        + (double(7) * h * n * n * n * n * n * n) / double(36)
-        - (double(161) * h * n * n * n * n * n) / double(60)
-        + (double(182) * h * n * n * n * n) / double(9)
-        - (double(3227) * h * n * n * n) / double(36)
-        + (double(700) * h * n * n) / double(3) - (double(59591) * h * n) / double(180)
-        + double(2) * T * n + (double(9011) * h) / double(45) - double(7) * T - double(1);
-    if (n < double(6))
-      return (h * n * n * n * n * n * n * n) / double(420)
-        - (double(7) * h * n * n * n * n * n * n) / double(72)
-        + (double(203) * h * n * n * n * n * n) / double(120)
-        - (double(1169) * h * n * n * n * n) / double(72)
-        + (double(6671) * h * n * n * n) / double(72)
-        - (double(7525) * h * n * n) / double(24) + (double(208943) * h * n) / double(360)
-        + double(2) * T * n - (double(162287) * h) / double(360) - double(7) * T
-        - double(1);
-    if (n < double(7))
-      return -(h * n * n * n * n * n * n * n) / double(2520)
-        + (double(7) * h * n * n * n * n * n * n) / double(360)
-        - (double(49) * h * n * n * n * n * n) / double(120)
-        + (double(343) * h * n * n * n * n) / double(72)
-        - (double(2401) * h * n * n * n) / double(72)
-        + (double(16807) * h * n * n) / double(120)
-        - (double(117649) * h * n) / double(360) + double(2) * T * n
-        + (double(117649) * h) / double(360) - double(7) * T - double(1);
-    return 0.0; // Just in case.
-  }
+    oscPhase = select(isSync, syncPhase, phase);
+    height = select(isSync, syncHeight, select(isWrap, 1.0f, height));
 
-  double ptrSaw8Double(double phi, double T, double h = 1.0)
-  {
-    double n = phi / T;
-    if (n >= double(7)) return double(2) * T * n - double(8) * T - double(1);
-    if (n < double(1))
-      return -(h * n * n * n * n * n * n * n * n) / double(20160) + double(2) * T * n
-        + double(2) * h - double(8) * T - double(1);
-    if (n < double(2))
-      return (h * n * n * n * n * n * n * n * n) / double(2880)
-        - (h * n * n * n * n * n * n * n) / double(315)
-        + (h * n * n * n * n * n * n) / double(90) - (h * n * n * n * n * n) / double(45)
-        + (h * n * n * n * n) / double(36) - (h * n * n * n) / double(45)
-        + (h * n * n) / double(90) - (h * n) / double(315) + double(2) * T * n
-        + (double(5041) * h) / double(2520) - double(8) * T - double(1);
-    if (n < double(3))
-      return -(h * n * n * n * n * n * n * n * n) / double(960)
-        + (double(2) * h * n * n * n * n * n * n * n) / double(105)
-        - (double(13) * h * n * n * n * n * n * n) / double(90)
-        + (double(3) * h * n * n * n * n * n) / double(5)
-        - (double(55) * h * n * n * n * n) / double(36)
-        + (double(37) * h * n * n * n) / double(15)
-        - (double(223) * h * n * n) / double(90) + (double(149) * h * n) / double(105)
-        + double(2) * T * n + (double(829) * h) / double(504) - double(8) * T - double(1);
-    if (n < double(4))
-      return (h * n * n * n * n * n * n * n * n) / double(576)
-        - (h * n * n * n * n * n * n * n) / double(21)
-        + (double(5) * h * n * n * n * n * n * n) / double(9)
-        - (double(18) * h * n * n * n * n * n) / double(5)
-        + (double(128) * h * n * n * n * n) / double(9)
-        - (double(106) * h * n * n * n) / double(3)
-        + (double(488) * h * n * n) / double(9) - (double(4954) * h * n) / double(105)
-        + double(2) * T * n + (double(6259) * h) / double(315) - double(8) * T
-        - double(1);
-    if (n < double(5))
-      return -(h * n * n * n * n * n * n * n * n) / double(576)
-        + (double(4) * h * n * n * n * n * n * n * n) / double(63)
-        - h * n * n * n * n * n * n + (double(398) * h * n * n * n * n * n) / double(45)
-        - double(48) * h * n * n * n * n + (double(1474) * h * n * n * n) / double(9)
-        - double(344) * h * n * n + (double(128498) * h * n) / double(315)
-        + double(2) * T * n - (double(7269) * h) / double(35) - double(8) * T - double(1);
-    if (n < double(6))
-      return (h * n * n * n * n * n * n * n * n) / double(960)
-        - (h * n * n * n * n * n * n * n) / double(21)
-        + (double(17) * h * n * n * n * n * n * n) / double(18)
-        - (double(53) * h * n * n * n * n * n) / double(5)
-        + (double(2647) * h * n * n * n * n) / double(36)
-        - (double(967) * h * n * n * n) / double(3)
-        + (double(15683) * h * n * n) / double(18)
-        - (double(139459) * h * n) / double(105) + double(2) * T * n
-        + (double(2211007) * h) / double(2520) - double(8) * T - double(1);
-    if (n < double(7))
-      return -(h * n * n * n * n * n * n * n * n) / double(2880)
-        + (double(2) * h * n * n * n * n * n * n * n) / double(105)
-        - (double(41) * h * n * n * n * n * n * n) / double(90)
-        + (double(31) * h * n * n * n * n * n) / double(5)
-        - (double(1889) * h * n * n * n * n) / double(36)
-        + (double(4237) * h * n * n * n) / double(15)
-        - (double(84881) * h * n * n) / double(90)
-        + (double(187133) * h * n) / double(105) + double(2) * T * n
-        - (double(3667649) * h) / double(2520) - double(8) * T - double(1);
-    if (n < double(8))
-      return (h * n * n * n * n * n * n * n * n) / double(20160)
-        - (h * n * n * n * n * n * n * n) / double(315)
-        + (double(4) * h * n * n * n * n * n * n) / double(45)
-        - (double(64) * h * n * n * n * n * n) / double(45)
-        + (double(128) * h * n * n * n * n) / double(9)
-        - (double(4096) * h * n * n * n) / double(45)
-        + (double(16384) * h * n * n) / double(45)
-        - (double(262144) * h * n) / double(315) + double(2) * T * n
-        + (double(262144) * h) / double(315) - double(8) * T - double(1);
-    return 0.0; // Just in case.
+    Vec16f sig = (this->*ptrFunc)();
+    lastSig = select(
+      isSync & isFree, min(max(sig, -1.0f), 1.0f), select(is_finite(sig), sig, 0.0f));
+    return lastSig;
   }
 
-  double ptrSaw9Double(double phi, double T, double h = 1.0)
-  {
-    double n = phi / T;
-    if (n >= double(8)) return double(2) * T * n - double(9) * T - double(1);
-    if (n < double(1))
-      return -(h * n * n * n * n * n * n * n * n * n) / double(181440) + double(2) * T * n
-        + double(2) * h - double(9) * T - double(1);
-    if (n < double(2))
-      return (h * n * n * n * n * n * n * n * n * n) / double(22680)
-        - (h * n * n * n * n * n * n * n * n) / double(2240)
-        + (h * n * n * n * n * n * n * n) / double(560)
-        - (h * n * n * n * n * n * n) / double(240)
-        + (h * n * n * n * n * n) / double(160) - (h * n * n * n * n) / double(160)
-        + (h * n * n * n) / double(240) - (h * n * n) / double(560)
-        + (h * n) / double(2240) + double(2) * T * n + (double(40319) * h) / double(20160)
-        - double(9) * T - double(1);
-    if (n < double(3))
-      return -(h * n * n * n * n * n * n * n * n * n) / double(6480)
-        + (h * n * n * n * n * n * n * n * n) / double(320)
-        - (double(3) * h * n * n * n * n * n * n * n) / double(112)
-        + (double(31) * h * n * n * n * n * n * n) / double(240)
-        - (double(63) * h * n * n * n * n * n) / double(160)
-        + (double(127) * h * n * n * n * n) / double(160)
-        - (double(17) * h * n * n * n) / double(16)
-        + (double(73) * h * n * n) / double(80) - (double(1023) * h * n) / double(2240)
-        + double(2) * T * n + (double(42367) * h) / double(20160) - double(9) * T
-        - double(1);
-    if (n < double(4))
-      return (h * n * n * n * n * n * n * n * n * n) / double(3240)
-        - (double(3) * h * n * n * n * n * n * n * n * n) / double(320)
-        + (double(69) * h * n * n * n * n * n * n * n) / double(560)
-        - (double(221) * h * n * n * n * n * n * n) / double(240)
-        + (double(693) * h * n * n * n * n * n) / double(160)
-        - (double(2141) * h * n * n * n * n) / double(160)
-        + (double(2183) * h * n * n * n) / double(80)
-        - (double(2843) * h * n * n) / double(80) + (double(60213) * h * n) / double(2240)
-        + double(2) * T * n - (double(141341) * h) / double(20160) - double(9) * T
-        - double(1);
-    if (n < double(5))
-      return -(h * n * n * n * n * n * n * n * n * n) / double(2592)
-        + (h * n * n * n * n * n * n * n * n) / double(64)
-        - (double(31) * h * n * n * n * n * n * n * n) / double(112)
-        + (double(45) * h * n * n * n * n * n * n) / double(16)
-        - (double(2891) * h * n * n * n * n * n) / double(160)
-        + (double(2439) * h * n * n * n * n) / double(32)
-        - (double(10159) * h * n * n * n) / double(48)
-        + (double(5985) * h * n * n) / double(16)
-        - (double(857291) * h * n) / double(2240) + double(2) * T * n
-        + (double(78415) * h) / double(448) - double(9) * T - double(1);
-    if (n < double(6))
-      return (h * n * n * n * n * n * n * n * n * n) / double(3240)
-        - (h * n * n * n * n * n * n * n * n) / double(64)
-        + (double(39) * h * n * n * n * n * n * n * n) / double(112)
-        - (double(215) * h * n * n * n * n * n * n) / double(48)
-        + (double(5859) * h * n * n * n * n * n) / double(160)
-        - (double(6311) * h * n * n * n * n) / double(32)
-        + (double(11197) * h * n * n * n) / double(16)
-        - (double(25265) * h * n * n) / double(16)
-        + (double(4611459) * h * n) / double(2240) + double(2) * T * n
-        - (double(4763015) * h) / double(4032) - double(9) * T - double(1);
-    if (n < double(7))
-      return -(h * n * n * n * n * n * n * n * n * n) / double(6480)
-        + (double(3) * h * n * n * n * n * n * n * n * n) / double(320)
-        - (double(141) * h * n * n * n * n * n * n * n) / double(560)
-        + (double(941) * h * n * n * n * n * n * n) / double(240)
-        - (double(6237) * h * n * n * n * n * n) / double(160)
-        + (double(41021) * h * n * n * n * n) / double(160)
-        - (double(89167) * h * n * n * n) / double(80)
-        + (double(246923) * h * n * n) / double(80)
-        - (double(11064957) * h * n) / double(2240) + double(2) * T * n
-        + (double(70243421) * h) / double(20160) - double(9) * T - double(1);
-    if (n < double(8))
-      return (h * n * n * n * n * n * n * n * n * n) / double(22680)
-        - (h * n * n * n * n * n * n * n * n) / double(320)
-        + (double(11) * h * n * n * n * n * n * n * n) / double(112)
-        - (double(431) * h * n * n * n * n * n * n) / double(240)
-        + (double(3367) * h * n * n * n * n * n) / double(160)
-        - (double(26207) * h * n * n * n * n) / double(160)
-        + (double(40619) * h * n * n * n) / double(48)
-        - (double(223673) * h * n * n) / double(80)
-        + (double(11994247) * h * n) / double(2240) + double(2) * T * n
-        - (double(91171007) * h) / double(20160) - double(9) * T - double(1);
-    if (n < double(9))
-      return -(h * n * n * n * n * n * n * n * n * n) / double(181440)
-        + (h * n * n * n * n * n * n * n * n) / double(2240)
-        - (double(9) * h * n * n * n * n * n * n * n) / double(560)
-        + (double(27) * h * n * n * n * n * n * n) / double(80)
-        - (double(729) * h * n * n * n * n * n) / double(160)
-        + (double(6561) * h * n * n * n * n) / double(160)
-        - (double(19683) * h * n * n * n) / double(80)
-        + (double(531441) * h * n * n) / double(560)
-        - (double(4782969) * h * n) / double(2240) + double(2) * T * n
-        + (double(4782969) * h) / double(2240) - double(9) * T - double(1);
-    return 0.0; // Just in case.
-  }
+protected:
+  using PtrFunc = Vec16f (PTRSyncSaw16::*)();
+
+  float sampleRate = 44100.0f;
+  Vec16f oscPhase = 0.0f; // Range in [0, 1)
+  Vec16f oscTick = 0.0f;  // sec/sample
+  Vec16f height = 1.0f;   // Range in [0, 1]. Sample value at phase reset of hardsync.
+  Vec16f syncPhase = 0.0f;
+  Vec16f syncTick = 0.0f;
+  Vec16f lastSig = 0.0f;
+  PtrFunc ptrFunc = &PTRSyncSaw16::ptrSawN<7, ptrSawPoly7>;
 
-  double ptrSaw10Double(double phi, double T, double h = 1.0)
+  Vec16f ptrSaw0() { return 2.0f * oscTick * oscPhase / oscTick - 1.0f; }
+  Vec16f ptrSaw1() { return 2.0f * oscPhase - oscTick - 1.0f; }
+  Vec16f ptrSine() { return -sin(oscPhase * float(twopi)); }
+
+  template<int32_t degree, const float (&polynomial)[degree + 1][16]> Vec16f ptrSawN()
   {
-    double n = phi / T;
-    if (n >= double(9)) return double(2) * T * n - double(10) * T - double(1);
-    if (n < double(1))
-      return -(h * n * n * n * n * n * n * n * n * n * n) / double(1814400)
-        + double(2) * T * n + double(2) * h - double(10) * T - double(1);
-    if (n < double(2))
-      return (h * n * n * n * n * n * n * n * n * n * n) / double(201600)
-        - (h * n * n * n * n * n * n * n * n * n) / double(18144)
-        + (h * n * n * n * n * n * n * n * n) / double(4032)
-        - (h * n * n * n * n * n * n * n) / double(1512)
-        + (h * n * n * n * n * n * n) / double(864)
-        - (h * n * n * n * n * n) / double(720) + (h * n * n * n * n) / double(864)
-        - (h * n * n * n) / double(1512) + (h * n * n) / double(4032)
-        - (h * n) / double(18144) + double(2) * T * n
-        + (double(362881) * h) / double(181440) - double(10) * T - double(1);
-    if (n < double(3))
-      return -(h * n * n * n * n * n * n * n * n * n * n) / double(50400)
-        + (h * n * n * n * n * n * n * n * n * n) / double(2268)
-        - (double(17) * h * n * n * n * n * n * n * n * n) / double(4032)
-        + (double(5) * h * n * n * n * n * n * n * n) / double(216)
-        - (double(71) * h * n * n * n * n * n * n) / double(864)
-        + (double(143) * h * n * n * n * n * n) / double(720)
-        - (double(287) * h * n * n * n * n) / double(864)
-        + (double(575) * h * n * n * n) / double(1512)
-        - (double(1151) * h * n * n) / double(4032) + (double(329) * h * n) / double(2592)
-        + double(2) * T * n + (double(358273) * h) / double(181440) - double(10) * T
-        - double(1);
-    if (n < double(4))
-      return (h * n * n * n * n * n * n * n * n * n * n) / double(21600)
-        - (h * n * n * n * n * n * n * n * n * n) / double(648)
-        + (double(13) * h * n * n * n * n * n * n * n * n) / double(576)
-        - (double(289) * h * n * n * n * n * n * n * n) / double(1512)
-        + (double(901) * h * n * n * n * n * n * n) / double(864)
-        - (double(2773) * h * n * n * n * n * n) / double(720)
-        + (double(8461) * h * n * n * n * n) / double(864)
-        - (double(3667) * h * n * n * n) / double(216)
-        + (double(11083) * h * n * n) / double(576)
-        - (double(233893) * h * n) / double(18144) + double(2) * T * n
-        + (double(1066861) * h) / double(181440) - double(10) * T - double(1);
-    if (n < double(5))
-      return -(h * n * n * n * n * n * n * n * n * n * n) / double(14400)
-        + (h * n * n * n * n * n * n * n * n * n) / double(324)
-        - (double(35) * h * n * n * n * n * n * n * n * n) / double(576)
-        + (double(1055) * h * n * n * n * n * n * n * n) / double(1512)
-        - (double(4475) * h * n * n * n * n * n * n) / double(864)
-        + (double(18731) * h * n * n * n * n * n) / double(720)
-        - (double(77555) * h * n * n * n * n) / double(864)
-        + (double(45485) * h * n * n * n) / double(216)
-        - (double(185525) * h * n * n) / double(576)
-        + (double(5271131) * h * n) / double(18144) + double(2) * T * n
-        - (double(4190647) * h) / double(36288) - double(10) * T - double(1);
-    if (n < double(6))
-      return (h * n * n * n * n * n * n * n * n * n * n) / double(14400)
-        - (double(5) * h * n * n * n * n * n * n * n * n * n) / double(1296)
-        + (double(55) * h * n * n * n * n * n * n * n * n) / double(576)
-        - (double(2095) * h * n * n * n * n * n * n * n) / double(1512)
-        + (double(11275) * h * n * n * n * n * n * n) / double(864)
-        - (double(60019) * h * n * n * n * n * n) / double(720)
-        + (double(316195) * h * n * n * n * n) / double(864)
-        - (double(235765) * h * n * n * n) / double(216)
-        + (double(1220725) * h * n * n) / double(576)
-        - (double(43947619) * h * n) / double(18144) + double(2) * T * n
-        + (double(45028103) * h) / double(36288) - double(10) * T - double(1);
-    if (n < double(7))
-      return -(h * n * n * n * n * n * n * n * n * n * n) / double(21600)
-        + (h * n * n * n * n * n * n * n * n * n) / double(324)
-        - (double(53) * h * n * n * n * n * n * n * n * n) / double(576)
-        + (double(2441) * h * n * n * n * n * n * n * n) / double(1512)
-        - (double(15941) * h * n * n * n * n * n * n) / double(864)
-        + (double(103277) * h * n * n * n * n * n) / double(720)
-        - (double(663581) * h * n * n * n * n) / double(864)
-        + (double(604043) * h * n * n * n) / double(216)
-        - (double(3818123) * h * n * n) / double(576)
-        + (double(167683997) * h * n) / double(18144) + double(2) * T * n
-        - (double(1044649181) * h) / double(181440) - double(10) * T - double(1);
-    if (n < double(8))
-      return (h * n * n * n * n * n * n * n * n * n * n) / double(50400)
-        - (h * n * n * n * n * n * n * n * n * n) / double(648)
-        + (double(31) * h * n * n * n * n * n * n * n * n) / double(576)
-        - (double(1675) * h * n * n * n * n * n * n * n) / double(1512)
-        + (double(12871) * h * n * n * n * n * n * n) / double(864)
-        - (double(98407) * h * n * n * n * n * n) / double(720)
-        + (double(748207) * h * n * n * n * n) / double(864)
-        - (double(807745) * h * n * n * n) / double(216)
-        + (double(6064393) * h * n * n) / double(576)
-        - (double(316559287) * h * n) / double(18144) + double(2) * T * n
-        + (double(2345053807) * h) / double(181440) - double(10) * T - double(1);
-    if (n < double(9))
-      return -(h * n * n * n * n * n * n * n * n * n * n) / double(201600)
-        + (h * n * n * n * n * n * n * n * n * n) / double(2268)
-        - (double(71) * h * n * n * n * n * n * n * n * n) / double(4032)
-        + (double(629) * h * n * n * n * n * n * n * n) / double(1512)
-        - (double(5561) * h * n * n * n * n * n * n) / double(864)
-        + (double(49049) * h * n * n * n * n * n) / double(720)
-        - (double(431441) * h * n * n * n * n) / double(864)
-        + (double(3782969) * h * n * n * n) / double(1512)
-        - (double(33046721) * h * n * n) / double(4032)
-        + (double(287420489) * h * n) / double(18144) + double(2) * T * n
-        - (double(2486784401) * h) / double(181440) - double(10) * T - double(1);
-    if (n < double(10))
-      return (h * n * n * n * n * n * n * n * n * n * n) / double(1814400)
-        - (h * n * n * n * n * n * n * n * n * n) / double(18144)
-        + (double(5) * h * n * n * n * n * n * n * n * n) / double(2016)
-        - (double(25) * h * n * n * n * n * n * n * n) / double(378)
-        + (double(125) * h * n * n * n * n * n * n) / double(108)
-        - (double(125) * h * n * n * n * n * n) / double(9)
-        + (double(3125) * h * n * n * n * n) / double(27)
-        - (double(125000) * h * n * n * n) / double(189)
-        + (double(156250) * h * n * n) / double(63)
-        - (double(3125000) * h * n) / double(567) + double(2) * T * n
-        + (double(3125000) * h) / double(567) - double(10) * T - double(1);
-    return 0.0; // Just in case.
+    Vec16f n = oscPhase / oscTick;
+    Vec16i k = min(max(truncatei(n), Vec16i(0)), Vec16i(degree - 1));
+    Vec16f x = n - to_float(k);
+
+    Vec16f poly = lookup<16>(k, polynomial[degree]);
+    for (int32_t j = degree - 1; j >= 0; --j)
+      poly = mul_add(poly, x, lookup<16>(k, polynomial[j]));
+
+    return height * poly + 2.0f * oscTick * n - float(degree) * oscTick - 1.0f;
   }
 };
 
@@ -60,6 +60,8 @@ LogScale<double> Scales::lfoFrequencyMultiplier(0.0, 16.0, 0.5, 1.0);
 
 IntScale<double> Scales::nVoice(5);
 
+IntScale<double> Scales::modulationInterval(5);
+
 // Generated from preset dump. This works, but hard coding preset data is seriously bad.
 void GlobalParameter::loadProgram(uint32_t index)
 {
@@ -102,6 +102,8 @@ enum ID {
   pitchBend,
   nVoice,
 
+  modulationInterval,
+
   ID_ENUM_LENGTH,
 };
 } // namespace ParameterID
@@ -146,15 +148,15 @@ struct Scales {
   static SomeDSP::LogScale<double> lfoFrequencyMultiplier; // internal
 
   static SomeDSP::IntScale<double> nVoice;
+
+  static SomeDSP::IntScale<double> modulationInterval;
 };
 
 struct GlobalParameter : public ParameterInterface {
-  std::vector<std::unique_ptr<ValueInterface>> value;
+  ValueArray<ParameterID::ID_ENUM_LENGTH> value;
 
   GlobalParameter()
   {
-    value.resize(ParameterID::ID_ENUM_LENGTH);
-
     using ID = ParameterID::ID;
     using LinearValue = FloatValue<SomeDSP::LinearScale<double>>;
     using LogValue = FloatValue<SomeDSP::LogScale<double>>;
@@ -299,6 +301,10 @@ struct GlobalParameter : public ParameterInterface {
     value[ID::nVoice] = std::make_unique<IntValue>(
       5.0 / Scales::nVoice.getMax(), Scales::nVoice, "nVoice",
       kParameterIsAutomable | kParameterIsInteger);
+
+    value[ID::modulationInterval] = std::make_unique<IntValue>(
+      0, Scales::modulationInterval, "modulationInterval",
+      kParameterIsAutomable | kParameterIsInteger);
   }
 
 #ifndef TEST_BUILD
@@ -311,10 +317,7 @@ struct GlobalParameter : public ParameterInterface {
 
   size_t idLength() override { return value.size(); }
 
-  void resetParameter()
-  {
-    for (auto &val : value) val->setFromNormalized(val->getDefaultNormalized());
-  }
+  void resetParameter() { value.reset(); }
 
   double getNormalized(uint32_t index) const override
   {
@@ -416,10 +419,12 @@ struct GlobalParameter : public ParameterInterface {
     "ThisIsntAModem",
   };
 
+#ifndef TEST_BUILD
   void initProgramName(uint32_t index, String &programName)
   {
     programName = this->programName[index];
   }
+#endif
 
   void loadProgram(uint32_t index);
 };
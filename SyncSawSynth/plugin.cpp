@@ -20,9 +20,13 @@
 // You should have received a copy of the GNU General Public License
 // along with SyncSawSynth.  If not, see <https://www.gnu.org/licenses/>.
 
+#include <iostream>
+
+#include <memory>
 #include <utility>
 
 #include "DistrhoPlugin.hpp"
+#include "../common/dspload.hpp"
 #include "dsp/dspcore.hpp"
 
 START_NAMESPACE_DISTRHO
@@ -31,11 +35,27 @@ class SyncSawSynth : public Plugin {
 public:
   // Plugin(nParameters, nPrograms, nStates).
   SyncSawSynth()
-    : Plugin(ParameterID::ID_ENUM_LENGTH, GlobalParameter::Preset::Preset_ENUM_LENGTH, 0)
+    : Plugin(
+      ParameterID::ID_ENUM_LENGTH + DSPLoadMeter::nParameter,
+      GlobalParameter::Preset::Preset_ENUM_LENGTH, 0)
   {
+    auto iset = instrset_detect();
+    if (iset >= 10) {
+      dsp = std::make_unique<DSPCore_AVX512>();
+    } else if (iset >= 8) {
+      dsp = std::make_unique<DSPCore_AVX2>();
+    } else if (iset >= 5) {
+      dsp = std::make_unique<DSPCore_SSE41>();
+    } else if (iset >= 2) {
+      dsp = std::make_unique<DSPCore_SSE2>();
+    } else {
+      std::cerr << "\nError: Instruction set SSE2 not supported on this computer";
+      exit(EXIT_FAILURE);
+    }
+
     sampleRateChanged(getSampleRate());
-    lastNoteId.reserve(dsp.maxVoice + 1);
-    alreadyRecievedNote.reserve(dsp.maxVoice);
+    lastNoteId.reserve(dsp->maxVoice + 1);
+    alreadyRecievedNote.reserve(dsp->maxVoice);
   }
 
 protected:
@@ -59,7 +79,12 @@ protected:
 
   void initParameter(uint32_t index, Parameter &parameter) override
   {
-    dsp.param.initParameter(index, parameter);
+    if (index >= ParameterID::ID_ENUM_LENGTH) {
+      DSPLoadMeter::initParameter(index - ParameterID::ID_ENUM_LENGTH, parameter);
+      return;
+    }
+
+    dsp->param.initParameter(index, parameter);
 
     switch (index) {
       case ParameterID::bypass:
@@ -72,24 +97,30 @@ protected:
 
   float getParameterValue(uint32_t index) const override
   {
-    return dsp.param.getFloat(index);
+    if (index >= ParameterID::ID_ENUM_LENGTH)
+      return loadMeter.getParameter(index - ParameterID::ID_ENUM_LENGTH);
+    return dsp->param.getFloat(index);
   }
 
   void setParameterValue(uint32_t index, float value) override
   {
-    dsp.param.setParameterValue(index, value);
+    dsp->param.setParameterValue(index, value);
   }
 
   void initProgramName(uint32_t index, String &programName) override
   {
-    dsp.param.initProgramName(index, programName);
+    dsp->param.initProgramName(index, programName);
   }
 
-  void loadProgram(uint32_t index) override { dsp.param.loadProgram(index); }
+  void loadProgram(uint32_t index) override { dsp->param.loadProgram(index); }
 
-  void sampleRateChanged(double newSampleRate) { dsp.setup(newSampleRate); }
-  void activate() { dsp.startup(); }
-  void deactivate() { dsp.reset(); }
+  void sampleRateChanged(double newSampleRate)
+  {
+    loadMeter.setup(newSampleRate);
+    dsp->setup(newSampleRate);
+  }
+  void activate() { dsp->startup(); }
+  void deactivate() { dsp->reset(); }
 
   void handleMidi(const MidiEvent ev)
   {
@@ -103,7 +134,7 @@ protected:
           lastNoteId.begin(), lastNoteId.end(),
           [&](const std::pair<uint8_t, uint32_t> &p) { return p.first == ev.data[1]; });
         if (it == std::end(lastNoteId)) break;
-        dsp.pushMidiNote(false, ev.frame, it->second, 0, 0, 0);
+        dsp->pushMidiNote(false, ev.frame, it->second, 0, 0, 0);
         lastNoteId.erase(it);
       } break;
 
@@ -114,7 +145,7 @@ protected:
             alreadyRecievedNote.begin(), alreadyRecievedNote.end(),
             [&](const uint8_t &noteNo) { return noteNo == ev.data[1]; });
           if (it != std::end(alreadyRecievedNote)) break;
-          dsp.pushMidiNote(
+          dsp->pushMidiNote(
             true, ev.frame, noteId, ev.data[1], 0.0f, ev.data[2] / float(INT8_MAX));
           lastNoteId.push_back(std::pair<uint8_t, uint32_t>(ev.data[1], noteId));
           alreadyRecievedNote.push_back(ev.data[1]);
@@ -124,7 +155,7 @@ protected:
 
       // Pitch bend. Center is 8192 (0x2000).
       case 0xe0:
-        dsp.param.value[ParameterID::pitchBend]->setFromFloat(
+        dsp->param.value[ParameterID::pitchBend]->setFromFloat(
           ((uint16_t(ev.data[2]) << 7) + ev.data[1]) / 16384.0f);
         break;
 
@@ -141,21 +172,23 @@ protected:
     uint32_t midiEventCount) override
   {
     if (outputs == nullptr) return;
-    if (dsp.param.value[ParameterID::bypass]->getInt()) return;
+    if (dsp->param.value[ParameterID::bypass]->getInt()) return;
 
     const auto timePos = getTimePosition();
-    if (!wasPlaying && timePos.playing) dsp.startup();
+    if (!wasPlaying && timePos.playing) dsp->startup();
     wasPlaying = timePos.playing;
 
     for (size_t i = 0; i < midiEventCount; ++i) handleMidi(midiEvents[i]);
     alreadyRecievedNote.resize(0);
 
-    dsp.setParameters(timePos.bbt.beatsPerMinute);
-    dsp.process(frames, outputs[0], outputs[1]);
+    dsp->setParameters(timePos.bbt.beatsPerMinute);
+    auto probe = loadMeter.probe(frames);
+    dsp->process(frames, outputs[0], outputs[1]);
   }
 
 private:
-  DSPCore dsp;
+  std::unique_ptr<DSPInterface> dsp;
+  DSPLoadMeter loadMeter;
   bool wasPlaying = false;
   uint32_t noteId = 0;
   std::vector<std::pair<uint8_t, uint32_t>> lastNoteId;
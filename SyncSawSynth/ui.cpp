@@ -151,14 +151,7 @@ public:
 
     setGeometryConstraints(defaultWidth, defaultHeight, true, true);
 
-    if (palette.fontPath().size() > 0)
-      fontId = createFontFromFile("main", palette.fontPath().c_str());
-
-    if (fontId < 0) {
-      fontId = createFontFromMemory(
-        "main", (unsigned char *)(FontData::TinosBoldItalicData),
-        FontData::TinosBoldItalicDataSize, false);
-    }
+    loadFont();
 
     // Oscillators.
     const auto oscWidth = 2.0 * knobWidth + 4.0 * margin;
@@ -270,6 +263,13 @@ public:
     knobLfoTempoDenominator->sensitivity = 0.001;
     knobLfoTempoNumerator->lowSensitivity = 0.00025;
 
+    addLabel(modLeft + 3.0 * knobX, modTop3, knobX, labelHeight, uiTextSize, "Interval");
+    std::vector<std::string> modulationIntervalOptions
+      = {"1", "2", "4", "8", "16", "32"};
+    addOptionMenu(
+      modLeft + 4.0 * knobX, modTop3, knobX - 1, labelHeight, uiTextSize,
+      ParameterID::modulationInterval, modulationIntervalOptions);
+
     // Gain.
     const auto gainTop = modTop2 + knobY + labelHeight + margin;
     const auto gainLeft = modLeft;
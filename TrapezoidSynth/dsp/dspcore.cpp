@@ -37,20 +37,39 @@ inline float paramToPitch(float semi, float cent, float bend)
 
 template<typename Sample> void TpzMono<Sample>::setup(Sample sampleRate)
 {
-  interpOctave.setSampleRate(sampleRate);
-  interpOctave.setTime(0.001);
-  interpOsc1Pitch.setSampleRate(sampleRate);
-  interpOsc2Pitch.setSampleRate(sampleRate);
+  this->sampleRate = sampleRate;
+
   tpzOsc1.sampleRate = 8 * sampleRate;
   tpzOsc2.sampleRate = 8 * sampleRate;
-  lfo.setup(sampleRate);
   gainEnvelope.setup(sampleRate);
-  filterEnvelope.setup(sampleRate);
-  modEnvelope1.setup(sampleRate);
-  modEnvelope2.setup(sampleRate);
   filter.setup(8 * sampleRate);
   shifter1.setup(sampleRate);
   shifter2.setup(sampleRate);
+
+  setupControl();
+}
+
+// Modulation sources run at control rate.
+template<typename Sample> void TpzMono<Sample>::setupControl()
+{
+  const Sample controlRate = sampleRate / controlInterval;
+  interpOctave.setSampleRate(controlRate);
+  interpOctave.setTime(0.001);
+  interpOsc1Pitch.setSampleRate(controlRate);
+  interpOsc2Pitch.setSampleRate(controlRate);
+  lfo.setup(controlRate);
+  filterEnvelope.setup(controlRate);
+  modEnvelope1.setup(controlRate);
+  modEnvelope2.setup(controlRate);
+}
+
+template<typename Sample> void TpzMono<Sample>::setControlInterval(uint32_t interval)
+{
+  if (interval < 1) interval = 1;
+  if (controlInterval == interval) return;
+  controlInterval = interval;
+  controlCounter = 0;
+  setupControl();
 }
 
 template<typename Sample> void TpzMono<Sample>::reset()
@@ -61,6 +80,9 @@ template<typename Sample> void TpzMono<Sample>::reset()
   shifter2.reset();
   gainEnvelope.terminate();
 
+  controlCounter = 0;
+  resetControl = true;
+
   startup();
 }
 
@@ -76,57 +98,78 @@ template<typename Sample> void TpzMono<Sample>::startup()
 
 template<typename Sample>
 void TpzMono<Sample>::setParameters(
-  Sample tempo, Sample timeSigUpper, GlobalParameter &param)
+  const SmootherCommon<Sample> &smootherCommon,
+  Sample tempo,
+  Sample timeSigUpper,
+  GlobalParameter &param)
 {
-  interpOctave.push(getOctave(param));
+  interpOctave.push(smootherCommon, getOctave(param));
   interpOsc1Pitch.setTime(param.value[ParameterID::pitchSlide]->getFloat());
-  interpOsc1Pitch.push(getOsc1Pitch(param));
+  interpOsc1Pitch.push(smootherCommon, getOsc1Pitch(param));
   interpOsc2Pitch.setTime(
     param.value[ParameterID::pitchSlide]->getFloat()
     * param.value[ParameterID::pitchSlideOffset]->getFloat());
-  interpOsc2Pitch.push(getOsc2Pitch(param));
-
-  interpOsc1Slope.push(param.value[ParameterID::osc1Slope]->getFloat());
-  interpOsc1PulseWidth.push(param.value[ParameterID::osc1PulseWidth]->getFloat());
-  interpOsc2Slope.push(param.value[ParameterID::osc2Slope]->getFloat());
-  interpOsc2PulseWidth.push(param.value[ParameterID::osc2PulseWidth]->getFloat());
-  interpOscMix.push(param.value[ParameterID::oscMix]->getFloat());
-  interpPitchDrift.push(param.value[ParameterID::osc1PitchDrift]->getFloat());
-  interpPhaseMod.push(param.value[ParameterID::pmOsc2ToOsc1]->getFloat());
-  interpFeedback.push(param.value[ParameterID::osc1Feedback]->getFloat());
-  interpFilterCutoff.push(param.value[ParameterID::filterCutoff]->getFloat());
-  interpFilterFeedback.push(param.value[ParameterID::filterFeedback]->getFloat());
-  interpFilterSaturation.push(param.value[ParameterID::filterSaturation]->getFloat());
-  interpFilterEnvToCutoff.push(param.value[ParameterID::filterEnvToCutoff]->getFloat());
-  interpFilterKeyToCutoff.push(param.value[ParameterID::filterKeyToCutoff]->getFloat());
+  interpOsc2Pitch.push(smootherCommon, getOsc2Pitch(param));
+
+  interpOsc1Slope.push(smootherCommon, param.value[ParameterID::osc1Slope]->getFloat());
+  interpOsc1PulseWidth.push(
+    smootherCommon, param.value[ParameterID::osc1PulseWidth]->getFloat());
+  interpOsc2Slope.push(smootherCommon, param.value[ParameterID::osc2Slope]->getFloat());
+  interpOsc2PulseWidth.push(
+    smootherCommon, param.value[ParameterID::osc2PulseWidth]->getFloat());
+  interpOscMix.push(smootherCommon, param.value[ParameterID::oscMix]->getFloat());
+  interpPitchDrift.push(
+    smootherCommon, param.value[ParameterID::osc1PitchDrift]->getFloat());
+  interpPhaseMod.push(smootherCommon, param.value[ParameterID::pmOsc2ToOsc1]->getFloat());
+  interpFeedback.push(smootherCommon, param.value[ParameterID::osc1Feedback]->getFloat());
+  interpFilterCutoff.push(
+    smootherCommon, param.value[ParameterID::filterCutoff]->getFloat());
+  interpFilterFeedback.push(
+    smootherCommon, param.value[ParameterID::filterFeedback]->getFloat());
+  interpFilterSaturation.push(
+    smootherCommon, param.value[ParameterID::filterSaturation]->getFloat());
+  interpFilterEnvToCutoff.push(
+    smootherCommon, param.value[ParameterID::filterEnvToCutoff]->getFloat());
+  interpFilterKeyToCutoff.push(
+    smootherCommon, param.value[ParameterID::filterKeyToCutoff]->getFloat());
   interpOscMixToFilterCutoff.push(
-    param.value[ParameterID::oscMixToFilterCutoff]->getFloat());
-  interpMod1EnvToPhaseMod.push(param.value[ParameterID::modEnv1ToPhaseMod]->getFloat());
-  interpMod2EnvToFeedback.push(param.value[ParameterID::modEnv2ToFeedback]->getFloat());
+    smootherCommon, param.value[ParameterID::oscMixToFilterCutoff]->getFloat());
+  interpMod1EnvToPhaseMod.push(
+    smootherCommon, param.value[ParameterID::modEnv1ToPhaseMod]->getFloat());
+  interpMod2EnvToFeedback.push(
+    smootherCommon, param.value[ParameterID::modEnv2ToFeedback]->getFloat());
   interpMod2EnvToLFOFrequency.push(
-    param.value[ParameterID::modEnv2ToLFOFrequency]->getFloat());
-  interpModEnv2ToOsc2Slope.push(param.value[ParameterID::modEnv2ToOsc2Slope]->getFloat());
-  interpMod2EnvToShifter1.push(param.value[ParameterID::modEnv2ToShifter1]->getFloat());
-  interpLFOPhase.push(param.value[ParameterID::lfoPhase]->getFloat());
-  interpLFOShape.push(param.value[ParameterID::lfoShape]->getFloat());
-  interpLFOToPitch.push(param.value[ParameterID::lfoToPitch]->getFloat());
-  interpLFOToSlope.push(param.value[ParameterID::lfoToSlope]->getFloat());
-  interpLFOToPulseWidth.push(param.value[ParameterID::lfoToPulseWidth]->getFloat());
-  interpLFOToCutoff.push(param.value[ParameterID::lfoToCutoff]->getFloat());
+    smootherCommon, param.value[ParameterID::modEnv2ToLFOFrequency]->getFloat());
+  interpModEnv2ToOsc2Slope.push(
+    smootherCommon, param.value[ParameterID::modEnv2ToOsc2Slope]->getFloat());
+  interpMod2EnvToShifter1.push(
+    smootherCommon, param.value[ParameterID::modEnv2ToShifter1]->getFloat());
+  interpLFOPhase.push(smootherCommon, param.value[ParameterID::lfoPhase]->getFloat());
+  interpLFOShape.push(smootherCommon, param.value[ParameterID::lfoShape]->getFloat());
+  interpLFOToPitch.push(smootherCommon, param.value[ParameterID::lfoToPitch]->getFloat());
+  interpLFOToSlope.push(smootherCommon, param.value[ParameterID::lfoToSlope]->getFloat());
+  interpLFOToPulseWidth.push(
+    smootherCommon, param.value[ParameterID::lfoToPulseWidth]->getFloat());
+  interpLFOToCutoff.push(
+    smootherCommon, param.value[ParameterID::lfoToCutoff]->getFloat());
 
   // shiftHz = freq * shifterPitch - freq.
   interpShifter1Pitch.push(
+    smootherCommon,
     paramToPitch(
-      param.value[ParameterID::shifter1Semi]->getFloat(),
-      param.value[ParameterID::shifter1Cent]->getFloat(), 0.5f)
-    - Sample(1));
-  interpShifter1Gain.push(param.value[ParameterID::shifter1Gain]->getFloat());
+        param.value[ParameterID::shifter1Semi]->getFloat(),
+        param.value[ParameterID::shifter1Cent]->getFloat(), 0.5f)
+      - Sample(1));
+  interpShifter1Gain.push(
+    smootherCommon, param.value[ParameterID::shifter1Gain]->getFloat());
   interpShifter2Pitch.push(
+    smootherCommon,
     paramToPitch(
-      param.value[ParameterID::shifter2Semi]->getFloat(),
-      param.value[ParameterID::shifter2Cent]->getFloat(), 0.5f)
-    - Sample(1));
-  interpShifter2Gain.push(param.value[ParameterID::shifter2Gain]->getFloat());
+        param.value[ParameterID::shifter2Semi]->getFloat(),
+        param.value[ParameterID::shifter2Cent]->getFloat(), 0.5f)
+      - Sample(1));
+  interpShifter2Gain.push(
+    smootherCommon, param.value[ParameterID::shifter2Gain]->getFloat());
 
   lfo.syncType
     = static_cast<LFOSyncType>(param.value[ParameterID::lfoTempoSync]->getInt());
@@ -134,7 +177,8 @@ void TpzMono<Sample>::setParameters(
   switch (param.value[ParameterID::lfoTempoSync]->getInt()) {
     default:
     case 0: // Free
-      interpLFOFrequency.push(param.value[ParameterID::lfoFrequency]->getFloat());
+      interpLFOFrequency.push(
+        smootherCommon, param.value[ParameterID::lfoFrequency]->getFloat());
       break;
 
     case 2: { // Beat
@@ -151,7 +195,7 @@ void TpzMono<Sample>::setParameters(
         / float(param.value[ParameterID::lfoTempoDenominator]->getInt() + 1);
       const float multiplier = Scales::lfoFrequencyMultiplier.map(
         param.value[ParameterID::lfoFrequency]->getNormalized());
-      interpLFOFrequency.push(multiplier * tempo / 480.0f / beat);
+      interpLFOFrequency.push(smootherCommon, multiplier * tempo / 480.0f / beat);
     } break;
   }
 
@@ -196,6 +240,10 @@ void TpzMono<Sample>::noteOn(
 {
   noteFreq = frequency;
 
+  // Jump to new targets when starting from silence, instead of ramping from old values.
+  if (gainEnvelope.isTerminated()) resetControl = true;
+  controlCounter = 0;
+
   int32_t pitchSlideType
     = wasResting ? param.value[ParameterID::pitchSlideType]->getInt() : -1;
   switch (pitchSlideType) {
@@ -261,50 +309,90 @@ template<typename Sample> void TpzMono<Sample>::release(bool resetPitch)
   filterEnvelope.release();
 }
 
-template<typename Sample> Sample TpzMono<Sample>::process(const uint64_t hostFrame)
+template<typename Sample>
+void TpzMono<Sample>::processControl(const uint64_t hostFrame)
 {
-  if (gainEnvelope.isTerminated()) return 0;
+  const uint32_t nStep = resetControl ? 1 : controlInterval;
+  resetControl = false;
 
   const auto modEnv2Sig = modEnvelope2.process();
   lfo.setFreq(
     interpLFOFrequency.process() + modEnv2Sig * interpMod2EnvToLFOFrequency.process());
   lfo.pw = interpLFOShape.process();
-  const auto lfoSig = lfo.process(hostFrame, interpLFOPhase.process());
+  const auto lfoSig = lfo.process(hostFrame / controlInterval, interpLFOPhase.process());
 
-  const auto filterEnv = filterEnvelope.process()
-    + interpOscMixToFilterCutoff.process() * (1.0f + feedbackBuffer);
-  const auto cutoff = interpFilterCutoff.process()
-    + interpFilterKeyToCutoff.process() * noteFreq
-    + Sample(19800)
-      * (interpLFOToCutoff.process() * lfoSig + interpFilterEnvToCutoff.process() * filterEnv);
-  filter.setCutoff(clamp(cutoff, Sample(20), Sample(8 * 20000)));
-  filter.feedback = interpFilterFeedback.process();
-  filter.saturation = interpFilterSaturation.process();
+  rampFilterEnv.push(filterEnvelope.process(), nStep);
+  rampOscMixToFilterCutoff.push(interpOscMixToFilterCutoff.process(), nStep);
+  rampFilterCutoff.push(
+    interpFilterCutoff.process() + interpFilterKeyToCutoff.process() * noteFreq, nStep);
+  rampLFOToCutoff.push(interpLFOToCutoff.process() * lfoSig, nStep);
+  rampFilterEnvToCutoff.push(interpFilterEnvToCutoff.process(), nStep);
+  rampFilterFeedback.push(interpFilterFeedback.process(), nStep);
+  rampFilterSaturation.push(interpFilterSaturation.process(), nStep);
 
   const auto octave = interpOctave.process();
-  tpzOsc1.setFreq(
-    octave
-    * interpOsc1Pitch.process()
-    * (1.0f
-      + lfoSig * interpLFOToPitch.process()
-      + interpPitchDrift.process() * rngPitchDrift.process()));
-  tpzOsc1.setSlope(interpOsc1Slope.process() + lfoSig * interpLFOToSlope.process());
-  tpzOsc1.setPulseWidth(
-    interpOsc1PulseWidth.process() + lfoSig * interpLFOToPulseWidth.process());
+  rampOsc1Freq.push(octave * interpOsc1Pitch.process(), nStep);
+  rampOsc1FreqMod.push(lfoSig * interpLFOToPitch.process(), nStep);
+  rampPitchDrift.push(interpPitchDrift.process(), nStep);
+  rampOsc1Slope.push(interpOsc1Slope.process() + lfoSig * interpLFOToSlope.process(), nStep);
+  rampOsc1PulseWidth.push(
+    interpOsc1PulseWidth.process() + lfoSig * interpLFOToPulseWidth.process(), nStep);
 
   const auto osc2Freq = octave * interpOsc2Pitch.process();
-  tpzOsc2.setFreq(osc2Freq);
-  tpzOsc2.setSlope(
-    interpOsc2Slope.process() + +modEnv2Sig * interpModEnv2ToOsc2Slope.process());
-  tpzOsc2.setPulseWidth(interpOsc2PulseWidth.process());
+  rampOsc2Freq.push(osc2Freq, nStep);
+  rampOsc2Slope.push(
+    interpOsc2Slope.process() + modEnv2Sig * interpModEnv2ToOsc2Slope.process(), nStep);
+  rampOsc2PulseWidth.push(interpOsc2PulseWidth.process(), nStep);
 
-  const auto oscMix = interpOscMix.process();
+  rampOscMix.push(interpOscMix.process(), nStep);
   const auto modEnv1Sig = modEnvelope1.process();
+  rampFeedback.push(
+    interpMod2EnvToFeedback.process() * modEnv2Sig + interpFeedback.process(), nStep);
+  rampPhaseMod.push(
+    interpMod1EnvToPhaseMod.process() * modEnv1Sig + interpPhaseMod.process(), nStep);
+
+  rampShifter1Shift.push(
+    osc2Freq * interpShifter1Pitch.process()
+      + modEnv2Sig * interpMod2EnvToShifter1.process(),
+    nStep);
+  rampShifter1Gain.push(interpShifter1Gain.process(), nStep);
+  rampShifter2Shift.push(osc2Freq * interpShifter2Pitch.process(), nStep);
+  rampShifter2Gain.push(interpShifter2Gain.process(), nStep);
+}
+
+template<typename Sample> Sample TpzMono<Sample>::process(const uint64_t hostFrame)
+{
+  if (gainEnvelope.isTerminated()) return 0;
+
+  if (controlCounter == 0) {
+    controlCounter = controlInterval;
+    processControl(hostFrame);
+  }
+  --controlCounter;
+
+  const auto filterEnv = rampFilterEnv.process()
+    + rampOscMixToFilterCutoff.process() * (1.0f + feedbackBuffer);
+  const auto cutoff = rampFilterCutoff.process()
+    + Sample(19800)
+      * (rampLFOToCutoff.process() + rampFilterEnvToCutoff.process() * filterEnv);
+  filter.setCutoff(clamp(cutoff, Sample(20), Sample(8 * 20000)));
+  filter.feedback = rampFilterFeedback.process();
+  filter.saturation = rampFilterSaturation.process();
+
+  tpzOsc1.setFreq(
+    rampOsc1Freq.process()
+    * (1.0f + rampOsc1FreqMod.process()
+       + rampPitchDrift.process() * rngPitchDrift.process()));
+  tpzOsc1.setSlope(rampOsc1Slope.process());
+  tpzOsc1.setPulseWidth(rampOsc1PulseWidth.process());
+
+  tpzOsc2.setFreq(rampOsc2Freq.process());
+  tpzOsc2.setSlope(rampOsc2Slope.process());
+  tpzOsc2.setPulseWidth(rampOsc2PulseWidth.process());
+
+  const auto oscMix = rampOscMix.process();
   tpzOsc1.addPhase(
-    feedbackBuffer
-      * (interpMod2EnvToFeedback.process() * modEnv2Sig + interpFeedback.process())
-    + tpzOsc2Buffer
-      * (interpMod1EnvToPhaseMod.process() * modEnv1Sig + interpPhaseMod.process()));
+    feedbackBuffer * rampFeedback.process() + tpzOsc2Buffer * rampPhaseMod.process());
   for (size_t i = 0; i < 8; ++i) {
     tpzOsc2Buffer = tpzOsc2.process();
     const float osc1Sig = tpzOsc1.process();
@@ -312,14 +400,13 @@ template<typename Sample> Sample TpzMono<Sample>::process(const uint64_t hostFra
       filter.process(osc1Sig + oscMix * (tpzOsc2Buffer - osc1Sig)));
   }
 
-  shifter1.setShift(
-    osc2Freq * interpShifter1Pitch.process()
-    + modEnv2Sig * interpMod2EnvToShifter1.process());
-  shifter2.setShift(osc2Freq * interpShifter2Pitch.process());
+  shifter1.setShift(rampShifter1Shift.process());
+  shifter2.setShift(rampShifter2Shift.process());
 
   return gainEnvelope.process()
-    * (feedbackBuffer + interpShifter1Gain.process() * shifter1.process(feedbackBuffer)
-       + interpShifter2Gain.process() * shifter2.process(feedbackBuffer));
+    * (feedbackBuffer
+       + rampShifter1Gain.process() * shifter1.process(feedbackBuffer)
+       + rampShifter2Gain.process() * shifter2.process(feedbackBuffer));
 }
 
 template<typename Sample> Sample TpzMono<Sample>::getOctave(GlobalParameter &param)
@@ -356,8 +443,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate / controlInterval);
+  smootherCommon.setTime(0.01f);
 
   noteStack.reserve(128);
   noteStack.resize(0);
@@ -365,6 +452,7 @@ void DSPCore::setup(double sampleRate)
   tpz1.setup(sampleRate);
 
   interpMasterGain.reset(param.value[ParameterID::gain]->getFloat());
+  rampMasterGain.reset(param.value[ParameterID::gain]->getFloat());
 
   reset();
   startup();
@@ -382,24 +470,39 @@ void DSPCore::startup() { tpz1.startup(); }
 
 void DSPCore::setParameters(double tempo, float timeSigUpper)
 {
-  SmootherCommon<float>::setTime(param.value[ParameterID::smoothness]->getFloat());
+  const uint32_t interval = 1 << param.value[ParameterID::modulationInterval]->getInt();
+  if (controlInterval != interval) {
+    controlInterval = interval;
+    controlCounter = 0;
+    smootherCommon.setSampleRate(sampleRate / controlInterval);
+    tpz1.setControlInterval(controlInterval);
+  }
+
+  smootherCommon.setTime(param.value[ParameterID::smoothness]->getFloat());
 
-  interpMasterGain.push(velocity * param.value[ParameterID::gain]->getFloat());
+  interpMasterGain.push(
+    smootherCommon, velocity * param.value[ParameterID::gain]->getFloat());
 
-  tpz1.setParameters(tempo, timeSigUpper, param);
+  tpz1.setParameters(smootherCommon, tempo, timeSigUpper, param);
 }
 
 void DSPCore::process(
   const uint64_t hostFrame, const size_t length, float *out0, float *out1)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(float(length) / controlInterval);
 
   float sample = 0;
   for (size_t i = 0; i < length; ++i) {
     processMidiNote(i);
 
+    if (controlCounter == 0) {
+      controlCounter = controlInterval;
+      rampMasterGain.push(interpMasterGain.process(), controlInterval);
+    }
+    --controlCounter;
+
     sample = tpz1.process(hostFrame + i);
-    const float masterGain = interpMasterGain.process();
+    const float masterGain = rampMasterGain.process();
     out0[i] = masterGain * sample;
     out1[i] = masterGain * sample;
   }
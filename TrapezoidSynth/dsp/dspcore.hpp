@@ -74,9 +74,15 @@ public:
   AMPitchShiter<Sample> shifter1;
   AMPitchShiter<Sample> shifter2;
 
+  Sample sampleRate = 44100;
   Sample noteFreq = 0;
   Sample normalizedKey = 0;
 
+  // Modulation is computed every controlInterval samples, then linearly interpolated.
+  uint32_t controlInterval = 1;
+  uint32_t controlCounter = 0;
+  bool resetControl = true;
+
   LinearSmootherLocal<Sample> interpOctave;
   LinearSmootherLocal<Sample> interpOsc1Pitch;
   LinearSmootherLocal<Sample> interpOsc2Pitch;
@@ -111,10 +117,38 @@ public:
   LinearSmoother<Sample> interpShifter2Pitch;
   LinearSmoother<Sample> interpShifter2Gain;
 
+  ControlRamp<Sample> rampFilterCutoff;
+  ControlRamp<Sample> rampFilterFeedback;
+  ControlRamp<Sample> rampFilterSaturation;
+  ControlRamp<Sample> rampFilterEnv;
+  ControlRamp<Sample> rampFilterEnvToCutoff;
+  ControlRamp<Sample> rampOscMixToFilterCutoff;
+  ControlRamp<Sample> rampLFOToCutoff;
+  ControlRamp<Sample> rampOsc1Freq;
+  ControlRamp<Sample> rampOsc1FreqMod;
+  ControlRamp<Sample> rampOsc1Slope;
+  ControlRamp<Sample> rampOsc1PulseWidth;
+  ControlRamp<Sample> rampOsc2Freq;
+  ControlRamp<Sample> rampOsc2Slope;
+  ControlRamp<Sample> rampOsc2PulseWidth;
+  ControlRamp<Sample> rampOscMix;
+  ControlRamp<Sample> rampPitchDrift;
+  ControlRamp<double> rampFeedback;
+  ControlRamp<double> rampPhaseMod;
+  ControlRamp<Sample> rampShifter1Shift;
+  ControlRamp<Sample> rampShifter1Gain;
+  ControlRamp<Sample> rampShifter2Shift;
+  ControlRamp<Sample> rampShifter2Gain;
+
   void setup(Sample sampleRate);
+  void setControlInterval(uint32_t interval);
   void reset();
   void startup();
-  void setParameters(Sample tempo, Sample timeSigUpper, GlobalParameter &param);
+  void setParameters(
+    const SmootherCommon<Sample> &smootherCommon,
+    Sample tempo,
+    Sample timeSigUpper,
+    GlobalParameter &param);
   void
   noteOn(bool wasResting, Sample frequency, Sample normalizedKey, GlobalParameter &param);
   void noteOff(Sample frequency);
@@ -122,6 +156,8 @@ public:
   Sample process(const uint64_t hostFrame);
 
 private:
+  void setupControl();
+  void processControl(const uint64_t hostFrame);
   Sample getOctave(GlobalParameter &param);
   Sample getOsc1Pitch(GlobalParameter &param);
   Sample getOsc2Pitch(GlobalParameter &param);
@@ -189,11 +225,16 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
 
   float velocity = 0;
   std::vector<NoteInfo> noteStack; // Top of this stack is current note.
 
+  uint32_t controlInterval = 1;
+  uint32_t controlCounter = 0;
+
   TpzMono<float> tpz1;
 
   LinearSmoother<float> interpMasterGain;
+  ControlRamp<float> rampMasterGain;
 };
@@ -310,7 +310,14 @@ protected:
 template<typename Sample> class PolyExpEnvelope {
 public:
   // attack is in seconds. curve is arbitrary value.
-  void setup(Sample sampleRate) { this->sampleRate = sampleRate; }
+  void setup(Sample sampleRate)
+  {
+    // Rescale running envelope, so that changing sample rate keeps its time.
+    const Sample ratio = this->sampleRate / sampleRate;
+    gamma = somepow<Sample>(gamma, ratio);
+    tick *= ratio;
+    this->sampleRate = sampleRate;
+  }
 
   bool isReleasing() { return time >= attack; }
 
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 
 #include "../../common/dsp/constants.hpp"
 #include "../../common/dsp/somemath.hpp"
@@ -199,7 +200,20 @@ public:
 
   void setFreq(float hz)
   {
-    if (hz >= 0) tick = hz / sampleRate;
+    if (hz < 0) return;
+    tick = hz / sampleRate;
+
+    // Order of PTR is reduced at high frequency. Kernel is picked here, not per sample.
+    using Tpz = PTRTrapezoidOsc;
+    static constexpr std::array<PtrFunc, 6> ptrTable{
+      &Tpz::branch<Tpz::ptrRamp2>, &Tpz::branch<Tpz::ptrRamp2>,
+      &Tpz::branch<Tpz::ptrRamp2>, &Tpz::branch<Tpz::ptrRamp3>,
+      &Tpz::branch<Tpz::ptrRamp4>, &Tpz::branch<Tpz::ptrRamp5>};
+
+    uint32_t order = 5;
+    if (order > float(0.25) / tick) order = int(float(0.25) / tick);
+    ptrLen = order * tick;
+    ptrFunc = ptrTable[order];
   }
 
   void setPhase(float phase) { this->phase = phase; }
@@ -213,7 +227,7 @@ public:
     if (tick <= 0) return 0;
     phase += tick;
     phase -= somefloor<float>(phase);
-    return ptrTpz5(phase, tick, slope, pw);
+    return ptrTpz(phase, tick, slope, pw);
   }
 
   float sampleRate;
@@ -223,14 +237,14 @@ public:
   float pw = float(0.5); // Pulse width.
 
 protected:
-  // tick must be greater than 0.
-  static float ptrTpz5(float phase, float tick, float slope, float pw)
-  {
-    uint32_t order = 5;
-    if (order > float(0.25) / tick) order = int(float(0.25) / tick);
+  using PtrFunc = float (*)(float, float, float, float, float);
 
-    const float ptrLen = order * tick;
+  float ptrLen = 0;
+  PtrFunc ptrFunc = &PTRTrapezoidOsc::branch<PTRTrapezoidOsc::ptrRamp5>;
 
+  // tick must be greater than 0.
+  float ptrTpz(float phase, float tick, float slope, float pw)
+  {
     const float maxSlope = float(0.25) / ptrLen;
     if (slope > maxSlope) {
       slope = maxSlope;
@@ -244,13 +258,7 @@ protected:
 
     const float y = float(1) - float(2) * slope * ptrLen;
     const float dc = (y * y + pw * slope * y) / (float(2) * y + slope - float(1));
-    if (order == 5)
-      return branch<PTRTrapezoidOsc::ptrRamp5>(slope, pw, y, phase, tick) - dc;
-    else if (order == 4)
-      return branch<PTRTrapezoidOsc::ptrRamp4>(slope, pw, y, phase, tick) - dc;
-    else if (order == 3)
-      return branch<PTRTrapezoidOsc::ptrRamp3>(slope, pw, y, phase, tick) - dc;
-    return branch<PTRTrapezoidOsc::ptrRamp2>(slope, pw, y, phase, tick) - dc;
+    return ptrFunc(slope, pw, y, phase, tick) - dc;
   }
 
   template<float (*ptrfunc)(float, float)>
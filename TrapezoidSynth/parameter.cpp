@@ -67,6 +67,7 @@ LogScale<double> Scales::pitchSlide(0.001, 0.5, 0.5, 0.15);
 LinearScale<double> Scales::pitchSlideOffset(0.0, 2.0);
 
 LogScale<double> Scales::smoothness(0.001, 0.5, 0.5, 0.2);
+IntScale<double> Scales::modulationInterval(5);
 
 LogScale<double> Scales::gain(0.0, 4.0, 0.5, 0.75);
 
@@ -116,6 +116,8 @@ enum ID {
 
   pitchBend,
 
+  modulationInterval,
+
   ID_ENUM_LENGTH,
 };
 } // namespace ParameterID
@@ -168,17 +170,16 @@ struct Scales {
   static SomeDSP::LinearScale<double> pitchSlideOffset;
 
   static SomeDSP::LogScale<double> smoothness;
+  static SomeDSP::IntScale<double> modulationInterval;
 
   static SomeDSP::LogScale<double> gain;
 };
 
 struct GlobalParameter : public ParameterInterface {
-  std::vector<std::unique_ptr<ValueInterface>> value;
+  ValueArray<ParameterID::ID_ENUM_LENGTH> value;
 
   GlobalParameter()
   {
-    value.resize(ParameterID::ID_ENUM_LENGTH);
-
     using ID = ParameterID::ID;
     using LinearValue = FloatValue<SomeDSP::LinearScale<double>>;
     using LogValue = FloatValue<SomeDSP::LogScale<double>>;
@@ -348,6 +349,10 @@ struct GlobalParameter : public ParameterInterface {
 
     value[ID::pitchBend] = std::make_unique<LinearValue>(
       0.5, Scales::defaultScale, "pitchBend", kParameterIsAutomable);
+
+    value[ID::modulationInterval] = std::make_unique<IntValue>(
+      0, Scales::modulationInterval, "modulationInterval",
+      kParameterIsAutomable | kParameterIsInteger);
   }
 
 #ifndef TEST_BUILD
@@ -360,10 +365,7 @@ struct GlobalParameter : public ParameterInterface {
 
   size_t idLength() override { return value.size(); }
 
-  void resetParameter()
-  {
-    for (auto &val : value) val->setFromNormalized(val->getDefaultNormalized());
-  }
+  void resetParameter() { value.reset(); }
 
   double getNormalized(uint32_t index) const override
   {
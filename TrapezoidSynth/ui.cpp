@@ -125,14 +125,7 @@ public:
 
     setGeometryConstraints(defaultWidth, defaultHeight, true, true);
 
-    if (palette.fontPath().size() > 0)
-      fontId = createFontFromFile("main", palette.fontPath().c_str());
-
-    if (fontId < 0) {
-      fontId = createFontFromMemory(
-        "main", (unsigned char *)(FontData::TinosBoldItalicData),
-        FontData::TinosBoldItalicDataSize, false);
-    }
+    loadFont();
 
     using ID = ParameterID::ID;
 
@@ -397,6 +390,14 @@ public:
       left1 + 1.0f * knobX, top4knob, knobWidth, margin, uiTextSize, "Offset",
       ID::pitchSlideOffset);
 
+    addLabel(
+      left1 + floorf(2.25f * knobX), top4knob, floorf(2.25f * knobWidth), labelHeight,
+      uiTextSize, "Mod Interval", ALIGN_CENTER | ALIGN_MIDDLE);
+    std::vector<std::string> modulationIntervalItems{"1", "2", "4", "8", "16", "32"};
+    addOptionMenu(
+      left1 + floorf(4.5f * knobX), top4knob, floorf(1.5f * knobWidth), labelHeight,
+      uiTextSize, ID::modulationInterval, modulationIntervalItems);
+
     // Plugin name.
     const auto splashWidth = 3.75f * knobX;
     const auto splashHeight = 40.0f;
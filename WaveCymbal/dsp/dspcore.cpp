@@ -29,15 +29,23 @@ inline float midiNoteToFrequency(float pitch, float tuning)
 
 float paramToPitch(float bend) { return powf(2.0f, ((bend - 0.5f) * 400.0f) / 1200.0f); }
 
+inline bool isSilent(const float *buffer, size_t length)
+{
+  for (size_t i = 0; i < length; ++i) {
+    if (std::fabs(buffer[i]) >= hitSilence) return false;
+  }
+  return true;
+}
+
 void DSPCore::setSystem()
 {
   excitor.set(
-    param.value[ParameterID::pickCombTime]->getFloat(),
+    smootherCommon, param.value[ParameterID::pickCombTime]->getFloat(),
     param.value[ParameterID::pickCombFeedback]->getFloat(),
     param.value[ParameterID::randomAmount]->getFloat());
 
   cymbal.set(
-    1 + param.value[ParameterID::nCymbal]->getInt(),
+    smootherCommon, 1 + param.value[ParameterID::nCymbal]->getInt(),
     1 + param.value[ParameterID::stack]->getInt(),
     param.value[ParameterID::minFrequency]->getFloat(),
     param.value[ParameterID::maxFrequency]->getFloat(),
@@ -52,11 +60,17 @@ void DSPCore::setSystem()
 }
 
 void DSPCore::setup(double sampleRate)
+{
+  setupDSP(sampleRate);
+  liveCountdown = 0;
+}
+
+void DSPCore::setupDSP(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(param.value[ParameterID::smoothness]->getFloat());
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(param.value[ParameterID::smoothness]->getFloat());
 
   noteStack.reserve(128);
   noteStack.resize(0);
@@ -65,7 +79,7 @@ void DSPCore::setup(double sampleRate)
   velvetNoise.sampleRate = sampleRate;
 
   excitor.setup(sampleRate);
-  cymbal.setup(sampleRate);
+  cymbal.setup(smootherCommon, sampleRate);
   setSystem();
 
   startup();
@@ -76,6 +90,7 @@ void DSPCore::free() {}
 void DSPCore::reset()
 {
   cymbal.reset();
+  hitCache.reset();
   startup();
 }
 
@@ -83,10 +98,11 @@ void DSPCore::startup() { rnd.seed = param.value[ParameterID::seed]->getInt(); }
 
 void DSPCore::setParameters()
 {
-  SmootherCommon<float>::setTime(param.value[ParameterID::smoothness]->getFloat());
+  smootherCommon.setTime(param.value[ParameterID::smoothness]->getFloat());
 
   if (!noteStack.empty()) velocity = noteStack.back().velocity;
-  interpMasterGain.push(velocity * param.value[ParameterID::gain]->getFloat());
+  interpMasterGain.push(
+    smootherCommon, velocity * param.value[ParameterID::gain]->getFloat());
 
   if (trigger) {
     trigger = false;
@@ -103,19 +119,128 @@ void DSPCore::setParameters()
   if (param.value[ParameterID::oscType]->getInt() >= 2 && !noteStack.empty()) {
     const auto freq = noteStack.back().frequency
       * paramToPitch(param.value[ParameterID::pitchBend]->getFloat());
-    interpPitch.push(freq);
+    interpPitch.push(smootherCommon, freq);
     velvetNoise.setDensity(freq);
   } else {
     pulsar.setFrequency(0);
     velvetNoise.setDensity(0);
-    interpPitch.push(0.0f);
+    interpPitch.push(smootherCommon, 0.0f);
+  }
+
+  if (param.value[ParameterID::hitCache]->getInt()) {
+    using ID = ParameterID::ID;
+
+    hitCache.start(renderHit);
+
+    // Pitch is not used by Impulse oscillator.
+    hitKey = HitKey();
+    for (size_t i = 0; i < hitRequest.value.size(); ++i) {
+      hitRequest.value[i] = param.value[i]->getFloat();
+      if (i == ID::bypass || i == ID::gain || i == ID::pitchBend || i == ID::hitCache)
+        continue;
+      hitKey.add(hitRequest.value[i]);
+    }
+    hitRequest.sampleRate = sampleRate;
+    hitKey.add(sampleRate);
+
+    isHitCacheable = param.value[ID::oscType]->getInt() == 1
+      && param.value[ID::retrigger]->getInt();
   }
 }
 
 void DSPCore::process(
   const size_t length, const float *in0, const float *in1, float *out0, float *out1)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  if (!param.value[ParameterID::hitCache]->getInt()) {
+    hitCache.reset();
+    liveCountdown = int64_t(sampleRate);
+    processLive(length, in0, in1, out0, out1);
+    return;
+  }
+
+  hitCache.collect();
+
+  // Cached hits follow the master gain of live synthesis.
+  auto interpCacheGain = interpMasterGain;
+
+  // Cached hits are removed from `midiNotes`. Missed hits are requested and played live.
+  bool isNoteOn = false;
+  for (auto it = midiNotes.begin(); it != midiNotes.end();) {
+    if (!it->isNoteOn) {
+      ++it;
+      continue;
+    }
+
+    if (isHitCacheable) {
+      const auto key = hitKey.get();
+      if (hitCache.play(key, it->frame, 1.0f)) {
+        // Velocity is applied by master gain from next block, as same as live note.
+        noteStack.push_back(
+          {it->id, midiNoteToFrequency(it->pitch, it->tuning), it->velocity});
+        it = midiNotes.erase(it);
+        continue;
+      }
+      hitCache.request(key, [&](HitRequest &request) { request = hitRequest; });
+    }
+    isNoteOn = true;
+    ++it;
+  }
+
+  // Inputs are checked before writing outputs, because they may share the same buffer.
+  if (liveCountdown > 0 || isNoteOn || !isSilent(in0, length) || !isSilent(in1, length)) {
+    processLive(length, in0, in1, out0, out1);
+
+    float peak = 0.0f;
+    for (size_t i = 0; i < length; ++i) peak = std::max(peak, std::fabs(out0[i]));
+    // Attack of a new note may start after this block.
+    const float gain = interpMasterGain.getValue();
+    if (isNoteOn || gain <= 0.0f || peak >= hitSilence * gain)
+      liveCountdown = int64_t(sampleRate);
+    else
+      liveCountdown -= int64_t(length);
+  } else {
+    for (const auto &note : midiNotes) noteOff(note.id);
+    midiNotes.clear();
+    for (size_t i = 0; i < length; ++i) interpMasterGain.process();
+    std::fill(out0, out0 + length, 0.0f);
+    std::fill(out1, out1 + length, 0.0f);
+  }
+
+  if (!hitCache.isPlaying()) return;
+  for (size_t i = 0; i < length; ++i) {
+    const float sample = interpCacheGain.process() * hitCache.process();
+    out0[i] += sample;
+    out1[i] += sample;
+  }
+}
+
+std::vector<float>
+DSPCore::renderHit(const HitRequest &request, const std::atomic<bool> &isRunning)
+{
+  using ID = ParameterID::ID;
+
+  auto dsp = std::make_unique<DSPCore>();
+  for (size_t i = 0; i < request.value.size(); ++i)
+    dsp->param.value[i]->setFromFloat(request.value[i]);
+  dsp->param.value[ID::gain]->setFromFloat(1.0);
+  dsp->param.value[ID::hitCache]->setFromInt(0);
+
+  dsp->setupDSP(request.sampleRate);
+  dsp->noteOn(0, 69, 0.0f, 1.0f);
+
+  std::vector<float> silence;
+  return renderHitUntilSilence(
+    request.sampleRate, isRunning, [&](float *out, size_t length) {
+      silence.resize(length, 0.0f);
+      dsp->setParameters();
+      dsp->processLive(length, silence.data(), silence.data(), out, out);
+    });
+}
+
+void DSPCore::processLive(
+  const size_t length, const float *in0, const float *in1, float *out0, float *out1)
+{
+  smootherCommon.setBufferSize(length);
 
   const bool excitation = param.value[ParameterID::excitation]->getInt();
   const bool collision = param.value[ParameterID::collision]->getInt();
@@ -82,7 +82,7 @@ constexpr float sliderX = 80.0f;
 constexpr float sliderY = sliderHeight + labelY;
 constexpr float checkboxWidth = 80.0f;
 constexpr uint32_t defaultWidth = uint32_t(2 * 20 + sliderX + 7 * knobX + 10 * margin);
-constexpr uint32_t defaultHeight = uint32_t(2 * 15 + 2 * knobY + 2 * labelHeight + 55);
+constexpr uint32_t defaultHeight = uint32_t(2 * 15 + 2 * knobY + 3 * labelHeight + 55);
 
 class WaveCymbalUI : public PluginUIBase {
 protected:
@@ -103,14 +103,7 @@ public:
 
     setGeometryConstraints(defaultWidth, defaultHeight, true, true);
 
-    if (palette.fontPath().size() > 0)
-      fontId = createFontFromFile("main", palette.fontPath().c_str());
-
-    if (fontId < 0) {
-      fontId = createFontFromMemory(
-        "main", (unsigned char *)(FontData::TinosBoldItalicData),
-        FontData::TinosBoldItalicDataSize, false);
-    }
+    loadFont();
 
     using ID = ParameterID::ID;
 
@@ -228,6 +221,11 @@ public:
       leftExcitation + 2.0f * knobX + 2.0f * margin, topOscillator, checkboxWidth,
       labelHeight, uiTextSize, ID::cutoffMap, itemCutoffMap);
 
+    // Hit cache.
+    addToggleButton(
+      leftGain, topOscillator + labelHeight + margin, checkboxWidth, labelHeight,
+      midTextSize, "Hit Cache", ID::hitCache);
+
     // Smoothness.
     const auto leftSmoothness = leftExcitation + 3.0f * knobX + 4.0f * margin;
     addKnob(
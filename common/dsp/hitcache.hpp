@@ -0,0 +1,393 @@
+// (c) 2020 Takamitsu Endo
+//
+// This file is part of Uhhyou Plugins.
+//
+// Uhhyou Plugins is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Uhhyou Plugins is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Uhhyou Plugins.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "semaphore.hpp"
+
+namespace SomeDSP {
+
+// FNV-1a. Makes a cache key from the values which change the sound of a hit.
+class HitKey {
+public:
+  template<typename T> void add(T value)
+  {
+    uint8_t bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    for (auto byte : bytes) hash = (hash ^ byte) * 0x100000001b3;
+  }
+
+  uint64_t get() const { return hash; }
+
+private:
+  uint64_t hash = 0xcbf29ce484222325;
+};
+
+// Output below this level is regarded as silence.
+constexpr float hitSilence = 1e-5f;
+
+/**
+Renders a mono hit for `HitCache`. `process(float *out, size_t length)` is called until
+the output stays 60 dB below its peak for 0.5 seconds. Then the tail is trimmed and faded
+out in 10 ms. Returns empty when aborted, when the hit is silent, or when the hit doesn't
+decay in 10 seconds.
+*/
+template<typename Process>
+std::vector<float> renderHitUntilSilence(
+  float sampleRate, const std::atomic<bool> &isRunning, Process process)
+{
+  constexpr size_t blockSize = 256;
+  const size_t tailLength = size_t(0.5f * sampleRate);
+  const size_t fadeLength = size_t(0.01f * sampleRate);
+  const size_t maxLength = size_t(10 * sampleRate);
+
+  std::vector<float> data;
+  float peak = hitSilence;
+  size_t end = 0; // One past the last sample above threshold.
+  while (data.size() < maxLength) {
+    if (!isRunning.load(std::memory_order_relaxed)) return {};
+
+    const auto start = data.size();
+    data.resize(start + blockSize);
+    process(data.data() + start, blockSize);
+    for (size_t i = start; i < data.size(); ++i) {
+      const auto level = std::fabs(data[i]);
+      peak = std::max(peak, level);
+      if (level >= 1e-3f * peak) end = i + 1;
+    }
+
+    if (data.size() - end < tailLength) continue;
+    if (end == 0) return {};
+
+    data.resize(end);
+    data.shrink_to_fit();
+    const auto fade = std::min(fadeLength, end);
+    for (size_t i = 0; i < fade; ++i) data[end - 1 - i] *= float(i) / fade;
+    return data;
+  }
+  return {};
+}
+
+/**
+Cache of rendered one-shot hits. Used by percussion which sounds the same on every hit
+while parameters are unchanged.
+
+`play()` starts a voice which plays back a rendered hit. On miss, caller falls back to
+live synthesis and calls `request()`. A worker thread renders the hit, and it becomes
+available after `collect()` on a later block. The worker is started by the first
+`start()`, and it's parked on a semaphore while there's nothing to do.
+
+Entries and voices are only touched by audio thread, so lookup and playback don't take a
+lock. Rendered buffers are handed over through single producer, single consumer queues by
+swapping `std::vector`. Evicted buffers go back through the same queue, and are freed on
+worker thread. Audio thread posts the semaphore to wake the parked worker, without a lock.
+It happens on a new request or when rendered hits are collected.
+
+`Request` is a snapshot of parameters taken on audio thread. It must be copyable without
+allocation.
+*/
+template<typename Request> class HitCache {
+public:
+  // Returns rendered mono hit. Empty result marks the key as not cacheable. Rendering
+  // should be aborted when `isRunning` becomes false.
+  using Render
+    = std::vector<float> (*)(const Request &request, const std::atomic<bool> &isRunning);
+
+  static constexpr size_t nEntry = 32;
+  static constexpr size_t nVoice = 32;
+
+  HitCache() = default;
+  HitCache(const HitCache &) = delete;
+  HitCache &operator=(const HitCache &) = delete;
+  ~HitCache() { stop(); }
+
+  // Not realtime safe on the first call, which starts worker. Later calls do nothing.
+  void start(Render render)
+  {
+    if (worker.joinable()) return;
+
+    this->render = render;
+    isRunning.store(true);
+    worker = std::thread([this]() { work(); });
+  }
+
+  // Not realtime safe. Stops worker and discards all entries.
+  void stop()
+  {
+    isRunning.store(false);
+    if (worker.joinable()) {
+      semaphore.post();
+      worker.join();
+    }
+
+    reset();
+    for (auto &entry : entries) entry = Entry();
+    for (auto &result : results) result = Result();
+    requestHead.store(0);
+    requestTail.store(0);
+    resultHead.store(0);
+    resultTail.store(0);
+    nPending = 0;
+    clock = 0;
+  }
+
+  // Realtime safe. Stops all voices.
+  void reset()
+  {
+    for (size_t i = 0; i < nActive; ++i) --entries[voices[i].entry].nVoice;
+    nActive = 0;
+  }
+
+  // Realtime safe. Moves rendered hits to entries. Call once for each block.
+  void collect()
+  {
+    bool isCollected = false;
+    while (true) {
+      const auto tail = resultTail.load(std::memory_order_relaxed);
+      if (tail == resultHead.load(std::memory_order_acquire)) break;
+
+      auto &result = results[tail & mask];
+      auto victim = findVictim();
+      if (victim == nullptr) break; // All entries are playing. Retry on next block.
+
+      // Evicted buffer stays in `result`, and worker frees it.
+      victim->data.swap(result.data);
+      victim->key = result.key;
+      victim->isUsed = true;
+      victim->lastUsed = ++clock;
+
+      auto end = pending.begin() + nPending;
+      auto it = std::find(pending.begin(), end, result.key);
+      if (it != end) {
+        *it = pending[nPending - 1];
+        --nPending;
+      }
+
+      resultTail.store(tail + 1, std::memory_order_release);
+      isCollected = true;
+    }
+
+    // Worker frees evicted buffers, and it may be waiting for a free slot of results.
+    if (isCollected) wake();
+  }
+
+  /**
+  Realtime safe. Starts playing the hit of `key` after `delay` samples. Returns false on
+  miss, or when the key is marked as not cacheable.
+  */
+  bool play(uint64_t key, uint32_t delay, float gain)
+  {
+    auto entry = find(key);
+    if (entry == nullptr || entry->data.empty()) return false;
+
+    // Steals the oldest voice when all voices are playing.
+    if (nActive >= nVoice) {
+      auto oldest = std::max_element(
+        voices.begin(), voices.end(),
+        [](const Voice &a, const Voice &b) { return a.position < b.position; });
+      --entries[oldest->entry].nVoice;
+      *oldest = voices[--nActive];
+    }
+
+    entry->lastUsed = ++clock;
+    ++entry->nVoice;
+    voices[nActive++]
+      = {uint32_t(entry - entries.data()), -int64_t(delay), gain, entry->data.data(),
+         int64_t(entry->data.size())};
+    return true;
+  }
+
+  /**
+  Realtime safe. Requests rendering of `key`, if it's not cached or already requested.
+  `fill(Request &)` writes the parameters of the hit. Request is dropped when the queue is
+  full, and is tried again on next miss.
+  */
+  template<typename Fill> void request(uint64_t key, Fill fill)
+  {
+    if (find(key) != nullptr) return;
+    const auto pendingEnd = pending.begin() + nPending;
+    if (std::find(pending.begin(), pendingEnd, key) != pendingEnd) return;
+    if (nPending >= pending.size()) return;
+
+    const auto head = requestHead.load(std::memory_order_relaxed);
+    if (head - requestTail.load(std::memory_order_acquire) >= queueSize) return;
+
+    auto &slot = requests[head & mask];
+    slot.key = key;
+    fill(slot.request);
+    requestHead.store(head + 1, std::memory_order_release);
+    pending[nPending++] = key;
+    wake();
+  }
+
+  bool isPlaying() const { return nActive > 0; }
+
+  // Realtime safe. Returns the sum of voices for a sample.
+  float process()
+  {
+    float sum = 0.0f;
+    size_t index = 0;
+    while (index < nActive) {
+      auto &voice = voices[index];
+      if (voice.position >= 0) sum += voice.gain * voice.data[voice.position];
+      if (++voice.position < voice.length) {
+        ++index;
+        continue;
+      }
+      --entries[voice.entry].nVoice;
+      voice = voices[--nActive];
+    }
+    return sum;
+  }
+
+protected:
+  static constexpr size_t queueSize = 8;
+  static constexpr size_t mask = queueSize - 1;
+  static_assert((queueSize & mask) == 0);
+
+  struct Entry {
+    uint64_t key = 0;
+    std::vector<float> data; // Empty means not cacheable.
+    bool isUsed = false;
+    uint32_t nVoice = 0;
+    uint64_t lastUsed = 0;
+  };
+
+  struct Voice {
+    uint32_t entry;
+    int64_t position; // Negative until the start of playback.
+    float gain;
+    const float *data;
+    int64_t length;
+  };
+
+  struct RequestSlot {
+    uint64_t key = 0;
+    Request request;
+  };
+
+  struct Result {
+    uint64_t key = 0;
+    std::vector<float> data;
+  };
+
+  // Audio thread.
+  std::array<Entry, nEntry> entries;
+  std::array<Voice, nVoice> voices;
+  size_t nActive = 0;
+  std::array<uint64_t, 2 * queueSize> pending{};
+  size_t nPending = 0;
+  uint64_t clock = 0;
+
+  // Shared. Each slot is only touched by the side which owns it at that moment.
+  std::array<RequestSlot, queueSize> requests;
+  std::array<Result, queueSize> results;
+  alignas(64) std::atomic<size_t> requestHead{0};
+  alignas(64) std::atomic<size_t> requestTail{0};
+  alignas(64) std::atomic<size_t> resultHead{0};
+  alignas(64) std::atomic<size_t> resultTail{0};
+
+  Render render = nullptr;
+  std::atomic<bool> isRunning{false};
+  std::thread worker;
+
+  Semaphore semaphore;
+  std::atomic<bool> isParked{false};
+  std::atomic<uint32_t> wakeCount{0};
+
+  // Posts only when worker is parked, so the count of semaphore stays small.
+  void wake()
+  {
+    wakeCount.fetch_add(1, std::memory_order_seq_cst);
+    if (isParked.exchange(false, std::memory_order_seq_cst)) semaphore.post();
+  }
+
+  Entry *find(uint64_t key)
+  {
+    for (auto &entry : entries) {
+      if (entry.isUsed && entry.key == key) return &entry;
+    }
+    return nullptr;
+  }
+
+  // Unused entry, or least recently used entry which is not playing.
+  Entry *findVictim()
+  {
+    Entry *victim = nullptr;
+    for (auto &entry : entries) {
+      if (!entry.isUsed) return &entry;
+      if (entry.nVoice > 0) continue;
+      if (victim == nullptr || entry.lastUsed < victim->lastUsed) victim = &entry;
+    }
+    return victim;
+  }
+
+  void work()
+  {
+    // Frees the buffers evicted by audio thread. Slots before `resultTail` are consumed,
+    // and they hold evicted buffers.
+    size_t freed = 0;
+    auto freeEvicted = [&]() {
+      const auto consumed = resultTail.load(std::memory_order_acquire);
+      for (; freed != consumed; ++freed) {
+        std::vector<float>().swap(results[freed & mask].data);
+      }
+      return consumed;
+    };
+
+    while (isRunning.load(std::memory_order_relaxed)) {
+      const auto seen = wakeCount.load(std::memory_order_seq_cst);
+
+      const auto consumed = freeEvicted();
+      const auto head = resultHead.load(std::memory_order_relaxed);
+      const auto tail = requestTail.load(std::memory_order_relaxed);
+      const bool hasRequest = tail != requestHead.load(std::memory_order_acquire);
+      if (hasRequest && head - consumed < queueSize) {
+        auto &slot = requests[tail & mask];
+        auto data = render(slot.request, isRunning);
+        if (!isRunning.load(std::memory_order_relaxed)) return;
+
+        // Result is published before releasing the request slot. So all requests are
+        // finished when `requestTail` reaches `requestHead`.
+        auto &result = results[head & mask];
+        result.key = slot.key;
+        result.data = std::move(data);
+        resultHead.store(head + 1, std::memory_order_release);
+        requestTail.store(tail + 1, std::memory_order_release);
+        continue;
+      }
+
+      // A wake after this store either posts, or changes `wakeCount` before the check.
+      isParked.store(true, std::memory_order_seq_cst);
+      if (wakeCount.load(std::memory_order_seq_cst) == seen
+          && isRunning.load(std::memory_order_relaxed))
+        semaphore.wait();
+      isParked.store(false, std::memory_order_relaxed);
+    }
+  }
+};
+
+} // namespace SomeDSP
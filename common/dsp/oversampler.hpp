@@ -0,0 +1,600 @@
+// (c) 2020 Takamitsu Endo
+//
+// This file is part of Uhhyou Plugins.
+//
+// Uhhyou Plugins is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Uhhyou Plugins is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Uhhyou Plugins.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "../../lib/vcl/vectorclass.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace SomeDSP {
+
+/**
+Coefficients of half-band lowpass. `HalfBandSharp` is used for 1x <-> 2x stage.
+`HalfBandWide` is used for later stages, which only have to keep the band below the
+original Nyquist frequency. Both have about 100 dB of stopband attenuation.
+
+`iir` is for polyphase allpass form of HIIR by Laurent de Soras. Computed by
+`hiir::PolyphaseIir2Designer::compute_coefs_spec_order_tbw()` with (order, transition
+bandwidth) of (8, 0.04) and (6, 0.125).
+
+`fir` is Kaiser windowed half-band. Only even indices are stored. Odd indices are 0,
+except the center which is 0.5.
+
+```python
+import numpy
+from scipy import signal
+
+def halfband(K, beta): # (K, beta) is (24, 10) and (8, 11).
+    N = 4 * K - 1
+    m = numpy.arange(N) - (2 * K - 1)
+    fir = numpy.sinc(m / 2) / 2 * signal.windows.kaiser(N, beta)
+    fir[2 * K - 1] = 0
+    fir *= 0.5 / numpy.sum(fir)
+    return fir[::2]
+```
+*/
+struct HalfBandSharp {
+  static constexpr std::array<float, 8> iir{
+    0.0406334609f, 0.150505129f, 0.300757056f, 0.460774505f,
+    0.609524315f,  0.738503841f, 0.84922381f,  0.949742784f,
+  };
+
+  static constexpr std::array<float, 48> fir{
+    -2.40526696e-06f, 1.11862787e-05f,  -3.06770427e-05f, 6.80259044e-05f,
+    -0.000133140949f, 0.00023918429f,   -0.000403039613f, 0.000645748872f,
+    -0.000992937726f, 0.00147528772f,   -0.00212917355f,  0.00299767957f,
+    -0.00413236898f,  0.00559645814f,   -0.00747057427f,  0.00986333697f,
+    -0.012931323f,    0.0169184896f,    -0.0222396699f,   0.0296763749f,
+    -0.0409089654f,   0.0603261149f,    -0.104070679f,    0.317627067f,
+    0.317627067f,     -0.104070679f,    0.0603261149f,    -0.0409089654f,
+    0.0296763749f,    -0.0222396699f,   0.0169184896f,    -0.012931323f,
+    0.00986333697f,   -0.00747057427f,  0.00559645814f,   -0.00413236898f,
+    0.00299767957f,   -0.00212917355f,  0.00147528772f,   -0.000992937726f,
+    0.000645748872f,  -0.000403039613f, 0.00023918429f,   -0.000133140949f,
+    6.80259044e-05f,  -3.06770427e-05f, 1.11862787e-05f,  -2.40526696e-06f,
+  };
+};
+
+struct HalfBandWide {
+  static constexpr std::array<float, 6> iir{
+    0.033549102f, 0.128269005f, 0.269741311f, 0.442899874f, 0.640098604f, 0.867526713f,
+  };
+
+  static constexpr std::array<float, 16> fir{
+    -2.91152721e-06f, 0.00014185346f, -0.00104364085f, 0.00439542254f,
+    -0.0135846538f,   0.034977234f,   -0.0858526166f,  0.310969313f,
+    0.310969313f,     -0.0858526166f, 0.034977234f,    -0.0135846538f,
+    0.00439542254f,   -0.00104364085f, 0.00014185346f, -2.91152721e-06f,
+  };
+};
+
+/**
+2x up or down sampling of 2 channels with polyphase allpass half-band IIR. Lanes are
+[ch0 path0, ch0 path1, ch1 path0, ch1 path1], so 2 paths of 2 channels run at once.
+
+Use different instances for upsampling and downsampling.
+*/
+template<typename Coefficient> class HalfBandIIR {
+public:
+  static constexpr size_t nSection = Coefficient::iir.size() / 2;
+
+  HalfBandIIR()
+  {
+    for (size_t i = 0; i < nSection; ++i) {
+      const auto &c = Coefficient::iir;
+      co[i] = Vec4f(c[2 * i], c[2 * i + 1], c[2 * i], c[2 * i + 1]);
+    }
+  }
+
+  // Delay of a pair of upsampler and downsampler at DC, in samples of higher rate.
+  static float delay()
+  {
+    float sum = 0;
+    for (const auto &c : Coefficient::iir) sum += (1.0f - c) / (1.0f + c);
+    return 2.0f * sum;
+  }
+
+  void reset() { state.fill(0); }
+
+  // Outputs 2 samples per channel, in time order.
+  void upsample(float in0, float in1, float *out0, float *out1)
+  {
+    Vec4f y = process(Vec4f(in0, in0, in1, in1));
+    out0[0] = y[0];
+    out0[1] = y[1];
+    out1[0] = y[2];
+    out1[1] = y[3];
+  }
+
+  // Inputs are 2 samples per channel, in time order.
+  void downsample(const float *in0, const float *in1, float &out0, float &out1)
+  {
+    Vec4f y = process(Vec4f(in0[1], in0[0], in1[1], in1[0]));
+    out0 = 0.5f * (y[0] + y[1]);
+    out1 = 0.5f * (y[2] + y[3]);
+  }
+
+private:
+  std::array<Vec4f, nSection> co;
+
+  // state[i] is the last input of section i, and also the last output of section i - 1.
+  std::array<Vec4f, nSection + 1> state{};
+
+  Vec4f process(Vec4f x)
+  {
+    for (size_t i = 0; i < nSection; ++i) {
+      Vec4f y = mul_add(x - state[i + 1], co[i], state[i]);
+      state[i] = x;
+      x = y;
+    }
+    state[nSection] = x;
+    return x;
+  }
+};
+
+// Holds the last `length` inputs. `data()` returns them contiguous, oldest first.
+template<typename T, size_t length> class HalfBandHistory {
+public:
+  void reset()
+  {
+    wptr = 0;
+    buf.fill(T(0.0f));
+  }
+
+  void push(T x)
+  {
+    if (++wptr >= length) wptr = 0;
+    buf[wptr] = x;
+    buf[wptr + length] = x;
+  }
+
+  const T *data() const { return buf.data() + wptr + 1; }
+
+  template<typename Mask> void reset(const Mask &lanes)
+  {
+    for (auto &value : buf) value = select(lanes, T(0.0f), value);
+  }
+
+private:
+  size_t wptr = 0;
+  std::array<T, 2 * length> buf{};
+};
+
+/**
+2x up or down sampling of 2 channels with linear phase half-band FIR. Only the non-zero
+taps are computed, and each of them is computed with `Vec8f`.
+
+Use different instances for upsampling and downsampling.
+*/
+template<typename Coefficient> class HalfBandFIR {
+public:
+  static constexpr size_t nTap = Coefficient::fir.size();
+  static_assert(nTap % 8 == 0, "Number of taps must be a multiple of 8.");
+
+  // Delay of a pair of upsampler and downsampler, in samples of higher rate. Center of
+  // full length FIR is at `nTap - 1`, and a pair takes the latest of 2 samples.
+  static float delay() { return float(2 * nTap - 3); }
+
+  void reset()
+  {
+    for (auto &hist : history) hist.reset();
+    for (auto &hist : center) hist.reset();
+  }
+
+  void upsample(float in0, float in1, float *out0, float *out1)
+  {
+    upsample(history[0], in0, out0);
+    upsample(history[1], in1, out1);
+  }
+
+  void downsample(const float *in0, const float *in1, float &out0, float &out1)
+  {
+    out0 = downsample(history[0], center[0], in0);
+    out1 = downsample(history[1], center[1], in1);
+  }
+
+private:
+  using History = HalfBandHistory<float, nTap>;
+
+  std::array<History, 2> history;
+  std::array<History, 2> center;
+
+  static float convolve(const float *x)
+  {
+    Vec8f sum = 0;
+    Vec8f sig;
+    Vec8f coefficient;
+    for (size_t i = 0; i < nTap; i += 8) {
+      sig.load(x + i);
+      coefficient.load(Coefficient::fir.data() + i);
+      sum = mul_add(sig, coefficient, sum);
+    }
+    return horizontal_add(sum);
+  }
+
+  void upsample(History &hist, float input, float *output)
+  {
+    hist.push(input);
+    output[0] = 2.0f * convolve(hist.data());
+    output[1] = hist.data()[nTap / 2];
+  }
+
+  float downsample(History &hist, History &even, const float *input)
+  {
+    even.push(input[0]);
+    hist.push(input[1]);
+    return convolve(hist.data()) + 0.5f * even.data()[nTap / 2];
+  }
+};
+
+/**
+Up to 16x oversampler of 2 channels, made from cascaded 2x half-band stages.
+
+Usage:
+
+```
+oversampler.upsample(in0, in1);
+for (size_t i = 0; i < oversampler.factor(); ++i) {
+  oversampler.buffer[0][i] = shape(oversampler.buffer[0][i]);
+  oversampler.buffer[1][i] = shape(oversampler.buffer[1][i]);
+}
+auto out = oversampler.downsample();
+```
+
+Minimum phase mode uses IIR, and has a few samples of latency. Linear phase mode uses
+FIR, and has about 60 samples of latency at 16x.
+*/
+class Oversampler {
+public:
+  static constexpr size_t maxStage = 4;
+  static constexpr size_t maxFactor = size_t(1) << maxStage;
+
+  alignas(64) std::array<std::array<float, maxFactor>, 2> buffer{};
+
+  // factor = 2^nStage. Not realtime safe when the settings change, because of reset.
+  void setup(size_t nStage, bool linearPhase)
+  {
+    nStage = std::min(nStage, maxStage);
+    if (this->nStage == nStage && this->linearPhase == linearPhase) return;
+    this->nStage = nStage;
+    this->linearPhase = linearPhase;
+    reset();
+  }
+
+  void reset()
+  {
+    for (auto &buf : buffer) buf.fill(0);
+
+    iirUp0.reset();
+    iirDown0.reset();
+    for (auto &stage : iirUp) stage.reset();
+    for (auto &stage : iirDown) stage.reset();
+
+    firUp0.reset();
+    firDown0.reset();
+    for (auto &stage : firUp) stage.reset();
+    for (auto &stage : firDown) stage.reset();
+  }
+
+  size_t factor() const { return size_t(1) << nStage; }
+
+  // Rounded group delay at DC, in samples of original rate.
+  uint32_t getLatency() const { return latency(nStage, linearPhase); }
+
+  static uint32_t latency(size_t nStage, bool linearPhase)
+  {
+    if (nStage == 0) return 0;
+
+    float latency = linearPhase ? HalfBandFIR<HalfBandSharp>::delay()
+                                : HalfBandIIR<HalfBandSharp>::delay();
+    float laterDelay = linearPhase ? HalfBandFIR<HalfBandWide>::delay()
+                                   : HalfBandIIR<HalfBandWide>::delay();
+    latency /= 2;
+    for (size_t stage = 1; stage < nStage; ++stage)
+      latency += laterDelay / float(size_t(2) << stage);
+    return uint32_t(latency + 0.5f);
+  }
+
+  // Fills `buffer[channel][0]` to `buffer[channel][factor() - 1]`.
+  void upsample(float in0, float in1)
+  {
+    if (linearPhase)
+      upsample(firUp0, firUp, in0, in1);
+    else
+      upsample(iirUp0, iirUp, in0, in1);
+  }
+
+  // Reads `buffer[channel][0]` to `buffer[channel][factor() - 1]`. Filters are reset when
+  // output is not finite.
+  std::array<float, 2> downsample()
+  {
+    auto output
+      = linearPhase ? downsample(firDown0, firDown) : downsample(iirDown0, iirDown);
+    if (std::isfinite(output[0]) && std::isfinite(output[1])) return output;
+
+    reset();
+    return {0, 0};
+  }
+
+private:
+  size_t nStage = 0;
+  bool linearPhase = false;
+
+  HalfBandIIR<HalfBandSharp> iirUp0;
+  HalfBandIIR<HalfBandSharp> iirDown0;
+  std::array<HalfBandIIR<HalfBandWide>, maxStage - 1> iirUp;
+  std::array<HalfBandIIR<HalfBandWide>, maxStage - 1> iirDown;
+
+  HalfBandFIR<HalfBandSharp> firUp0;
+  HalfBandFIR<HalfBandSharp> firDown0;
+  std::array<HalfBandFIR<HalfBandWide>, maxStage - 1> firUp;
+  std::array<HalfBandFIR<HalfBandWide>, maxStage - 1> firDown;
+
+  template<typename First, typename Later>
+  void upsample(First &first, Later &later, float in0, float in1)
+  {
+    if (nStage == 0) {
+      buffer[0][0] = in0;
+      buffer[1][0] = in1;
+      return;
+    }
+
+    first.upsample(in0, in1, buffer[0].data(), buffer[1].data());
+
+    std::array<std::array<float, maxFactor / 2>, 2> tmp;
+    for (size_t stage = 1; stage < nStage; ++stage) {
+      const size_t length = size_t(1) << stage;
+      std::copy(buffer[0].begin(), buffer[0].begin() + length, tmp[0].begin());
+      std::copy(buffer[1].begin(), buffer[1].begin() + length, tmp[1].begin());
+      for (size_t i = 0; i < length; ++i) {
+        later[stage - 1].upsample(
+          tmp[0][i], tmp[1][i], buffer[0].data() + 2 * i, buffer[1].data() + 2 * i);
+      }
+    }
+  }
+
+  template<typename First, typename Later>
+  std::array<float, 2> downsample(First &first, Later &later)
+  {
+    if (nStage == 0) return {buffer[0][0], buffer[1][0]};
+
+    // In-place. buffer[ch][i] is written after buffer[ch][2 * i] is read.
+    for (size_t stage = nStage - 1; stage >= 1; --stage) {
+      const size_t length = size_t(1) << stage;
+      for (size_t i = 0; i < length; ++i) {
+        later[stage - 1].downsample(
+          buffer[0].data() + 2 * i, buffer[1].data() + 2 * i, buffer[0][i],
+          buffer[1][i]);
+      }
+    }
+
+    std::array<float, 2> output;
+    first.downsample(buffer[0].data(), buffer[1].data(), output[0], output[1]);
+    return output;
+  }
+};
+
+/**
+2x up or down sampling with polyphase allpass half-band IIR. Each lane of `Vec` is an
+independent stream, and 2 paths are computed one after another.
+*/
+template<typename Coefficient, typename Vec> class HalfBandIIRLane {
+public:
+  static constexpr size_t nSection = Coefficient::iir.size() / 2;
+
+  void reset()
+  {
+    for (auto &st : state) st.fill(Vec(0.0f));
+  }
+
+  template<typename Mask> void reset(const Mask &lanes)
+  {
+    for (auto &st : state)
+      for (auto &value : st) value = select(lanes, Vec(0.0f), value);
+  }
+
+  void upsample(Vec input, Vec *output)
+  {
+    output[0] = process<0>(input);
+    output[1] = process<1>(input);
+  }
+
+  Vec downsample(const Vec *input)
+  {
+    return 0.5f * (process<0>(input[1]) + process<1>(input[0]));
+  }
+
+private:
+  std::array<std::array<Vec, nSection + 1>, 2> state{};
+
+  template<size_t path> Vec process(Vec x)
+  {
+    auto &st = state[path];
+    for (size_t i = 0; i < nSection; ++i) {
+      Vec y = mul_add(x - st[i + 1], Vec(Coefficient::iir[2 * i + path]), st[i]);
+      st[i] = x;
+      x = y;
+    }
+    st[nSection] = x;
+    return x;
+  }
+};
+
+/**
+2x up or down sampling with linear phase half-band FIR. Each lane of `Vec` is an
+independent stream.
+*/
+template<typename Coefficient, typename Vec> class HalfBandFIRLane {
+public:
+  static constexpr size_t nTap = Coefficient::fir.size();
+
+  void reset()
+  {
+    history.reset();
+    center.reset();
+  }
+
+  template<typename Mask> void reset(const Mask &lanes)
+  {
+    history.reset(lanes);
+    center.reset(lanes);
+  }
+
+  void upsample(Vec input, Vec *output)
+  {
+    history.push(input);
+    output[0] = 2.0f * convolve(history.data());
+    output[1] = history.data()[nTap / 2];
+  }
+
+  Vec downsample(const Vec *input)
+  {
+    center.push(input[0]);
+    history.push(input[1]);
+    return convolve(history.data()) + 0.5f * center.data()[nTap / 2];
+  }
+
+private:
+  HalfBandHistory<Vec, nTap> history;
+  HalfBandHistory<Vec, nTap> center;
+
+  static Vec convolve(const Vec *x)
+  {
+    Vec sum(0.0f);
+    for (size_t i = 0; i < nTap; ++i) sum = mul_add(x[i], Vec(Coefficient::fir[i]), sum);
+    return sum;
+  }
+};
+
+/**
+Same as `Oversampler`, but each lane of `Vec` is an independent stream. Used to batch
+instances of a plugin. All lanes share the same factor and phase setting.
+
+`buffer[i]` holds i-th sample of higher rate for all lanes.
+*/
+template<typename Vec> class LaneOversampler {
+public:
+  static constexpr size_t maxStage = Oversampler::maxStage;
+  static constexpr size_t maxFactor = Oversampler::maxFactor;
+
+  std::array<Vec, maxFactor> buffer{};
+
+  // Not realtime safe when the settings change, because of reset.
+  void setup(size_t nStage, bool linearPhase)
+  {
+    nStage = std::min(nStage, maxStage);
+    if (this->nStage == nStage && this->linearPhase == linearPhase) return;
+    this->nStage = nStage;
+    this->linearPhase = linearPhase;
+    reset();
+  }
+
+  void reset()
+  {
+    buffer.fill(Vec(0.0f));
+    forEachFilter([](auto &filter) { filter.reset(); });
+  }
+
+  size_t factor() const { return size_t(1) << nStage; }
+  uint32_t getLatency() const { return Oversampler::latency(nStage, linearPhase); }
+
+  void upsample(Vec input)
+  {
+    if (linearPhase)
+      upsample(firUp0, firUp, input);
+    else
+      upsample(iirUp0, iirUp, input);
+  }
+
+  // Only the lanes with non-finite output are reset, and output 0.
+  Vec downsample()
+  {
+    Vec output
+      = linearPhase ? downsample(firDown0, firDown) : downsample(iirDown0, iirDown);
+
+    auto isFinite = is_finite(output);
+    if (horizontal_and(isFinite)) return output;
+
+    auto lanes = !isFinite;
+    forEachFilter([&](auto &filter) { filter.reset(lanes); });
+    return select(isFinite, output, Vec(0.0f));
+  }
+
+private:
+  size_t nStage = 0;
+  bool linearPhase = false;
+
+  HalfBandIIRLane<HalfBandSharp, Vec> iirUp0;
+  HalfBandIIRLane<HalfBandSharp, Vec> iirDown0;
+  std::array<HalfBandIIRLane<HalfBandWide, Vec>, maxStage - 1> iirUp;
+  std::array<HalfBandIIRLane<HalfBandWide, Vec>, maxStage - 1> iirDown;
+
+  HalfBandFIRLane<HalfBandSharp, Vec> firUp0;
+  HalfBandFIRLane<HalfBandSharp, Vec> firDown0;
+  std::array<HalfBandFIRLane<HalfBandWide, Vec>, maxStage - 1> firUp;
+  std::array<HalfBandFIRLane<HalfBandWide, Vec>, maxStage - 1> firDown;
+
+  template<typename Func> void forEachFilter(Func func)
+  {
+    func(iirUp0);
+    func(iirDown0);
+    for (auto &stage : iirUp) func(stage);
+    for (auto &stage : iirDown) func(stage);
+
+    func(firUp0);
+    func(firDown0);
+    for (auto &stage : firUp) func(stage);
+    for (auto &stage : firDown) func(stage);
+  }
+
+  template<typename First, typename Later>
+  void upsample(First &first, Later &later, Vec input)
+  {
+    if (nStage == 0) {
+      buffer[0] = input;
+      return;
+    }
+
+    first.upsample(input, buffer.data());
+
+    std::array<Vec, maxFactor / 2> tmp;
+    for (size_t stage = 1; stage < nStage; ++stage) {
+      const size_t length = size_t(1) << stage;
+      std::copy(buffer.begin(), buffer.begin() + length, tmp.begin());
+      for (size_t i = 0; i < length; ++i)
+        later[stage - 1].upsample(tmp[i], buffer.data() + 2 * i);
+    }
+  }
+
+  template<typename First, typename Later> Vec downsample(First &first, Later &later)
+  {
+    if (nStage == 0) return buffer[0];
+
+    for (size_t stage = nStage - 1; stage >= 1; --stage) {
+      const size_t length = size_t(1) << stage;
+      for (size_t i = 0; i < length; ++i)
+        buffer[i] = later[stage - 1].downsample(buffer.data() + 2 * i);
+    }
+    return first.downsample(buffer.data());
+  }
+};
+
+} // namespace SomeDSP
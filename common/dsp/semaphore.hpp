@@ -0,0 +1,63 @@
+// (c) 2020 Takamitsu Endo
+//
+// This file is part of Uhhyou Plugins.
+//
+// Uhhyou Plugins is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Uhhyou Plugins is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Uhhyou Plugins.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#if defined(__APPLE__)
+  #include <dispatch/dispatch.h>
+#else
+  #include <cerrno>
+  #include <semaphore.h>
+#endif
+
+namespace SomeDSP {
+
+/**
+Counting semaphore to wake a worker thread from audio thread. `post()` doesn't take a
+lock, and it only makes a system call when a thread is waiting.
+*/
+class Semaphore {
+public:
+#if defined(__APPLE__)
+  Semaphore() : semaphore(dispatch_semaphore_create(0)) {}
+  ~Semaphore() { dispatch_release(semaphore); }
+
+  void post() { dispatch_semaphore_signal(semaphore); }
+  void wait() { dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER); }
+#else
+  Semaphore() { sem_init(&semaphore, 0, 0); }
+  ~Semaphore() { sem_destroy(&semaphore); }
+
+  void post() { sem_post(&semaphore); }
+  void wait()
+  {
+    while (sem_wait(&semaphore) != 0 && errno == EINTR) continue;
+  }
+#endif
+
+  Semaphore(const Semaphore &) = delete;
+  Semaphore &operator=(const Semaphore &) = delete;
+
+private:
+#if defined(__APPLE__)
+  dispatch_semaphore_t semaphore;
+#else
+  sem_t semaphore;
+#endif
+};
+
+} // namespace SomeDSP
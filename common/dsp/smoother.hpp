@@ -63,57 +63,119 @@ private:
   Vec16f value = 0;
 };
 
+/**
+Smoothing time and buffer size shared by the smoothers of a DSPCore. Each DSPCore owns
+one, so instances running on different threads don't write to the same memory.
+
+Smoothers take it on `push()`. ExpSmoother family copies `kp` at that time.
+*/
 template<typename Sample> class SmootherCommon {
 public:
-  static void setSampleRate(Sample _sampleRate, Sample time = 0.04)
+  void setSampleRate(Sample sampleRate, Sample time = 0.04)
   {
-    sampleRate = _sampleRate;
+    this->sampleRate = sampleRate;
     setTime(time);
   }
 
-  static void setTime(Sample seconds)
+  void setTime(Sample seconds)
   {
     timeInSamples = seconds * sampleRate;
     kp = PController<double>::cutoffToP(
       sampleRate, std::clamp<double>(1.0 / seconds, 0.0, sampleRate / 2.0));
   }
-  static void setBufferSize(Sample _bufferSize) { bufferSize = _bufferSize; }
 
-  static Sample sampleRate;
-  static Sample timeInSamples;
-  static Sample kp;
-  static Sample bufferSize;
-};
+  void setBufferSize(Sample bufferSize) { this->bufferSize = bufferSize; }
 
-template<typename Sample> Sample SmootherCommon<Sample>::sampleRate = 44100.0;
-template<typename Sample> Sample SmootherCommon<Sample>::timeInSamples = 0.0;
-template<typename Sample> Sample SmootherCommon<Sample>::kp = 1.0;
-template<typename Sample> Sample SmootherCommon<Sample>::bufferSize = 44100.0;
+  Sample sampleRate = 44100.0;
+  Sample timeInSamples = 0.0;
+  Sample kp = 1.0;
+  Sample bufferSize = 44100.0;
+};
 
 template<typename Sample> class ExpSmoother {
 public:
   Sample value = 0;
   Sample target = 0;
+  Sample kp = 1;
 
   inline Sample getValue() { return value; }
   void reset(Sample value = 0) { this->value = value; }
-  void push(Sample newTarget) { target = newTarget; }
-  Sample process() { return value += SmootherCommon<Sample>::kp * (target - value); }
+
+  void push(const SmootherCommon<Sample> &common, Sample newTarget)
+  {
+    target = newTarget;
+    kp = common.kp;
+  }
+
+  Sample process() { return value += kp * (target - value); }
 };
 
 class alignas(64) ExpSmoother16 {
 public:
   Vec16f value = 0.0f;
   Vec16f target = 0.0f;
+  float kp = 1.0f;
 
   inline Vec16f getValue() { return value; }
   inline float getValue(int index) { return value[index]; }
   void reset(float value = 0.0f) { this->value = value; }
   void reset(Vec16f value = 0.0f) { this->value = value; }
   void reset(int index, float value = 0.0f) { this->value.insert(index, value); }
-  void push(Vec16f newTarget) { target = newTarget; }
+
+  void push(const SmootherCommon<float> &common, Vec16f newTarget)
+  {
+    target = newTarget;
+    kp = common.kp;
+  }
+
+  void push(const SmootherCommon<float> &common, int index, float newTarget)
+  {
+    target.insert(index, newTarget);
+    kp = common.kp;
+  }
+
+  Vec16f process() { return value += kp * (target - value); }
+};
+
+// Typically used to smooth a pair of left and right values in lane 0 and 1.
+class alignas(16) ExpSmoother4 {
+public:
+  Vec4f value = 0.0f;
+  Vec4f target = 0.0f;
+  float kp = 1.0f;
+
+  inline Vec4f getValue() { return value; }
+  void reset(Vec4f value = 0.0f) { this->value = value; }
+
+  void push(const SmootherCommon<float> &common, Vec4f newTarget)
+  {
+    target = newTarget;
+    kp = common.kp;
+  }
+
+  Vec4f process() { return value += kp * (target - value); }
+};
+
+// Each lane has its own smoothing time. Used to batch independent instances in lanes.
+template<typename Vec> class ExpSmootherLane {
+public:
+  Vec kp = 1.0f; // In [0, 1].
+  Vec value = 0.0f;
+  Vec target = 0.0f;
+
+  void setTime(int index, float sampleRate, float seconds)
+  {
+    kp.insert(
+      index,
+      float(PController<double>::cutoffToP(
+        sampleRate, std::clamp<double>(1.0 / seconds, 0.0, sampleRate / 2.0))));
+  }
+
+  inline Vec getValue() { return value; }
+  void reset(Vec value = 0.0f) { this->value = value; }
+  void reset(int index, float value) { this->value.insert(index, value); }
   void push(int index, float newTarget) { target.insert(index, newTarget); }
-  Vec16f process() { return value += SmootherCommon<float>::kp * (target - value); }
+  Vec process() { return value += kp * (target - value); }
 };
 
 template<typename Sample> class ExpSmootherLocal {
@@ -149,7 +211,7 @@ public:
   using Common = SmootherCommon<Sample>;
 
   inline Sample getValue() { return value; }
-  virtual void refresh() { push(target); }
+  virtual void refresh(const Common &common) { push(common, target); }
 
   void reset(Sample value)
   {
@@ -157,14 +219,14 @@ public:
     target = value;
   }
 
-  void push(Sample newTarget)
+  void push(const Common &common, Sample newTarget)
   {
     target = newTarget;
-    if (Common::timeInSamples < Common::bufferSize) {
+    if (common.timeInSamples < common.bufferSize) {
       value = target;
       ramp = 0;
     } else {
-      ramp = (target - value) / Common::timeInSamples;
+      ramp = (target - value) / common.timeInSamples;
     }
   }
 
@@ -181,6 +243,44 @@ protected:
   Sample ramp = 0.0;
 };
 
+// Lane version of LinearSmoother. Used to batch independent instances in lanes.
+template<typename Vec> class LinearSmootherLane {
+public:
+  using Common = SmootherCommon<float>;
+
+  inline Vec getValue() { return value; }
+
+  void reset(Vec value)
+  {
+    this->value = value;
+    target = value;
+    ramp = 0.0f;
+  }
+
+  void push(const Common &common, int index, float newTarget)
+  {
+    target.insert(index, newTarget);
+    if (common.timeInSamples < common.bufferSize) {
+      value.insert(index, newTarget);
+      ramp.insert(index, 0.0f);
+    } else {
+      ramp.insert(index, (newTarget - value[index]) / common.timeInSamples);
+    }
+  }
+
+  Vec process()
+  {
+    value += ramp;
+    value = select(abs(value - target) < 1e-5f, target, value);
+    return value;
+  }
+
+protected:
+  Vec value = 1.0f;
+  Vec target = 1.0f;
+  Vec ramp = 0.0f;
+};
+
 template<typename Sample> class LinearSmootherLocal {
 public:
   using Common = SmootherCommon<Sample>;
@@ -193,13 +293,13 @@ public:
 
   void setTime(Sample seconds) { timeInSamples = seconds * sampleRate; }
   void reset(Sample value) { this->value = target = value; }
-  void refresh() { push(target); }
+  void refresh(const Common &common) { push(common, target); }
   inline Sample getValue() { return value; }
 
-  void push(Sample newTarget)
+  void push(const Common &common, Sample newTarget)
   {
     target = newTarget;
-    if (timeInSamples < Common::bufferSize) {
+    if (timeInSamples < common.bufferSize) {
       value = target;
       ramp = 0;
     } else {
@@ -222,6 +322,44 @@ protected:
   Sample value = 0;
 };
 
+/**
+Linear interpolation of a value computed at control rate. Pushed target is reached after
+`nStep` calls of `process()`. When `nStep` is 1, output is exactly the pushed target.
+ */
+template<typename Sample> class ControlRamp {
+public:
+  inline Sample getValue() { return value; }
+
+  void reset(Sample value)
+  {
+    this->value = value;
+    ramp = Sample(0);
+  }
+
+  void push(Sample target, uint32_t nStep)
+  {
+    if (nStep <= 1) {
+      value = target;
+      ramp = Sample(0);
+    } else {
+      ramp = (target - value) / float(nStep);
+    }
+  }
+
+  // For vector types. Lanes where `mask` is true jump to `target`. Others keep ramping.
+  template<typename Mask> void jump(Sample target, Mask mask)
+  {
+    value = select(mask, target, value);
+    ramp = select(mask, Sample(0), ramp);
+  }
+
+  Sample process() { return value += ramp; }
+
+protected:
+  Sample value = Sample(0);
+  Sample ramp = Sample(0);
+};
+
 // Unlike LinearSmoother, value is normalized in [0, 1].
 template<typename Sample> class RotarySmoother {
 public:
@@ -229,13 +367,13 @@ public:
 
   inline Sample getValue() { return value; }
   void reset(Sample value) { this->value = value; }
-  void refresh() { push(target); }
+  void refresh(const Common &common) { push(common, target); }
   void setRange(Sample max) { this->max = max; }
 
-  void push(Sample newTarget)
+  void push(const Common &common, Sample newTarget)
   {
     this->target = newTarget;
-    if (Common::timeInSamples < Common::bufferSize) {
+    if (common.timeInSamples < common.bufferSize) {
       this->value = this->target;
       return;
     }
@@ -245,17 +383,17 @@ public:
     if (dist1 < 0) {
       auto dist2 = this->target + max - this->value;
       if (somefabs<Sample>(dist1) > dist2) {
-        this->ramp = dist2 / Common::timeInSamples;
+        this->ramp = dist2 / common.timeInSamples;
         return;
       }
     } else {
       auto dist2 = this->target - max - this->value;
       if (dist1 > somefabs<Sample>(dist2)) {
-        this->ramp = dist2 / Common::timeInSamples;
+        this->ramp = dist2 / common.timeInSamples;
         return;
       }
     }
-    this->ramp = dist1 / Common::timeInSamples;
+    this->ramp = dist1 / common.timeInSamples;
   }
 
   Sample process()
@@ -0,0 +1,359 @@
+// (c) 2020 Takamitsu Endo
+//
+// This file is part of Uhhyou Plugins.
+//
+// Uhhyou Plugins is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Uhhyou Plugins is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Uhhyou Plugins.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "semaphore.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <pthread.h>
+  #include <sched.h>
+#endif
+
+namespace SomeDSP {
+
+/**
+Process-wide pool of worker threads to render voices in parallel. Shared by all plugin
+instances in the process. Workers are started by the first `start()`, which plugins call
+from `setup()` because it's not called on audio thread.
+
+`run()` is called from audio thread. It takes one of a few job slots, and publishes the
+tasks in it. Each task has its own state word, and a task is claimed by compare-and-swap
+on it. Audio thread claims tasks too, so all tasks not started by workers are rendered
+inline on audio thread. This includes the case that no worker wakes up in time, or all
+workers are busy with jobs of other instances.
+
+Workers don't touch voices. Before publishing, audio thread copies the state of each
+voice to a snapshot. Worker renders the snapshot, and audio thread commits it to the voice
+after the worker has finished. A worker which hasn't finished at the deadline is
+abandoned, and audio thread renders the voice inline from its unchanged state. So `run()`
+waits for workers at most until the deadline, even if a worker is preempted. While an
+abandoned worker is still rendering, `run()` of the same instance renders all tasks
+inline, so the snapshots aren't overwritten.
+
+Idle workers wait on a semaphore. Audio thread posts it to wake them, without a lock.
+Realtime priority for workers is requested, but it's best effort.
+
+Each task must write to its own output. Caller sums the outputs in a fixed order, so the
+result is the same regardless of which thread ran which task.
+*/
+class VoicePool {
+public:
+  struct Task {
+    // Renders voice `index` in place. Called on audio thread.
+    void (*render)(void *context, uint32_t index);
+
+    // Copies voice `index` and the inputs of this block to snapshot `index`. Called on
+    // audio thread before the task is published.
+    void (*snapshot)(void *context, uint32_t index);
+
+    // Renders snapshot `index`. Called on worker. It must not change anything outside of
+    // the snapshot.
+    void (*renderSnapshot)(void *context, uint32_t index);
+
+    // Moves snapshot `index` to voice `index`. Called on audio thread.
+    void (*commit)(void *context, uint32_t index);
+  };
+
+  static constexpr uint32_t maxTask = 64;
+
+  static VoicePool &instance()
+  {
+    static VoicePool pool;
+    return pool;
+  }
+
+  VoicePool(const VoicePool &) = delete;
+  VoicePool &operator=(const VoicePool &) = delete;
+  ~VoicePool() { stop(); }
+
+  // Not realtime safe. Later calls only load a flag.
+  void start()
+  {
+    if (isStarted.load(std::memory_order_acquire)) return;
+
+    std::lock_guard<std::mutex> lock(startMutex);
+    if (isStarted.load(std::memory_order_relaxed)) return;
+
+    isRunning.store(true);
+    const auto nThread = defaultThreadCount();
+    for (size_t i = 0; i < nThread; ++i) workers.emplace_back([this]() { work(); });
+    isStarted.store(true, std::memory_order_release);
+  }
+
+  // Not realtime safe. Waits for abandoned workers still rendering snapshots of
+  // `context`. Call before freeing the snapshots.
+  void detach(void *context)
+  {
+    while (isLate(context)) std::this_thread::yield();
+  }
+
+  // Renders all tasks on calling thread when `isParallel` is false.
+  static void render(
+    bool isParallel, const Task &task, void *context, uint32_t nTask, float timeout)
+  {
+    if (isParallel) {
+      instance().run(task, context, nTask, timeout);
+      return;
+    }
+    for (uint32_t index = 0; index < nTask; ++index) task.render(context, index);
+  }
+
+  /**
+  Realtime safe. Returns after all tasks are rendered. Workers which haven't finished
+  `timeout` seconds after the call are abandoned, and their tasks are rendered inline.
+  */
+  void run(const Task &task, void *context, uint32_t nTask, float timeout)
+  {
+    const auto deadline = Clock::now() + toDuration(timeout);
+
+    Job *job = nullptr;
+    if (nTask >= 2 && nTask <= maxTask && isStarted.load(std::memory_order_acquire)
+        && !workers.empty() && !isLate(context))
+      job = acquireJob();
+    if (job == nullptr) {
+      for (uint32_t index = 0; index < nTask; ++index) task.render(context, index);
+      return;
+    }
+
+    for (uint32_t index = 0; index < nTask; ++index) task.snapshot(context, index);
+
+    const uint32_t epoch = job->epoch = (job->epoch + 1) & epochMask;
+    job->task.store(&task, std::memory_order_relaxed);
+    job->context.store(context, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < nTask; ++i)
+      job->status[i].store(taskState(epoch, pending), std::memory_order_relaxed);
+    job->header.store((epoch << 8) | nTask, std::memory_order_seq_cst);
+    wake(nTask - 1);
+
+    for (uint32_t index = 0; index < nTask; ++index) {
+      auto expected = taskState(epoch, pending);
+      if (job->status[index].compare_exchange_strong(
+            expected, taskState(epoch, done), std::memory_order_acq_rel,
+            std::memory_order_relaxed))
+        task.render(context, index);
+    }
+
+    // Commits snapshots rendered by workers, until all are committed or deadline.
+    while (true) {
+      bool isWaiting = false;
+      for (uint32_t index = 0; index < nTask; ++index) {
+        auto &status = job->status[index];
+        const auto state = status.load(std::memory_order_acquire);
+        if (state == taskState(epoch, rendered)) {
+          task.commit(context, index);
+          status.store(taskState(epoch, done), std::memory_order_relaxed);
+        } else if (state == taskState(epoch, running)) {
+          isWaiting = true;
+        }
+      }
+      if (!isWaiting) break;
+
+      if (Clock::now() < deadline) {
+        std::this_thread::yield();
+        continue;
+      }
+
+      for (uint32_t index = 0; index < nTask; ++index) {
+        auto &status = job->status[index];
+        auto expected = taskState(epoch, running);
+        if (status.compare_exchange_strong(
+              expected, taskState(epoch, abandoned), std::memory_order_acq_rel,
+              std::memory_order_acquire)) {
+          task.render(context, index);
+        } else if (expected == taskState(epoch, rendered)) {
+          task.commit(context, index);
+          status.store(taskState(epoch, done), std::memory_order_relaxed);
+        }
+      }
+      break;
+    }
+
+    job->header.store(0, std::memory_order_relaxed);
+    job->isBusy.store(false, std::memory_order_release);
+  }
+
+protected:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr size_t nJob = 8;
+  static constexpr uint32_t epochMask = 0xffffff;
+
+  enum TaskState : uint32_t { pending, running, rendered, abandoned, done };
+
+  struct alignas(64) Job {
+    std::atomic<bool> isBusy{false}; // Owned by an audio thread.
+    uint32_t epoch = 0;              // Only touched by the owner.
+
+    // Bits are [epoch:24][nTask:8]. nTask is 0 when idle.
+    std::atomic<uint32_t> header{0};
+    std::atomic<const Task *> task{nullptr};
+    std::atomic<void *> context{nullptr};
+
+    // Number of workers in tasks of this job. It may be non-zero after `run()` returns,
+    // while abandoned workers are still rendering.
+    std::atomic<uint32_t> nInside{0};
+
+    // Bits are [epoch:24][TaskState:3]. Epoch makes a claim fail when the slot is reused.
+    std::array<std::atomic<uint32_t>, maxTask> status{};
+  };
+
+  VoicePool() = default;
+
+  // Half of hardware threads are left for host and other plugins.
+  static size_t defaultThreadCount()
+  {
+    const size_t nHardware = std::thread::hardware_concurrency();
+    if (nHardware <= 1) return 0;
+    return std::min<size_t>(std::max<size_t>(nHardware / 2, 1), maxTask - 1);
+  }
+
+  static Clock::duration toDuration(float seconds)
+  {
+    return std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<float>(seconds));
+  }
+
+  static uint32_t taskState(uint32_t epoch, TaskState state)
+  {
+    return (epoch << 3) | state;
+  }
+
+  std::mutex startMutex;
+  std::atomic<bool> isStarted{false};
+  std::atomic<bool> isRunning{false};
+  std::vector<std::thread> workers;
+
+  std::array<Job, nJob> jobs;
+
+  Semaphore semaphore;
+  std::atomic<uint32_t> nParked{0};
+
+  // Not realtime safe.
+  void stop()
+  {
+    isRunning.store(false);
+    for (size_t i = 0; i < workers.size(); ++i) semaphore.post();
+    for (auto &worker : workers) worker.join();
+    workers.clear();
+    isStarted.store(false);
+  }
+
+  bool isLate(void *context)
+  {
+    for (auto &job : jobs) {
+      if (job.nInside.load(std::memory_order_acquire) > 0
+          && job.context.load(std::memory_order_relaxed) == context)
+        return true;
+    }
+    return false;
+  }
+
+  // A job with abandoned workers is not reused until they leave.
+  Job *acquireJob()
+  {
+    for (auto &job : jobs) {
+      bool isBusy = false;
+      if (!job.isBusy.compare_exchange_strong(
+            isBusy, true, std::memory_order_acquire, std::memory_order_relaxed))
+        continue;
+      if (job.nInside.load(std::memory_order_acquire) == 0) return &job;
+      job.isBusy.store(false, std::memory_order_release);
+    }
+    return nullptr;
+  }
+
+  void wake(uint32_t nWake)
+  {
+    const auto nSleeper = nParked.load(std::memory_order_seq_cst);
+    for (uint32_t i = 0; i < std::min(nWake, nSleeper); ++i) semaphore.post();
+  }
+
+  // Returns true when a task is run.
+  bool runAnyTask()
+  {
+    bool isRun = false;
+    for (auto &job : jobs) {
+      const auto header = job.header.load(std::memory_order_seq_cst);
+      const uint32_t nTask = header & 0xff;
+      if (nTask == 0) continue;
+      const uint32_t epoch = header >> 8;
+
+      // These may belong to a newer job. In that case the claim fails.
+      const auto task = job.task.load(std::memory_order_relaxed);
+      const auto context = job.context.load(std::memory_order_relaxed);
+
+      job.nInside.fetch_add(1, std::memory_order_seq_cst);
+      for (uint32_t index = 0; index < nTask; ++index) {
+        auto &status = job.status[index];
+        auto expected = taskState(epoch, pending);
+        if (!status.compare_exchange_strong(
+              expected, taskState(epoch, running), std::memory_order_acq_rel,
+              std::memory_order_relaxed))
+          continue;
+
+        task->renderSnapshot(context, index);
+
+        // Fails when audio thread has abandoned this task.
+        expected = taskState(epoch, running);
+        status.compare_exchange_strong(
+          expected, taskState(epoch, rendered), std::memory_order_release,
+          std::memory_order_relaxed);
+        isRun = true;
+      }
+      job.nInside.fetch_sub(1, std::memory_order_release);
+    }
+    return isRun;
+  }
+
+  static void setRealtimePriority()
+  {
+#if defined(__unix__) || defined(__APPLE__)
+    // Failure is ignored. Worker runs with normal priority in that case, and audio
+    // thread doesn't wait for it beyond the deadline of `run()`.
+    sched_param param{};
+    param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+    pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+#endif
+  }
+
+  void work()
+  {
+    setRealtimePriority();
+
+    while (isRunning.load(std::memory_order_relaxed)) {
+      if (runAnyTask()) continue;
+
+      // A job published after this increment is either found by `runAnyTask()`, or its
+      // `wake()` sees this worker and posts.
+      nParked.fetch_add(1, std::memory_order_seq_cst);
+      if (!runAnyTask() && isRunning.load(std::memory_order_relaxed)) semaphore.wait();
+      nParked.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+};
+
+} // namespace SomeDSP
@@ -0,0 +1,264 @@
+// (c) 2020 Takamitsu Endo
+//
+// This file is part of Uhhyou Plugins.
+//
+// Uhhyou Plugins is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Uhhyou Plugins is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Uhhyou Plugins.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef TEST_BUILD
+#include "DistrhoPlugin.hpp"
+#endif
+
+#include <cstdint>
+
+#ifdef DSP_LOAD_METER
+  #include <algorithm>
+  #include <array>
+  #include <atomic>
+  #include <chrono>
+  #include <cstdlib>
+  #include <fstream>
+  #include <string>
+  #include <thread>
+#endif
+
+// Output parameters appended after `ParameterID::ID`. Values are in percent of deadline.
+namespace DSPLoadID {
+enum ID : uint32_t { current, peak, p99, ID_ENUM_LENGTH };
+} // namespace DSPLoadID
+
+#ifdef DSP_LOAD_METER
+
+struct BlockTiming {
+  uint32_t frames;
+  float sampleRate;
+  float seconds; // Elapsed time of `DSPCore::process()`.
+};
+
+/**
+Measures `DSPCore::process()` of each block, and reports it as percentage of the block
+duration. Built only with `make DSP_LOAD_METER=true`. Otherwise `DSPLoadMeter` below is
+empty, and adds no parameter.
+
+Peak and 99th percentile are taken from last `windowLength` blocks. Peak uses a monotonic
+queue, and percentile uses a histogram of 0.5% bins. So all the statistics are updated in
+amortized constant time on audio thread.
+
+When environment variable `UHHYOU_DSP_LOAD_TRACE` is set to a directory, timing of each
+block is written to `dspload-<time>-<n>.csv` in the directory. Audio thread only pushes
+to a lock-free ring, and a writer thread drains it to the file.
+*/
+class DSPLoadMeter {
+public:
+  static constexpr uint32_t nParameter = DSPLoadID::ID_ENUM_LENGTH;
+
+  using Clock = std::chrono::steady_clock;
+
+  class Probe {
+  public:
+    Probe(DSPLoadMeter &meter, uint32_t frames)
+      : meter(meter), frames(frames), start(Clock::now())
+    {
+    }
+
+    ~Probe()
+    {
+      meter.push(frames, std::chrono::duration<float>(Clock::now() - start).count());
+    }
+
+  private:
+    DSPLoadMeter &meter;
+    uint32_t frames;
+    Clock::time_point start;
+  };
+
+  DSPLoadMeter()
+  {
+    const char *dir = std::getenv("UHHYOU_DSP_LOAD_TRACE");
+    if (dir != nullptr) startTrace(dir);
+  }
+
+  DSPLoadMeter(const DSPLoadMeter &) = delete;
+  DSPLoadMeter &operator=(const DSPLoadMeter &) = delete;
+  ~DSPLoadMeter() { stopTrace(); }
+
+  // Not realtime safe.
+  void setup(double sampleRate) { this->sampleRate = float(sampleRate); }
+
+  Probe probe(uint32_t frames) { return Probe(*this, frames); }
+
+  float getParameter(uint32_t index) const
+  {
+    if (index >= nParameter) return 0.0f;
+    return parameter[index].load(std::memory_order_relaxed);
+  }
+
+#ifndef TEST_BUILD
+  static void initParameter(uint32_t index, Parameter &parameter)
+  {
+    static const char *name[] = {"dspLoad", "dspLoadPeak", "dspLoadP99"};
+    if (index >= nParameter) return;
+    parameter.name = name[index];
+    parameter.symbol = name[index];
+    parameter.unit = "%";
+    parameter.hints = kParameterIsOutput;
+    parameter.ranges.def = 0.0f;
+    parameter.ranges.min = 0.0f;
+    parameter.ranges.max = float(maxPercent);
+  }
+#endif
+
+protected:
+  static constexpr size_t windowLength = 1024;
+  static constexpr size_t traceCapacity = 4096;
+  static constexpr double maxPercent = 200.0;
+  static constexpr double binWidth = 0.5; // In percent.
+  static constexpr size_t nBin = size_t(maxPercent / binWidth) + 1;
+
+  float sampleRate = 44100.0f;
+  std::array<std::atomic<float>, nParameter> parameter{};
+
+  struct PeakCandidate {
+    size_t block;
+    float percent;
+  };
+
+  // Only touched by audio thread.
+  std::array<uint16_t, windowLength> windowBin{};
+  std::array<uint16_t, nBin> histogram{};
+  size_t windowIndex = 0;
+  size_t windowCount = 0;
+  size_t nBlock = 0;
+
+  // Ring of blocks which may become peak. Percent is decreasing from front to back.
+  std::array<PeakCandidate, windowLength> peakQueue{};
+  size_t peakFront = 0;
+  size_t peakBack = 0;
+
+  // Single producer, single consumer ring for trace.
+  std::array<BlockTiming, traceCapacity> trace;
+  alignas(64) std::atomic<size_t> traceHead{0};
+  alignas(64) std::atomic<size_t> traceTail{0};
+  std::atomic<bool> isTracing{false};
+  std::thread writer;
+
+  void push(uint32_t frames, float seconds)
+  {
+    if (frames == 0) return;
+    const float percent = 100.0f * seconds * sampleRate / frames;
+
+    // Sliding window.
+    if (windowCount >= windowLength) --histogram[windowBin[windowIndex]];
+    const auto bin = uint16_t(std::min<double>(percent / binWidth, nBin - 1));
+    windowBin[windowIndex] = bin;
+    ++histogram[bin];
+    windowIndex = (windowIndex + 1) % windowLength;
+    if (windowCount < windowLength) ++windowCount;
+
+    // Each block enters and leaves the queue at most once. The queue never overflows,
+    // because it only holds blocks in the window.
+    auto at = [&](size_t index) -> PeakCandidate & {
+      return peakQueue[index % windowLength];
+    };
+    if (peakFront != peakBack && at(peakFront).block + windowLength <= nBlock)
+      ++peakFront;
+    while (peakFront != peakBack && at(peakBack - 1).percent <= percent) --peakBack;
+    at(peakBack++) = {nBlock++, percent};
+    const float peak = at(peakFront).percent;
+
+    // Upper edge of the bin which contains 99th percentile.
+    size_t sum = 0;
+    size_t index = nBin;
+    const size_t nTail = windowCount / 100;
+    while (index > 0) {
+      sum += histogram[--index];
+      if (sum > nTail) break;
+    }
+
+    parameter[DSPLoadID::current].store(percent, std::memory_order_relaxed);
+    parameter[DSPLoadID::peak].store(peak, std::memory_order_relaxed);
+    parameter[DSPLoadID::p99].store(
+      float(std::min((index + 1) * binWidth, maxPercent)), std::memory_order_relaxed);
+
+    if (!isTracing.load(std::memory_order_relaxed)) return;
+    const auto head = traceHead.load(std::memory_order_relaxed);
+    if (head - traceTail.load(std::memory_order_acquire) >= traceCapacity) return;
+    trace[head % traceCapacity] = {frames, sampleRate, seconds};
+    traceHead.store(head + 1, std::memory_order_release);
+  }
+
+  void startTrace(std::string dir)
+  {
+    static std::atomic<uint32_t> instanceCount{0};
+    const auto time = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::system_clock::now().time_since_epoch())
+                        .count();
+    const auto path = dir + "/dspload-" + std::to_string(time) + "-"
+      + std::to_string(instanceCount.fetch_add(1)) + ".csv";
+
+    std::ofstream ofs(path);
+    if (!ofs.is_open()) return;
+    ofs << "frames,sampleRate,seconds\n";
+
+    isTracing.store(true);
+    writer = std::thread([this, ofs = std::move(ofs)]() mutable {
+      while (isTracing.load(std::memory_order_relaxed)) {
+        drainTrace(ofs);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      }
+      drainTrace(ofs);
+    });
+  }
+
+  void stopTrace()
+  {
+    isTracing.store(false);
+    if (writer.joinable()) writer.join();
+  }
+
+  void drainTrace(std::ofstream &ofs)
+  {
+    auto tail = traceTail.load(std::memory_order_relaxed);
+    const auto head = traceHead.load(std::memory_order_acquire);
+    for (; tail != head; ++tail) {
+      const auto &timing = trace[tail % traceCapacity];
+      ofs << timing.frames << "," << timing.sampleRate << "," << timing.seconds << "\n";
+    }
+    traceTail.store(tail, std::memory_order_release);
+    ofs.flush();
+  }
+};
+
+#else
+
+// Stub used when `DSP_LOAD_METER` is not defined. Everything is optimized away.
+class DSPLoadMeter {
+public:
+  static constexpr uint32_t nParameter = 0;
+
+  struct Probe {
+    ~Probe() {} // User provided to suppress unused variable warning.
+  };
+
+  void setup(double) {}
+  Probe probe(uint32_t) { return {}; }
+  float getParameter(uint32_t) const { return 0.0f; }
+
+#ifndef TEST_BUILD
+  static void initParameter(uint32_t, Parameter &) {}
+#endif
+};
+
+#endif
@@ -21,7 +21,9 @@
 #include "valuewidget.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdio>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -40,6 +42,11 @@ private:
   float highlightBorderWidth = 4.0f;
   float scrollBarheight = 8.0f;
 
+  // Text is formatted outside of `onNanoDisplay()` to avoid allocation while drawing.
+  std::vector<std::array<char, 12>> indexLabel;
+  std::array<char, 16> viewRangeLabel{{"<- #0"}};
+  int32_t labelOffset = 0;
+
   float textSize = 9.0f;
   FontId fontId = -1;
   Palette &pal;
@@ -86,6 +93,9 @@ public:
     barState.resize(defaultValue.size(), BarState::active);
     active.reserve(value.size());
     locked.reserve(value.size());
+
+    indexLabel.resize(value.size());
+    refreshIndexLabel();
   }
 
   void onNanoDisplay() override
@@ -102,31 +112,43 @@ public:
     fillColor(pal.boxBackground());
     fill();
 
-    // Value bar.
-    float sliderZeroHeight = height * (1.0f - sliderZero);
+    // Value bar. Active and locked bars are batched into a path for each color.
+    const float sliderZeroHeight = height * (1.0f - sliderZero);
+    bool hasLocked = false;
+    beginPath();
     for (int i = indexL; i < indexR; ++i) {
-      float rectH = value[i] >= sliderZero ? (value[i] - sliderZero) * height
-                                           : (sliderZero - value[i]) * height;
-      float rectY = value[i] >= sliderZero ? sliderZeroHeight - rectH : sliderZeroHeight;
-      fillColor(
-        barState[i] == BarState::active ? pal.highlightMain() : pal.foregroundInactive());
+      if (barState[i] != BarState::active) {
+        hasLocked = true;
+        continue;
+      }
+      barRect(i, sliderZeroHeight, height);
+    }
+    fillColor(pal.highlightMain());
+    fill();
+
+    if (hasLocked) {
       beginPath();
-      rect((i - indexL) * sliderWidth, rectY, sliderWidth - sliderMargin, rectH);
+      for (int i = indexL; i < indexR; ++i) {
+        if (barState[i] == BarState::active) continue;
+        barRect(i, sliderZeroHeight, height);
+      }
+      fillColor(pal.foregroundInactive());
       fill();
     }
 
     // Index text.
     fontFaceId(fontId);
     if (sliderWidth >= 8.0f) {
+      if (labelOffset != indexOffset) refreshIndexLabel();
+
       fillColor(pal.foreground());
       fontSize(textSize);
       textAlign(ALIGN_CENTER | ALIGN_MIDDLE);
       for (int i = 0; i < indexRange; ++i) {
-        text(
-          (i + 0.5f) * sliderWidth, height - 4,
-          std::to_string(i + indexL + indexOffset).c_str(), nullptr);
-        if (barState[i] != BarState::active) {
-          text((i + 0.5f) * sliderWidth, textSize + 4, "L", nullptr);
+        const float x = (i + 0.5f) * sliderWidth;
+        text(x, height - 4, indexLabel[i + indexL].data(), nullptr);
+        if (barState[i + indexL] != BarState::active) {
+          text(x, textSize + 4, "L", nullptr);
         }
       }
     }
@@ -136,8 +158,7 @@ public:
       fillColor(pal.overlay());
       fontSize(textSize * 2.0f);
       textAlign(ALIGN_LEFT | ALIGN_TOP);
-      std::string str = "<- #" + std::to_string(indexL);
-      text(0, 0, str.c_str(), nullptr);
+      text(0, 0, viewRangeLabel.data(), nullptr);
     }
 
     // Border.
@@ -161,11 +182,11 @@ public:
         fontFaceId(fontId);
         fontSize(textSize * 4.0f);
         textAlign(ALIGN_CENTER | ALIGN_MIDDLE);
-        std::ostringstream os;
-        os << "#" << std::to_string(index + indexOffset) << ": "
-           << std::to_string(scale.map(value[index]));
-        std::string indexText(os.str());
-        text(width / 2, height / 2, indexText.c_str(), nullptr);
+        std::array<char, 64> indexText;
+        snprintf(
+          indexText.data(), indexText.size(), "#%d: %f", index + indexOffset,
+          double(scale.map(value[index])));
+        text(width / 2, height / 2, indexText.data(), nullptr);
 
         if (barState[index] != BarState::active) {
           fontSize(textSize * 2.0f);
@@ -671,11 +692,29 @@ public:
     indexL = int(std::clamp(left, 0.0f, 1.0f) * value.size());
     indexR = int(std::clamp(right, 0.0f, 1.0f) * value.size());
     indexRange = indexR >= indexL ? indexR - indexL : 0;
+    snprintf(viewRangeLabel.data(), viewRangeLabel.size(), "<- #%d", indexL);
     refreshSliderWidth(getWidth());
     repaint();
   }
 
 private:
+  inline void barRect(int index, float sliderZeroHeight, float height)
+  {
+    const float rectH = value[index] >= sliderZero ? (value[index] - sliderZero) * height
+                                                   : (sliderZero - value[index]) * height;
+    const float rectY
+      = value[index] >= sliderZero ? sliderZeroHeight - rectH : sliderZeroHeight;
+    rect((index - indexL) * sliderWidth, rectY, sliderWidth - sliderMargin, rectH);
+  }
+
+  // Index labels only depend on `indexOffset`, which is set once after construction.
+  void refreshIndexLabel()
+  {
+    labelOffset = indexOffset;
+    for (size_t i = 0; i < indexLabel.size(); ++i)
+      snprintf(indexLabel[i].data(), indexLabel[i].size(), "%d", int(i) + indexOffset);
+  }
+
   inline size_t calcIndex(Point<int> position)
   {
     return size_t(indexL + position.getX() / sliderWidth);
@@ -0,0 +1,77 @@
+// (c) 2020 Takamitsu Endo
+//
+// This file is part of Uhhyou Plugins.
+//
+// Uhhyou Plugins is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Uhhyou Plugins is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Uhhyou Plugins.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Widget.hpp"
+#include "style.hpp"
+
+#include "../dspload.hpp"
+
+#include <array>
+#include <cstdio>
+
+// Shows the output parameters of `DSPLoadMeter`.
+class DSPLoadView : public NanoWidget {
+public:
+  explicit DSPLoadView(NanoWidget *group, FontId fontId, Palette &palette)
+    : NanoWidget(group), fontId(fontId), pal(palette)
+  {
+  }
+
+  // Returns true when displayed text is changed.
+  bool setValue(uint32_t index, float percent)
+  {
+    if (index >= value.size() || value[index] == percent) return false;
+    value[index] = percent;
+    return true;
+  }
+
+  void onNanoDisplay() override
+  {
+    resetTransform();
+    translate(getAbsoluteX(), getAbsoluteY());
+
+    const auto width = getWidth();
+    const auto height = getHeight();
+
+    beginPath();
+    rect(0, 0, width, height);
+    fillColor(pal.overlay());
+    fill();
+
+    std::array<char, 64> str;
+    snprintf(
+      str.data(), str.size(), "DSP %5.1f%%  Peak %5.1f%%  p99 %5.1f%%",
+      value[DSPLoadID::current], value[DSPLoadID::peak], value[DSPLoadID::p99]);
+
+    fontFaceId(fontId);
+    fontSize(textSize);
+    textAlign(ALIGN_RIGHT | ALIGN_MIDDLE);
+    fillColor(
+      value[DSPLoadID::peak] >= 100.0f ? pal.highlightWarning() : pal.boxBackground());
+    text(width - 4.0f, height / 2, str.data(), nullptr);
+  }
+
+  void setTextSize(float size) { textSize = size < 0.0f ? 0.0f : size; }
+
+protected:
+  std::array<float, DSPLoadID::ID_ENUM_LENGTH> value{};
+  FontId fontId = -1;
+  Palette &pal;
+  float textSize = 12.0f;
+};
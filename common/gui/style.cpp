@@ -28,6 +28,8 @@ This source is splitted because nlohmann/json.hpp is slow to compile.
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <mutex>
 
 /**
 Specification of $XDG_CONFIG_HOME:
@@ -125,7 +127,54 @@ inline void loadString(nlohmann::json &data, std::string key, std::string &dest)
   dest = data[key];
 }
 
+inline std::vector<unsigned char> loadFile(const std::string &path)
+{
+  std::ifstream ifs(path, std::ios::binary);
+  if (!ifs.is_open()) {
+    std::cerr << "Failed to open " << path << "\n";
+    return {};
+  }
+  return std::vector<unsigned char>(
+    std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+
+struct Palette::Resource {
+  Palette palette{NoLoad{}};
+  std::vector<unsigned char> fontData;
+
+  Resource()
+  {
+    palette.parse();
+    if (palette._fontPath.size() > 0) fontData = loadFile(palette._fontPath);
+  }
+};
+
 void Palette::load()
+{
+  static std::mutex mutex;
+  static std::weak_ptr<const Resource> cache;
+
+  std::shared_ptr<const Resource> shared;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    shared = cache.lock();
+    if (!shared) {
+      shared = std::make_shared<const Resource>();
+      cache = shared;
+    }
+  }
+
+  *this = shared->palette;
+  resource = std::move(shared);
+}
+
+const std::vector<unsigned char> &Palette::fontData()
+{
+  static const std::vector<unsigned char> empty;
+  return resource ? resource->fontData : empty;
+}
+
+void Palette::parse()
 {
   auto data = loadStyleJson();
   if (data.is_null()) return;
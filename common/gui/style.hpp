@@ -21,17 +21,27 @@
 #include "../../lib/DPF/dgl/Color.hpp"
 
 #include <array>
+#include <memory>
 #include <string>
+#include <vector>
 
 // Using common because default is a keyword in C++.
 enum class Style { common, accent, warning };
 
+/**
+Colors and font of GUI.
+
+`style.json` and the font file are loaded once, and shared by all the instances in the
+process. The shared copy is kept while any instance is alive, so changes to the config
+are applied after closing all the plugin windows.
+*/
 class Palette {
 public:
   Palette() { load(); }
   void load();
 
   const std::string &fontPath() { return _fontPath; }
+  const std::vector<unsigned char> &fontData(); // Empty on failure.
   const DGL::Color &foreground() { return _foreground; }
   const DGL::Color &foregroundButtonOn() { return _foregroundButtonOn; }
   const DGL::Color &foregroundInactive() { return _foregroundInactive; }
@@ -49,6 +59,14 @@ public:
   const DGL::Color &overlayHighlight() { return _overlayHighlight; }
 
 private:
+  struct Resource;
+  struct NoLoad {};
+
+  explicit Palette(NoLoad) {}
+  void parse();
+
+  std::shared_ptr<const Resource> resource;
+
   std::string _fontPath;
   DGL::Color _foreground{0x00, 0x00, 0x00};
   DGL::Color _foregroundButtonOn{0x00, 0x00, 0x00};
@@ -0,0 +1,139 @@
+// (c) 2020 Takamitsu Endo
+//
+// This file is part of Uhhyou Plugins.
+//
+// Uhhyou Plugins is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Uhhyou Plugins is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Uhhyou Plugins.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+struct ParameterEvent {
+  uint32_t frame; // Offset from the start of next block.
+  uint32_t id;
+  double value; // Raw value.
+};
+
+/**
+Multiple producer, single consumer queue of parameter changes. Preallocated and lock-free.
+Host and UI may push from different threads.
+
+Producer pushes a change after writing it to GlobalParameter. Consumer applies changes at
+their frame, and only touches the parameters which are changed.
+
+When the queue is full, a change is dropped and resync is requested instead. Consumer then
+discards the queue and reads all values from GlobalParameter. This is also used after the
+values are rewritten without the queue, like loading a program. Resync is requested at
+start, so the first block always reads all values.
+
+Each slot has a sequence number, which tells whether the slot is free, or holds an event
+of the current lap. Producers claim a slot by compare-and-swap on `head`, and publish it
+by advancing the sequence number. Consumer frees the slot in the same way.
+*/
+template<size_t capacity> class ParameterQueue {
+public:
+  static_assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+
+  ParameterQueue()
+  {
+    for (size_t i = 0; i < capacity; ++i)
+      buffer[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  // Producer. Any thread.
+  void push(uint32_t frame, uint32_t id, double value)
+  {
+    auto pos = head.load(std::memory_order_relaxed);
+    Slot *slot;
+    while (true) {
+      slot = &buffer[pos & mask];
+      const auto seq = slot->sequence.load(std::memory_order_acquire);
+      const auto diff = std::ptrdiff_t(seq - pos);
+      if (diff == 0) {
+        if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+      } else if (diff < 0) {
+        requestResync(); // Full.
+        return;
+      } else {
+        pos = head.load(std::memory_order_relaxed);
+      }
+    }
+    slot->event = {frame, id, value};
+    slot->sequence.store(pos + 1, std::memory_order_release);
+  }
+
+  // Any thread.
+  void requestResync() { resync.store(true, std::memory_order_release); }
+
+  // Consumer. Returns true once for each request.
+  bool takeResync()
+  {
+    if (!resync.load(std::memory_order_relaxed)) return false;
+    return resync.exchange(false, std::memory_order_acq_rel);
+  }
+
+  // Consumer. Returns nullptr when empty, or when next event is not yet published.
+  const ParameterEvent *front() const
+  {
+    const auto &slot = buffer[tail & mask];
+    if (slot.sequence.load(std::memory_order_acquire) != tail + 1) return nullptr;
+    return &slot.event;
+  }
+
+  // Consumer. Call only when `front()` returned an event.
+  void pop()
+  {
+    buffer[tail & mask].sequence.store(tail + capacity, std::memory_order_release);
+    ++tail;
+  }
+
+  // Consumer.
+  void clear()
+  {
+    while (front() != nullptr) pop();
+  }
+
+  /**
+  Consumer. Calls `apply(event)` for changes at or before `frame`. Returns the frame of
+  next change, or `length` when no change is left. Changes past the end of block are
+  applied at the last frame.
+  */
+  template<typename Apply> size_t dispatch(size_t frame, size_t length, Apply apply)
+  {
+    while (auto event = front()) {
+      const size_t eventFrame = std::min<size_t>(event->frame, length - 1);
+      if (eventFrame > frame) return eventFrame;
+      apply(*event);
+      pop();
+    }
+    return length;
+  }
+
+protected:
+  static constexpr size_t mask = capacity - 1;
+
+  struct Slot {
+    std::atomic<size_t> sequence{0};
+    ParameterEvent event;
+  };
+
+  alignas(64) std::atomic<size_t> head{0};
+  alignas(64) size_t tail = 0; // Only touched by consumer.
+  alignas(64) std::atomic<bool> resync{true};
+  std::array<Slot, capacity> buffer;
+};
@@ -35,6 +35,10 @@
 #include "gui/textview.hpp"
 #include "gui/vslider.hpp"
 
+#ifdef DSP_LOAD_METER
+  #include "gui/dsploadview.hpp"
+#endif
+
 #include <memory>
 #include <tuple>
 #include <unordered_map>
@@ -55,24 +59,84 @@ protected:
   std::unordered_map<int, std::shared_ptr<ArrayWidget>> arrayWidget;
   std::unordered_map<std::string, std::shared_ptr<StateWidget>> stateWidget;
 
+  // Font data is owned by `palette`, or embedded. NanoVG doesn't copy or free them.
+  void loadFont()
+  {
+    auto &data = palette.fontData();
+    if (data.size() > 0) {
+      fontId = createFontFromMemory(
+        "main", const_cast<unsigned char *>(data.data()), uint(data.size()), false);
+    }
+
+    if (fontId < 0) {
+      fontId = createFontFromMemory(
+        "main", (unsigned char *)(FontData::TinosBoldItalicData),
+        FontData::TinosBoldItalicDataSize, false);
+    }
+  }
+
+  /**
+  Parameter changes only mark the UI as dirty, and `uiIdle()` repaints at most once for
+  each idle call. Otherwise, loading a program or automating many parameters requests a
+  full window redraw for each parameter.
+
+  Host updates which don't change the displayed value don't request a redraw. Widgets
+  still repaint themselves on user interaction.
+  */
+  bool isDirty = false;
+
+  void requestRepaint() { isDirty = true; }
+
+  void uiIdle() override
+  {
+    if (!isDirty) return;
+    isDirty = false;
+    repaint();
+  }
+
   void parameterChanged(uint32_t index, float value) override
   {
+#ifdef DSP_LOAD_METER
+    if (index >= param->idLength()) {
+      updateDSPLoad(uint32_t(index - param->idLength()), value);
+      return;
+    }
+#endif
     updateUI(index, param->parameterChanged(index, value));
   }
 
+#ifdef DSP_LOAD_METER
+  std::shared_ptr<DSPLoadView> dspLoadView;
+
+  // The view is added on first update, because `fontId` is not set in constructor.
+  void updateDSPLoad(uint32_t index, float percent)
+  {
+    if (!dspLoadView) {
+      const float width = 280.0f;
+      const float height = 16.0f;
+      dspLoadView = std::make_shared<DSPLoadView>(this, fontId, palette);
+      dspLoadView->setSize(width, height);
+      dspLoadView->setAbsolutePos(getWidth() - width, getHeight() - height);
+    }
+    if (dspLoadView->setValue(index, percent)) requestRepaint();
+  }
+#endif
+
   void updateUI(uint32_t id, float normalized)
   {
     auto vWidget = valueWidget.find(id);
     if (vWidget != valueWidget.end()) {
-      vWidget->second->setValue(normalized);
-      repaint();
+      if (setWidgetValue(*vWidget->second, normalized)) requestRepaint();
       return;
     }
 
     auto aWidget = arrayWidget.find(id);
     if (aWidget != arrayWidget.end()) {
-      aWidget->second->setValueFromId(id, normalized);
-      repaint();
+      auto &widget = *aWidget->second;
+      const auto index = id - widget.id[0];
+      const auto previous = widget.getValueAt(index);
+      widget.setValueFromId(id, normalized);
+      if (widget.getValueAt(index) != previous) requestRepaint();
       return;
     }
   }
@@ -81,7 +145,7 @@ protected:
   {
     if (id >= param->idLength()) return;
     setParameterValue(id, param->updateValue(id, normalized));
-    repaint();
+    requestRepaint();
   }
 
   void programLoaded(uint32_t index) override
@@ -93,15 +157,21 @@ protected:
       vPair.second->setValue(param->getNormalized(vPair.second->id));
     }
 
+    // `arrayWidget` has an entry for each element. Only the element of the entry is set.
     for (auto &aPair : arrayWidget) {
-      auto &aWidget = aPair.second;
-      for (size_t idx = 0; idx < aWidget->id.size(); ++idx) {
-        if (aWidget->id[idx] >= param->idLength()) continue;
-        aWidget->setValueAt(idx, param->getNormalized(aWidget->id[idx]));
-      }
+      if (uint32_t(aPair.first) >= param->idLength()) continue;
+      aPair.second->setValueFromId(aPair.first, param->getNormalized(aPair.first));
     }
 
-    repaint();
+    requestRepaint();
+  }
+
+  // Returns true when displayed value is changed.
+  static bool setWidgetValue(ValueWidget &widget, double normalized)
+  {
+    const auto previous = widget.getValue();
+    widget.setValue(normalized);
+    return widget.getValue() != previous;
   }
 
 #if DISTRHO_PLUGIN_WANT_STATE
@@ -23,6 +23,10 @@
 
 #include "dsp/scale.hpp"
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
 #include <string>
 
 #ifndef TEST_BUILD
@@ -54,25 +58,27 @@ protected:
 };
 #endif
 
+// Descriptor of a parameter. Holds scale, name and flags. Raw value lives in ValueArray.
 struct ValueInterface {
+  virtual ~ValueInterface() {}
 #ifndef TEST_BUILD
   virtual void setParameterRange(Parameter &parameter) = 0;
 #endif
   virtual const char *getName() const = 0;
-  virtual double getFloat() const = 0;
-  virtual uint32_t getInt() const = 0;
-  virtual double getNormalized() = 0;
+  virtual double getDefaultRaw() = 0;
   virtual uint32_t getDefaultInt() = 0;
   virtual double getDefaultNormalized() = 0;
-  virtual void setFromInt(uint32_t value) = 0;
-  virtual void setFromFloat(double value) = 0;
-  virtual void setFromNormalized(double value) = 0;
+  virtual double toNormalized(double raw) = 0;
+  virtual double fromInt(uint32_t value) = 0;
+  virtual double fromFloat(double value) = 0;
+  virtual double fromNormalized(double value) = 0;
+  virtual double fromPreset(double value) = 0;
 };
 
 struct IntValue : public ValueInterface {
   SomeDSP::IntScale<double> &scale;
   double defaultNormalized;
-  uint32_t raw;
+  uint32_t defaultRaw;
 
   std::string name;
   uint32_t hints;
@@ -84,7 +90,7 @@ struct IntValue : public ValueInterface {
     uint32_t hints)
     : scale(scale)
     , defaultNormalized(scale.invmap(defaultRaw))
-    , raw(defaultRaw <= scale.getMax() ? defaultRaw : 0)
+    , defaultRaw(defaultRaw <= scale.getMax() ? defaultRaw : 0)
     , name(name)
     , hints(hints)
   {
@@ -101,44 +107,36 @@ struct IntValue : public ValueInterface {
 #endif
 
   inline const char *getName() const override { return name.c_str(); }
-  inline uint32_t getInt() const override { return raw; }
-  inline double getFloat() const override { return raw; }
-  double getNormalized() override { return scale.invmap(raw); }
-  uint32_t getDefaultInt() { return scale.map(defaultNormalized); }
+  double getDefaultRaw() override { return defaultRaw; }
+  uint32_t getDefaultInt() override { return scale.map(defaultNormalized); }
   inline double getDefaultNormalized() override { return defaultNormalized; }
+  double toNormalized(double raw) override { return scale.invmap(uint32_t(raw)); }
 
-  void setFromInt(uint32_t value)
+  double fromInt(uint32_t value) override
   {
-    raw = value < scale.getMin() ? scale.getMin()
-                                 : value > scale.getMax() ? scale.getMax() : value;
+    return value < scale.getMin() ? scale.getMin()
+                                  : value > scale.getMax() ? scale.getMax() : value;
   }
 
-  void setFromFloat(double valueFloat) override
-  {
-    uint32_t value = uint32_t(valueFloat);
-    raw = value < scale.getMin() ? scale.getMin()
-                                 : value > scale.getMax() ? scale.getMax() : value;
-  }
+  double fromFloat(double valueFloat) override { return fromInt(uint32_t(valueFloat)); }
 
-  void setFromNormalized(double value) override
+  double fromNormalized(double value) override
   {
-    raw = scale.map(value < 0.0 ? 0.0 : value > 1.0 ? 1.0 : value);
+    return scale.map(value < 0.0 ? 0.0 : value > 1.0 ? 1.0 : value);
   }
+
+  // Preset stores raw value of integer parameter.
+  double fromPreset(double value) override { return fromInt(uint32_t(value)); }
 };
 
 template<typename Scale> struct FloatValue : public ValueInterface {
   double defaultNormalized;
-  double raw;
   Scale &scale;
   std::string name;
   uint32_t hints;
 
   FloatValue(double defaultNormalized, Scale &scale, const char *name, uint32_t hints)
-    : defaultNormalized(defaultNormalized)
-    , raw(scale.map(defaultNormalized))
-    , scale(scale)
-    , name(name)
-    , hints(hints)
+    : defaultNormalized(defaultNormalized), scale(scale), name(name), hints(hints)
   {
   }
 
@@ -152,27 +150,126 @@ template<typename Scale> struct FloatValue : public ValueInterface {
 #endif
 
   inline const char *getName() const override { return name.c_str(); }
-  inline uint32_t getInt() const override { return uint32_t(raw); }
-  inline double getFloat() const override { return raw; }
-  double getNormalized() override { return scale.invmap(raw); }
-  uint32_t getDefaultInt() { return uint32_t(scale.map(defaultNormalized)); }
+  double getDefaultRaw() override { return scale.map(defaultNormalized); }
+  uint32_t getDefaultInt() override { return uint32_t(scale.map(defaultNormalized)); }
   inline double getDefaultNormalized() override { return defaultNormalized; }
+  double toNormalized(double raw) override { return scale.invmap(raw); }
 
-  void setFromInt(uint32_t value) override
+  double fromInt(uint32_t value) override
   {
-    raw = value < scale.getMin() ? scale.getMin()
-                                 : value > scale.getMax() ? scale.getMax() : value;
+    return value < scale.getMin() ? scale.getMin()
+                                  : value > scale.getMax() ? scale.getMax() : value;
   }
 
-  void setFromFloat(double value) override
+  double fromFloat(double value) override
   {
-    raw = value < scale.getMin() ? scale.getMin()
-                                 : value > scale.getMax() ? scale.getMax() : value;
+    return value < scale.getMin() ? scale.getMin()
+                                  : value > scale.getMax() ? scale.getMax() : value;
   }
 
-  void setFromNormalized(double value) override
+  double fromNormalized(double value) override
   {
-    value = value < 0.0 ? 0.0 : value > 1.0 ? 1.0 : value;
-    raw = scale.map(value);
+    return scale.map(value < 0.0 ? 0.0 : value > 1.0 ? 1.0 : value);
   }
+
+  double fromPreset(double value) override { return fromNormalized(value); }
+};
+
+// Marks a parameter which is not in a preset dump. See `ValueArray::load()`.
+constexpr double presetKeep = -1.0;
+
+/**
+Raw values of all parameters in a flat array of atomics, and their descriptors.
+
+DSP reads hundreds of values for each block, so raw values are packed apart from the
+descriptors to keep them on as few cache lines as possible. Host, UI and DSP may access a
+value from different threads. Each value is independent, so relaxed order is enough.
+
+`value[index]` returns a Reference which has the same methods as former
+`std::unique_ptr<ValueInterface>`. Reading a value doesn't go through descriptor, and
+compiles to a plain load.
+*/
+template<size_t length> class ValueArray {
+public:
+  class Reference {
+  public:
+    Reference(std::atomic<double> &raw, std::unique_ptr<ValueInterface> &info)
+      : raw(raw), info(info)
+    {
+    }
+
+    Reference *operator->() { return this; }
+    bool operator==(std::nullptr_t) const { return info == nullptr; }
+    bool operator!=(std::nullptr_t) const { return info != nullptr; }
+
+    // Sets descriptor, and resets raw value to default.
+    Reference &operator=(std::unique_ptr<ValueInterface> descriptor)
+    {
+      info = std::move(descriptor);
+      raw.store(info->getDefaultRaw(), std::memory_order_relaxed);
+      return *this;
+    }
+
+#ifndef TEST_BUILD
+    void setParameterRange(Parameter &parameter) { info->setParameterRange(parameter); }
+#endif
+
+    inline const char *getName() const { return info->getName(); }
+    inline double getFloat() const { return raw.load(std::memory_order_relaxed); }
+    inline uint32_t getInt() const { return uint32_t(getFloat()); }
+    double getNormalized() const { return info->toNormalized(getFloat()); }
+    uint32_t getDefaultInt() const { return info->getDefaultInt(); }
+    double getDefaultNormalized() const { return info->getDefaultNormalized(); }
+
+    void setFromInt(uint32_t value)
+    {
+      raw.store(info->fromInt(value), std::memory_order_relaxed);
+    }
+
+    void setFromFloat(double value)
+    {
+      raw.store(info->fromFloat(value), std::memory_order_relaxed);
+    }
+
+    void setFromNormalized(double value)
+    {
+      raw.store(info->fromNormalized(value), std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<double> &raw;
+    std::unique_ptr<ValueInterface> &info;
+  };
+
+  static_assert(std::atomic<double>::is_always_lock_free);
+
+  // Constness is shallow, as same as `std::vector<std::unique_ptr<ValueInterface>>`.
+  Reference operator[](size_t index) const { return Reference(raw[index], info[index]); }
+
+  constexpr size_t size() const { return length; }
+
+  void reset()
+  {
+    for (size_t i = 0; i < length; ++i) {
+      raw[i].store(
+        info[i]->fromNormalized(info[i]->getDefaultNormalized()),
+        std::memory_order_relaxed);
+    }
+  }
+
+  /**
+  Loads a row of preset bank in a single pass. Values are raw for integer parameters, and
+  normalized for others. Negative value is `presetKeep`, and leaves the parameter as is.
+  */
+  void load(const std::array<double, length> &preset)
+  {
+    for (size_t i = 0; i < length; ++i) {
+      if (preset[i] < 0.0) continue;
+      raw[i].store(info[i]->fromPreset(preset[i]), std::memory_order_relaxed);
+    }
+  }
+
+private:
+  alignas(64) mutable std::array<std::atomic<double>, length> raw{};
+  mutable std::array<std::unique_ptr<ValueInterface>, length> info;
 };
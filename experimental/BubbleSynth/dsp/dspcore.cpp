@@ -37,8 +37,8 @@ void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   noteStack.reserve(128);
   noteStack.resize(0);
@@ -61,7 +61,7 @@ void DSPCORE_NAME::setParameters(float tempo) { using ID = ParameterID::ID; }
 
 void DSPCORE_NAME::process(const size_t length, float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     processMidiNote(i);
@@ -129,6 +129,7 @@ struct NoteInfo {
                                                                                          \
   private:                                                                               \
     float sampleRate = 44100.0f;                                                         \
+    SmootherCommon<float> smootherCommon;                                                \
     std::vector<NoteInfo> noteStack;                                                     \
                                                                                          \
     std::array<BubbleOsc<float>, nOscillator> bubbleOsc;                                 \
@@ -49,8 +49,8 @@ void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   noteStack.reserve(128);
   noteStack.resize(0);
@@ -79,7 +79,7 @@ void DSPCORE_NAME::setParameters(float tempo)
   using ID = ParameterID::ID;
   auto &pv = param.value;
 
-  smoothMasterGain.push(pv[ID::boost]->getFloat());
+  smoothMasterGain.push(smootherCommon, pv[ID::boost]->getFloat());
 
   if (prepareRefresh || (!isTableRefeshed && param.value[ID::refreshTable]->getInt()))
     refreshTable();
@@ -90,7 +90,7 @@ void DSPCORE_NAME::setParameters(float tempo)
 
 void DSPCORE_NAME::process(const size_t length, float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   float frame;
   for (size_t i = 0; i < length; ++i) {
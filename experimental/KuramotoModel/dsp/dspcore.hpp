@@ -134,6 +134,7 @@ struct NoteInfo {
                                                                                          \
   private:                                                                               \
     float sampleRate = 44100.0f;                                                         \
+    SmootherCommon<float> smootherCommon;                                                \
     float velocity = 0.0f;                                                               \
     std::vector<NoteInfo> noteStack;                                                     \
     DecibelScale<float> velocityMap{-30, 0, true};                                       \
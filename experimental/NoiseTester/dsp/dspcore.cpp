@@ -45,8 +45,8 @@ void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.1f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.1f);
 
   noteStack.reserve(128);
   noteStack.resize(0);
@@ -69,9 +69,9 @@ void DSPCORE_NAME::setParameters(float tempo)
   using ID = ParameterID::ID;
   auto &pv = param.value;
 
-  SmootherCommon<float>::setTime(pv[ID::smooth]->getFloat());
+  smootherCommon.setTime(pv[ID::smooth]->getFloat());
 
-  smoothGain.push(pv[ID::gain]->getFloat());
+  smoothGain.push(smootherCommon, pv[ID::gain]->getFloat());
 
   hardclip = pv[ID::hardclip]->getInt();
   noiseType = static_cast<NoiseGenerator::Type>(pv[ID::type]->getInt());
@@ -82,7 +82,7 @@ void DSPCORE_NAME::setParameters(float tempo)
 
 void DSPCORE_NAME::process(const size_t length, float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   std::array<float, 16> delayTime;
   for (size_t i = 0; i < length; ++i) {
@@ -379,13 +379,14 @@ public:
     smoothFeed.reset(feed);
   }
 
-  void push(Sample pitchMod, Sample feed)
+  void push(const SmootherCommon<Sample> &common, Sample pitchMod, Sample feed)
   {
-    smoothPitchMod.push(pitchMod);
-    smoothFeed.push(feed);
+    smoothPitchMod.push(common, pitchMod);
+    smoothFeed.push(common, feed);
   }
 
   void prepare(
+    const SmootherCommon<Sample> &common,
     Sample sampleRate,
     Sample noteFrequency,
     Sample pitchDecayAmountHz,
@@ -396,7 +397,7 @@ public:
   {
     pitchDecay.reset(sampleRate, pitchDecaySeconds);
     for (uint8_t idx = 0; idx < size; ++idx) {
-      smoothFrequencyHz[idx].push((idx + 1) * noteFrequency);
+      smoothFrequencyHz[idx].push(common, (idx + 1) * noteFrequency);
 
       lowpass[idx].setLowpass(
         sampleRate, (idx + 1) * lowpassCutoffHz + lowpassDecayAmountHz, 0.5, false);
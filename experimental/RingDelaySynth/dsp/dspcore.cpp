@@ -45,8 +45,8 @@ void DSPCORE_NAME::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.1f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.1f);
 
   noteStack.reserve(128);
   noteStack.resize(0);
@@ -83,26 +83,27 @@ void DSPCORE_NAME::setParameters(float tempo)
   using ID = ParameterID::ID;
   auto &pv = param.value;
 
-  SmootherCommon<float>::setTime(pv[ID::smooth]->getFloat());
+  smootherCommon.setTime(pv[ID::smooth]->getFloat());
 
   Vec16f delayTime;
   for (int i = 0; i < nDelay; ++i)
     delayTime.insert(i, 1.0f / pv[ID::frequency0 + i]->getFloat());
-  smoothDelayTime.push(delayTime);
+  smoothDelayTime.push(smootherCommon, delayTime);
 
-  smoothMasterGain.push(pv[ID::gain]->getFloat());
-  smoothNoiseGain.push(pv[ID::noiseGain]->getFloat());
-  smoothPropagation.push(pv[ID::ringPropagation]->getFloat());
+  smoothMasterGain.push(smootherCommon, pv[ID::gain]->getFloat());
+  smoothNoiseGain.push(smootherCommon, pv[ID::noiseGain]->getFloat());
+  smoothPropagation.push(smootherCommon, pv[ID::ringPropagation]->getFloat());
 
   ringDelay.push(
     sampleRate, pv[ID::ringLowpassCutoff]->getFloat(),
     pv[ID::ringHighpassCutoff]->getFloat());
-  ksDelay.push(pv[ID::pitchDecayAmount]->getFloat(), pv[ID::ksFeed]->getFloat());
+  ksDelay.push(
+    smootherCommon, pv[ID::pitchDecayAmount]->getFloat(), pv[ID::ksFeed]->getFloat());
 }
 
 void DSPCORE_NAME::process(const size_t length, float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   std::array<float, 16> delayTime;
   for (size_t i = 0; i < length; ++i) {
@@ -129,7 +130,7 @@ void DSPCORE_NAME::noteOn(int32_t noteId, int16_t pitch, float tuning, float vel
     sampleRate, pv[ID::noiseAttack]->getFloat(), pv[ID::noiseDecay]->getFloat());
 
   ksDelay.prepare(
-    sampleRate, notePitchToFrequency(pitch - 24 + tuning),
+    smootherCommon, sampleRate, notePitchToFrequency(pitch - 24 + tuning),
     mapCutoff(pv[ID::pitchDecayAmount]->getFloat()), pv[ID::pitchDecay]->getFloat(),
     pv[ID::ksLowpassFrequency]->getFloat(),
     mapCutoff(pv[ID::ksLowpassDecayAmount]->getFloat()),
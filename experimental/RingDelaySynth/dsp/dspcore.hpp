@@ -131,6 +131,7 @@ struct NoteInfo {
                                                                                          \
   private:                                                                               \
     float sampleRate = 44100.0f;                                                         \
+    SmootherCommon<float> smootherCommon;                                                \
     std::vector<NoteInfo> noteStack;                                                     \
                                                                                          \
     ExpSmoother16 smoothDelayTime;                                                       \
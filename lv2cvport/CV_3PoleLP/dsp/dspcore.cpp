@@ -21,8 +21,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   reset();
 }
@@ -33,11 +33,10 @@ void DSPCore::startup() {}
 
 void DSPCore::setParameters()
 {
-  interpGain.push(param.value[ParameterID::gain]->getFloat());
-  interpCutoff.push(param.value[ParameterID::cutoff]->getFloat());
-  interpResonance.push(param.value[ParameterID::resonance]->getFloat());
-  interpLpDecay.push(
-    param.value[ParameterID::dcBlock]->getFloat()
+  interpGain.push(smootherCommon, param.value[ParameterID::gain]->getFloat());
+  interpCutoff.push(smootherCommon, param.value[ParameterID::cutoff]->getFloat());
+  interpResonance.push(smootherCommon, param.value[ParameterID::resonance]->getFloat());
+  interpLpDecay.push(smootherCommon, param.value[ParameterID::dcBlock]->getFloat()
     * LP3<float>::highpassHzToDecay(
       sampleRate, param.value[ParameterID::highpass]->getFloat()));
 }
@@ -50,7 +49,7 @@ void DSPCore::process(
   const float *inDecay,
   float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   bool uniformPeak = param.value[ParameterID::uniformPeak]->getInt();
   bool uniformGain = param.value[ParameterID::uniformGain]->getInt();
@@ -68,3 +67,86 @@ void DSPCore::process(
     out0[i] = interpGain.process() * lp3.process(in0[i]);
   }
 }
+
+void DSPBatch::setup(double sampleRate, size_t nStream)
+{
+  this->sampleRate = sampleRate;
+  this->nStream = nStream;
+
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
+
+  group.resize((nStream + LaneVec::size() - 1) / LaneVec::size());
+  reset();
+}
+
+void DSPBatch::reset()
+{
+  for (auto &grp : group) grp.lp3.reset();
+}
+
+void DSPBatch::setParameters(size_t stream, const GlobalParameter &param)
+{
+  if (stream >= nStream) return;
+  auto &grp = group[stream / LaneVec::size()];
+  const int lane = int(stream % LaneVec::size());
+
+  grp.interpGain.push(smootherCommon, lane, param.value[ParameterID::gain]->getFloat());
+  grp.interpCutoff.push(
+    smootherCommon, lane, param.value[ParameterID::cutoff]->getFloat());
+  grp.interpResonance.push(
+    smootherCommon, lane, param.value[ParameterID::resonance]->getFloat());
+  grp.interpLpDecay.push(
+    smootherCommon, lane,
+    param.value[ParameterID::dcBlock]->getFloat()
+      * LP3<float>::highpassHzToDecay(
+        sampleRate, param.value[ParameterID::highpass]->getFloat()));
+
+  grp.uniformPeak.insert(lane, param.value[ParameterID::uniformPeak]->getInt());
+  grp.uniformGain.insert(lane, param.value[ParameterID::uniformGain]->getInt());
+}
+
+void DSPBatch::process(
+  const size_t length,
+  const float *const *in0,
+  const float *const *inCutoff,
+  const float *const *inResonance,
+  const float *const *inDecay,
+  float *const *out0)
+{
+  smootherCommon.setBufferSize(length);
+
+  alignas(16) std::array<float, LaneVec::size()> frame{};
+  alignas(16) std::array<float, LaneVec::size()> output{};
+
+  for (size_t index = 0; index < group.size(); ++index) {
+    auto &grp = group[index];
+    const size_t first = index * LaneVec::size();
+    const size_t nLane = std::min<size_t>(LaneVec::size(), nStream - first);
+
+    auto gather = [&](const float *const *input, size_t i) {
+      for (size_t lane = 0; lane < nLane; ++lane) frame[lane] = input[first + lane][i];
+      LaneVec x;
+      x.load_a(frame.data());
+      return x;
+    };
+
+    for (size_t i = 0; i < length; ++i) {
+      const LaneVec cutoff = grp.interpCutoff.process();
+      const LaneVec resonance = grp.interpResonance.process();
+      const LaneVec decay = grp.interpLpDecay.process();
+
+      const LaneVec cvCutoff = abs(gather(inCutoff, i)) * 130.0f - 69.0f;
+      const LaneVec cutoffHz = cutoff + 440.0f * exp2(cvCutoff / 12.0f);
+      grp.lp3.setRaw(
+        sampleRate, min(max(cutoffHz, 0.0f), sampleRate / 2.0f),
+        min(max(resonance + gather(inResonance, i), 0.0f), 1.0f),
+        min(max(decay + 0.1f * gather(inDecay, i), 0.0f), 1.0f), grp.uniformPeak,
+        grp.uniformGain);
+
+      LaneVec y = grp.interpGain.process() * grp.lp3.process(gather(in0, i));
+      y.store_a(output.data());
+      for (size_t lane = 0; lane < nLane; ++lane) out0[first + lane][i] = output[lane];
+    }
+  }
+}
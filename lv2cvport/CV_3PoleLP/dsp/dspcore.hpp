@@ -22,6 +22,8 @@
 #include "../parameter.hpp"
 #include "lp3.hpp"
 
+#include <vector>
+
 using namespace SomeDSP;
 
 class DSPCore {
@@ -43,9 +45,48 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   LP3<float> lp3;
   LinearSmoother<float> interpGain;
   LinearSmoother<float> interpCutoff;
   LinearSmoother<float> interpResonance;
   LinearSmoother<float> interpLpDecay;
 };
+
+/**
+Processes independent streams in lanes of `Vec4f`, for hosts running many instances.
+Each stream has its own parameters and states. This plugin is built without dispatching on
+instruction set, so the lane width is fixed to 4 of SSE2.
+*/
+class DSPBatch {
+public:
+  using LaneVec = Vec4f;
+
+  void setup(double sampleRate, size_t nStream); // Not realtime safe.
+  void reset();
+  size_t laneWidth() { return LaneVec::size(); }
+  void setParameters(size_t stream, const GlobalParameter &param);
+  void process(
+    const size_t length,
+    const float *const *in0,
+    const float *const *inCutoff,
+    const float *const *inResonance,
+    const float *const *inDecay,
+    float *const *out0);
+
+private:
+  struct Group {
+    LP3Lane<LaneVec> lp3;
+    LaneVec uniformPeak = 0.0f;
+    LaneVec uniformGain = 0.0f;
+    LinearSmootherLane<LaneVec> interpGain;
+    LinearSmootherLane<LaneVec> interpCutoff;
+    LinearSmootherLane<LaneVec> interpResonance;
+    LinearSmootherLane<LaneVec> interpLpDecay;
+  };
+
+  float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
+  size_t nStream = 0;
+  std::vector<Group> group;
+};
@@ -19,6 +19,9 @@
 
 #include "../../../common/dsp/constants.hpp"
 #include "../../../common/dsp/somemath.hpp"
+#include "../../../lib/vcl/vectorclass.h"
+#include "../../../lib/vcl/vectormath_exp.h"
+#include "../../../lib/vcl/vectormath_trig.h"
 
 #include <algorithm>
 
@@ -114,4 +117,54 @@ template<typename Sample> struct LP3 {
   }
 };
 
+// `LP3` on lanes of `Vec`. `uniformPeak` and `uniformGain` are 1 for on, and 0 for off.
+template<typename Vec> struct LP3Lane {
+  Vec c = 0.0f;
+  Vec k = 0.0f;
+  Vec decay = 1.0f;
+  Vec gain = 0.0f;
+  Vec acc = 0.0f;
+  Vec vel = 0.0f;
+  Vec pos = 0.0f;
+  Vec x1 = 0.0f;
+
+  void reset() { acc = vel = pos = x1 = 0.0f; }
+
+  void setRaw(
+    float sampleRate,
+    Vec cutoffHz,
+    Vec resonance,
+    Vec decay,
+    Vec uniformPeak,
+    Vec uniformGain)
+  {
+    const Vec x = cutoffHz / sampleRate;
+    c = 56.85341479156533f * x * x * x * x * x * x
+      + -60.92051508862034f * x * x * x * x * x + -1.6515635438744682f * x * x * x * x
+      + 31.558896956675998f * x * x * x + -20.61402812645397f * x * x
+      + 6.320753515093109f * x;
+
+    const Vec kExp = exp(-5.6852537097945195f * resonance);
+    const Vec kMin = 1.0f - kExp;
+    const Vec kMax = 0.9999771732485103f - 0.01f * (kExp - 0.0033956716251850594f);
+    const Vec kPeak = kMax - (kMax - kMin) * acos(1.0f - c) / float(halfpi);
+    k = select(uniformPeak != 0.0f, kPeak, min(max(resonance, 0.0f), float(1 - 1e-5)));
+
+    this->decay = decay;
+    gain = select(uniformGain != 0.0f, c / (1.0f - k), c);
+  }
+
+  Vec process(Vec x0)
+  {
+    acc = k * acc + c * vel;
+    vel -= acc + x0 - x1;
+    pos -= gain * vel;
+
+    pos *= decay;
+
+    x1 = x0;
+    return pos;
+  }
+};
+
 } // namespace SomeDSP
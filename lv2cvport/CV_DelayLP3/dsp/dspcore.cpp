@@ -44,8 +44,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   delay.setup(sampleRate, Scales::time.getMax());
 
@@ -71,11 +71,11 @@ void DSPCore::setParameters()
 {
   using ID = ParameterID::ID;
 
-  interpTime.push(param.value[ID::time]->getFloat());
-  interpFeedback.push(param.value[ID::feedback]->getFloat());
-  interpLowpassHz.push(param.value[ID::lowpassHz]->getFloat());
-  interpResonance.push(param.value[ID::resonance]->getFloat());
-  interpHighpassHz.push(param.value[ID::highpassHz]->getFloat());
+  interpTime.push(smootherCommon, param.value[ID::time]->getFloat());
+  interpFeedback.push(smootherCommon, param.value[ID::feedback]->getFloat());
+  interpLowpassHz.push(smootherCommon, param.value[ID::lowpassHz]->getFloat());
+  interpResonance.push(smootherCommon, param.value[ID::resonance]->getFloat());
+  interpHighpassHz.push(smootherCommon, param.value[ID::highpassHz]->getFloat());
 }
 
 void DSPCore::process(
@@ -87,7 +87,7 @@ void DSPCore::process(
   const float *inHighpass,
   float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     auto lowpassHz = interpLowpassHz.process() + mapCutoffHz(inLowpass[i]);
@@ -45,6 +45,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   DelayLP3<float> delay;
   LinearSmoother<float> interpTime;
   LinearSmoother<float> interpFeedback;
@@ -21,8 +21,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   reset();
 }
@@ -33,9 +33,9 @@ void DSPCore::startup() {}
 
 void DSPCore::setParameters()
 {
-  interpGain.push(param.value[ParameterID::gain]->getFloat());
-  interpCutoff.push(param.value[ParameterID::cutoff]->getFloat());
-  interpResonance.push(param.value[ParameterID::resonance]->getFloat());
+  interpGain.push(smootherCommon, param.value[ParameterID::gain]->getFloat());
+  interpCutoff.push(smootherCommon, param.value[ParameterID::cutoff]->getFloat());
+  interpResonance.push(smootherCommon, param.value[ParameterID::resonance]->getFloat());
 }
 
 void DSPCore::process(
@@ -45,7 +45,7 @@ void DSPCore::process(
   const float *inResonance,
   float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   const bool uniformGain = param.value[ParameterID::uniformGain]->getInt();
   const bool highpass = param.value[ParameterID::highpass]->getInt();
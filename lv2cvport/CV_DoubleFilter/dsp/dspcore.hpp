@@ -42,6 +42,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   DoubleFilter<float> filter;
   LinearSmoother<float> interpGain;
   LinearSmoother<float> interpCutoff;
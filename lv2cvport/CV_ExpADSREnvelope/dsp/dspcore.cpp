@@ -21,8 +21,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   envelope.setup(sampleRate);
 
@@ -43,10 +43,10 @@ void DSPCore::setParameters()
 {
   using ID = ParameterID::ID;
 
-  interpGain.push(param.value[ID::gain]->getFloat());
+  interpGain.push(smootherCommon, param.value[ID::gain]->getFloat());
 
   envelope.set(
-    param.value[ParameterID::attack]->getFloat(),
+    smootherCommon, param.value[ParameterID::attack]->getFloat(),
     param.value[ParameterID::decay]->getFloat(),
     param.value[ParameterID::sustain]->getFloat(),
     param.value[ParameterID::release]->getFloat(), 20000.0f);
@@ -54,7 +54,7 @@ void DSPCore::setParameters()
 
 void DSPCore::process(const size_t length, float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     processMidiNote(i);
@@ -71,7 +71,7 @@ void DSPCore::noteOn(
   noteStack.push_back(info);
 
   envelope.reset(
-    param.value[ParameterID::attack]->getFloat(),
+    smootherCommon, param.value[ParameterID::attack]->getFloat(),
     param.value[ParameterID::decay]->getFloat(),
     param.value[ParameterID::sustain]->getFloat(),
     param.value[ParameterID::release]->getFloat(), 20000.0f,
@@ -130,6 +130,7 @@ public:
   }
 
   void reset(
+    const SmootherCommon<Sample> &common,
     Sample attackTime,
     Sample decayTime,
     Sample sustainLevel,
@@ -139,7 +140,7 @@ public:
   {
     state = State::attack;
 
-    sustain.push(std::clamp<Sample>(sustainLevel, Sample(0), Sample(1)));
+    sustain.push(common, std::clamp<Sample>(sustainLevel, Sample(0), Sample(1)));
 
     offset = value;
     range = Sample(1) - value;
@@ -154,6 +155,7 @@ public:
   }
 
   void set(
+    const SmootherCommon<Sample> &common,
     Sample attackTime,
     Sample decayTime,
     Sample sustainLevel,
@@ -172,7 +174,7 @@ public:
         // Fall through.
 
       case State::sustain:
-        sustain.push(std::clamp<Sample>(sustainLevel, Sample(0), Sample(1)));
+        sustain.push(common, std::clamp<Sample>(sustainLevel, Sample(0), Sample(1)));
         // Fall through.
 
       case State::release:
@@ -310,6 +312,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   std::vector<NoteInfo> noteStack; // Top of this stack is current note.
   ExpADSREnvelope<float> envelope;
   LinearSmoother<float> interpGain;
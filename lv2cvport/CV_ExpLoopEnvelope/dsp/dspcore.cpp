@@ -27,8 +27,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   interpRate.setSampleRate(sampleRate);
 
@@ -56,48 +56,48 @@ void DSPCore::setParameters()
     param.value[ParameterID::loopStart]->getInt(),
     param.value[ParameterID::loopEnd]->getInt());
 
-  interpGain.push(param.value[ID::gain]->getFloat());
+  interpGain.push(smootherCommon, param.value[ID::gain]->getFloat());
 
   float rateRatio = param.value[ID::rateKeyFollow]->getInt() ? noteRatio : 1.0f;
   float rateSlideTime = param.value[ParameterID::rateSlideTime]->getFloat();
-  interpRate.push(param.value[ID::rate]->getFloat() * rateRatio);
+  interpRate.push(smootherCommon, param.value[ID::rate]->getFloat() * rateRatio);
   interpRate.setTime(rateSlideTime);
 
-  interpReleaseTime.push(param.value[ID::releaseTime]->getFloat());
-
-  interpS0DecayTime.push(param.value[ID::s0DecayTime]->getFloat());
-  interpS1DecayTime.push(param.value[ID::s1DecayTime]->getFloat());
-  interpS2DecayTime.push(param.value[ID::s2DecayTime]->getFloat());
-  interpS3DecayTime.push(param.value[ID::s3DecayTime]->getFloat());
-  interpS4DecayTime.push(param.value[ID::s4DecayTime]->getFloat());
-  interpS5DecayTime.push(param.value[ID::s5DecayTime]->getFloat());
-  interpS6DecayTime.push(param.value[ID::s6DecayTime]->getFloat());
-  interpS7DecayTime.push(param.value[ID::s7DecayTime]->getFloat());
-
-  interpS0HoldTime.push(param.value[ID::s0HoldTime]->getFloat());
-  interpS1HoldTime.push(param.value[ID::s1HoldTime]->getFloat());
-  interpS2HoldTime.push(param.value[ID::s2HoldTime]->getFloat());
-  interpS3HoldTime.push(param.value[ID::s3HoldTime]->getFloat());
-  interpS4HoldTime.push(param.value[ID::s4HoldTime]->getFloat());
-  interpS5HoldTime.push(param.value[ID::s5HoldTime]->getFloat());
-  interpS6HoldTime.push(param.value[ID::s6HoldTime]->getFloat());
-  interpS7HoldTime.push(param.value[ID::s7HoldTime]->getFloat());
-
-  interpS0Level.push(param.value[ID::s0Level]->getFloat());
-  interpS1Level.push(param.value[ID::s1Level]->getFloat());
-  interpS2Level.push(param.value[ID::s2Level]->getFloat());
-  interpS3Level.push(param.value[ID::s3Level]->getFloat());
-  interpS4Level.push(param.value[ID::s4Level]->getFloat());
-  interpS5Level.push(param.value[ID::s5Level]->getFloat());
-  interpS6Level.push(param.value[ID::s6Level]->getFloat());
-  interpS7Level.push(param.value[ID::s7Level]->getFloat());
+  interpReleaseTime.push(smootherCommon, param.value[ID::releaseTime]->getFloat());
+
+  interpS0DecayTime.push(smootherCommon, param.value[ID::s0DecayTime]->getFloat());
+  interpS1DecayTime.push(smootherCommon, param.value[ID::s1DecayTime]->getFloat());
+  interpS2DecayTime.push(smootherCommon, param.value[ID::s2DecayTime]->getFloat());
+  interpS3DecayTime.push(smootherCommon, param.value[ID::s3DecayTime]->getFloat());
+  interpS4DecayTime.push(smootherCommon, param.value[ID::s4DecayTime]->getFloat());
+  interpS5DecayTime.push(smootherCommon, param.value[ID::s5DecayTime]->getFloat());
+  interpS6DecayTime.push(smootherCommon, param.value[ID::s6DecayTime]->getFloat());
+  interpS7DecayTime.push(smootherCommon, param.value[ID::s7DecayTime]->getFloat());
+
+  interpS0HoldTime.push(smootherCommon, param.value[ID::s0HoldTime]->getFloat());
+  interpS1HoldTime.push(smootherCommon, param.value[ID::s1HoldTime]->getFloat());
+  interpS2HoldTime.push(smootherCommon, param.value[ID::s2HoldTime]->getFloat());
+  interpS3HoldTime.push(smootherCommon, param.value[ID::s3HoldTime]->getFloat());
+  interpS4HoldTime.push(smootherCommon, param.value[ID::s4HoldTime]->getFloat());
+  interpS5HoldTime.push(smootherCommon, param.value[ID::s5HoldTime]->getFloat());
+  interpS6HoldTime.push(smootherCommon, param.value[ID::s6HoldTime]->getFloat());
+  interpS7HoldTime.push(smootherCommon, param.value[ID::s7HoldTime]->getFloat());
+
+  interpS0Level.push(smootherCommon, param.value[ID::s0Level]->getFloat());
+  interpS1Level.push(smootherCommon, param.value[ID::s1Level]->getFloat());
+  interpS2Level.push(smootherCommon, param.value[ID::s2Level]->getFloat());
+  interpS3Level.push(smootherCommon, param.value[ID::s3Level]->getFloat());
+  interpS4Level.push(smootherCommon, param.value[ID::s4Level]->getFloat());
+  interpS5Level.push(smootherCommon, param.value[ID::s5Level]->getFloat());
+  interpS6Level.push(smootherCommon, param.value[ID::s6Level]->getFloat());
+  interpS7Level.push(smootherCommon, param.value[ID::s7Level]->getFloat());
 }
 
 void DSPCore::process(const size_t length, const float **inputs, float *out0)
 {
   constexpr float gateThreshold = 1e-5f;
 
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     processMidiNote(i);
@@ -156,7 +156,7 @@ void DSPCore::noteOn(int32_t noteId, int16_t pitch, float tuning, float /* veloc
 
   if (param.value[ID::rateKeyFollow]->getInt()) {
     noteRatio = info.noteRatio;
-    interpRate.push(param.value[ID::rate]->getFloat() * noteRatio);
+    interpRate.push(smootherCommon, param.value[ID::rate]->getFloat() * noteRatio);
   }
 
   envelope.trigger();
@@ -173,7 +173,7 @@ void DSPCore::noteOff(int32_t noteId)
   using ID = ParameterID::ID;
   if (param.value[ID::rateKeyFollow]->getInt() && !noteStack.empty()) {
     noteRatio = noteStack.back().noteRatio;
-    interpRate.push(param.value[ID::rate]->getFloat() * noteRatio);
+    interpRate.push(smootherCommon, param.value[ID::rate]->getFloat() * noteRatio);
   }
 
   if (noteStack.empty() && !isGateOpen) envelope.release();
@@ -135,6 +135,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   ExpPolyEnvelope<double> envelope;
   LinearSmoother<float> interpGain;
 };
@@ -21,8 +21,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.002f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.002f);
 
   noteStack.reserve(128);
   noteStack.resize(0);
@@ -44,18 +44,18 @@ void DSPCore::setParameters(double tempo)
 
   bool isNoteOn = noteStack.size() != 0;
   for (size_t idx = 0; idx < nGate; ++idx) {
-    gates[idx].gain.push(param.value[ID::gain1 + idx]->getFloat());
+    gates[idx].gain.push(smootherCommon, param.value[ID::gain1 + idx]->getFloat());
     gates[idx].setType(param.value[ID::type1 + idx]->getInt(), isNoteOn);
   }
 
-  interpMasterGain.push(param.value[ID::masterGain]->getFloat());
+  interpMasterGain.push(smootherCommon, param.value[ID::masterGain]->getFloat());
 }
 
 void DSPCore::process(const size_t length, const float **inputs, float **outputs)
 {
   constexpr float gateThreshold = 1e-5f;
 
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     processMidiNote(i);
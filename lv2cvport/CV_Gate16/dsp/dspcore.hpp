@@ -88,6 +88,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   double tempo = 120.0f;
   bool gateOpen = false;
 
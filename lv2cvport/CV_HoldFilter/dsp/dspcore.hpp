@@ -44,6 +44,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   uint32_t overSample = 1;
   bool highpass = false;
   float output = 0;
@@ -41,6 +41,7 @@ public:
   Sample secondToDelta(Sample seconds) { return 1 / (sampleRate * seconds); }
 
   void trigger(
+    const SmootherCommon<Sample> &common,
     Sample attackTime,
     Sample decayTime,
     Sample sustainLevel,
@@ -51,17 +52,18 @@ public:
     value = Sample(1);
     atkOffset = state == stateTerminated ? 0 : out;
     atkRange = Sample(1) - atkOffset;
-    set(attackTime, decayTime, sustainLevel, releaseTime, noteFreq);
+    set(common, attackTime, decayTime, sustainLevel, releaseTime, noteFreq);
   }
 
   void set(
+    const SmootherCommon<Sample> &common,
     Sample attackTime,
     Sample decayTime,
     Sample sustainLevel,
     Sample releaseTime,
     Sample noteFreq)
   {
-    sus.push(std::clamp<Sample>(sustainLevel, Sample(0), Sample(1)));
+    sus.push(common, std::clamp<Sample>(sustainLevel, Sample(0), Sample(1)));
     atk = secondToDelta(adaptTime(attackTime, noteFreq));
     dec = secondToDelta(adaptTime(decayTime, noteFreq));
     rel = secondToDelta(adaptTime(releaseTime, noteFreq));
@@ -196,6 +198,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   std::vector<NoteInfo> noteStack; // Top of this stack is current note.
   LinearADSREnvelope<float> envelope;
   LinearSmoother<float> interpGain;
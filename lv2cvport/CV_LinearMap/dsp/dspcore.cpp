@@ -21,8 +21,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   reset();
 }
@@ -35,17 +35,15 @@ void DSPCore::setParameters()
 {
   using ID = ParameterID::ID;
 
-  interpAdd.push(
-    (int32_t(param.value[ID::addInt]->getInt()) - 128)
+  interpAdd.push(smootherCommon, (int32_t(param.value[ID::addInt]->getInt()) - 128)
     + param.value[ID::addFrac]->getFloat());
-  interpMul.push(
-    (int32_t(param.value[ID::mulInt]->getInt()) - 128)
+  interpMul.push(smootherCommon, (int32_t(param.value[ID::mulInt]->getInt()) - 128)
     + param.value[ID::mulFrac]->getFloat());
 }
 
 void DSPCore::process(const size_t length, const float *in0, float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     out0[i] = interpAdd.process() + interpMul.process() * in0[i];
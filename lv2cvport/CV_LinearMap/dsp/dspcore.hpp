@@ -35,6 +35,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   LinearSmoother<float> interpAdd;
   LinearSmoother<float> interpMul;
 };
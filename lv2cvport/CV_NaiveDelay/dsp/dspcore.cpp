@@ -21,8 +21,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   delay.setup(sampleRate, Scales::time.getMax());
 
@@ -45,8 +45,8 @@ void DSPCore::setParameters()
 {
   using ID = ParameterID::ID;
 
-  interpTime.push(param.value[ID::time]->getFloat());
-  interpFeedback.push(param.value[ID::feedback]->getFloat());
+  interpTime.push(smootherCommon, param.value[ID::time]->getFloat());
+  interpFeedback.push(smootherCommon, param.value[ID::feedback]->getFloat());
 }
 
 void DSPCore::process(
@@ -56,7 +56,7 @@ void DSPCore::process(
   const float *inFeedback,
   float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     out0[i] = delay.process(
@@ -43,6 +43,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   NaiveDelay<float> delay;
   LinearSmoother<float> interpTime;
   LinearSmoother<float> interpFeedback;
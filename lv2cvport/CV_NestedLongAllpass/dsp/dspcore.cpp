@@ -21,8 +21,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.04f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.04f);
 
   delay.setup(sampleRate, Scales::time.getMax());
 
@@ -51,21 +51,24 @@ void DSPCore::setParameters()
 {
   using ID = ParameterID::ID;
 
-  SmootherCommon<float>::setTime(param.value[ID::smoothness]->getFloat());
+  smootherCommon.setTime(param.value[ID::smoothness]->getFloat());
 
   auto timeMul = param.value[ID::timeMultiply]->getFloat();
   auto outerMul = param.value[ID::outerFeedMultiply]->getFloat();
   auto innerMul = param.value[ID::innerFeedMultiply]->getFloat();
   for (size_t idx = 0; idx < nestingDepth; ++idx) {
-    interpTime[idx].push(timeMul * param.value[ID::time0 + idx]->getFloat());
-    interpOuterFeed[idx].push(outerMul * param.value[ID::outerFeed0 + idx]->getFloat());
-    interpInnerFeed[idx].push(innerMul * param.value[ID::innerFeed0 + idx]->getFloat());
+    interpTime[idx].push(
+      smootherCommon, timeMul * param.value[ID::time0 + idx]->getFloat());
+    interpOuterFeed[idx].push(
+      smootherCommon, outerMul * param.value[ID::outerFeed0 + idx]->getFloat());
+    interpInnerFeed[idx].push(
+      smootherCommon, innerMul * param.value[ID::innerFeed0 + idx]->getFloat());
   }
 }
 
 void DSPCore::process(const size_t length, const float *in0, float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     for (size_t idx = 0; idx < nestingDepth; ++idx) {
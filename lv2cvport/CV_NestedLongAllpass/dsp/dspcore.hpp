@@ -40,6 +40,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   NestedLongAllpass<float, nestingDepth> delay;
   std::array<LinearSmoother<float>, nestingDepth> interpTime;
   std::array<LinearSmoother<float>, nestingDepth> interpOuterFeed;
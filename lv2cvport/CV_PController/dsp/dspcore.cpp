@@ -21,8 +21,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   reset();
 }
@@ -33,8 +33,7 @@ void DSPCore::startup() {}
 
 void DSPCore::setParameters()
 {
-  interpP.push(
-    param.value[ParameterID::bypass]->getInt()
+  interpP.push(smootherCommon, param.value[ParameterID::bypass]->getInt()
       ? 1.0f
       : PController<double>::cutoffToP(
         sampleRate, param.value[ParameterID::cutoff]->getFloat()));
@@ -42,7 +41,7 @@ void DSPCore::setParameters()
 
 void DSPCore::process(const size_t length, const float *in0, float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     pController.setP(interpP.process());
@@ -36,6 +36,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   PController<float> pController;
   LinearSmoother<float> interpP;
 };
@@ -31,8 +31,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   oscillator.setup(sampleRate);
 
@@ -63,16 +63,17 @@ void DSPCore::setParameters()
   using ID = ParameterID::ID;
 
   if (!noteStack.empty()) lastFreq = noteStack.back().frequency;
-  interpFrequency.push(
-    lastFreq
+  interpFrequency.push(smootherCommon, lastFreq
     * paramToPitch(
       param.value[ParameterID::oscSemi]->getFloat() - 60,
       param.value[ParameterID::oscMilli]->getFloat(),
       param.value[ParameterID::pitchBend]->getFloat()));
-  interpGain.push(param.value[ID::gain]->getFloat() * param.value[ID::boost]->getFloat());
-  interpPulseWidth.push(param.value[ParameterID::pulseWidth]->getFloat());
-  interpSlope.push(param.value[ParameterID::slope]->getFloat());
-  interpSlopeMul.push(param.value[ID::slopeMultiply]->getFloat());
+  interpGain.push(
+    smootherCommon,
+    param.value[ID::gain]->getFloat() * param.value[ID::boost]->getFloat());
+  interpPulseWidth.push(smootherCommon, param.value[ParameterID::pulseWidth]->getFloat());
+  interpSlope.push(smootherCommon, param.value[ParameterID::slope]->getFloat());
+  interpSlopeMul.push(smootherCommon, param.value[ID::slopeMultiply]->getFloat());
 }
 
 void DSPCore::process(
@@ -84,7 +85,7 @@ void DSPCore::process(
   const float *inOscSlope,
   float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     processMidiNote(i);
@@ -100,6 +100,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
 
   float lastFreq = 0;
   PTRTrapezoidOsc oscillator;
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cinttypes>
 #include <cmath>
 
@@ -31,7 +32,22 @@ public:
     setFreq(0);
   }
 
-  void setFreq(double hz) { tick = 2.0 * fabs(hz) / sampleRate; }
+  void setFreq(double hz)
+  {
+    tick = 2.0 * fabs(hz) / sampleRate;
+
+    // Order of PTR is reduced at high frequency. Kernel is picked here, not per sample.
+    using Tpz = PTRTrapezoidOsc;
+    static constexpr std::array<PtrFunc, 6> ptrTable{
+      &Tpz::branch<Tpz::ptrRamp2>, &Tpz::branch<Tpz::ptrRamp2>,
+      &Tpz::branch<Tpz::ptrRamp2>, &Tpz::branch<Tpz::ptrRamp3>,
+      &Tpz::branch<Tpz::ptrRamp4>, &Tpz::branch<Tpz::ptrRamp5>};
+
+    uint32_t order = 5;
+    if (order > double(0.25) / tick) order = int(double(0.25) / tick);
+    ptrLen = order * tick;
+    ptrFunc = ptrTable[order];
+  }
   void setPhase(double phase) { this->phase = phase; }
   void addPhase(double phase) { this->phase += phase; }
   void setSlope(double slope) { this->slope = fabs(slope); }
@@ -43,7 +59,7 @@ public:
     if (tick <= 0) return 0;
     phase += tick;
     phase -= floor(phase + tick);
-    return ptrTpz5(phase, tick, slope, pw);
+    return ptrTpz(phase, tick, slope, pw);
   }
 
   double sampleRate;
@@ -53,14 +69,14 @@ public:
   double pw = double(0.5); // Pulse width.
 
 protected:
-  // tick must be greater than 0.
-  static double ptrTpz5(double phase, double tick, double slope, double pw)
-  {
-    uint32_t order = 5;
-    if (order > double(0.25) / tick) order = int(double(0.25) / tick);
+  using PtrFunc = double (*)(double, double, double, double, double);
 
-    const double ptrLen = order * tick;
+  double ptrLen = 0;
+  PtrFunc ptrFunc = &PTRTrapezoidOsc::branch<PTRTrapezoidOsc::ptrRamp5>;
 
+  // tick must be greater than 0.
+  double ptrTpz(double phase, double tick, double slope, double pw)
+  {
     const double maxSlope = double(0.25) / ptrLen;
     if (slope > maxSlope) {
       slope = maxSlope;
@@ -74,13 +90,7 @@ protected:
 
     const double y = double(1) - double(2) * slope * ptrLen;
     const double dc = (y * y + pw * slope * y) / (double(2) * y + slope - double(1));
-    if (order == 5)
-      return branch<PTRTrapezoidOsc::ptrRamp5>(slope, pw, y, phase, tick) - dc;
-    else if (order == 4)
-      return branch<PTRTrapezoidOsc::ptrRamp4>(slope, pw, y, phase, tick) - dc;
-    else if (order == 3)
-      return branch<PTRTrapezoidOsc::ptrRamp3>(slope, pw, y, phase, tick) - dc;
-    return branch<PTRTrapezoidOsc::ptrRamp2>(slope, pw, y, phase, tick) - dc;
+    return ptrFunc(slope, pw, y, phase, tick) - dc;
   }
 
   template<double (*ptrfunc)(double, double)>
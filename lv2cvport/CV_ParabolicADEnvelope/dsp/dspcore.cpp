@@ -21,8 +21,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   envelope.setup(sampleRate);
 
@@ -43,12 +43,12 @@ void DSPCore::setParameters()
 {
   using ID = ParameterID::ID;
 
-  interpGain.push(param.value[ID::gain]->getFloat());
+  interpGain.push(smootherCommon, param.value[ID::gain]->getFloat());
 }
 
 void DSPCore::process(const size_t length, float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     processMidiNote(i);
@@ -157,6 +157,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   std::vector<NoteInfo> noteStack; // Top of this stack is current note.
   ParabolicADEnvelope<float> envelope;
   LinearSmoother<float> interpGain;
@@ -27,8 +27,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   interpRate.setSampleRate(sampleRate);
 
@@ -56,21 +56,23 @@ void DSPCore::setParameters()
     param.value[ParameterID::loopStart]->getInt(),
     param.value[ParameterID::loopEnd]->getInt());
 
-  interpGain.push(param.value[ID::gain]->getFloat());
+  interpGain.push(smootherCommon, param.value[ID::gain]->getFloat());
 
   float rateRatio = param.value[ID::rateKeyFollow]->getInt() ? noteRatio : 1.0f;
   float rateSlideTime = param.value[ParameterID::rateSlideTime]->getFloat();
-  interpRate.push(param.value[ID::rate]->getFloat() * rateRatio);
+  interpRate.push(smootherCommon, param.value[ID::rate]->getFloat() * rateRatio);
   interpRate.setTime(rateSlideTime);
 
-  interpReleaseTime.push(param.value[ID::releaseTime]->getFloat());
-  interpReleaseCurve.push(param.value[ID::releaseCurve]->getFloat());
+  interpReleaseTime.push(smootherCommon, param.value[ID::releaseTime]->getFloat());
+  interpReleaseCurve.push(smootherCommon, param.value[ID::releaseCurve]->getFloat());
 
   for (size_t idx = 0; idx < envelope.nSections; ++idx) {
-    interpDecayTime[idx].push(param.value[ID::s0DecayTime + idx]->getFloat());
-    interpHoldTime[idx].push(param.value[ID::s0HoldTime + idx]->getFloat());
-    interpLevel[idx].push(param.value[ID::s0Level + idx]->getFloat());
-    interpCurve[idx].push(param.value[ID::s0Curve + idx]->getFloat());
+    interpDecayTime[idx].push(
+      smootherCommon, param.value[ID::s0DecayTime + idx]->getFloat());
+    interpHoldTime[idx].push(
+      smootherCommon, param.value[ID::s0HoldTime + idx]->getFloat());
+    interpLevel[idx].push(smootherCommon, param.value[ID::s0Level + idx]->getFloat());
+    interpCurve[idx].push(smootherCommon, param.value[ID::s0Curve + idx]->getFloat());
   }
 }
 
@@ -78,7 +80,7 @@ void DSPCore::process(const size_t length, const float **inputs, float *out0)
 {
   constexpr float gateThreshold = 1e-5f;
 
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     processMidiNote(i);
@@ -151,7 +153,7 @@ void DSPCore::noteOn(int32_t noteId, int16_t pitch, float tuning, float /* veloc
 
   if (param.value[ID::rateKeyFollow]->getInt()) {
     noteRatio = info.noteRatio;
-    interpRate.push(param.value[ID::rate]->getFloat() * noteRatio);
+    interpRate.push(smootherCommon, param.value[ID::rate]->getFloat() * noteRatio);
   }
 
   envelope.trigger();
@@ -168,7 +170,7 @@ void DSPCore::noteOff(int32_t noteId)
   using ID = ParameterID::ID;
   if (param.value[ID::rateKeyFollow]->getInt() && !noteStack.empty()) {
     noteRatio = noteStack.back().noteRatio;
-    interpRate.push(param.value[ID::rate]->getFloat() * noteRatio);
+    interpRate.push(smootherCommon, param.value[ID::rate]->getFloat() * noteRatio);
   }
 
   if (noteStack.size() == 0 && !isGateOpen) envelope.release();
@@ -126,6 +126,7 @@ private:
   std::vector<NoteInfo> noteStack; // Top of this stack is current note.
 
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   float noteRatio = 1.0f;
   bool isGateOpen = false;
 
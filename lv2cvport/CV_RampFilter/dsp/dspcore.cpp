@@ -21,8 +21,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   reset();
 }
@@ -41,15 +41,15 @@ void DSPCore::setParameters()
 
   overSample = param.value[ID::overSampling]->getInt() ? 4 : 1;
 
-  SmootherCommon<float>::setSampleRate(sampleRate * overSample);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate * overSample);
+  smootherCommon.setTime(0.01f);
 
-  interpGain.push(param.value[ID::gain]->getFloat());
-  interpCutoff.push(param.value[ID::cutoff]->getFloat());
-  interpResonance.push(param.value[ID::resonance]->getFloat());
-  interpRampLimit.push(param.value[ID::rampLimit]->getFloat());
-  interpBias.push(param.value[ID::bias]->getFloat());
-  interpBiasTuning.push(param.value[ID::biasTuning]->getFloat());
+  interpGain.push(smootherCommon, param.value[ID::gain]->getFloat());
+  interpCutoff.push(smootherCommon, param.value[ID::cutoff]->getFloat());
+  interpResonance.push(smootherCommon, param.value[ID::resonance]->getFloat());
+  interpRampLimit.push(smootherCommon, param.value[ID::rampLimit]->getFloat());
+  interpBias.push(smootherCommon, param.value[ID::bias]->getFloat());
+  interpBiasTuning.push(smootherCommon, param.value[ID::biasTuning]->getFloat());
 
   filter.highpass = param.value[ID::highpass]->getInt();
 }
@@ -61,7 +61,7 @@ void DSPCore::process(
   const float *inResonance,
   float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length * overSample);
+  smootherCommon.setBufferSize(length * overSample);
 
   for (size_t i = 0; i < length; ++i) {
     inputInterp.push(in0[i]);
@@ -42,6 +42,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   uint32_t overSample = 1;
   float output = 0;
 
@@ -21,8 +21,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   rateLimiter.setup(sampleRate);
 
@@ -35,14 +35,16 @@ void DSPCore::startup() {}
 
 void DSPCore::setParameters()
 {
-  interpRisingSlewRate.push(param.value[ParameterID::risingSlewRate]->getFloat());
+  interpRisingSlewRate.push(
+    smootherCommon, param.value[ParameterID::risingSlewRate]->getFloat());
   interpFallingSlewRate.push(
+    smootherCommon,
     -param.value[ParameterID::fallingSlewRate]->getFloat()); // Must be negative.
 }
 
 void DSPCore::process(const size_t length, const float *in0, float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     rateLimiter.setRate(interpRisingSlewRate.process(), interpFallingSlewRate.process());
@@ -67,6 +67,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   RateLimiter<float> rateLimiter;
   LinearSmoother<float> interpRisingSlewRate;
   LinearSmoother<float> interpFallingSlewRate;
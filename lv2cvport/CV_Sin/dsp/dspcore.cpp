@@ -31,8 +31,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   noteStack.reserve(128);
   noteStack.resize(0);
@@ -60,13 +60,14 @@ void DSPCore::setParameters()
   if (!noteStack.empty()) {
     lastFreq = noteStack.back().frequency;
   }
-  interpFrequency.push(
-    lastFreq
+  interpFrequency.push(smootherCommon, lastFreq
     * paramToPitch(
       param.value[ParameterID::oscSemi]->getFloat() - 60,
       param.value[ParameterID::oscMilli]->getFloat(),
       param.value[ParameterID::pitchBend]->getFloat()));
-  interpGain.push(param.value[ID::gain]->getFloat() * param.value[ID::boost]->getFloat());
+  interpGain.push(
+    smootherCommon,
+    param.value[ID::gain]->getFloat() * param.value[ID::boost]->getFloat());
 }
 
 void DSPCore::process(
@@ -76,7 +77,7 @@ void DSPCore::process(
   const float *inPhase,
   float *out0)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     processMidiNote(i);
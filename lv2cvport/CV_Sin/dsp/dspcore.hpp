@@ -97,6 +97,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
 
   float lastFreq = 0;
   float phase = 0;
@@ -21,8 +21,8 @@ void DSPCore::setup(double sampleRate)
 {
   this->sampleRate = sampleRate;
 
-  SmootherCommon<float>::setSampleRate(sampleRate);
-  SmootherCommon<float>::setTime(0.01f);
+  smootherCommon.setSampleRate(sampleRate);
+  smootherCommon.setTime(0.01f);
 
   reset();
 }
@@ -37,8 +37,8 @@ void DSPCore::startup() {}
 
 void DSPCore::setParameters()
 {
-  interpGain.push(param.value[ParameterID::gain]->getFloat());
-  interpDc.push(param.value[ParameterID::dc]->getFloat());
+  interpGain.push(smootherCommon, param.value[ParameterID::gain]->getFloat());
+  interpDc.push(smootherCommon, param.value[ParameterID::dc]->getFloat());
 }
 
 void DSPCore::process(
@@ -49,7 +49,7 @@ void DSPCore::process(
   float *out0,
   float *out1)
 {
-  SmootherCommon<float>::setBufferSize(length);
+  smootherCommon.setBufferSize(length);
 
   for (size_t i = 0; i < length; ++i) {
     const float dc = interpDc.process();
@@ -41,6 +41,7 @@ public:
 
 private:
   float sampleRate = 44100.0f;
+  SmootherCommon<float> smootherCommon;
   LinearSmoother<float> interpGain;
   LinearSmoother<float> interpDc;
 };
@@ -23,11 +23,16 @@ def get_enum_range(code):
     enum = re.findall(
         r"namespace ParameterID \{\nenum ID.*\{([\s\S]*)\};\n\} // namespace ParameterID",
         code)
-    enum = [
-        line.strip().replace(",", "")
-        for line in enum[0].split("\n")
-        if line.strip() != "" and "//" not in line
-    ]
+    enum = [line.split("//")[0].strip().replace(",", "") for line in enum[0].split("\n")]
+    enum = [line for line in enum if line != ""]
+
+    # Enum values may refer constants like `innerFeed0 = 2 * nDepth1`.
+    constants = {}
+    for name, expr in re.findall(r"constexpr\s+[\w:]+\s+(\w+)\s*=\s*([^;]+);", code):
+        try:
+            constants[name] = eval(expr.replace("/", "//"), {}, constants)
+        except (NameError, SyntaxError):
+            pass
 
     temp = []
     index = -1
@@ -37,7 +42,7 @@ def get_enum_range(code):
             temp.append({"name": line, "index": index})
             continue
         name, end_str = line.replace(" ", "").split("=")
-        index = int(end_str)
+        index = int(eval(end_str.replace("/", "//"), {}, constants))
         temp.append({"name": name, "index": index})
 
     index = 0
@@ -51,7 +56,7 @@ def get_enum_range(code):
         enum[name] = elem
     return enum
 
-def extract_parameter(parameter_hpp_path):
+def extract_parameter(parameter_hpp_path, json_dir=Path(__file__).parent / Path("json")):
     with open(parameter_hpp_path, "r", encoding="utf-8") as fi:
         code = fi.read()
 
@@ -81,6 +86,7 @@ def extract_parameter(parameter_hpp_path):
                 data[f"{basename}{i}"] = {
                     "type": datatype,
                     "index": code,
+                    "position": enum[name]["index"] + i,
                     "default": convert_string(default),
                     "scale": matched[3],
                     "flags": matched[4],
@@ -89,12 +95,13 @@ def extract_parameter(parameter_hpp_path):
             data[matched[0]] = {
                 "type": datatype,
                 "index": matched[0],
+                "position": enum[matched[0]]["index"],
                 "default": convert_string(matched[2]),
                 "scale": matched[3],
                 "flags": matched[4],
             }
 
-    json_dir = Path(__file__).parent / Path("json")
+    json_dir = Path(json_dir)
     json_dir.mkdir(parents=True, exist_ok=True)
     with open(json_dir / Path(f"{plugin_name}.type.json"), "w", encoding="utf-8") as fi:
         json.dump(data, fi, indent=2)
@@ -102,14 +109,18 @@ def extract_parameter(parameter_hpp_path):
 if __name__ == "__main__":
     if len(sys.argv) < 2:
         print("Requires parameter.hpp file path as first argument.")
+        print("Optional second argument is output directory. Default is preset/json.")
         exit(1)
 
-    if len(sys.argv) > 2:
-        print("Only first argument is used. Second or later arguments are discarded.")
+    if len(sys.argv) > 3:
+        print("Only first 2 arguments are used. Third or later arguments are discarded.")
 
     parameter_hpp_path = Path(sys.argv[1])
     if not parameter_hpp_path.exists():
         print("Path doesn't exist.")
         exit(1)
 
-    extract_parameter(parameter_hpp_path)
+    if len(sys.argv) > 2:
+        extract_parameter(parameter_hpp_path, Path(sys.argv[2]))
+    else:
+        extract_parameter(parameter_hpp_path)
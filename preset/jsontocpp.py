@@ -2,6 +2,51 @@ import json
 import sys
 from pathlib import Path
 
+def preset_bank_code(rows, width=90):
+    """
+    `rows` is a list of `(name, values)`. `values` are C++ literals ordered by
+    `ParameterID::ID`. Integer parameters take raw value, and others take normalized
+    value. `presetKeep` leaves the parameter unchanged.
+    """
+    indent = "  "
+
+    code = """#include "parameter.hpp"
+
+// Generated from preset dump.
+#ifndef TEST_BUILD
+
+using PresetBank = std::array<
+  std::array<double, ParameterID::ID_ENUM_LENGTH>,
+  GlobalParameter::Preset_ENUM_LENGTH>;
+
+static constexpr PresetBank presetBank{{
+"""
+    for name, values in rows:
+        code += f"{indent}// {name}\n{indent}{{{{\n"
+        line = indent * 2
+        for value in values:
+            item = f"{value},"
+            if len(line) + len(item) + 1 > width:
+                code += line.rstrip() + "\n"
+                line = indent * 2
+            line += item + " "
+        code += line.rstrip() + "\n"
+        code += f"{indent}}}}},\n"
+    code += """}};
+
+void GlobalParameter::loadProgram(uint32_t index)
+{
+  if (index >= presetBank.size()) {
+    resetParameter();
+    return;
+  }
+  value.load(presetBank[index]);
+}
+
+#endif
+"""
+    return code
+
 def json_to_cpp(type_json_path, preset_json_path, prefix="preset"):
     """
     Add prefix to preset name because C++ identifier couldn't start with number, symbols etc.
@@ -19,39 +64,17 @@ def json_to_cpp(type_json_path, preset_json_path, prefix="preset"):
 
     indent = "  "
 
-    # loadProgram() method
-    code = """#include "parameter.hpp"
-
-// Generated from preset dump.
-#ifndef TEST_BUILD
-
-void GlobalParameter::loadProgram(uint32_t index)
-{
-  using ID = ParameterID::ID;
-
-  switch (index) {
-    default:
-      resetParameter();
-      break;
-"""
+    # Preset bank and loadProgram() method.
+    n_parameter = max(it["position"] for it in parameter_type.values()) + 1
+    rows = []
     for preset in preset_list:
-        name = preset["name"]
-        code += f"\n{indent * 2}case {prefix + name}: {{\n"
+        row = ["presetKeep"] * n_parameter
         for name, value in preset["parameter"].items():
-            dtype = parameter_type[name]["type"]
-            index = parameter_type[name]["index"]
             if name == "bypass":
                 value = 0
-
-            if dtype == "I":
-                code += f"{indent * 3}value[ID::{index}]->setFromInt({value});\n"
-            elif dtype == "d":
-                code += f"{indent * 3}value[ID::{index}]->setFromNormalized({value});\n"
-            else:
-                code += f"{indent * 3}value[ID::{index}]->setFromNormalized({value});\n"
-
-        code += f"{indent * 2}}} break;\n"
-    code += f"{indent}}}\n}}\n\n#endif\n"
+            row[parameter_type[name]["position"]] = f"{value}"
+        rows.append((preset["name"], row))
+    code = preset_bank_code(rows)
 
     out_dir = Path(__file__).parent / Path("cpp")
     out_dir.mkdir(parents=True, exist_ok=True)
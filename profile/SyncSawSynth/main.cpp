@@ -1,7 +1,9 @@
 #include <sndfile.h>
 #include <string.h>
 
+#include <chrono>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include "../../SyncSawSynth/dsp/dspcore.hpp"
@@ -23,7 +25,7 @@ writeWave(const char *filename, std::vector<float> &buffer, const size_t &sample
   }
 
   size_t length = sfinfo.channels * buffer.size();
-  if (sf_write_float(file, &buffer[0], length) != length)
+  if (sf_write_float(file, &buffer[0], length) != (sf_count_t)length)
     std::cout << sf_strerror(file) << std::endl;
 
   sf_close(file);
@@ -34,6 +36,7 @@ writeWave(const char *filename, std::vector<float> &buffer, const size_t &sample
 constexpr size_t BUF_LEN = 512;
 constexpr size_t N_LOOP = 127;
 constexpr float sampleRate = 44100.0f;
+constexpr float tempo = 120.0f;
 
 int main()
 {
@@ -43,30 +46,58 @@ int main()
 
   float sig[2][BUF_LEN];
 
-  DSPCore dsp;
-  dsp.setup(sampleRate);
+  std::unique_ptr<DSPInterface> dsp;
 
-  dsp.param.value[ParameterID::gainR]->setFromNormalized(1.0);
-  dsp.param.value[ParameterID::filterR]->setFromNormalized(1.0);
+  auto iset = instrset_detect();
 
-  dsp.setParameters();
+  std::cout << "instrset: " << std::to_string(iset) << std::endl;
 
-  for (int32_t n = 0; n < dsp.maxVoice; ++n) dsp.noteOn(n, 48 + n, 0, 0.5);
-  dsp.setParameters();
-  dsp.process(BUF_LEN, sig[0], sig[1]);
+  if (iset >= 10) { // AVX512
+    dsp = std::make_unique<DSPCore_AVX512>();
+  } else if (iset >= 8) { // AVX2
+    dsp = std::make_unique<DSPCore_AVX2>();
+  } else if (iset >= 5) { // SSE4.1
+    dsp = std::make_unique<DSPCore_SSE41>();
+  } else if (iset >= 2) { // SSE2
+    dsp = std::make_unique<DSPCore_SSE2>();
+  } else {
+    std::cerr << "\nError: Instruction set SSE2 not supported on this computer";
+    exit(EXIT_FAILURE);
+  }
+
+  dsp->setup(sampleRate);
+
+  dsp->param.value[ParameterID::gainR]->setFromNormalized(1.0);
+  dsp->param.value[ParameterID::filterR]->setFromNormalized(1.0);
+
+  dsp->setParameters(tempo);
 
+  for (size_t n = 0; n < dsp->maxVoice; ++n) dsp->noteOn(n, 48 + n, 0, 0.5);
+  dsp->setParameters(tempo);
+  dsp->process(BUF_LEN, sig[0], sig[1]);
+
+  double sumElapsed = 0.0;
   for (size_t i = 0; i < N_LOOP; ++i) {
     if (i == 20) // 20 * BUF_LEN / sampleRate [seconds].
-      for (int32_t n = 0; n < dsp.maxVoice; ++n) dsp.noteOff(n);
-    dsp.setParameters();
-    dsp.process(BUF_LEN, sig[0], sig[1]);
+      for (size_t n = 0; n < dsp->maxVoice; ++n) dsp->noteOff(n);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    dsp->setParameters(tempo);
+    dsp->process(BUF_LEN, sig[0], sig[1]);
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> elapsed = finish - start;
+    sumElapsed += elapsed.count();
+
     for (size_t j = 0; j < BUF_LEN; ++j) {
       wav[wavIndex] = sig[0][j];
       wavIndex += 1;
     }
   }
 
-  std::cout << std::to_string(sig[0][0]) << "\n";
+  const char *name = "SyncSawSynth";
+  std::cout << name << "\n"
+            << "Total[ms]" << std::to_string(sumElapsed) << "\n"
+            << "Average[ms]" << std::to_string(sumElapsed / N_LOOP) << "\n\n";
 
   writeWave("test.wav", wav, sampleRate);
 }
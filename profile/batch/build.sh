@@ -0,0 +1,86 @@
+#!/bin/bash
+#
+# Checks that `DSPBatch` of each effect renders the same as one `DSPCore` per instance.
+# Every SIMD variant supported by the CPU is checked. Exits with non-zero status when any
+# plugin fails.
+#
+# Usage:
+#   ./build.sh                         # Check all plugins.
+#   ./build.sh SoftClipper CV_3PoleLP  # Check specified plugins.
+#
+
+# Name, tolerance relative to 1 + |DSPCore output|.
+PLUGINS=(
+  "FoldShaper 1e-3"
+  "OddPowShaper 1e-2" # Folding at high drive amplifies rounding of oversampler.
+  "SoftClipper 1e-3" # Lanes use `pow` of VCL, and DSPCore uses `somepow`.
+)
+
+function compile_simd() {
+  local base
+  base=$(basename "$1")
+  g++ -DTEST_BUILD -O3 -fPIC -mavx512f -mfma -mavx512vl -mavx512bw -mavx512dq -std=c++17 -c "$1" -o"$2/$base.avx512.o" &&
+  g++ -DTEST_BUILD -O3 -fPIC -mavx2 -mfma -std=c++17 -c "$1" -o"$2/$base.avx2.o" &&
+  g++ -DTEST_BUILD -O3 -fPIC -msse4.1 -std=c++17 -c "$1" -o"$2/$base.sse41.o" &&
+  g++ -DTEST_BUILD -O3 -fPIC -msse2 -std=c++17 -c "$1" -o"$2/$base.sse2.o"
+}
+
+function compare() {
+  local name=$1
+  local tolerance=$2
+  local buildDir="build/$name"
+  mkdir -p "$buildDir"
+
+  echo Compiling "$name"
+  compile_simd "../../$name/dsp/dspcore.cpp" "$buildDir" || return 1
+
+  # If CPU doesn't support AVX512, changing order of *.o file cause SIGILL (illegal instruction).
+  # See: https://stackoverflow.com/questions/15406658/cpu-dispatcher-for-visual-studio-for-avx-and-sse
+  g++ -std=c++17 -O3 -Wall -DTEST_BUILD \
+    -DPLUGIN_DSPCORE="\"../../$name/dsp/dspcore.hpp\"" \
+    -o "$buildDir/batch" \
+    ../../lib/vcl/instrset_detect.cpp \
+    "$buildDir/dspcore.cpp.sse2.o" \
+    "$buildDir/dspcore.cpp.sse41.o" \
+    "$buildDir/dspcore.cpp.avx2.o" \
+    "$buildDir/dspcore.cpp.avx512.o" \
+    "../../$name/parameter.cpp" \
+    main.cpp \
+    -lpthread || return 1
+
+  "$buildDir/batch" "$name" "$tolerance"
+}
+
+# CV_3PoleLP is built without dispatching on instruction set.
+function compare_cv3polelp() {
+  local buildDir="build/CV_3PoleLP"
+  mkdir -p "$buildDir"
+
+  echo Compiling CV_3PoleLP
+  g++ -std=c++17 -O3 -Wall -DTEST_BUILD -msse2 \
+    -o "$buildDir/batch" \
+    ../../lv2cvport/CV_3PoleLP/dsp/dspcore.cpp \
+    ../../lv2cvport/CV_3PoleLP/parameter.cpp \
+    cv3polelp.cpp || return 1
+
+  "$buildDir/batch"
+}
+
+cd "$(dirname "$0")" || exit 1
+
+failed=()
+for entry in "${PLUGINS[@]}"; do
+  read -r name tolerance <<< "$entry"
+  if [[ $# -gt 0 && ! " $* " =~ " $name " ]]; then continue; fi
+  compare "$name" "$tolerance" || failed+=("$name")
+done
+
+if [[ $# -eq 0 || " $* " =~ " CV_3PoleLP " ]]; then
+  compare_cv3polelp || failed+=("CV_3PoleLP")
+fi
+
+if [[ ${#failed[@]} -gt 0 ]]; then
+  echo "Failed: ${failed[*]}"
+  exit 1
+fi
+echo "All passed."
@@ -0,0 +1,101 @@
+// Renders random instances of CV_3PoleLP through one DSPCore per instance, and through
+// DSPBatch, then compares them per stream. Both use the same operations, so the output is
+// expected to be bit exact.
+//
+// Build and run with `build.sh`.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "../../lv2cvport/CV_3PoleLP/dsp/dspcore.hpp"
+
+constexpr size_t BUF_LEN = 256;
+constexpr size_t N_LOOP = 400;
+constexpr size_t N_INSTANCE = 7; // Leaves a partial group of 4 lanes.
+constexpr size_t N_INPUT = 4;    // Audio, cutoff, resonance and decay.
+constexpr float sampleRate = 48000.0f;
+
+// Linear congruential generator, to get the same parameters on any standard library.
+struct Rng {
+  uint32_t state = 1;
+  float operator()()
+  {
+    state = 1664525u * state + 1013904223u;
+    return float(state >> 8) / float(1 << 24);
+  }
+};
+
+int main()
+{
+  Rng rng;
+
+  std::vector<std::unique_ptr<DSPCore>> core;
+  for (size_t idx = 0; idx < N_INSTANCE; ++idx) {
+    core.push_back(std::make_unique<DSPCore>());
+    auto &param = core.back()->param;
+    for (size_t id = 0; id < param.value.size(); ++id)
+      param.value[id]->setFromNormalized(rng());
+    core.back()->setup(sampleRate);
+  }
+
+  DSPBatch batch;
+  batch.setup(sampleRate, N_INSTANCE);
+
+  std::vector<std::vector<std::vector<float>>> in(
+    N_INPUT, std::vector<std::vector<float>>(N_INSTANCE, std::vector<float>(BUF_LEN)));
+  std::vector<std::vector<float>> outCore(N_INSTANCE, std::vector<float>(BUF_LEN));
+  std::vector<std::vector<float>> outBatch(N_INSTANCE, std::vector<float>(BUF_LEN));
+
+  std::vector<std::vector<const float *>> inPtr(N_INPUT);
+  std::vector<float *> outPtr;
+  for (size_t idx = 0; idx < N_INSTANCE; ++idx) {
+    for (size_t port = 0; port < N_INPUT; ++port)
+      inPtr[port].push_back(in[port][idx].data());
+    outPtr.push_back(outBatch[idx].data());
+  }
+
+  size_t nMismatch = 0;
+  double maxDiff = 0.0;
+  for (size_t i = 0; i < N_LOOP; ++i) {
+    // Parameters are changed once in a while to exercise smoothers.
+    if (i % 100 == 50) {
+      for (auto &dsp : core) {
+        dsp->param.value[ParameterID::cutoff]->setFromNormalized(rng());
+        dsp->param.value[ParameterID::resonance]->setFromNormalized(rng());
+      }
+    }
+
+    // Inputs are in [-0.5, 0.5]. Wider cutoff CV goes above Nyquist frequency.
+    for (auto &port : in)
+      for (auto &ch : port)
+        for (auto &x : ch) x = rng() - 0.5f;
+
+    for (size_t idx = 0; idx < N_INSTANCE; ++idx) {
+      core[idx]->setParameters();
+      core[idx]->process(
+        BUF_LEN, in[0][idx].data(), in[1][idx].data(), in[2][idx].data(),
+        in[3][idx].data(), outCore[idx].data());
+      batch.setParameters(idx, core[idx]->param);
+    }
+    batch.process(
+      BUF_LEN, inPtr[0].data(), inPtr[1].data(), inPtr[2].data(), inPtr[3].data(),
+      outPtr.data());
+
+    for (size_t idx = 0; idx < N_INSTANCE; ++idx) {
+      for (size_t j = 0; j < BUF_LEN; ++j) {
+        const double diff = std::fabs(double(outBatch[idx][j]) - outCore[idx][j]);
+        if (!(diff == 0.0)) ++nMismatch; // Also counts NaN.
+        if (std::isfinite(diff)) maxDiff = std::max(maxDiff, diff);
+      }
+    }
+  }
+
+  std::cout << "CV_3PoleLP: " << nMismatch << " samples differ. Max difference is "
+            << maxDiff << (nMismatch == 0 ? "" : " FAIL") << "\n";
+  return nMismatch == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
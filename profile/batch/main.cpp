@@ -0,0 +1,178 @@
+// Renders random instances of an effect through one DSPCore per instance, and through
+// DSPBatch, then compares them per stream.
+//
+// Build and run with `build.sh`, which sets `PLUGIN_DSPCORE`.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include PLUGIN_DSPCORE
+
+constexpr size_t BUF_LEN = 256;
+constexpr size_t N_LOOP = 400;
+constexpr size_t N_INSTANCE = 5; // 10 streams. Leaves a partial group at every width.
+constexpr float sampleRate = 48000.0f;
+constexpr float tempo = 120.0f;
+
+struct OversampleSetting {
+  uint32_t oversample;
+  uint32_t factor;
+  uint32_t linearPhase;
+};
+
+struct Variant {
+  const char *name;
+  int instrset; // Minimum value of `instrset_detect()`.
+  std::function<std::unique_ptr<DSPInterface>()> createCore;
+  std::function<std::unique_ptr<DSPBatchInterface>()> createBatch;
+};
+
+// Linear congruential generator, to get the same parameters on any standard library.
+struct Rng {
+  uint32_t state = 1;
+  float operator()()
+  {
+    state = 1664525u * state + 1013904223u;
+    return float(state >> 8) / float(1 << 24);
+  }
+};
+
+void randomize(GlobalParameter &param, Rng &rng, const OversampleSetting &setting)
+{
+  using ID = ParameterID::ID;
+
+  for (size_t id = 0; id < param.value.size(); ++id) {
+    if (id == ID::bypass) continue;
+    param.value[id]->setFromNormalized(rng());
+  }
+  param.value[ID::bypass]->setFromInt(0);
+  param.value[ID::oversample]->setFromInt(setting.oversample);
+  param.value[ID::oversampleFactor]->setFromInt(setting.factor);
+  param.value[ID::linearPhase]->setFromInt(setting.linearPhase);
+}
+
+// Returns true when all outputs match within tolerance.
+bool compare(
+  const std::string &name,
+  const Variant &variant,
+  const OversampleSetting &setting,
+  double tolerance)
+{
+  constexpr size_t nStream = 2 * N_INSTANCE;
+
+  Rng rng;
+  std::vector<std::unique_ptr<DSPInterface>> core;
+  for (size_t idx = 0; idx < N_INSTANCE; ++idx) {
+    core.push_back(variant.createCore());
+    randomize(core.back()->param, rng, setting);
+    core.back()->setup(sampleRate);
+  }
+
+  auto batch = variant.createBatch();
+  batch->setup(sampleRate, nStream);
+
+  std::vector<std::vector<float>> in(nStream, std::vector<float>(BUF_LEN));
+  std::vector<std::vector<float>> outCore(nStream, std::vector<float>(BUF_LEN));
+  std::vector<std::vector<float>> outBatch(nStream, std::vector<float>(BUF_LEN));
+  std::vector<const float *> inPtr;
+  std::vector<float *> outPtr;
+  for (size_t st = 0; st < nStream; ++st) {
+    inPtr.push_back(in[st].data());
+    outPtr.push_back(outBatch[st].data());
+  }
+
+  auto processBatch = [&]() {
+    for (size_t st = 0; st < nStream; ++st)
+      batch->setParameters(st, core[st / 2]->param);
+    batch->process(BUF_LEN, inPtr.data(), outPtr.data());
+  };
+
+  auto processCore = [&]() {
+    for (size_t idx = 0; idx < N_INSTANCE; ++idx) {
+      core[idx]->setParameters(tempo);
+      core[idx]->process(
+        BUF_LEN, in[2 * idx].data(), in[2 * idx + 1].data(), outCore[2 * idx].data(),
+        outCore[2 * idx + 1].data());
+    }
+  };
+
+  double maxDiff = 0.0;
+  bool isOk = batch->getLatency() == core[0]->getLatency();
+  for (size_t i = 0; i < N_LOOP; ++i) {
+    // Smoothers start from the first parameters. Changing parameters later makes ramps.
+    if (i == N_LOOP / 2) {
+      for (auto &dsp : core) randomize(dsp->param, rng, setting);
+    }
+
+    for (auto &ch : in)
+      for (auto &x : ch) x = 2.0f * rng() - 1.0f;
+
+    processCore();
+    processBatch();
+
+    for (size_t st = 0; st < nStream; ++st) {
+      for (size_t j = 0; j < BUF_LEN; ++j) {
+        const double ref = outCore[st][j];
+        const double diff = std::fabs(double(outBatch[st][j]) - ref);
+        if (!std::isfinite(diff)) {
+          isOk = false;
+          continue;
+        }
+        maxDiff = std::max(maxDiff, diff);
+        if (diff > tolerance * (1.0 + std::fabs(ref))) isOk = false;
+      }
+    }
+  }
+
+  std::cout << name << " " << variant.name << " oversample=" << setting.oversample
+            << " factor=" << setting.factor << " linearPhase=" << setting.linearPhase
+            << ": " << maxDiff << (isOk ? "" : " FAIL") << "\n";
+  return isOk;
+}
+
+// Usage: main NAME TOLERANCE
+int main(int argc, char **argv)
+{
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0] << " NAME TOLERANCE\n";
+    return EXIT_FAILURE;
+  }
+  const std::string name(argv[1]);
+  const double tolerance = std::stod(argv[2]);
+
+  const std::vector<Variant> variants{
+    {"SSE2", 2, []() { return std::make_unique<DSPCore_SSE2>(); },
+     []() { return std::make_unique<DSPBatch_SSE2>(); }},
+    {"SSE41", 5, []() { return std::make_unique<DSPCore_SSE41>(); },
+     []() { return std::make_unique<DSPBatch_SSE41>(); }},
+    {"AVX2", 8, []() { return std::make_unique<DSPCore_AVX2>(); },
+     []() { return std::make_unique<DSPBatch_AVX2>(); }},
+    {"AVX512", 10, []() { return std::make_unique<DSPCore_AVX512>(); },
+     []() { return std::make_unique<DSPBatch_AVX512>(); }},
+  };
+
+  const std::vector<OversampleSetting> settings{
+    {0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {1, 3, 0}, {1, 1, 1}, {1, 3, 1},
+  };
+
+  const auto iset = instrset_detect();
+
+  bool isPassed = true;
+  for (const auto &variant : variants) {
+    if (iset < variant.instrset) {
+      std::cout << name << " " << variant.name << ": Skipped. Not supported by CPU.\n";
+      continue;
+    }
+    for (const auto &setting : settings)
+      isPassed &= compare(name, variant, setting, tolerance);
+  }
+
+  return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
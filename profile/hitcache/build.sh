@@ -0,0 +1,59 @@
+#!/bin/bash
+#
+# Checks `HitCache` in common/dsp/hitcache.hpp, and compares hits played from cache to
+# live synthesis on each plugin using it. Exits with non-zero status when any check fails.
+#
+# Usage:
+#   ./build.sh                         # Check all.
+#   ./build.sh HitCache WaveCymbal     # Check specified targets.
+#
+
+PLUGINS=(
+  "FDNCymbal"
+  "WaveCymbal"
+)
+
+function check_hitcache() {
+  local buildDir="build/HitCache"
+  mkdir -p "$buildDir"
+
+  echo Compiling HitCache
+  g++ -std=c++17 -O3 -Wall -o "$buildDir/hitcache" hitcache.cpp -lpthread || return 1
+
+  "$buildDir/hitcache"
+}
+
+function compare() {
+  local name=$1
+  local buildDir="build/$name"
+  mkdir -p "$buildDir"
+
+  echo Compiling "$name"
+  g++ -std=c++17 -O3 -Wall -DTEST_BUILD \
+    -DPLUGIN_DSPCORE_CPP="\"../../$name/dsp/dspcore.cpp\"" \
+    -DPLUGIN_NAME="\"$name\"" \
+    -o "$buildDir/cymbal" \
+    "../../$name/parameter.cpp" \
+    cymbal.cpp \
+    -lpthread || return 1
+
+  "$buildDir/cymbal"
+}
+
+cd "$(dirname "$0")" || exit 1
+
+failed=()
+if [[ $# -eq 0 || " $* " =~ " HitCache " ]]; then
+  check_hitcache || failed+=("HitCache")
+fi
+
+for name in "${PLUGINS[@]}"; do
+  if [[ $# -gt 0 && ! " $* " =~ " $name " ]]; then continue; fi
+  compare "$name" || failed+=("$name")
+done
+
+if [[ ${#failed[@]} -gt 0 ]]; then
+  echo "Failed: ${failed[*]}"
+  exit 1
+fi
+echo "All passed."
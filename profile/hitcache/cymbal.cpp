@@ -0,0 +1,150 @@
+// Plays the same sequence of hits on 2 instances with hit cache on. One plays hits from
+// cache. Cache of the other never gets rendered hits, so it plays all hits live.
+//
+// The first hit is a miss on both, and they are compared as is. Later hits are compared
+// to `renderHit()` scaled by the master gain of the live instance. A live hit isn't used
+// as reference, because it's not rendered from rest. Velocity changes between hits to
+// check the gain of cached hits.
+//
+// Build and run with `build.sh`, which sets `PLUGIN_DSPCORE_CPP`.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Internal state is checked to make sure that hits are played from cache.
+#define private public
+#define protected public
+#include PLUGIN_DSPCORE_CPP
+#undef private
+#undef protected
+
+constexpr size_t BUF_LEN = 256;
+constexpr float sampleRate = 48000.0f;
+constexpr size_t hitInterval = 2000 * BUF_LEN; // About 10.7 seconds.
+constexpr uint32_t hitFrame = 100;
+constexpr double toleranceDecibel = -54.0;
+
+// Parameters to make hits cacheable. Names not in the plugin are skipped.
+const std::vector<std::pair<std::string, int>> cacheableParameters{
+  {"hitCache", 1},       {"retriggerTime", 1}, {"retriggerStick", 1},
+  {"retriggerTremolo", 1}, {"retrigger", 1},     {"oscType", 1},
+};
+
+std::vector<float> renderNothing(const DSPCore::HitRequest &, const std::atomic<bool> &)
+{
+  return {};
+}
+
+double toDecibel(double x) { return 20.0 * std::log10(std::max(x, 1e-20)); }
+
+int main()
+{
+  const std::vector<float> velocity{1.0f, 0.3f, 1.0f, 0.7f, 0.7f};
+
+  std::array<std::unique_ptr<DSPCore>, 2> dsp{
+    std::make_unique<DSPCore>(), std::make_unique<DSPCore>()};
+  for (auto &core : dsp) {
+    for (const auto &[name, value] : cacheableParameters) {
+      for (size_t id = 0; id < core->param.value.size(); ++id) {
+        if (name == core->param.value[id]->getName())
+          core->param.value[id]->setFromInt(value);
+      }
+    }
+    core->setup(sampleRate);
+  }
+  auto &cached = *dsp[0];
+  auto &live = *dsp[1];
+  live.hitCache.start(renderNothing); // Marks all hits as not cacheable.
+
+  const size_t length = velocity.size() * hitInterval;
+  std::array<std::vector<float>, 2> out{
+    std::vector<float>(length), std::vector<float>(length)};
+  std::vector<float> reference(length);
+  std::vector<float> rendered;
+  int64_t hitPosition = 0;
+  std::vector<float> silence(BUF_LEN, 0.0f);
+  std::vector<float> discard(BUF_LEN);
+
+  // Result is published before the request slot is released.
+  auto waitWorker = [&](HitCache<DSPCore::HitRequest> &cache) {
+    while (cache.requestTail.load() != cache.requestHead.load())
+      std::this_thread::yield();
+  };
+
+  bool isOk = true;
+  for (size_t start = 0; start < length; start += BUF_LEN) {
+    const bool isHit = start % hitInterval == 0;
+    if (isHit) waitWorker(cached.hitCache);
+
+    for (size_t idx = 0; idx < dsp.size(); ++idx) {
+      auto &core = *dsp[idx];
+      if (isHit) {
+        const auto vel = velocity[start / hitInterval];
+        core.pushMidiNote(true, hitFrame, int32_t(start / hitInterval), 60, 0.0f, vel);
+      }
+      core.setParameters();
+
+      // Cached hit follows the master gain of live synthesis from its note-on block.
+      if (idx == 1) {
+        if (isHit) hitPosition = -int64_t(hitFrame);
+        auto gain = core.interpMasterGain;
+        for (size_t i = 0; i < BUF_LEN; ++i, ++hitPosition) {
+          const float sample = hitPosition >= 0 && size_t(hitPosition) < rendered.size()
+            ? rendered[hitPosition]
+            : 0.0f;
+          reference[start + i] = gain.process() * sample;
+        }
+      }
+
+      core.process(
+        BUF_LEN, silence.data(), silence.data(), out[idx].data() + start, discard.data());
+      core.midiNotes.clear();
+    }
+
+    // The request of the first hit is the one rendered by worker.
+    if (start == 0) {
+      rendered = DSPCore::renderHit(
+        cached.hitCache.requests[0].request, std::atomic<bool>(true));
+    }
+
+    if (isHit && start > 0 && !cached.hitCache.isPlaying()) {
+      std::cout << "Hit at " << start << " is not played from cache. FAIL\n";
+      isOk = false;
+    }
+  }
+
+  // First hit is played live on both.
+  std::copy(out[1].begin(), out[1].begin() + hitInterval, reference.begin());
+
+  // Cached hit is trimmed after it stays 60 dB below its peak. So error is the maximum
+  // difference relative to the peak of the hit.
+  for (size_t hit = 0; hit < velocity.size(); ++hit) {
+    double peak = 0.0;
+    double maxDiff = 0.0;
+    for (size_t i = hit * hitInterval; i < (hit + 1) * hitInterval; ++i) {
+      const double ref = reference[i];
+      peak = std::max(peak, std::fabs(ref));
+      maxDiff = std::max(maxDiff, std::fabs(double(out[0][i]) - ref));
+    }
+    const double error = toDecibel(maxDiff / std::max(peak, 1e-20));
+    const bool isHitOk = std::isfinite(error) && peak > 0 && error <= toleranceDecibel;
+    std::cout << PLUGIN_NAME << " hit " << hit << " velocity " << velocity[hit]
+              << ": error " << error << " dB" << (isHitOk ? "" : " FAIL") << "\n";
+    isOk &= isHitOk;
+  }
+
+  return isOk ? EXIT_SUCCESS : EXIT_FAILURE;
+}
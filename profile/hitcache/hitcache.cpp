@@ -0,0 +1,201 @@
+// Checks `HitCache` in common/dsp/hitcache.hpp. Covers handover of rendered hits from the
+// worker, duplicated and dropped requests, hits which are not cacheable, eviction, and
+// stopping the worker during a render.
+//
+// Build and run with `build.sh`.
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../common/dsp/hitcache.hpp"
+
+using namespace SomeDSP;
+
+struct Request {
+  int32_t length; // 0 is not cacheable. Negative value renders until stopped.
+  float value;
+};
+
+std::atomic<int> nRender{0};
+
+std::vector<float> render(const Request &request, const std::atomic<bool> &isRunning)
+{
+  ++nRender;
+  if (request.length < 0) {
+    while (isRunning.load()) std::this_thread::yield();
+    return {};
+  }
+  return std::vector<float>(size_t(request.length), request.value);
+}
+
+// Exposes internal state to check it.
+class TestCache : public HitCache<Request> {
+public:
+  using HitCache<Request>::find;
+  using HitCache<Request>::queueSize;
+
+  size_t nRequest() const { return requestHead.load() - requestTail.load(); }
+
+  // Result is published before the request slot is released.
+  void waitWorker()
+  {
+    while (requestTail.load() != requestHead.load()) std::this_thread::yield();
+  }
+
+  void add(uint64_t key, int32_t length, float value = 1.0f)
+  {
+    request(key, [&](Request &req) { req = {length, value}; });
+  }
+};
+
+int nFailed = 0;
+
+void check(bool condition, const std::string &message)
+{
+  if (condition) return;
+  std::cout << "FAIL: " << message << "\n";
+  ++nFailed;
+}
+
+void testHandover()
+{
+  TestCache cache;
+  cache.start(render);
+
+  cache.add(1, 4, 0.5f);
+  cache.waitWorker();
+  check(!cache.play(1, 0, 1.0f), "Hit is played before collect().");
+  cache.collect();
+  check(cache.play(1, 2, 2.0f), "Rendered hit is not played.");
+
+  std::vector<float> out;
+  while (cache.isPlaying()) out.push_back(cache.process());
+  const std::vector<float> expected{0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+  check(out == expected, "Playback doesn't match rendered hit with delay and gain.");
+}
+
+void testDuplicatedRequest()
+{
+  TestCache cache;
+  cache.start(render);
+  nRender = 0;
+
+  // Second request is made before the first one is collected.
+  cache.add(1, 4);
+  cache.add(1, 4);
+  cache.waitWorker();
+  cache.collect();
+  cache.add(1, 4);
+  cache.waitWorker();
+  check(nRender == 1, "Duplicated request is rendered.");
+}
+
+void testNotCacheable()
+{
+  TestCache cache;
+  cache.start(render);
+  nRender = 0;
+
+  cache.add(1, 0);
+  cache.waitWorker();
+  cache.collect();
+  check(!cache.play(1, 0, 1.0f), "Hit which is not cacheable is played.");
+  cache.add(1, 0);
+  cache.waitWorker();
+  check(nRender == 1, "Hit which is not cacheable is rendered again.");
+}
+
+void testFullQueue()
+{
+  TestCache cache;
+  nRender = 0;
+
+  // Worker is not started yet, so requests stay in queue.
+  for (uint64_t key = 0; key <= TestCache::queueSize; ++key) cache.add(key, 4);
+  check(cache.nRequest() == TestCache::queueSize, "Request is queued over the size.");
+
+  cache.start(render);
+  cache.waitWorker();
+  cache.collect();
+  const uint64_t dropped = TestCache::queueSize;
+  check(cache.find(dropped) == nullptr, "Dropped request is rendered.");
+
+  cache.add(dropped, 4);
+  cache.waitWorker();
+  cache.collect();
+  check(cache.find(dropped) != nullptr, "Dropped request is not tried again.");
+  check(nRender == int(TestCache::queueSize) + 1, "Number of renders is wrong.");
+}
+
+void testEviction()
+{
+  TestCache cache;
+  cache.start(render);
+
+  // Fills all entries. Key 0 plays longer than others.
+  for (uint64_t key = 0; key < TestCache::nEntry; ++key) {
+    cache.add(key, key == 0 ? 1000 : 10);
+    if (key % 4 == 3) {
+      cache.waitWorker();
+      cache.collect();
+    }
+  }
+  for (uint64_t key = 0; key < TestCache::nEntry; ++key)
+    check(cache.find(key) != nullptr, "Entry is missing after filling.");
+
+  // Key 0 becomes least recently used, but it's still playing.
+  for (uint64_t key = 0; key < TestCache::nEntry; ++key) cache.play(key, 0, 1.0f);
+  for (size_t i = 0; i < 10; ++i) cache.process();
+  check(cache.isPlaying(), "Long hit stopped.");
+
+  const uint64_t newKey = TestCache::nEntry;
+  cache.add(newKey, 10);
+  cache.waitWorker();
+  cache.collect();
+  check(cache.find(newKey) != nullptr, "New hit is not stored.");
+  check(cache.find(0) != nullptr, "Playing entry is evicted.");
+  check(cache.find(1) == nullptr, "Least recently used entry is not evicted.");
+
+  // When all entries are playing, new hit waits until an entry becomes free.
+  cache.reset();
+  for (uint64_t key = 0; key <= TestCache::nEntry; ++key) cache.play(key, 0, 1.0f);
+  const uint64_t waitingKey = TestCache::nEntry + 1;
+  cache.add(waitingKey, 10);
+  cache.waitWorker();
+  cache.collect();
+  check(cache.find(waitingKey) == nullptr, "Playing entry is evicted.");
+  cache.reset();
+  cache.collect();
+  check(cache.find(waitingKey) != nullptr, "Waiting hit is not stored.");
+}
+
+void testStop()
+{
+  TestCache cache;
+  cache.start(render);
+  nRender = 0;
+
+  cache.add(1, -1);
+  while (nRender == 0) std::this_thread::yield();
+  cache.stop(); // Returns only when the render is aborted.
+  check(cache.find(1) == nullptr, "Aborted hit is stored.");
+}
+
+int main()
+{
+  testHandover();
+  testDuplicatedRequest();
+  testNotCacheable();
+  testFullQueue();
+  testEviction();
+  testStop();
+
+  if (nFailed > 0) return EXIT_FAILURE;
+  std::cout << "HitCache: All passed.\n";
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+#!/bin/bash
+#
+# Renders a fixed scenario through SSE2, SSE4.1, AVX2 and AVX512 variants of each plugin,
+# and checks that they match SSE2 within tolerance. Variants not supported by the CPU are
+# skipped. Exits with non-zero status when any plugin fails.
+#
+# Usage:
+#   ./build.sh                     # Compare all plugins.
+#   ./build.sh L4Reverb EsPhaser   # Compare specified plugins.
+#   WRITE_REFERENCE=1 ./build.sh   # Store SSE2 renders to `reference/*.f32`.
+#
+# When `reference/<plugin>.f32` exists, SSE2 render is also compared to it. Reference is
+# raw 32-bit float, so it's only valid on the machine and compiler that wrote it. Plugins
+# without reference are listed at the end.
+#
+# CubicPadSynth requires `lib/fftw3/libfftw3f.a`, and LightPadSynth requires pocketfft
+# submodule. See README.md.
+#
+
+# Name, is synth (1 or 0), tolerance of RMS error relative to SSE2 in decibel.
+#
+# Tolerances are about 15 dB above the error measured on an AVX512 machine, which comes
+# from FMA contraction. A broken variant, like a wrong lane, makes error close to 0 dB.
+# Error of CubicPadSynth and LightPadSynth is not measured, because their libraries are
+# missing in this tree. They use the tolerance of IterativeSinCluster.
+PLUGINS=(
+  "CollidingCombSynth 1 -30"  # -44.8 dB. Collision of strings amplifies the difference.
+  "CubicPadSynth 1 -70"
+  "EnvelopedSine 1 -130"      # -146.7 dB.
+  "IterativeSinCluster 1 -70" # -84.0 dB.
+  "LightPadSynth 1 -70"
+  "SyncSawSynth 1 -100"       # -116.4 dB.
+  "EsPhaser 0 -120"           # Identical.
+  "FoldShaper 0 -120"         # Identical.
+  "L3Reverb 0 -120"           # Identical.
+  "L4Reverb 0 -120"           # Identical.
+  "LatticeReverb 0 -120"      # Identical.
+  "ModuloShaper 0 -105"       # -122.8 dB.
+  "OddPowShaper 0 -120"       # Identical.
+  "SoftClipper 0 -120"        # Identical.
+)
+
+function compile_simd() {
+  local base
+  base=$(basename "$1")
+  g++ -DTEST_BUILD -O3 -fPIC -mavx512f -mfma -mavx512vl -mavx512bw -mavx512dq -std=c++17 -c "$1" -o"$2/$base.avx512.o" &&
+  g++ -DTEST_BUILD -O3 -fPIC -mavx2 -mfma -std=c++17 -c "$1" -o"$2/$base.avx2.o" &&
+  g++ -DTEST_BUILD -O3 -fPIC -msse4.1 -std=c++17 -c "$1" -o"$2/$base.sse41.o" &&
+  g++ -DTEST_BUILD -O3 -fPIC -msse2 -std=c++17 -c "$1" -o"$2/$base.sse2.o"
+}
+
+function compare() {
+  local name=$1
+  local isSynth=$2
+  local tolerance=$3
+  local buildDir="build/$name"
+  mkdir -p "$buildDir" reference
+
+  echo Compiling "$name"
+  compile_simd "../../$name/dsp/dspcore.cpp" "$buildDir" || return 1
+
+  local libs=()
+  if [[ "$name" == "CubicPadSynth" ]]; then
+    libs+=(../../lib/fftw3/libfftw3f.a)
+  fi
+
+  # If CPU doesn't support AVX512, changing order of *.o file cause SIGILL (illegal instruction).
+  # See: https://stackoverflow.com/questions/15406658/cpu-dispatcher-for-visual-studio-for-avx-and-sse
+  g++ -std=c++17 -O3 -Wall -DTEST_BUILD \
+    -DPLUGIN_DSPCORE="\"../../$name/dsp/dspcore.hpp\"" \
+    -DPLUGIN_IS_SYNTH="$isSynth" \
+    -o "$buildDir/isacompare" \
+    ../../lib/vcl/instrset_detect.cpp \
+    "$buildDir/dspcore.cpp.sse2.o" \
+    "$buildDir/dspcore.cpp.sse41.o" \
+    "$buildDir/dspcore.cpp.avx2.o" \
+    "$buildDir/dspcore.cpp.avx512.o" \
+    "../../$name/parameter.cpp" \
+    main.cpp \
+    "${libs[@]}" \
+    -lpthread || return 1
+
+  if [[ -z "$WRITE_REFERENCE" && ! -f "reference/$name.f32" ]]; then
+    noReference+=("$name")
+  fi
+
+  if [[ -n "$WRITE_REFERENCE" ]]; then
+    "$buildDir/isacompare" "$name" "$tolerance" "reference/$name.f32" --write
+  else
+    "$buildDir/isacompare" "$name" "$tolerance" "reference/$name.f32"
+  fi
+}
+
+cd "$(dirname "$0")" || exit 1
+
+failed=()
+noReference=()
+for entry in "${PLUGINS[@]}"; do
+  read -r name isSynth tolerance <<< "$entry"
+  if [[ $# -gt 0 && ! " $* " =~ " $name " ]]; then continue; fi
+  compare "$name" "$isSynth" "$tolerance" || failed+=("$name")
+done
+
+if [[ ${#noReference[@]} -gt 0 ]]; then
+  echo "Stored reference comparison did not run for: ${noReference[*]}"
+  echo "Run with WRITE_REFERENCE=1 to store references."
+fi
+
+if [[ ${#failed[@]} -gt 0 ]]; then
+  echo "Failed: ${failed[*]}"
+  exit 1
+fi
+echo "All passed."
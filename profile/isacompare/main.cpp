@@ -0,0 +1,208 @@
+// Renders a fixed scenario through every SIMD variant of a DSPCore, and compares them.
+//
+// Build and run with `build.sh`, which sets `PLUGIN_DSPCORE` and `PLUGIN_IS_SYNTH`.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include PLUGIN_DSPCORE
+
+constexpr size_t BUF_LEN = 256;
+constexpr size_t N_LOOP = 400;
+constexpr float sampleRate = 48000.0f;
+constexpr float tempo = 120.0f;
+
+template<typename T, typename = void> struct HasTempo : std::false_type {};
+template<typename T>
+struct HasTempo<T, std::void_t<decltype(std::declval<T &>().setParameters(tempo))>>
+  : std::true_type {};
+
+template<typename T, typename = void> struct HasTable : std::false_type {};
+template<typename T>
+struct HasTable<T, std::void_t<decltype(std::declval<T &>().refreshTable())>>
+  : std::true_type {};
+
+// Templates are used to discard the branch of `if constexpr`.
+template<typename Dsp> void setParameters(Dsp &dsp)
+{
+  if constexpr (HasTempo<Dsp>::value) {
+    dsp.setParameters(tempo);
+  } else {
+    dsp.setParameters();
+  }
+}
+
+// Output is interleaved stereo.
+template<typename Dsp> std::vector<float> render(Dsp &dsp)
+{
+  std::vector<float> wav;
+  wav.reserve(2 * BUF_LEN * N_LOOP);
+
+  dsp.setup(sampleRate);
+  if constexpr (HasTable<Dsp>::value) {
+    dsp.refreshTable();
+    dsp.refreshLfo();
+  }
+  dsp.startup();
+
+  float in[2][BUF_LEN];
+  float out[2][BUF_LEN];
+  float phase = 0.0f;
+
+  for (size_t i = 0; i < N_LOOP; ++i) {
+#if PLUGIN_IS_SYNTH
+    // Chord, then a note sliding in at odd frame, then release.
+    if (i == 0) {
+      for (int32_t n = 0; n < 4; ++n) dsp.pushMidiNote(true, 0, n, 48 + 4 * n, 0, 0.8f);
+    }
+    if (i == 40) dsp.pushMidiNote(true, 77, 4, 67, 0.25f, 0.5f);
+    if (i == 120) {
+      for (int32_t n = 0; n < 5; ++n) dsp.pushMidiNote(false, 13, n, 0, 0, 0);
+    }
+#endif
+
+    // 100 Hz saw for first half, then silence to render the tail.
+    for (size_t j = 0; j < BUF_LEN; ++j) {
+      phase += 100.0f / sampleRate;
+      phase -= std::floor(phase);
+      in[0][j] = i < N_LOOP / 2 ? 0.5f * (2.0f * phase - 1.0f) : 0.0f;
+      in[1][j] = 0.5f * in[0][j];
+    }
+
+    setParameters(dsp);
+#if PLUGIN_IS_SYNTH
+    dsp.process(BUF_LEN, out[0], out[1]);
+#else
+    dsp.process(BUF_LEN, in[0], in[1], out[0], out[1]);
+#endif
+
+    for (size_t j = 0; j < BUF_LEN; ++j) {
+      wav.push_back(out[0][j]);
+      wav.push_back(out[1][j]);
+    }
+  }
+  return wav;
+}
+
+/**
+Returns RMS of `a - b` relative to RMS of `b`, in decibel. Returns -inf when they are
+identical, and infinity when a sample is not finite.
+
+Error is relative to signal level, because a small difference may grow in feedback. For
+example, the collision of strings in CollidingCombSynth amplifies rounding differences.
+*/
+double relativeError(const std::vector<float> &a, const std::vector<float> &b)
+{
+  if (a.size() != b.size()) return INFINITY;
+  double sumDiff = 0.0;
+  double sumRef = 0.0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (!std::isfinite(a[i]) || !std::isfinite(b[i])) return INFINITY;
+    const double diff = double(a[i]) - double(b[i]);
+    sumDiff += diff * diff;
+    sumRef += double(b[i]) * double(b[i]);
+  }
+  if (sumDiff == 0.0) return -INFINITY;
+  if (sumRef == 0.0) return INFINITY;
+  return 10.0 * std::log10(sumDiff / sumRef);
+}
+
+// Reference render is raw 32-bit float, interleaved stereo, in native byte order.
+bool readReference(const std::string &path, std::vector<float> &wav)
+{
+  std::ifstream ifs(path, std::ios::binary);
+  if (!ifs.is_open()) return false;
+  ifs.seekg(0, std::ios::end);
+  wav.resize(size_t(ifs.tellg()) / sizeof(float));
+  ifs.seekg(0, std::ios::beg);
+  ifs.read(reinterpret_cast<char *>(wav.data()), wav.size() * sizeof(float));
+  return bool(ifs);
+}
+
+bool writeReference(const std::string &path, const std::vector<float> &wav)
+{
+  std::ofstream ofs(path, std::ios::binary);
+  if (!ofs.is_open()) return false;
+  ofs.write(reinterpret_cast<const char *>(wav.data()), wav.size() * sizeof(float));
+  return bool(ofs);
+}
+
+struct Variant {
+  const char *name;
+  int instrset; // Minimum value of `instrset_detect()`.
+  std::function<std::unique_ptr<DSPInterface>()> create;
+};
+
+// Usage: main NAME TOLERANCE [REFERENCE_PATH [--write]]
+int main(int argc, char **argv)
+{
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0] << " NAME TOLERANCE [REFERENCE_PATH [--write]]\n";
+    return EXIT_FAILURE;
+  }
+  const std::string name(argv[1]);
+  const double tolerance = std::stod(argv[2]); // In decibel.
+  const std::string referencePath = argc >= 4 ? argv[3] : "";
+  const bool isWriting = argc >= 5 && std::strcmp(argv[4], "--write") == 0;
+
+  const std::vector<Variant> variants{
+    {"SSE2", 2, []() { return std::make_unique<DSPCore_SSE2>(); }},
+    {"SSE41", 5, []() { return std::make_unique<DSPCore_SSE41>(); }},
+    {"AVX2", 8, []() { return std::make_unique<DSPCore_AVX2>(); }},
+    {"AVX512", 10, []() { return std::make_unique<DSPCore_AVX512>(); }},
+  };
+
+  const auto iset = instrset_detect();
+
+  // SSE2 is the baseline. It runs on every x86-64 CPU.
+  std::vector<float> baseline = render(*variants[0].create());
+  bool isPassed = relativeError(baseline, baseline) == -INFINITY;
+  if (!isPassed) std::cout << name << " SSE2: output is not finite.\n";
+
+  if (!referencePath.empty()) {
+    if (isWriting) {
+      if (!writeReference(referencePath, baseline)) {
+        std::cerr << "Error: Failed to write " << referencePath << "\n";
+        return EXIT_FAILURE;
+      }
+      std::cout << name << ": Wrote reference to " << referencePath << "\n";
+    } else {
+      std::vector<float> reference;
+      if (readReference(referencePath, reference)) {
+        const auto error = relativeError(baseline, reference);
+        const bool isOk = error <= tolerance;
+        isPassed &= isOk;
+        std::cout << name << " SSE2 vs reference: " << error << " dB"
+                  << (isOk ? "" : " FAIL") << "\n";
+      } else {
+        std::cout << name << ": Reference " << referencePath
+                  << " is not found. Stored reference comparison is skipped.\n";
+      }
+    }
+  }
+
+  for (size_t i = 1; i < variants.size(); ++i) {
+    const auto &variant = variants[i];
+    if (iset < variant.instrset) {
+      std::cout << name << " " << variant.name << ": Skipped. Not supported by CPU.\n";
+      continue;
+    }
+    const auto error = relativeError(render(*variant.create()), baseline);
+    const bool isOk = error <= tolerance;
+    isPassed &= isOk;
+    std::cout << name << " " << variant.name << " vs SSE2: " << error << " dB"
+              << (isOk ? "" : " FAIL") << "\n";
+  }
+
+  return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,96 @@
+#!/bin/bash
+#
+# Builds offline renderer for each plugin to `build/<plugin>/render`. Run `render --help`
+# for options.
+#
+# Usage:
+#   ./build.sh                     # Build all plugins.
+#   ./build.sh L4Reverb EsPhaser   # Build specified plugins.
+#
+# Example:
+#   build/SyncSawSynth/render -m song.mid --preset SyncSawSynth.preset.json -o out.wav
+#   build/L4Reverb/render --jobs jobs.txt -j 8
+#
+# Parameter names are same as `*.preset.json`. They are read from `<plugin>.type.json`
+# next to `render`, which is generated by `preset/extractparameter.py` on build.
+#
+# CubicPadSynth requires `lib/fftw3/libfftw3f.a`, and LightPadSynth requires pocketfft
+# submodule. See README.md.
+#
+
+# Name, is synth (1 or 0).
+PLUGINS=(
+  "CollidingCombSynth 1"
+  "CubicPadSynth 1"
+  "EnvelopedSine 1"
+  "IterativeSinCluster 1"
+  "LightPadSynth 1"
+  "SyncSawSynth 1"
+  "EsPhaser 0"
+  "FoldShaper 0"
+  "L3Reverb 0"
+  "L4Reverb 0"
+  "LatticeReverb 0"
+  "ModuloShaper 0"
+  "OddPowShaper 0"
+  "SoftClipper 0"
+)
+
+function compile_simd() {
+  local base
+  base=$(basename "$1")
+  g++ -DTEST_BUILD -O3 -fPIC -mavx512f -mfma -mavx512vl -mavx512bw -mavx512dq -std=c++17 -c "$1" -o"$2/$base.avx512.o" &&
+  g++ -DTEST_BUILD -O3 -fPIC -mavx2 -mfma -std=c++17 -c "$1" -o"$2/$base.avx2.o" &&
+  g++ -DTEST_BUILD -O3 -fPIC -msse4.1 -std=c++17 -c "$1" -o"$2/$base.sse41.o" &&
+  g++ -DTEST_BUILD -O3 -fPIC -msse2 -std=c++17 -c "$1" -o"$2/$base.sse2.o"
+}
+
+function build() {
+  local name=$1
+  local isSynth=$2
+  local buildDir="build/$name"
+  mkdir -p "$buildDir"
+
+  echo Compiling "$name"
+  compile_simd "../../$name/dsp/dspcore.cpp" "$buildDir" || return 1
+
+  # Parameter names of `*.preset.json`. Written to `build/<plugin>/<plugin>.type.json`.
+  python3 ../../preset/extractparameter.py "../../$name/parameter.hpp" "$buildDir" \
+    || return 1
+
+  local libs=()
+  if [[ "$name" == "CubicPadSynth" ]]; then
+    libs+=(../../lib/fftw3/libfftw3f.a)
+  fi
+
+  # If CPU doesn't support AVX512, changing order of *.o file cause SIGILL (illegal instruction).
+  # See: https://stackoverflow.com/questions/15406658/cpu-dispatcher-for-visual-studio-for-avx-and-sse
+  g++ -std=c++17 -O3 -Wall -DTEST_BUILD \
+    -DPLUGIN_DSPCORE="\"../../$name/dsp/dspcore.hpp\"" \
+    -DPLUGIN_IS_SYNTH="$isSynth" \
+    -DPLUGIN_NAME="\"$name\"" \
+    -o "$buildDir/render" \
+    ../../lib/vcl/instrset_detect.cpp \
+    "$buildDir/dspcore.cpp.sse2.o" \
+    "$buildDir/dspcore.cpp.sse41.o" \
+    "$buildDir/dspcore.cpp.avx2.o" \
+    "$buildDir/dspcore.cpp.avx512.o" \
+    "../../$name/parameter.cpp" \
+    main.cpp \
+    "${libs[@]}" \
+    -lpthread
+}
+
+cd "$(dirname "$0")" || exit 1
+
+failed=()
+for entry in "${PLUGINS[@]}"; do
+  read -r name isSynth <<< "$entry"
+  if [[ $# -gt 0 && ! " $* " =~ " $name " ]]; then continue; fi
+  build "$name" "$isSynth" || failed+=("$name")
+done
+
+if [[ ${#failed[@]} -gt 0 ]]; then
+  echo "Failed: ${failed[*]}"
+  exit 1
+fi
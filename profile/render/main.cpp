@@ -0,0 +1,836 @@
+// Offline renderer. Runs a DSPCore without host, as fast as CPU allows.
+//
+// Build with `build.sh`, which sets `PLUGIN_DSPCORE` and `PLUGIN_IS_SYNTH`. See the usage
+// text below for options.
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../../lib/json.hpp"
+
+#include PLUGIN_DSPCORE
+
+constexpr const char *usage = R"(Usage:
+  render [OPTION]...
+  render --jobs FILE [-j N] [OPTION]...
+
+Options:
+  -o PATH              Output. `*.raw` and `*.f32` are raw float, others are WAV.
+  -i PATH              Input of effect. `*.raw` and `*.f32` are raw float, others are WAV.
+  -m PATH              Standard MIDI file to play synth.
+  -r HZ                Sample rate. Default is 48000, or the rate of WAV input.
+  -b FRAMES            Block size. Default is 4096.
+  -t SECONDS           Length of output. Default is input or MIDI length plus tail.
+  --tail SECONDS       Rendered after the end of input or MIDI. Default is 2.
+  --tempo BPM          Used when MIDI file doesn't have tempo. Default is 120.
+  --preset PATH        `*.preset.json` in the format of `preset/vstpresettojson.py`.
+  --preset-name NAME   Preset to load from `--preset`. Default is "Default".
+  --params PATH        Text file with a `name value` pair on each line.
+  -p NAME=VALUE        Sets a parameter. Can be repeated.
+  --types PATH         `*.type.json` of `preset/extractparameter.py`. Default is the one
+                       next to this executable, which is written by `build.sh`.
+  --jobs PATH          Each line is options of a job. Jobs run in parallel.
+  -j N                 Number of parallel jobs. Default is number of hardware threads.
+
+Parameter names and values are same as preset: raw value for integer parameters, and
+normalized value for others. `--preset`, `--params` and `-p` are applied in this order.
+
+Raw float is interleaved stereo in native byte order. In `--jobs` file, options on command
+line are placed before the options on each line, and `#` starts a comment.
+)";
+
+template<typename T, typename = void> struct HasTempo : std::false_type {};
+template<typename T>
+struct HasTempo<T, std::void_t<decltype(std::declval<T &>().setParameters(120.0f))>>
+  : std::true_type {};
+
+template<typename T, typename = void> struct HasTable : std::false_type {};
+template<typename T>
+struct HasTable<T, std::void_t<decltype(std::declval<T &>().refreshTable())>>
+  : std::true_type {};
+
+// Templates are used to discard the branch of `if constexpr`.
+template<typename Dsp> void setParameters(Dsp &dsp, float tempo)
+{
+  if constexpr (HasTempo<Dsp>::value) {
+    dsp.setParameters(tempo);
+  } else {
+    dsp.setParameters();
+  }
+}
+
+template<typename Dsp> void refreshTable(Dsp &dsp)
+{
+  if constexpr (HasTable<Dsp>::value) {
+    dsp.refreshTable();
+    dsp.refreshLfo();
+  }
+}
+
+std::unique_ptr<DSPInterface> createDSP()
+{
+  auto iset = instrset_detect();
+  if (iset >= 10) return std::make_unique<DSPCore_AVX512>();
+  if (iset >= 8) return std::make_unique<DSPCore_AVX2>();
+  if (iset >= 5) return std::make_unique<DSPCore_SSE41>();
+  if (iset >= 2) return std::make_unique<DSPCore_SSE2>();
+  throw std::runtime_error("Instruction set SSE2 not supported on this computer.");
+}
+
+struct FileCloser {
+  void operator()(std::FILE *file) { std::fclose(file); }
+};
+using FilePtr = std::unique_ptr<std::FILE, FileCloser>;
+
+FilePtr openFile(const std::string &path, const char *mode)
+{
+  FilePtr file(std::fopen(path.c_str(), mode));
+  if (!file) throw std::runtime_error("Failed to open " + path);
+
+  // Large buffer reduces the number of system calls on streaming.
+  std::setvbuf(file.get(), nullptr, _IOFBF, 1 << 20);
+  return file;
+}
+
+bool isRawPath(const std::string &path)
+{
+  auto endsWith = [&](const char *ext) {
+    const size_t len = std::strlen(ext);
+    return path.size() >= len && path.compare(path.size() - len, len, ext) == 0;
+  };
+  return endsWith(".raw") || endsWith(".f32");
+}
+
+// WAV fields are little endian. VCL only targets x86, so native order is used as is.
+template<typename T> T readLE(const uint8_t *data)
+{
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+/**
+Streaming reader of stereo input. Mono is copied to both channels, and channels after 2nd
+are discarded. WAV can be 16, 24 or 32 bit integer, or 32 bit float.
+*/
+class AudioReader {
+public:
+  double sampleRate = 0; // 0 for raw float.
+
+  void open(const std::string &path)
+  {
+    file = openFile(path, "rb");
+    if (isRawPath(path)) {
+      nChannel = 2;
+      bytesPerSample = 4;
+      isFloat = true;
+      remaining = std::numeric_limits<uint64_t>::max();
+      return;
+    }
+
+    uint8_t header[12];
+    if (
+      std::fread(header, 1, 12, file.get()) != 12 || std::memcmp(header, "RIFF", 4) != 0
+      || std::memcmp(header + 8, "WAVE", 4) != 0)
+      throw std::runtime_error(path + " is not a WAV file.");
+
+    bool hasFormat = false;
+    uint8_t chunk[8];
+    while (std::fread(chunk, 1, 8, file.get()) == 8) {
+      const uint32_t size = readLE<uint32_t>(chunk + 4);
+      if (std::memcmp(chunk, "fmt ", 4) == 0) {
+        std::vector<uint8_t> fmt(size + (size & 1));
+        if (size < 16 || std::fread(fmt.data(), 1, fmt.size(), file.get()) != fmt.size())
+          break;
+        uint16_t tag = readLE<uint16_t>(fmt.data());
+        if (tag == 0xfffe && size >= 26) tag = readLE<uint16_t>(fmt.data() + 24);
+        nChannel = readLE<uint16_t>(fmt.data() + 2);
+        sampleRate = readLE<uint32_t>(fmt.data() + 4);
+        bytesPerSample = readLE<uint16_t>(fmt.data() + 14) / 8;
+        isFloat = tag == 3;
+        if (
+          nChannel == 0 || (tag != 1 && tag != 3) || (isFloat && bytesPerSample != 4)
+          || (!isFloat && (bytesPerSample < 2 || bytesPerSample > 4)))
+          throw std::runtime_error(path + ": Unsupported WAV format.");
+        hasFormat = true;
+      } else if (std::memcmp(chunk, "data", 4) == 0) {
+        if (!hasFormat) break;
+        remaining = size / (nChannel * bytesPerSample);
+        return;
+      } else {
+        std::fseek(file.get(), long(size + (size & 1)), SEEK_CUR);
+      }
+    }
+    throw std::runtime_error(path + ": fmt or data chunk is missing.");
+  }
+
+  // Returns number of frames read. Less than `length` means end of input.
+  size_t read(float *out0, float *out1, size_t length)
+  {
+    length = size_t(std::min<uint64_t>(length, remaining));
+    const size_t frameBytes = nChannel * bytesPerSample;
+    buffer.resize(length * frameBytes);
+    const size_t nFrame = std::fread(buffer.data(), frameBytes, length, file.get());
+    remaining = nFrame < length ? 0 : remaining - nFrame;
+
+    const size_t ch1 = nChannel >= 2 ? bytesPerSample : 0;
+    for (size_t i = 0; i < nFrame; ++i) {
+      const uint8_t *frame = buffer.data() + i * frameBytes;
+      out0[i] = toFloat(frame);
+      out1[i] = toFloat(frame + ch1);
+    }
+    return nFrame;
+  }
+
+private:
+  FilePtr file;
+  uint64_t remaining = 0;
+  size_t nChannel = 2;
+  size_t bytesPerSample = 4;
+  bool isFloat = true;
+  std::vector<uint8_t> buffer;
+
+  float toFloat(const uint8_t *data) const
+  {
+    if (isFloat) return readLE<float>(data);
+    if (bytesPerSample == 2) return readLE<int16_t>(data) / 32768.0f;
+    if (bytesPerSample == 3) {
+      int32_t value = int32_t(uint32_t(data[0]) << 8 | uint32_t(data[1]) << 16
+                              | uint32_t(data[2]) << 24);
+      return float(value / 2147483648.0);
+    }
+    return float(readLE<int32_t>(data) / 2147483648.0);
+  }
+};
+
+// Streaming writer of 32 bit float stereo. WAV sizes are filled on `close()`.
+class AudioWriter {
+public:
+  void open(const std::string &path, uint32_t sampleRate)
+  {
+    this->path = path;
+    file = openFile(path, "wb");
+    isWav = !isRawPath(path);
+    if (isWav) writeHeader(sampleRate, 0);
+  }
+
+  void write(const float *in0, const float *in1, size_t length)
+  {
+    buffer.resize(2 * length);
+    for (size_t i = 0; i < length; ++i) {
+      buffer[2 * i] = in0[i];
+      buffer[2 * i + 1] = in1[i];
+    }
+    const auto nWritten
+      = std::fwrite(buffer.data(), sizeof(float), buffer.size(), file.get());
+    if (nWritten != buffer.size()) throw std::runtime_error("Failed to write " + path);
+    nFrame += length;
+  }
+
+  void close()
+  {
+    if (isWav && std::fseek(file.get(), 0, SEEK_SET) == 0)
+      writeHeader(sampleRate, nFrame);
+    const bool isFailed = std::fclose(file.release()) != 0;
+    if (isFailed) throw std::runtime_error("Failed to write " + path);
+  }
+
+private:
+  std::string path;
+  FilePtr file;
+  bool isWav = true;
+  uint32_t sampleRate = 0;
+  uint64_t nFrame = 0;
+  std::vector<float> buffer;
+
+  void writeHeader(uint32_t sampleRate, uint64_t nFrame)
+  {
+    this->sampleRate = sampleRate;
+
+    // Sizes are clamped at 4 GiB limit of RIFF. Samples past the limit are still written.
+    constexpr uint64_t maxDataSize = std::numeric_limits<uint32_t>::max() - 36;
+    const uint32_t dataSize = uint32_t(std::min<uint64_t>(8 * nFrame, maxDataSize));
+    uint8_t header[44];
+    auto put16 = [&](size_t pos, uint16_t v) { std::memcpy(header + pos, &v, 2); };
+    auto put32 = [&](size_t pos, uint32_t v) { std::memcpy(header + pos, &v, 4); };
+    std::memcpy(header, "RIFF", 4);
+    put32(4, 36 + dataSize);
+    std::memcpy(header + 8, "WAVEfmt ", 8);
+    put32(16, 16);
+    put16(20, 3); // IEEE float.
+    put16(22, 2);
+    put32(24, sampleRate);
+    put32(28, 8 * sampleRate);
+    put16(32, 8);
+    put16(34, 32);
+    std::memcpy(header + 36, "data", 4);
+    put32(40, dataSize);
+    if (std::fwrite(header, 1, 44, file.get()) != 44)
+      throw std::runtime_error("Failed to write " + path);
+  }
+};
+
+struct MidiEvent {
+  uint64_t frame;
+  uint8_t status; // 0xff is tempo change.
+  uint8_t data1;
+  uint8_t data2;
+  float tempo;
+};
+
+/**
+Reads note on, note off, pitch bend and tempo from standard MIDI file of format 0 or 1.
+Events on all tracks and channels are merged, and sorted by time.
+*/
+std::vector<MidiEvent> readMidiFile(const std::string &path, double sampleRate)
+{
+  std::ifstream ifs(path, std::ios::binary);
+  if (!ifs.is_open()) throw std::runtime_error("Failed to open " + path);
+  const std::vector<uint8_t> data(
+    (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+  size_t pos = 0;
+  auto fail = [&]() { throw std::runtime_error(path + ": Broken MIDI file."); };
+  auto need = [&](size_t n) {
+    if (pos + n > data.size()) fail();
+  };
+  auto u8 = [&]() {
+    need(1);
+    return data[pos++];
+  };
+  auto u16 = [&]() {
+    const uint16_t hi = u8();
+    return uint16_t(hi << 8 | u8());
+  };
+  auto u32 = [&]() {
+    const uint32_t hi = u16();
+    return hi << 16 | u16();
+  };
+  auto varLen = [&]() {
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+      const uint8_t byte = u8();
+      value = value << 7 | (byte & 0x7f);
+      if (!(byte & 0x80)) return value;
+    }
+    fail();
+    return value;
+  };
+
+  need(14);
+  if (std::memcmp(data.data(), "MThd", 4) != 0) fail();
+  pos = 4;
+  const uint32_t headerSize = u32();
+  const uint16_t format = u16();
+  const uint16_t nTrack = u16();
+  const uint16_t division = u16();
+  if (format > 1) throw std::runtime_error(path + ": MIDI format 2 is not supported.");
+  pos = 8 + headerSize;
+
+  struct TickEvent {
+    uint64_t tick;
+    MidiEvent event;
+  };
+  std::vector<TickEvent> events;
+
+  for (uint16_t track = 0; track < nTrack; ++track) {
+    need(8);
+    const bool isTrack = std::memcmp(data.data() + pos, "MTrk", 4) == 0;
+    pos += 4;
+    const uint32_t size = u32();
+    const size_t end = pos + size;
+    if (end > data.size()) fail();
+    if (!isTrack) {
+      pos = end;
+      continue;
+    }
+
+    uint64_t tick = 0;
+    uint8_t status = 0;
+    while (pos < end) {
+      tick += varLen();
+      uint8_t byte = u8();
+      if (byte == 0xff) {
+        const uint8_t type = u8();
+        const uint32_t size = varLen();
+        need(size);
+        if (type == 0x51 && size == 3) {
+          const uint32_t usPerBeat = data[pos] << 16 | data[pos + 1] << 8 | data[pos + 2];
+          if (usPerBeat > 0)
+            events.push_back({tick, {0, 0xff, 0, 0, float(60e6 / usPerBeat)}});
+        }
+        pos += size;
+        if (type == 0x2f) break; // End of track.
+        continue;
+      }
+      if (byte == 0xf0 || byte == 0xf7) {
+        const uint32_t size = varLen();
+        need(size);
+        pos += size;
+        continue;
+      }
+
+      // Running status reuses the last status byte.
+      if (byte & 0x80) {
+        status = byte;
+        byte = u8();
+      } else if (status == 0) {
+        fail();
+      }
+      const uint8_t type = status & 0xf0;
+      const uint8_t data2 = type == 0xc0 || type == 0xd0 ? 0 : u8();
+      if (type == 0x80 || type == 0x90 || type == 0xe0)
+        events.push_back({tick, {0, type, byte, data2, 0}});
+    }
+    pos = end;
+  }
+
+  // Stable sort keeps the order of events at same tick, and track 0 comes first.
+  std::stable_sort(events.begin(), events.end(), [](const auto &a, const auto &b) {
+    return a.tick < b.tick;
+  });
+
+  // Tempo map applies to all tracks. SMPTE division doesn't depend on tempo.
+  double secondsPerTick;
+  const bool isSmpte = division & 0x8000;
+  if (isSmpte) {
+    const int fps = -int8_t(division >> 8);
+    secondsPerTick = 1.0 / (fps * (division & 0xff));
+  } else {
+    if (division == 0) fail();
+    secondsPerTick = 0.5 / division;
+  }
+
+  std::vector<MidiEvent> result;
+  result.reserve(events.size());
+  uint64_t lastTick = 0;
+  double seconds = 0;
+  for (auto &ev : events) {
+    seconds += (ev.tick - lastTick) * secondsPerTick;
+    lastTick = ev.tick;
+    if (ev.event.status == 0xff && !isSmpte)
+      secondsPerTick = 60.0 / (ev.event.tempo * (division & 0x7fff));
+    ev.event.frame = uint64_t(std::llround(seconds * sampleRate));
+    result.push_back(ev.event);
+  }
+  return result;
+}
+
+// Set in `main()` before options are parsed.
+std::filesystem::path executableDir;
+
+using PresetRow = std::array<double, ParameterID::ID_ENUM_LENGTH>;
+
+struct Options {
+  std::string outputPath;
+  std::string inputPath;
+  std::string midiPath;
+  std::string presetPath;
+  std::string presetName = "Default";
+  std::string typesPath = (executableDir / PLUGIN_NAME ".type.json").string();
+  std::vector<std::string> paramsPaths;
+  std::vector<std::pair<std::string, std::string>> params;
+  double sampleRate = 0;
+  size_t blockSize = 4096;
+  double length = -1;
+  double tail = 2;
+  float tempo = 120.0f;
+  PresetRow parameters;
+};
+
+// Quoted text can contain spaces. `#` outside of quote starts a comment.
+std::vector<std::string> splitLine(const std::string &line)
+{
+  std::vector<std::string> tokens;
+  std::string token;
+  bool isQuoted = false;
+  bool hasToken = false;
+  for (char c : line) {
+    if (c == '"') {
+      isQuoted = !isQuoted;
+      hasToken = true;
+    } else if (!isQuoted && c == '#') {
+      break;
+    } else if (!isQuoted && std::isspace(static_cast<unsigned char>(c))) {
+      if (hasToken) tokens.push_back(std::move(token));
+      token.clear();
+      hasToken = false;
+    } else {
+      token += c;
+      hasToken = true;
+    }
+  }
+  if (hasToken) tokens.push_back(std::move(token));
+  return tokens;
+}
+
+/**
+Collects `--preset`, `--params` and `-p` into a row, which has the same layout as the rows
+of `presetBank`. Later values overwrite former ones.
+*/
+PresetRow readParameters(const Options &opt)
+{
+  PresetRow row;
+  row.fill(-1.0); // presetKeep.
+  if (opt.presetPath.empty() && opt.paramsPaths.empty() && opt.params.empty()) return row;
+
+  // Names are same as `*.preset.json`, which are not stored in GlobalParameter.
+  std::unordered_map<std::string, size_t> index;
+  std::ifstream types(opt.typesPath);
+  if (!types.is_open())
+    throw std::runtime_error(
+      "Failed to open " + opt.typesPath + ". Run preset/extractparameter.py first.");
+  const auto typeJson = nlohmann::json::parse(types);
+  for (const auto &item : typeJson.items()) {
+    const size_t position = item.value().at("position").get<size_t>();
+    if (position >= row.size())
+      throw std::runtime_error(opt.typesPath + " doesn't match to parameter.hpp.");
+    index[item.key()] = position;
+  }
+
+  auto set = [&](const std::string &name, double value, const std::string &source) {
+    auto it = index.find(name);
+    if (it == index.end())
+      throw std::runtime_error(source + ": Unknown parameter " + name);
+    row[it->second] = std::max(0.0, value);
+  };
+
+  if (!opt.presetPath.empty()) {
+    std::ifstream ifs(opt.presetPath);
+    if (!ifs.is_open()) throw std::runtime_error("Failed to open " + opt.presetPath);
+    const auto presets = nlohmann::json::parse(ifs);
+    auto preset = std::find_if(presets.begin(), presets.end(), [&](const auto &p) {
+      return p.at("name") == opt.presetName;
+    });
+    if (preset == presets.end())
+      throw std::runtime_error(
+        opt.presetPath + ": Preset " + opt.presetName + " is not found.");
+    for (const auto &item : preset->at("parameter").items()) {
+      // Same as `preset/jsontocpp.py`.
+      const auto &name = item.key();
+      if (name == "bypass") {
+        if (index.count(name)) row[index[name]] = 0.0;
+        continue;
+      }
+      set(name, item.value().get<double>(), opt.presetPath);
+    }
+  }
+
+  for (const auto &path : opt.paramsPaths) {
+    std::ifstream ifs(path);
+    if (!ifs.is_open()) throw std::runtime_error("Failed to open " + path);
+    std::string line;
+    while (std::getline(ifs, line)) {
+      const auto tokens = splitLine(line);
+      if (tokens.empty()) continue;
+      if (tokens.size() != 2) throw std::runtime_error(path + ": Invalid line: " + line);
+      set(tokens[0], std::stod(tokens[1]), path);
+    }
+  }
+
+  for (const auto &[name, value] : opt.params) set(name, std::stod(value), "-p");
+  return row;
+}
+
+Options parseOptions(const std::vector<std::string> &args)
+{
+  Options opt;
+  for (size_t i = 0; i < args.size(); ++i) {
+    const auto &arg = args[i];
+    auto next = [&]() -> const std::string & {
+      if (++i >= args.size()) throw std::runtime_error("Missing value of " + arg);
+      return args[i];
+    };
+    auto number = [&]() {
+      const auto &text = next();
+      try {
+        return std::stod(text);
+      } catch (const std::exception &) {
+        throw std::runtime_error("Invalid number for " + arg + ": " + text);
+      }
+    };
+
+    if (arg == "-o") {
+      opt.outputPath = next();
+    } else if (arg == "-i") {
+      opt.inputPath = next();
+    } else if (arg == "-m") {
+      opt.midiPath = next();
+    } else if (arg == "-r") {
+      opt.sampleRate = number();
+    } else if (arg == "-b") {
+      opt.blockSize = size_t(std::max(1.0, number()));
+    } else if (arg == "-t") {
+      opt.length = number();
+    } else if (arg == "--tail") {
+      opt.tail = std::max(0.0, number());
+    } else if (arg == "--tempo") {
+      opt.tempo = float(number());
+    } else if (arg == "--preset") {
+      opt.presetPath = next();
+    } else if (arg == "--preset-name") {
+      opt.presetName = next();
+    } else if (arg == "--types") {
+      opt.typesPath = next();
+    } else if (arg == "--params") {
+      opt.paramsPaths.push_back(next());
+    } else if (arg == "-p") {
+      const auto &text = next();
+      const auto eq = text.find('=');
+      if (eq == std::string::npos)
+        throw std::runtime_error("-p takes NAME=VALUE: " + text);
+      opt.params.emplace_back(text.substr(0, eq), text.substr(eq + 1));
+    } else {
+      throw std::runtime_error("Unknown option " + arg);
+    }
+  }
+
+  if (opt.outputPath.empty()) throw std::runtime_error("Output path (-o) is missing.");
+#if PLUGIN_IS_SYNTH
+  if (!opt.inputPath.empty()) throw std::runtime_error("Synth doesn't take input (-i).");
+  if (opt.midiPath.empty() && opt.length < 0)
+    throw std::runtime_error("MIDI file (-m) or length (-t) is required.");
+#else
+  if (opt.inputPath.empty()) throw std::runtime_error("Input path (-i) is missing.");
+  if (!opt.midiPath.empty()) throw std::runtime_error("Effect doesn't take MIDI (-m).");
+#endif
+
+  opt.parameters = readParameters(opt);
+  return opt;
+}
+
+struct Result {
+  uint64_t nFrame = 0;
+  double sampleRate = 0;
+};
+
+Result render(const Options &opt)
+{
+  AudioReader reader;
+  if (!opt.inputPath.empty()) reader.open(opt.inputPath);
+  double sampleRate = opt.sampleRate;
+  if (sampleRate <= 0) sampleRate = reader.sampleRate > 0 ? reader.sampleRate : 48000;
+  if (reader.sampleRate > 0 && reader.sampleRate != sampleRate)
+    throw std::runtime_error(opt.inputPath + ": Sample rate doesn't match to -r.");
+
+  std::vector<MidiEvent> events;
+  if (!opt.midiPath.empty()) events = readMidiFile(opt.midiPath, sampleRate);
+
+  auto dsp = createDSP();
+  dsp->param.value.load(opt.parameters);
+  dsp->setup(sampleRate);
+  refreshTable(*dsp);
+  dsp->startup();
+
+  AudioWriter writer;
+  writer.open(opt.outputPath, uint32_t(sampleRate));
+
+  const size_t blockSize = opt.blockSize;
+  std::vector<float> buffer(4 * blockSize);
+  float *in0 = buffer.data();
+  float *in1 = in0 + blockSize;
+  float *out0 = in1 + blockSize;
+  float *out1 = out0 + blockSize;
+
+  const uint64_t tailFrames = uint64_t(opt.tail * sampleRate);
+  const uint64_t limit = opt.length >= 0 ? uint64_t(opt.length * sampleRate)
+                                         : std::numeric_limits<uint64_t>::max();
+  uint64_t frame = 0;
+
+#if PLUGIN_IS_SYNTH
+  const uint64_t endFrame = opt.length >= 0
+    ? limit
+    : (events.empty() ? 0 : events.back().frame) + tailFrames;
+
+  // Same as `handleMidi()` in plugin.cpp, except that 0 velocity note on is note off.
+  std::vector<std::pair<uint8_t, int32_t>> lastNoteId;
+  std::vector<uint8_t> alreadyRecievedNote;
+  int32_t noteId = 0;
+  float tempo = opt.tempo;
+  size_t next = 0;
+
+  while (frame < endFrame) {
+    // Block is split at pitch bend and tempo change. They are applied to whole block.
+    uint64_t blockEnd = std::min<uint64_t>(frame + blockSize, endFrame);
+    for (size_t i = next; i < events.size() && events[i].frame < blockEnd; ++i) {
+      const auto status = events[i].status;
+      if (events[i].frame > frame && (status == 0xe0 || status == 0xff)) {
+        blockEnd = events[i].frame;
+        break;
+      }
+    }
+
+    for (; next < events.size() && events[next].frame < blockEnd; ++next) {
+      const auto &ev = events[next];
+      const uint32_t offset = uint32_t(ev.frame - frame);
+      if (ev.status == 0x80 || (ev.status == 0x90 && ev.data2 == 0)) {
+        auto it = std::find_if(lastNoteId.begin(), lastNoteId.end(), [&](const auto &p) {
+          return p.first == ev.data1;
+        });
+        if (it == lastNoteId.end()) continue;
+        dsp->pushMidiNote(false, offset, it->second, 0, 0, 0);
+        lastNoteId.erase(it);
+      } else if (ev.status == 0x90) {
+        auto &received = alreadyRecievedNote;
+        if (std::find(received.begin(), received.end(), ev.data1) != received.end())
+          continue;
+        dsp->pushMidiNote(
+          true, offset, noteId, ev.data1, 0.0f, ev.data2 / float(INT8_MAX));
+        lastNoteId.emplace_back(ev.data1, noteId);
+        alreadyRecievedNote.push_back(ev.data1);
+        ++noteId;
+      } else if (ev.status == 0xe0) {
+        dsp->param.value[ParameterID::pitchBend]->setFromFloat(
+          ((uint16_t(ev.data2) << 7) + ev.data1) / 16384.0f);
+      } else if (ev.status == 0xff) {
+        tempo = ev.tempo;
+      }
+    }
+    alreadyRecievedNote.resize(0);
+
+    const size_t length = size_t(blockEnd - frame);
+    setParameters(*dsp, tempo);
+    dsp->process(length, out0, out1);
+    writer.write(out0, out1, length);
+    frame += length;
+  }
+#else
+  bool isInputEnded = false;
+  uint64_t tailLeft = tailFrames;
+  while (frame < limit) {
+    size_t length = size_t(std::min<uint64_t>(blockSize, limit - frame));
+    const size_t nRead = isInputEnded ? 0 : reader.read(in0, in1, length);
+    if (nRead < length) {
+      // With -t, output is padded to the length regardless of tail.
+      if (!isInputEnded && opt.length >= 0)
+        tailLeft = std::numeric_limits<uint64_t>::max();
+      isInputEnded = true;
+
+      length = nRead + size_t(std::min<uint64_t>(length - nRead, tailLeft));
+      tailLeft -= length - nRead;
+      std::fill(in0 + nRead, in0 + length, 0.0f);
+      std::fill(in1 + nRead, in1 + length, 0.0f);
+      if (length == 0) break;
+    }
+
+    setParameters(*dsp, opt.tempo);
+    dsp->process(length, in0, in1, out0, out1);
+    writer.write(out0, out1, length);
+    frame += length;
+  }
+#endif
+
+  writer.close();
+  return {frame, sampleRate};
+}
+
+// `argv[0]` may be a name found in `PATH`, so `/proc/self/exe` is tried first.
+std::filesystem::path getExecutableDir(const char *argv0)
+{
+  std::error_code err;
+  auto path = std::filesystem::read_symlink("/proc/self/exe", err);
+  if (err) path = std::filesystem::absolute(argv0, err);
+  return path.parent_path();
+}
+
+int main(int argc, char **argv)
+{
+  executableDir = getExecutableDir(argv[0]);
+
+  std::vector<std::string> common;
+  std::string jobsPath;
+  size_t nThread = std::max(1u, std::thread::hardware_concurrency());
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg(argv[i]);
+    if (arg == "-h" || arg == "--help") {
+      std::cout << usage;
+      return EXIT_SUCCESS;
+    } else if (arg == "--jobs" && i + 1 < argc) {
+      jobsPath = argv[++i];
+    } else if (arg == "-j" && i + 1 < argc) {
+      nThread = size_t(std::max(1, std::atoi(argv[++i])));
+    } else {
+      common.push_back(arg);
+    }
+  }
+
+  // Options are parsed before rendering, so a typo doesn't waste a long batch.
+  std::vector<std::string> labels;
+  std::vector<Options> jobs;
+  try {
+    if (jobsPath.empty()) {
+      labels.push_back("render");
+      jobs.push_back(parseOptions(common));
+    } else {
+      std::ifstream ifs(jobsPath);
+      if (!ifs.is_open()) throw std::runtime_error("Failed to open " + jobsPath);
+      std::string line;
+      for (size_t lineNumber = 1; std::getline(ifs, line); ++lineNumber) {
+        auto args = splitLine(line);
+        if (args.empty()) continue;
+        args.insert(args.begin(), common.begin(), common.end());
+        labels.push_back(jobsPath + ":" + std::to_string(lineNumber));
+        try {
+          jobs.push_back(parseOptions(args));
+        } catch (const std::exception &e) {
+          throw std::runtime_error(labels.back() + ": " + e.what());
+        }
+      }
+    }
+  } catch (const std::exception &e) {
+    std::cerr << "Error: " << e.what() << "\n\n" << usage;
+    return EXIT_FAILURE;
+  }
+
+  // Each job has its own DSP instance. Jobs are taken in order by idle threads.
+  std::atomic<size_t> nextJob{0};
+  std::atomic<bool> isFailed{false};
+  std::mutex outputMutex;
+  auto work = [&]() {
+    for (size_t i = nextJob++; i < jobs.size(); i = nextJob++) {
+      const auto start = std::chrono::steady_clock::now();
+      std::ostringstream os;
+      try {
+        const auto result = render(jobs[i]);
+        const std::chrono::duration<double> elapsed
+          = std::chrono::steady_clock::now() - start;
+        const double seconds = result.nFrame / result.sampleRate;
+        os << labels[i] << ": " << jobs[i].outputPath << ", " << seconds << " s in "
+           << elapsed.count() << " s (" << seconds / elapsed.count() << "x realtime)\n";
+      } catch (const std::exception &e) {
+        os << labels[i] << ": Error: " << e.what() << "\n";
+        isFailed = true;
+      }
+      std::lock_guard<std::mutex> lock(outputMutex);
+      std::cout << os.str() << std::flush;
+    }
+  };
+
+  std::vector<std::thread> workers;
+  nThread = std::min(nThread, jobs.size());
+  for (size_t i = 1; i < nThread; ++i) workers.emplace_back(work);
+  work();
+  for (auto &worker : workers) worker.join();
+
+  return isFailed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,63 @@
+#!/bin/bash
+#
+# Checks that multi-thread voice rendering is deterministic. Renders a fixed scenario with
+# `multiThread` on, several times, with and without busy threads which preempt workers.
+# Preempted workers miss the deadline, and their voices are rendered inline. All renders
+# must be bit-identical. When the last column is 1, render with `multiThread` off must
+# also be bit-identical. Exits with non-zero status when any plugin fails.
+#
+# Usage:
+#   ./build.sh                       # Check all plugins.
+#   ./build.sh IterativeSinCluster   # Check specified plugins.
+#
+# CubicPadSynth requires `lib/fftw3/libfftw3f.a`. See README.md.
+#
+
+# Name, single-thread render must match (1 or 0).
+#
+# CollidingCombSynth has a separate single-thread path which shares one noise generator
+# across notes, so its output differs.
+PLUGINS=(
+  "CollidingCombSynth 0"
+  "CubicPadSynth 1"
+  "IterativeSinCluster 1"
+)
+
+function check() {
+  local name=$1
+  local isSingleMatching=$2
+  local buildDir="build/$name"
+  mkdir -p "$buildDir"
+
+  local libs=()
+  if [[ "$name" == "CubicPadSynth" ]]; then
+    libs+=(../../lib/fftw3/libfftw3f.a)
+  fi
+
+  echo Compiling "$name"
+  g++ -std=c++17 -O3 -Wall -msse2 -DTEST_BUILD \
+    -DPLUGIN_DSPCORE="\"../../$name/dsp/dspcore.hpp\"" \
+    -o "$buildDir/voicepool" \
+    "../../$name/dsp/dspcore.cpp" \
+    "../../$name/parameter.cpp" \
+    main.cpp \
+    "${libs[@]}" \
+    -lpthread || return 1
+
+  "$buildDir/voicepool" "$name" "$isSingleMatching"
+}
+
+cd "$(dirname "$0")" || exit 1
+
+failed=()
+for entry in "${PLUGINS[@]}"; do
+  read -r name isSingleMatching <<< "$entry"
+  if [[ $# -gt 0 && ! " $* " =~ " $name " ]]; then continue; fi
+  check "$name" "$isSingleMatching" || failed+=("$name")
+done
+
+if [[ ${#failed[@]} -gt 0 ]]; then
+  echo "Failed: ${failed[*]}"
+  exit 1
+fi
+echo "All passed."
@@ -0,0 +1,153 @@
+// Renders a fixed scenario with multi-thread voice rendering, and checks that the output
+// doesn't depend on scheduling.
+//
+// Build and run with `build.sh`, which sets `PLUGIN_DSPCORE`.
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include PLUGIN_DSPCORE
+
+constexpr size_t BUF_LEN = 256;
+constexpr size_t N_LOOP = 400;
+constexpr float sampleRate = 48000.0f;
+constexpr float tempo = 120.0f;
+
+template<typename T, typename = void> struct HasTempo : std::false_type {};
+template<typename T>
+struct HasTempo<T, std::void_t<decltype(std::declval<T &>().setParameters(tempo))>>
+  : std::true_type {};
+
+template<typename T, typename = void> struct HasTable : std::false_type {};
+template<typename T>
+struct HasTable<T, std::void_t<decltype(std::declval<T &>().refreshTable())>>
+  : std::true_type {};
+
+template<typename Dsp> void setParameters(Dsp &dsp)
+{
+  if constexpr (HasTempo<Dsp>::value) {
+    dsp.setParameters(tempo);
+  } else {
+    dsp.setParameters();
+  }
+}
+
+// Output is interleaved stereo.
+template<typename Dsp> std::vector<float> render(bool isMultiThread)
+{
+  // DSPCore is large, so it's allocated on heap. A new one is used for each render,
+  // because `reset()` doesn't clear all states.
+  auto dspPtr = std::make_unique<Dsp>();
+  auto &dsp = *dspPtr;
+
+  std::vector<float> wav;
+  wav.reserve(2 * BUF_LEN * N_LOOP);
+
+  dsp.param.value[ParameterID::multiThread]->setFromInt(isMultiThread);
+  dsp.setup(sampleRate);
+  if constexpr (HasTable<Dsp>::value) {
+    dsp.refreshTable();
+    dsp.refreshLfo();
+  }
+  dsp.startup();
+
+  float out[2][BUF_LEN];
+  for (size_t i = 0; i < N_LOOP; ++i) {
+    // Many voices to make many tasks. A note at odd frame splits voice block.
+    if (i == 0) {
+      for (int32_t n = 0; n < 8; ++n) dsp.pushMidiNote(true, 0, n, 48 + 3 * n, 0, 0.8f);
+    }
+    if (i == 40) dsp.pushMidiNote(true, 77, 8, 67, 0.25f, 0.5f);
+    if (i == 200) {
+      for (int32_t n = 0; n < 9; ++n) dsp.pushMidiNote(false, 13, n, 0, 0, 0);
+    }
+
+    setParameters(dsp);
+    dsp.process(BUF_LEN, out[0], out[1]);
+
+    for (size_t j = 0; j < BUF_LEN; ++j) {
+      wav.push_back(out[0][j]);
+      wav.push_back(out[1][j]);
+    }
+  }
+  return wav;
+}
+
+// Busy threads at normal priority. Workers are preempted by them.
+class Stress {
+public:
+  Stress()
+  {
+    const size_t nThread = 2 * std::max(1u, std::thread::hardware_concurrency());
+    for (size_t i = 0; i < nThread; ++i) {
+      threads.emplace_back([this]() {
+        volatile uint64_t counter = 0;
+        while (isRunning.load(std::memory_order_relaxed)) counter = counter + 1;
+      });
+    }
+  }
+
+  ~Stress()
+  {
+    isRunning.store(false);
+    for (auto &th : threads) th.join();
+  }
+
+private:
+  std::atomic<bool> isRunning{true};
+  std::vector<std::thread> threads;
+};
+
+size_t countMismatch(const std::vector<float> &a, const std::vector<float> &b)
+{
+  if (a.size() != b.size()) return std::max(a.size(), b.size());
+  size_t count = 0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i] != b[i] || !std::isfinite(a[i])) ++count;
+  }
+  return count;
+}
+
+// Usage: main NAME IS_SINGLE_MATCHING
+int main(int argc, char **argv)
+{
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0] << " NAME IS_SINGLE_MATCHING\n";
+    return EXIT_FAILURE;
+  }
+  const std::string name(argv[1]);
+  const bool isSingleMatching = std::atoi(argv[2]) != 0;
+
+  const auto reference = render<DSPCore_SSE2>(true);
+
+  bool isPassed = true;
+  auto compare = [&](const char *label, const std::vector<float> &wav) {
+    const auto nMismatch = countMismatch(reference, wav);
+    isPassed &= nMismatch == 0;
+    std::cout << name << " " << label << ": " << nMismatch << " samples differ"
+              << (nMismatch == 0 ? "" : " FAIL") << "\n";
+  };
+
+  // VoicePool doesn't start workers on single core CPU.
+  if (std::thread::hardware_concurrency() <= 1)
+    std::cout << name << ": Only 1 hardware thread. Worker path is not tested.\n";
+
+  for (int i = 0; i < 3; ++i) compare("multi-thread", render<DSPCore_SSE2>(true));
+  {
+    Stress stress;
+    for (int i = 0; i < 3; ++i) {
+      compare("multi-thread with busy threads", render<DSPCore_SSE2>(true));
+    }
+  }
+  if (isSingleMatching) compare("single-thread", render<DSPCore_SSE2>(false));
+
+  return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}